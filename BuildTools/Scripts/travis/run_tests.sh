@@ -1,5 +1,8 @@
 if [ "$TRAVIS_OS_NAME" = "linux" ]; then
     $1/Tests/DiligentCoreTest/DiligentCoreTest || return
+    if [ -n "$API_TEST_MODE" ]; then
+        $1/Tests/DiligentCoreAPITest/DiligentCoreAPITest --mode=$API_TEST_MODE || return
+    fi
 fi
 
 if [ "$TRAVIS_OS_NAME" = "osx" ]; then 
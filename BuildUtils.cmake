@@ -16,6 +16,9 @@ if(PLATFORM_WIN32 OR PLATFORM_UNIVERSAL_WINDOWS)
         if(METAL_SUPPORTED)
             list(APPEND ENGINE_DLLS Diligent-GraphicsEngineMetal-shared)
         endif()
+        if(NULL_SUPPORTED)
+            list(APPEND ENGINE_DLLS Diligent-GraphicsEngineNull-shared)
+        endif()
 
         foreach(DLL ${ENGINE_DLLS})
             add_custom_command(TARGET ${TARGET_NAME} POST_BUILD
@@ -243,6 +246,9 @@ function(get_supported_backends _TARGETS)
     if(METAL_SUPPORTED)
 	    list(APPEND BACKENDS Diligent-GraphicsEngineMetal-${LIB_TYPE})
     endif()
+    if(NULL_SUPPORTED)
+	    list(APPEND BACKENDS Diligent-GraphicsEngineNull-${LIB_TYPE})
+    endif()
     # ${_TARGETS} == ENGINE_LIBRARIES
     # ${${_TARGETS}} == ${ENGINE_LIBRARIES}
     set(${_TARGETS} ${${_TARGETS}} ${BACKENDS} PARENT_SCOPE)
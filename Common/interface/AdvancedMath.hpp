@@ -367,6 +367,56 @@ inline BoxVisibility GetBoxVisibility(const ViewFrustum&  ViewFrustum,
     return (NumPlanesInside == TotalPlanes) ? BoxVisibility::FullyVisible : BoxVisibility::Intersecting;
 }
 
+// Tests if all frustum corners are outside of one of the bounding box planes, which
+// means that the box is invisible even though it intersects every frustum plane
+inline bool AreFrustumCornersOutsideBox(const ViewFrustumExt& ViewFrustumExt, const BoundBox& Box)
+{
+    // This helps in the following situation:
+    //
+    //
+    //       .
+    //      /   '  .       .
+    //     / AABB  /   . ' |
+    //    /       /. '     |
+    //       ' . / |       |
+    //       * .   |       |
+    //           ' .       |
+    //               ' .   |
+    //                   ' .
+
+    // Test all frustum corners against every bound box plane
+    for (int iBoundBoxPlane = 0; iBoundBoxPlane < 6; ++iBoundBoxPlane)
+    {
+        // struct BoundBox
+        // {
+        //     float3 Min;
+        //     float3 Max;
+        // };
+        float CurrPlaneCoord = reinterpret_cast<const float*>(&Box)[iBoundBoxPlane];
+        // Bound box normal is one of the axis, so we just need to pick the right coordinate
+        int iCoordOrder = iBoundBoxPlane % 3; // 0, 1, 2, 0, 1, 2
+        // Since plane normal is directed along one of the axis, we only need to select
+        // if it is pointing in the positive (max planes) or negative (min planes) direction
+        float fSign              = (iBoundBoxPlane >= 3) ? +1.f : -1.f;
+        bool  bAllCornersOutside = true;
+        for (int iCorner = 0; iCorner < 8; iCorner++)
+        {
+            // Pick the frustum corner coordinate
+            float CurrCornerCoord = ViewFrustumExt.FrustumCorners[iCorner][iCoordOrder];
+            // Dot product is simply the coordinate difference multiplied by the sign
+            if (fSign * (CurrPlaneCoord - CurrCornerCoord) > 0)
+            {
+                bAllCornersOutside = false;
+                break;
+            }
+        }
+        if (bAllCornersOutside)
+            return true;
+    }
+
+    return false;
+}
+
 inline BoxVisibility GetBoxVisibility(const ViewFrustumExt& ViewFrustumExt,
                                       const BoundBox&       Box,
                                       FRUSTUM_PLANE_FLAGS   PlaneFlags = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM)
@@ -378,48 +428,9 @@ inline BoxVisibility GetBoxVisibility(const ViewFrustumExt& ViewFrustumExt,
     if ((PlaneFlags & FRUSTUM_PLANE_FLAG_FULL_FRUSTUM) == FRUSTUM_PLANE_FLAG_FULL_FRUSTUM)
     {
         // Additionally test if the whole frustum is outside one of
-        // the the bounding box planes. This helps in the following situation:
-        //
-        //
-        //       .
-        //      /   '  .       .
-        //     / AABB  /   . ' |
-        //    /       /. '     |
-        //       ' . / |       |
-        //       * .   |       |
-        //           ' .       |
-        //               ' .   |
-        //                   ' .
-
-        // Test all frustum corners against every bound box plane
-        for (int iBoundBoxPlane = 0; iBoundBoxPlane < 6; ++iBoundBoxPlane)
-        {
-            // struct BoundBox
-            // {
-            //     float3 Min;
-            //     float3 Max;
-            // };
-            float CurrPlaneCoord = reinterpret_cast<const float*>(&Box)[iBoundBoxPlane];
-            // Bound box normal is one of the axis, so we just need to pick the right coordinate
-            int iCoordOrder = iBoundBoxPlane % 3; // 0, 1, 2, 0, 1, 2
-            // Since plane normal is directed along one of the axis, we only need to select
-            // if it is pointing in the positive (max planes) or negative (min planes) direction
-            float fSign              = (iBoundBoxPlane >= 3) ? +1.f : -1.f;
-            bool  bAllCornersOutside = true;
-            for (int iCorner = 0; iCorner < 8; iCorner++)
-            {
-                // Pick the frustum corner coordinate
-                float CurrCornerCoord = ViewFrustumExt.FrustumCorners[iCorner][iCoordOrder];
-                // Dot product is simply the coordinate difference multiplied by the sign
-                if (fSign * (CurrPlaneCoord - CurrCornerCoord) > 0)
-                {
-                    bAllCornersOutside = false;
-                    break;
-                }
-            }
-            if (bAllCornersOutside)
-                return BoxVisibility::Invisible;
-        }
+        // the the bounding box planes.
+        if (AreFrustumCornersOutsideBox(ViewFrustumExt, Box))
+            return BoxVisibility::Invisible;
     }
 
     return BoxVisibility::Intersecting;
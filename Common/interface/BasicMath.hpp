@@ -53,6 +53,7 @@
 #include <iostream>
 
 #include "HashUtils.hpp"
+#include "BasicMathSIMD.hpp"
 
 #ifdef _MSC_VER
 #    pragma warning(push)
@@ -1616,6 +1617,76 @@ template <class T> struct Matrix4x4
     }
 };
 
+#if DILIGENT_SIMD_MATH
+
+// Vectorized specializations for float.
+// Multiplications accumulate in the same order as the scalar templates and produce identical
+// results unless FMA is enabled. Inverse and determinant use 2x2 block decomposition and
+// match the scalar cofactor expansion within rounding tolerance.
+
+template <>
+inline Vector4<float> Vector4<float>::operator*(const Matrix4x4<float>& m) const
+{
+    Vector4<float> out;
+    SIMD::Store(out.Data(),
+                SIMD::MulVecMat(SIMD::Load(Data()),
+                                SIMD::Load(m.m[0]), SIMD::Load(m.m[1]), SIMD::Load(m.m[2]), SIMD::Load(m.m[3])));
+    return out;
+}
+
+template <>
+inline Matrix4x4<float> Matrix4x4<float>::Mul(const Matrix4x4<float>& m1, const Matrix4x4<float>& m2)
+{
+    Matrix4x4<float> mOut;
+#    if DILIGENT_SIMD_MATH_AVX
+    // Two rows of m1 per iteration
+    const auto r0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2.m[0]));
+    const auto r1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2.m[1]));
+    const auto r2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2.m[2]));
+    const auto r3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2.m[3]));
+    for (int i = 0; i < 4; i += 2)
+    {
+        const auto a = _mm256_loadu_ps(m1.m[i]);
+
+        auto out = _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0x00), r0);
+#        ifdef __FMA__
+        out = _mm256_fmadd_ps(_mm256_shuffle_ps(a, a, 0x55), r1, out);
+        out = _mm256_fmadd_ps(_mm256_shuffle_ps(a, a, 0xAA), r2, out);
+        out = _mm256_fmadd_ps(_mm256_shuffle_ps(a, a, 0xFF), r3, out);
+#        else
+        out = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(a, a, 0x55), r1), out);
+        out = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(a, a, 0xAA), r2), out);
+        out = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(a, a, 0xFF), r3), out);
+#        endif
+        _mm256_storeu_ps(mOut.m[i], out);
+    }
+#    else
+    const auto r0 = SIMD::Load(m2.m[0]);
+    const auto r1 = SIMD::Load(m2.m[1]);
+    const auto r2 = SIMD::Load(m2.m[2]);
+    const auto r3 = SIMD::Load(m2.m[3]);
+    for (int i = 0; i < 4; ++i)
+        SIMD::Store(mOut.m[i], SIMD::MulVecMat(SIMD::Load(m1.m[i]), r0, r1, r2, r3));
+#    endif
+    return mOut;
+}
+
+template <>
+inline float Matrix4x4<float>::Determinant() const
+{
+    return SIMD::GetX(SIMD::Matrix4x4Blocks{Data()}.DetM);
+}
+
+template <>
+inline Matrix4x4<float> Matrix4x4<float>::Inverse() const
+{
+    Matrix4x4<float> inv;
+    SIMD::InverseMatrix4x4(Data(), inv.Data());
+    return inv;
+}
+
+#endif
+
 // Template Vector Operations
 
 
@@ -1802,6 +1873,23 @@ Vector4<T> operator*(const Matrix4x4<T>& m, const Vector4<T>& v)
     return out;
 }
 
+#if DILIGENT_SIMD_MATH
+template <>
+inline Vector4<float> operator*(const Matrix4x4<float>& m, const Vector4<float>& v)
+{
+    // Transposing the matrix turns dot products with the rows into a linear combination of the columns
+    auto c0 = SIMD::Load(m.m[0]);
+    auto c1 = SIMD::Load(m.m[1]);
+    auto c2 = SIMD::Load(m.m[2]);
+    auto c3 = SIMD::Load(m.m[3]);
+    SIMD::Transpose(c0, c1, c2, c3);
+
+    Vector4<float> out;
+    SIMD::Store(out.Data(), SIMD::MulVecMat(SIMD::Load(v.Data()), c0, c1, c2, c3));
+    return out;
+}
+#endif
+
 template <class T>
 Vector3<T> operator*(const Matrix3x3<T>& m, Vector3<T>& v)
 {
@@ -1849,6 +1937,102 @@ using double3x3 = Matrix3x3<double>;
 using double2x2 = Matrix2x2<double>;
 
 
+/// Transforms an array of row vectors: pDst[i] = pSrc[i] * m.
+
+/// pSrc and pDst may point to the same array.
+inline void TransformVectors(const float4* pSrc, float4* pDst, size_t Count, const float4x4& m)
+{
+    size_t i = 0;
+#if DILIGENT_SIMD_MATH
+#    if DILIGENT_SIMD_MATH_AVX
+    {
+        const auto r0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m[0]));
+        const auto r1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m[1]));
+        const auto r2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m[2]));
+        const auto r3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m[3]));
+        for (; i + 2 <= Count; i += 2)
+        {
+            const auto v = _mm256_loadu_ps(pSrc[i].Data());
+
+            auto out = _mm256_mul_ps(_mm256_shuffle_ps(v, v, 0x00), r0);
+#        ifdef __FMA__
+            out = _mm256_fmadd_ps(_mm256_shuffle_ps(v, v, 0x55), r1, out);
+            out = _mm256_fmadd_ps(_mm256_shuffle_ps(v, v, 0xAA), r2, out);
+            out = _mm256_fmadd_ps(_mm256_shuffle_ps(v, v, 0xFF), r3, out);
+#        else
+            out = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(v, v, 0x55), r1), out);
+            out = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(v, v, 0xAA), r2), out);
+            out = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(v, v, 0xFF), r3), out);
+#        endif
+            _mm256_storeu_ps(pDst[i].Data(), out);
+        }
+    }
+#    endif
+    const auto r0 = SIMD::Load(m.m[0]);
+    const auto r1 = SIMD::Load(m.m[1]);
+    const auto r2 = SIMD::Load(m.m[2]);
+    const auto r3 = SIMD::Load(m.m[3]);
+    for (; i < Count; ++i)
+        SIMD::Store(pDst[i].Data(), SIMD::MulVecMat(SIMD::Load(pSrc[i].Data()), r0, r1, r2, r3));
+#endif
+    for (; i < Count; ++i)
+        pDst[i] = pSrc[i] * m;
+}
+
+/// Transforms an array of points to homogeneous coordinates: pDst[i] = float4{pSrc[i], 1} * m.
+
+/// This is the form required by e.g. clip-space tests, where the perspective division must not be performed.
+inline void TransformPoints(const float3* pSrc, float4* pDst, size_t Count, const float4x4& m)
+{
+    size_t i = 0;
+#if DILIGENT_SIMD_MATH
+    const auto r0 = SIMD::Load(m.m[0]);
+    const auto r1 = SIMD::Load(m.m[1]);
+    const auto r2 = SIMD::Load(m.m[2]);
+    const auto r3 = SIMD::Load(m.m[3]);
+    for (; i < Count; ++i)
+    {
+        // Components are broadcast individually, so that the 12-byte source is never over-read
+        auto out = SIMD::Mul(SIMD::Splat(pSrc[i].x), r0);
+        out      = SIMD::MulAdd(SIMD::Splat(pSrc[i].y), r1, out);
+        out      = SIMD::MulAdd(SIMD::Splat(pSrc[i].z), r2, out);
+        out      = SIMD::Add(r3, out);
+        SIMD::Store(pDst[i].Data(), out);
+    }
+#endif
+    for (; i < Count; ++i)
+        pDst[i] = float4{pSrc[i], 1} * m;
+}
+
+/// Transforms an array of points: pDst[i] = pSrc[i] * m, including the division by w.
+
+/// pSrc and pDst may point to the same array.
+inline void TransformPoints(const float3* pSrc, float3* pDst, size_t Count, const float4x4& m)
+{
+    size_t i = 0;
+#if DILIGENT_SIMD_MATH
+    const auto r0 = SIMD::Load(m.m[0]);
+    const auto r1 = SIMD::Load(m.m[1]);
+    const auto r2 = SIMD::Load(m.m[2]);
+    const auto r3 = SIMD::Load(m.m[3]);
+    for (; i < Count; ++i)
+    {
+        auto out = SIMD::Mul(SIMD::Splat(pSrc[i].x), r0);
+        out      = SIMD::MulAdd(SIMD::Splat(pSrc[i].y), r1, out);
+        out      = SIMD::MulAdd(SIMD::Splat(pSrc[i].z), r2, out);
+        out      = SIMD::Add(r3, out);
+        out      = SIMD::Div(out, SIMD::SplatLane<3>(out));
+
+        float4 f4;
+        SIMD::Store(f4.Data(), out);
+        pDst[i] = float3{f4.x, f4.y, f4.z};
+    }
+#endif
+    for (; i < Count; ++i)
+        pDst[i] = pSrc[i] * m;
+}
+
+
 struct Quaternion
 {
     float4 q;
@@ -0,0 +1,342 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Thin wrappers over the 4-wide float SIMD instructions of the target ISA that are used
+/// by the vectorized float specializations in BasicMath.hpp.
+///
+/// The instruction set is selected at compile time from the compiler's predefined macros:
+///   - DILIGENT_SIMD_MATH_SSE  - SSE2 (all x86-64 targets); AVX/FMA paths are additionally
+///                               enabled when the code is compiled with -mavx/-mfma or /arch:AVX2
+///   - DILIGENT_SIMD_MATH_NEON - NEON (ARMv7 with NEON, AArch64)
+///
+/// Define DILIGENT_NO_SIMD_MATH to force the scalar implementation.
+
+#if !defined(DILIGENT_NO_SIMD_MATH)
+#    if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define DILIGENT_SIMD_MATH_SSE 1
+#    elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#        define DILIGENT_SIMD_MATH_NEON 1
+#    endif
+#endif
+
+#if DILIGENT_SIMD_MATH_SSE
+#    include <emmintrin.h>
+#    if defined(__AVX__) || defined(__AVX2__)
+#        include <immintrin.h>
+#        define DILIGENT_SIMD_MATH_AVX 1
+#    endif
+#elif DILIGENT_SIMD_MATH_NEON
+#    include <arm_neon.h>
+#    include <cmath>
+#endif
+
+#if DILIGENT_SIMD_MATH_SSE || DILIGENT_SIMD_MATH_NEON
+#    define DILIGENT_SIMD_MATH 1
+#endif
+
+#if DILIGENT_SIMD_MATH
+
+namespace Diligent
+{
+
+namespace SIMD
+{
+
+#    if DILIGENT_SIMD_MATH_SSE
+
+using f32x4 = __m128;
+
+inline f32x4 Load(const float* p) { return _mm_loadu_ps(p); }
+inline void  Store(float* p, f32x4 v) { _mm_storeu_ps(p, v); }
+inline f32x4 Set(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+inline f32x4 Splat(float s) { return _mm_set1_ps(s); }
+
+inline f32x4 Add(f32x4 a, f32x4 b) { return _mm_add_ps(a, b); }
+inline f32x4 Sub(f32x4 a, f32x4 b) { return _mm_sub_ps(a, b); }
+inline f32x4 Mul(f32x4 a, f32x4 b) { return _mm_mul_ps(a, b); }
+inline f32x4 Div(f32x4 a, f32x4 b) { return _mm_div_ps(a, b); }
+inline f32x4 Min(f32x4 a, f32x4 b) { return _mm_min_ps(a, b); }
+inline f32x4 Max(f32x4 a, f32x4 b) { return _mm_max_ps(a, b); }
+inline f32x4 Sqrt(f32x4 a) { return _mm_sqrt_ps(a); }
+
+inline float GetX(f32x4 v) { return _mm_cvtss_f32(v); }
+
+// Comparisons return all-ones lanes where the condition holds and zero lanes otherwise
+inline f32x4 CmpLT(f32x4 a, f32x4 b) { return _mm_cmplt_ps(a, b); }
+inline f32x4 CmpGT(f32x4 a, f32x4 b) { return _mm_cmpgt_ps(a, b); }
+inline f32x4 And(f32x4 a, f32x4 b) { return _mm_and_ps(a, b); }
+inline f32x4 Or(f32x4 a, f32x4 b) { return _mm_or_ps(a, b); }
+
+/// Returns a where the mask lane is all ones and b where it is zero
+inline f32x4 Select(f32x4 mask, f32x4 a, f32x4 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+/// Returns the sign bits of the four lanes packed into the lower 4 bits of the result
+inline int MoveMask(f32x4 v) { return _mm_movemask_ps(v); }
+
+/// Returns {a[X], a[Y], b[Z], b[W]}
+template <int X, int Y, int Z, int W>
+inline f32x4 Shuffle(f32x4 a, f32x4 b)
+{
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+/// Transposes the 4x4 matrix whose rows are r0, r1, r2, r3
+inline void Transpose(f32x4& r0, f32x4& r1, f32x4& r2, f32x4& r3)
+{
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+}
+
+#    elif DILIGENT_SIMD_MATH_NEON
+
+using f32x4 = float32x4_t;
+
+inline f32x4 Load(const float* p) { return vld1q_f32(p); }
+inline void  Store(float* p, f32x4 v) { vst1q_f32(p, v); }
+inline f32x4 Set(float x, float y, float z, float w)
+{
+    const float v[] = {x, y, z, w};
+    return vld1q_f32(v);
+}
+inline f32x4 Splat(float s) { return vdupq_n_f32(s); }
+
+inline f32x4 Add(f32x4 a, f32x4 b) { return vaddq_f32(a, b); }
+inline f32x4 Sub(f32x4 a, f32x4 b) { return vsubq_f32(a, b); }
+inline f32x4 Mul(f32x4 a, f32x4 b) { return vmulq_f32(a, b); }
+
+inline f32x4 Div(f32x4 a, f32x4 b)
+{
+#        if defined(__aarch64__) || defined(_M_ARM64)
+    return vdivq_f32(a, b);
+#        else
+    // ARMv7 has no vector division: refine the reciprocal estimate with two Newton-Raphson steps
+    auto rcp = vrecpeq_f32(b);
+    rcp      = vmulq_f32(vrecpsq_f32(b, rcp), rcp);
+    rcp      = vmulq_f32(vrecpsq_f32(b, rcp), rcp);
+    return vmulq_f32(a, rcp);
+#        endif
+}
+
+inline f32x4 Min(f32x4 a, f32x4 b) { return vminq_f32(a, b); }
+inline f32x4 Max(f32x4 a, f32x4 b) { return vmaxq_f32(a, b); }
+
+inline f32x4 Sqrt(f32x4 a)
+{
+#        if defined(__aarch64__) || defined(_M_ARM64)
+    return vsqrtq_f32(a);
+#        else
+    // ARMv7 only has a reciprocal square root estimate, so use the correctly rounded scalar instruction
+    float v[4];
+    vst1q_f32(v, a);
+    return Set(std::sqrt(v[0]), std::sqrt(v[1]), std::sqrt(v[2]), std::sqrt(v[3]));
+#        endif
+}
+
+inline float GetX(f32x4 v) { return vgetq_lane_f32(v, 0); }
+
+// Comparisons return all-ones lanes where the condition holds and zero lanes otherwise
+inline f32x4 CmpLT(f32x4 a, f32x4 b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+inline f32x4 CmpGT(f32x4 a, f32x4 b) { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+inline f32x4 And(f32x4 a, f32x4 b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+inline f32x4 Or(f32x4 a, f32x4 b) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+
+/// Returns a where the mask lane is all ones and b where it is zero
+inline f32x4 Select(f32x4 mask, f32x4 a, f32x4 b) { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+
+/// Returns the sign bits of the four lanes packed into the lower 4 bits of the result
+inline int MoveMask(f32x4 v)
+{
+    static const uint32_t LaneBits[] = {1, 2, 4, 8};
+
+    const auto Bits = vandq_u32(vshrq_n_u32(vreinterpretq_u32_f32(v), 31), vld1q_u32(LaneBits));
+#        if defined(__aarch64__) || defined(_M_ARM64)
+    return static_cast<int>(vaddvq_u32(Bits));
+#        else
+    const auto Sum = vadd_u32(vget_low_u32(Bits), vget_high_u32(Bits));
+    return static_cast<int>(vget_lane_u32(vpadd_u32(Sum, Sum), 0));
+#        endif
+}
+
+/// Returns {a[X], a[Y], b[Z], b[W]}
+template <int X, int Y, int Z, int W>
+inline f32x4 Shuffle(f32x4 a, f32x4 b)
+{
+    auto r = vdupq_n_f32(vgetq_lane_f32(a, X));
+    r      = vsetq_lane_f32(vgetq_lane_f32(a, Y), r, 1);
+    r      = vsetq_lane_f32(vgetq_lane_f32(b, Z), r, 2);
+    r      = vsetq_lane_f32(vgetq_lane_f32(b, W), r, 3);
+    return r;
+}
+
+/// Transposes the 4x4 matrix whose rows are r0, r1, r2, r3
+inline void Transpose(f32x4& r0, f32x4& r1, f32x4& r2, f32x4& r3)
+{
+    const auto t01 = vtrnq_f32(r0, r1);
+    const auto t23 = vtrnq_f32(r2, r3);
+    r0             = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    r1             = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    r2             = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    r3             = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+
+#    endif
+
+/// Returns a * b + c.
+/// Unless the code is compiled with FMA enabled, the result is rounded exactly as in
+/// the scalar expression, which keeps vectorized and scalar paths bit-identical.
+inline f32x4 MulAdd(f32x4 a, f32x4 b, f32x4 c)
+{
+#    if DILIGENT_SIMD_MATH_SSE && defined(__FMA__)
+    return _mm_fmadd_ps(a, b, c);
+#    else
+    return Add(Mul(a, b), c);
+#    endif
+}
+
+/// Returns {a[X], a[Y], a[Z], a[W]}
+template <int X, int Y, int Z, int W>
+inline f32x4 Swizzle(f32x4 a)
+{
+    return Shuffle<X, Y, Z, W>(a, a);
+}
+
+/// Broadcasts component I of a to all components
+template <int I>
+inline f32x4 SplatLane(f32x4 a)
+{
+    return Swizzle<I, I, I, I>(a);
+}
+
+/// Computes v * m, where m is a row-major 4x4 matrix given by its rows
+inline f32x4 MulVecMat(f32x4 v, f32x4 r0, f32x4 r1, f32x4 r2, f32x4 r3)
+{
+    auto out = Mul(SplatLane<0>(v), r0);
+    out      = MulAdd(SplatLane<1>(v), r1, out);
+    out      = MulAdd(SplatLane<2>(v), r2, out);
+    out      = MulAdd(SplatLane<3>(v), r3, out);
+    return out;
+}
+
+// 2x2 row-major matrices are stored in f32x4 as {m00, m01, m10, m11}
+
+/// Returns A * B
+inline f32x4 Mat2Mul(f32x4 A, f32x4 B)
+{
+    return Add(Mul(A, Swizzle<0, 3, 0, 3>(B)), Mul(Swizzle<1, 0, 3, 2>(A), Swizzle<2, 1, 2, 1>(B)));
+}
+
+/// Returns adj(A) * B
+inline f32x4 Mat2AdjMul(f32x4 A, f32x4 B)
+{
+    return Sub(Mul(Swizzle<3, 3, 0, 0>(A), B), Mul(Swizzle<1, 1, 2, 2>(A), Swizzle<2, 3, 0, 1>(B)));
+}
+
+/// Returns A * adj(B)
+inline f32x4 Mat2MulAdj(f32x4 A, f32x4 B)
+{
+    return Sub(Mul(A, Swizzle<3, 0, 3, 0>(B)), Mul(Swizzle<1, 0, 3, 2>(A), Swizzle<2, 1, 2, 1>(B)));
+}
+
+/// Decomposes a row-major 4x4 matrix into 2x2 blocks | A B |
+///                                                     | C D |
+/// and computes the terms shared by the determinant and the inverse.
+struct Matrix4x4Blocks
+{
+    Matrix4x4Blocks(const float* pMat)
+    {
+        const auto r0 = Load(pMat + 0);
+        const auto r1 = Load(pMat + 4);
+        const auto r2 = Load(pMat + 8);
+        const auto r3 = Load(pMat + 12);
+
+        A = Shuffle<0, 1, 0, 1>(r0, r1);
+        B = Shuffle<2, 3, 2, 3>(r0, r1);
+        C = Shuffle<0, 1, 0, 1>(r2, r3);
+        D = Shuffle<2, 3, 2, 3>(r2, r3);
+
+        // {|A|, |B|, |C|, |D|}
+        const auto DetSub = Sub(Mul(Shuffle<0, 2, 0, 2>(r0, r2), Shuffle<1, 3, 1, 3>(r1, r3)),
+                                Mul(Shuffle<1, 3, 1, 3>(r0, r2), Shuffle<0, 2, 0, 2>(r1, r3)));
+
+        DetA = SplatLane<0>(DetSub);
+        DetB = SplatLane<1>(DetSub);
+        DetC = SplatLane<2>(DetSub);
+        DetD = SplatLane<3>(DetSub);
+
+        A_B = Mat2AdjMul(A, B);
+        D_C = Mat2AdjMul(D, C);
+
+        // |M| = |A|*|D| + |B|*|C| - tr(adj(A)B * adj(D)C)
+        auto Tr = Mul(A_B, Swizzle<0, 2, 1, 3>(D_C));
+        Tr      = Add(Tr, Swizzle<1, 0, 3, 2>(Tr));
+        Tr      = Add(Tr, Swizzle<2, 3, 0, 1>(Tr));
+        DetM    = Sub(Add(Mul(DetA, DetD), Mul(DetB, DetC)), Tr);
+    }
+
+    f32x4 A, B, C, D;
+    f32x4 DetA, DetB, DetC, DetD;
+    f32x4 A_B, D_C;
+    f32x4 DetM;
+};
+
+/// Computes the inverse of a row-major 4x4 matrix
+inline void InverseMatrix4x4(const float* pMat, float* pInv)
+{
+    const Matrix4x4Blocks M{pMat};
+
+    // inv(M) = 1/|M| * | X Y |
+    //                  | Z W |
+    // X# = |D|A - B(D#C)
+    auto X_ = Sub(Mul(M.DetD, M.A), Mat2Mul(M.B, M.D_C));
+    // W# = |A|D - C(A#B)
+    auto W_ = Sub(Mul(M.DetA, M.D), Mat2Mul(M.C, M.A_B));
+    // Y# = |B|C - D(A#B)#
+    auto Y_ = Sub(Mul(M.DetB, M.C), Mat2MulAdj(M.D, M.A_B));
+    // Z# = |C|B - A(D#C)#
+    auto Z_ = Sub(Mul(M.DetC, M.B), Mat2MulAdj(M.A, M.D_C));
+
+    const auto RcpDetM = Div(Set(1.f, -1.f, -1.f, 1.f), M.DetM);
+
+    X_ = Mul(X_, RcpDetM);
+    Y_ = Mul(Y_, RcpDetM);
+    Z_ = Mul(Z_, RcpDetM);
+    W_ = Mul(W_, RcpDetM);
+
+    // Apply the adjugate and interleave the blocks back into rows
+    Store(pInv + 0, Shuffle<3, 1, 3, 1>(X_, Y_));
+    Store(pInv + 4, Shuffle<2, 0, 2, 0>(X_, Y_));
+    Store(pInv + 8, Shuffle<3, 1, 3, 1>(Z_, W_));
+    Store(pInv + 12, Shuffle<2, 0, 2, 0>(Z_, W_));
+}
+
+} // namespace SIMD
+
+} // namespace Diligent
+
+#endif
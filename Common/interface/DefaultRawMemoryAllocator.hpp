@@ -30,6 +30,8 @@
 /// \file
 /// Defines Diligent::DefaultRawMemoryAllocator class
 
+#include <atomic>
+
 #include "../../Primitives/interface/MemoryAllocator.h"
 
 namespace Diligent
@@ -48,11 +50,22 @@ public:
 
     static DefaultRawMemoryAllocator& GetAllocator();
 
+    /// Returns the total number of allocations made by the allocator.
+
+    /// The counter is intended to detect unexpected allocations in hot paths: the difference
+    /// between two values taken around a piece of code is the number of allocations it made.
+    Uint64 GetAllocationCount() const
+    {
+        return m_AllocationCount.load(std::memory_order_relaxed);
+    }
+
 private:
     DefaultRawMemoryAllocator(const DefaultRawMemoryAllocator&) = delete;
     DefaultRawMemoryAllocator(DefaultRawMemoryAllocator&&)      = delete;
     DefaultRawMemoryAllocator& operator=(const DefaultRawMemoryAllocator&) = delete;
     DefaultRawMemoryAllocator& operator=(DefaultRawMemoryAllocator&&) = delete;
+
+    std::atomic<Uint64> m_AllocationCount{0};
 };
 
 } // namespace Diligent
@@ -31,12 +31,15 @@
 /// Defines Diligent::DynamicLinearAllocator class
 
 #include <vector>
+#include <cstddef>
+#include <cstring>
 
 #include "../../Primitives/interface/BasicTypes.h"
 #include "../../Primitives/interface/MemoryAllocator.h"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 #include "CompilerDefinitions.h"
 #include "Align.hpp"
+#include "STDAllocator.hpp"
 
 namespace Diligent
 {
@@ -111,6 +114,18 @@ public:
         return Ptr;
     }
 
+    /// Allocates memory with the fundamental alignment. Together with Free(void*), this
+    /// method allows using the allocator with STDAllocator, see STDAllocatorDynamicLinear.
+    NODISCARD void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+    {
+        return Allocate(Size, alignof(std::max_align_t));
+    }
+
+    /// Individual allocations are never released. The memory is reclaimed by Discard() or Free().
+    void Free(void* Ptr)
+    {
+    }
+
     template <typename T>
     NODISCARD T* Allocate(size_t count = 1)
     {
@@ -208,4 +223,11 @@ private:
     IMemoryAllocator*  m_pAllocator = nullptr;
 };
 
+/// STL-compatible allocator that allocates memory from the dynamic linear allocator.
+
+/// Containers that use this allocator never return memory to the allocator, and must be
+/// destroyed or reset before DynamicLinearAllocator::Discard() is called.
+template <class T> using STDAllocatorDynamicLinear = STDAllocator<T, DynamicLinearAllocator>;
+#define STD_ALLOCATOR_DYNAMIC_LINEAR(Type, Allocator, Description) STDAllocatorDynamicLinear<Type>(Allocator, Description, __FILE__, __LINE__)
+
 } // namespace Diligent
@@ -56,7 +56,22 @@ inline void FillWithDebugPattern(void* ptr, Uint8 Pattern, size_t NumBytes)
 class FixedBlockMemoryAllocator final : public IMemoryAllocator
 {
 public:
-    FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator, size_t BlockSize, Uint32 NumBlocksInPage);
+    /// \param [in] RawMemoryAllocator - Allocator that is used to allocate memory pages.
+    /// \param [in] BlockSize          - Size of one block.
+    /// \param [in] NumBlocksInPage    - The number of blocks in one memory page.
+    /// \param [in] ThreadCaching      - Whether to use thread-caching mode (see remarks).
+    ///
+    /// \remarks   By default, all allocations and deallocations are serialized by a mutex.
+    ///            In thread-caching mode, every thread keeps a small cache of free blocks,
+    ///            allocations and deallocations are served from this cache and only once in a
+    ///            batch go to the shared depot: allocations take a lock, while returning blocks
+    ///            (including blocks allocated by another thread) is lock-free.
+    ///            This mode scales much better when objects are created and destroyed by many
+    ///            threads, but blocks cached by threads are not available to other threads
+    ///            until the threads exit, and memory pages are aligned to the power of two that is
+    ///            greater than or equal to the page size, which reserves up to twice the page size
+    ///            of memory.
+    FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator, size_t BlockSize, Uint32 NumBlocksInPage, bool ThreadCaching = false);
     ~FixedBlockMemoryAllocator();
 
     /// Allocates block of memory
@@ -75,6 +90,14 @@ private:
 
     void CreateNewPage();
 
+    // Shared state and per-thread caches of the thread-caching mode, see FixedBlockMemoryAllocator.cpp
+    struct ThreadCache;
+    struct ThreadCacheDepot;
+    class ThreadCacheRegistry;
+
+    void* AllocateFromThreadCache();
+    void  FreeToThreadCache(void* Ptr);
+
     // Memory page class is based on the fixed-size memory pool described in "Fast Efficient Fixed-Size Memory Pool"
     // by Ben Kenwright
     class MemoryPage
@@ -228,6 +251,10 @@ private:
 
     std::mutex m_Mutex;
 
+    // Non-null in thread-caching mode. The depot owns all memory pages and thread caches
+    // of the allocator and releases them when the allocator is destroyed.
+    std::unique_ptr<ThreadCacheDepot, STDDeleterRawMem<ThreadCacheDepot>> m_pThreadCacheDepot;
+
     IMemoryAllocator& m_RawMemoryAllocator;
     const size_t      m_BlockSize;
     const Uint32      m_NumBlocksInPage;
@@ -0,0 +1,273 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Batched frustum culling of bounding boxes stored as structure of arrays.
+///
+/// The functions produce exactly the same results as GetBoxVisibility() for individual
+/// boxes, but test four boxes per iteration when SIMD math is available (see BasicMathSIMD.hpp).
+
+#include <algorithm>
+#include <vector>
+#include <future>
+
+#include "AdvancedMath.hpp"
+#include "Align.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+/// Non-owning structure-of-arrays view of bounding boxes: box i is
+/// {{MinX[i], MinY[i], MinZ[i]}, {MaxX[i], MaxY[i], MaxZ[i]}}
+struct BoundBoxArraysSOA
+{
+    const float* MinX = nullptr;
+    const float* MinY = nullptr;
+    const float* MinZ = nullptr;
+    const float* MaxX = nullptr;
+    const float* MaxY = nullptr;
+    const float* MaxZ = nullptr;
+
+    BoundBox GetBox(size_t i) const
+    {
+        return BoundBox{float3{MinX[i], MinY[i], MinZ[i]}, float3{MaxX[i], MaxY[i], MaxZ[i]}};
+    }
+};
+
+/// Computes the visibility of boxes [FirstBox, FirstBox + NumBoxes) against the frustum planes
+/// and calls Handler(size_t BoxIdx, BoxVisibility Visibility) for every box in order.
+template <typename HandlerType>
+void ClassifyBoxes(const ViewFrustum&       Frustum,
+                   const BoundBoxArraysSOA& Boxes,
+                   size_t                   FirstBox,
+                   size_t                   NumBoxes,
+                   FRUSTUM_PLANE_FLAGS      PlaneFlags,
+                   HandlerType&&            Handler)
+{
+    const size_t EndBox = FirstBox + NumBoxes;
+
+    size_t i = FirstBox;
+#if DILIGENT_SIMD_MATH
+    struct PlaneData
+    {
+        SIMD::f32x4 NX, NY, NZ, D;
+        bool        PosX, PosY, PosZ;
+    };
+    PlaneData Planes[ViewFrustum::NUM_PLANES];
+    Uint32    NumPlanes = 0;
+    for (Uint32 plane_idx = 0; plane_idx < ViewFrustum::NUM_PLANES; ++plane_idx)
+    {
+        if ((PlaneFlags & (1 << plane_idx)) == 0)
+            continue;
+
+        const auto& Plane = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(plane_idx));
+
+        auto& Data = Planes[NumPlanes++];
+        Data.NX    = SIMD::Splat(Plane.Normal.x);
+        Data.NY    = SIMD::Splat(Plane.Normal.y);
+        Data.NZ    = SIMD::Splat(Plane.Normal.z);
+        Data.D     = SIMD::Splat(Plane.Distance);
+        Data.PosX  = Plane.Normal.x > 0;
+        Data.PosY  = Plane.Normal.y > 0;
+        Data.PosZ  = Plane.Normal.z > 0;
+    }
+
+    const auto Zero = SIMD::Splat(0.f);
+    for (; i + 4 <= EndBox; i += 4)
+    {
+        const auto MinX = SIMD::Load(Boxes.MinX + i);
+        const auto MinY = SIMD::Load(Boxes.MinY + i);
+        const auto MinZ = SIMD::Load(Boxes.MinZ + i);
+        const auto MaxX = SIMD::Load(Boxes.MaxX + i);
+        const auto MaxY = SIMD::Load(Boxes.MaxY + i);
+        const auto MaxZ = SIMD::Load(Boxes.MaxZ + i);
+
+        auto Invisible  = Zero;
+        int  InsideBits = 0xF;
+        for (Uint32 p = 0; p < NumPlanes; ++p)
+        {
+            const auto& Plane = Planes[p];
+            // The sign of the normal is the same for all boxes, so instead of selecting
+            // the corners per lane, we select the arrays. The operations are performed in
+            // the same order as in GetBoxVisibilityAgainstPlane() to get identical results.
+            auto DMax = SIMD::Mul(Plane.PosX ? MaxX : MinX, Plane.NX);
+            DMax      = SIMD::Add(DMax, SIMD::Mul(Plane.PosY ? MaxY : MinY, Plane.NY));
+            DMax      = SIMD::Add(DMax, SIMD::Mul(Plane.PosZ ? MaxZ : MinZ, Plane.NZ));
+            DMax      = SIMD::Add(DMax, Plane.D);
+
+            auto DMin = SIMD::Mul(Plane.PosX ? MinX : MaxX, Plane.NX);
+            DMin      = SIMD::Add(DMin, SIMD::Mul(Plane.PosY ? MinY : MaxY, Plane.NY));
+            DMin      = SIMD::Add(DMin, SIMD::Mul(Plane.PosZ ? MinZ : MaxZ, Plane.NZ));
+            DMin      = SIMD::Add(DMin, Plane.D);
+
+            Invisible = SIMD::Or(Invisible, SIMD::CmpLT(DMax, Zero));
+            InsideBits &= SIMD::MoveMask(SIMD::CmpGT(DMin, Zero));
+        }
+
+        const auto InvisibleBits = SIMD::MoveMask(Invisible);
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const auto Visibility = (InvisibleBits & (1 << lane)) != 0 ?
+                BoxVisibility::Invisible :
+                ((InsideBits & (1 << lane)) != 0 ? BoxVisibility::FullyVisible : BoxVisibility::Intersecting);
+            Handler(i + lane, Visibility);
+        }
+    }
+#endif
+
+    for (; i < EndBox; ++i)
+        Handler(i, GetBoxVisibility(Frustum, Boxes.GetBox(i), PlaneFlags));
+}
+
+/// Same as above, but also performs the additional test against the frustum corners
+/// that GetBoxVisibility(const ViewFrustumExt&, ...) does for intersecting boxes.
+template <typename HandlerType>
+void ClassifyBoxes(const ViewFrustumExt&    FrustumExt,
+                   const BoundBoxArraysSOA& Boxes,
+                   size_t                   FirstBox,
+                   size_t                   NumBoxes,
+                   FRUSTUM_PLANE_FLAGS      PlaneFlags,
+                   HandlerType&&            Handler)
+{
+    const bool TestCorners = (PlaneFlags & FRUSTUM_PLANE_FLAG_FULL_FRUSTUM) == FRUSTUM_PLANE_FLAG_FULL_FRUSTUM;
+    ClassifyBoxes(static_cast<const ViewFrustum&>(FrustumExt), Boxes, FirstBox, NumBoxes, PlaneFlags,
+                  [&](size_t BoxIdx, BoxVisibility Visibility) //
+                  {
+                      if (Visibility == BoxVisibility::Intersecting && TestCorners &&
+                          AreFrustumCornersOutsideBox(FrustumExt, Boxes.GetBox(BoxIdx)))
+                          Visibility = BoxVisibility::Invisible;
+                      Handler(BoxIdx, Visibility);
+                  });
+}
+
+/// Computes the visibility of boxes [FirstBox, FirstBox + NumBoxes) and writes it to
+/// pVisibility[FirstBox] ... pVisibility[FirstBox + NumBoxes - 1].
+template <typename FrustumType>
+void GetBoxVisibility(const FrustumType&       Frustum,
+                      const BoundBoxArraysSOA& Boxes,
+                      size_t                   FirstBox,
+                      size_t                   NumBoxes,
+                      BoxVisibility*           pVisibility,
+                      FRUSTUM_PLANE_FLAGS      PlaneFlags = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM)
+{
+    ClassifyBoxes(Frustum, Boxes, FirstBox, NumBoxes, PlaneFlags,
+                  [pVisibility](size_t BoxIdx, BoxVisibility Visibility) //
+                  {
+                      pVisibility[BoxIdx] = Visibility;
+                  });
+}
+
+/// Computes the visibility of boxes [FirstBox, FirstBox + NumBoxes) and writes it to the bit mask:
+/// bit (i % 32) of pVisibleMask[i / 32] is set if box i is not BoxVisibility::Invisible.
+
+/// FirstBox must be a multiple of 32. The mask words covering the range are overwritten;
+/// the bits past the last box in the last word are set to zero.
+template <typename FrustumType>
+void GetBoxVisibilityMask(const FrustumType&       Frustum,
+                          const BoundBoxArraysSOA& Boxes,
+                          size_t                   FirstBox,
+                          size_t                   NumBoxes,
+                          Uint32*                  pVisibleMask,
+                          FRUSTUM_PLANE_FLAGS      PlaneFlags = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM)
+{
+    VERIFY((FirstBox % 32) == 0, "First box index (", FirstBox, ") must be a multiple of 32");
+    std::fill(pVisibleMask + FirstBox / 32, pVisibleMask + (FirstBox + NumBoxes + 31) / 32, Uint32{0});
+    ClassifyBoxes(Frustum, Boxes, FirstBox, NumBoxes, PlaneFlags,
+                  [pVisibleMask](size_t BoxIdx, BoxVisibility Visibility) //
+                  {
+                      pVisibleMask[BoxIdx / 32] |= (Visibility != BoxVisibility::Invisible ? 1u : 0u) << (BoxIdx % 32);
+                  });
+}
+
+/// Splits [0, NumBoxes) into at most one chunk per pool thread plus one for the calling
+/// thread, and calls Func(FirstBox, NumBoxes) for every chunk. The calling thread processes
+/// the first chunk and waits for the rest.
+
+/// Chunk boundaries are multiples of 32, so that no two chunks share a visibility mask word.
+template <typename FuncType>
+void ProcessBoxesInParallel(ThreadingTools::ThreadPool& Pool,
+                            size_t                      NumBoxes,
+                            size_t                      MinBoxesPerTask,
+                            const FuncType&             Func)
+{
+    const size_t NumTasks  = std::max(std::min(Pool.GetNumThreads() + 1, NumBoxes / std::max(MinBoxesPerTask, size_t{1})), size_t{1});
+    const size_t ChunkSize = Align((NumBoxes + NumTasks - 1) / NumTasks, size_t{32});
+
+    std::vector<std::future<void>> Futures;
+    for (size_t FirstBox = ChunkSize; FirstBox < NumBoxes; FirstBox += ChunkSize)
+    {
+        const size_t ChunkBoxes = std::min(ChunkSize, NumBoxes - FirstBox);
+        Futures.emplace_back(Pool.Enqueue([&Func, FirstBox, ChunkBoxes]() { Func(FirstBox, ChunkBoxes); }));
+    }
+
+    Func(size_t{0}, std::min(ChunkSize, NumBoxes));
+
+    for (auto& Future : Futures)
+        Future.get();
+}
+
+/// Multithreaded version of GetBoxVisibility() that processes boxes [0, NumBoxes).
+///
+/// \param MinBoxesPerTask - the minimum number of boxes processed by a single task. Small batches
+///                          are processed by the calling thread alone.
+template <typename FrustumType>
+void GetBoxVisibilityParallel(ThreadingTools::ThreadPool& Pool,
+                              const FrustumType&          Frustum,
+                              const BoundBoxArraysSOA&    Boxes,
+                              size_t                      NumBoxes,
+                              BoxVisibility*              pVisibility,
+                              FRUSTUM_PLANE_FLAGS         PlaneFlags      = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                              size_t                      MinBoxesPerTask = 8192)
+{
+    ProcessBoxesInParallel(Pool, NumBoxes, MinBoxesPerTask,
+                           [&](size_t FirstBox, size_t ChunkBoxes) //
+                           {
+                               GetBoxVisibility(Frustum, Boxes, FirstBox, ChunkBoxes, pVisibility, PlaneFlags);
+                           });
+}
+
+/// Multithreaded version of GetBoxVisibilityMask() that processes boxes [0, NumBoxes).
+template <typename FrustumType>
+void GetBoxVisibilityMaskParallel(ThreadingTools::ThreadPool& Pool,
+                                  const FrustumType&          Frustum,
+                                  const BoundBoxArraysSOA&    Boxes,
+                                  size_t                      NumBoxes,
+                                  Uint32*                     pVisibleMask,
+                                  FRUSTUM_PLANE_FLAGS         PlaneFlags      = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                                  size_t                      MinBoxesPerTask = 8192)
+{
+    ProcessBoxesInParallel(Pool, NumBoxes, MinBoxesPerTask,
+                           [&](size_t FirstBox, size_t ChunkBoxes) //
+                           {
+                               GetBoxVisibilityMask(Frustum, Boxes, FirstBox, ChunkBoxes, pVisibleMask, PlaneFlags);
+                           });
+}
+
+} // namespace Diligent
@@ -31,6 +31,7 @@
 #include <memory>
 #include <cstring>
 
+#include "../../Primitives/interface/BasicTypes.h"
 #include "../../Primitives/interface/Errors.hpp"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -61,6 +62,26 @@ std::size_t ComputeHash(const ArgsType&... Args)
     return Seed;
 }
 
+/// Computes the hash of a raw memory block
+inline std::size_t ComputeHashRaw(const void* pData, size_t Size)
+{
+    std::size_t Seed = 0;
+
+    const auto* pBytes   = static_cast<const Uint8*>(pData);
+    const auto* pEnd     = pBytes + Size;
+    const auto* pEndWord = pBytes + (Size / sizeof(std::size_t)) * sizeof(std::size_t);
+    for (; pBytes < pEndWord; pBytes += sizeof(std::size_t))
+    {
+        std::size_t Word;
+        memcpy(&Word, pBytes, sizeof(Word));
+        HashCombine(Seed, Word);
+    }
+    for (; pBytes < pEnd; ++pBytes)
+        HashCombine(Seed, *pBytes);
+
+    return Seed;
+}
+
 template <typename CharType>
 struct CStringHash
 {
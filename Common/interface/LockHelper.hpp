@@ -27,19 +27,103 @@
 
 #pragma once
 
+#include <string>
+
 #include "../../Platforms/interface/Atomics.hpp"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
+// When DILIGENT_SPINLOCK_FUTEX is defined as 1 (Linux and Android only, see the CMake option
+// of the same name), threads that failed to acquire a lock after spinning are parked on a futex
+// instead of yielding. This makes every unlock an atomic exchange instead of a plain store.
+#ifndef DILIGENT_SPINLOCK_FUTEX
+#    define DILIGENT_SPINLOCK_FUTEX 0
+#endif
+
+// When DILIGENT_LOCK_STATISTICS is defined as 1 (see the CMake option of the same name), every
+// LockFlag keeps a pointer to the object that collects its contention statistics. Otherwise, the
+// statistics are compiled out and LockFlag is not larger than the atomic flag itself.
+#ifndef DILIGENT_LOCK_STATISTICS
+#    define DILIGENT_LOCK_STATISTICS 0
+#endif
+
 namespace ThreadingTools
 {
 
+/// Contention counters of one or more locks.
+
+/// Statistics are opt-in: they are only collected when DILIGENT_LOCK_STATISTICS is enabled, and
+/// only for flags that were given a statistics object with LockFlag::SetStatistics().
+/// Objects are obtained from LockStatistics::Register()
+/// by name, so that all locks with the same name (e.g. all instances of a registry) share one
+/// set of counters. Registered objects are never released, so the counters outlive the locks.
+class LockStatistics
+{
+public:
+    struct Counters
+    {
+        /// The number of successful Lock() and TryLock() calls
+        Atomics::Int64 Acquisitions = 0;
+
+        /// The number of Lock() calls that found the lock taken
+        Atomics::Int64 ContendedAcquisitions = 0;
+
+        /// The total number of spin iterations performed while waiting
+        Atomics::Int64 SpinCount = 0;
+
+        /// The number of times a waiting thread yielded its time slice or was parked
+        Atomics::Int64 YieldCount = 0;
+
+        /// The total time, in nanoseconds, spent waiting for contended locks
+        Atomics::Int64 WaitTimeNs = 0;
+    };
+
+    /// Enables or disables statistics collection globally. When collection is disabled (default),
+    /// Register() returns null, so locks created at that time do not collect statistics.
+    static void SetCollectionEnabled(bool Enabled) noexcept;
+    static bool IsCollectionEnabled() noexcept;
+
+    /// Returns the statistics object registered under the given name, creating it if necessary,
+    /// or null if statistics collection is disabled.
+    static LockStatistics* Register(const char* Name);
+
+    /// Returns a human-readable table with the counters of all registered objects.
+    static std::string DumpAll();
+
+    /// Resets the counters of all registered objects.
+    static void ResetAll() noexcept;
+
+    const char* GetName() const noexcept { return m_Name.c_str(); }
+
+    Counters GetCounters() const noexcept;
+
+    void Reset() noexcept;
+
+private:
+    friend class LockHelper;
+
+    explicit LockStatistics(const char* Name) :
+        m_Name{Name}
+    {}
+
+    const std::string m_Name;
+
+    Atomics::AtomicInt64 m_Acquisitions{0};
+    Atomics::AtomicInt64 m_ContendedAcquisitions{0};
+    Atomics::AtomicInt64 m_SpinCount{0};
+    Atomics::AtomicInt64 m_YieldCount{0};
+    Atomics::AtomicInt64 m_WaitTimeNs{0};
+};
+
 class LockFlag
 {
 public:
     enum
     {
         LOCK_FLAG_UNLOCKED = 0,
-        LOCK_FLAG_LOCKED   = 1
+        LOCK_FLAG_LOCKED   = 1,
+
+        // The lock is taken and there may be threads parked on it (only used when DILIGENT_SPINLOCK_FUTEX is enabled)
+        LOCK_FLAG_LOCKED_CONTENDED = 2
     };
     LockFlag(Atomics::Long InitFlag = LOCK_FLAG_UNLOCKED) noexcept
     {
@@ -49,13 +133,41 @@ public:
 
     operator Atomics::Long() const { return m_Flag; }
 
+    /// Sets the object that collects the contention statistics of this lock, see LockStatistics.
+    /// Passing null disables the statistics. The object is ignored if DILIGENT_LOCK_STATISTICS is disabled.
+    void SetStatistics(LockStatistics* pStats) noexcept
+    {
+#if DILIGENT_LOCK_STATISTICS
+        m_pStats = pStats;
+#else
+        (void)pStats;
+#endif
+    }
+
+    LockStatistics* GetStatistics() const noexcept
+    {
+#if DILIGENT_LOCK_STATISTICS
+        return m_pStats;
+#else
+        return nullptr;
+#endif
+    }
+
 private:
     friend class LockHelper;
     Atomics::AtomicLong m_Flag;
+#if DILIGENT_LOCK_STATISTICS
+    LockStatistics* m_pStats = nullptr;
+#endif
 };
 
 // Spinlock implementation. This kind of lock should be used in scenarios
 // where simultaneous access is uncommon but possible.
+//
+// The lock is acquired with a single compare-exchange when it is free. Otherwise, the waiting
+// thread polls the flag with plain loads (test-and-test-and-set), so that the cache line stays
+// shared while the lock is held, and executes an exponentially growing number of pause
+// instructions between the polls. After SpinCountToYield pauses, the thread yields.
 class LockHelper
 {
 public:
@@ -86,9 +198,12 @@ public:
 
     static bool UnsafeTryLock(LockFlag& LockFlag) noexcept
     {
-        return Atomics::AtomicCompareExchange(LockFlag.m_Flag,
-                                              static_cast<Atomics::Long>(LockFlag::LOCK_FLAG_LOCKED),
-                                              static_cast<Atomics::Long>(LockFlag::LOCK_FLAG_UNLOCKED)) == LockFlag::LOCK_FLAG_UNLOCKED;
+        if (!TryAcquire(LockFlag))
+            return false;
+
+        if (auto* pStats = LockFlag.GetStatistics())
+            Atomics::AtomicIncrement(pStats->m_Acquisitions);
+        return true;
     }
 
     bool TryLock(LockFlag& LockFlag) noexcept
@@ -106,37 +221,28 @@ public:
 
     static void UnsafeLock(LockFlag& LockFlag, int SpinCountToYield = DefaultSpinCountToYield) noexcept
     {
-        int SpinCount = 0;
-        while (!UnsafeTryLock(LockFlag))
-        {
-            ++SpinCount;
-            if (SpinCount == SpinCountToYield)
-            {
-                SpinCount = 0;
-                YieldThread();
-            }
-        }
+        if (!TryAcquire(LockFlag))
+            WaitAndAcquire(LockFlag, SpinCountToYield);
+
+        if (auto* pStats = LockFlag.GetStatistics())
+            Atomics::AtomicIncrement(pStats->m_Acquisitions);
     }
 
     void Lock(LockFlag& LockFlag, int SpinCountToYield = DefaultSpinCountToYield) noexcept
     {
         VERIFY(m_pLockFlag == NULL, "Object already locked");
-        // Wait for the flag to become unlocked and lock it
-        int SpinCount = 0;
-        while (!TryLock(LockFlag))
-        {
-            ++SpinCount;
-            if (SpinCount == SpinCountToYield)
-            {
-                SpinCount = 0;
-                YieldThread();
-            }
-        }
+        UnsafeLock(LockFlag, SpinCountToYield);
+        m_pLockFlag = &LockFlag;
     }
 
     static void UnsafeUnlock(LockFlag& LockFlag) noexcept
     {
+#if DILIGENT_SPINLOCK_FUTEX
+        if (LockFlag.m_Flag.exchange(LockFlag::LOCK_FLAG_UNLOCKED) == LockFlag::LOCK_FLAG_LOCKED_CONTENDED)
+            WakeWaiters(LockFlag);
+#else
         LockFlag.m_Flag = LockFlag::LOCK_FLAG_UNLOCKED;
+#endif
     }
 
     void Unlock() noexcept
@@ -147,6 +253,20 @@ public:
     }
 
 private:
+    static bool TryAcquire(LockFlag& LockFlag) noexcept
+    {
+        return Atomics::AtomicCompareExchange(LockFlag.m_Flag,
+                                              static_cast<Atomics::Long>(LockFlag::LOCK_FLAG_LOCKED),
+                                              static_cast<Atomics::Long>(LockFlag::LOCK_FLAG_UNLOCKED)) == LockFlag::LOCK_FLAG_UNLOCKED;
+    }
+
+    // Slow path of UnsafeLock() that is executed when the lock is taken
+    static void WaitAndAcquire(LockFlag& LockFlag, int SpinCountToYield) noexcept;
+
+#if DILIGENT_SPINLOCK_FUTEX
+    static void WakeWaiters(LockFlag& LockFlag) noexcept;
+#endif
+
     static void YieldThread() noexcept;
 
     LockFlag* m_pLockFlag = nullptr;
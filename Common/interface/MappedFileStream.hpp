@@ -0,0 +1,147 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the MappedDataBlob and MappedFileStream classes
+
+#include "../../Primitives/interface/FileStream.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Expected access pattern of a memory-mapped file, passed to the OS as a paging hint
+enum class EFileAccessHint
+{
+    /// The file will be read from the beginning to the end. Pages are read ahead aggressively.
+    Sequential,
+
+    /// The file will be accessed in random order. Read-ahead is disabled.
+    Random
+};
+
+/// Data blob that references the contents of a read-only memory-mapped file
+
+/// The file is mapped privately: the pointer returned by GetDataPtr() may be written to,
+/// but the changes are never written back to the file. The blob can't be resized.
+/// Memory mapping is only supported on Linux, Android, MacOS and iOS. On other platforms,
+/// the blob is always invalid.
+class MappedDataBlob final : public ObjectBase<IDataBlob>
+{
+public:
+    typedef ObjectBase<IDataBlob> TBase;
+
+    MappedDataBlob(IReferenceCounters* pRefCounters,
+                   const Char*         Path,
+                   EFileAccessHint     AccessHint = EFileAccessHint::Sequential);
+
+    ~MappedDataBlob();
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override;
+
+    /// Mapped data blob can't be resized. The method only succeeds if the size does not change.
+    virtual void DILIGENT_CALL_TYPE Resize(size_t NewSize) override;
+
+    /// Returns the size of the mapped file
+    virtual size_t DILIGENT_CALL_TYPE GetSize() const override;
+
+    /// Returns the pointer to the mapped file data
+    virtual void* DILIGENT_CALL_TYPE GetDataPtr() override;
+
+    /// Returns const pointer to the mapped file data
+    virtual const void* DILIGENT_CALL_TYPE GetConstDataPtr() const override;
+
+    /// Returns true if the file has been successfully mapped
+    bool IsValid() const { return m_IsValid; }
+
+private:
+    void*  m_pData   = nullptr;
+    size_t m_Size    = 0;
+    bool   m_IsValid = false;
+};
+
+
+// {3CD9E5EC-D96B-4FED-8A8E-FA079944CBB8}
+static const INTERFACE_ID IID_MappedFileStream =
+    {0x3cd9e5ec, 0xd96b, 0x4fed, {0x8a, 0x8e, 0xfa, 0x7, 0x99, 0x44, 0xcb, 0xb8}};
+
+/// Read-only file stream backed by a memory-mapped file
+
+/// Unlike BasicFileStream, the stream does not copy the file into a memory buffer:
+/// ReadRemainingData() returns the blob that references the mapped memory. Use
+/// ReadStreamData() to get the contents of any stream without copying whenever possible.
+class MappedFileStream : public ObjectBase<IFileStream>
+{
+public:
+    typedef ObjectBase<IFileStream> TBase;
+
+    MappedFileStream(IReferenceCounters* pRefCounters,
+                     const Char*         Path,
+                     EFileAccessHint     AccessHint = EFileAccessHint::Sequential);
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override;
+
+    /// Reads data from the stream
+    virtual void DILIGENT_CALL_TYPE ReadBlob(IDataBlob* pData) override;
+
+    /// Reads data from the stream
+    virtual bool DILIGENT_CALL_TYPE Read(void* Data, size_t Size) override;
+
+    /// Mapped file stream is read-only; the method always fails
+    virtual bool DILIGENT_CALL_TYPE Write(const void* Data, size_t Size) override;
+
+    virtual size_t DILIGENT_CALL_TYPE GetSize() override;
+
+    virtual bool DILIGENT_CALL_TYPE IsValid() override;
+
+    /// Reads the remaining data from the stream. If the stream is at the beginning, returns
+    /// the blob that references the mapped memory, otherwise copies the data into a new blob.
+    RefCntAutoPtr<IDataBlob> ReadRemainingData();
+
+    /// Returns the size of the file without opening it.
+
+    /// The method returns false if memory mapping is not supported on this platform or if
+    /// the path does not refer to a regular file. This lets callers decide whether to map
+    /// the file before opening it.
+    static bool GetMappableFileSize(const Char* Path, size_t& Size);
+
+private:
+    RefCntAutoPtr<MappedDataBlob> m_pDataBlob;
+    size_t                        m_CurrentOffset = 0;
+};
+
+/// Returns the remaining contents of the file stream as a data blob.
+
+/// If the stream is a MappedFileStream, see MappedFileStream::ReadRemainingData().
+/// Otherwise, the contents are read into a new DataBlobImpl.
+RefCntAutoPtr<IDataBlob> ReadStreamData(IFileStream* pStream);
+
+} // namespace Diligent
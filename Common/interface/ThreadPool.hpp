@@ -0,0 +1,146 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <functional>
+#include <memory>
+
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+
+namespace ThreadingTools
+{
+
+/// Fixed-size pool of worker threads that execute enqueued tasks in FIFO order.
+class ThreadPool
+{
+public:
+    /// \param NumThreads - the number of worker threads. If zero, the number of
+    ///                     hardware threads is used.
+    explicit ThreadPool(size_t NumThreads = 0)
+    {
+        if (NumThreads == 0)
+            NumThreads = GetDefaultThreadCount();
+
+        m_WorkerThreads.reserve(NumThreads);
+        for (size_t i = 0; i < NumThreads; ++i)
+            m_WorkerThreads.emplace_back([this]() { WorkerThreadProc(); });
+    }
+
+    // clang-format off
+    ThreadPool           (const ThreadPool&)  = delete;
+    ThreadPool           (      ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&)  = delete;
+    ThreadPool& operator=(      ThreadPool&&) = delete;
+    // clang-format on
+
+    /// Waits until all pending tasks are executed and joins the worker threads.
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_QueueMtx};
+            m_Stop = true;
+        }
+        m_QueueCondVar.notify_all();
+
+        for (auto& Worker : m_WorkerThreads)
+            Worker.join();
+    }
+
+    /// Enqueues the task and returns the future that will hold its result.
+    template <typename TaskType>
+    auto Enqueue(TaskType&& Task) -> std::future<decltype(Task())>
+    {
+        using ReturnType = decltype(Task());
+
+        // std::function requires the callable to be copy-constructible,
+        // so the packaged task is held through the shared pointer.
+        auto pTask  = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<TaskType>(Task));
+        auto Future = pTask->get_future();
+        {
+            std::lock_guard<std::mutex> Lock{m_QueueMtx};
+            VERIFY(!m_Stop, "Enqueueing a task into the thread pool that is being destroyed");
+            m_Tasks.emplace_back([pTask]() { (*pTask)(); });
+        }
+        m_QueueCondVar.notify_one();
+
+        return Future;
+    }
+
+    size_t GetNumThreads() const
+    {
+        return m_WorkerThreads.size();
+    }
+
+    size_t GetNumPendingTasks() const
+    {
+        std::lock_guard<std::mutex> Lock{m_QueueMtx};
+        return m_Tasks.size();
+    }
+
+    static size_t GetDefaultThreadCount()
+    {
+        const auto NumHWThreads = std::thread::hardware_concurrency();
+        return NumHWThreads != 0 ? NumHWThreads : 1;
+    }
+
+private:
+    void WorkerThreadProc()
+    {
+        for (;;)
+        {
+            std::function<void()> Task;
+            {
+                std::unique_lock<std::mutex> Lock{m_QueueMtx};
+                m_QueueCondVar.wait(Lock, [this]() { return m_Stop || !m_Tasks.empty(); });
+                // Drain the queue before exiting so that no future is left unsatisfied
+                if (m_Tasks.empty())
+                    return;
+
+                Task = std::move(m_Tasks.front());
+                m_Tasks.pop_front();
+            }
+            Task();
+        }
+    }
+
+    mutable std::mutex                m_QueueMtx;
+    std::condition_variable           m_QueueCondVar;
+    std::deque<std::function<void()>> m_Tasks;
+    bool                              m_Stop = false;
+
+    std::vector<std::thread> m_WorkerThreads;
+};
+
+} // namespace ThreadingTools
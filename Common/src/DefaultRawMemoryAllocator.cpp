@@ -38,6 +38,7 @@ DefaultRawMemoryAllocator::DefaultRawMemoryAllocator()
 void* DefaultRawMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
 {
     VERIFY_EXPR(Size > 0);
+    m_AllocationCount.fetch_add(1, std::memory_order_relaxed);
     return new Uint8[Size];
 }
 
@@ -27,6 +27,9 @@
 
 #include "pch.h"
 #include <algorithm>
+#include <atomic>
+#include <new>
+#include <unordered_set>
 #include "FixedBlockMemoryAllocator.hpp"
 #include "Align.hpp"
 
@@ -38,9 +41,326 @@ static size_t AdjustBlockSize(size_t BlockSize)
     return Align(std::max(BlockSize, size_t{1}), sizeof(void*));
 }
 
+// Thread-caching mode.
+//
+// Free blocks are linked into chains through the first pointer stored in every block.
+// Every thread keeps a chain of free blocks for every allocator it uses. When the
+// chain runs dry, the thread takes a batch of blocks from the shared depot; when the
+// chain grows too long, the thread returns a batch back to the depot. Batches in the
+// depot form a stack linked through the second pointer of the first block in the batch.
+//
+// Returning batches is lock-free. Taking a batch is serialized by the mutex, which
+// rules out the ABA problem: a batch cannot be taken and returned again while another
+// thread is trying to take it.
+//
+// Memory pages are aligned to a power of two, and the page header at the beginning of
+// the page is found by masking the block address. The raw allocator has no notion of
+// alignment, so every page is over-allocated and aligned inside the raw memory block.
+//
+// Thread caches are owned by the depot and are released together with it. A thread only
+// keeps pointers to its caches tagged with the depot ids, see ThreadCacheRegistry.
+struct FixedBlockMemoryAllocator::ThreadCache
+{
+    void*  pHead     = nullptr;
+    Uint32 NumBlocks = 0;
+    // Whether the cache is assigned to a thread. Protected by the depot mutex.
+    bool InUse = false;
+};
+
+struct FixedBlockMemoryAllocator::ThreadCacheDepot
+{
+    struct PageHeader
+    {
+        const ThreadCacheDepot* pDepot;
+    };
+    static constexpr size_t PageHeaderSize = 16;
+    static_assert(sizeof(PageHeader) <= PageHeaderSize, "Page header does not fit into the reserved space");
+
+    // The number of blocks transferred between a thread cache and the depot
+    static constexpr Uint32 BatchSize = 32;
+
+    ThreadCacheDepot(IMemoryAllocator& _RawAllocator, size_t _BlockSize, Uint32 NumBlocksInPage) :
+        // clang-format off
+        Id           {NextId.fetch_add(1) + 1},
+        RawAllocator {_RawAllocator},
+        BlockSize    {std::max(_BlockSize, 2 * sizeof(void*))},
+        PageAlignment{ComputePageAlignment(BlockSize, NumBlocksInPage)},
+        BlocksInPage {static_cast<Uint32>((PageAlignment - PageHeaderSize) / BlockSize)},
+        RawPages     (STD_ALLOCATOR_RAW_MEM(void*, _RawAllocator, "Allocator for vector<void*>")),
+        Caches       (STD_ALLOCATOR_RAW_MEM(ThreadCache*, _RawAllocator, "Allocator for vector<ThreadCache*>"))
+    // clang-format on
+    {
+        VERIFY_EXPR(BlocksInPage >= std::max(NumBlocksInPage, 1u));
+    }
+
+    ~ThreadCacheDepot()
+    {
+        for (auto* pCache : Caches)
+        {
+            pCache->~ThreadCache();
+            RawAllocator.Free(pCache);
+        }
+        for (auto* pRawMemory : RawPages)
+            RawAllocator.Free(pRawMemory);
+    }
+
+    // clang-format off
+    ThreadCacheDepot           (const ThreadCacheDepot&) = delete;
+    ThreadCacheDepot           (ThreadCacheDepot&&)      = delete;
+    ThreadCacheDepot& operator=(const ThreadCacheDepot&) = delete;
+    ThreadCacheDepot& operator=(ThreadCacheDepot&&)      = delete;
+    // clang-format on
+
+    static size_t ComputePageAlignment(size_t BlockSize, Uint32 NumBlocksInPage)
+    {
+        const size_t MinPageSize   = PageHeaderSize + BlockSize * std::max(NumBlocksInPage, 1u);
+        size_t       PageAlignment = 4096;
+        while (PageAlignment < MinPageSize)
+            PageAlignment *= 2;
+        return PageAlignment;
+    }
+
+    static void*& NextBlock(void* pBlock)
+    {
+        return reinterpret_cast<void**>(pBlock)[0];
+    }
+
+    static void*& NextBatch(void* pBlock)
+    {
+        return reinterpret_cast<void**>(pBlock)[1];
+    }
+
+    const PageHeader& GetPageHeader(const void* pBlock) const
+    {
+        return *reinterpret_cast<const PageHeader*>(reinterpret_cast<uintptr_t>(pBlock) & ~(PageAlignment - 1));
+    }
+
+#ifdef DILIGENT_DEBUG
+    void dbgVerifyBlock(const void* pBlock) const
+    {
+        const auto& Header = GetPageHeader(pBlock);
+        VERIFY(Header.pDepot == this, "This block was not allocated by this allocator");
+        const auto Offset = reinterpret_cast<const Uint8*>(pBlock) - reinterpret_cast<const Uint8*>(&Header) - PageHeaderSize;
+        VERIFY(Offset >= 0 && static_cast<size_t>(Offset) % BlockSize == 0 && static_cast<size_t>(Offset) / BlockSize < BlocksInPage,
+               "Invalid block address");
+    }
+#endif
+
+    // Returns a chain of blocks to the depot. This method is lock-free.
+    void PushBatch(void* pFirstBlock)
+    {
+        VERIFY_EXPR(pFirstBlock != nullptr);
+        auto* pHead = BatchStack.load(std::memory_order_relaxed);
+        do
+        {
+            NextBatch(pFirstBlock) = pHead;
+        } while (!BatchStack.compare_exchange_weak(pHead, pFirstBlock, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Takes a chain of free blocks from the depot, allocating a new page if necessary.
+    void* PopBatch(Uint32& NumBlocks)
+    {
+        std::lock_guard<std::mutex> Lock{Mtx};
+
+        auto* pBatch = BatchStack.load(std::memory_order_acquire);
+        // No other thread can take this batch while we hold the mutex, so it is safe to read its link
+        while (pBatch != nullptr && !BatchStack.compare_exchange_weak(pBatch, NextBatch(pBatch), std::memory_order_acquire, std::memory_order_acquire))
+        {}
+
+        if (pBatch != nullptr)
+        {
+            NumBlocks = 0;
+            for (auto* pBlock = pBatch; pBlock != nullptr; pBlock = NextBlock(pBlock))
+                ++NumBlocks;
+            return pBatch;
+        }
+
+        if (NumUncarvedBlocks == 0)
+        {
+            // Over-allocate the page so that it can be aligned inside the raw memory block
+            auto* pRawMemory = RawAllocator.Allocate(PageAlignment * 2 - 1, "FixedBlockMemoryAllocator page", __FILE__, __LINE__);
+            if (pRawMemory == nullptr)
+                LOG_ERROR_AND_THROW("Failed to allocate FixedBlockMemoryAllocator page");
+            RawPages.push_back(pRawMemory);
+
+            auto* pPage = Align(reinterpret_cast<Uint8*>(pRawMemory), PageAlignment);
+            FillWithDebugPattern(pPage, MemoryPage::NewPageMemPattern, PageAlignment);
+            auto* pHeader   = reinterpret_cast<PageHeader*>(pPage);
+            pHeader->pDepot = this;
+
+            pNextUncarvedBlock = pPage + PageHeaderSize;
+            NumUncarvedBlocks  = BlocksInPage;
+        }
+
+        // Carve the new batch from the current page
+        NumBlocks = std::min(NumUncarvedBlocks, Uint32{BatchSize});
+        pBatch    = pNextUncarvedBlock;
+        for (Uint32 i = 0; i < NumBlocks; ++i)
+        {
+            auto* pBlock = pNextUncarvedBlock;
+            pNextUncarvedBlock += BlockSize;
+            NextBlock(pBlock) = i + 1 < NumBlocks ? pNextUncarvedBlock : nullptr;
+        }
+        NumUncarvedBlocks -= NumBlocks;
+
+        return pBatch;
+    }
+
+    // Assigns a cache to the calling thread, reusing the caches of the threads that have exited
+    ThreadCache& AcquireCache()
+    {
+        std::lock_guard<std::mutex> Lock{Mtx};
+        for (auto* pCache : Caches)
+        {
+            if (!pCache->InUse)
+            {
+                pCache->InUse = true;
+                return *pCache;
+            }
+        }
+
+        auto* pCache = new (RawAllocator.Allocate(sizeof(ThreadCache), "FixedBlockMemoryAllocator thread cache", __FILE__, __LINE__)) ThreadCache{};
+        Caches.push_back(pCache);
+        pCache->InUse = true;
+        return *pCache;
+    }
+
+    // Returns the blocks cached by the exiting thread to the depot and makes the cache available to other threads
+    void ReleaseCache(ThreadCache& Cache)
+    {
+        if (Cache.pHead != nullptr)
+            PushBatch(Cache.pHead);
+        Cache.pHead     = nullptr;
+        Cache.NumBlocks = 0;
+
+        std::lock_guard<std::mutex> Lock{Mtx};
+        Cache.InUse = false;
+    }
+
+    static std::atomic<Uint64> NextId;
+
+    // Unique depot id that is used to find thread caches. Unlike the address, the id is never reused.
+    const Uint64      Id;
+    IMemoryAllocator& RawAllocator;
+    const size_t      BlockSize;
+    const size_t      PageAlignment;
+    const Uint32      BlocksInPage;
+
+    std::atomic<void*> BatchStack{nullptr};
+
+    // Serializes popping batches, carving new blocks and assigning thread caches
+    std::mutex                                                  Mtx;
+    std::vector<void*, STDAllocatorRawMem<void*>>               RawPages;
+    std::vector<ThreadCache*, STDAllocatorRawMem<ThreadCache*>> Caches;
+    Uint8*                                                      pNextUncarvedBlock = nullptr;
+    Uint32                                                      NumUncarvedBlocks  = 0;
+
+#ifdef DILIGENT_DEBUG
+    std::atomic<Int64> dbgNumAllocations{0};
+#endif
+};
+
+std::atomic<Uint64> FixedBlockMemoryAllocator::ThreadCacheDepot::NextId{0};
+
+// Per-thread list of the caches of all thread-caching allocators used by the thread.
+//
+// The list does not own the caches. The ids of the depots that are alive are kept in a global
+// set protected by a global mutex: an exiting thread only returns its blocks to the depots that
+// are still alive, and holds the mutex while doing so, so that the depot can't be destroyed
+// meanwhile. The depot ids are never reused, so a cache of a destroyed depot is never found
+// by the lookup even if a new depot is created at the same address.
+class FixedBlockMemoryAllocator::ThreadCacheRegistry
+{
+public:
+    using DepotType = FixedBlockMemoryAllocator::ThreadCacheDepot;
+
+    ~ThreadCacheRegistry()
+    {
+        std::lock_guard<std::mutex> Lock{GetAliveDepotsMutex()};
+
+        const auto& AliveDepots = GetAliveDepots();
+        for (auto& Entry : m_Entries)
+        {
+            if (AliveDepots.find(Entry.DepotId) != AliveDepots.end())
+                Entry.pDepot->ReleaseCache(*Entry.pCache);
+        }
+    }
+
+    ThreadCache& GetCache(DepotType& Depot)
+    {
+        for (auto& Entry : m_Entries)
+        {
+            if (Entry.DepotId == Depot.Id)
+                return *Entry.pCache;
+        }
+
+        {
+            // Remove caches of the allocators that have been destroyed.
+            // Their blocks were released together with the depot.
+            std::lock_guard<std::mutex> Lock{GetAliveDepotsMutex()};
+
+            const auto& AliveDepots = GetAliveDepots();
+            m_Entries.erase(std::remove_if(m_Entries.begin(), m_Entries.end(),
+                                           [&](const Entry& E) { return AliveDepots.find(E.DepotId) == AliveDepots.end(); }),
+                            m_Entries.end());
+        }
+
+        m_Entries.emplace_back(Depot.Id, &Depot, &Depot.AcquireCache());
+        return *m_Entries.back().pCache;
+    }
+
+    static ThreadCacheRegistry& Get()
+    {
+        static thread_local ThreadCacheRegistry Registry;
+        return Registry;
+    }
+
+    static void RegisterDepot(const DepotType& Depot)
+    {
+        std::lock_guard<std::mutex> Lock{GetAliveDepotsMutex()};
+        GetAliveDepots().insert(Depot.Id);
+    }
+
+    // Must be called before the depot is destroyed. After this call, no thread will access the depot
+    // through its thread cache list.
+    static void UnregisterDepot(const DepotType& Depot)
+    {
+        std::lock_guard<std::mutex> Lock{GetAliveDepotsMutex()};
+        GetAliveDepots().erase(Depot.Id);
+    }
+
+private:
+    static std::mutex& GetAliveDepotsMutex()
+    {
+        static std::mutex Mtx;
+        return Mtx;
+    }
+
+    static std::unordered_set<Uint64>& GetAliveDepots()
+    {
+        static std::unordered_set<Uint64> AliveDepots;
+        return AliveDepots;
+    }
+
+    struct Entry
+    {
+        Entry(Uint64 _DepotId, DepotType* _pDepot, ThreadCache* _pCache) :
+            DepotId{_DepotId},
+            pDepot{_pDepot},
+            pCache{_pCache}
+        {}
+
+        Uint64       DepotId;
+        DepotType*   pDepot;
+        ThreadCache* pCache;
+    };
+    std::vector<Entry> m_Entries;
+};
+
 FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator,
                                                      size_t            BlockSize,
-                                                     Uint32            NumBlocksInPage) :
+                                                     Uint32            NumBlocksInPage,
+                                                     bool              ThreadCaching) :
     // clang-format off
     m_PagePool          (STD_ALLOCATOR_RAW_MEM(MemoryPage, RawMemoryAllocator, "Allocator for vector<MemoryPage>")),
     m_AvailablePages    (STD_ALLOCATOR_RAW_MEM(size_t, RawMemoryAllocator, "Allocator for unordered_set<size_t>") ),
@@ -50,13 +370,34 @@ FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemory
     m_NumBlocksInPage   {NumBlocksInPage           }
 // clang-format on
 {
-    // Allocate one page
-    CreateNewPage();
+    if (ThreadCaching)
+    {
+        auto* pDepotMem = RawMemoryAllocator.Allocate(sizeof(ThreadCacheDepot), "FixedBlockMemoryAllocator::ThreadCacheDepot", __FILE__, __LINE__);
+        m_pThreadCacheDepot = std::unique_ptr<ThreadCacheDepot, STDDeleterRawMem<ThreadCacheDepot>>{
+            new (pDepotMem) ThreadCacheDepot{RawMemoryAllocator, m_BlockSize, NumBlocksInPage},
+            STDDeleterRawMem<ThreadCacheDepot>{RawMemoryAllocator}};
+        ThreadCacheRegistry::RegisterDepot(*m_pThreadCacheDepot);
+    }
+    else
+    {
+        // Allocate one page
+        CreateNewPage();
+    }
 }
 
 FixedBlockMemoryAllocator::~FixedBlockMemoryAllocator()
 {
+    if (m_pThreadCacheDepot)
+    {
+        // Detach the depot from the threads. Blocks cached by the threads are released
+        // together with the pages, and the caches are released by the depot.
+        ThreadCacheRegistry::UnregisterDepot(*m_pThreadCacheDepot);
+    }
+
 #ifdef DILIGENT_DEBUG
+    if (m_pThreadCacheDepot)
+        VERIFY(m_pThreadCacheDepot->dbgNumAllocations == 0, "Memory leak detected: ", m_pThreadCacheDepot->dbgNumAllocations.load(), " block(s) have not been released");
+
     for (size_t p = 0; p < m_PagePool.size(); ++p)
     {
         VERIFY(!m_PagePool[p].HasAllocations(), "Memory leak detected: memory page has allocated block");
@@ -79,6 +420,9 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
     Size = AdjustBlockSize(Size);
     VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
 
+    if (m_pThreadCacheDepot)
+        return AllocateFromThreadCache();
+
     std::lock_guard<std::mutex> LockGuard(m_Mutex);
 
     if (m_AvailablePages.empty())
@@ -100,6 +444,12 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
 
 void FixedBlockMemoryAllocator::Free(void* Ptr)
 {
+    if (m_pThreadCacheDepot)
+    {
+        FreeToThreadCache(Ptr);
+        return;
+    }
+
     std::lock_guard<std::mutex> LockGuard(m_Mutex);
     auto                        PageIdIt = m_AddrToPageId.find(Ptr);
     if (PageIdIt != m_AddrToPageId.end())
@@ -124,4 +474,60 @@ void FixedBlockMemoryAllocator::Free(void* Ptr)
     }
 }
 
+void* FixedBlockMemoryAllocator::AllocateFromThreadCache()
+{
+    auto& Depot = *m_pThreadCacheDepot;
+    auto& Cache = ThreadCacheRegistry::Get().GetCache(Depot);
+    if (Cache.pHead == nullptr)
+    {
+        VERIFY_EXPR(Cache.NumBlocks == 0);
+        Cache.pHead = Depot.PopBatch(Cache.NumBlocks);
+    }
+
+    auto* Ptr = Cache.pHead;
+    VERIFY_EXPR(Ptr != nullptr && Cache.NumBlocks > 0);
+#ifdef DILIGENT_DEBUG
+    Depot.dbgVerifyBlock(Ptr);
+    Depot.dbgNumAllocations.fetch_add(1);
+#endif
+    Cache.pHead = ThreadCacheDepot::NextBlock(Ptr);
+    --Cache.NumBlocks;
+
+    FillWithDebugPattern(Ptr, MemoryPage::AllocatedBlockMemPattern, Depot.BlockSize);
+    return Ptr;
+}
+
+void FixedBlockMemoryAllocator::FreeToThreadCache(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+
+    auto& Depot = *m_pThreadCacheDepot;
+#ifdef DILIGENT_DEBUG
+    Depot.dbgVerifyBlock(Ptr);
+    Depot.dbgNumAllocations.fetch_sub(1);
+#endif
+    FillWithDebugPattern(Ptr, MemoryPage::DeallocatedBlockMemPattern, Depot.BlockSize);
+
+    auto& Cache                      = ThreadCacheRegistry::Get().GetCache(Depot);
+    ThreadCacheDepot::NextBlock(Ptr) = Cache.pHead;
+    Cache.pHead                      = Ptr;
+    ++Cache.NumBlocks;
+
+    if (Cache.NumBlocks >= ThreadCacheDepot::BatchSize * 2)
+    {
+        // Return one batch to the depot and keep the rest
+        auto* pBatch     = Cache.pHead;
+        auto* pLastBlock = pBatch;
+        for (Uint32 i = 1; i < ThreadCacheDepot::BatchSize; ++i)
+            pLastBlock = ThreadCacheDepot::NextBlock(pLastBlock);
+
+        Cache.pHead = ThreadCacheDepot::NextBlock(pLastBlock);
+        Cache.NumBlocks -= ThreadCacheDepot::BatchSize;
+        ThreadCacheDepot::NextBlock(pLastBlock) = nullptr;
+
+        Depot.PushBatch(pBatch);
+    }
+}
+
 } // namespace Diligent
@@ -26,11 +26,248 @@
  */
 
 #include <thread>
+#include <chrono>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#    include <emmintrin.h>
+#elif defined(_M_ARM) || defined(_M_ARM64)
+#    include <intrin.h>
+#endif
+
+#if DILIGENT_SPINLOCK_FUTEX
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
 #include "LockHelper.hpp"
 
 namespace ThreadingTools
 {
 
+namespace
+{
+
+// Hints the CPU that the thread is in a spin-wait loop
+inline void Pause()
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(_M_ARM) || defined(_M_ARM64)
+    __yield();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// The maximum number of pause instructions between two polls of the lock flag
+constexpr int MaxBackoff = 64;
+
+class LockStatisticsRegistry
+{
+public:
+    static LockStatisticsRegistry& Get()
+    {
+        // The registry is never destroyed, so that the statistics can be safely
+        // updated by locks in objects with static storage duration
+        static LockStatisticsRegistry* const pRegistry = new LockStatisticsRegistry;
+        return *pRegistry;
+    }
+
+    template <typename CreateStatsType>
+    LockStatistics* Register(const char* Name, CreateStatsType&& CreateStats)
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        for (auto& pStats : m_Stats)
+        {
+            if (strcmp(pStats->GetName(), Name) == 0)
+                return pStats.get();
+        }
+        m_Stats.emplace_back(CreateStats());
+        return m_Stats.back().get();
+    }
+
+    template <typename HandlerType>
+    void ProcessAll(HandlerType&& Handler)
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        for (auto& pStats : m_Stats)
+            Handler(*pStats);
+    }
+
+    std::atomic<bool> CollectionEnabled{false};
+
+private:
+    std::mutex                                   m_Mtx;
+    std::vector<std::unique_ptr<LockStatistics>> m_Stats;
+};
+
+#if DILIGENT_SPINLOCK_FUTEX
+
+// Threads are parked on a small table of futex words rather than on the lock flags themselves:
+// the flag is not necessarily 32 bits wide and must remain a valid Atomics::AtomicLong.
+// Locks that hash to the same bucket share the futex, so all waiters of the bucket are woken.
+struct alignas(64) ParkingBucket
+{
+    std::atomic<int> Sequence{0};
+};
+
+constexpr size_t NumParkingBuckets = 64;
+ParkingBucket    ParkingBuckets[NumParkingBuckets];
+
+ParkingBucket& GetParkingBucket(const LockFlag& LockFlag)
+{
+    return ParkingBuckets[(reinterpret_cast<size_t>(&LockFlag) / sizeof(void*)) % NumParkingBuckets];
+}
+
+#endif
+
+} // namespace
+
+void LockStatistics::SetCollectionEnabled(bool Enabled) noexcept
+{
+    LockStatisticsRegistry::Get().CollectionEnabled.store(Enabled);
+}
+
+bool LockStatistics::IsCollectionEnabled() noexcept
+{
+    return LockStatisticsRegistry::Get().CollectionEnabled.load();
+}
+
+LockStatistics* LockStatistics::Register(const char* Name)
+{
+    VERIFY_EXPR(Name != nullptr);
+    auto& Registry = LockStatisticsRegistry::Get();
+    if (!Registry.CollectionEnabled.load())
+        return nullptr;
+
+    return Registry.Register(Name, [Name]() { return std::unique_ptr<LockStatistics>{new LockStatistics{Name}}; });
+}
+
+LockStatistics::Counters LockStatistics::GetCounters() const noexcept
+{
+    Counters Cnt;
+    Cnt.Acquisitions          = m_Acquisitions;
+    Cnt.ContendedAcquisitions = m_ContendedAcquisitions;
+    Cnt.SpinCount             = m_SpinCount;
+    Cnt.YieldCount            = m_YieldCount;
+    Cnt.WaitTimeNs            = m_WaitTimeNs;
+    return Cnt;
+}
+
+void LockStatistics::Reset() noexcept
+{
+    m_Acquisitions          = 0;
+    m_ContendedAcquisitions = 0;
+    m_SpinCount             = 0;
+    m_YieldCount            = 0;
+    m_WaitTimeNs            = 0;
+}
+
+std::string LockStatistics::DumpAll()
+{
+    std::stringstream ss;
+    ss << std::left << std::setw(32) << "Lock" << std::right
+       << std::setw(14) << "Acquisitions"
+       << std::setw(14) << "Contended"
+       << std::setw(14) << "Spins"
+       << std::setw(10) << "Yields"
+       << std::setw(14) << "Wait (ms)" << '\n';
+
+    LockStatisticsRegistry::Get().ProcessAll(
+        [&ss](const LockStatistics& Stats) //
+        {
+            const auto Cnt = Stats.GetCounters();
+            ss << std::left << std::setw(32) << Stats.GetName() << std::right
+               << std::setw(14) << Cnt.Acquisitions
+               << std::setw(14) << Cnt.ContendedAcquisitions
+               << std::setw(14) << Cnt.SpinCount
+               << std::setw(10) << Cnt.YieldCount
+               << std::setw(14) << std::fixed << std::setprecision(3) << static_cast<double>(Cnt.WaitTimeNs) * 1e-6 << '\n';
+        });
+
+    return ss.str();
+}
+
+void LockStatistics::ResetAll() noexcept
+{
+    LockStatisticsRegistry::Get().ProcessAll([](LockStatistics& Stats) { Stats.Reset(); });
+}
+
+void LockHelper::WaitAndAcquire(LockFlag& LockFlag, int SpinCountToYield) noexcept
+{
+    auto* const pStats = LockFlag.GetStatistics();
+
+    std::chrono::steady_clock::time_point StartTime;
+    if (pStats != nullptr)
+        StartTime = std::chrono::steady_clock::now();
+
+    Atomics::Int64 TotalSpins  = 0;
+    Atomics::Int64 TotalYields = 0;
+
+    int Backoff   = 1;
+    int SpinCount = 0;
+    for (;;)
+    {
+        // Only attempt the compare-exchange when the flag has been observed unlocked:
+        // polling with plain loads does not take the cache line away from the owner.
+        if (LockFlag.m_Flag == LockFlag::LOCK_FLAG_UNLOCKED && TryAcquire(LockFlag))
+            break;
+
+        for (int i = 0; i < Backoff; ++i)
+            Pause();
+        TotalSpins += Backoff;
+        SpinCount += Backoff;
+        if (Backoff < MaxBackoff)
+            Backoff *= 2;
+
+        if (SpinCount >= SpinCountToYield)
+        {
+            SpinCount = 0;
+            ++TotalYields;
+#if DILIGENT_SPINLOCK_FUTEX
+            auto&     Bucket   = GetParkingBucket(LockFlag);
+            const int Sequence = Bucket.Sequence.load();
+            // Mark the lock as contended so that the owner wakes us up when it releases the lock.
+            // If the lock has been released in the meantime, we now own it.
+            if (LockFlag.m_Flag.exchange(LockFlag::LOCK_FLAG_LOCKED_CONTENDED) == LockFlag::LOCK_FLAG_UNLOCKED)
+                break;
+            // The wait returns immediately if the owner has already bumped the sequence
+            syscall(SYS_futex, &Bucket.Sequence, FUTEX_WAIT_PRIVATE, Sequence, nullptr, nullptr, 0);
+            Backoff = 1;
+#else
+            YieldThread();
+#endif
+        }
+    }
+
+    if (pStats != nullptr)
+    {
+        const auto WaitTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - StartTime);
+        Atomics::AtomicIncrement(pStats->m_ContendedAcquisitions);
+        Atomics::AtomicAdd(pStats->m_SpinCount, TotalSpins);
+        Atomics::AtomicAdd(pStats->m_YieldCount, TotalYields);
+        Atomics::AtomicAdd(pStats->m_WaitTimeNs, static_cast<Atomics::Int64>(WaitTime.count()));
+    }
+}
+
+#if DILIGENT_SPINLOCK_FUTEX
+void LockHelper::WakeWaiters(LockFlag& LockFlag) noexcept
+{
+    auto& Bucket = GetParkingBucket(LockFlag);
+    Bucket.Sequence.fetch_add(1);
+    syscall(SYS_futex, &Bucket.Sequence, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
+#endif
+
 void LockHelper::YieldThread() noexcept
 {
     std::this_thread::yield();
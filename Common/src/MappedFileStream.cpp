@@ -0,0 +1,241 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "MappedFileStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS
+#    define DILIGENT_MMAP_SUPPORTED 1
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#else
+#    define DILIGENT_MMAP_SUPPORTED 0
+#endif
+
+#include "DataBlobImpl.hpp"
+
+namespace Diligent
+{
+
+MappedDataBlob::MappedDataBlob(IReferenceCounters* pRefCounters,
+                               const Char*         Path,
+                               EFileAccessHint     AccessHint) :
+    TBase{pRefCounters}
+{
+#if DILIGENT_MMAP_SUPPORTED
+    int fd = open(Path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file '", Path, "' for mapping");
+        return;
+    }
+
+    struct stat FileStat;
+    if (fstat(fd, &FileStat) != 0 || !S_ISREG(FileStat.st_mode))
+    {
+        LOG_ERROR_MESSAGE("Failed to map file '", Path, "': the path does not refer to a regular file");
+        close(fd);
+        return;
+    }
+
+    m_Size = static_cast<size_t>(FileStat.st_size);
+    if (m_Size > 0)
+    {
+        // Private writable mapping is copy-on-write: pages are shared with the page cache
+        // until written to, and the changes are never written back to the file.
+        void* pData = mmap(nullptr, m_Size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (pData == MAP_FAILED)
+        {
+            LOG_ERROR_MESSAGE("Failed to map file '", Path, "': mmap failed");
+            m_Size = 0;
+            close(fd);
+            return;
+        }
+        m_pData = pData;
+
+        if (AccessHint == EFileAccessHint::Sequential)
+        {
+            // Files are typically consumed right away, so start reading them in immediately
+            madvise(m_pData, m_Size, MADV_SEQUENTIAL);
+            madvise(m_pData, m_Size, MADV_WILLNEED);
+        }
+        else
+        {
+            madvise(m_pData, m_Size, MADV_RANDOM);
+        }
+    }
+
+    // The mapping holds its own reference to the file
+    close(fd);
+    m_IsValid = true;
+#else
+    (void)Path;
+    (void)AccessHint;
+#endif
+}
+
+MappedDataBlob::~MappedDataBlob()
+{
+#if DILIGENT_MMAP_SUPPORTED
+    if (m_pData != nullptr)
+        munmap(m_pData, m_Size);
+#endif
+}
+
+IMPLEMENT_QUERY_INTERFACE(MappedDataBlob, IID_DataBlob, TBase)
+
+void MappedDataBlob::Resize(size_t NewSize)
+{
+    if (NewSize != m_Size)
+        LOG_ERROR_MESSAGE("Mapped data blob can't be resized");
+}
+
+size_t MappedDataBlob::GetSize() const
+{
+    return m_Size;
+}
+
+void* MappedDataBlob::GetDataPtr()
+{
+    return m_pData;
+}
+
+const void* MappedDataBlob::GetConstDataPtr() const
+{
+    return m_pData;
+}
+
+
+MappedFileStream::MappedFileStream(IReferenceCounters* pRefCounters,
+                                   const Char*         Path,
+                                   EFileAccessHint     AccessHint) :
+    TBase{pRefCounters},
+    m_pDataBlob{MakeNewRCObj<MappedDataBlob>()(Path, AccessHint)}
+{
+}
+
+void MappedFileStream::QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface)
+{
+    if (ppInterface == nullptr)
+        return;
+    if (IID == IID_MappedFileStream || IID == IID_FileStream)
+    {
+        *ppInterface = this;
+        (*ppInterface)->AddRef();
+    }
+    else
+    {
+        TBase::QueryInterface(IID, ppInterface);
+    }
+}
+
+bool MappedFileStream::Read(void* Data, size_t Size)
+{
+    VERIFY_EXPR(m_CurrentOffset <= m_pDataBlob->GetSize());
+    auto  BytesLeft   = m_pDataBlob->GetSize() - m_CurrentOffset;
+    auto  BytesToRead = std::min(BytesLeft, Size);
+    auto* pSrcData    = reinterpret_cast<const Uint8*>(m_pDataBlob->GetConstDataPtr()) + m_CurrentOffset;
+    if (BytesToRead > 0)
+        memcpy(Data, pSrcData, BytesToRead);
+    m_CurrentOffset += BytesToRead;
+    return Size == BytesToRead;
+}
+
+void MappedFileStream::ReadBlob(IDataBlob* pData)
+{
+    auto BytesLeft = m_pDataBlob->GetSize() - m_CurrentOffset;
+    pData->Resize(BytesLeft);
+    auto res = Read(pData->GetDataPtr(), pData->GetSize());
+    VERIFY_EXPR(res);
+    (void)res;
+}
+
+RefCntAutoPtr<IDataBlob> MappedFileStream::ReadRemainingData()
+{
+    if (m_CurrentOffset == 0)
+    {
+        m_CurrentOffset = m_pDataBlob->GetSize();
+        return RefCntAutoPtr<IDataBlob>{m_pDataBlob};
+    }
+
+    RefCntAutoPtr<IDataBlob> pData{MakeNewRCObj<DataBlobImpl>()(0)};
+    ReadBlob(pData);
+    return pData;
+}
+
+bool MappedFileStream::Write(const void* Data, size_t Size)
+{
+    LOG_ERROR_MESSAGE("Mapped file stream is read-only");
+    return false;
+}
+
+bool MappedFileStream::IsValid()
+{
+    return m_pDataBlob->IsValid();
+}
+
+size_t MappedFileStream::GetSize()
+{
+    return m_pDataBlob->GetSize();
+}
+
+bool MappedFileStream::GetMappableFileSize(const Char* Path, size_t& Size)
+{
+#if DILIGENT_MMAP_SUPPORTED
+    struct stat FileStat;
+    if (stat(Path, &FileStat) != 0 || !S_ISREG(FileStat.st_mode))
+        return false;
+
+    Size = static_cast<size_t>(FileStat.st_size);
+    return true;
+#else
+    (void)Path;
+    (void)Size;
+    return false;
+#endif
+}
+
+
+RefCntAutoPtr<IDataBlob> ReadStreamData(IFileStream* pStream)
+{
+    RefCntAutoPtr<MappedFileStream> pMappedStream{pStream, IID_MappedFileStream};
+    if (pMappedStream)
+        return pMappedStream->ReadRemainingData();
+
+    RefCntAutoPtr<IDataBlob> pData{MakeNewRCObj<DataBlobImpl>()(0)};
+    pStream->ReadBlob(pData);
+    return pData;
+}
+
+} // namespace Diligent
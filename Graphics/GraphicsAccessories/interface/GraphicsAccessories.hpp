@@ -38,6 +38,11 @@
 #include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
 #include "../../../Platforms/interface/PlatformMisc.hpp"
 
+namespace ThreadingTools
+{
+class ThreadPool;
+}
+
 namespace Diligent
 {
 
@@ -574,6 +579,21 @@ BufferToTextureCopyInfo GetBufferToTextureCopyInfo(const TextureDesc& TexDesc,
                                                    Uint32             RowStrideAlignment);
 
 
+/// Texture subresource copy flags.
+enum COPY_TEXTURE_SUBRESOURCE_FLAGS : Uint32
+{
+    COPY_TEXTURE_SUBRESOURCE_FLAG_NONE = 0u,
+
+    /// The destination is write-combined memory (e.g. a mapped upload heap)
+    /// that is not read by the CPU. The data is written with non-temporal stores
+    /// that bypass the cache.
+    COPY_TEXTURE_SUBRESOURCE_FLAG_WRITE_COMBINED = 1u << 0u
+};
+DEFINE_FLAG_ENUM_OPERATORS(COPY_TEXTURE_SUBRESOURCE_FLAGS)
+
+/// Copies that are smaller than this size are always performed by the calling thread.
+static constexpr size_t MinParallelTextureCopySize = size_t{4} << 20;
+
 /// Copies texture subresource data on the CPU.
 
 /// \param [in] SrcSubres      - Source subresource data.
@@ -583,12 +603,20 @@ BufferToTextureCopyInfo GetBufferToTextureCopyInfo(const TextureDesc& TexDesc,
 /// \param [in] pDstData       - Pointer to the destination subresource data.
 /// \param [in] DstRowStride   - Destination subresource row stride, in bytes.
 /// \param [in] DstDepthStride - Destination subresource depth stride, in bytes.
-void CopyTextureSubresource(const TextureSubResData& SrcSubres,
-                            Uint32                   NumRows,
-                            Uint32                   NumDepthSlices,
-                            Uint32                   RowSize,
-                            void*                    pDstData,
-                            Uint32                   DstRowStride,
-                            Uint32                   DstDepthStride);
+/// \param [in] Flags          - Copy flags, see Diligent::COPY_TEXTURE_SUBRESOURCE_FLAGS.
+/// \param [in] pThreadPool    - Optional thread pool. Copies of at least MinParallelTextureCopySize
+///                              bytes are split between the pool threads and the calling thread.
+///
+/// \remarks   Rows that are contiguous in both the source and the destination are
+///            copied as a single block.
+void CopyTextureSubresource(const TextureSubResData&       SrcSubres,
+                            Uint32                         NumRows,
+                            Uint32                         NumDepthSlices,
+                            Uint32                         RowSize,
+                            void*                          pDstData,
+                            Uint32                         DstRowStride,
+                            Uint32                         DstDepthStride,
+                            COPY_TEXTURE_SUBRESOURCE_FLAGS Flags       = COPY_TEXTURE_SUBRESOURCE_FLAG_NONE,
+                            ThreadingTools::ThreadPool*    pThreadPool = nullptr);
 
 } // namespace Diligent
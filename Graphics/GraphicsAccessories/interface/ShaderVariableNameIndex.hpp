@@ -0,0 +1,162 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the Diligent::ShaderVariableNameIndex class
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../../Common/interface/HashUtils.hpp"
+
+namespace Diligent
+{
+
+/// Accelerates the lookup of shader variables by name.
+
+/// The index keeps the variables' name hashes sorted, so that a variable can be found with
+/// a binary search followed by a single string comparison instead of comparing the name with
+/// every variable. The index does not own its memory: the variable manager reserves
+/// GetRequiredMemorySize() bytes in the same block it allocates the variables from and
+/// passes the pointer to Initialize(). The index is built once when the variables are created
+/// and is immutable afterwards.
+/// For a small number of variables, the linear search is faster than the binary search, so
+/// no index is built and Find() compares the name with every variable.
+class ShaderVariableNameIndex
+{
+public:
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    /// The maximum number of variables that are searched linearly.
+    static constexpr Uint32 MaxLinearSearchVariables = 8;
+
+    /// Returns the size of the memory required to index NumVariables variables.
+    static size_t GetRequiredMemorySize(Uint32 NumVariables)
+    {
+        return NumVariables > MaxLinearSearchVariables ? sizeof(Entry) * NumVariables : 0;
+    }
+
+    /// Returns the required alignment of the memory passed to Initialize().
+    static constexpr size_t GetRequiredAlignment()
+    {
+        return alignof(Entry);
+    }
+
+    /// Builds the index.
+
+    /// \param [in] pMemory      - Memory block of at least GetRequiredMemorySize(NumVariables) bytes
+    ///                            aligned by GetRequiredAlignment().
+    /// \param [in] NumVariables - Number of variables.
+    /// \param [in] GetName      - Function that returns the name of the variable with the given index.
+    template <typename NameGetterType>
+    void Initialize(void* pMemory, Uint32 NumVariables, NameGetterType GetName)
+    {
+        VERIFY(m_pEntries == nullptr, "The index has already been initialized");
+
+        m_NumEntries = NumVariables;
+        if (NumVariables <= MaxLinearSearchVariables)
+            return;
+
+        VERIFY(pMemory != nullptr, "Memory must not be null");
+        VERIFY((reinterpret_cast<size_t>(pMemory) % GetRequiredAlignment()) == 0, "Memory is not properly aligned");
+
+        m_pEntries = reinterpret_cast<Entry*>(pMemory);
+        for (Uint32 v = 0; v < NumVariables; ++v)
+            new (m_pEntries + v) Entry{CStringHash<Char>{}(GetName(v)), v};
+
+        // Sort by the variable index within the same hash value to make sure that
+        // Find() returns the first matching variable, same as the linear search.
+        std::sort(m_pEntries, m_pEntries + m_NumEntries,
+                  [](const Entry& lhs, const Entry& rhs) //
+                  {
+                      return lhs.NameHash < rhs.NameHash || (lhs.NameHash == rhs.NameHash && lhs.VarIndex < rhs.VarIndex);
+                  });
+    }
+
+    /// Returns the index of the first variable with the given name that passes the filter,
+    /// or InvalidIndex if there is no such variable.
+
+    /// \param [in] Name    - Variable name.
+    /// \param [in] GetName - Function that returns the name of the variable with the given index.
+    ///                       It is used to resolve hash collisions.
+    /// \param [in] Filter  - Function that returns true if the variable with the given index
+    ///                       should be considered (e.g. if it is used by the requested shader stage).
+    template <typename NameGetterType, typename FilterType>
+    Uint32 Find(const Char* Name, NameGetterType GetName, FilterType Filter) const
+    {
+        VERIFY_EXPR(Name != nullptr);
+
+        if (m_pEntries == nullptr)
+        {
+            for (Uint32 v = 0; v < m_NumEntries; ++v)
+            {
+                if (Filter(v) && strcmp(GetName(v), Name) == 0)
+                    return v;
+            }
+            return InvalidIndex;
+        }
+
+        const auto NameHash = CStringHash<Char>{}(Name);
+        auto       It       = std::lower_bound(m_pEntries, m_pEntries + m_NumEntries, NameHash,
+                                   [](const Entry& Elem, size_t Hash) //
+                                   {
+                                       return Elem.NameHash < Hash;
+                                   });
+        for (; It != m_pEntries + m_NumEntries && It->NameHash == NameHash; ++It)
+        {
+            if (Filter(It->VarIndex) && strcmp(GetName(It->VarIndex), Name) == 0)
+                return It->VarIndex;
+        }
+        return InvalidIndex;
+    }
+
+    /// Returns the index of the first variable with the given name, or InvalidIndex if there is no such variable.
+    template <typename NameGetterType>
+    Uint32 Find(const Char* Name, NameGetterType GetName) const
+    {
+        return Find(Name, GetName, [](Uint32) { return true; });
+    }
+
+    Uint32 GetNumVariables() const { return m_NumEntries; }
+
+private:
+    struct Entry
+    {
+        size_t NameHash;
+        Uint32 VarIndex;
+    };
+
+    Entry* m_pEntries   = nullptr;
+    Uint32 m_NumEntries = 0;
+};
+
+} // namespace Diligent
@@ -0,0 +1,586 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+// Two-level segregated-fit (TLSF) manager of variable-size allocations
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "../../../Primitives/interface/MemoryAllocator.h"
+#include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../../Platforms/interface/PlatformMisc.hpp"
+#include "../../../Common/interface/Align.hpp"
+#include "../../../Common/interface/STDAllocator.hpp"
+#include "VariableSizeAllocationsManager.hpp"
+
+namespace Diligent
+{
+
+// Free block policy of VariableSizeAllocationsManagerImpl. Unlike MapFreeBlocksPolicy that keeps free blocks in
+// ordered maps and allocates a tree node for every free block, this policy uses a two-level segregated-fit
+// (TLSF) index that finds a suitable free block in constant time and does not allocate memory
+// in every operation:
+//
+// * Free blocks are sorted into size classes. The first level splits sizes into powers of two,
+//   the second level splits every power-of-two range into 32 linear classes. Sizes below 32
+//   have their own exact classes.
+// * Every class keeps a doubly-linked list of its free blocks. Non-empty classes are tracked by
+//   bitmaps, so a non-empty class that is not smaller than the requested one is found with two
+//   bit scans.
+// * The requested size is rounded up to the next class boundary, so that any block in the found
+//   class is large enough (good fit rather than best fit). If there is no such block, the class of
+//   the requested size itself is searched.
+// * Free blocks are also indexed by their start and end offsets in two open-addressing hash tables,
+//   which makes merging a released range with its free neighbors a constant-time operation.
+// * Free block descriptors are kept in a pool and are reused.
+//
+//   Size classes:     [0] [1] ... [31] | [32] [33] ... [63] | [64..65] ... [126..127] | [128..131] ... | ...
+//                          fl = 0      |       fl = 1       |          fl = 2          |     fl = 3     |
+//
+class TLSFFreeBlocksPolicy
+{
+public:
+    using OffsetType = VariableSizeAllocationsManagerTypes::OffsetType;
+    using BlockId    = Uint32;
+
+private:
+    using Allocation = VariableSizeAllocationsManagerTypes::Allocation;
+
+    static constexpr Uint32 InvalidIndex = ~Uint32{0};
+
+    // Number of second-level classes (log2)
+    static constexpr Uint32 SLIndexBits = 5;
+    static constexpr Uint32 SLCount     = 1u << SLIndexBits;
+    static constexpr Uint32 FLCount     = sizeof(OffsetType) * 8 - SLIndexBits + 1;
+    static_assert(FLCount <= 64, "First-level bitmap is 64 bits");
+
+    struct FreeBlock
+    {
+        OffsetType Offset;
+        OffsetType Size;
+
+        // Links in the free list of the size class. Unused descriptors
+        // are linked into the descriptor pool through NextFree.
+        Uint32 PrevFree;
+        Uint32 NextFree;
+    };
+
+    // Open-addressing hash table that maps block offsets to block indices
+    class OffsetHashMap
+    {
+    public:
+        explicit OffsetHashMap(IMemoryAllocator& Allocator) :
+            m_Slots(STD_ALLOCATOR_RAW_MEM(Slot, Allocator, "Allocator for vector<TLSFFreeBlocksPolicy::OffsetHashMap::Slot>"))
+        {}
+
+        OffsetHashMap(OffsetHashMap&& rhs) noexcept :
+            m_Slots{std::move(rhs.m_Slots)},
+            m_Count{rhs.m_Count}
+        {
+            rhs.Clear();
+        }
+
+        OffsetHashMap& operator=(OffsetHashMap&& rhs) noexcept
+        {
+            m_Slots = std::move(rhs.m_Slots);
+            m_Count = rhs.m_Count;
+            rhs.Clear();
+            return *this;
+        }
+
+        void Clear()
+        {
+            m_Slots.clear();
+            m_Count = 0;
+        }
+
+        Uint32 Find(OffsetType Key) const
+        {
+            if (m_Slots.empty())
+                return InvalidIndex;
+
+            for (size_t i = GetHomeSlot(Key);; i = (i + 1) & (m_Slots.size() - 1))
+            {
+                const auto& Slot = m_Slots[i];
+                if (Slot.Key == Key)
+                    return Slot.Value;
+                if (Slot.Key == EmptyKey)
+                    return InvalidIndex;
+            }
+        }
+
+        void Insert(OffsetType Key, Uint32 Value)
+        {
+            VERIFY_EXPR(Key != EmptyKey);
+            if ((m_Count + 1) * 2 > m_Slots.size())
+                Rehash(std::max(m_Slots.size() * 2, size_t{16}));
+
+            auto i = GetHomeSlot(Key);
+            while (m_Slots[i].Key != EmptyKey)
+            {
+                VERIFY(m_Slots[i].Key != Key, "Key ", Key, " is already in the table");
+                i = (i + 1) & (m_Slots.size() - 1);
+            }
+            m_Slots[i] = {Key, Value};
+            ++m_Count;
+        }
+
+        void Erase(OffsetType Key)
+        {
+            VERIFY_EXPR(!m_Slots.empty());
+
+            const auto Mask = m_Slots.size() - 1;
+
+            auto i = GetHomeSlot(Key);
+            while (m_Slots[i].Key != Key)
+            {
+                VERIFY(m_Slots[i].Key != EmptyKey, "Key ", Key, " is not found in the table");
+                i = (i + 1) & Mask;
+            }
+
+            // Backward-shift deletion: move subsequent entries of the probe sequence into
+            // the hole so that lookups never need tombstones
+            for (auto j = (i + 1) & Mask; m_Slots[j].Key != EmptyKey; j = (j + 1) & Mask)
+            {
+                const auto Home = GetHomeSlot(m_Slots[j].Key);
+                // Move the entry unless its home slot lies cyclically in (i, j]
+                if (((j - Home) & Mask) >= ((j - i) & Mask))
+                {
+                    m_Slots[i] = m_Slots[j];
+                    i          = j;
+                }
+            }
+            m_Slots[i].Key = EmptyKey;
+            --m_Count;
+        }
+
+        size_t GetCount() const { return m_Count; }
+
+    private:
+        static constexpr OffsetType EmptyKey = ~OffsetType{0};
+
+        struct Slot
+        {
+            OffsetType Key;
+            Uint32     Value;
+        };
+
+        size_t GetHomeSlot(OffsetType Key) const
+        {
+            // Fibonacci hashing
+            return static_cast<size_t>((static_cast<Uint64>(Key) * Uint64{0x9E3779B97F4A7C15}) >> 32) & (m_Slots.size() - 1);
+        }
+
+        void Rehash(size_t NewSize)
+        {
+            VERIFY_EXPR(IsPowerOfTwo(NewSize));
+            std::vector<Slot, STDAllocatorRawMem<Slot>> OldSlots(NewSize, Slot{EmptyKey, InvalidIndex}, m_Slots.get_allocator());
+            OldSlots.swap(m_Slots);
+            m_Count = 0;
+            for (const auto& OldSlot : OldSlots)
+            {
+                if (OldSlot.Key != EmptyKey)
+                    Insert(OldSlot.Key, OldSlot.Value);
+            }
+        }
+
+        std::vector<Slot, STDAllocatorRawMem<Slot>> m_Slots;
+
+        size_t m_Count = 0;
+    };
+
+public:
+    explicit TLSFFreeBlocksPolicy(IMemoryAllocator& Allocator) :
+        // clang-format off
+        m_Blocks      (STD_ALLOCATOR_RAW_MEM(FreeBlock, Allocator, "Allocator for vector<TLSFFreeBlocksPolicy::FreeBlock>")),
+        m_BlocksByStart{Allocator},
+        m_BlocksByEnd  {Allocator}
+    // clang-format on
+    {
+        m_SLBitmaps.fill(0);
+        m_FreeListHeads.fill(Uint32{InvalidIndex});
+    }
+
+    // clang-format off
+    TLSFFreeBlocksPolicy(TLSFFreeBlocksPolicy&& rhs) noexcept :
+        m_Blocks           {std::move(rhs.m_Blocks)       },
+        m_FirstUnusedBlock {rhs.m_FirstUnusedBlock        },
+        m_NumFreeBlocks    {rhs.m_NumFreeBlocks           },
+        m_FLBitmap         {rhs.m_FLBitmap                },
+        m_SLBitmaps        (rhs.m_SLBitmaps               ),
+        m_FreeListHeads    (rhs.m_FreeListHeads           ),
+        m_BlocksByStart    {std::move(rhs.m_BlocksByStart)},
+        m_BlocksByEnd      {std::move(rhs.m_BlocksByEnd)  }
+    {
+        // clang-format on
+        rhs.Clear();
+    }
+
+    TLSFFreeBlocksPolicy& operator=(TLSFFreeBlocksPolicy&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            m_Blocks           = std::move(rhs.m_Blocks);
+            m_FirstUnusedBlock = rhs.m_FirstUnusedBlock;
+            m_NumFreeBlocks    = rhs.m_NumFreeBlocks;
+            m_FLBitmap         = rhs.m_FLBitmap;
+            m_SLBitmaps        = rhs.m_SLBitmaps;
+            m_FreeListHeads    = rhs.m_FreeListHeads;
+            m_BlocksByStart    = std::move(rhs.m_BlocksByStart);
+            m_BlocksByEnd      = std::move(rhs.m_BlocksByEnd);
+
+            rhs.Clear();
+        }
+        return *this;
+    }
+
+    // clang-format off
+    TLSFFreeBlocksPolicy             (const TLSFFreeBlocksPolicy&) = delete;
+    TLSFFreeBlocksPolicy& operator = (const TLSFFreeBlocksPolicy&) = delete;
+    // clang-format on
+
+    // Finds a free block that is at least Size bytes large
+    bool FindBlock(OffsetType Size, BlockId& Block) const
+    {
+        Block = FindFreeBlock(Size);
+        return Block != InvalidIndex;
+    }
+
+    OffsetType GetBlockOffset(BlockId Block) const
+    {
+        return m_Blocks[Block].Offset;
+    }
+
+    // Removes Size bytes from the beginning of the block
+    void TrimBlock(BlockId BlockIdx, OffsetType Size)
+    {
+        auto& Block = m_Blocks[BlockIdx];
+        VERIFY_EXPR(Size <= Block.Size);
+
+        //     Block.Offset
+        //        |                                  |
+        //        |<-----------Block.Size----------->|
+        //        |<------Size------>|<---NewSize--->|
+        //        |                  |
+        //      Offset              NewOffset
+        //
+        const auto Offset  = Block.Offset;
+        const auto NewSize = Block.Size - Size;
+
+        RemoveFromFreeList(BlockIdx);
+        m_BlocksByStart.Erase(Offset);
+        if (NewSize > 0)
+        {
+            // Reuse the block descriptor for the remaining part. The end offset does not change.
+            Block.Offset = Offset + Size;
+            Block.Size   = NewSize;
+            m_BlocksByStart.Insert(Block.Offset, BlockIdx);
+            InsertIntoFreeList(BlockIdx);
+        }
+        else
+        {
+            m_BlocksByEnd.Erase(Offset + Size);
+            ReleaseBlock(BlockIdx);
+        }
+    }
+
+    // Adds the range to the free blocks, merging it with the adjacent free blocks
+    void AddRange(OffsetType Offset, OffsetType Size)
+    {
+        VERIFY_EXPR(Size > 0);
+
+        const auto End     = Offset + Size;
+        const auto PrevIdx = m_BlocksByEnd.Find(Offset);
+        const auto NextIdx = m_BlocksByStart.Find(End);
+        // Block being deallocated must not overlap with the free blocks
+        VERIFY_EXPR(m_BlocksByStart.Find(Offset) == InvalidIndex && m_BlocksByEnd.Find(End) == InvalidIndex);
+
+        Uint32 BlockIdx = InvalidIndex;
+        if (PrevIdx != InvalidIndex)
+        {
+            //  PrevBlock.Offset             Offset
+            //       |                          |
+            //       |<-----PrevBlock.Size----->|<------Size-------->|
+            //
+            RemoveFromFreeList(PrevIdx);
+            m_BlocksByEnd.Erase(Offset);
+            BlockIdx = PrevIdx;
+            m_Blocks[BlockIdx].Size += Size;
+        }
+        else
+        {
+            BlockIdx = CreateBlock(Offset, Size);
+            m_BlocksByStart.Insert(Offset, BlockIdx);
+        }
+
+        if (NextIdx != InvalidIndex)
+        {
+            //   Offset            NextBlock.Offset
+            //     |                    |
+            //     |<------Size-------->|<-----NextBlock.Size----->|
+            //
+            RemoveFromFreeList(NextIdx);
+            m_BlocksByStart.Erase(End);
+            const auto NextBlockSize = m_Blocks[NextIdx].Size;
+            m_BlocksByEnd.Erase(End + NextBlockSize);
+            ReleaseBlock(NextIdx);
+            m_Blocks[BlockIdx].Size += NextBlockSize;
+        }
+
+        const auto& Block = m_Blocks[BlockIdx];
+        m_BlocksByEnd.Insert(Block.Offset + Block.Size, BlockIdx);
+        InsertIntoFreeList(BlockIdx);
+    }
+
+    size_t GetNumBlocks() const
+    {
+        return m_NumFreeBlocks;
+    }
+
+#ifdef DILIGENT_DEBUG
+    void DbgVerifyBlocks(OffsetType MaxSize, OffsetType CurrAlignment, OffsetType FreeSize) const
+    {
+        OffsetType TotalFreeSize = 0;
+        size_t     NumBlocks     = 0;
+        for (Uint32 FL = 0; FL < FLCount; ++FL)
+        {
+            VERIFY_EXPR(((m_FLBitmap >> FL) & 1) == (m_SLBitmaps[FL] != 0 ? 1 : 0));
+            for (Uint32 SL = 0; SL < SLCount; ++SL)
+            {
+                const auto Head = m_FreeListHeads[FL * SLCount + SL];
+                VERIFY_EXPR(((m_SLBitmaps[FL] >> SL) & 1) == (Head != InvalidIndex ? 1u : 0u));
+                for (auto BlockIdx = Head; BlockIdx != InvalidIndex; BlockIdx = m_Blocks[BlockIdx].NextFree)
+                {
+                    const auto& Block = m_Blocks[BlockIdx];
+                    Uint32      BlockFL = 0, BlockSL = 0;
+                    GetSizeClass(Block.Size, BlockFL, BlockSL);
+                    VERIFY(BlockFL == FL && BlockSL == SL, "Block is in the wrong size class");
+                    VERIFY_EXPR(Block.Offset + Block.Size <= MaxSize);
+                    VERIFY((Block.Offset & (CurrAlignment - 1)) == 0, "Block offset (", Block.Offset, ") is not ", CurrAlignment, "-aligned");
+                    if (Block.Offset + Block.Size < MaxSize)
+                        VERIFY((Block.Size & (CurrAlignment - 1)) == 0, "All block sizes except for the last one must be ", CurrAlignment, "-aligned");
+                    VERIFY_EXPR(m_BlocksByStart.Find(Block.Offset) == BlockIdx);
+                    VERIFY_EXPR(m_BlocksByEnd.Find(Block.Offset + Block.Size) == BlockIdx);
+                    VERIFY(m_BlocksByEnd.Find(Block.Offset) == InvalidIndex, "Unmerged adjacent blocks detected");
+                    TotalFreeSize += Block.Size;
+                    ++NumBlocks;
+                }
+            }
+        }
+        VERIFY_EXPR(NumBlocks == m_NumFreeBlocks);
+        VERIFY_EXPR(m_BlocksByStart.GetCount() == m_NumFreeBlocks && m_BlocksByEnd.GetCount() == m_NumFreeBlocks);
+        VERIFY_EXPR(TotalFreeSize == FreeSize);
+    }
+#endif
+
+private:
+    static void GetSizeClass(OffsetType Size, Uint32& FL, Uint32& SL)
+    {
+        if (Size < SLCount)
+        {
+            FL = 0;
+            SL = static_cast<Uint32>(Size);
+        }
+        else
+        {
+            const auto MSB = PlatformMisc::GetMSB(static_cast<Uint64>(Size));
+            SL             = static_cast<Uint32>(Size >> (MSB - SLIndexBits)) - SLCount;
+            FL             = MSB - SLIndexBits + 1;
+        }
+        VERIFY_EXPR(FL < FLCount && SL < SLCount);
+    }
+
+    Uint32 FindFreeBlock(OffsetType Size) const
+    {
+        Uint32 FL = 0, SL = 0;
+        {
+            // Round the size up to the next class boundary so that
+            // every block in the class is large enough
+            auto RoundedSize = Size;
+            if (Size >= SLCount)
+            {
+                const auto MSB = PlatformMisc::GetMSB(static_cast<Uint64>(Size));
+                RoundedSize += (OffsetType{1} << (MSB - SLIndexBits)) - 1;
+            }
+            if (RoundedSize >= Size)
+                GetSizeClass(RoundedSize, FL, SL);
+            else
+                FL = FLCount; // Overflow
+        }
+
+        if (FL < FLCount)
+        {
+            // Look for a non-empty class in the same first-level range
+            auto SLMap = m_SLBitmaps[FL] & (~Uint32{0} << SL);
+            if (SLMap == 0)
+            {
+                // Look for a non-empty first-level range
+                const auto FLMap = FL + 1 < FLCount ? m_FLBitmap & (~Uint64{0} << (FL + 1)) : 0;
+                if (FLMap != 0)
+                {
+                    FL    = PlatformMisc::GetLSB(FLMap);
+                    SLMap = m_SLBitmaps[FL];
+                    VERIFY_EXPR(SLMap != 0);
+                }
+            }
+
+            if (SLMap != 0)
+            {
+                SL = PlatformMisc::GetLSB(SLMap);
+
+                const auto BlockIdx = m_FreeListHeads[FL * SLCount + SL];
+                VERIFY_EXPR(BlockIdx != InvalidIndex && m_Blocks[BlockIdx].Size >= Size);
+                return BlockIdx;
+            }
+        }
+
+        // There is no block in larger classes, but the class of the
+        // requested size itself may contain a large enough block
+        GetSizeClass(Size, FL, SL);
+        for (auto BlockIdx = m_FreeListHeads[FL * SLCount + SL]; BlockIdx != InvalidIndex; BlockIdx = m_Blocks[BlockIdx].NextFree)
+        {
+            if (m_Blocks[BlockIdx].Size >= Size)
+                return BlockIdx;
+        }
+
+        return InvalidIndex;
+    }
+
+    void InsertIntoFreeList(Uint32 BlockIdx)
+    {
+        auto&  Block = m_Blocks[BlockIdx];
+        Uint32 FL = 0, SL = 0;
+        GetSizeClass(Block.Size, FL, SL);
+
+        auto& Head     = m_FreeListHeads[FL * SLCount + SL];
+        Block.PrevFree = InvalidIndex;
+        Block.NextFree = Head;
+        if (Head != InvalidIndex)
+            m_Blocks[Head].PrevFree = BlockIdx;
+        Head = BlockIdx;
+
+        m_FLBitmap |= Uint64{1} << FL;
+        m_SLBitmaps[FL] |= 1u << SL;
+    }
+
+    void RemoveFromFreeList(Uint32 BlockIdx)
+    {
+        const auto& Block = m_Blocks[BlockIdx];
+        Uint32      FL = 0, SL = 0;
+        GetSizeClass(Block.Size, FL, SL);
+
+        if (Block.PrevFree != InvalidIndex)
+            m_Blocks[Block.PrevFree].NextFree = Block.NextFree;
+        else
+        {
+            VERIFY_EXPR(m_FreeListHeads[FL * SLCount + SL] == BlockIdx);
+            m_FreeListHeads[FL * SLCount + SL] = Block.NextFree;
+            if (Block.NextFree == InvalidIndex)
+            {
+                // The class is now empty
+                m_SLBitmaps[FL] &= ~(1u << SL);
+                if (m_SLBitmaps[FL] == 0)
+                    m_FLBitmap &= ~(Uint64{1} << FL);
+            }
+        }
+
+        if (Block.NextFree != InvalidIndex)
+            m_Blocks[Block.NextFree].PrevFree = Block.PrevFree;
+    }
+
+    Uint32 CreateBlock(OffsetType Offset, OffsetType Size)
+    {
+        Uint32 BlockIdx = m_FirstUnusedBlock;
+        if (BlockIdx != InvalidIndex)
+        {
+            m_FirstUnusedBlock = m_Blocks[BlockIdx].NextFree;
+        }
+        else
+        {
+            BlockIdx = static_cast<Uint32>(m_Blocks.size());
+            m_Blocks.emplace_back();
+        }
+
+        auto& Block  = m_Blocks[BlockIdx];
+        Block.Offset = Offset;
+        Block.Size   = Size;
+        ++m_NumFreeBlocks;
+        return BlockIdx;
+    }
+
+    void ReleaseBlock(Uint32 BlockIdx)
+    {
+        auto& Block        = m_Blocks[BlockIdx];
+        Block.Offset       = Allocation::InvalidOffset;
+        Block.Size         = 0;
+        Block.PrevFree     = InvalidIndex;
+        Block.NextFree     = m_FirstUnusedBlock;
+        m_FirstUnusedBlock = BlockIdx;
+        VERIFY_EXPR(m_NumFreeBlocks > 0);
+        --m_NumFreeBlocks;
+    }
+
+    // Leaves the policy in the same state as a newly created one
+    void Clear()
+    {
+        m_Blocks.clear();
+        m_FirstUnusedBlock = InvalidIndex;
+        m_NumFreeBlocks    = 0;
+        m_FLBitmap         = 0;
+        m_SLBitmaps.fill(0);
+        m_FreeListHeads.fill(Uint32{InvalidIndex});
+        m_BlocksByStart.Clear();
+        m_BlocksByEnd.Clear();
+    }
+
+    // Free block descriptors. Unused descriptors are linked into the pool starting at m_FirstUnusedBlock.
+    std::vector<FreeBlock, STDAllocatorRawMem<FreeBlock>> m_Blocks;
+
+    Uint32 m_FirstUnusedBlock = InvalidIndex;
+    size_t m_NumFreeBlocks    = 0;
+
+    // Bit FL is set if any class in the first-level range FL is not empty
+    Uint64 m_FLBitmap = 0;
+    // Bit SL of m_SLBitmaps[FL] is set if class (FL, SL) is not empty
+    std::array<Uint32, FLCount> m_SLBitmaps;
+    // Heads of the free lists for every class (FL, SL)
+    std::array<Uint32, FLCount * SLCount> m_FreeListHeads;
+
+    // Free blocks indexed by their start and end offsets
+    OffsetHashMap m_BlocksByStart;
+    OffsetHashMap m_BlocksByEnd;
+    // When adding new members, do not forget to update move ctor, move assignment and Clear()
+};
+
+// Variable-size allocations manager that keeps free blocks in the TLSF index
+using TLSFAllocationsManager = VariableSizeAllocationsManagerImpl<TLSFFreeBlocksPolicy>;
+
+} // namespace Diligent
@@ -40,11 +40,50 @@
 
 namespace Diligent
 {
-// The class handles free memory block management to accommodate variable-size allocation requests.
-// It keeps track of free blocks only and does not record allocation sizes. The class uses two ordered maps
-// to facilitate operations. The first map keeps blocks sorted by their offsets. The second multimap keeps blocks
-// sorted by their sizes. The elements of the two maps reference each other, which enables efficient block
-// insertion, removal and merging.
+
+// Types shared by all variable-size allocations managers and their free block policies
+struct VariableSizeAllocationsManagerTypes
+{
+    using OffsetType = size_t;
+
+    // Offset returned by Allocate() may not be aligned, but the size of the allocation
+    // is sufficient to properly align it
+    struct Allocation
+    {
+        // clang-format off
+        Allocation(OffsetType offset, OffsetType size) :
+            UnalignedOffset{offset},
+            Size           {size  }
+        {}
+        // clang-format on
+
+        Allocation() {}
+
+        static constexpr OffsetType InvalidOffset = ~OffsetType{0};
+        static Allocation           InvalidAllocation()
+        {
+            return Allocation{InvalidOffset, 0};
+        }
+
+        bool IsValid() const
+        {
+            return UnalignedOffset != InvalidAllocation().UnalignedOffset;
+        }
+
+        bool operator==(const Allocation& rhs) const
+        {
+            return UnalignedOffset == rhs.UnalignedOffset &&
+                Size == rhs.Size;
+        }
+
+        OffsetType UnalignedOffset = InvalidOffset;
+        OffsetType Size            = 0;
+    };
+};
+
+// Free block policy that keeps free blocks in two ordered maps. The first map keeps blocks sorted by their offsets.
+// The second multimap keeps blocks sorted by their sizes. The elements of the two maps reference each other, which
+// enables efficient block insertion, removal and merging.
 //
 //   8                 32                       64                           104
 //   |<---16--->|       |<-----24------>|        |<---16--->|                 |<-----32----->|
@@ -61,10 +100,10 @@ namespace Diligent
 //
 //                32 ------------------> 104 ---------->  {size = 32, &m_FreeBlocksBySize[3]}
 //
-class VariableSizeAllocationsManager
+class MapFreeBlocksPolicy
 {
 public:
-    using OffsetType = size_t;
+    using OffsetType = VariableSizeAllocationsManagerTypes::OffsetType;
 
 private:
     struct FreeBlockInfo;
@@ -98,167 +137,61 @@ private:
     };
 
 public:
-    VariableSizeAllocationsManager(OffsetType MaxSize, IMemoryAllocator& Allocator) :
+    using BlockId = TFreeBlocksBySizeMap::iterator;
+
+    explicit MapFreeBlocksPolicy(IMemoryAllocator& Allocator) :
         m_FreeBlocksByOffset(STD_ALLOCATOR_RAW_MEM(TFreeBlocksByOffsetMap::value_type, Allocator, "Allocator for map<OffsetType, FreeBlockInfo>")),
-        m_FreeBlocksBySize(STD_ALLOCATOR_RAW_MEM(TFreeBlocksBySizeMap::value_type, Allocator, "Allocator for multimap<OffsetType, TFreeBlocksByOffsetMap::iterator>")),
-        m_MaxSize(MaxSize),
-        m_FreeSize(MaxSize)
-    {
-        // Insert single maximum-size block
-        AddNewBlock(0, m_MaxSize);
-        ResetCurrAlignment();
+        m_FreeBlocksBySize(STD_ALLOCATOR_RAW_MEM(TFreeBlocksBySizeMap::value_type, Allocator, "Allocator for multimap<OffsetType, TFreeBlocksByOffsetMap::iterator>"))
+    {}
 
-#ifdef DILIGENT_DEBUG
-        DbgVerifyList();
-#endif
-    }
+    // clang-format off
+    MapFreeBlocksPolicy             (MapFreeBlocksPolicy&&) = default;
+    MapFreeBlocksPolicy& operator = (MapFreeBlocksPolicy&&) = default;
+    MapFreeBlocksPolicy             (const MapFreeBlocksPolicy&) = delete;
+    MapFreeBlocksPolicy& operator = (const MapFreeBlocksPolicy&) = delete;
+    // clang-format on
 
-    ~VariableSizeAllocationsManager()
+    // Finds the smallest free block that is at least Size bytes large
+    bool FindBlock(OffsetType Size, BlockId& Block)
     {
-#ifdef DILIGENT_DEBUG
-        if (!m_FreeBlocksByOffset.empty() || !m_FreeBlocksBySize.empty())
-        {
-            VERIFY(m_FreeBlocksByOffset.size() == 1, "Single free block is expected");
-            VERIFY(m_FreeBlocksByOffset.begin()->first == 0, "Head chunk offset is expected to be 0");
-            VERIFY(m_FreeBlocksByOffset.begin()->second.Size == m_MaxSize, "Head chunk size is expected to be ", m_MaxSize);
-            VERIFY_EXPR(m_FreeBlocksByOffset.begin()->second.OrderBySizeIt == m_FreeBlocksBySize.begin());
-            VERIFY(m_FreeBlocksBySize.size() == m_FreeBlocksByOffset.size(), "Sizes of the two maps must be equal");
-
-            VERIFY(m_FreeBlocksBySize.size() == 1, "Single free block is expected");
-            VERIFY(m_FreeBlocksBySize.begin()->first == m_MaxSize, "Head chunk size is expected to be ", m_MaxSize);
-            VERIFY(m_FreeBlocksBySize.begin()->second == m_FreeBlocksByOffset.begin(), "Incorrect first block");
-        }
-#endif
+        // lower_bound() returns an iterator pointing to the first element that
+        // is not less (i.e. >= ) than key
+        Block = m_FreeBlocksBySize.lower_bound(Size);
+        return Block != m_FreeBlocksBySize.end();
     }
 
-    // clang-format off
-    VariableSizeAllocationsManager(VariableSizeAllocationsManager&& rhs) noexcept :
-        m_FreeBlocksByOffset {std::move(rhs.m_FreeBlocksByOffset)},
-        m_FreeBlocksBySize   {std::move(rhs.m_FreeBlocksBySize)  },
-        m_MaxSize            {rhs.m_MaxSize      },
-        m_FreeSize           {rhs.m_FreeSize     },
-        m_CurrAlignment      {rhs.m_CurrAlignment}
+    OffsetType GetBlockOffset(BlockId Block) const
     {
-        // clang-format on
-        rhs.m_MaxSize       = 0;
-        rhs.m_FreeSize      = 0;
-        rhs.m_CurrAlignment = 0;
+        return Block->second->first;
     }
 
-    // clang-format off
-    VariableSizeAllocationsManager& operator = (VariableSizeAllocationsManager&& rhs) = default;
-    VariableSizeAllocationsManager             (const VariableSizeAllocationsManager&) = delete;
-    VariableSizeAllocationsManager& operator = (const VariableSizeAllocationsManager&) = delete;
-    // clang-format on
-
-    // Offset returned by Allocate() may not be aligned, but the size of the allocation
-    // is sufficient to properly align it
-    struct Allocation
-    {
-        // clang-format off
-        Allocation(OffsetType offset, OffsetType size) :
-            UnalignedOffset{offset},
-            Size           {size  }
-        {}
-        // clang-format on
-
-        Allocation() {}
-
-        static constexpr OffsetType InvalidOffset = ~OffsetType{0};
-        static Allocation           InvalidAllocation()
-        {
-            return Allocation{InvalidOffset, 0};
-        }
-
-        bool IsValid() const
-        {
-            return UnalignedOffset != InvalidAllocation().UnalignedOffset;
-        }
-
-        bool operator==(const Allocation& rhs) const
-        {
-            return UnalignedOffset == rhs.UnalignedOffset &&
-                Size == rhs.Size;
-        }
-
-        OffsetType UnalignedOffset = InvalidOffset;
-        OffsetType Size            = 0;
-    };
-
-    Allocation Allocate(OffsetType Size, OffsetType Alignment)
+    // Removes Size bytes from the beginning of the block
+    void TrimBlock(BlockId Block, OffsetType Size)
     {
-        VERIFY_EXPR(Size > 0);
-        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
-        Size = Align(Size, Alignment);
-        if (m_FreeSize < Size)
-            return Allocation::InvalidAllocation();
+        auto BlockIt = Block->second;
+        VERIFY_EXPR(Size <= BlockIt->second.Size);
+        VERIFY_EXPR(Block == BlockIt->second.OrderBySizeIt);
 
-        auto AlignmentReserve = (Alignment > m_CurrAlignment) ? Alignment - m_CurrAlignment : 0;
-        // Get the first block that is large enough to encompass Size + AlignmentReserve bytes
-        // lower_bound() returns an iterator pointing to the first element that
-        // is not less (i.e. >= ) than key
-        auto SmallestBlockItIt = m_FreeBlocksBySize.lower_bound(Size + AlignmentReserve);
-        if (SmallestBlockItIt == m_FreeBlocksBySize.end())
-            return Allocation::InvalidAllocation();
-
-        auto SmallestBlockIt = SmallestBlockItIt->second;
-        VERIFY_EXPR(Size + AlignmentReserve <= SmallestBlockIt->second.Size);
-        VERIFY_EXPR(SmallestBlockIt->second.Size == SmallestBlockItIt->first);
-
-        //     SmallestBlockIt.Offset
+        //     BlockIt.Offset
         //        |                                  |
-        //        |<------SmallestBlockIt.Size------>|
+        //        |<-----------BlockIt.Size--------->|
         //        |<------Size------>|<---NewSize--->|
         //        |                  |
         //      Offset              NewOffset
         //
-        auto Offset = SmallestBlockIt->first;
-        VERIFY_EXPR(Offset % m_CurrAlignment == 0);
-        auto AlignedOffset = Align(Offset, Alignment);
-        auto AdjustedSize  = Size + (AlignedOffset - Offset);
-        VERIFY_EXPR(AdjustedSize <= Size + AlignmentReserve);
-        auto NewOffset = Offset + AdjustedSize;
-        auto NewSize   = SmallestBlockIt->second.Size - AdjustedSize;
-        VERIFY_EXPR(SmallestBlockItIt == SmallestBlockIt->second.OrderBySizeIt);
-        m_FreeBlocksBySize.erase(SmallestBlockItIt);
-        m_FreeBlocksByOffset.erase(SmallestBlockIt);
+        const auto NewOffset = BlockIt->first + Size;
+        const auto NewSize   = BlockIt->second.Size - Size;
+        m_FreeBlocksBySize.erase(Block);
+        m_FreeBlocksByOffset.erase(BlockIt);
         if (NewSize > 0)
         {
             AddNewBlock(NewOffset, NewSize);
         }
-
-        m_FreeSize -= AdjustedSize;
-
-        if ((Size & (m_CurrAlignment - 1)) != 0)
-        {
-            if (IsPowerOfTwo(Size))
-            {
-                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
-                m_CurrAlignment = Size;
-            }
-            else
-            {
-                m_CurrAlignment = std::min(m_CurrAlignment, Alignment);
-            }
-        }
-
-#ifdef DILIGENT_DEBUG
-        DbgVerifyList();
-#endif
-        return Allocation{Offset, AdjustedSize};
-    }
-
-    void Free(Allocation&& allocation)
-    {
-        VERIFY_EXPR(allocation.IsValid());
-        Free(allocation.UnalignedOffset, allocation.Size);
-        allocation = Allocation{};
     }
 
-    void Free(OffsetType Offset, OffsetType Size)
+    // Adds the range to the free blocks, merging it with the adjacent free blocks
+    void AddRange(OffsetType Offset, OffsetType Size)
     {
-        VERIFY_EXPR(Offset != Allocation::InvalidOffset && Offset + Size <= m_MaxSize);
-
         // Find the first element whose offset is greater than the specified offset.
         // upper_bound() returns an iterator pointing to the first element in the
         // container whose key is considered to go after k.
@@ -337,6 +270,198 @@ public:
         }
 
         AddNewBlock(NewOffset, NewSize);
+    }
+
+    size_t GetNumBlocks() const
+    {
+        return m_FreeBlocksByOffset.size();
+    }
+
+#ifdef DILIGENT_DEBUG
+    void DbgVerifyBlocks(OffsetType MaxSize, OffsetType CurrAlignment, OffsetType FreeSize) const
+    {
+        OffsetType TotalFreeSize = 0;
+
+        auto BlockIt     = m_FreeBlocksByOffset.begin();
+        auto PrevBlockIt = m_FreeBlocksByOffset.end();
+        VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
+        while (BlockIt != m_FreeBlocksByOffset.end())
+        {
+            VERIFY_EXPR(BlockIt->first >= 0 && BlockIt->first + BlockIt->second.Size <= MaxSize);
+            VERIFY((BlockIt->first & (CurrAlignment - 1)) == 0, "Block offset (", BlockIt->first, ") is not ", CurrAlignment, "-aligned");
+            if (BlockIt->first + BlockIt->second.Size < MaxSize)
+                VERIFY((BlockIt->second.Size & (CurrAlignment - 1)) == 0, "All block sizes except for the last one must be ", CurrAlignment, "-aligned");
+            VERIFY_EXPR(BlockIt == BlockIt->second.OrderBySizeIt->second);
+            VERIFY_EXPR(BlockIt->second.Size == BlockIt->second.OrderBySizeIt->first);
+            //   PrevBlock.Offset                   BlockIt.first
+            //     |                                  |
+            // ~ ~ |<-----PrevBlock.Size----->| ~ ~ ~ |<------Size-------->| ~ ~ ~
+            //
+            VERIFY(PrevBlockIt == m_FreeBlocksByOffset.end() || BlockIt->first > PrevBlockIt->first + PrevBlockIt->second.Size, "Unmerged adjacent or overlapping blocks detected");
+            TotalFreeSize += BlockIt->second.Size;
+
+            PrevBlockIt = BlockIt;
+            ++BlockIt;
+        }
+
+        auto OrderIt = m_FreeBlocksBySize.begin();
+        while (OrderIt != m_FreeBlocksBySize.end())
+        {
+            VERIFY_EXPR(OrderIt->first == OrderIt->second->second.Size);
+            ++OrderIt;
+        }
+
+        VERIFY_EXPR(TotalFreeSize == FreeSize);
+    }
+#endif
+
+private:
+    void AddNewBlock(OffsetType Offset, OffsetType Size)
+    {
+        auto NewBlockIt = m_FreeBlocksByOffset.emplace(Offset, Size);
+        VERIFY_EXPR(NewBlockIt.second);
+        auto OrderIt                           = m_FreeBlocksBySize.emplace(Size, NewBlockIt.first);
+        NewBlockIt.first->second.OrderBySizeIt = OrderIt;
+    }
+
+    TFreeBlocksByOffsetMap m_FreeBlocksByOffset;
+    TFreeBlocksBySizeMap   m_FreeBlocksBySize;
+};
+
+
+// The class handles free memory block management to accommodate variable-size allocation requests.
+// It keeps track of free blocks only and does not record allocation sizes. Free blocks are stored by
+// FreeBlocksPolicyType that must provide the following interface:
+//
+//   - BlockId type that identifies a free block
+//   - explicit constructor from IMemoryAllocator& and move constructor and assignment
+//   - bool FindBlock(OffsetType Size, BlockId& Block) - finds a free block of at least Size bytes
+//   - OffsetType GetBlockOffset(BlockId Block) const
+//   - void TrimBlock(BlockId Block, OffsetType Size) - removes Size bytes from the beginning of the block
+//   - void AddRange(OffsetType Offset, OffsetType Size) - adds the free range and merges it with its neighbors
+//   - size_t GetNumBlocks() const
+//   - void DbgVerifyBlocks(OffsetType MaxSize, OffsetType CurrAlignment, OffsetType FreeSize) const (debug only)
+//
+// See MapFreeBlocksPolicy (the default, see VariableSizeAllocationsManager) and TLSFFreeBlocksPolicy.
+template <typename FreeBlocksPolicyType>
+class VariableSizeAllocationsManagerImpl : public VariableSizeAllocationsManagerTypes
+{
+public:
+    VariableSizeAllocationsManagerImpl(OffsetType MaxSize, IMemoryAllocator& Allocator) :
+        m_FreeBlocks{Allocator},
+        m_MaxSize(MaxSize),
+        m_FreeSize(MaxSize)
+    {
+        // Insert single maximum-size block
+        if (m_MaxSize > 0)
+            m_FreeBlocks.AddRange(0, m_MaxSize);
+        ResetCurrAlignment();
+
+#ifdef DILIGENT_DEBUG
+        DbgVerifyList();
+#endif
+    }
+
+    ~VariableSizeAllocationsManagerImpl()
+    {
+#ifdef DILIGENT_DEBUG
+        if (GetNumFreeBlocks() != 0)
+        {
+            VERIFY(GetNumFreeBlocks() == 1, "Single free block is expected");
+            VERIFY(IsEmpty(), "Head chunk size is expected to be ", m_MaxSize);
+            DbgVerifyList();
+        }
+#endif
+    }
+
+    // clang-format off
+    VariableSizeAllocationsManagerImpl(VariableSizeAllocationsManagerImpl&& rhs) noexcept :
+        m_FreeBlocks    {std::move(rhs.m_FreeBlocks)},
+        m_MaxSize       {rhs.m_MaxSize      },
+        m_FreeSize      {rhs.m_FreeSize     },
+        m_CurrAlignment {rhs.m_CurrAlignment}
+    {
+        // clang-format on
+        rhs.m_MaxSize       = 0;
+        rhs.m_FreeSize      = 0;
+        rhs.m_CurrAlignment = 0;
+    }
+
+    VariableSizeAllocationsManagerImpl& operator=(VariableSizeAllocationsManagerImpl&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            m_FreeBlocks    = std::move(rhs.m_FreeBlocks);
+            m_MaxSize       = rhs.m_MaxSize;
+            m_FreeSize      = rhs.m_FreeSize;
+            m_CurrAlignment = rhs.m_CurrAlignment;
+
+            rhs.m_MaxSize       = 0;
+            rhs.m_FreeSize      = 0;
+            rhs.m_CurrAlignment = 0;
+        }
+        return *this;
+    }
+
+    // clang-format off
+    VariableSizeAllocationsManagerImpl             (const VariableSizeAllocationsManagerImpl&) = delete;
+    VariableSizeAllocationsManagerImpl& operator = (const VariableSizeAllocationsManagerImpl&) = delete;
+    // clang-format on
+
+    Allocation Allocate(OffsetType Size, OffsetType Alignment)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
+        Size = Align(Size, Alignment);
+        if (m_FreeSize < Size)
+            return Allocation::InvalidAllocation();
+
+        auto AlignmentReserve = (Alignment > m_CurrAlignment) ? Alignment - m_CurrAlignment : 0;
+        // Get the block that is large enough to encompass Size + AlignmentReserve bytes
+        typename FreeBlocksPolicyType::BlockId Block;
+        if (!m_FreeBlocks.FindBlock(Size + AlignmentReserve, Block))
+            return Allocation::InvalidAllocation();
+
+        auto Offset = m_FreeBlocks.GetBlockOffset(Block);
+        VERIFY_EXPR(Offset % m_CurrAlignment == 0);
+        auto AlignedOffset = Align(Offset, Alignment);
+        auto AdjustedSize  = Size + (AlignedOffset - Offset);
+        VERIFY_EXPR(AdjustedSize <= Size + AlignmentReserve);
+        m_FreeBlocks.TrimBlock(Block, AdjustedSize);
+
+        m_FreeSize -= AdjustedSize;
+
+        if ((Size & (m_CurrAlignment - 1)) != 0)
+        {
+            if (IsPowerOfTwo(Size))
+            {
+                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
+                m_CurrAlignment = Size;
+            }
+            else
+            {
+                m_CurrAlignment = std::min(m_CurrAlignment, Alignment);
+            }
+        }
+
+#ifdef DILIGENT_DEBUG
+        DbgVerifyList();
+#endif
+        return Allocation{Offset, AdjustedSize};
+    }
+
+    void Free(Allocation&& allocation)
+    {
+        VERIFY_EXPR(allocation.IsValid());
+        Free(allocation.UnalignedOffset, allocation.Size);
+        allocation = Allocation{};
+    }
+
+    void Free(OffsetType Offset, OffsetType Size)
+    {
+        VERIFY_EXPR(Offset != Allocation::InvalidOffset && Offset + Size <= m_MaxSize);
+
+        m_FreeBlocks.AddRange(Offset, Size);
 
         m_FreeSize += Size;
         if (IsEmpty())
@@ -361,35 +486,16 @@ public:
 
     size_t GetNumFreeBlocks() const
     {
-        return m_FreeBlocksByOffset.size();
+        return m_FreeBlocks.GetNumBlocks();
     }
 
     void Extend(size_t ExtraSize)
     {
-        size_t NewBlockOffset = m_MaxSize;
-        size_t NewBlockSize   = ExtraSize;
+        if (ExtraSize == 0)
+            return;
 
-        if (!m_FreeBlocksByOffset.empty())
-        {
-            auto LastBlockIt = m_FreeBlocksByOffset.end();
-            --LastBlockIt;
-
-            const auto LastBlockOffset = LastBlockIt->first;
-            const auto LastBlockSize   = LastBlockIt->second.Size;
-            if (LastBlockOffset + LastBlockSize == m_MaxSize)
-            {
-                // Extend the last block
-                NewBlockOffset = LastBlockOffset;
-                NewBlockSize += LastBlockSize;
-
-                VERIFY_EXPR(LastBlockIt->second.OrderBySizeIt->first == LastBlockSize &&
-                            LastBlockIt->second.OrderBySizeIt->second == LastBlockIt);
-                m_FreeBlocksBySize.erase(LastBlockIt->second.OrderBySizeIt);
-                m_FreeBlocksByOffset.erase(LastBlockIt);
-            }
-        }
-
-        AddNewBlock(NewBlockOffset, NewBlockSize);
+        // The new range is merged with the last free block, if there is one
+        m_FreeBlocks.AddRange(m_MaxSize, ExtraSize);
 
         m_MaxSize += ExtraSize;
         m_FreeSize += ExtraSize;
@@ -400,14 +506,6 @@ public:
     }
 
 private:
-    void AddNewBlock(OffsetType Offset, OffsetType Size)
-    {
-        auto NewBlockIt = m_FreeBlocksByOffset.emplace(Offset, Size);
-        VERIFY_EXPR(NewBlockIt.second);
-        auto OrderIt                           = m_FreeBlocksBySize.emplace(Size, NewBlockIt.first);
-        NewBlockIt.first->second.OrderBySizeIt = OrderIt;
-    }
-
     void ResetCurrAlignment()
     {
         for (m_CurrAlignment = 1; m_CurrAlignment * 2 <= m_MaxSize; m_CurrAlignment *= 2)
@@ -415,50 +513,22 @@ private:
     }
 
 #ifdef DILIGENT_DEBUG
-    void DbgVerifyList()
+    void DbgVerifyList() const
     {
-        OffsetType TotalFreeSize = 0;
-
         VERIFY_EXPR(IsPowerOfTwo(m_CurrAlignment));
-        auto BlockIt     = m_FreeBlocksByOffset.begin();
-        auto PrevBlockIt = m_FreeBlocksByOffset.end();
-        VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
-        while (BlockIt != m_FreeBlocksByOffset.end())
-        {
-            VERIFY_EXPR(BlockIt->first >= 0 && BlockIt->first + BlockIt->second.Size <= m_MaxSize);
-            VERIFY((BlockIt->first & (m_CurrAlignment - 1)) == 0, "Block offset (", BlockIt->first, ") is not ", m_CurrAlignment, "-aligned");
-            if (BlockIt->first + BlockIt->second.Size < m_MaxSize)
-                VERIFY((BlockIt->second.Size & (m_CurrAlignment - 1)) == 0, "All block sizes except for the last one must be ", m_CurrAlignment, "-aligned");
-            VERIFY_EXPR(BlockIt == BlockIt->second.OrderBySizeIt->second);
-            VERIFY_EXPR(BlockIt->second.Size == BlockIt->second.OrderBySizeIt->first);
-            //   PrevBlock.Offset                   BlockIt.first
-            //     |                                  |
-            // ~ ~ |<-----PrevBlock.Size----->| ~ ~ ~ |<------Size-------->| ~ ~ ~
-            //
-            VERIFY(PrevBlockIt == m_FreeBlocksByOffset.end() || BlockIt->first > PrevBlockIt->first + PrevBlockIt->second.Size, "Unmerged adjacent or overlapping blocks detected");
-            TotalFreeSize += BlockIt->second.Size;
-
-            PrevBlockIt = BlockIt;
-            ++BlockIt;
-        }
-
-        auto OrderIt = m_FreeBlocksBySize.begin();
-        while (OrderIt != m_FreeBlocksBySize.end())
-        {
-            VERIFY_EXPR(OrderIt->first == OrderIt->second->second.Size);
-            ++OrderIt;
-        }
-
-        VERIFY_EXPR(TotalFreeSize == m_FreeSize);
+        m_FreeBlocks.DbgVerifyBlocks(m_MaxSize, m_CurrAlignment, m_FreeSize);
     }
 #endif
 
-    TFreeBlocksByOffsetMap m_FreeBlocksByOffset;
-    TFreeBlocksBySizeMap   m_FreeBlocksBySize;
+    FreeBlocksPolicyType m_FreeBlocks;
 
     OffsetType m_MaxSize       = 0;
     OffsetType m_FreeSize      = 0;
     OffsetType m_CurrAlignment = 0;
-    // When adding new members, do not forget to update move ctor
+    // When adding new members, do not forget to update move ctor and move assignment
 };
+
+// The default variable-size allocations manager that keeps free blocks in ordered maps
+using VariableSizeAllocationsManager = VariableSizeAllocationsManagerImpl<MapFreeBlocksPolicy>;
+
 } // namespace Diligent
@@ -26,10 +26,15 @@
  */
 
 #include <algorithm>
+#include <cstring>
+#include <future>
+#include <vector>
 
 #include "GraphicsAccessories.hpp"
 #include "DebugUtilities.hpp"
 #include "Align.hpp"
+#include "ThreadPool.hpp"
+#include "BasicMathSIMD.hpp"
 
 namespace Diligent
 {
@@ -1554,30 +1559,173 @@ BufferToTextureCopyInfo GetBufferToTextureCopyInfo(const TextureDesc& TexDesc,
 }
 
 
-void CopyTextureSubresource(const TextureSubResData& SrcSubres,
-                            Uint32                   NumRows,
-                            Uint32                   NumDepthSlices,
-                            Uint32                   RowSize,
-                            void*                    pDstData,
-                            Uint32                   DstRowStride,
-                            Uint32                   DstDepthStride)
+namespace
+{
+
+// Copies the data to write-combined memory. Non-temporal stores bypass the cache, so the copy
+// does not evict useful data, and fill whole write-combining buffers that are flushed at once.
+void CopyToWriteCombinedMemory(Uint8* pDst, const Uint8* pSrc, size_t Size)
+{
+#if DILIGENT_SIMD_MATH_SSE
+    static constexpr size_t MinStreamingCopySize = 256;
+    if (Size >= MinStreamingCopySize)
+    {
+        // Streaming stores require 16-byte aligned destination
+        const size_t HeadSize = (16 - (reinterpret_cast<size_t>(pDst) & 15)) & 15;
+        memcpy(pDst, pSrc, HeadSize);
+        pDst += HeadSize;
+        pSrc += HeadSize;
+        Size -= HeadSize;
+
+        for (; Size >= 64; Size -= 64, pDst += 64, pSrc += 64)
+        {
+            const auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc));
+            const auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + 16));
+            const auto v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + 32));
+            const auto v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + 48));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(pDst), v0);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(pDst + 16), v1);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(pDst + 32), v2);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(pDst + 48), v3);
+        }
+        for (; Size >= 16; Size -= 16, pDst += 16, pSrc += 16)
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(pDst), _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc)));
+        }
+    }
+#endif
+    memcpy(pDst, pSrc, Size);
+}
+
+// Describes the copy as NumSlices x NumBlocks blocks of BlockSize bytes.
+// The data is addressed by the offset in the packed (source-order) sequence of blocks.
+struct TextureCopyLayout
+{
+    const Uint8* pSrc;
+    Uint8*       pDst;
+
+    size_t BlockSize;
+    size_t NumBlocks;
+    size_t SrcBlockStride;
+    size_t DstBlockStride;
+
+    size_t NumSlices;
+    size_t SrcSliceStride;
+    size_t DstSliceStride;
+
+    size_t GetSize() const
+    {
+        return BlockSize * NumBlocks * NumSlices;
+    }
+
+    void CopyRange(size_t StartOffset, size_t EndOffset, bool WriteCombined) const
+    {
+        const size_t SliceSize = BlockSize * NumBlocks;
+        while (StartOffset < EndOffset)
+        {
+            const size_t Slice         = StartOffset / SliceSize;
+            const size_t Block         = (StartOffset % SliceSize) / BlockSize;
+            const size_t OffsetInBlock = StartOffset % BlockSize;
+            const size_t CopySize      = std::min(BlockSize - OffsetInBlock, EndOffset - StartOffset);
+
+            const auto* pSrcData = pSrc + Slice * SrcSliceStride + Block * SrcBlockStride + OffsetInBlock;
+            auto*       pDstData = pDst + Slice * DstSliceStride + Block * DstBlockStride + OffsetInBlock;
+            if (WriteCombined)
+                CopyToWriteCombinedMemory(pDstData, pSrcData, CopySize);
+            else
+                memcpy(pDstData, pSrcData, CopySize);
+
+            StartOffset += CopySize;
+        }
+#if DILIGENT_SIMD_MATH_SSE
+        // Make non-temporal stores globally visible before the copy is reported complete
+        if (WriteCombined)
+            _mm_sfence();
+#endif
+    }
+};
+
+} // namespace
+
+void CopyTextureSubresource(const TextureSubResData&       SrcSubres,
+                            Uint32                         NumRows,
+                            Uint32                         NumDepthSlices,
+                            Uint32                         RowSize,
+                            void*                          pDstData,
+                            Uint32                         DstRowStride,
+                            Uint32                         DstDepthStride,
+                            COPY_TEXTURE_SUBRESOURCE_FLAGS Flags,
+                            ThreadingTools::ThreadPool*    pThreadPool)
 {
     VERIFY_EXPR(SrcSubres.pSrcBuffer == nullptr && SrcSubres.pData != nullptr);
     VERIFY_EXPR(pDstData != nullptr);
-    VERIFY(SrcSubres.Stride >= RowSize, "Source data row stride (", SrcSubres.Stride, ") is smaller than the row size (", RowSize, ")");
+    VERIFY(NumRows <= 1 || SrcSubres.Stride >= RowSize, "Source data row stride (", SrcSubres.Stride, ") is smaller than the row size (", RowSize, ")");
     VERIFY(DstRowStride >= RowSize, "Dst data row stride (", DstRowStride, ") is smaller than the row size (", RowSize, ")");
-    for (Uint32 z = 0; z < NumDepthSlices; ++z)
+
+    TextureCopyLayout Layout{};
+    Layout.pSrc           = static_cast<const Uint8*>(SrcSubres.pData);
+    Layout.pDst           = static_cast<Uint8*>(pDstData);
+    Layout.BlockSize      = RowSize;
+    Layout.NumBlocks      = NumRows;
+    Layout.SrcBlockStride = SrcSubres.Stride;
+    Layout.DstBlockStride = DstRowStride;
+    Layout.NumSlices      = NumDepthSlices;
+    Layout.SrcSliceStride = SrcSubres.DepthStride;
+    Layout.DstSliceStride = DstDepthStride;
+
+    // Collapse rows and then slices that are contiguous in both source and destination
+    if (Layout.SrcBlockStride == Layout.BlockSize && Layout.DstBlockStride == Layout.BlockSize)
     {
-        const auto* pSrcSlice = reinterpret_cast<const Uint8*>(SrcSubres.pData) + SrcSubres.DepthStride * z;
-        auto*       pDstSlice = reinterpret_cast<Uint8*>(pDstData) + DstDepthStride * z;
+        Layout.BlockSize *= Layout.NumBlocks;
+        Layout.NumBlocks = 1;
+    }
+    if (Layout.NumBlocks == 1 && (Layout.NumSlices == 1 || (Layout.SrcSliceStride == Layout.BlockSize && Layout.DstSliceStride == Layout.BlockSize)))
+    {
+        Layout.BlockSize *= Layout.NumSlices;
+        Layout.NumSlices      = 1;
+        Layout.SrcBlockStride = Layout.BlockSize;
+        Layout.DstBlockStride = Layout.BlockSize;
+    }
 
-        for (Uint32 y = 0; y < NumRows; ++y)
-        {
-            memcpy(pDstSlice + DstRowStride * y,
-                   pSrcSlice + SrcSubres.Stride * y,
-                   RowSize);
-        }
+    const auto TotalSize = Layout.GetSize();
+    if (TotalSize == 0)
+        return;
+
+    const bool WriteCombined = (Flags & COPY_TEXTURE_SUBRESOURCE_FLAG_WRITE_COMBINED) != 0;
+
+    // Every thread copies at least this many bytes
+    static constexpr size_t MinPartSize = MinParallelTextureCopySize / 4;
+
+    size_t NumParts = 1;
+    if (pThreadPool != nullptr && TotalSize >= MinParallelTextureCopySize)
+        NumParts = std::min(pThreadPool->GetNumThreads() + 1, TotalSize / MinPartSize);
+
+    if (NumParts <= 1)
+    {
+        Layout.CopyRange(0, TotalSize, WriteCombined);
+        return;
+    }
+
+    // Keep part boundaries page-aligned in the packed data
+    static constexpr size_t PartAlignment = 4096;
+
+    const auto PartSize = Align((TotalSize + NumParts - 1) / NumParts, PartAlignment);
+
+    std::vector<std::future<void>> Parts;
+    Parts.reserve(NumParts - 1);
+    // The calling thread copies the first part
+    for (size_t Start = PartSize; Start < TotalSize; Start += PartSize)
+    {
+        const auto End = std::min(Start + PartSize, TotalSize);
+        Parts.emplace_back(pThreadPool->Enqueue(
+            [&Layout, Start, End, WriteCombined]() {
+                Layout.CopyRange(Start, End, WriteCombined);
+            }));
     }
+    Layout.CopyRange(0, std::min(PartSize, TotalSize), WriteCombined);
+
+    for (auto& Part : Parts)
+        Part.get();
 }
 
 } // namespace Diligent
@@ -41,6 +41,8 @@
 #include "ValidatedCast.hpp"
 #include "GraphicsAccessories.hpp"
 #include "TextureBase.hpp"
+#include "EngineMemory.h"
+#include "DynamicLinearAllocator.hpp"
 
 namespace Diligent
 {
@@ -48,6 +50,8 @@ namespace Diligent
 // clang-format off
 bool VerifyDrawAttribs               (const DrawAttribs&                Attribs);
 bool VerifyDrawIndexedAttribs        (const DrawIndexedAttribs&         Attribs);
+bool VerifyMultiDrawAttribs          (const MultiDrawAttribs&           Attribs);
+bool VerifyMultiDrawIndexedAttribs   (const MultiDrawIndexedAttribs&    Attribs);
 bool VerifyDrawIndirectAttribs       (const DrawIndirectAttribs&        Attribs, const IBuffer* pAttribsBuffer);
 bool VerifyDrawIndexedIndirectAttribs(const DrawIndexedIndirectAttribs& Attribs, const IBuffer* pAttribsBuffer);
 
@@ -282,6 +286,7 @@ protected:
 
     void EndFrame()
     {
+        m_FrameAllocator.Discard();
         ++m_FrameNumber;
     }
 
@@ -289,6 +294,8 @@ protected:
     // clang-format off
     bool DvpVerifyDrawArguments               (const DrawAttribs&                Attribs) const;
     bool DvpVerifyDrawIndexedArguments        (const DrawIndexedAttribs&         Attribs) const;
+    bool DvpVerifyMultiDrawArguments          (const MultiDrawAttribs&           Attribs) const;
+    bool DvpVerifyMultiDrawIndexedArguments   (const MultiDrawIndexedAttribs&    Attribs) const;
     bool DvpVerifyDrawMeshArguments           (const DrawMeshAttribs&            Attribs) const;
     bool DvpVerifyDrawIndirectArguments       (const DrawIndirectAttribs&        Attribs, const IBuffer* pAttribsBuffer) const;
     bool DvpVerifyDrawIndexedIndirectArguments(const DrawIndexedIndirectAttribs& Attribs, const IBuffer* pAttribsBuffer) const;
@@ -306,6 +313,8 @@ protected:
 #else
     bool DvpVerifyDrawArguments               (const DrawAttribs&                Attribs)const {return true;}
     bool DvpVerifyDrawIndexedArguments        (const DrawIndexedAttribs&         Attribs)const {return true;}
+    bool DvpVerifyMultiDrawArguments          (const MultiDrawAttribs&           Attribs)const {return true;}
+    bool DvpVerifyMultiDrawIndexedArguments   (const MultiDrawIndexedAttribs&    Attribs)const {return true;}
     bool DvpVerifyDrawMeshArguments           (const DrawMeshAttribs&            Attribs)const {return true;}
     bool DvpVerifyDrawIndirectArguments       (const DrawIndirectAttribs&        Attribs, const IBuffer* pAttribsBuffer)const {return true;}
     bool DvpVerifyDrawIndexedIndirectArguments(const DrawIndexedIndirectAttribs& Attribs, const IBuffer* pAttribsBuffer)const {return true;}
@@ -403,6 +412,11 @@ protected:
 
     Uint64 m_FrameNumber = 0;
 
+    /// Linear allocator for transient CPU-side data that only lives until the end of the frame.
+    /// All allocations are discarded at once by EndFrame(), while the memory blocks are retained,
+    /// so that in steady state the allocator makes no heap allocations.
+    DynamicLinearAllocator m_FrameAllocator{GetRawAllocator(), 16 << 10};
+
 #ifdef DILIGENT_DEBUG
     // std::unordered_map is unbelievably slow. Keeping track of mapped buffers
     // in release builds is not feasible
@@ -1728,6 +1742,56 @@ inline bool DeviceContextBase<BaseInterface, ImplementationTraits>::DvpVerifyDra
     return VerifyDrawIndexedAttribs(Attribs);
 }
 
+template <typename BaseInterface, typename ImplementationTraits>
+inline bool DeviceContextBase<BaseInterface, ImplementationTraits>::DvpVerifyMultiDrawArguments(const MultiDrawAttribs& Attribs) const
+{
+    if ((Attribs.Flags & DRAW_FLAG_VERIFY_DRAW_ATTRIBS) == 0)
+        return true;
+
+    if (!m_pPipelineState)
+    {
+        LOG_ERROR_MESSAGE("MultiDraw command arguments are invalid: no pipeline state is bound.");
+        return false;
+    }
+
+    if (m_pPipelineState->GetDesc().PipelineType != PIPELINE_TYPE_GRAPHICS)
+    {
+        LOG_ERROR_MESSAGE("MultiDraw command arguments are invalid: pipeline state '",
+                          m_pPipelineState->GetDesc().Name, "' is not a graphics pipeline.");
+        return false;
+    }
+
+    return VerifyMultiDrawAttribs(Attribs);
+}
+
+template <typename BaseInterface, typename ImplementationTraits>
+inline bool DeviceContextBase<BaseInterface, ImplementationTraits>::DvpVerifyMultiDrawIndexedArguments(const MultiDrawIndexedAttribs& Attribs) const
+{
+    if ((Attribs.Flags & DRAW_FLAG_VERIFY_DRAW_ATTRIBS) == 0)
+        return true;
+
+    if (!m_pPipelineState)
+    {
+        LOG_ERROR_MESSAGE("MultiDrawIndexed command arguments are invalid: no pipeline state is bound.");
+        return false;
+    }
+
+    if (m_pPipelineState->GetDesc().PipelineType != PIPELINE_TYPE_GRAPHICS)
+    {
+        LOG_ERROR_MESSAGE("MultiDrawIndexed command arguments are invalid: pipeline state '",
+                          m_pPipelineState->GetDesc().Name, "' is not a graphics pipeline.");
+        return false;
+    }
+
+    if (!m_pIndexBuffer)
+    {
+        LOG_ERROR_MESSAGE("MultiDrawIndexed command arguments are invalid: no index buffer is bound.");
+        return false;
+    }
+
+    return VerifyMultiDrawIndexedAttribs(Attribs);
+}
+
 template <typename BaseInterface, typename ImplementationTraits>
 inline bool DeviceContextBase<BaseInterface, ImplementationTraits>::DvpVerifyDrawMeshArguments(const DrawMeshAttribs& Attribs) const
 {
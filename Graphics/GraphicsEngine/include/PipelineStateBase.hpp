@@ -165,23 +165,19 @@ public:
 
     ~PipelineStateBase()
     {
-        /*
-        /// \note Destructor cannot directly remove the object from the registry as this may cause a  
+        /// \note Destructor cannot directly remove the object from the registry as this may cause a
         ///       deadlock at the point where StateObjectsRegistry::Find() locks the weak pointer: if we
-        ///       are in dtor, the object is locked by Diligent::RefCountedObject::Release() and 
+        ///       are in dtor, the object is locked by Diligent::RefCountedObject::Release() and
         ///       StateObjectsRegistry::Find() will wait for that lock to be released.
         ///       A the same time this thread will be waiting for the other thread to unlock the registry.\n
         ///       Thus destructor only notifies the registry that there is a deleted object.
         ///       The reference to the object will be removed later.
-        auto &PipelineStateRegistry = static_cast<TRenderDeviceBase*>(this->GetDevice())->GetBSRegistry();
-        auto &RasterizerStateRegistry = static_cast<TRenderDeviceBase*>(this->GetDevice())->GetRSRegistry();
-        auto &DSSRegistry = static_cast<TRenderDeviceBase*>(this->GetDevice())->GetDSSRegistry();
-        // StateObjectsRegistry::ReportDeletedObject() does not lock the registry, but only 
-        // atomically increments the outstanding deleted objects counter.
-        PipelineStateRegistry.ReportDeletedObject();
-        RasterizerStateRegistry.ReportDeletedObject();
-        DSSRegistry.ReportDeletedObject();
-        */
+        if (auto* pPipelineStateRegistry = this->GetDevice()->GetPipelineStateRegistry())
+        {
+            // StateObjectsRegistry::ReportDeletedObject() does not lock the registry, but only
+            // atomically increments the outstanding deleted objects counter.
+            pPipelineStateRegistry->ReportDeletedObject();
+        }
         VERIFY(m_IsDestructed, "This object must be explicitly destructed with Destruct()");
     }
 
@@ -206,6 +202,12 @@ public:
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_PipelineState, TDeviceObjectBase)
 
+    /// Implementation of IPipelineState::GetStatus() for backends that always create pipeline states synchronously.
+    virtual PIPELINE_STATE_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) const override
+    {
+        return PIPELINE_STATE_STATUS_READY;
+    }
+
     Uint32 GetBufferStride(Uint32 BufferSlot) const
     {
         return BufferSlot < m_BufferSlotsUsed ? m_pStrides[BufferSlot] : 0;
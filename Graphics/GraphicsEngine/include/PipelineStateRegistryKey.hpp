@@ -0,0 +1,150 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::PipelineStateRegistryKey class
+
+#include <vector>
+
+#include "PipelineState.h"
+#include "Shader.h"
+#include "RenderPass.h"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Key of the pipeline state registry (see EngineCreateInfo::EnablePipelineStateRegistry).
+
+/// The key keeps a deep copy of graphics or compute pipeline state create info, including
+/// the pipeline name. Shaders are compared by their byte code or source (see ShaderBase::GetContentHash()
+/// and ShaderBase::IsContentEqual()), so that identical shaders created separately are treated as equal.
+/// The key keeps references to the shaders to compare their content when the hashes match.
+/// The render pass is identified by the object itself: the key keeps a weak reference to it,
+/// so that an object created at the address of a released object is never mistaken for it
+/// and the key does not extend the lifetime of the object.
+class PipelineStateRegistryKey
+{
+public:
+    /// Returns the content hash of the shader, see ShaderBase::GetContentHash().
+    using ShaderHashGetter = size_t (*)(IShader*);
+
+    /// Compares the content of two shaders, see ShaderBase::IsContentEqual().
+    using ShaderContentComparator = bool (*)(IShader*, IShader*);
+
+    PipelineStateRegistryKey(const GraphicsPipelineStateCreateInfo& CreateInfo, ShaderHashGetter GetShaderHash, ShaderContentComparator CompareShaders);
+    PipelineStateRegistryKey(const ComputePipelineStateCreateInfo& CreateInfo, ShaderHashGetter GetShaderHash, ShaderContentComparator CompareShaders);
+
+    PipelineStateRegistryKey(const PipelineStateRegistryKey& Key);
+    PipelineStateRegistryKey(PipelineStateRegistryKey&& Key);
+
+    // clang-format off
+    PipelineStateRegistryKey& operator = (const PipelineStateRegistryKey&) = delete;
+    PipelineStateRegistryKey& operator = (PipelineStateRegistryKey&&)      = delete;
+    // clang-format on
+
+    bool operator==(const PipelineStateRegistryKey& Key) const;
+
+    size_t GetHash() const { return m_Hash; }
+
+    /// Pipeline state name, used by StateObjectsRegistry for diagnostic messages.
+    const Char* Name = nullptr;
+
+private:
+    void InitCommon(const PipelineStateCreateInfo& CreateInfo);
+    void AddShader(IShader* pShader, ShaderHashGetter GetShaderHash);
+
+    struct VariableDesc
+    {
+        SHADER_TYPE                   ShaderStages;
+        String                        Name;
+        SHADER_RESOURCE_VARIABLE_TYPE Type;
+
+        bool operator==(const VariableDesc& rhs) const
+        {
+            return ShaderStages == rhs.ShaderStages && Type == rhs.Type && Name == rhs.Name;
+        }
+    };
+
+    struct ImtblSamplerDesc
+    {
+        SHADER_TYPE ShaderStages;
+        String      SamplerOrTextureName;
+        SamplerDesc Desc;
+
+        bool operator==(const ImtblSamplerDesc& rhs) const
+        {
+            return ShaderStages == rhs.ShaderStages && Desc == rhs.Desc && SamplerOrTextureName == rhs.SamplerOrTextureName;
+        }
+    };
+
+    String m_Name;
+
+    PIPELINE_TYPE                 m_PipelineType             = PIPELINE_TYPE_GRAPHICS;
+    PSO_CREATE_FLAGS              m_Flags                    = PSO_CREATE_FLAG_NONE;
+    Uint32                        m_SRBAllocationGranularity = 1;
+    Uint64                        m_CommandQueueMask         = 1;
+    SHADER_RESOURCE_VARIABLE_TYPE m_DefaultVariableType      = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+
+    std::vector<VariableDesc>     m_Variables;
+    std::vector<ImtblSamplerDesc> m_ImtblSamplers;
+
+    // Graphics pipeline description. Input layout elements are
+    // stored in m_LayoutElements and m_LayoutSemantics, the render pass is
+    // stored in m_wpRenderPass. The description is left default-initialized
+    // for compute pipelines.
+    GraphicsPipelineDesc       m_GraphicsPipeline;
+    std::vector<LayoutElement> m_LayoutElements;
+    std::vector<String>        m_LayoutSemantics;
+    RefCntWeakPtr<IRenderPass> m_wpRenderPass;
+
+    // Shaders and their content hashes in the fixed order (VS, PS, DS, HS, GS, AS, MS
+    // for graphics pipelines, CS for compute pipelines). Missing stages are null and 0.
+    std::vector<RefCntAutoPtr<IShader>> m_Shaders;
+    std::vector<size_t>                 m_ShaderHashes;
+    ShaderContentComparator             m_CompareShaders = nullptr;
+
+    size_t m_Hash = 0;
+};
+
+} // namespace Diligent
+
+namespace std
+{
+
+template <>
+struct hash<Diligent::PipelineStateRegistryKey>
+{
+    size_t operator()(const Diligent::PipelineStateRegistryKey& Key) const
+    {
+        return Key.GetHash();
+    }
+};
+
+} // namespace std
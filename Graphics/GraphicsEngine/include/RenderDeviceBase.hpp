@@ -35,6 +35,7 @@
 #include "Defines.h"
 #include "ResourceMappingImpl.hpp"
 #include "StateObjectsRegistry.hpp"
+#include "PipelineStateRegistryKey.hpp"
 #include "HashUtils.hpp"
 #include "ObjectBase.hpp"
 #include "DeviceContext.h"
@@ -43,6 +44,8 @@
 #include "FixedBlockMemoryAllocator.hpp"
 #include "EngineMemory.h"
 #include "STDAllocator.hpp"
+#include "ThreadPool.hpp"
+#include "ValidatedCast.hpp"
 
 namespace std
 {
@@ -240,14 +243,18 @@ public:
     /// \param pRefCounters        - Reference counters object that controls the lifetime of this render device
     /// \param RawMemAllocator     - Allocator that will be used to allocate memory for all device objects (including render device itself)
     /// \param pEngineFactory      - Engine factory that was used to create this device
+    /// \param EngineCI            - Engine create info
     /// \param NumDeferredContexts - The number of deferred device contexts
     /// \param ObjectSizes         - Device object sizes
     ///
     /// \remarks Render device uses fixed block allocators (see FixedBlockMemoryAllocator) to allocate memory for
     ///          device objects. The object sizes provided to constructor are used to initialize the allocators.
+    ///          Texture views, buffer views and shader resource bindings are often created by worker threads,
+    ///          so their allocators use the thread-caching mode.
     RenderDeviceBase(IReferenceCounters*      pRefCounters,
                      IMemoryAllocator&        RawMemAllocator,
                      IEngineFactory*          pEngineFactory,
+                     const EngineCreateInfo&  EngineCI,
                      Uint32                   NumDeferredContexts,
                      const DeviceObjectSizes& ObjectSizes) :
         // clang-format off
@@ -259,13 +266,13 @@ public:
         m_wpDeferredContexts    (NumDeferredContexts, RefCntWeakPtr<IDeviceContext>(), STD_ALLOCATOR_RAW_MEM(RefCntWeakPtr<IDeviceContext>, RawMemAllocator, "Allocator for vector< RefCntWeakPtr<IDeviceContext> >")),
         m_RawMemAllocator       {RawMemAllocator},
         m_TexObjAllocator       {RawMemAllocator, ObjectSizes.TextureObjSize,     64  },
-        m_TexViewObjAllocator   {RawMemAllocator, ObjectSizes.TexViewObjSize,     64  },
+        m_TexViewObjAllocator   {RawMemAllocator, ObjectSizes.TexViewObjSize,     64,   true},
         m_BufObjAllocator       {RawMemAllocator, ObjectSizes.BufferObjSize,      128 },
-        m_BuffViewObjAllocator  {RawMemAllocator, ObjectSizes.BuffViewObjSize,    128 },
+        m_BuffViewObjAllocator  {RawMemAllocator, ObjectSizes.BuffViewObjSize,    128,  true},
         m_ShaderObjAllocator    {RawMemAllocator, ObjectSizes.ShaderObjSize,      32  },
         m_SamplerObjAllocator   {RawMemAllocator, ObjectSizes.SamplerObjSize,     32  },
         m_PSOAllocator          {RawMemAllocator, ObjectSizes.PSOSize,            128 },
-        m_SRBAllocator          {RawMemAllocator, ObjectSizes.SRBSize,            1024},
+        m_SRBAllocator          {RawMemAllocator, ObjectSizes.SRBSize,            1024, true},
         m_ResMappingAllocator   {RawMemAllocator, sizeof(ResourceMappingImpl),    16  },
         m_FenceAllocator        {RawMemAllocator, ObjectSizes.FenceSize,          16  },
         m_QueryAllocator        {RawMemAllocator, ObjectSizes.QuerySize,          16  },
@@ -277,6 +284,9 @@ public:
         m_DeviceProperties      {}
     // clang-format on
     {
+        if (EngineCI.EnablePipelineStateRegistry)
+            m_pPipelineStatesRegistry.reset(new StateObjectsRegistry<PipelineStateRegistryKey>{RawMemAllocator, "pipeline state"});
+
         // Initialize texture format info
         for (Uint32 Fmt = TEX_FORMAT_UNKNOWN; Fmt < TEX_FORMAT_NUM_FORMATS; ++Fmt)
             static_cast<TextureFormatAttribs&>(m_TextureFormatsInfo[Fmt]) = GetTextureFormatAttribs(static_cast<TEXTURE_FORMAT>(Fmt));
@@ -383,12 +393,26 @@ public:
         return m_pEngineFactory.RawPtr<IEngineFactory>();
     }
 
+    /// Implementation of IRenderDevice::GetPipelineStateRegistryStatistics().
+    virtual void DILIGENT_CALL_TYPE GetPipelineStateRegistryStatistics(PipelineStateRegistryStatistics& Stats) const override final
+    {
+        Stats = PipelineStateRegistryStatistics{};
+        if (m_pPipelineStatesRegistry)
+        {
+            Stats.NumHits   = m_pPipelineStatesRegistry->GetNumHits();
+            Stats.NumMisses = m_pPipelineStatesRegistry->GetNumMisses();
+        }
+    }
+
     void OnCreateDeviceObject(IDeviceObject* pNewObject)
     {
     }
 
     StateObjectsRegistry<SamplerDesc>& GetSamplerRegistry() { return m_SamplersRegistry; }
 
+    /// Returns the pipeline state registry, or null if the registry is disabled.
+    StateObjectsRegistry<PipelineStateRegistryKey>* GetPipelineStateRegistry() { return m_pPipelineStatesRegistry.get(); }
+
     /// Set weak reference to the immediate context
     void SetImmediateContext(IDeviceContext* pImmediateContext)
     {
@@ -416,6 +440,24 @@ public:
     FixedBlockMemoryAllocator& GetBuffViewObjAllocator() { return m_BuffViewObjAllocator; }
     FixedBlockMemoryAllocator& GetSRBAllocator() { return m_SRBAllocator; }
 
+    /// Returns the thread pool that CopyTextureSubresource() should use to copy CopySize bytes,
+    /// or null if the copy is too small to benefit from multithreading.
+    /// The pool is created when the first large copy is performed.
+    ThreadingTools::ThreadPool* GetTextureCopyThreadPool(size_t CopySize)
+    {
+        if (CopySize < MinParallelTextureCopySize)
+            return nullptr;
+
+        std::call_once(m_TextureCopyThreadPoolInitFlag,
+                       [this]() {
+                           // A few threads together with the calling thread are enough to saturate the memory bandwidth
+                           const auto NumThreads = std::min(ThreadingTools::ThreadPool::GetDefaultThreadCount() - 1, size_t{3});
+                           if (NumThreads > 0)
+                               m_pTextureCopyThreadPool.reset(new ThreadingTools::ThreadPool{NumThreads});
+                       });
+        return m_pTextureCopyThreadPool.get();
+    }
+
 protected:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) = 0;
 
@@ -423,6 +465,66 @@ protected:
     template <typename TObjectType, typename TObjectDescType, typename TObjectConstructor>
     void CreateDeviceObject(const Char* ObjectTypeName, const TObjectDescType& Desc, TObjectType** ppObject, TObjectConstructor ConstructObject);
 
+    /// Helper template function that looks up an equivalent pipeline state in the registry
+    /// and only calls ConstructPSO() if it is not found. The new pipeline state is added to the registry
+    /// unless it has static variables: they are set through the pipeline state object itself and
+    /// must not be shared between callers. When the registry is disabled, the function simply calls ConstructPSO().
+    /// ShaderImplType is the backend shader implementation type that provides GetContentHash() and IsContentEqual().
+    template <typename ShaderImplType, typename PSOCreateInfoType, typename TPSOConstructor>
+    void FindOrCreatePipelineState(const PSOCreateInfoType& PSOCreateInfo, IPipelineState** ppPipelineState, TPSOConstructor ConstructPSO)
+    {
+        if (!m_pPipelineStatesRegistry)
+        {
+            ConstructPSO();
+            return;
+        }
+
+        PipelineStateRegistryKey Key{PSOCreateInfo, GetShaderContentHash<ShaderImplType>, IsShaderContentEqual<ShaderImplType>};
+        m_pPipelineStatesRegistry->Find(Key, reinterpret_cast<IDeviceObject**>(ppPipelineState));
+        if (*ppPipelineState == nullptr)
+        {
+            ConstructPSO();
+            if (*ppPipelineState != nullptr && !HasStaticVariables(PSOCreateInfo, *ppPipelineState))
+                m_pPipelineStatesRegistry->Add(Key, *ppPipelineState);
+        }
+    }
+
+    /// Ray tracing pipeline states are never shared.
+    template <typename ShaderImplType, typename TPSOConstructor>
+    void FindOrCreatePipelineState(const RayTracingPipelineStateCreateInfo& /*PSOCreateInfo*/, IPipelineState** ppPipelineState, TPSOConstructor ConstructPSO)
+    {
+        ConstructPSO();
+    }
+
+private:
+    template <typename ShaderImplType>
+    static size_t GetShaderContentHash(IShader* pShader)
+    {
+        return ValidatedCast<ShaderImplType>(pShader)->GetContentHash();
+    }
+
+    template <typename ShaderImplType>
+    static bool IsShaderContentEqual(IShader* pShader0, IShader* pShader1)
+    {
+        return ValidatedCast<ShaderImplType>(pShader0)->IsContentEqual(*ValidatedCast<ShaderImplType>(pShader1));
+    }
+
+    static bool HasStaticVariables(const GraphicsPipelineStateCreateInfo& PSOCreateInfo, IPipelineState* pPSO)
+    {
+        for (auto* pShader : {PSOCreateInfo.pVS, PSOCreateInfo.pPS, PSOCreateInfo.pDS, PSOCreateInfo.pHS, PSOCreateInfo.pGS, PSOCreateInfo.pAS, PSOCreateInfo.pMS})
+        {
+            if (pShader != nullptr && pPSO->GetStaticVariableCount(pShader->GetDesc().ShaderType) != 0)
+                return true;
+        }
+        return false;
+    }
+
+    static bool HasStaticVariables(const ComputePipelineStateCreateInfo& PSOCreateInfo, IPipelineState* pPSO)
+    {
+        return PSOCreateInfo.pCS != nullptr && pPSO->GetStaticVariableCount(PSOCreateInfo.pCS->GetDesc().ShaderType) != 0;
+    }
+
+protected:
     RefCntAutoPtr<IEngineFactory> m_pEngineFactory;
 
     DeviceCaps       m_DeviceCaps;
@@ -432,6 +534,7 @@ protected:
     // This is safe because every object unregisters itself
     // when it is deleted.
     StateObjectsRegistry<SamplerDesc>                                           m_SamplersRegistry; ///< Sampler state registry
+    std::unique_ptr<StateObjectsRegistry<PipelineStateRegistryKey>>             m_pPipelineStatesRegistry; ///< Pipeline state registry, null when disabled
     std::vector<TextureFormatInfoExt, STDAllocatorRawMem<TextureFormatInfoExt>> m_TextureFormatsInfo;
     std::vector<bool, STDAllocatorRawMem<bool>>                                 m_TexFmtInfoInitFlags;
 
@@ -459,6 +562,9 @@ protected:
     FixedBlockMemoryAllocator m_BLASAllocator;        ///< Allocator for bottom-level acceleration structure objects
     FixedBlockMemoryAllocator m_TLASAllocator;        ///< Allocator for top-level acceleration structure objects
     FixedBlockMemoryAllocator m_SBTAllocator;         ///< Allocator for shader binding table objects
+
+    std::once_flag                              m_TextureCopyThreadPoolInitFlag;
+    std::unique_ptr<ThreadingTools::ThreadPool> m_pTextureCopyThreadPool;
 };
 
 
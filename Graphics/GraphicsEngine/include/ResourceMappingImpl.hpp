@@ -54,7 +54,9 @@ public:
     ResourceMappingImpl(IReferenceCounters* pRefCounters, IMemoryAllocator& RawMemAllocator) :
         TObjectBase{pRefCounters},
         m_HashTable{STD_ALLOCATOR_RAW_MEM(HashTableElem, RawMemAllocator, "Allocator for unordered_map<ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>")}
-    {}
+    {
+        m_LockFlag.SetStatistics(ThreadingTools::LockStatistics::Register("Resource mapping"));
+    }
 
     ~ResourceMappingImpl();
 
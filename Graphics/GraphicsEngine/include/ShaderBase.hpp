@@ -38,6 +38,7 @@
 #include "PlatformMisc.hpp"
 #include "EngineMemory.h"
 #include "Align.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
@@ -85,6 +86,61 @@ public:
     }
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_Shader, TDeviceObjectBase)
+
+    /// Implementation of IShader::GetStatus() for backends that always compile shaders synchronously.
+    virtual SHADER_STATUS DILIGENT_CALL_TYPE GetStatus(bool /*WaitForCompletion*/) const override
+    {
+        return SHADER_STATUS_READY;
+    }
+
+    /// Returns the hash of the shader code combined with the create info members that affect
+    /// shader resource reflection. Shaders with equal hashes are interchangeable in a pipeline state.
+    size_t GetContentHash() const { return m_ContentHash; }
+
+    /// Returns true if the shader has the same code and the same create info members that affect
+    /// shader resource reflection as the given shader. The code is only kept and compared
+    /// when the pipeline state registry is enabled, see EngineCreateInfo::EnablePipelineStateRegistry.
+    bool IsContentEqual(const ShaderBase& Shader) const
+    {
+        // clang-format off
+        return m_ContentHash           == Shader.m_ContentHash           &&
+               this->m_Desc.ShaderType == Shader.m_Desc.ShaderType       &&
+               m_ContentAttribs        == Shader.m_ContentAttribs        &&
+               m_Content               == Shader.m_Content;
+        // clang-format on
+    }
+
+protected:
+    /// Initializes the content hash. pCode points to the byte code the shader was compiled to,
+    /// or to the final source in backends that compile shaders at run time.
+    void InitContent(const ShaderCreateInfo& ShaderCI, const void* pCode, size_t CodeSize)
+    {
+        m_ContentAttribs = ShaderCI.EntryPoint != nullptr ? ShaderCI.EntryPoint : "";
+        m_ContentAttribs += '\0';
+        if (ShaderCI.UseCombinedTextureSamplers)
+        {
+            m_ContentAttribs += '1';
+            m_ContentAttribs += ShaderCI.CombinedSamplerSuffix != nullptr ? ShaderCI.CombinedSamplerSuffix : "";
+        }
+
+        m_ContentHash = ComputeHash(static_cast<Uint32>(this->m_Desc.ShaderType), ComputeHashRaw(pCode, CodeSize), m_ContentAttribs);
+
+        // The pipeline state registry compares the code of shaders with equal hashes
+        if (this->GetDevice()->GetPipelineStateRegistry() != nullptr && CodeSize > 0)
+        {
+            const auto* pBytes = static_cast<const Uint8*>(pCode);
+            m_Content.assign(pBytes, pBytes + CodeSize);
+        }
+    }
+
+private:
+    size_t m_ContentHash = 0;
+
+    // Entry point and combined texture samplers mode, see InitContent()
+    String m_ContentAttribs;
+
+    // Copy of the shader code. Only kept when the pipeline state registry is enabled.
+    std::vector<Uint8> m_Content;
 };
 
 } // namespace Diligent
@@ -73,6 +73,26 @@ public:
         return m_pPSO;
     }
 
+    /// Implementation of IShaderResourceBinding::SetVariables() that binds variables one by one.
+    /// Back-ends that can batch descriptor updates override this method.
+    virtual void DILIGENT_CALL_TYPE SetVariables(Uint32 NumVariables, const ShaderResourceVariableBinding* pVariables) override
+    {
+        DEV_CHECK_ERR(NumVariables == 0 || pVariables != nullptr, "pVariables must not be null");
+        for (Uint32 i = 0; i < NumVariables; ++i)
+        {
+            const auto& Var = pVariables[i];
+            if (auto* pVar = this->GetVariableByName(Var.ShaderType, Var.Name))
+            {
+                pVar->SetArray(&Var.pObject, Var.ArrayIndex, 1);
+            }
+            else
+            {
+                LOG_ERROR_MESSAGE("Unable to find mutable/dynamic variable '", Var.Name, "' in shader stage ", GetShaderTypeLiteralName(Var.ShaderType),
+                                  " of shader resource binding of PSO '", m_pPSO->GetDesc().Name, "'.");
+            }
+        }
+    }
+
     template <typename PSOType>
     PSOType* GetPipelineState()
     {
@@ -68,7 +68,9 @@ public:
     StateObjectsRegistry(IMemoryAllocator& RawAllocator, const Char* RegistryName) :
         m_DescToObjHashMap(STD_ALLOCATOR_RAW_MEM(HashMapElem, RawAllocator, "Allocator for unordered_map<ResourceDescType, RefCntWeakPtr<IDeviceObject> >")),
         m_RegistryName{RegistryName}
-    {}
+    {
+        m_LockFlag.SetStatistics(ThreadingTools::LockStatistics::Register(RegistryName));
+    }
 
     ~StateObjectsRegistry()
     {
@@ -149,6 +151,7 @@ public:
             if (pObject)
             {
                 *ppObject = pObject.Detach();
+                Atomics::AtomicIncrement(m_NumHits);
                 //LOG_INFO_MESSAGE( "Equivalent of the requested state object named \"", Desc.Name ? Desc.Name : "", "\" found in the ", m_RegistryName, " registry. Reusing existing object.");
             }
             else
@@ -158,8 +161,17 @@ public:
                 Atomics::AtomicDecrement(m_NumDeletedObjects);
             }
         }
+
+        if (*ppObject == nullptr)
+            Atomics::AtomicIncrement(m_NumMisses);
     }
 
+    /// Returns the number of Find() calls that returned an existing object.
+    Uint32 GetNumHits() const { return static_cast<Uint32>(m_NumHits); }
+
+    /// Returns the number of Find() calls that did not find a live object.
+    Uint32 GetNumMisses() const { return static_cast<Uint32>(m_NumMisses); }
+
     /// Purges outstanding deleted objects from the registry
     void Purge()
     {
@@ -203,6 +215,10 @@ private:
     /// Nmber of outstanding deleted objects that have not been purged
     Atomics::AtomicLong m_NumDeletedObjects;
 
+    /// Number of successful and unsuccessful Find() calls
+    Atomics::AtomicLong m_NumHits{0};
+    Atomics::AtomicLong m_NumMisses{0};
+
     /// Hash map that stores weak pointers to the referenced objects
     typedef std::pair<const ResourceDescType, RefCntWeakPtr<IDeviceObject>>                                                                                           HashMapElem;
     std::unordered_map<ResourceDescType, RefCntWeakPtr<IDeviceObject>, std::hash<ResourceDescType>, std::equal_to<ResourceDescType>, STDAllocatorRawMem<HashMapElem>> m_DescToObjHashMap;
@@ -285,6 +285,170 @@ struct DrawIndexedAttribs
 typedef struct DrawIndexedAttribs DrawIndexedAttribs;
 
 
+/// Defines a single draw of the multi-draw command.
+
+/// This structure is used by IDeviceContext::MultiDraw().
+/// The layout of the structure matches the layout of the indirect draw
+/// arguments, see IDeviceContext::DrawIndirect().
+struct MultiDrawItem
+{
+    /// The number of vertices to draw.
+    Uint32 NumVertices           DEFAULT_INITIALIZER(0);
+
+    /// The number of instances to draw.
+    Uint32 NumInstances          DEFAULT_INITIALIZER(1);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) of the first vertex in the
+    /// vertex buffer to start reading vertices from.
+    Uint32 StartVertexLocation   DEFAULT_INITIALIZER(0);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) in the vertex buffer to start
+    /// reading instance data from.
+    ///
+    /// \remarks All draws of the multi-draw command use the same pipeline state and
+    ///          shader resources. Per-instance vertex attribute read at this location
+    ///          (for example, an index into a structured buffer) is the way to provide
+    ///          every draw with its own data.
+    Uint32 FirstInstanceLocation DEFAULT_INITIALIZER(0);
+
+
+#if DILIGENT_CPP_INTERFACE
+    /// Initializes the structure members with default values.
+    MultiDrawItem()noexcept{}
+
+    /// Initializes the structure with user-specified values.
+    MultiDrawItem(Uint32 _NumVertices,
+                  Uint32 _NumInstances          = 1,
+                  Uint32 _StartVertexLocation   = 0,
+                  Uint32 _FirstInstanceLocation = 0)noexcept :
+        NumVertices          {_NumVertices          },
+        NumInstances         {_NumInstances         },
+        StartVertexLocation  {_StartVertexLocation  },
+        FirstInstanceLocation{_FirstInstanceLocation}
+    {}
+#endif
+};
+typedef struct MultiDrawItem MultiDrawItem;
+
+
+/// Defines the multi-draw command attributes.
+
+/// This structure is used by IDeviceContext::MultiDraw().
+struct MultiDrawAttribs
+{
+    /// The number of draws.
+    Uint32               DrawCount  DEFAULT_INITIALIZER(0);
+
+    /// Pointer to the array of DrawCount draw items.
+    const MultiDrawItem* pDrawItems DEFAULT_INITIALIZER(nullptr);
+
+    /// Additional flags, see Diligent::DRAW_FLAGS.
+    DRAW_FLAGS           Flags      DEFAULT_INITIALIZER(DRAW_FLAG_NONE);
+
+
+#if DILIGENT_CPP_INTERFACE
+    /// Initializes the structure members with default values.
+    MultiDrawAttribs()noexcept{}
+
+    /// Initializes the structure with user-specified values.
+    MultiDrawAttribs(Uint32               _DrawCount,
+                     const MultiDrawItem* _pDrawItems,
+                     DRAW_FLAGS           _Flags)noexcept :
+        DrawCount {_DrawCount },
+        pDrawItems{_pDrawItems},
+        Flags     {_Flags     }
+    {}
+#endif
+};
+typedef struct MultiDrawAttribs MultiDrawAttribs;
+
+
+/// Defines a single draw of the indexed multi-draw command.
+
+/// This structure is used by IDeviceContext::MultiDrawIndexed().
+/// The layout of the structure matches the layout of the indexed indirect draw
+/// arguments, see IDeviceContext::DrawIndexedIndirect().
+struct MultiDrawIndexedItem
+{
+    /// The number of indices to draw.
+    Uint32 NumIndices            DEFAULT_INITIALIZER(0);
+
+    /// The number of instances to draw.
+    Uint32 NumInstances          DEFAULT_INITIALIZER(1);
+
+    /// LOCATION (NOT the byte offset) of the first index in
+    /// the index buffer to start reading indices from.
+    Uint32 FirstIndexLocation    DEFAULT_INITIALIZER(0);
+
+    /// A constant which is added to each index before accessing the vertex buffer.
+    Uint32 BaseVertex            DEFAULT_INITIALIZER(0);
+
+    /// LOCATION (or INDEX, but NOT the byte offset) in the vertex
+    /// buffer to start reading instance data from.
+    ///
+    /// \remarks See MultiDrawItem::FirstInstanceLocation.
+    Uint32 FirstInstanceLocation DEFAULT_INITIALIZER(0);
+
+
+#if DILIGENT_CPP_INTERFACE
+    /// Initializes the structure members with default values.
+    MultiDrawIndexedItem()noexcept{}
+
+    /// Initializes the structure with user-specified values.
+    MultiDrawIndexedItem(Uint32 _NumIndices,
+                         Uint32 _NumInstances          = 1,
+                         Uint32 _FirstIndexLocation    = 0,
+                         Uint32 _BaseVertex            = 0,
+                         Uint32 _FirstInstanceLocation = 0)noexcept :
+        NumIndices           {_NumIndices           },
+        NumInstances         {_NumInstances         },
+        FirstIndexLocation   {_FirstIndexLocation   },
+        BaseVertex           {_BaseVertex           },
+        FirstInstanceLocation{_FirstInstanceLocation}
+    {}
+#endif
+};
+typedef struct MultiDrawIndexedItem MultiDrawIndexedItem;
+
+
+/// Defines the indexed multi-draw command attributes.
+
+/// This structure is used by IDeviceContext::MultiDrawIndexed().
+struct MultiDrawIndexedAttribs
+{
+    /// The number of draws.
+    Uint32                      DrawCount  DEFAULT_INITIALIZER(0);
+
+    /// Pointer to the array of DrawCount draw items.
+    const MultiDrawIndexedItem* pDrawItems DEFAULT_INITIALIZER(nullptr);
+
+    /// The type of elements in the index buffer.
+    /// Allowed values: VT_UINT16 and VT_UINT32.
+    VALUE_TYPE                  IndexType  DEFAULT_INITIALIZER(VT_UNDEFINED);
+
+    /// Additional flags, see Diligent::DRAW_FLAGS.
+    DRAW_FLAGS                  Flags      DEFAULT_INITIALIZER(DRAW_FLAG_NONE);
+
+
+#if DILIGENT_CPP_INTERFACE
+    /// Initializes the structure members with default values.
+    MultiDrawIndexedAttribs()noexcept{}
+
+    /// Initializes the structure with user-specified values.
+    MultiDrawIndexedAttribs(Uint32                      _DrawCount,
+                            const MultiDrawIndexedItem* _pDrawItems,
+                            VALUE_TYPE                  _IndexType,
+                            DRAW_FLAGS                  _Flags)noexcept :
+        DrawCount {_DrawCount },
+        pDrawItems{_pDrawItems},
+        IndexType {_IndexType },
+        Flags     {_Flags     }
+    {}
+#endif
+};
+typedef struct MultiDrawIndexedAttribs MultiDrawIndexedAttribs;
+
+
 /// Defines the indirect draw command attributes.
 
 /// This structure is used by IDeviceContext::DrawIndirect().
@@ -2202,6 +2366,60 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
     ///           to the shader binding table passed as an argument to the function.
     VIRTUAL void METHOD(TraceRays)(THIS_
                                    const TraceRaysAttribs REF Attribs) PURE;
+
+
+    /// Executes a sequence of draw commands.
+
+    /// \param [in] Attribs - Multi-draw command attributes, see Diligent::MultiDrawAttribs for details.
+    ///
+    /// \remarks  All draws use the pipeline state, shader resources and vertex buffers
+    ///           currently bound to the context. The state is validated and committed once
+    ///           for the whole sequence, which makes the command considerably cheaper than
+    ///           the equivalent series of Draw() calls.
+    ///
+    ///           Vulkan backend issues all draws with a single vkCmdDrawIndirect command when
+    ///           multiDrawIndirect and drawIndirectFirstInstance device features are supported.
+    ///           Other backends issue the draws back-to-back.
+    ///
+    ///           If Diligent::DRAW_FLAG_VERIFY_STATES flag is set, the method reads the state of vertex
+    ///           buffers, so no other threads are allowed to alter the states of the same resources.
+    ///           It is OK to read these states.
+    VIRTUAL void METHOD(MultiDraw)(THIS_
+                                   const MultiDrawAttribs REF Attribs) PURE;
+
+
+    /// Executes a sequence of indexed draw commands.
+
+    /// \param [in] Attribs - Multi-draw command attributes, see Diligent::MultiDrawIndexedAttribs for details.
+    ///
+    /// \remarks  See remarks for IDeviceContext::MultiDraw().
+    ///
+    ///           If Diligent::DRAW_FLAG_VERIFY_STATES flag is set, the method reads the state of vertex/index
+    ///           buffers, so no other threads are allowed to alter the states of the same resources.
+    ///           It is OK to read these states.
+    VIRTUAL void METHOD(MultiDrawIndexed)(THIS_
+                                          const MultiDrawIndexedAttribs REF Attribs) PURE;
+
+
+    /// Makes the GPU wait until the fence reaches or exceeds the specified value.
+
+    /// \param [in] pFence - The fence to wait for.
+    /// \param [in] Value  - The value that the context is waiting for the fence to reach.
+    ///
+    /// \remarks   Wait is only allowed for immediate contexts.\n
+    ///            Unlike IDeviceContext::WaitForFence(), the method does not block the calling thread.
+    ///            The commands submitted by the next IDeviceContext::Flush() do not start execution until
+    ///            the fence reaches the value. This is the way to synchronize immediate contexts that
+    ///            submit commands to different queues.\n
+    ///            The command that signals the fence with the value must be submitted to the GPU before
+    ///            the context is flushed, otherwise the GPU may deadlock.\n
+    ///            In Direct3D11 and OpenGL backends, all commands are executed by a single queue in order,
+    ///            so the method only verifies that the fence has been signaled with the value.
+    ///            In Vulkan backend, if the device does not support timeline semaphores, the method
+    ///            flushes the context and waits for the fence on the host.
+    VIRTUAL void METHOD(DeviceWaitForFence)(THIS_
+                                            IFence* pFence,
+                                            Uint64  Value) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -2260,6 +2478,9 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_WriteBLASCompactedSize(This, ...)    CALL_IFACE_METHOD(DeviceContext, WriteBLASCompactedSize,    This, __VA_ARGS__)
 #    define IDeviceContext_WriteTLASCompactedSize(This, ...)    CALL_IFACE_METHOD(DeviceContext, WriteTLASCompactedSize,    This, __VA_ARGS__)
 #    define IDeviceContext_TraceRays(This, ...)                 CALL_IFACE_METHOD(DeviceContext, TraceRays,                 This, __VA_ARGS__)
+#    define IDeviceContext_MultiDraw(This, ...)                 CALL_IFACE_METHOD(DeviceContext, MultiDraw,                 This, __VA_ARGS__)
+#    define IDeviceContext_MultiDrawIndexed(This, ...)          CALL_IFACE_METHOD(DeviceContext, MultiDrawIndexed,          This, __VA_ARGS__)
+#    define IDeviceContext_DeviceWaitForFence(This, ...)        CALL_IFACE_METHOD(DeviceContext, DeviceWaitForFence,        This, __VA_ARGS__)
 
 // clang-format on
 
@@ -1440,7 +1440,8 @@ enum RENDER_DEVICE_TYPE
     RENDER_DEVICE_TYPE_GL,             ///< OpenGL device 
     RENDER_DEVICE_TYPE_GLES,           ///< OpenGLES device
     RENDER_DEVICE_TYPE_VULKAN,         ///< Vulkan device
-    RENDER_DEVICE_TYPE_METAL           ///< Metal device (not yet implemented)
+    RENDER_DEVICE_TYPE_METAL,          ///< Metal device (not yet implemented)
+    RENDER_DEVICE_TYPE_NULL            ///< Null device that validates and records commands without executing them
 };
 
 
@@ -1818,6 +1819,10 @@ struct DeviceCaps
     {
         return DevType == RENDER_DEVICE_TYPE_METAL;
     }
+    bool IsNullDevice()const
+    {
+        return DevType == RENDER_DEVICE_TYPE_NULL;
+    }
 
     struct NDCAttribs
     {
@@ -1905,6 +1910,18 @@ struct EngineCreateInfo
 
     /// Pointer to the user-specified debug message callback function
     DebugMessageCallbackType DebugMessageCallback   DEFAULT_INITIALIZER(nullptr);
+
+    /// Enable the pipeline state registry.
+
+    /// \remarks   When the registry is enabled, IRenderDevice::CreateGraphicsPipelineState()
+    ///             and IRenderDevice::CreateComputePipelineState() return a new reference to an existing
+    ///             pipeline state if a live pipeline with identical create info, including the name, was
+    ///             created before. Shaders are compared by their byte code or source, render passes
+    ///             are compared by object identity. Pipelines that have static shader resource variables
+    ///             and ray tracing pipelines are never deduplicated. Note that the user data
+    ///             (IDeviceObject::SetUserData) of a deduplicated pipeline is shared by all its users.
+    ///             Registry statistics can be queried with IRenderDevice::GetPipelineStateRegistryStatistics().
+    bool EnablePipelineStateRegistry                DEFAULT_INITIALIZER(false);
 };
 typedef struct EngineCreateInfo EngineCreateInfo;
 
@@ -1925,6 +1942,32 @@ struct EngineGLCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 
     /// Setting this to true is typically needed for testing purposes only.
     bool ForceNonSeparablePrograms DEFAULT_INITIALIZER(false);
+
+    /// Size of the persistently mapped dynamic heap (the ring buffer that is used to
+    /// suballocate memory for dynamic uniform buffers when they are mapped with MAP_FLAG_DISCARD).
+    /// The heap requires GL 4.4 or GL_ARB_buffer_storage extension. If the size is zero or
+    /// buffer storage is not supported, dynamic buffers are updated with glMapBufferRange().
+    /// Contents of all dynamic buffers suballocated from the heap is discarded at the end of every frame.
+    Uint32 DynamicHeapSize DEFAULT_INITIALIZER(8 << 20);
+
+    /// Path to the directory where linked program binaries are cached.
+
+    /// The cache is keyed by the final GLSL source of the program shaders and the driver
+    /// vendor, renderer and version strings, so that unchanged programs are loaded with
+    /// glProgramBinary() instead of being compiled and linked when the application is restarted.
+    /// Binaries rejected by the driver are transparently rebuilt from the source.
+    /// The cache requires GL 4.1, GLES 3.0 or GL_ARB_get_program_binary extension.
+    /// If null, the cache is disabled.
+    const char* ProgramBinaryCacheDirectory DEFAULT_INITIALIZER(nullptr);
+
+    /// The maximum number of threads the driver may use to compile shaders and link programs.
+
+    /// The value is passed to glMaxShaderCompilerThreadsKHR() when GL_KHR_parallel_shader_compile
+    /// or GL_ARB_parallel_shader_compile extension is supported. 0xFFFFFFFF lets the driver
+    /// use as many threads as it wants, 0 disables parallel compilation.
+    /// Parallel compilation is only beneficial for shaders created with SHADER_COMPILE_FLAG_ASYNCHRONOUS
+    /// and pipeline states created with PSO_CREATE_FLAG_ASYNCHRONOUS flags.
+    Uint32 MaxShaderCompilerThreads DEFAULT_INITIALIZER(0xFFFFFFFFu);
 };
 typedef struct EngineGLCreateInfo EngineGLCreateInfo;
 
@@ -2273,6 +2316,55 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// Path to DirectX Shader Compiler, which is required to use Shader Model 6.0+
     /// features when compiling shaders from HLSL.
     const char* pDxCompilerPath DEFAULT_INITIALIZER(nullptr);
+
+    /// Initial data of the Vulkan pipeline cache, e.g. previously retrieved
+    /// with IRenderDeviceVk::GetPipelineCacheData(). The data is ignored if it
+    /// was created by a different driver or device.
+    const void* pPipelineCacheData DEFAULT_INITIALIZER(nullptr);
+
+    /// Size of the initial pipeline cache data, in bytes.
+    Uint32 PipelineCacheDataSize   DEFAULT_INITIALIZER(0);
+
+    /// Path to the file the pipeline cache is loaded from when the device is
+    /// created and saved to when the device is destroyed.
+    /// If the file exists, its content takes precedence over pPipelineCacheData.
+    const char* PipelineCacheFilePath DEFAULT_INITIALIZER(nullptr);
+
+    /// The number of worker threads that compile shaders created with
+    /// SHADER_COMPILE_FLAG_ASYNCHRONOUS flag. If zero, the number of hardware
+    /// threads is used. The threads are started when the first asynchronous
+    /// shader is created.
+    Uint32 NumAsyncShaderCompilationThreads DEFAULT_INITIALIZER(0);
+
+    /// Path to the directory where SPIR-V byte code compiled by glslang is cached.
+    /// The cache is keyed by the preprocessed shader source and the compilation settings,
+    /// so that unchanged shaders are not recompiled when the application is restarted.
+    /// If null, the cache is disabled.
+    const char* SPIRVCacheDirectory DEFAULT_INITIALIZER(nullptr);
+
+    /// Whether to create an additional immediate context that submits commands to a queue
+    /// other than the main graphics queue and supports compute operations.
+
+    /// The engine looks for a queue family that supports compute, but not graphics, operations
+    /// and falls back to another queue of any compute-capable family. The context is returned in
+    /// ppContexts after the deferred contexts. If the device has no suitable queue, the pointer is null.
+    /// The context may only record compute and copy commands.
+    bool EnableAsyncComputeQueue DEFAULT_INITIALIZER(false);
+
+    /// Whether to create an additional immediate context that submits commands to a dedicated
+    /// transfer queue.
+
+    /// The engine looks for a queue family that only supports transfer operations and falls back
+    /// to another queue of any family. The context is returned in ppContexts after the deferred contexts
+    /// and the async compute context. If the device has no suitable queue, the pointer is null.
+    /// The context may only record copy commands.
+    ///
+    /// \remarks  Commands of the contexts bound to different queues execute in parallel and must be
+    ///           synchronized with IDeviceContext::SignalFence() and IDeviceContext::DeviceWaitForFence().
+    ///           Resources accessed by more than one queue must include the bits of all these queues
+    ///           in their CommandQueueMask. The main queue has index 0, the additional queues are numbered
+    ///           from 1 in the order their contexts are returned in ppContexts, skipping null contexts.
+    bool EnableTransferQueue DEFAULT_INITIALIZER(false);
 };
 typedef struct EngineVkCreateInfo EngineVkCreateInfo;
 
@@ -2310,6 +2402,20 @@ struct EngineMtlCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 typedef struct EngineMtlCreateInfo EngineMtlCreateInfo;
 
 
+/// Attributes of the Null engine implementation
+struct EngineNullCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
+
+    /// Verify that all shader variables are bound every time resources are committed
+    /// or a draw/dispatch command is recorded.
+
+    /// The check is only performed in development builds and mirrors
+    /// D3D11_DEBUG_FLAG_VERIFY_COMMITTED_SHADER_RESOURCES. Disable it to exclude
+    /// the verification cost from CPU-side measurements.
+    bool VerifyCommittedShaderResources DEFAULT_INITIALIZER(true);
+};
+typedef struct EngineNullCreateInfo EngineNullCreateInfo;
+
+
 /// Box
 struct Box
 {
@@ -384,10 +384,40 @@ DILIGENT_TYPED_ENUM(PSO_CREATE_FLAGS, Uint32)
     /// that is not found in any of the designated shader stages.
     /// Use this flag to silence these warnings.
     PSO_CREATE_FLAG_IGNORE_MISSING_IMMUTABLE_SAMPLERS = 0x02,
+
+    /// Create the pipeline state asynchronously.
+
+    /// When this flag is set, pipeline creation only submits the work to the driver and
+    /// does not wait for it to finish. Use IPipelineState::GetStatus() to query the status.
+    /// The pipeline state waits for the completion when it is first used or when
+    /// any of its methods that require shader reflection is called.
+    /// \note Asynchronous pipeline creation is only supported in OpenGL backend, where
+    ///       compile and link status queries are deferred so that the driver can process
+    ///       multiple programs in parallel (see GL_KHR_parallel_shader_compile).
+    ///       Other backends ignore this flag and create the pipeline synchronously.
+    PSO_CREATE_FLAG_ASYNCHRONOUS                      = 0x04,
 };
 DEFINE_FLAG_ENUM_OPERATORS(PSO_CREATE_FLAGS);
 
 
+/// Pipeline state status
+DILIGENT_TYPED_ENUM(PIPELINE_STATE_STATUS, Uint32)
+{
+    /// Initial pipeline state status.
+    PIPELINE_STATE_STATUS_UNINITIALIZED = 0,
+
+    /// The pipeline state is being compiled.
+    PIPELINE_STATE_STATUS_COMPILING,
+
+    /// The pipeline state has been successfully compiled
+    /// and is ready to be used.
+    PIPELINE_STATE_STATUS_READY,
+
+    /// The pipeline state compilation has failed.
+    PIPELINE_STATE_STATUS_FAILED
+};
+
+
 /// Pipeline state creation attributes
 struct PipelineStateCreateInfo
 {
@@ -601,6 +631,17 @@ DILIGENT_BEGIN_INTERFACE(IPipelineState, IDeviceObject)
     ///             into account vertex shader input layout, number of outputs, etc.
     VIRTUAL bool METHOD(IsCompatibleWith)(THIS_
                                           const struct IPipelineState* pPSO) CONST PURE;
+
+
+    /// Returns the pipeline state status, see Diligent::PIPELINE_STATE_STATUS.
+
+    /// \param [in] WaitForCompletion - If true, the method will wait until the pipeline state
+    ///                                 compilation is finished. Otherwise, the current status is returned.
+    /// \remarks    Only pipeline states created with PSO_CREATE_FLAG_ASYNCHRONOUS flag may be in
+    ///             PIPELINE_STATE_STATUS_COMPILING state.\n
+    ///             In OpenGL backend, the method must be called from the thread that owns the GL context.
+    VIRTUAL PIPELINE_STATE_STATUS METHOD(GetStatus)(THIS_
+                                                    Bool WaitForCompletion DEFAULT_VALUE(false)) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -620,6 +661,7 @@ DILIGENT_END_INTERFACE
 #    define IPipelineState_GetStaticVariableByIndex(This, ...)    CALL_IFACE_METHOD(PipelineState, GetStaticVariableByIndex,    This, __VA_ARGS__)
 #    define IPipelineState_CreateShaderResourceBinding(This, ...) CALL_IFACE_METHOD(PipelineState, CreateShaderResourceBinding, This, __VA_ARGS__)
 #    define IPipelineState_IsCompatibleWith(This, ...)            CALL_IFACE_METHOD(PipelineState, IsCompatibleWith,            This, __VA_ARGS__)
+#    define IPipelineState_GetStatus(This, ...)                   CALL_IFACE_METHOD(PipelineState, GetStatus,                   This, __VA_ARGS__)
 
 // clang-format on
 
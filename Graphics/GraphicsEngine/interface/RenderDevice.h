@@ -61,6 +61,17 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static const INTERFACE_ID IID_RenderDevice =
     {0xf0e9b607, 0xae33, 0x4b2b, {0xb1, 0xaf, 0xa8, 0xb2, 0xc3, 0x10, 0x40, 0x22}};
 
+/// Pipeline state registry statistics, see IRenderDevice::GetPipelineStateRegistryStatistics().
+struct PipelineStateRegistryStatistics
+{
+    /// The number of pipeline state requests that returned an existing pipeline state.
+    Uint32 NumHits   DEFAULT_INITIALIZER(0);
+
+    /// The number of pipeline state requests that resulted in creating a new pipeline state.
+    Uint32 NumMisses DEFAULT_INITIALIZER(0);
+};
+typedef struct PipelineStateRegistryStatistics PipelineStateRegistryStatistics;
+
 #define DILIGENT_INTERFACE_NAME IRenderDevice
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -327,6 +338,15 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
     /// \remark This method does not increment the reference counter of the returned interface,
     ///         so the application should not call Release().
     VIRTUAL IEngineFactory* METHOD(GetEngineFactory)(THIS) CONST PURE;
+
+
+    /// Returns pipeline state registry statistics.
+
+    /// \param [out] Stats - Registry statistics. If the registry is disabled
+    ///                      (EngineCreateInfo::EnablePipelineStateRegistry is false),
+    ///                      all members are set to zero.
+    VIRTUAL void METHOD(GetPipelineStateRegistryStatistics)(THIS_
+                                                            PipelineStateRegistryStatistics REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -353,6 +373,7 @@ DILIGENT_END_INTERFACE
 #    define IRenderDevice_ReleaseStaleResources(This, ...)         CALL_IFACE_METHOD(RenderDevice, ReleaseStaleResources,       This, __VA_ARGS__)
 #    define IRenderDevice_IdleGPU(This)                            CALL_IFACE_METHOD(RenderDevice, IdleGPU,                     This)
 #    define IRenderDevice_GetEngineFactory(This)                   CALL_IFACE_METHOD(RenderDevice, GetEngineFactory,            This)
+#    define IRenderDevice_GetPipelineStateRegistryStatistics(This, ...) CALL_IFACE_METHOD(RenderDevice, GetPipelineStateRegistryStatistics, This, __VA_ARGS__)
 // clang-format on
 
 #endif
@@ -129,6 +129,46 @@ DILIGENT_TYPED_ENUM(CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS, Uint32)
 };
 DEFINE_FLAG_ENUM_OPERATORS(CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS);
 
+
+/// Shader compilation flags
+DILIGENT_TYPED_ENUM(SHADER_COMPILE_FLAGS, Uint32)
+{
+    /// No flags.
+    SHADER_COMPILE_FLAG_NONE = 0x00,
+
+    /// Compile the shader asynchronously.
+
+    /// When this flag is set, IRenderDevice::CreateShader() returns immediately and the
+    /// shader is compiled by a worker thread. Use IShader::GetStatus() to query
+    /// the compilation status. Pipeline states wait for the shaders to be compiled.
+    /// \note Asynchronous compilation is supported in Vulkan and OpenGL backends. In OpenGL,
+    ///       the shader is compiled by the driver (in parallel if GL_KHR_parallel_shader_compile
+    ///       is supported) and IShader::GetStatus() must be called from the thread that owns
+    ///       the GL context. Other backends ignore this flag and compile the shader synchronously.
+    SHADER_COMPILE_FLAG_ASYNCHRONOUS = 0x01,
+
+    SHADER_COMPILE_FLAG_LAST = SHADER_COMPILE_FLAG_ASYNCHRONOUS
+};
+DEFINE_FLAG_ENUM_OPERATORS(SHADER_COMPILE_FLAGS);
+
+
+/// Shader status
+DILIGENT_TYPED_ENUM(SHADER_STATUS, Uint32)
+{
+    /// Initial shader status.
+    SHADER_STATUS_UNINITIALIZED = 0,
+
+    /// The shader is being compiled.
+    SHADER_STATUS_COMPILING,
+
+    /// The shader has been successfully compiled
+    /// and is ready to be used.
+    SHADER_STATUS_READY,
+
+    /// The shader compilation has failed.
+    SHADER_STATUS_FAILED
+};
+
 /// Shader description
 struct ShaderDesc DILIGENT_DERIVE(DeviceObjectAttribs)
 
@@ -321,6 +361,8 @@ struct ShaderCreateInfo
     /// supported by the device.
     ShaderVersion GLESSLVersion DEFAULT_INITIALIZER({});
 
+    /// Shader compile flags (see Diligent::SHADER_COMPILE_FLAGS).
+    SHADER_COMPILE_FLAGS CompileFlags DEFAULT_INITIALIZER(SHADER_COMPILE_FLAG_NONE);
 
     /// Memory address where pointer to the compiler messages data blob will be written
 
@@ -419,6 +461,16 @@ DILIGENT_BEGIN_INTERFACE(IShader, IDeviceObject)
     VIRTUAL void METHOD(GetResourceDesc)(THIS_
                                          Uint32 Index,
                                          ShaderResourceDesc REF ResourceDesc) CONST PURE;
+
+    /// Returns the shader status, see Diligent::SHADER_STATUS.
+
+    /// \param [in] WaitForCompletion - If true, the method will wait until the shader compilation
+    ///                                 is finished. Otherwise, the current status is returned.
+    /// \note The shader must not be used in a pipeline state until its status is
+    ///       SHADER_STATUS_READY. Pipeline states created from shaders that are still being
+    ///       compiled wait for the compilation to finish.
+    VIRTUAL SHADER_STATUS METHOD(GetStatus)(THIS_
+                                            Bool WaitForCompletion DEFAULT_VALUE(false)) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -432,6 +484,7 @@ DILIGENT_END_INTERFACE
 
 #    define IShader_GetResourceCount(This)     CALL_IFACE_METHOD(Shader, GetResourceCount, This)
 #    define IShader_GetResourceDesc(This, ...) CALL_IFACE_METHOD(Shader, GetResourceDesc,  This, __VA_ARGS__)
+#    define IShader_GetStatus(This, ...)       CALL_IFACE_METHOD(Shader, GetStatus,        This, __VA_ARGS__)
 
 // clang-format on
 
@@ -44,6 +44,42 @@ static const INTERFACE_ID IID_ShaderResourceBinding =
     {0x61f8774, 0x9a09, 0x48e8, {0x84, 0x11, 0xb5, 0xbd, 0x20, 0x56, 0x1, 0x4}};
 
 
+// clang-format off
+
+/// Describes a resource to bind to a shader resource variable, see IShaderResourceBinding::SetVariables().
+struct ShaderResourceVariableBinding
+{
+    /// Type of the shader stage the variable is defined in.
+    /// Must be one of Diligent::SHADER_TYPE.
+    SHADER_TYPE ShaderType        DEFAULT_INITIALIZER(SHADER_TYPE_UNKNOWN);
+
+    /// Variable name.
+    const Char* Name              DEFAULT_INITIALIZER(nullptr);
+
+    /// Object to bind to the variable.
+    struct IDeviceObject* pObject DEFAULT_INITIALIZER(nullptr);
+
+    /// Index of the array element to bind the object to.
+    Uint32 ArrayIndex             DEFAULT_INITIALIZER(0);
+
+#if DILIGENT_CPP_INTERFACE
+    ShaderResourceVariableBinding()noexcept{}
+
+    ShaderResourceVariableBinding(SHADER_TYPE    _ShaderType,
+                                  const Char*    _Name,
+                                  IDeviceObject* _pObject,
+                                  Uint32         _ArrayIndex = 0)noexcept :
+        ShaderType {_ShaderType},
+        Name       {_Name      },
+        pObject    {_pObject   },
+        ArrayIndex {_ArrayIndex}
+    {}
+#endif
+};
+typedef struct ShaderResourceVariableBinding ShaderResourceVariableBinding;
+
+// clang-format on
+
 #define DILIGENT_INTERFACE_NAME IShaderResourceBinding
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -81,6 +117,10 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceBinding, IObject)
     ///
     /// \note  This operation may potentially be expensive. If the variable will be used often, it is
     ///        recommended to store and reuse the pointer as it never changes.
+    ///        Variable indices (see IShaderResourceVariable::GetIndex()) are the same in all
+    ///        shader resource bindings created by the same pipeline state, so an application may
+    ///        look up the index once and then use IShaderResourceBinding::GetVariableByIndex()
+    ///        for every new SRB.
     VIRTUAL IShaderResourceVariable* METHOD(GetVariableByName)(THIS_
                                                                SHADER_TYPE ShaderType,
                                                                const char* Name) PURE;
@@ -128,6 +168,19 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceBinding, IObject)
     ///       no effect and a warning messge will be displayed.
     VIRTUAL void METHOD(InitializeStaticResources)(THIS_
                                                    const struct IPipelineState* pPipelineState DEFAULT_VALUE(nullptr)) PURE;
+
+    /// Binds resources to multiple mutable and dynamic variables
+
+    /// \param [in] NumVariables - Number of elements in pVariables array.
+    /// \param [in] pVariables   - Array of variable bindings, see Diligent::ShaderResourceVariableBinding.
+    ///
+    /// \remarks The method is equivalent to setting every variable individually, but
+    ///          allows the implementation to batch descriptor updates. In Vulkan backend,
+    ///          when all mutable variables are set at once, the descriptor set is
+    ///          written with a single templated update.
+    VIRTUAL void METHOD(SetVariables)(THIS_
+                                      Uint32                               NumVariables,
+                                      const ShaderResourceVariableBinding* pVariables) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -143,6 +196,7 @@ DILIGENT_END_INTERFACE
 #    define IShaderResourceBinding_GetVariableCount(This, ...)          CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableCount,          This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableByIndex(This, ...)        CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByIndex,        This, __VA_ARGS__)
 #    define IShaderResourceBinding_InitializeStaticResources(This, ...) CALL_IFACE_METHOD(ShaderResourceBinding, InitializeStaticResources, This, __VA_ARGS__)
+#    define IShaderResourceBinding_SetVariables(This, ...)              CALL_IFACE_METHOD(ShaderResourceBinding, SetVariables,              This, __VA_ARGS__)
 
 // clang-format on
 
@@ -146,6 +146,10 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceVariable, IObject)
                                          ShaderResourceDesc REF ResourceDesc) CONST PURE;
 
     /// Returns the variable index that can be used to access the variable.
+
+    /// \remark The index of a mutable or dynamic variable is the same in all shader resource
+    ///         bindings created by the same pipeline state, so it can be cached by the application
+    ///         and used with IShaderResourceBinding::GetVariableByIndex().
     VIRTUAL Uint32 METHOD(GetIndex)(THIS) CONST PURE;
 
     /// Returns true if non-null resource is bound to this variable.
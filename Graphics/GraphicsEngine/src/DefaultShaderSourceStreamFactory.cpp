@@ -31,6 +31,7 @@
 #include "RefCntAutoPtr.hpp"
 #include "EngineMemory.h"
 #include "BasicFileStream.hpp"
+#include "MappedFileStream.hpp"
 
 namespace Diligent
 {
@@ -49,6 +50,10 @@ public:
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, ObjectBase<IShaderSourceInputStreamFactory>);
 
 private:
+    // For smaller files, the cost of mapping and unmapping the file is higher than the cost
+    // of reading it into memory
+    static constexpr size_t MinMappedFileSize = 64 << 10;
+
     std::vector<String> m_SearchDirectories;
 };
 
@@ -90,27 +95,41 @@ void DefaultShaderSourceStreamFactory::CreateInputStream2(const Char*
                                                           CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
                                                           IFileStream**                           ppStream)
 {
-    bool                                     bFileCreated = false;
-    Diligent::RefCntAutoPtr<BasicFileStream> pBasicFileStream;
+    bool                                 bFileCreated = false;
+    Diligent::RefCntAutoPtr<IFileStream> pFileStream;
     for (const auto& SearchDir : m_SearchDirectories)
     {
         String FullPath = SearchDir + ((Name[0] == '\\' || Name[0] == '/') ? Name + 1 : Name);
         if (!FileSystem::FileExists(FullPath.c_str()))
             continue;
-        pBasicFileStream = MakeNewRCObj<BasicFileStream>()(FullPath.c_str(), EFileAccessMode::Read);
-        if (pBasicFileStream->IsValid())
+
+        // Memory-mapped stream lets the shader compilers consume the file data without
+        // copying it (see ReadStreamData()). Use the basic stream if the file is small,
+        // mapping is not supported on this platform or fails.
+        size_t FileSize = 0;
+        if (MappedFileStream::GetMappableFileSize(FullPath.c_str(), FileSize) && FileSize >= MinMappedFileSize)
+        {
+            pFileStream = MakeNewRCObj<MappedFileStream>()(FullPath.c_str(), EFileAccessHint::Sequential);
+            if (!pFileStream->IsValid())
+                pFileStream.Release();
+        }
+
+        if (!pFileStream)
+            pFileStream = MakeNewRCObj<BasicFileStream>()(FullPath.c_str(), EFileAccessMode::Read);
+
+        if (pFileStream->IsValid())
         {
             bFileCreated = true;
             break;
         }
         else
         {
-            pBasicFileStream.Release();
+            pFileStream.Release();
         }
     }
     if (bFileCreated)
     {
-        pBasicFileStream->QueryInterface(IID_FileStream, reinterpret_cast<IObject**>(ppStream));
+        *ppStream = pFileStream.Detach();
     }
     else
     {
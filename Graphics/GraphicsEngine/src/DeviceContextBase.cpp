@@ -80,6 +80,31 @@ bool VerifyDrawIndexedAttribs(const DrawIndexedAttribs& Attribs)
     return true;
 }
 
+bool VerifyMultiDrawAttribs(const MultiDrawAttribs& Attribs)
+{
+#define CHECK_MULTI_DRAW_ATTRIBS(Expr, ...) CHECK_PARAMETER(Expr, "Multi-draw attribs are invalid: ", __VA_ARGS__)
+
+    CHECK_MULTI_DRAW_ATTRIBS(Attribs.DrawCount == 0 || Attribs.pDrawItems != nullptr, "pDrawItems must not be null when DrawCount (", Attribs.DrawCount, ") is not zero.");
+
+#undef CHECK_MULTI_DRAW_ATTRIBS
+
+    return true;
+}
+
+bool VerifyMultiDrawIndexedAttribs(const MultiDrawIndexedAttribs& Attribs)
+{
+#define CHECK_MULTI_DRAW_INDEXED_ATTRIBS(Expr, ...) CHECK_PARAMETER(Expr, "Multi-draw indexed attribs are invalid: ", __VA_ARGS__)
+
+    CHECK_MULTI_DRAW_INDEXED_ATTRIBS(Attribs.IndexType == VT_UINT16 || Attribs.IndexType == VT_UINT32,
+                                     "IndexType (", GetValueTypeString(Attribs.IndexType), ") must be VT_UINT16 or VT_UINT32.");
+
+    CHECK_MULTI_DRAW_INDEXED_ATTRIBS(Attribs.DrawCount == 0 || Attribs.pDrawItems != nullptr, "pDrawItems must not be null when DrawCount (", Attribs.DrawCount, ") is not zero.");
+
+#undef CHECK_MULTI_DRAW_INDEXED_ATTRIBS
+
+    return true;
+}
+
 bool VerifyDrawMeshAttribs(Uint32 MaxDrawMeshTasksCount, const DrawMeshAttribs& Attribs)
 {
 #define CHECK_DRAW_MESH_ATTRIBS(Expr, ...) CHECK_PARAMETER(Expr, "Draw mesh attribs are invalid: ", __VA_ARGS__)
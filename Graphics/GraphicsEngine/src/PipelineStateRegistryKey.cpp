@@ -0,0 +1,241 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "PipelineStateRegistryKey.hpp"
+
+#include "RenderDeviceBase.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+void PipelineStateRegistryKey::InitCommon(const PipelineStateCreateInfo& CreateInfo)
+{
+    const auto& PSODesc = CreateInfo.PSODesc;
+    const auto& ResLayout = PSODesc.ResourceLayout;
+
+    m_Name                     = PSODesc.Name != nullptr ? PSODesc.Name : "";
+    Name                       = m_Name.c_str();
+    m_PipelineType             = PSODesc.PipelineType;
+    m_Flags                    = CreateInfo.Flags;
+    m_SRBAllocationGranularity = PSODesc.SRBAllocationGranularity;
+    m_CommandQueueMask         = PSODesc.CommandQueueMask;
+    m_DefaultVariableType      = ResLayout.DefaultVariableType;
+
+    m_Hash = Diligent::ComputeHash(m_Name,
+                                   static_cast<int>(m_PipelineType),
+                                   static_cast<Uint32>(m_Flags),
+                                   m_SRBAllocationGranularity,
+                                   m_CommandQueueMask,
+                                   static_cast<int>(m_DefaultVariableType));
+
+    m_Variables.reserve(ResLayout.NumVariables);
+    for (Uint32 i = 0; i < ResLayout.NumVariables; ++i)
+    {
+        const auto& Var = ResLayout.Variables[i];
+        m_Variables.emplace_back(VariableDesc{Var.ShaderStages, Var.Name != nullptr ? Var.Name : "", Var.Type});
+        HashCombine(m_Hash, static_cast<Uint32>(Var.ShaderStages), m_Variables.back().Name, static_cast<int>(Var.Type));
+    }
+
+    m_ImtblSamplers.reserve(ResLayout.NumImmutableSamplers);
+    for (Uint32 i = 0; i < ResLayout.NumImmutableSamplers; ++i)
+    {
+        const auto& ImtblSam = ResLayout.ImmutableSamplers[i];
+        m_ImtblSamplers.emplace_back(ImtblSamplerDesc{ImtblSam.ShaderStages, ImtblSam.SamplerOrTextureName != nullptr ? ImtblSam.SamplerOrTextureName : "", ImtblSam.Desc});
+        // Sampler name is ignored by SamplerDesc::operator== and must not be kept
+        m_ImtblSamplers.back().Desc.Name = nullptr;
+        HashCombine(m_Hash, static_cast<Uint32>(ImtblSam.ShaderStages), m_ImtblSamplers.back().SamplerOrTextureName, ImtblSam.Desc);
+    }
+}
+
+void PipelineStateRegistryKey::AddShader(IShader* pShader, ShaderHashGetter GetShaderHash)
+{
+    const size_t ShaderHash = pShader != nullptr ? GetShaderHash(pShader) : 0;
+    HashCombine(m_Hash, ShaderHash);
+    m_Shaders.emplace_back(pShader);
+    m_ShaderHashes.emplace_back(ShaderHash);
+}
+
+PipelineStateRegistryKey::PipelineStateRegistryKey(const GraphicsPipelineStateCreateInfo& CreateInfo, ShaderHashGetter GetShaderHash, ShaderContentComparator CompareShaders) :
+    m_CompareShaders{CompareShaders}
+{
+    InitCommon(CreateInfo);
+
+    m_GraphicsPipeline = CreateInfo.GraphicsPipeline;
+
+    const auto& InputLayout = m_GraphicsPipeline.InputLayout;
+    m_LayoutElements.reserve(InputLayout.NumElements);
+    m_LayoutSemantics.reserve(InputLayout.NumElements);
+    for (Uint32 i = 0; i < InputLayout.NumElements; ++i)
+    {
+        m_LayoutElements.emplace_back(InputLayout.LayoutElements[i]);
+        auto& Elem = m_LayoutElements.back();
+        m_LayoutSemantics.emplace_back(Elem.HLSLSemantic != nullptr ? Elem.HLSLSemantic : "");
+        // Semantics are compared through m_LayoutSemantics
+        Elem.HLSLSemantic = "";
+        HashCombine(m_Hash, m_LayoutSemantics.back(), Elem.InputIndex, Elem.BufferSlot, Elem.NumComponents,
+                    static_cast<int>(Elem.ValueType), Elem.IsNormalized, Elem.RelativeOffset, Elem.Stride,
+                    static_cast<int>(Elem.Frequency), Elem.InstanceDataStepRate);
+    }
+    m_GraphicsPipeline.InputLayout = InputLayoutDesc{};
+
+    m_wpRenderPass = CreateInfo.GraphicsPipeline.pRenderPass;
+    m_GraphicsPipeline.pRenderPass = nullptr;
+
+    const auto& GrPipeline = m_GraphicsPipeline;
+    HashCombine(m_Hash, GrPipeline.BlendDesc, GrPipeline.SampleMask, GrPipeline.RasterizerDesc, GrPipeline.DepthStencilDesc,
+                static_cast<int>(GrPipeline.PrimitiveTopology), GrPipeline.NumViewports, GrPipeline.NumRenderTargets,
+                GrPipeline.SubpassIndex, static_cast<int>(GrPipeline.DSVFormat), GrPipeline.SmplDesc.Count,
+                GrPipeline.SmplDesc.Quality, GrPipeline.NodeMask,
+                static_cast<const void*>(CreateInfo.GraphicsPipeline.pRenderPass));
+    for (Uint32 rt = 0; rt < GrPipeline.NumRenderTargets; ++rt)
+        HashCombine(m_Hash, static_cast<int>(GrPipeline.RTVFormats[rt]));
+
+    m_Shaders.reserve(7);
+    m_ShaderHashes.reserve(7);
+    AddShader(CreateInfo.pVS, GetShaderHash);
+    AddShader(CreateInfo.pPS, GetShaderHash);
+    AddShader(CreateInfo.pDS, GetShaderHash);
+    AddShader(CreateInfo.pHS, GetShaderHash);
+    AddShader(CreateInfo.pGS, GetShaderHash);
+    AddShader(CreateInfo.pAS, GetShaderHash);
+    AddShader(CreateInfo.pMS, GetShaderHash);
+}
+
+PipelineStateRegistryKey::PipelineStateRegistryKey(const ComputePipelineStateCreateInfo& CreateInfo, ShaderHashGetter GetShaderHash, ShaderContentComparator CompareShaders) :
+    m_CompareShaders{CompareShaders}
+{
+    InitCommon(CreateInfo);
+    AddShader(CreateInfo.pCS, GetShaderHash);
+}
+
+PipelineStateRegistryKey::PipelineStateRegistryKey(const PipelineStateRegistryKey& Key) :
+    // clang-format off
+    m_Name                    {Key.m_Name                    },
+    m_PipelineType            {Key.m_PipelineType            },
+    m_Flags                   {Key.m_Flags                   },
+    m_SRBAllocationGranularity{Key.m_SRBAllocationGranularity},
+    m_CommandQueueMask        {Key.m_CommandQueueMask        },
+    m_DefaultVariableType     {Key.m_DefaultVariableType     },
+    m_Variables               (Key.m_Variables               ),
+    m_ImtblSamplers           (Key.m_ImtblSamplers           ),
+    m_GraphicsPipeline        (Key.m_GraphicsPipeline        ),
+    m_LayoutElements          (Key.m_LayoutElements          ),
+    m_LayoutSemantics         (Key.m_LayoutSemantics         ),
+    m_wpRenderPass            {Key.m_wpRenderPass            },
+    m_Shaders                 (Key.m_Shaders                 ),
+    m_ShaderHashes            (Key.m_ShaderHashes            ),
+    m_CompareShaders          {Key.m_CompareShaders          },
+    m_Hash                    {Key.m_Hash                    }
+// clang-format on
+{
+    Name = m_Name.c_str();
+}
+
+PipelineStateRegistryKey::PipelineStateRegistryKey(PipelineStateRegistryKey&& Key) :
+    // clang-format off
+    m_Name                    {std::move(Key.m_Name)           },
+    m_PipelineType            {Key.m_PipelineType              },
+    m_Flags                   {Key.m_Flags                     },
+    m_SRBAllocationGranularity{Key.m_SRBAllocationGranularity  },
+    m_CommandQueueMask        {Key.m_CommandQueueMask          },
+    m_DefaultVariableType     {Key.m_DefaultVariableType       },
+    m_Variables               (std::move(Key.m_Variables)      ),
+    m_ImtblSamplers           (std::move(Key.m_ImtblSamplers)  ),
+    m_GraphicsPipeline        (Key.m_GraphicsPipeline          ),
+    m_LayoutElements          (std::move(Key.m_LayoutElements) ),
+    m_LayoutSemantics         (std::move(Key.m_LayoutSemantics)),
+    m_wpRenderPass            {std::move(Key.m_wpRenderPass)   },
+    m_Shaders                 (std::move(Key.m_Shaders)        ),
+    m_ShaderHashes            (std::move(Key.m_ShaderHashes)   ),
+    m_CompareShaders          {Key.m_CompareShaders            },
+    m_Hash                    {Key.m_Hash                      }
+// clang-format on
+{
+    Name     = m_Name.c_str();
+    Key.Name = Key.m_Name.c_str();
+}
+
+bool PipelineStateRegistryKey::operator==(const PipelineStateRegistryKey& Key) const
+{
+    if (m_Hash != Key.m_Hash)
+        return false;
+
+    // clang-format off
+    if (m_PipelineType             != Key.m_PipelineType             ||
+        m_Flags                    != Key.m_Flags                    ||
+        m_SRBAllocationGranularity != Key.m_SRBAllocationGranularity ||
+        m_CommandQueueMask         != Key.m_CommandQueueMask         ||
+        m_DefaultVariableType      != Key.m_DefaultVariableType      ||
+        m_ShaderHashes             != Key.m_ShaderHashes             ||
+        m_Name                     != Key.m_Name                     ||
+        m_wpRenderPass             != Key.m_wpRenderPass             ||
+        m_Variables                != Key.m_Variables                ||
+        m_ImtblSamplers            != Key.m_ImtblSamplers            ||
+        m_LayoutSemantics          != Key.m_LayoutSemantics          ||
+        m_LayoutElements           != Key.m_LayoutElements)
+        return false;
+
+    const auto& GrPipeline0 = m_GraphicsPipeline;
+    const auto& GrPipeline1 = Key.m_GraphicsPipeline;
+    if (!(GrPipeline0.BlendDesc        == GrPipeline1.BlendDesc)        ||
+          GrPipeline0.SampleMask       != GrPipeline1.SampleMask        ||
+        !(GrPipeline0.RasterizerDesc   == GrPipeline1.RasterizerDesc)   ||
+        !(GrPipeline0.DepthStencilDesc == GrPipeline1.DepthStencilDesc) ||
+          GrPipeline0.PrimitiveTopology!= GrPipeline1.PrimitiveTopology ||
+          GrPipeline0.NumViewports     != GrPipeline1.NumViewports      ||
+          GrPipeline0.NumRenderTargets != GrPipeline1.NumRenderTargets  ||
+          GrPipeline0.SubpassIndex     != GrPipeline1.SubpassIndex      ||
+          GrPipeline0.DSVFormat        != GrPipeline1.DSVFormat         ||
+          GrPipeline0.SmplDesc.Count   != GrPipeline1.SmplDesc.Count    ||
+          GrPipeline0.SmplDesc.Quality != GrPipeline1.SmplDesc.Quality  ||
+          GrPipeline0.NodeMask         != GrPipeline1.NodeMask)
+        return false;
+    // clang-format on
+
+    for (Uint32 rt = 0; rt < GrPipeline0.NumRenderTargets; ++rt)
+    {
+        if (GrPipeline0.RTVFormats[rt] != GrPipeline1.RTVFormats[rt])
+            return false;
+    }
+
+    // Shaders with equal hashes may still be different
+    VERIFY_EXPR(m_Shaders.size() == Key.m_Shaders.size());
+    for (size_t i = 0; i < m_Shaders.size(); ++i)
+    {
+        auto* pShader0 = m_Shaders[i].RawPtr<IShader>();
+        auto* pShader1 = Key.m_Shaders[i].RawPtr<IShader>();
+        if (pShader0 == pShader1)
+            continue;
+        if (pShader0 == nullptr || pShader1 == nullptr || !m_CompareShaders(pShader0, pShader1))
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace Diligent
@@ -30,6 +30,7 @@
 /// \file
 /// Declaration of Diligent::FenceD3D11Impl class
 
+#include <algorithm>
 #include <deque>
 #include "FenceD3D11.h"
 #include "RenderDeviceD3D11.h"
@@ -67,6 +68,14 @@ public:
 
     void Wait(Uint64 Value, bool FlushCommands);
 
+    /// Returns the largest value the fence has been signaled with
+    Uint64 GetLastSignaledValue() const
+    {
+        return m_PendingQueries.empty() ?
+            m_LastCompletedFenceValue :
+            std::max(Uint64{m_LastCompletedFenceValue}, m_PendingQueries.back().Value);
+    }
+
 private:
     struct PendingFenceData
     {
@@ -37,13 +37,14 @@
 #include "STDAllocator.hpp"
 #include "ShaderVariableD3DBase.hpp"
 #include "ShaderResourcesD3D11.hpp"
+#include "ShaderVariableNameIndex.hpp"
 
 namespace Diligent
 {
 
 /// Diligent::ShaderResourceLayoutD3D11 class
 /// http://diligentgraphics.com/diligent-engine/architecture/d3d11/shader-resource-layout/
-// sizeof(ShaderResourceLayoutD3D11) == 64 (x64)
+// sizeof(ShaderResourceLayoutD3D11) == 80 (x64)
 class ShaderResourceLayoutD3D11
 {
 public:
@@ -326,8 +327,11 @@ private:
 /*54*/ OffsetType m_BuffUAVsOffset = 0;
 /*56*/ OffsetType m_SamplerOffset  = 0;
 /*58*/ OffsetType m_MemorySize     = 0;
-/*60 - 64*/    
-/*64*/ // End of data
+/*60 - 64*/
+
+       // Name index that is allocated in m_ResourceBuffer after the resources
+/*64*/ ShaderVariableNameIndex m_NameIndex;
+/*80*/ // End of data
 
 
     template<typename ResourceType> OffsetType GetResourceOffset()const;
@@ -356,8 +360,7 @@ private:
         return reinterpret_cast<const ResourceType*>(reinterpret_cast<const Uint8*>(m_ResourceBuffer.get()) + Offset)[ResIndex];
     }
 
-    template <typename ResourceType>
-    IShaderResourceVariable* GetResourceByName(const Char* Name);
+    const Char* GetVariableName(Uint32 Index) const;
 
     template <typename THandleCB,
               typename THandleTexSRV,
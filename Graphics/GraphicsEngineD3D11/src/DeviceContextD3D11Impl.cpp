@@ -860,6 +860,46 @@ void DeviceContextD3D11Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
         m_pd3d11DeviceContext->DrawIndexed(Attribs.NumIndices, Attribs.FirstIndexLocation, Attribs.BaseVertex);
 }
 
+void DeviceContextD3D11Impl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawArguments(Attribs))
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (Item.NumInstances > 1 || Item.FirstInstanceLocation != 0)
+            m_pd3d11DeviceContext->DrawInstanced(Item.NumVertices, Item.NumInstances, Item.StartVertexLocation, Item.FirstInstanceLocation);
+        else
+            m_pd3d11DeviceContext->Draw(Item.NumVertices, Item.StartVertexLocation);
+    }
+}
+
+void DeviceContextD3D11Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawIndexedArguments(Attribs))
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        if (Item.NumInstances > 1 || Item.FirstInstanceLocation != 0)
+            m_pd3d11DeviceContext->DrawIndexedInstanced(Item.NumIndices, Item.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Item.FirstInstanceLocation);
+        else
+            m_pd3d11DeviceContext->DrawIndexed(Item.NumIndices, Item.FirstIndexLocation, Item.BaseVertex);
+    }
+}
+
 void DeviceContextD3D11Impl::DrawIndirect(const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
     if (!DvpVerifyDrawIndirectArguments(Attribs, pAttribsBuffer))
@@ -2006,6 +2046,16 @@ void DeviceContextD3D11Impl::WaitForFence(IFence* pFence, Uint64 Value, bool Flu
     pFenceD3D11Impl->Wait(Value, FlushContext);
 }
 
+void DeviceContextD3D11Impl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    VERIFY(!m_bIsDeferred, "Fence can only be waited from immediate context");
+    // Direct3D11 has a single queue that executes all commands in order, so the commands that follow
+    // the wait are executed after the fence is signaled as long as the signal command has been recorded.
+    auto* pFenceD3D11Impl = ValidatedCast<FenceD3D11Impl>(pFence);
+    DEV_CHECK_ERR(pFenceD3D11Impl->GetLastSignaledValue() >= Value, "Fence '", pFenceD3D11Impl->GetDesc().Name, "' has not been signaled with value ", Value,
+                  ". The wait can never complete and would deadlock the GPU in backends that use multiple queues.");
+}
+
 void DeviceContextD3D11Impl::WaitForIdle()
 {
     VERIFY(!m_bIsDeferred, "Only immediate contexts can be idled");
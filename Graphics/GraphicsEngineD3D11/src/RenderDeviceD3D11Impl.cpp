@@ -87,6 +87,7 @@ RenderDeviceD3D11Impl::RenderDeviceD3D11Impl(IReferenceCounters*          pRefCo
         pRefCounters,
         RawMemAllocator,
         pEngineFactory,
+        EngineAttribs,
         NumDeferredContexts,
         DeviceObjectSizes
         {
@@ -397,9 +398,13 @@ void RenderDeviceD3D11Impl::CreatePipelineState(const PSOCreateInfoType& PSOCrea
     CreateDeviceObject("Pipeline state", PSOCreateInfo.PSODesc, ppPipelineState,
                        [&]() //
                        {
-                           PipelineStateD3D11Impl* pPipelineStateD3D11{NEW_RC_OBJ(m_PSOAllocator, "PipelineStateD3D11Impl instance", PipelineStateD3D11Impl)(this, PSOCreateInfo)};
-                           pPipelineStateD3D11->QueryInterface(IID_PipelineState, reinterpret_cast<IObject**>(ppPipelineState));
-                           OnCreateDeviceObject(pPipelineStateD3D11);
+                           FindOrCreatePipelineState<ShaderD3D11Impl>(PSOCreateInfo, ppPipelineState,
+                                                                      [&]() //
+                                                                      {
+                                                                          PipelineStateD3D11Impl* pPipelineStateD3D11{NEW_RC_OBJ(m_PSOAllocator, "PipelineStateD3D11Impl instance", PipelineStateD3D11Impl)(this, PSOCreateInfo)};
+                                                                          pPipelineStateD3D11->QueryInterface(IID_PipelineState, reinterpret_cast<IObject**>(ppPipelineState));
+                                                                          OnCreateDeviceObject(pPipelineStateD3D11);
+                                                                      });
                        });
 }
 
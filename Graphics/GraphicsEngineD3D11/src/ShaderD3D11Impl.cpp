@@ -141,6 +141,8 @@ ShaderD3D11Impl::ShaderD3D11Impl(IReferenceCounters*     pRefCounters,
     auto* pResources = new (pRawMem) ShaderResourcesD3D11(pRenderDeviceD3D11, m_pShaderByteCode, m_Desc, ShaderCI.UseCombinedTextureSamplers ? ShaderCI.CombinedSamplerSuffix : nullptr);
     m_pShaderResources.reset(pResources, STDDeleterRawMem<ShaderResourcesD3D11>(Allocator));
 
+    InitContent(ShaderCI, m_pShaderByteCode->GetBufferPointer(), m_pShaderByteCode->GetBufferSize());
+
     // Byte code is only required for the vertex shader to create input layout
     if (ShaderCI.Desc.ShaderType != SHADER_TYPE_VERTEX)
         m_pShaderByteCode.Release();
@@ -38,6 +38,7 @@
 #include "SamplerD3D11Impl.hpp"
 #include "ShaderD3D11Impl.hpp"
 #include "ShaderResourceVariableBase.hpp"
+#include "Align.hpp"
 
 namespace Diligent
 {
@@ -97,7 +98,16 @@ size_t ShaderResourceLayoutD3D11::GetRequiredMemorySize(const ShaderResourcesD3D
                    ResCounters.NumBufUAVs  * sizeof(BuffUAVBindInfo)   +
                    ResCounters.NumSamplers * sizeof(SamplerBindInfo);
     // clang-format on
-    return MemSize;
+    if (MemSize == 0)
+        return 0;
+
+    auto NumVariables = ResCounters.NumCBs + ResCounters.NumTexSRVs + ResCounters.NumTexUAVs + ResCounters.NumBufSRVs + ResCounters.NumBufUAVs;
+    // Sampler variables are not exposed when using combined texture samplers
+    if (!SrcResources.IsUsingCombinedTextureSamplers())
+        NumVariables += ResCounters.NumSamplers;
+
+    // The name index is placed after the resources
+    return Align(MemSize, ShaderVariableNameIndex::GetRequiredAlignment()) + ShaderVariableNameIndex::GetRequiredMemorySize(NumVariables);
 }
 
 
@@ -141,11 +151,11 @@ void ShaderResourceLayoutD3D11::Initialize(std::shared_ptr<const ShaderResources
     m_MemorySize     = AdvanceOffset(0);
     // clang-format on
 
-    VERIFY_EXPR(m_MemorySize == GetRequiredMemorySize(*m_pResources, ResourceLayout, VarTypes, NumVarTypes));
-
     if (m_MemorySize)
     {
-        auto* pRawMem    = ALLOCATE_RAW(ResLayoutDataAllocator, "Raw memory buffer for shader resource layout resources", m_MemorySize);
+        const auto BufferSize = GetRequiredMemorySize(*m_pResources, ResourceLayout, VarTypes, NumVarTypes);
+        VERIFY_EXPR(BufferSize >= m_MemorySize);
+        auto* pRawMem    = ALLOCATE_RAW(ResLayoutDataAllocator, "Raw memory buffer for shader resource layout resources", BufferSize);
         m_ResourceBuffer = std::unique_ptr<void, STDDeleterRawMem<void>>(pRawMem, ResLayoutDataAllocator);
     }
 
@@ -308,6 +318,16 @@ void ShaderResourceLayoutD3D11::Initialize(std::shared_ptr<const ShaderResources
     VERIFY(sam    == GetNumSamplers(), "Not all samplers are initialized which will cause a crash when dtor is called");
     // clang-format on
 
+    if (m_ResourceBuffer)
+    {
+        auto* pNameIndexMem = Align(reinterpret_cast<Uint8*>(m_ResourceBuffer.get()) + m_MemorySize, ShaderVariableNameIndex::GetRequiredAlignment());
+        m_NameIndex.Initialize(pNameIndexMem, GetTotalResourceCount(),
+                               [this](Uint32 VarIdx) //
+                               {
+                                   return GetVariableName(VarIdx);
+                               });
+    }
+
     // Shader resource cache in the SRB is initialized by the constructor of ShaderResourceBindingD3D11Impl to
     // hold all variable types. The corresponding layout in the SRB is initialized to keep mutable and dynamic
     // variables only
@@ -704,45 +724,41 @@ void ShaderResourceLayoutD3D11::BindResources(IResourceMapping*               pR
     // clang-format on
 }
 
-template <typename ResourceType>
-IShaderResourceVariable* ShaderResourceLayoutD3D11::GetResourceByName(const Char* Name)
+const Char* ShaderResourceLayoutD3D11::GetVariableName(Uint32 Index) const
 {
-    auto NumResources = GetNumResources<ResourceType>();
-    for (Uint32 res = 0; res < NumResources; ++res)
-    {
-        auto& Resource = GetResource<ResourceType>(res);
-        if (strcmp(Resource.m_Attribs.Name, Name) == 0)
-            return &Resource;
-    }
+    // Variables are enumerated in the same order as in GetShaderVariable(Uint32 Index)
+    if (Index < GetNumCBs())
+        return GetConstResource<ConstBuffBindInfo>(Index).m_Attribs.Name;
+    Index -= GetNumCBs();
 
-    return nullptr;
-}
+    if (Index < GetNumTexSRVs())
+        return GetConstResource<TexSRVBindInfo>(Index).m_Attribs.Name;
+    Index -= GetNumTexSRVs();
 
-IShaderResourceVariable* ShaderResourceLayoutD3D11::GetShaderVariable(const Char* Name)
-{
-    if (auto* pCB = GetResourceByName<ConstBuffBindInfo>(Name))
-        return pCB;
+    if (Index < GetNumTexUAVs())
+        return GetConstResource<TexUAVBindInfo>(Index).m_Attribs.Name;
+    Index -= GetNumTexUAVs();
 
-    if (auto* pTexSRV = GetResourceByName<TexSRVBindInfo>(Name))
-        return pTexSRV;
+    if (Index < GetNumBufSRVs())
+        return GetConstResource<BuffSRVBindInfo>(Index).m_Attribs.Name;
+    Index -= GetNumBufSRVs();
 
-    if (auto* pTexUAV = GetResourceByName<TexUAVBindInfo>(Name))
-        return pTexUAV;
-
-    if (auto* pBuffSRV = GetResourceByName<BuffSRVBindInfo>(Name))
-        return pBuffSRV;
+    if (Index < GetNumBufUAVs())
+        return GetConstResource<BuffUAVBindInfo>(Index).m_Attribs.Name;
+    Index -= GetNumBufUAVs();
 
-    if (auto* pBuffUAV = GetResourceByName<BuffUAVBindInfo>(Name))
-        return pBuffUAV;
-
-    if (!m_pResources->IsUsingCombinedTextureSamplers())
-    {
-        // Immutable samplers are never created in the resource layout
-        if (auto* pSampler = GetResourceByName<SamplerBindInfo>(Name))
-            return pSampler;
-    }
+    VERIFY(!m_pResources->IsUsingCombinedTextureSamplers(), "Sampler variables are not exposed when using combined texture samplers");
+    return GetConstResource<SamplerBindInfo>(Index).m_Attribs.Name;
+}
 
-    return nullptr;
+IShaderResourceVariable* ShaderResourceLayoutD3D11::GetShaderVariable(const Char* Name)
+{
+    const auto VarIdx = m_NameIndex.Find(Name,
+                                         [this](Uint32 Idx) //
+                                         {
+                                             return GetVariableName(Idx);
+                                         });
+    return VarIdx != ShaderVariableNameIndex::InvalidIndex ? GetShaderVariable(VarIdx) : nullptr;
 }
 
 class ShaderVariableIndexLocator
@@ -143,6 +143,10 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw               (const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed        (const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw          (const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed   (const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in Direct3D12 backend.
@@ -244,6 +248,9 @@ public:
     /// Implementation of IDeviceContext::WaitForFence() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE WaitForFence(IFence* pFence, Uint64 Value, bool FlushContext) override final;
 
+    /// Implementation of IDeviceContext::DeviceWaitForFence() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE DeviceWaitForFence(IFence* pFence, Uint64 Value) override final;
+
     /// Implementation of IDeviceContext::WaitForIdle() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE WaitForIdle() override final;
 
@@ -66,13 +66,14 @@
 #include "ShaderResourceVariableD3D.h"
 #include "ShaderResourceLayoutD3D12.hpp"
 #include "ShaderResourceVariableBase.hpp"
+#include "ShaderVariableNameIndex.hpp"
 
 namespace Diligent
 {
 
 class ShaderVariableD3D12Impl;
 
-// sizeof(ShaderVariableManagerD3D12) == 32 (x64, msvc, Release)
+// sizeof(ShaderVariableManagerD3D12) == 48 (x64, msvc, Release)
 class ShaderVariableManagerD3D12
 {
 public:
@@ -123,6 +124,9 @@ private:
     ShaderVariableD3D12Impl*         m_pVariables     = nullptr;
     Uint32                           m_NumVariables = 0;
 
+    // Name index that is allocated in the same memory block after the variables
+    ShaderVariableNameIndex          m_NameIndex;
+
 #ifdef DILIGENT_DEBUG
     IMemoryAllocator*                m_pDbgAllocator = nullptr;
 #endif
@@ -529,6 +529,42 @@ void DeviceContextD3D12Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     ++m_State.NumCommands;
 }
 
+void DeviceContextD3D12Impl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawArguments(Attribs))
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    auto& GraphCtx = GetCmdContext().AsGraphicsContext();
+    PrepareForDraw(GraphCtx, Attribs.Flags);
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        GraphCtx.Draw(Item.NumVertices, Item.NumInstances, Item.StartVertexLocation, Item.FirstInstanceLocation);
+    }
+    m_State.NumCommands += Attribs.DrawCount;
+}
+
+void DeviceContextD3D12Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawIndexedArguments(Attribs))
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    auto& GraphCtx = GetCmdContext().AsGraphicsContext();
+    PrepareForIndexedDraw(GraphCtx, Attribs.Flags, Attribs.IndexType);
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        const auto& Item = Attribs.pDrawItems[i];
+        GraphCtx.DrawIndexed(Item.NumIndices, Item.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Item.FirstInstanceLocation);
+    }
+    m_State.NumCommands += Attribs.DrawCount;
+}
+
 void DeviceContextD3D12Impl::PrepareDrawIndirectBuffer(GraphicsContext&               GraphCtx,
                                                        IBuffer*                       pAttribsBuffer,
                                                        RESOURCE_STATE_TRANSITION_MODE BufferStateTransitionMode,
@@ -1876,18 +1912,15 @@ void DeviceContextD3D12Impl::UpdateTextureRegion(const void*
 #endif
     const auto AlignedOffset = UploadSpace.AlignedOffset;
 
-    for (Uint32 DepthSlice = 0; DepthSlice < UpdateRegionDepth; ++DepthSlice)
-    {
-        for (Uint32 row = 0; row < UploadSpace.RowCount; ++row)
-        {
-            const auto* pSrcPtr =
-                reinterpret_cast<const Uint8*>(pSrcData) + row * SrcStride + DepthSlice * SrcDepthStride;
-            auto* pDstPtr =
-                reinterpret_cast<Uint8*>(UploadSpace.Allocation.CPUAddress) + (AlignedOffset - UploadSpace.Allocation.Offset) + row * UploadSpace.Stride + DepthSlice * UploadSpace.DepthStride;
-
-            memcpy(pDstPtr, pSrcPtr, UploadSpace.RowSize);
-        }
-    }
+    CopyTextureSubresource(TextureSubResData{pSrcData, SrcStride, SrcDepthStride},
+                           UploadSpace.RowCount,
+                           UpdateRegionDepth,
+                           UploadSpace.RowSize,
+                           reinterpret_cast<Uint8*>(UploadSpace.Allocation.CPUAddress) + (AlignedOffset - UploadSpace.Allocation.Offset),
+                           UploadSpace.Stride,
+                           UploadSpace.DepthStride,
+                           COPY_TEXTURE_SUBRESOURCE_FLAG_WRITE_COMBINED,
+                           m_pDevice->GetTextureCopyThreadPool(size_t{UploadSpace.DepthStride} * UpdateRegionDepth));
     CopyTextureRegion(UploadSpace.Allocation.pBuffer,
                       static_cast<Uint32>(AlignedOffset),
                       UploadSpace.Stride,
@@ -2104,6 +2137,25 @@ void DeviceContextD3D12Impl::WaitForFence(IFence* pFence, Uint64 Value, bool Flu
     pFenceD3D12->WaitForCompletion(Value);
 }
 
+void DeviceContextD3D12Impl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    DEV_CHECK_ERR(!m_bIsDeferred, "Fence can only be waited from immediate context");
+    DEV_CHECK_ERR(pFence != nullptr, "Fence must not be null");
+
+    // The wait is inserted into the queue right away, so all command lists
+    // submitted to the queue after this point will wait for the fence
+    auto* pd3d12Fence = ValidatedCast<FenceD3D12Impl>(pFence)->GetD3D12Fence();
+    m_pDevice->LockCmdQueueAndRun(
+        m_CommandQueueId,
+        [&](ICommandQueueD3D12* pCmdQueue) //
+        {
+            auto hr = pCmdQueue->GetD3D12CommandQueue()->Wait(pd3d12Fence, Value);
+            DEV_CHECK_ERR(SUCCEEDED(hr), "Failed to insert fence wait into the command queue");
+            (void)hr;
+        } //
+    );
+}
+
 void DeviceContextD3D12Impl::WaitForIdle()
 {
     DEV_CHECK_ERR(!m_bIsDeferred, "Only immediate contexts can be idled");
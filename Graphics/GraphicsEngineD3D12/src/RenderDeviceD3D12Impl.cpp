@@ -122,6 +122,7 @@ RenderDeviceD3D12Impl::RenderDeviceD3D12Impl(IReferenceCounters*          pRefCo
         pRefCounters,
         RawMemAllocator,
         pEngineFactory,
+        EngineCI,
         CommandQueueCount,
         ppCmdQueues,
         EngineCI.NumDeferredContexts,
@@ -594,9 +595,13 @@ void RenderDeviceD3D12Impl::CreatePipelineState(const PSOCreateInfoType& PSOCrea
     CreateDeviceObject("Pipeline State", PSOCreateInfo.PSODesc, ppPipelineState,
                        [&]() //
                        {
-                           PipelineStateD3D12Impl* pPipelineStateD3D12{NEW_RC_OBJ(m_PSOAllocator, "PipelineStateD3D12Impl instance", PipelineStateD3D12Impl)(this, PSOCreateInfo)};
-                           pPipelineStateD3D12->QueryInterface(IID_PipelineState, reinterpret_cast<IObject**>(ppPipelineState));
-                           OnCreateDeviceObject(pPipelineStateD3D12);
+                           FindOrCreatePipelineState<ShaderD3D12Impl>(PSOCreateInfo, ppPipelineState,
+                                                                      [&]() //
+                                                                      {
+                                                                          PipelineStateD3D12Impl* pPipelineStateD3D12{NEW_RC_OBJ(m_PSOAllocator, "PipelineStateD3D12Impl instance", PipelineStateD3D12Impl)(this, PSOCreateInfo)};
+                                                                          pPipelineStateD3D12->QueryInterface(IID_PipelineState, reinterpret_cast<IObject**>(ppPipelineState));
+                                                                          OnCreateDeviceObject(pPipelineStateD3D12);
+                                                                      });
                        });
 }
 
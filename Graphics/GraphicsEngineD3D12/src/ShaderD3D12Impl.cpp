@@ -109,6 +109,8 @@ ShaderD3D12Impl::ShaderD3D12Impl(IReferenceCounters*     pRefCounters,
             pRenderDeviceD3D12->GetDxCompiler() //
         };
     m_pShaderResources.reset(pResources, STDDeleterRawMem<ShaderResourcesD3D12>(Allocator));
+
+    InitContent(ShaderCI, m_pShaderByteCode->GetBufferPointer(), m_pShaderByteCode->GetBufferSize());
 }
 
 ShaderD3D12Impl::~ShaderD3D12Impl()
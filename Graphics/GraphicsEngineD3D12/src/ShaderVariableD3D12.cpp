@@ -29,6 +29,7 @@
 
 #include "ShaderVariableD3D12.hpp"
 #include "ShaderResourceVariableBase.hpp"
+#include "Align.hpp"
 
 namespace Diligent
 {
@@ -50,7 +51,12 @@ size_t ShaderVariableManagerD3D12::GetRequiredMemorySize(const ShaderResourceLay
         }
     }
 
-    return NumVariables * sizeof(ShaderVariableD3D12Impl);
+    if (NumVariables == 0)
+        return 0;
+
+    // The name index is placed after the variables
+    return Align(NumVariables * sizeof(ShaderVariableD3D12Impl), ShaderVariableNameIndex::GetRequiredAlignment()) +
+        ShaderVariableNameIndex::GetRequiredMemorySize(NumVariables);
 }
 
 // Creates shader variable for every resource from SrcLayout whose type is one AllowedVarTypes
@@ -99,6 +105,13 @@ void ShaderVariableManagerD3D12::Initialize(const ShaderResourceLayoutD3D12&
         }
     }
     VERIFY_EXPR(VarInd == m_NumVariables);
+
+    auto* pNameIndexMem = Align(reinterpret_cast<Uint8*>(m_pVariables + m_NumVariables), ShaderVariableNameIndex::GetRequiredAlignment());
+    m_NameIndex.Initialize(pNameIndexMem, m_NumVariables,
+                           [this](Uint32 VarIdx) //
+                           {
+                               return m_pVariables[VarIdx].m_Resource.Attribs.Name;
+                           });
 }
 
 ShaderVariableManagerD3D12::~ShaderVariableManagerD3D12()
@@ -121,17 +134,12 @@ void ShaderVariableManagerD3D12::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableD3D12Impl* ShaderVariableManagerD3D12::GetVariable(const Char* Name)
 {
-    ShaderVariableD3D12Impl* pVar = nullptr;
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        auto& Var = m_pVariables[v];
-        if (strcmp(Var.m_Resource.Attribs.Name, Name) == 0)
-        {
-            pVar = &Var;
-            break;
-        }
-    }
-    return pVar;
+    const auto VarIdx = m_NameIndex.Find(Name,
+                                         [this](Uint32 Idx) //
+                                         {
+                                             return m_pVariables[Idx].m_Resource.Attribs.Name;
+                                         });
+    return VarIdx != ShaderVariableNameIndex::InvalidIndex ? m_pVariables + VarIdx : nullptr;
 }
 
 
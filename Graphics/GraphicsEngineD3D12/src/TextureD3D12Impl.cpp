@@ -366,8 +366,9 @@ TextureD3D12Impl::TextureD3D12Impl(IReferenceCounters*        pRefCounters,
                                            MipProps.RowSize,
                                            reinterpret_cast<Uint8*>(pStagingData) + DstFootprint.Offset,
                                            DstFootprint.Footprint.RowPitch,
-                                           DstFootprint.Footprint.RowPitch * DstFootprint.Footprint.Height / FmtAttribs.BlockHeight // DstDepthStride
-                    );
+                                           DstFootprint.Footprint.RowPitch * DstFootprint.Footprint.Height / FmtAttribs.BlockHeight, // DstDepthStride
+                                           COPY_TEXTURE_SUBRESOURCE_FLAG_WRITE_COMBINED,
+                                           pRenderDeviceD3D12->GetTextureCopyThreadPool(MipProps.MipSize));
                 }
             }
             D3D12_RANGE FlushRange{0, static_cast<SIZE_T>(stagingBufferSize)};
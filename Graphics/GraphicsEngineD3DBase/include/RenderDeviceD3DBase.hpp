@@ -46,9 +46,10 @@ public:
     RenderDeviceD3DBase(IReferenceCounters*      pRefCounters,
                         IMemoryAllocator&        RawMemAllocator,
                         IEngineFactory*          pEngineFactory,
+                        const EngineCreateInfo&  EngineCI,
                         Uint32                   NumDeferredContexts,
                         const DeviceObjectSizes& ObjectSizes) :
-        RenderDeviceBase<BaseInterface>{pRefCounters, RawMemAllocator, pEngineFactory, NumDeferredContexts, ObjectSizes}
+        RenderDeviceBase<BaseInterface>{pRefCounters, RawMemAllocator, pEngineFactory, EngineCI, NumDeferredContexts, ObjectSizes}
     {
         // Flag texture formats always supported in D3D11 and D3D12
 
@@ -35,7 +35,7 @@
 #include "dxc/dxcapi.h"
 
 #include "D3DErrors.hpp"
-#include "DataBlobImpl.hpp"
+#include "MappedFileStream.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ShaderD3DBase.hpp"
 #include "DXCompiler.hpp"
@@ -63,8 +63,8 @@ public:
             return E_FAIL;
         }
 
-        RefCntAutoPtr<IDataBlob> pFileData(MakeNewRCObj<DataBlobImpl>{}(0));
-        pSourceStream->ReadBlob(pFileData);
+        RefCntAutoPtr<IDataBlob> pFileData = ReadStreamData(pSourceStream);
+
         *ppData = pFileData->GetDataPtr();
         *pBytes = static_cast<UINT>(pFileData->GetSize());
 
@@ -54,11 +54,12 @@ public:
     RenderDeviceNextGenBase(IReferenceCounters*      pRefCounters,
                             IMemoryAllocator&        RawMemAllocator,
                             IEngineFactory*          pEngineFactory,
+                            const EngineCreateInfo&  EngineCI,
                             size_t                   CmdQueueCount,
                             CommandQueueType**       Queues,
                             Uint32                   NumDeferredContexts,
                             const DeviceObjectSizes& ObjectSizes) :
-        TBase{pRefCounters, RawMemAllocator, pEngineFactory, NumDeferredContexts, ObjectSizes},
+        TBase{pRefCounters, RawMemAllocator, pEngineFactory, EngineCI, NumDeferredContexts, ObjectSizes},
         m_CmdQueueCount{CmdQueueCount}
     {
         m_CommandQueues = ALLOCATE(this->m_RawMemAllocator, "Raw memory for the device command/release queues", CommandQueue, m_CmdQueueCount);
@@ -0,0 +1,81 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::BufferNullImpl class
+
+#include <vector>
+
+#include "Buffer.h"
+#include "BufferBase.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "STDAllocator.hpp"
+
+namespace Diligent
+{
+
+class FixedBlockMemoryAllocator;
+
+/// Buffer object implementation in Null backend.
+
+/// The buffer keeps its content in host memory, so that updates, copies and
+/// mappings behave exactly as they would on a real device.
+class BufferNullImpl final : public BufferBase<IBuffer, RenderDeviceNullImpl, BufferViewNullImpl, FixedBlockMemoryAllocator>
+{
+public:
+    using TBufferBase = BufferBase<IBuffer, RenderDeviceNullImpl, BufferViewNullImpl, FixedBlockMemoryAllocator>;
+
+    BufferNullImpl(IReferenceCounters*        pRefCounters,
+                   FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                   RenderDeviceNullImpl*      pDeviceNull,
+                   const BufferDesc&          BuffDesc,
+                   const BufferData*          pBuffData,
+                   bool                       bIsDeviceInternal = false);
+    ~BufferNullImpl();
+
+    /// Implementation of IBuffer::GetNativeHandle() in Null backend.
+
+    /// \return Pointer to the host memory that backs the buffer.
+    virtual void* DILIGENT_CALL_TYPE GetNativeHandle() override final { return m_Data.data(); }
+
+    void UpdateData(Uint32 Offset, Uint32 Size, const void* pData);
+    void CopyData(const BufferNullImpl& SrcBuffer, Uint32 SrcOffset, Uint32 DstOffset, Uint32 Size);
+    void Map(MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData);
+    void Unmap(MAP_TYPE MapType);
+
+    const Uint8* GetData() const { return m_Data.data(); }
+
+private:
+    virtual void CreateViewInternal(const struct BufferViewDesc& ViewDesc, IBufferView** ppView, bool bIsDefaultView) override;
+
+    std::vector<Uint8, STDAllocatorRawMem<Uint8>> m_Data;
+};
+
+} // namespace Diligent
@@ -0,0 +1,323 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::DeviceContextNullImpl class
+
+#include "DeviceContextNull.h"
+#include "DeviceContextBase.hpp"
+#include "BufferNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "QueryNullImpl.hpp"
+#include "FramebufferNullImpl.hpp"
+#include "RenderPassNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+#include "BottomLevelASBase.hpp"
+#include "TopLevelASBase.hpp"
+#include "FixedBlockMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+struct DeviceContextNullImplTraits
+{
+    using BufferType        = BufferNullImpl;
+    using TextureType       = TextureNullImpl;
+    using PipelineStateType = PipelineStateNullImpl;
+    using DeviceType        = RenderDeviceNullImpl;
+    using QueryType         = QueryNullImpl;
+    using FramebufferType   = FramebufferNullImpl;
+    using RenderPassType    = RenderPassNullImpl;
+    using BottomLevelASType = BottomLevelASBase<IBottomLevelAS, RenderDeviceNullImpl>;
+    using TopLevelASType    = TopLevelASBase<ITopLevelAS, BottomLevelASType, RenderDeviceNullImpl>;
+};
+
+/// Device context implementation in Null backend.
+
+/// The context does not execute any commands. It validates the arguments the same way
+/// other backends do, tracks resource states, performs buffer and texture copies in
+/// host memory and counts the recorded commands (see IDeviceContextNull::GetCommandCounters()).
+class DeviceContextNullImpl final : public DeviceContextBase<IDeviceContextNull, DeviceContextNullImplTraits>
+{
+public:
+    using TDeviceContextBase = DeviceContextBase<IDeviceContextNull, DeviceContextNullImplTraits>;
+
+    DeviceContextNullImpl(IReferenceCounters* pRefCounters, RenderDeviceNullImpl* pDeviceNull, bool bIsDeferred);
+
+    /// Queries the specific interface, see IObject::QueryInterface() for details.
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
+
+    /// Implementation of IDeviceContext::SetPipelineState() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
+
+    /// Implementation of IDeviceContext::TransitionShaderResources() in Null backend.
+    virtual void DILIGENT_CALL_TYPE TransitionShaderResources(IPipelineState* pPipelineState, IShaderResourceBinding* pShaderResourceBinding) override final;
+
+    /// Implementation of IDeviceContext::CommitShaderResources() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CommitShaderResources(IShaderResourceBinding*        pShaderResourceBinding,
+                                                          RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::SetStencilRef() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SetStencilRef(Uint32 StencilRef) override final;
+
+    /// Implementation of IDeviceContext::SetBlendFactors() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
+
+    /// Implementation of IDeviceContext::SetVertexBuffers() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
+                                                     Uint32                         NumBuffersSet,
+                                                     IBuffer**                      ppBuffers,
+                                                     Uint32*                        pOffsets,
+                                                     RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                                     SET_VERTEX_BUFFERS_FLAGS       Flags) override final;
+
+    /// Implementation of IDeviceContext::InvalidateState() in Null backend.
+    virtual void DILIGENT_CALL_TYPE InvalidateState() override final;
+
+    /// Implementation of IDeviceContext::SetIndexBuffer() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SetIndexBuffer(IBuffer*                       pIndexBuffer,
+                                                   Uint32                         ByteOffset,
+                                                   RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::SetViewports() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SetViewports(Uint32          NumViewports,
+                                                 const Viewport* pViewports,
+                                                 Uint32          RTWidth,
+                                                 Uint32          RTHeight) override final;
+
+    /// Implementation of IDeviceContext::SetScissorRects() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SetScissorRects(Uint32      NumRects,
+                                                    const Rect* pRects,
+                                                    Uint32      RTWidth,
+                                                    Uint32      RTHeight) override final;
+
+    /// Implementation of IDeviceContext::SetRenderTargets() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SetRenderTargets(Uint32                         NumRenderTargets,
+                                                     ITextureView*                  ppRenderTargets[],
+                                                     ITextureView*                  pDepthStencil,
+                                                     RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::BeginRenderPass() in Null backend.
+    virtual void DILIGENT_CALL_TYPE BeginRenderPass(const BeginRenderPassAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::NextSubpass() in Null backend.
+    virtual void DILIGENT_CALL_TYPE NextSubpass() override final;
+
+    /// Implementation of IDeviceContext::EndRenderPass() in Null backend.
+    virtual void DILIGENT_CALL_TYPE EndRenderPass() override final;
+
+    // clang-format off
+
+    /// Implementation of IDeviceContext::Draw() in Null backend.
+    virtual void DILIGENT_CALL_TYPE Draw               (const DrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::DrawIndexed() in Null backend.
+    virtual void DILIGENT_CALL_TYPE DrawIndexed        (const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in Null backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw          (const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in Null backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed   (const MultiDrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::DrawIndirect() in Null backend.
+    virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer) override final;
+    /// Implementation of IDeviceContext::DrawIndexedIndirect() in Null backend.
+    virtual void DILIGENT_CALL_TYPE DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs, IBuffer* pAttribsBuffer) override final;
+    /// Implementation of IDeviceContext::DrawMesh() in Null backend.
+    virtual void DILIGENT_CALL_TYPE DrawMesh           (const DrawMeshAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::DrawMeshIndirect() in Null backend.
+    virtual void DILIGENT_CALL_TYPE DrawMeshIndirect   (const DrawMeshIndirectAttribs& Attribs, IBuffer* pAttribsBuffer) override final;
+
+    /// Implementation of IDeviceContext::DispatchCompute() in Null backend.
+    virtual void DILIGENT_CALL_TYPE DispatchCompute        (const DispatchComputeAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::DispatchComputeIndirect() in Null backend.
+    virtual void DILIGENT_CALL_TYPE DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs, IBuffer* pAttribsBuffer) override final;
+
+    // clang-format on
+
+    /// Implementation of IDeviceContext::ClearDepthStencil() in Null backend.
+    virtual void DILIGENT_CALL_TYPE ClearDepthStencil(ITextureView*                  pView,
+                                                      CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                                      float                          fDepth,
+                                                      Uint8                          Stencil,
+                                                      RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::ClearRenderTarget() in Null backend.
+    virtual void DILIGENT_CALL_TYPE ClearRenderTarget(ITextureView*                  pView,
+                                                      const float*                   RGBA,
+                                                      RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::UpdateBuffer() in Null backend.
+    virtual void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
+                                                 Uint32                         Offset,
+                                                 Uint32                         Size,
+                                                 const void*                    pData,
+                                                 RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::CopyBuffer() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CopyBuffer(IBuffer*                       pSrcBuffer,
+                                               Uint32                         SrcOffset,
+                                               RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                               IBuffer*                       pDstBuffer,
+                                               Uint32                         DstOffset,
+                                               Uint32                         Size,
+                                               RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::MapBuffer() in Null backend.
+    virtual void DILIGENT_CALL_TYPE MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData) override final;
+
+    /// Implementation of IDeviceContext::UnmapBuffer() in Null backend.
+    virtual void DILIGENT_CALL_TYPE UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType) override final;
+
+    /// Implementation of IDeviceContext::UpdateTexture() in Null backend.
+    virtual void DILIGENT_CALL_TYPE UpdateTexture(ITexture*                      pTexture,
+                                                  Uint32                         MipLevel,
+                                                  Uint32                         Slice,
+                                                  const Box&                     DstBox,
+                                                  const TextureSubResData&       SubresData,
+                                                  RESOURCE_STATE_TRANSITION_MODE SrcBufferStateTransitionMode,
+                                                  RESOURCE_STATE_TRANSITION_MODE TextureStateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::CopyTexture() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CopyTexture(const CopyTextureAttribs& CopyAttribs) override final;
+
+    /// Implementation of IDeviceContext::MapTextureSubresource() in Null backend.
+    virtual void DILIGENT_CALL_TYPE MapTextureSubresource(ITexture*                 pTexture,
+                                                          Uint32                    MipLevel,
+                                                          Uint32                    ArraySlice,
+                                                          MAP_TYPE                  MapType,
+                                                          MAP_FLAGS                 MapFlags,
+                                                          const Box*                pMapRegion,
+                                                          MappedTextureSubresource& MappedData) override final;
+
+    /// Implementation of IDeviceContext::UnmapTextureSubresource() in Null backend.
+    virtual void DILIGENT_CALL_TYPE UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice) override final;
+
+    /// Implementation of IDeviceContext::GenerateMips() in Null backend.
+    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView) override final;
+
+    /// Implementation of IDeviceContext::FinishFrame() in Null backend.
+    virtual void DILIGENT_CALL_TYPE FinishFrame() override final;
+
+    /// Implementation of IDeviceContext::TransitionResourceStates() in Null backend.
+    virtual void DILIGENT_CALL_TYPE TransitionResourceStates(Uint32 BarrierCount, StateTransitionDesc* pResourceBarriers) override final;
+
+    /// Implementation of IDeviceContext::ResolveTextureSubresource() in Null backend.
+    virtual void DILIGENT_CALL_TYPE ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                              ITexture*                               pDstTexture,
+                                                              const ResolveTextureSubresourceAttribs& ResolveAttribs) override final;
+
+    /// Implementation of IDeviceContext::FinishCommandList() in Null backend.
+    virtual void DILIGENT_CALL_TYPE FinishCommandList(class ICommandList** ppCommandList) override final;
+
+    /// Implementation of IDeviceContext::ExecuteCommandLists() in Null backend.
+    virtual void DILIGENT_CALL_TYPE ExecuteCommandLists(Uint32               NumCommandLists,
+                                                        ICommandList* const* ppCommandLists) override final;
+
+    /// Implementation of IDeviceContext::SignalFence() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SignalFence(IFence* pFence, Uint64 Value) override final;
+
+    /// Implementation of IDeviceContext::WaitForFence() in Null backend.
+    virtual void DILIGENT_CALL_TYPE WaitForFence(IFence* pFence, Uint64 Value, bool FlushContext) override final;
+
+    /// Implementation of IDeviceContext::DeviceWaitForFence() in Null backend.
+    virtual void DILIGENT_CALL_TYPE DeviceWaitForFence(IFence* pFence, Uint64 Value) override final;
+
+    /// Implementation of IDeviceContext::WaitForIdle() in Null backend.
+    virtual void DILIGENT_CALL_TYPE WaitForIdle() override final;
+
+    /// Implementation of IDeviceContext::BeginQuery() in Null backend.
+    virtual void DILIGENT_CALL_TYPE BeginQuery(IQuery* pQuery) override final;
+
+    /// Implementation of IDeviceContext::EndQuery() in Null backend.
+    virtual void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
+
+    /// Implementation of IDeviceContext::Flush() in Null backend.
+    virtual void DILIGENT_CALL_TYPE Flush() override final;
+
+    /// Implementation of IDeviceContext::BuildBLAS() in Null backend.
+    virtual void DILIGENT_CALL_TYPE BuildBLAS(const BuildBLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::BuildTLAS() in Null backend.
+    virtual void DILIGENT_CALL_TYPE BuildTLAS(const BuildTLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::CopyBLAS() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CopyBLAS(const CopyBLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::CopyTLAS() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CopyTLAS(const CopyTLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::WriteBLASCompactedSize() in Null backend.
+    virtual void DILIGENT_CALL_TYPE WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::WriteTLASCompactedSize() in Null backend.
+    virtual void DILIGENT_CALL_TYPE WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::TraceRays() in Null backend.
+    virtual void DILIGENT_CALL_TYPE TraceRays(const TraceRaysAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContextNull::GetCommandCounters().
+    virtual const NullCommandCounters& DILIGENT_CALL_TYPE GetCommandCounters() const override final { return m_Counters; }
+
+    /// Implementation of IDeviceContextNull::ResetCommandCounters().
+    virtual void DILIGENT_CALL_TYPE ResetCommandCounters() override final { m_Counters = NullCommandCounters{}; }
+
+private:
+    void TransitionOrVerifyBufferState(BufferNullImpl&                Buffer,
+                                       RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                       RESOURCE_STATE                 RequiredState,
+                                       const char*                    OperationName);
+
+    void TransitionOrVerifyTextureState(TextureNullImpl&               Texture,
+                                        RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                        RESOURCE_STATE                 RequiredState,
+                                        const char*                    OperationName);
+
+    void TransitionTextureState(TextureNullImpl& Texture, RESOURCE_STATE NewState);
+    void TransitionBufferState(BufferNullImpl& Buffer, RESOURCE_STATE NewState);
+
+    template <bool TransitionResources, bool CommitResources>
+    void TransitionAndCommitShaderResources(IPipelineState* pPSO, IShaderResourceBinding* pShaderResourceBinding, bool VerifyStates);
+
+    void PrepareForDraw(DRAW_FLAGS Flags);
+    void PrepareForIndexedDraw(DRAW_FLAGS Flags);
+    void PrepareForDispatch();
+
+#ifdef DILIGENT_DEVELOPMENT
+    void DvpVerifyCommittedResources();
+#endif
+
+    NullCommandCounters m_Counters;
+
+    FixedBlockMemoryAllocator m_CmdListAllocator;
+
+    // Shader resource binding committed by the last call to CommitShaderResources().
+    // It is only kept when EngineNullCreateInfo::VerifyCommittedShaderResources is true.
+    RefCntAutoPtr<ShaderResourceBindingNullImpl> m_pCommittedSRB;
+};
+
+} // namespace Diligent
@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineStateNullImpl class
+
+#include <array>
+#include <vector>
+
+#include "PipelineState.h"
+#include "PipelineStateBase.hpp"
+#include "ShaderVariableManagerNull.hpp"
+#include "ShaderNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+class FixedBlockMemoryAllocator;
+
+/// Pipeline state object implementation in Null backend.
+
+/// The pipeline state only validates the create info and the resource layout;
+/// no native objects are created.
+class PipelineStateNullImpl final : public PipelineStateBase<IPipelineState, RenderDeviceNullImpl>
+{
+public:
+    using TPipelineStateBase = PipelineStateBase<IPipelineState, RenderDeviceNullImpl>;
+
+    PipelineStateNullImpl(IReferenceCounters*                    pRefCounters,
+                          RenderDeviceNullImpl*                  pDeviceNull,
+                          const GraphicsPipelineStateCreateInfo& CreateInfo);
+    PipelineStateNullImpl(IReferenceCounters*                   pRefCounters,
+                          RenderDeviceNullImpl*                 pDeviceNull,
+                          const ComputePipelineStateCreateInfo& CreateInfo);
+    ~PipelineStateNullImpl();
+
+    /// Implementation of IPipelineState::BindStaticResources() in Null backend.
+    virtual void DILIGENT_CALL_TYPE BindStaticResources(Uint32            ShaderFlags,
+                                                        IResourceMapping* pResourceMapping,
+                                                        Uint32            Flags) override final;
+
+    /// Implementation of IPipelineState::GetStaticVariableCount() in Null backend.
+    virtual Uint32 DILIGENT_CALL_TYPE GetStaticVariableCount(SHADER_TYPE ShaderType) const override final;
+
+    /// Implementation of IPipelineState::GetStaticVariableByName() in Null backend.
+    virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetStaticVariableByName(SHADER_TYPE ShaderType,
+                                                                                const Char* Name) override final;
+
+    /// Implementation of IPipelineState::GetStaticVariableByIndex() in Null backend.
+    virtual IShaderResourceVariable* DILIGENT_CALL_TYPE GetStaticVariableByIndex(SHADER_TYPE ShaderType,
+                                                                                 Uint32      Index) override final;
+
+    /// Implementation of IPipelineState::CreateShaderResourceBinding() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateShaderResourceBinding(IShaderResourceBinding** ppShaderResourceBinding,
+                                                                bool                     InitStaticResources) override final;
+
+    /// Implementation of IPipelineState::IsCompatibleWith() in Null backend.
+    virtual bool DILIGENT_CALL_TYPE IsCompatibleWith(const IPipelineState* pPSO) const override final;
+
+    const ShaderNullImpl* GetShader(Uint32 Index) const
+    {
+        VERIFY_EXPR(Index < GetNumShaderStages());
+        return m_Shaders[Index];
+    }
+
+    Uint32 GetNumStaticVarManagers() const { return m_NumStaticVarManagers; }
+
+    const ShaderVariableManagerNull& GetStaticVarManager(Uint32 Index) const
+    {
+        VERIFY_EXPR(Index < m_NumStaticVarManagers);
+        return m_pStaticVarManagers[Index];
+    }
+
+private:
+    template <typename PSOCreateInfoType>
+    void InitInternalObjects(const PSOCreateInfoType& CreateInfo);
+
+    void Destruct();
+
+    std::vector<RefCntAutoPtr<ShaderNullImpl>> m_Shaders;
+
+    // Static variable managers are indexed by the shader order in the PSO
+    ShaderVariableManagerNull* m_pStaticVarManagers   = nullptr; // [m_NumStaticVarManagers]
+    Uint8                      m_NumStaticVarManagers = 0;
+
+    // Static variable manager index in m_pStaticVarManagers array for every shader stage,
+    // indexed by the shader type pipeline index (returned by GetShaderTypePipelineIndex)
+    std::array<Int8, MAX_SHADERS_IN_PIPELINE> m_ResourceLayoutIndex = {-1, -1, -1, -1, -1, -1};
+    static_assert(MAX_SHADERS_IN_PIPELINE == 6, "Please update the initializer list above");
+};
+
+} // namespace Diligent
@@ -0,0 +1,141 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::RenderDeviceNullImpl class
+
+#include "RenderDeviceNull.h"
+#include "RenderDeviceBase.hpp"
+
+namespace Diligent
+{
+
+/// Render device implementation in Null backend.
+class RenderDeviceNullImpl final : public RenderDeviceBase<IRenderDeviceNull>
+{
+public:
+    using TRenderDeviceBase = RenderDeviceBase<IRenderDeviceNull>;
+
+    RenderDeviceNullImpl(IReferenceCounters*         pRefCounters,
+                         IMemoryAllocator&           RawMemAllocator,
+                         IEngineFactory*             pEngineFactory,
+                         const EngineNullCreateInfo& EngineCI) noexcept(false);
+    ~RenderDeviceNullImpl();
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
+
+    /// Implementation of IRenderDevice::CreateBuffer() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateBuffer(const BufferDesc& BuffDesc,
+                                                 const BufferData* pBuffData,
+                                                 IBuffer**         ppBuffer) override final;
+
+    /// Implementation of IRenderDevice::CreateShader() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateShader(const ShaderCreateInfo& ShaderCI,
+                                                 IShader**               ppShader) override final;
+
+    /// Implementation of IRenderDevice::CreateTexture() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateTexture(const TextureDesc& TexDesc,
+                                                  const TextureData* pData,
+                                                  ITexture**         ppTexture) override final;
+
+    /// Implementation of IRenderDevice::CreateSampler() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateSampler(const SamplerDesc& SamplerDesc,
+                                                  ISampler**         ppSampler) override final;
+
+    /// Implementation of IRenderDevice::CreateGraphicsPipelineState() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateGraphicsPipelineState(const GraphicsPipelineStateCreateInfo& PSOCreateInfo,
+                                                                IPipelineState**                       ppPipelineState) override final;
+
+    /// Implementation of IRenderDevice::CreateComputePipelineState() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateComputePipelineState(const ComputePipelineStateCreateInfo& PSOCreateInfo,
+                                                               IPipelineState**                      ppPipelineState) override final;
+
+    /// Implementation of IRenderDevice::CreateRayTracingPipelineState() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateRayTracingPipelineState(const RayTracingPipelineStateCreateInfo& PSOCreateInfo,
+                                                                  IPipelineState**                         ppPipelineState) override final;
+
+    /// Implementation of IRenderDevice::CreateFence() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateFence(const FenceDesc& Desc, IFence** ppFence) override final;
+
+    /// Implementation of IRenderDevice::CreateQuery() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateQuery(const QueryDesc& Desc, IQuery** ppQuery) override final;
+
+    /// Implementation of IRenderDevice::CreateRenderPass() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateRenderPass(const RenderPassDesc& Desc,
+                                                     IRenderPass**         ppRenderPass) override final;
+
+    /// Implementation of IRenderDevice::CreateFramebuffer() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateFramebuffer(const FramebufferDesc& Desc,
+                                                      IFramebuffer**         ppFramebuffer) override final;
+
+    /// Implementation of IRenderDevice::CreateBLAS() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateBLAS(const BottomLevelASDesc& Desc,
+                                               IBottomLevelAS**         ppBLAS) override final;
+
+    /// Implementation of IRenderDevice::CreateTLAS() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateTLAS(const TopLevelASDesc& Desc,
+                                               ITopLevelAS**         ppTLAS) override final;
+
+    /// Implementation of IRenderDevice::CreateSBT() in Null backend.
+    virtual void DILIGENT_CALL_TYPE CreateSBT(const ShaderBindingTableDesc& Desc,
+                                              IShaderBindingTable**         ppSBT) override final;
+
+    /// Implementation of IRenderDevice::ReleaseStaleResources() in Null backend.
+    virtual void DILIGENT_CALL_TYPE ReleaseStaleResources(bool ForceRelease = false) override final {}
+
+    /// Implementation of IRenderDevice::IdleGPU() in Null backend.
+    virtual void DILIGENT_CALL_TYPE IdleGPU() override final;
+
+    size_t GetCommandQueueCount() const { return 1; }
+    Uint64 GetCommandQueueMask() const { return Uint64{1}; }
+
+    const EngineNullCreateInfo& GetEngineCreateInfo() const { return m_EngineAttribs; }
+
+    struct Properties
+    {
+        const Uint32 MaxDrawMeshTasksCount = 64000; // same limit as in Direct3D12
+    };
+
+    const Properties& GetProperties() const
+    {
+        return m_Properties;
+    }
+
+private:
+    template <typename PSOCreateInfoType>
+    void CreatePipelineState(const PSOCreateInfoType& PSOCreateInfo, IPipelineState** ppPipelineState);
+
+    virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
+
+    const EngineNullCreateInfo m_EngineAttribs;
+
+    Properties m_Properties;
+};
+
+} // namespace Diligent
@@ -0,0 +1,78 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderNullImpl class
+
+#include <memory>
+
+#include "Shader.h"
+#include "ShaderBase.hpp"
+#include "ShaderResourcesNull.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+class FixedBlockMemoryAllocator;
+
+/// Shader implementation in Null backend.
+class ShaderNullImpl final : public ShaderBase<IShader, RenderDeviceNullImpl>
+{
+public:
+    using TShaderBase = ShaderBase<IShader, RenderDeviceNullImpl>;
+
+    ShaderNullImpl(IReferenceCounters*     pRefCounters,
+                   RenderDeviceNullImpl*   pDeviceNull,
+                   const ShaderCreateInfo& ShaderCI);
+    ~ShaderNullImpl();
+
+    /// Implementation of IShader::GetResourceCount() in Null backend.
+    virtual Uint32 DILIGENT_CALL_TYPE GetResourceCount() const override final
+    {
+        return m_pShaderResources->GetNumResources();
+    }
+
+    /// Implementation of IShader::GetResourceDesc() in Null backend.
+    virtual void DILIGENT_CALL_TYPE GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const override final
+    {
+        DEV_CHECK_ERR(Index < GetResourceCount(), "Resource index (", Index, ") is out of range");
+        if (Index < GetResourceCount())
+            ResourceDesc = m_pShaderResources->GetResource(Index).GetResourceDesc();
+    }
+
+    const std::shared_ptr<const ShaderResourcesNull>& GetNullResources() const { return m_pShaderResources; }
+
+private:
+    // ShaderResources class instance must be referenced through the shared pointer, because
+    // it is referenced by ShaderVariableManagerNull class instances
+    std::shared_ptr<const ShaderResourcesNull> m_pShaderResources;
+};
+
+} // namespace Diligent
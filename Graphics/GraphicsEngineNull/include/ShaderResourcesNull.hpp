@@ -0,0 +1,147 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderResourcesNull class
+
+#include <vector>
+
+#include "Shader.h"
+#include "PipelineState.h"
+#include "BasicTypes.h"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// Shader resources reflected from the shader source code by the Null backend.
+
+/// Null backend does not compile shaders, so resources are obtained by scanning
+/// the declarations at global scope of HLSL or GLSL source (including the files
+/// referenced by #include directives). Preprocessor conditions are not evaluated:
+/// all declarations found in the source are reported, and resources with the same
+/// name are only reported once. Shaders created from byte code have no resources.
+class ShaderResourcesNull
+{
+public:
+    struct ResourceAttribs
+    {
+        // clang-format off
+        const String               Name;
+        const SHADER_RESOURCE_TYPE Type;
+        const Uint32               ArraySize;
+        const RESOURCE_DIMENSION   ResourceDim;
+        const bool                 IsMS;
+        // clang-format on
+
+        ResourceAttribs(String _Name, SHADER_RESOURCE_TYPE _Type, Uint32 _ArraySize, RESOURCE_DIMENSION _ResourceDim, bool _IsMS) noexcept :
+            // clang-format off
+            Name       {std::move(_Name)},
+            Type       {_Type       },
+            ArraySize  {_ArraySize  },
+            ResourceDim{_ResourceDim},
+            IsMS       {_IsMS       }
+        // clang-format on
+        {}
+
+        String GetPrintName(Uint32 ArrayInd) const
+        {
+            VERIFY_EXPR(ArrayInd < ArraySize);
+            return ArraySize > 1 ? Name + '[' + std::to_string(ArrayInd) + ']' : Name;
+        }
+
+        RESOURCE_DIMENSION GetResourceDimension() const { return ResourceDim; }
+
+        bool IsMultisample() const { return IsMS; }
+
+        ShaderResourceDesc GetResourceDesc() const
+        {
+            return ShaderResourceDesc{Name.c_str(), Type, ArraySize};
+        }
+
+        bool IsCompatibleWith(const ResourceAttribs& Attribs) const
+        {
+            // clang-format off
+            return Type        == Attribs.Type        &&
+                   ArraySize   == Attribs.ArraySize   &&
+                   ResourceDim == Attribs.ResourceDim &&
+                   IsMS        == Attribs.IsMS;
+            // clang-format on
+        }
+    };
+
+    ShaderResourcesNull(const ShaderCreateInfo& ShaderCI) noexcept(false);
+
+    // clang-format off
+    ShaderResourcesNull           (const ShaderResourcesNull&)  = delete;
+    ShaderResourcesNull           (      ShaderResourcesNull&&) = delete;
+    ShaderResourcesNull& operator=(const ShaderResourcesNull&)  = delete;
+    ShaderResourcesNull& operator=(      ShaderResourcesNull&&) = delete;
+    // clang-format on
+
+    Uint32 GetNumResources() const { return static_cast<Uint32>(m_Resources.size()); }
+
+    const ResourceAttribs& GetResource(Uint32 n) const
+    {
+        VERIFY_EXPR(n < m_Resources.size());
+        return m_Resources[n];
+    }
+
+    SHADER_TYPE GetShaderType() const { return m_ShaderType; }
+    const char* GetShaderName() const { return m_ShaderName.c_str(); }
+
+    bool        IsUsingCombinedTextureSamplers() const { return !m_CombinedSamplerSuffix.empty(); }
+    const char* GetCombinedSamplerSuffix() const { return IsUsingCombinedTextureSamplers() ? m_CombinedSamplerSuffix.c_str() : nullptr; }
+
+    size_t GetHash() const;
+
+    bool IsCompatibleWith(const ShaderResourcesNull& Resources) const;
+
+#ifdef DILIGENT_DEVELOPMENT
+    static void DvpVerifyResourceLayout(const PipelineResourceLayoutDesc& ResourceLayout,
+                                        const ShaderResourcesNull* const  pShaderResources[],
+                                        Uint32                            NumShaders,
+                                        bool                              VerifyVariables,
+                                        bool                              VerifyImmutableSamplers);
+#endif
+
+private:
+    void AddResource(String Name, SHADER_RESOURCE_TYPE Type, Uint32 ArraySize, RESOURCE_DIMENSION ResourceDim, bool IsMS);
+
+    void ParseHLSL(const std::vector<String>& Tokens);
+    void ParseGLSL(const std::vector<String>& Tokens);
+
+    std::vector<ResourceAttribs> m_Resources;
+
+    const SHADER_TYPE m_ShaderType;
+    const String      m_ShaderName;
+    const String      m_CombinedSamplerSuffix;
+};
+
+} // namespace Diligent
@@ -0,0 +1,185 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderVariableManagerNull and Diligent::ShaderVariableNullImpl classes
+
+#include <memory>
+#include <vector>
+
+#include "ShaderResourceVariable.h"
+#include "PipelineState.h"
+#include "ResourceMapping.h"
+#include "ShaderResourceVariableBase.hpp"
+#include "ShaderResourcesNull.hpp"
+#include "ShaderVariableNameIndex.hpp"
+
+namespace Diligent
+{
+
+class ShaderVariableManagerNull;
+
+/// Shader resource variable implementation in Null backend.
+class ShaderVariableNullImpl final : public ShaderVariableBase<ShaderVariableManagerNull>
+{
+public:
+    using TBase = ShaderVariableBase<ShaderVariableManagerNull>;
+
+    ShaderVariableNullImpl(ShaderVariableManagerNull&                  ParentManager,
+                           const ShaderResourcesNull::ResourceAttribs& Attribs,
+                           SHADER_RESOURCE_VARIABLE_TYPE               VariableType,
+                           Uint32                                      CacheOffset) :
+        // clang-format off
+        TBase          {ParentManager},
+        m_Attribs      {Attribs      },
+        m_VariableType {VariableType },
+        m_CacheOffset  {CacheOffset  }
+    // clang-format on
+    {}
+
+    /// Implementation of IShaderResourceVariable::Set() in Null backend.
+    virtual void DILIGENT_CALL_TYPE Set(IDeviceObject* pObject) override final
+    {
+        BindResource(pObject, 0);
+    }
+
+    /// Implementation of IShaderResourceVariable::SetArray() in Null backend.
+    virtual void DILIGENT_CALL_TYPE SetArray(IDeviceObject* const* ppObjects,
+                                             Uint32                FirstElement,
+                                             Uint32                NumElements) override final
+    {
+        VerifyAndCorrectSetArrayArguments(m_Attribs.Name.c_str(), m_Attribs.ArraySize, FirstElement, NumElements);
+        for (Uint32 elem = 0; elem < NumElements; ++elem)
+            BindResource(ppObjects[elem], FirstElement + elem);
+    }
+
+    /// Implementation of IShaderResourceVariable::GetType() in Null backend.
+    virtual SHADER_RESOURCE_VARIABLE_TYPE DILIGENT_CALL_TYPE GetType() const override final
+    {
+        return m_VariableType;
+    }
+
+    /// Implementation of IShaderResourceVariable::GetResourceDesc() in Null backend.
+    virtual void DILIGENT_CALL_TYPE GetResourceDesc(ShaderResourceDesc& ResourceDesc) const override final
+    {
+        ResourceDesc = m_Attribs.GetResourceDesc();
+    }
+
+    /// Implementation of IShaderResourceVariable::GetIndex() in Null backend.
+    virtual Uint32 DILIGENT_CALL_TYPE GetIndex() const override final;
+
+    /// Implementation of IShaderResourceVariable::IsBound() in Null backend.
+    virtual bool DILIGENT_CALL_TYPE IsBound(Uint32 ArrayIndex) const override final;
+
+    void BindResource(IDeviceObject* pObject, Uint32 ArrayIndex);
+
+    const ShaderResourcesNull::ResourceAttribs& GetAttribs() const { return m_Attribs; }
+
+private:
+    friend ShaderVariableManagerNull;
+
+    const ShaderResourcesNull::ResourceAttribs& m_Attribs;
+    const SHADER_RESOURCE_VARIABLE_TYPE         m_VariableType;
+    // Offset of the first array element in the resource cache of the parent manager
+    const Uint32 m_CacheOffset;
+};
+
+
+/// Keeps the shader variables of the given types of one shader stage together with the
+/// resources bound to them. The manager is used by the pipeline state to hold static variables
+/// and by the shader resource binding to hold mutable and dynamic variables.
+class ShaderVariableManagerNull
+{
+public:
+    ShaderVariableManagerNull(IObject&                                   Owner,
+                              std::shared_ptr<const ShaderResourcesNull> pResources,
+                              const PipelineResourceLayoutDesc&          ResourceLayout,
+                              const SHADER_RESOURCE_VARIABLE_TYPE*       AllowedVarTypes,
+                              Uint32                                     NumAllowedTypes);
+
+    // clang-format off
+    ShaderVariableManagerNull           (const ShaderVariableManagerNull&)  = delete;
+    ShaderVariableManagerNull           (      ShaderVariableManagerNull&&) = delete;
+    ShaderVariableManagerNull& operator=(const ShaderVariableManagerNull&)  = delete;
+    ShaderVariableManagerNull& operator=(      ShaderVariableManagerNull&&) = delete;
+    // clang-format on
+
+    void BindResources(IResourceMapping* pResourceMapping, Uint32 Flags);
+
+    ShaderVariableNullImpl* GetVariable(const Char* Name);
+    ShaderVariableNullImpl* GetVariable(Uint32 Index);
+
+    Uint32 GetVariableCount() const { return static_cast<Uint32>(m_Variables.size()); }
+
+    Uint32 GetVariableIndex(const ShaderVariableNullImpl& Variable) const;
+
+    IObject& GetOwner() { return m_Owner; }
+
+    SHADER_TYPE GetShaderType() const { return m_pResources->GetShaderType(); }
+    const char* GetShaderName() const { return m_pResources->GetShaderName(); }
+
+#ifdef DILIGENT_DEVELOPMENT
+    bool DvpVerifyBindings() const;
+#endif
+
+    /// Calls Handler(const ShaderResourcesNull::ResourceAttribs&, IDeviceObject*) for every
+    /// non-null object bound to the variables of this manager.
+    template <typename THandler>
+    void ProcessBoundResources(THandler Handler) const
+    {
+        for (const auto& Var : m_Variables)
+        {
+            const auto& Attribs = Var.GetAttribs();
+            for (Uint32 ArrInd = 0; ArrInd < Attribs.ArraySize; ++ArrInd)
+            {
+                if (auto* pObject = m_ResourceCache[Var.m_CacheOffset + ArrInd].RawPtr<IDeviceObject>())
+                    Handler(Attribs, pObject);
+            }
+        }
+    }
+
+private:
+    friend ShaderVariableNullImpl;
+
+    IObject& m_Owner;
+
+    // The variables reference resource attributes, so the resources must be kept alive
+    const std::shared_ptr<const ShaderResourcesNull> m_pResources;
+
+    std::vector<ShaderVariableNullImpl> m_Variables;
+
+    // Storage for the name index. size_t elements satisfy the index alignment requirement.
+    std::vector<size_t>     m_NameIndexData;
+    ShaderVariableNameIndex m_NameIndex;
+
+    // Resources bound to all array elements of all variables
+    std::vector<RefCntAutoPtr<IDeviceObject>> m_ResourceCache;
+};
+
+} // namespace Diligent
@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::TextureNullImpl class
+
+#include <vector>
+
+#include "Texture.h"
+#include "TextureBase.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "STDAllocator.hpp"
+
+namespace Diligent
+{
+
+class FixedBlockMemoryAllocator;
+
+/// Texture object implementation in Null backend.
+
+/// All subresources are backed by host memory, so that data written by UpdateTexture()
+/// and CopyTexture() can be read back through a staging texture. Draw and dispatch
+/// commands are not executed and never modify texture contents.
+class TextureNullImpl final : public TextureBase<ITexture, RenderDeviceNullImpl, TextureViewNullImpl, FixedBlockMemoryAllocator>
+{
+public:
+    using TTextureBase = TextureBase<ITexture, RenderDeviceNullImpl, TextureViewNullImpl, FixedBlockMemoryAllocator>;
+    using ViewImplType = TextureViewNullImpl;
+
+    TextureNullImpl(IReferenceCounters*        pRefCounters,
+                    FixedBlockMemoryAllocator& TexViewObjAllocator,
+                    RenderDeviceNullImpl*      pDeviceNull,
+                    const TextureDesc&         TexDesc,
+                    const TextureData*         pInitData,
+                    bool                       bIsDeviceInternal = false);
+    ~TextureNullImpl();
+
+    /// Implementation of ITexture::GetNativeHandle() in Null backend.
+
+    /// \return Pointer to the host memory that backs the texture.
+    virtual void* DILIGENT_CALL_TYPE GetNativeHandle() override final { return m_Data.data(); }
+
+    /// Returns the address and strides of the given subresource region in host memory.
+    MappedTextureSubresource GetSubresourceData(Uint32 MipLevel, Uint32 Slice, const Box* pRegion);
+
+    void UpdateData(Uint32 MipLevel, Uint32 Slice, const Box& DstBox, const TextureSubResData& SubresData);
+
+    void CopyData(TextureNullImpl& SrcTexture,
+                  Uint32           SrcMipLevel,
+                  Uint32           SrcSlice,
+                  const Box&       SrcBox,
+                  Uint32           DstMipLevel,
+                  Uint32           DstSlice,
+                  Uint32           DstX,
+                  Uint32           DstY,
+                  Uint32           DstZ);
+
+private:
+    virtual void CreateViewInternal(const struct TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView) override;
+
+    Uint32 GetSubresourceOffset(Uint32 MipLevel, Uint32 Slice) const
+    {
+        VERIFY_EXPR(MipLevel < m_Desc.MipLevels);
+        return m_SubresourceOffsets[Slice * m_Desc.MipLevels + MipLevel];
+    }
+
+    std::vector<Uint8, STDAllocatorRawMem<Uint8>> m_Data;
+
+    // Offsets of all subresources in m_Data, indexed by Slice * MipLevels + MipLevel
+    std::vector<Uint32, STDAllocatorRawMem<Uint32>> m_SubresourceOffsets;
+};
+
+} // namespace Diligent
@@ -0,0 +1,136 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::IDeviceContextNull interface
+
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {41838AB9-E018-4F7E-B580-AFBC597D5B23}
+static const INTERFACE_ID IID_DeviceContextNull =
+    {0x41838ab9, 0xe018, 0x4f7e, {0xb5, 0x80, 0xaf, 0xbc, 0x59, 0x7d, 0x5b, 0x23}};
+
+// clang-format off
+
+/// The number of commands recorded by the Null device context, see IDeviceContextNull::GetCommandCounters().
+struct NullCommandCounters
+{
+    /// The total number of recorded commands
+    Uint64 CommandCount          DEFAULT_INITIALIZER(0);
+
+    /// The number of Draw*() and DrawMesh*() commands
+    Uint64 DrawCount             DEFAULT_INITIALIZER(0);
+
+    /// The number of DispatchCompute*() commands
+    Uint64 DispatchCount         DEFAULT_INITIALIZER(0);
+
+    /// The number of SetPipelineState() commands that changed the pipeline
+    Uint64 PipelineStateChanges  DEFAULT_INITIALIZER(0);
+
+    /// The number of TransitionShaderResources() and CommitShaderResources() commands
+    Uint64 ShaderResourceCommits DEFAULT_INITIALIZER(0);
+
+    /// The number of SetVertexBuffers() commands
+    Uint64 VertexBufferBinds     DEFAULT_INITIALIZER(0);
+
+    /// The number of SetIndexBuffer() commands
+    Uint64 IndexBufferBinds      DEFAULT_INITIALIZER(0);
+
+    /// The number of SetRenderTargets() commands
+    Uint64 RenderTargetChanges   DEFAULT_INITIALIZER(0);
+
+    /// The number of BeginRenderPass() commands
+    Uint64 RenderPasses          DEFAULT_INITIALIZER(0);
+
+    /// The number of ClearRenderTarget() and ClearDepthStencil() commands
+    Uint64 ClearCount            DEFAULT_INITIALIZER(0);
+
+    /// The number of UpdateBuffer() and CopyBuffer() commands
+    Uint64 BufferUpdates         DEFAULT_INITIALIZER(0);
+
+    /// The number of UpdateTexture(), CopyTexture(), GenerateMips() and ResolveTextureSubresource() commands
+    Uint64 TextureUpdates        DEFAULT_INITIALIZER(0);
+
+    /// The number of MapBuffer() and MapTextureSubresource() commands
+    Uint64 MapCount              DEFAULT_INITIALIZER(0);
+
+    /// The number of resource state transitions
+    Uint64 StateTransitions      DEFAULT_INITIALIZER(0);
+
+    /// The number of BeginQuery() and EndQuery() commands
+    Uint64 QueryCount            DEFAULT_INITIALIZER(0);
+
+    /// The number of command lists executed by ExecuteCommandLists()
+    Uint64 CommandListsExecuted  DEFAULT_INITIALIZER(0);
+};
+typedef struct NullCommandCounters NullCommandCounters;
+
+// clang-format on
+
+#define DILIGENT_INTERFACE_NAME IDeviceContextNull
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IDeviceContextNullInclusiveMethods \
+    IDeviceContextInclusiveMethods;        \
+    IDeviceContextNullMethods DeviceContextNull
+
+// clang-format off
+
+/// Exposes Null-backend-specific functionality of a device context.
+DILIGENT_BEGIN_INTERFACE(IDeviceContextNull, IDeviceContext)
+{
+    /// Returns the number of commands recorded by the context since it was
+    /// created or since the last call to ResetCommandCounters().
+
+    /// \remarks When a deferred context finishes a command list, its counters are
+    ///          stored in the command list and are added to the counters of the immediate
+    ///          context when the list is executed.
+    VIRTUAL const NullCommandCounters REF METHOD(GetCommandCounters)(THIS) CONST PURE;
+
+    /// Resets all command counters to zero.
+    VIRTUAL void METHOD(ResetCommandCounters)(THIS) PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+
+#    define IDeviceContextNull_GetCommandCounters(This)   CALL_IFACE_METHOD(DeviceContextNull, GetCommandCounters,   This)
+#    define IDeviceContextNull_ResetCommandCounters(This) CALL_IFACE_METHOD(DeviceContextNull, ResetCommandCounters, This)
+
+// clang-format on
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of functions that create Null engine implementation
+
+#include "../../GraphicsEngine/interface/EngineFactory.h"
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/SwapChain.h"
+
+#if PLATFORM_ANDROID || PLATFORM_LINUX || PLATFORM_MACOS || PLATFORM_IOS || (PLATFORM_WIN32 && !defined(_MSC_VER))
+// https://gcc.gnu.org/wiki/Visibility
+#    define API_QUALIFIER __attribute__((visibility("default")))
+#elif PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
+#    define API_QUALIFIER
+#else
+#    error Unsupported platform
+#endif
+
+#if ENGINE_DLL && PLATFORM_WIN32 && defined(_MSC_VER)
+#    include "../../GraphicsEngine/interface/LoadEngineDll.h"
+#    define EXPLICITLY_LOAD_ENGINE_NULL_DLL 1
+#endif
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {110F16D0-B9FB-420A-B027-A7822B1EEB30}
+static const INTERFACE_ID IID_EngineFactoryNull =
+    {0x110f16d0, 0xb9fb, 0x420a, {0xb0, 0x27, 0xa7, 0x82, 0x2b, 0x1e, 0xeb, 0x30}};
+
+#define DILIGENT_INTERFACE_NAME IEngineFactoryNull
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IEngineFactoryNullInclusiveMethods \
+    IEngineFactoryInclusiveMethods;        \
+    IEngineFactoryNullMethods EngineFactoryNull
+
+// clang-format off
+
+/// Engine factory for the Null implementation.
+
+/// The Null device implements all engine interfaces with CPU-only objects: buffers are
+/// backed by host memory, shader resources are reflected from the source code, and
+/// device contexts validate and record commands without executing them. It is intended
+/// for measuring the CPU cost of the engine and for running validation on machines
+/// without a GPU.
+DILIGENT_BEGIN_INTERFACE(IEngineFactoryNull, IEngineFactory)
+{
+    /// Creates a render device and device contexts for the Null implementation.
+
+    /// \param [in] EngineCI    - Engine creation attributes.
+    /// \param [out] ppDevice   - Address of the memory location where pointer to
+    ///                           the created device will be written.
+    /// \param [out] ppContexts - Address of the memory location where pointers to
+    ///                           the contexts will be written. Immediate context goes at
+    ///                           position 0. If EngineCI.NumDeferredContexts > 0,
+    ///                           pointers to deferred contexts are written afterwards.
+    VIRTUAL void METHOD(CreateDeviceAndContextsNull)(THIS_
+                                                     const EngineNullCreateInfo REF EngineCI,
+                                                     IRenderDevice**                ppDevice,
+                                                     IDeviceContext**               ppContexts) PURE;
+
+    /// Creates a swap chain for the Null implementation.
+
+    /// \param [in] pDevice           - Pointer to the render device.
+    /// \param [in] pImmediateContext - Pointer to the immediate device context.
+    /// \param [in] SCDesc            - Swap chain description.
+    /// \param [out] ppSwapChain      - Address of the memory location where pointer to the new
+    ///                                 swap chain will be written.
+    ///
+    /// \remarks The swap chain is not associated with any window. Its back buffer and
+    ///          depth buffer are regular textures; Present() only advances the frame.
+    VIRTUAL void METHOD(CreateSwapChainNull)(THIS_
+                                             IRenderDevice*          pDevice,
+                                             IDeviceContext*         pImmediateContext,
+                                             const SwapChainDesc REF SCDesc,
+                                             ISwapChain**            ppSwapChain) PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+
+#    define IEngineFactoryNull_CreateDeviceAndContextsNull(This, ...) CALL_IFACE_METHOD(EngineFactoryNull, CreateDeviceAndContextsNull, This, __VA_ARGS__)
+#    define IEngineFactoryNull_CreateSwapChainNull(This, ...)         CALL_IFACE_METHOD(EngineFactoryNull, CreateSwapChainNull,         This, __VA_ARGS__)
+
+// clang-format on
+
+#endif
+
+
+#if EXPLICITLY_LOAD_ENGINE_NULL_DLL
+
+typedef struct IEngineFactoryNull* (*GetEngineFactoryNullType)();
+
+inline GetEngineFactoryNullType DILIGENT_GLOBAL_FUNCTION(LoadGraphicsEngineNull)()
+{
+    return (GetEngineFactoryNullType)LoadEngineDll("GraphicsEngineNull", "GetEngineFactoryNull");
+}
+
+#else
+
+API_QUALIFIER
+struct IEngineFactoryNull* DILIGENT_GLOBAL_FUNCTION(GetEngineFactoryNull)();
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
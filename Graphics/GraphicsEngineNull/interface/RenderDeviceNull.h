@@ -0,0 +1,72 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::IRenderDeviceNull interface
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {0DF83C29-6B4B-4888-AFF2-18B6EE352EF9}
+static const INTERFACE_ID IID_RenderDeviceNull =
+    {0xdf83c29, 0x6b4b, 0x4888, {0xaf, 0xf2, 0x18, 0xb6, 0xee, 0x35, 0x2e, 0xf9}};
+
+#define DILIGENT_INTERFACE_NAME IRenderDeviceNull
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IRenderDeviceNullInclusiveMethods \
+    IRenderDeviceInclusiveMethods
+//IRenderDeviceNullMethods RenderDeviceNull
+
+#if DILIGENT_CPP_INTERFACE
+
+/// Exposes Null-backend-specific functionality of a render device.
+DILIGENT_BEGIN_INTERFACE(IRenderDeviceNull, IRenderDevice){};
+DILIGENT_END_INTERFACE
+
+#endif
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+typedef struct IRenderDeviceNullVtbl
+{
+    IRenderDeviceNullInclusiveMethods;
+} IRenderDeviceNullVtbl;
+
+typedef struct IRenderDeviceNull
+{
+    struct IRenderDeviceNullVtbl* pVtbl;
+} IRenderDeviceNull;
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "BufferNullImpl.hpp"
+#include "EngineMemory.h"
+
+namespace Diligent
+{
+
+BufferNullImpl::BufferNullImpl(IReferenceCounters*        pRefCounters,
+                               FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                               RenderDeviceNullImpl*      pDeviceNull,
+                               const BufferDesc&          BuffDesc,
+                               const BufferData*          pBuffData,
+                               bool                       bIsDeviceInternal) :
+    // clang-format off
+    TBufferBase
+    {
+        pRefCounters,
+        BuffViewObjMemAllocator,
+        pDeviceNull,
+        BuffDesc,
+        bIsDeviceInternal
+    },
+    m_Data(STD_ALLOCATOR_RAW_MEM(Uint8, GetRawAllocator(), "Allocator for vector<Uint8>"))
+// clang-format on
+{
+    ValidateBufferInitData(BuffDesc, pBuffData);
+
+    if (m_Desc.Usage == USAGE_IMMUTABLE)
+        VERIFY(pBuffData != nullptr && pBuffData->pData != nullptr, "Initial data must not be null for immutable buffers");
+
+    m_Data.resize(m_Desc.uiSizeInBytes);
+    if (pBuffData != nullptr && pBuffData->pData != nullptr)
+    {
+        VERIFY(pBuffData->DataSize >= m_Desc.uiSizeInBytes, "Data size is not consistent with buffer size");
+        memcpy(m_Data.data(), pBuffData->pData, std::min(pBuffData->DataSize, m_Desc.uiSizeInBytes));
+    }
+
+    SetState(RESOURCE_STATE_UNDEFINED);
+}
+
+BufferNullImpl::~BufferNullImpl()
+{
+}
+
+void BufferNullImpl::UpdateData(Uint32 Offset, Uint32 Size, const void* pData)
+{
+    VERIFY_EXPR(Offset + Size <= m_Data.size());
+    memcpy(m_Data.data() + Offset, pData, Size);
+}
+
+void BufferNullImpl::CopyData(const BufferNullImpl& SrcBuffer, Uint32 SrcOffset, Uint32 DstOffset, Uint32 Size)
+{
+    VERIFY_EXPR(SrcOffset + Size <= SrcBuffer.m_Data.size());
+    VERIFY_EXPR(DstOffset + Size <= m_Data.size());
+    // Source and destination ranges may overlap if this is the same buffer
+    memmove(m_Data.data() + DstOffset, SrcBuffer.m_Data.data() + SrcOffset, Size);
+}
+
+void BufferNullImpl::Map(MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
+{
+    // There is no GPU timeline, so the memory can always be returned directly:
+    // discarded and unsynchronized mappings need no special handling.
+    pMappedData = m_Data.data();
+}
+
+void BufferNullImpl::Unmap(MAP_TYPE MapType)
+{
+}
+
+void BufferNullImpl::CreateViewInternal(const BufferViewDesc& OrigViewDesc, IBufferView** ppView, bool bIsDefaultView)
+{
+    VERIFY(ppView != nullptr, "Buffer view pointer address is null");
+    if (!ppView) return;
+    VERIFY(*ppView == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+    *ppView = nullptr;
+
+    try
+    {
+        auto ViewDesc = OrigViewDesc;
+        ValidateAndCorrectBufferViewDesc(m_Desc, ViewDesc);
+
+        auto* pDeviceNullImpl   = GetDevice();
+        auto& BuffViewAllocator = pDeviceNullImpl->GetBuffViewObjAllocator();
+        VERIFY(&BuffViewAllocator == &m_dbgBuffViewAllocator, "Buff view allocator does not match allocator provided at buffer initialization");
+
+        *ppView = NEW_RC_OBJ(BuffViewAllocator, "BufferViewNullImpl instance", BufferViewNullImpl, bIsDefaultView ? this : nullptr)(pDeviceNullImpl, ViewDesc, this, bIsDefaultView);
+
+        if (!bIsDefaultView)
+            (*ppView)->AddRef();
+    }
+    catch (const std::runtime_error&)
+    {
+        const auto* ViewTypeName = GetBufferViewTypeLiteralName(OrigViewDesc.ViewType);
+        LOG_ERROR("Failed to create view '", (OrigViewDesc.Name ? OrigViewDesc.Name : ""), "' (", ViewTypeName, ") for buffer '", (m_Desc.Name ? m_Desc.Name : ""), "'");
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,960 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "DeviceContextNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "CommandListNullImpl.hpp"
+#include "FenceNullImpl.hpp"
+
+namespace Diligent
+{
+
+DeviceContextNullImpl::DeviceContextNullImpl(IReferenceCounters* pRefCounters, RenderDeviceNullImpl* pDeviceNull, bool bIsDeferred) :
+    // clang-format off
+    TDeviceContextBase
+    {
+        pRefCounters,
+        pDeviceNull,
+        bIsDeferred
+    },
+    m_CmdListAllocator{GetRawAllocator(), sizeof(CommandListNullImpl), 64}
+// clang-format on
+{
+}
+
+IMPLEMENT_QUERY_INTERFACE(DeviceContextNullImpl, IID_DeviceContextNull, TDeviceContextBase)
+
+
+void DeviceContextNullImpl::SetPipelineState(IPipelineState* pPipelineState)
+{
+    auto* pPipelineStateNull = ValidatedCast<PipelineStateNullImpl>(pPipelineState);
+    if (PipelineStateNullImpl::IsSameObject(m_pPipelineState, pPipelineStateNull))
+        return;
+
+    TDeviceContextBase::SetPipelineState(pPipelineStateNull, 0 /*Dummy*/);
+    ++m_Counters.CommandCount;
+    ++m_Counters.PipelineStateChanges;
+}
+
+void DeviceContextNullImpl::TransitionTextureState(TextureNullImpl& Texture, RESOURCE_STATE NewState)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+    if (!Texture.IsInKnownState() || Texture.CheckState(NewState))
+        return;
+
+    Texture.SetState(NewState);
+    ++m_Counters.StateTransitions;
+}
+
+void DeviceContextNullImpl::TransitionBufferState(BufferNullImpl& Buffer, RESOURCE_STATE NewState)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+    if (!Buffer.IsInKnownState() || Buffer.CheckState(NewState))
+        return;
+
+    Buffer.SetState(NewState);
+    ++m_Counters.StateTransitions;
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyBufferState(BufferNullImpl&                Buffer,
+                                                          RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                          RESOURCE_STATE                 RequiredState,
+                                                          const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        TransitionBufferState(Buffer, RequiredState);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyBufferState(Buffer, RequiredState, OperationName);
+    }
+#endif
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyTextureState(TextureNullImpl&               Texture,
+                                                           RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                           RESOURCE_STATE                 RequiredState,
+                                                           const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        TransitionTextureState(Texture, RequiredState);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyTextureState(Texture, RequiredState, OperationName);
+    }
+#endif
+}
+
+template <bool TransitionResources, bool CommitResources>
+void DeviceContextNullImpl::TransitionAndCommitShaderResources(IPipelineState* pPSO, IShaderResourceBinding* pShaderResourceBinding, bool VerifyStates)
+{
+    VERIFY_EXPR(pPSO != nullptr);
+    static_assert(TransitionResources || CommitResources, "At least one of TransitionResources or CommitResources flags is expected to be true");
+
+    auto* pPipelineStateNull = ValidatedCast<PipelineStateNullImpl>(pPSO);
+
+    if (pShaderResourceBinding == nullptr)
+    {
+#ifdef DILIGENT_DEVELOPMENT
+        bool ResourcesPresent = false;
+        for (Uint32 s = 0; s < pPipelineStateNull->GetNumShaderStages(); ++s)
+        {
+            if (pPipelineStateNull->GetShader(s)->GetNullResources()->GetNumResources() > 0)
+                ResourcesPresent = true;
+        }
+
+        if (ResourcesPresent)
+        {
+            LOG_ERROR_MESSAGE("Pipeline state '", pPSO->GetDesc().Name, "' requires shader resource binding object to ",
+                              (CommitResources ? "commit" : "transition"), " resources, but none is provided.");
+        }
+#endif
+        if (CommitResources)
+            m_pCommittedSRB.Release();
+        return;
+    }
+
+    auto* pShaderResBindingNull = ValidatedCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+#ifdef DILIGENT_DEVELOPMENT
+    if (pPipelineStateNull->IsIncompatibleWith(pShaderResourceBinding->GetPipelineState()))
+    {
+        LOG_ERROR_MESSAGE("Shader resource binding does not match Pipeline State");
+        return;
+    }
+#endif
+
+    const auto NumShaders = pShaderResBindingNull->GetNumActiveShaders();
+    VERIFY(NumShaders == pPipelineStateNull->GetNumShaderStages(), "Number of active shaders in shader resource binding is not consistent with the number of shaders in the pipeline state");
+
+#ifdef DILIGENT_DEVELOPMENT
+    {
+        bool StaticResourcesPresent = false;
+        for (Uint32 s = 0; s < pPipelineStateNull->GetNumStaticVarManagers(); ++s)
+        {
+            if (pPipelineStateNull->GetStaticVarManager(s).GetVariableCount() > 0)
+                StaticResourcesPresent = true;
+        }
+        // Static resource bindings are verified in InitializeStaticResources()
+        if (StaticResourcesPresent && !pShaderResBindingNull->IsStaticResourcesBound())
+        {
+            LOG_ERROR_MESSAGE("Static resources have not been initialized in the shader resource binding object being committed for PSO '", pPSO->GetDesc().Name, "'. Please call IShaderResourceBinding::InitializeStaticResources().");
+        }
+    }
+#endif
+
+    if (TransitionResources || VerifyStates)
+    {
+        const auto ProcessResource = [&](const ShaderResourcesNull::ResourceAttribs& Attribs, IDeviceObject* pObject) //
+        {
+            BufferNullImpl*  pBuffer       = nullptr;
+            TextureNullImpl* pTexture      = nullptr;
+            RESOURCE_STATE   RequiredState = RESOURCE_STATE_UNKNOWN;
+            switch (Attribs.Type)
+            {
+                case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+                    pBuffer       = ValidatedCast<BufferNullImpl>(pObject);
+                    RequiredState = RESOURCE_STATE_CONSTANT_BUFFER;
+                    break;
+
+                case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+                case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+                    pBuffer       = ValidatedCast<BufferViewNullImpl>(pObject)->GetBuffer<BufferNullImpl>();
+                    RequiredState = Attribs.Type == SHADER_RESOURCE_TYPE_BUFFER_UAV ? RESOURCE_STATE_UNORDERED_ACCESS : RESOURCE_STATE_SHADER_RESOURCE;
+                    break;
+
+                case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
+                case SHADER_RESOURCE_TYPE_TEXTURE_UAV:
+                    pTexture      = ValidatedCast<TextureViewNullImpl>(pObject)->GetTexture<TextureNullImpl>();
+                    RequiredState = Attribs.Type == SHADER_RESOURCE_TYPE_TEXTURE_UAV ? RESOURCE_STATE_UNORDERED_ACCESS : RESOURCE_STATE_SHADER_RESOURCE;
+                    // Input attachments declared as regular textures are read in the input attachment state
+                    if (RequiredState == RESOURCE_STATE_SHADER_RESOURCE && pTexture->IsInKnownState() && pTexture->CheckState(RESOURCE_STATE_INPUT_ATTACHMENT))
+                        return;
+                    break;
+
+                default:
+                    // Samplers, input attachments and acceleration structures require no transitions
+                    return;
+            }
+
+            const auto TransitionMode = TransitionResources ? RESOURCE_STATE_TRANSITION_MODE_TRANSITION : RESOURCE_STATE_TRANSITION_MODE_VERIFY;
+            if (pBuffer != nullptr)
+                TransitionOrVerifyBufferState(*pBuffer, TransitionMode, RequiredState, "Committing shader resources (DeviceContextNullImpl::CommitShaderResources)");
+            else if (pTexture != nullptr)
+                TransitionOrVerifyTextureState(*pTexture, TransitionMode, RequiredState, "Committing shader resources (DeviceContextNullImpl::CommitShaderResources)");
+        };
+
+        for (Uint32 s = 0; s < NumShaders; ++s)
+        {
+            pShaderResBindingNull->GetVarManager(s).ProcessBoundResources(ProcessResource);
+            // Static resources are kept by the pipeline state
+            if (s < pPipelineStateNull->GetNumStaticVarManagers())
+                pPipelineStateNull->GetStaticVarManager(s).ProcessBoundResources(ProcessResource);
+        }
+    }
+
+    if (CommitResources)
+    {
+        if (m_pDevice->GetEngineCreateInfo().VerifyCommittedShaderResources)
+            m_pCommittedSRB = pShaderResBindingNull;
+    }
+}
+
+void DeviceContextNullImpl::TransitionShaderResources(IPipelineState* pPipelineState, IShaderResourceBinding* pShaderResourceBinding)
+{
+    DEV_CHECK_ERR(pPipelineState != nullptr, "Pipeline state must not be null");
+    DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "Shader resource binding must not be null");
+    if (m_pActiveRenderPass)
+    {
+        LOG_ERROR_MESSAGE("State transitions are not allowed inside a render pass.");
+        return;
+    }
+
+    TransitionAndCommitShaderResources<true, false>(pPipelineState, pShaderResourceBinding, false);
+    ++m_Counters.CommandCount;
+    ++m_Counters.ShaderResourceCommits;
+}
+
+void DeviceContextNullImpl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    if (!TDeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/))
+        return;
+
+    if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+        TransitionAndCommitShaderResources<true, true>(m_pPipelineState, pShaderResourceBinding, false);
+    else
+        TransitionAndCommitShaderResources<false, true>(m_pPipelineState, pShaderResourceBinding, StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.ShaderResourceCommits;
+}
+
+void DeviceContextNullImpl::SetStencilRef(Uint32 StencilRef)
+{
+    if (TDeviceContextBase::SetStencilRef(StencilRef, 0))
+        ++m_Counters.CommandCount;
+}
+
+void DeviceContextNullImpl::SetBlendFactors(const float* pBlendFactors)
+{
+    if (TDeviceContextBase::SetBlendFactors(pBlendFactors, 0))
+        ++m_Counters.CommandCount;
+}
+
+void DeviceContextNullImpl::SetVertexBuffers(Uint32                         StartSlot,
+                                             Uint32                         NumBuffersSet,
+                                             IBuffer**                      ppBuffers,
+                                             Uint32*                        pOffsets,
+                                             RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                             SET_VERTEX_BUFFERS_FLAGS       Flags)
+{
+    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+    for (Uint32 Slot = 0; Slot < m_NumVertexStreams; ++Slot)
+    {
+        if (auto* pBufferNull = m_VertexStreams[Slot].pBuffer.RawPtr())
+        {
+            TransitionOrVerifyBufferState(*pBufferNull, StateTransitionMode, RESOURCE_STATE_VERTEX_BUFFER,
+                                          "Setting vertex buffers (DeviceContextNullImpl::SetVertexBuffers)");
+        }
+    }
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.VertexBufferBinds;
+}
+
+void DeviceContextNullImpl::InvalidateState()
+{
+    TDeviceContextBase::InvalidateState();
+    m_pCommittedSRB.Release();
+}
+
+void DeviceContextNullImpl::SetIndexBuffer(IBuffer* pIndexBuffer, Uint32 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+    if (m_pIndexBuffer)
+    {
+        TransitionOrVerifyBufferState(*m_pIndexBuffer, StateTransitionMode, RESOURCE_STATE_INDEX_BUFFER,
+                                      "Setting index buffer (DeviceContextNullImpl::SetIndexBuffer)");
+    }
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.IndexBufferBinds;
+}
+
+void DeviceContextNullImpl::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+    VERIFY(NumViewports == m_NumViewports, "Unexpected number of viewports");
+    ++m_Counters.CommandCount;
+}
+
+void DeviceContextNullImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+    VERIFY(NumRects == m_NumScissorRects, "Unexpected number of scissor rects");
+    ++m_Counters.CommandCount;
+}
+
+void DeviceContextNullImpl::SetRenderTargets(Uint32                         NumRenderTargets,
+                                             ITextureView*                  ppRenderTargets[],
+                                             ITextureView*                  pDepthStencil,
+                                             RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+#ifdef DILIGENT_DEVELOPMENT
+    if (m_pActiveRenderPass != nullptr)
+    {
+        LOG_ERROR_MESSAGE("Calling SetRenderTargets inside active render pass is invalid. End the render pass first");
+        return;
+    }
+#endif
+
+    if (TDeviceContextBase::SetRenderTargets(NumRenderTargets, ppRenderTargets, pDepthStencil))
+    {
+        for (Uint32 RT = 0; RT < NumRenderTargets; ++RT)
+        {
+            if (ppRenderTargets[RT])
+            {
+                auto* pTexNull = ValidatedCast<TextureNullImpl>(ppRenderTargets[RT]->GetTexture());
+                TransitionOrVerifyTextureState(*pTexNull, StateTransitionMode, RESOURCE_STATE_RENDER_TARGET,
+                                               "Setting render targets (DeviceContextNullImpl::SetRenderTargets)");
+            }
+        }
+
+        if (pDepthStencil)
+        {
+            auto* pTexNull = ValidatedCast<TextureNullImpl>(pDepthStencil->GetTexture());
+            TransitionOrVerifyTextureState(*pTexNull, StateTransitionMode, RESOURCE_STATE_DEPTH_WRITE,
+                                           "Setting depth-stencil buffer (DeviceContextNullImpl::SetRenderTargets)");
+        }
+
+        // Set the viewport to match the render target size
+        SetViewports(1, nullptr, 0, 0);
+
+        ++m_Counters.CommandCount;
+        ++m_Counters.RenderTargetChanges;
+    }
+}
+
+void DeviceContextNullImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    // BeginRenderPass() transitions resources to required states
+    TDeviceContextBase::BeginRenderPass(Attribs);
+
+    // Set the viewport to match the framebuffer size
+    SetViewports(1, nullptr, 0, 0);
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.RenderPasses;
+}
+
+void DeviceContextNullImpl::NextSubpass()
+{
+    TDeviceContextBase::NextSubpass();
+    ++m_Counters.CommandCount;
+}
+
+void DeviceContextNullImpl::EndRenderPass()
+{
+    TDeviceContextBase::EndRenderPass();
+    ++m_Counters.CommandCount;
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void DeviceContextNullImpl::DvpVerifyCommittedResources()
+{
+    if (!m_pDevice->GetEngineCreateInfo().VerifyCommittedShaderResources)
+        return;
+
+    if (!m_pCommittedSRB)
+    {
+        for (Uint32 s = 0; s < m_pPipelineState->GetNumShaderStages(); ++s)
+        {
+            if (m_pPipelineState->GetShader(s)->GetNullResources()->GetNumResources() > 0)
+            {
+                LOG_ERROR_MESSAGE("No shader resource binding object is committed for pipeline state '", m_pPipelineState->GetDesc().Name,
+                                  "' that uses shader resources. Call IDeviceContext::CommitShaderResources().");
+                return;
+            }
+        }
+        return;
+    }
+
+    if (m_pPipelineState->IsIncompatibleWith(m_pCommittedSRB->GetPipelineState()))
+    {
+        LOG_ERROR_MESSAGE("The shader resource binding object committed last is not compatible with the currently bound pipeline state '",
+                          m_pPipelineState->GetDesc().Name, "'. Call IDeviceContext::CommitShaderResources() after changing the pipeline.");
+        return;
+    }
+
+    for (Uint32 s = 0; s < m_pCommittedSRB->GetNumActiveShaders(); ++s)
+    {
+        if (!m_pCommittedSRB->GetVarManager(s).DvpVerifyBindings())
+        {
+            LOG_ERROR_MESSAGE("Not all mutable and dynamic resources of shader '", m_pPipelineState->GetShader(s)->GetDesc().Name,
+                              "' in pipeline '", m_pPipelineState->GetDesc().Name, "' are bound.");
+        }
+    }
+    for (Uint32 s = 0; s < m_pPipelineState->GetNumStaticVarManagers(); ++s)
+    {
+        if (!m_pPipelineState->GetStaticVarManager(s).DvpVerifyBindings())
+        {
+            LOG_ERROR_MESSAGE("Not all static resources of shader '", m_pPipelineState->GetShader(s)->GetDesc().Name,
+                              "' in pipeline '", m_pPipelineState->GetDesc().Name, "' are bound.");
+        }
+    }
+}
+#endif
+
+void DeviceContextNullImpl::PrepareForDraw(DRAW_FLAGS Flags)
+{
+#ifdef DILIGENT_DEVELOPMENT
+    if ((Flags & DRAW_FLAG_VERIFY_RENDER_TARGETS) != 0)
+        DvpVerifyRenderTargets();
+
+    if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
+    {
+        for (Uint32 Slot = 0; Slot < m_NumVertexStreams; ++Slot)
+        {
+            if (auto* pBufferNull = m_VertexStreams[Slot].pBuffer.RawPtr())
+            {
+                DvpVerifyBufferState(*pBufferNull, RESOURCE_STATE_VERTEX_BUFFER, "Using vertex buffers (DeviceContextNullImpl::Draw)");
+            }
+        }
+    }
+
+    DvpVerifyCommittedResources();
+#endif
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.DrawCount;
+}
+
+void DeviceContextNullImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags)
+{
+    PrepareForDraw(Flags);
+
+#ifdef DILIGENT_DEVELOPMENT
+    if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
+    {
+        DvpVerifyBufferState(*m_pIndexBuffer, RESOURCE_STATE_INDEX_BUFFER, "Indexed draw call (DeviceContextNullImpl::Draw)");
+    }
+#endif
+}
+
+void DeviceContextNullImpl::PrepareForDispatch()
+{
+#ifdef DILIGENT_DEVELOPMENT
+    DvpVerifyCommittedResources();
+#endif
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.DispatchCount;
+}
+
+void DeviceContextNullImpl::Draw(const DrawAttribs& Attribs)
+{
+    if (!DvpVerifyDrawArguments(Attribs))
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
+{
+    if (!DvpVerifyDrawIndexedArguments(Attribs))
+        return;
+
+    PrepareForIndexedDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawArguments(Attribs))
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawIndexedArguments(Attribs))
+        return;
+
+    PrepareForIndexedDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndirect(const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
+{
+    if (!DvpVerifyDrawIndirectArguments(Attribs, pAttribsBuffer))
+        return;
+
+    TransitionOrVerifyBufferState(*ValidatedCast<BufferNullImpl>(pAttribsBuffer), Attribs.IndirectAttribsBufferStateTransitionMode,
+                                  RESOURCE_STATE_INDIRECT_ARGUMENT, "Indirect draw (DeviceContextNullImpl::DrawIndirect)");
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
+{
+    if (!DvpVerifyDrawIndexedIndirectArguments(Attribs, pAttribsBuffer))
+        return;
+
+    TransitionOrVerifyBufferState(*ValidatedCast<BufferNullImpl>(pAttribsBuffer), Attribs.IndirectAttribsBufferStateTransitionMode,
+                                  RESOURCE_STATE_INDIRECT_ARGUMENT, "Indirect draw (DeviceContextNullImpl::DrawIndexedIndirect)");
+    PrepareForIndexedDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawMesh(const DrawMeshAttribs& Attribs)
+{
+    if (!DvpVerifyDrawMeshArguments(Attribs))
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
+{
+    if (!DvpVerifyDrawMeshIndirectArguments(Attribs, pAttribsBuffer))
+        return;
+
+    TransitionOrVerifyBufferState(*ValidatedCast<BufferNullImpl>(pAttribsBuffer), Attribs.IndirectAttribsBufferStateTransitionMode,
+                                  RESOURCE_STATE_INDIRECT_ARGUMENT, "Indirect draw (DeviceContextNullImpl::DrawMeshIndirect)");
+    PrepareForDraw(Attribs.Flags);
+}
+
+void DeviceContextNullImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
+{
+    if (!DvpVerifyDispatchArguments(Attribs))
+        return;
+
+    PrepareForDispatch();
+}
+
+void DeviceContextNullImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
+{
+    if (!DvpVerifyDispatchIndirectArguments(Attribs, pAttribsBuffer))
+        return;
+
+    TransitionOrVerifyBufferState(*ValidatedCast<BufferNullImpl>(pAttribsBuffer), Attribs.IndirectAttribsBufferStateTransitionMode,
+                                  RESOURCE_STATE_INDIRECT_ARGUMENT, "Indirect dispatch (DeviceContextNullImpl::DispatchComputeIndirect)");
+    PrepareForDispatch();
+}
+
+
+void DeviceContextNullImpl::ClearDepthStencil(ITextureView*                  pView,
+                                              CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                              float                          fDepth,
+                                              Uint8                          Stencil,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    if (!TDeviceContextBase::ClearDepthStencil(pView))
+        return;
+
+    VERIFY_EXPR(pView != nullptr);
+
+    if (pView != m_pBoundDepthStencil)
+    {
+        // Clearing outside of the render pass requires the texture to be in copy destination state
+        auto* pTexNull = ValidatedCast<TextureNullImpl>(pView->GetTexture());
+        TransitionOrVerifyTextureState(*pTexNull, StateTransitionMode, RESOURCE_STATE_COPY_DEST,
+                                       "Clearing depth-stencil buffer outside of render pass (DeviceContextNullImpl::ClearDepthStencil)");
+    }
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.ClearCount;
+}
+
+void DeviceContextNullImpl::ClearRenderTarget(ITextureView* pView, const float* RGBA, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    if (!TDeviceContextBase::ClearRenderTarget(pView))
+        return;
+
+    VERIFY_EXPR(pView != nullptr);
+
+    bool IsBound = false;
+    for (Uint32 RT = 0; RT < m_NumBoundRenderTargets; ++RT)
+    {
+        if (m_pBoundRenderTargets[RT] == pView)
+            IsBound = true;
+    }
+    if (!IsBound)
+    {
+        auto* pTexNull = ValidatedCast<TextureNullImpl>(pView->GetTexture());
+        TransitionOrVerifyTextureState(*pTexNull, StateTransitionMode, RESOURCE_STATE_COPY_DEST,
+                                       "Clearing render target outside of render pass (DeviceContextNullImpl::ClearRenderTarget)");
+    }
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.ClearCount;
+}
+
+void DeviceContextNullImpl::Flush()
+{
+    if (m_pActiveRenderPass != nullptr)
+    {
+        LOG_ERROR_MESSAGE("Flushing device context inside an active render pass.");
+    }
+}
+
+void DeviceContextNullImpl::UpdateBuffer(IBuffer*                       pBuffer,
+                                         Uint32                         Offset,
+                                         Uint32                         Size,
+                                         const void*                    pData,
+                                         RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::UpdateBuffer(pBuffer, Offset, Size, pData, StateTransitionMode);
+
+    auto* pBufferNull = ValidatedCast<BufferNullImpl>(pBuffer);
+    TransitionOrVerifyBufferState(*pBufferNull, StateTransitionMode, RESOURCE_STATE_COPY_DEST, "Updating buffer (DeviceContextNullImpl::UpdateBuffer)");
+    pBufferNull->UpdateData(Offset, Size, pData);
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.BufferUpdates;
+}
+
+void DeviceContextNullImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
+                                       Uint32                         SrcOffset,
+                                       RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                       IBuffer*                       pDstBuffer,
+                                       Uint32                         DstOffset,
+                                       Uint32                         Size,
+                                       RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    TDeviceContextBase::CopyBuffer(pSrcBuffer, SrcOffset, SrcBufferTransitionMode, pDstBuffer, DstOffset, Size, DstBufferTransitionMode);
+
+    auto* pSrcBufferNull = ValidatedCast<BufferNullImpl>(pSrcBuffer);
+    auto* pDstBufferNull = ValidatedCast<BufferNullImpl>(pDstBuffer);
+    TransitionOrVerifyBufferState(*pSrcBufferNull, SrcBufferTransitionMode, RESOURCE_STATE_COPY_SOURCE, "Using buffer as copy source (DeviceContextNullImpl::CopyBuffer)");
+    TransitionOrVerifyBufferState(*pDstBufferNull, DstBufferTransitionMode, RESOURCE_STATE_COPY_DEST, "Using buffer as copy destination (DeviceContextNullImpl::CopyBuffer)");
+    pDstBufferNull->CopyData(*pSrcBufferNull, SrcOffset, DstOffset, Size);
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.BufferUpdates;
+}
+
+void DeviceContextNullImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
+{
+    TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
+    ValidatedCast<BufferNullImpl>(pBuffer)->Map(MapType, MapFlags, pMappedData);
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.MapCount;
+}
+
+void DeviceContextNullImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
+{
+    TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
+    ValidatedCast<BufferNullImpl>(pBuffer)->Unmap(MapType);
+}
+
+void DeviceContextNullImpl::UpdateTexture(ITexture*                      pTexture,
+                                          Uint32                         MipLevel,
+                                          Uint32                         Slice,
+                                          const Box&                     DstBox,
+                                          const TextureSubResData&       SubresData,
+                                          RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                          RESOURCE_STATE_TRANSITION_MODE TextureTransitionMode)
+{
+    TDeviceContextBase::UpdateTexture(pTexture, MipLevel, Slice, DstBox, SubresData, SrcBufferTransitionMode, TextureTransitionMode);
+
+    auto* pTexNull = ValidatedCast<TextureNullImpl>(pTexture);
+    if (SubresData.pSrcBuffer != nullptr)
+    {
+        TransitionOrVerifyBufferState(*ValidatedCast<BufferNullImpl>(SubresData.pSrcBuffer), SrcBufferTransitionMode, RESOURCE_STATE_COPY_SOURCE,
+                                      "Using buffer as copy source (DeviceContextNullImpl::UpdateTexture)");
+    }
+    TransitionOrVerifyTextureState(*pTexNull, TextureTransitionMode, RESOURCE_STATE_COPY_DEST, "Updating texture (DeviceContextNullImpl::UpdateTexture)");
+    pTexNull->UpdateData(MipLevel, Slice, DstBox, SubresData);
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.TextureUpdates;
+}
+
+void DeviceContextNullImpl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
+{
+    TDeviceContextBase::CopyTexture(CopyAttribs);
+
+    auto* pSrcTexNull = ValidatedCast<TextureNullImpl>(CopyAttribs.pSrcTexture);
+    auto* pDstTexNull = ValidatedCast<TextureNullImpl>(CopyAttribs.pDstTexture);
+    TransitionOrVerifyTextureState(*pSrcTexNull, CopyAttribs.SrcTextureTransitionMode, RESOURCE_STATE_COPY_SOURCE, "Using texture as copy source (DeviceContextNullImpl::CopyTexture)");
+    TransitionOrVerifyTextureState(*pDstTexNull, CopyAttribs.DstTextureTransitionMode, RESOURCE_STATE_COPY_DEST, "Using texture as copy destination (DeviceContextNullImpl::CopyTexture)");
+
+    Box FullMipBox;
+    const auto* pSrcBox = CopyAttribs.pSrcBox;
+    if (pSrcBox == nullptr)
+    {
+        const auto MipInfo = GetMipLevelProperties(pSrcTexNull->GetDesc(), CopyAttribs.SrcMipLevel);
+        FullMipBox.MaxX    = MipInfo.LogicalWidth;
+        FullMipBox.MaxY    = MipInfo.LogicalHeight;
+        FullMipBox.MaxZ    = MipInfo.Depth;
+        pSrcBox            = &FullMipBox;
+    }
+    pDstTexNull->CopyData(*pSrcTexNull, CopyAttribs.SrcMipLevel, CopyAttribs.SrcSlice, *pSrcBox,
+                          CopyAttribs.DstMipLevel, CopyAttribs.DstSlice, CopyAttribs.DstX, CopyAttribs.DstY, CopyAttribs.DstZ);
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.TextureUpdates;
+}
+
+void DeviceContextNullImpl::MapTextureSubresource(ITexture*                 pTexture,
+                                                  Uint32                    MipLevel,
+                                                  Uint32                    ArraySlice,
+                                                  MAP_TYPE                  MapType,
+                                                  MAP_FLAGS                 MapFlags,
+                                                  const Box*                pMapRegion,
+                                                  MappedTextureSubresource& MappedData)
+{
+    TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
+
+    auto* pTexNull = ValidatedCast<TextureNullImpl>(pTexture);
+    MappedData     = pTexNull->GetSubresourceData(MipLevel, ArraySlice, pMapRegion);
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.MapCount;
+}
+
+void DeviceContextNullImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
+{
+    TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
+}
+
+void DeviceContextNullImpl::GenerateMips(ITextureView* pTexView)
+{
+    TDeviceContextBase::GenerateMips(pTexView);
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.TextureUpdates;
+}
+
+void DeviceContextNullImpl::FinishFrame()
+{
+    TDeviceContextBase::EndFrame();
+}
+
+void DeviceContextNullImpl::TransitionResourceStates(Uint32 BarrierCount, StateTransitionDesc* pResourceBarriers)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+
+    for (Uint32 i = 0; i < BarrierCount; ++i)
+    {
+        const auto& Barrier = pResourceBarriers[i];
+#ifdef DILIGENT_DEVELOPMENT
+        DvpVerifyStateTransitionDesc(Barrier);
+#endif
+        DEV_CHECK_ERR(Barrier.NewState != RESOURCE_STATE_UNKNOWN, "New resource state can't be unknown");
+
+        if (Barrier.TransitionType == STATE_TRANSITION_TYPE_BEGIN)
+        {
+            // Skip begin-split barriers
+            VERIFY(!Barrier.UpdateResourceState, "Resource state can't be updated in begin-split barrier");
+            continue;
+        }
+        VERIFY(Barrier.TransitionType == STATE_TRANSITION_TYPE_IMMEDIATE || Barrier.TransitionType == STATE_TRANSITION_TYPE_END, "Unexpected barrier type");
+
+        ++m_Counters.StateTransitions;
+        if (!Barrier.UpdateResourceState)
+            continue;
+
+        if (RefCntAutoPtr<ITexture> pTexture{Barrier.pResource, IID_Texture})
+        {
+            pTexture->SetState(Barrier.NewState);
+        }
+        else if (RefCntAutoPtr<IBuffer> pBuffer{Barrier.pResource, IID_Buffer})
+        {
+            pBuffer->SetState(Barrier.NewState);
+        }
+        else
+        {
+            UNEXPECTED("The type of resource '", Barrier.pResource->GetDesc().Name, "' is not supported in Null backend");
+        }
+    }
+
+    ++m_Counters.CommandCount;
+}
+
+void DeviceContextNullImpl::ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                      ITexture*                               pDstTexture,
+                                                      const ResolveTextureSubresourceAttribs& ResolveAttribs)
+{
+    TDeviceContextBase::ResolveTextureSubresource(pSrcTexture, pDstTexture, ResolveAttribs);
+
+    TransitionOrVerifyTextureState(*ValidatedCast<TextureNullImpl>(pSrcTexture), ResolveAttribs.SrcTextureTransitionMode, RESOURCE_STATE_RESOLVE_SOURCE,
+                                   "Resolving multi-sampled texture (DeviceContextNullImpl::ResolveTextureSubresource)");
+    TransitionOrVerifyTextureState(*ValidatedCast<TextureNullImpl>(pDstTexture), ResolveAttribs.DstTextureTransitionMode, RESOURCE_STATE_RESOLVE_DEST,
+                                   "Resolving multi-sampled texture (DeviceContextNullImpl::ResolveTextureSubresource)");
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.TextureUpdates;
+}
+
+void DeviceContextNullImpl::FinishCommandList(ICommandList** ppCommandList)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+
+    CommandListNullImpl* pCmdListNull(NEW_RC_OBJ(m_CmdListAllocator, "CommandListNullImpl instance", CommandListNullImpl)(m_pDevice, m_Counters));
+    pCmdListNull->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
+
+    // The counters are now owned by the command list
+    ResetCommandCounters();
+
+    // Device context is now in default state
+    InvalidateState();
+}
+
+void DeviceContextNullImpl::ExecuteCommandLists(Uint32               NumCommandLists,
+                                                ICommandList* const* ppCommandLists)
+{
+    if (m_bIsDeferred)
+    {
+        LOG_ERROR("Only immediate context can execute command list");
+        return;
+    }
+
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        const auto& ListCounters = ValidatedCast<CommandListNullImpl>(ppCommandLists[i])->GetCommandCounters();
+
+        m_Counters.CommandCount += ListCounters.CommandCount;
+        m_Counters.DrawCount += ListCounters.DrawCount;
+        m_Counters.DispatchCount += ListCounters.DispatchCount;
+        m_Counters.PipelineStateChanges += ListCounters.PipelineStateChanges;
+        m_Counters.ShaderResourceCommits += ListCounters.ShaderResourceCommits;
+        m_Counters.VertexBufferBinds += ListCounters.VertexBufferBinds;
+        m_Counters.IndexBufferBinds += ListCounters.IndexBufferBinds;
+        m_Counters.RenderTargetChanges += ListCounters.RenderTargetChanges;
+        m_Counters.RenderPasses += ListCounters.RenderPasses;
+        m_Counters.ClearCount += ListCounters.ClearCount;
+        m_Counters.BufferUpdates += ListCounters.BufferUpdates;
+        m_Counters.TextureUpdates += ListCounters.TextureUpdates;
+        m_Counters.MapCount += ListCounters.MapCount;
+        m_Counters.StateTransitions += ListCounters.StateTransitions;
+        m_Counters.QueryCount += ListCounters.QueryCount;
+        m_Counters.CommandListsExecuted += ListCounters.CommandListsExecuted + 1;
+    }
+
+    // Device context is now in default state
+    InvalidateState();
+}
+
+void DeviceContextNullImpl::SignalFence(IFence* pFence, Uint64 Value)
+{
+    VERIFY(!m_bIsDeferred, "Fence can only be signaled from immediate context");
+    // Commands complete immediately, so the fence is signaled right away
+    ValidatedCast<FenceNullImpl>(pFence)->Signal(Value);
+    ++m_Counters.CommandCount;
+}
+
+void DeviceContextNullImpl::WaitForFence(IFence* pFence, Uint64 Value, bool FlushContext)
+{
+    VERIFY(!m_bIsDeferred, "Fence can only be waited from immediate context");
+    if (FlushContext)
+        Flush();
+}
+
+void DeviceContextNullImpl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    VERIFY(!m_bIsDeferred, "Fence can only be waited from immediate context");
+    // Fences are signaled when the signal command is recorded, so the value must have been reached
+    DEV_CHECK_ERR(pFence->GetCompletedValue() >= Value, "Fence '", pFence->GetDesc().Name, "' has not been signaled with value ", Value,
+                  ". The wait can never complete and would deadlock the GPU in backends that use multiple queues.");
+}
+
+void DeviceContextNullImpl::WaitForIdle()
+{
+    VERIFY(!m_bIsDeferred, "Only immediate contexts can be idled");
+    Flush();
+}
+
+void DeviceContextNullImpl::BeginQuery(IQuery* pQuery)
+{
+    if (!TDeviceContextBase::BeginQuery(pQuery, 0))
+        return;
+
+    ValidatedCast<QueryNullImpl>(pQuery)->RecordBeginTime();
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.QueryCount;
+}
+
+void DeviceContextNullImpl::EndQuery(IQuery* pQuery)
+{
+    if (!TDeviceContextBase::EndQuery(pQuery, 0))
+        return;
+
+    ValidatedCast<QueryNullImpl>(pQuery)->RecordEndTime();
+
+    ++m_Counters.CommandCount;
+    ++m_Counters.QueryCount;
+}
+
+void DeviceContextNullImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildBLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildTLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::CopyBLAS(const CopyBLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyBLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::CopyTLAS(const CopyTLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyTLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteBLASCompactedSize is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteTLASCompactedSize is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::TraceRays(const TraceRaysAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRays is not supported in Null backend");
+}
+
+} // namespace Diligent
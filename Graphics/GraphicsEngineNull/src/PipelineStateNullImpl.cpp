@@ -0,0 +1,240 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineStateNullImpl.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+#include "FixedLinearAllocator.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+template <typename PSOCreateInfoType>
+void PipelineStateNullImpl::InitInternalObjects(const PSOCreateInfoType& CreateInfo)
+{
+    m_ResourceLayoutIndex.fill(-1);
+
+    std::vector<ShaderNullImpl*> Shaders;
+    ExtractShaders<ShaderNullImpl>(CreateInfo, Shaders);
+
+    const auto NumShaderStages = GetNumShaderStages();
+    VERIFY_EXPR(NumShaderStages > 0 && NumShaderStages == Shaders.size());
+
+    FixedLinearAllocator MemPool{GetRawAllocator()};
+
+    MemPool.AddSpace<ShaderVariableManagerNull>(NumShaderStages);
+
+    ReserveSpaceForPipelineDesc(CreateInfo, MemPool);
+
+    MemPool.Reserve();
+
+    m_pStaticVarManagers = MemPool.Allocate<ShaderVariableManagerNull>(NumShaderStages);
+
+    // The memory is now owned by PipelineStateNullImpl and will be freed by Destruct().
+    auto* Ptr = MemPool.ReleaseOwnership();
+    VERIFY_EXPR(Ptr == m_pStaticVarManagers);
+    (void)Ptr;
+
+    InitializePipelineDesc(CreateInfo, MemPool);
+
+    const auto& ResourceLayout = m_Desc.ResourceLayout;
+#ifdef DILIGENT_DEVELOPMENT
+    {
+        const ShaderResourcesNull* pResources[MAX_SHADERS_IN_PIPELINE] = {};
+        for (Uint32 s = 0; s < Shaders.size(); ++s)
+        {
+            pResources[s] = Shaders[s]->GetNullResources().get();
+        }
+        ShaderResourcesNull::DvpVerifyResourceLayout(ResourceLayout, pResources, NumShaderStages,
+                                                     (CreateInfo.Flags & PSO_CREATE_FLAG_IGNORE_MISSING_VARIABLES) == 0,
+                                                     (CreateInfo.Flags & PSO_CREATE_FLAG_IGNORE_MISSING_IMMUTABLE_SAMPLERS) == 0);
+    }
+#endif
+
+    m_Shaders.reserve(NumShaderStages);
+    for (Uint32 s = 0; s < NumShaderStages; ++s)
+    {
+        auto* pShader = Shaders[s];
+        m_Shaders.emplace_back(pShader);
+        HashCombine(m_ShaderResourceLayoutHash, pShader->GetNullResources()->GetHash());
+
+        // Static variable manager will only contain static variables
+        const SHADER_RESOURCE_VARIABLE_TYPE StaticVarTypes[] = {SHADER_RESOURCE_VARIABLE_TYPE_STATIC};
+        new (m_pStaticVarManagers + s) ShaderVariableManagerNull{*this, pShader->GetNullResources(), ResourceLayout, StaticVarTypes, _countof(StaticVarTypes)};
+        ++m_NumStaticVarManagers;
+
+        const auto ShaderInd             = GetShaderTypePipelineIndex(pShader->GetDesc().ShaderType, m_Desc.PipelineType);
+        m_ResourceLayoutIndex[ShaderInd] = static_cast<Int8>(s);
+    }
+}
+
+PipelineStateNullImpl::PipelineStateNullImpl(IReferenceCounters*                    pRefCounters,
+                                             RenderDeviceNullImpl*                  pDeviceNull,
+                                             const GraphicsPipelineStateCreateInfo& CreateInfo) :
+    // clang-format off
+    TPipelineStateBase
+    {
+        pRefCounters,
+        pDeviceNull,
+        CreateInfo
+    }
+// clang-format on
+{
+    try
+    {
+        InitInternalObjects(CreateInfo);
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+PipelineStateNullImpl::PipelineStateNullImpl(IReferenceCounters*                   pRefCounters,
+                                             RenderDeviceNullImpl*                 pDeviceNull,
+                                             const ComputePipelineStateCreateInfo& CreateInfo) :
+    // clang-format off
+    TPipelineStateBase
+    {
+        pRefCounters,
+        pDeviceNull,
+        CreateInfo
+    }
+// clang-format on
+{
+    try
+    {
+        InitInternalObjects(CreateInfo);
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+PipelineStateNullImpl::~PipelineStateNullImpl()
+{
+    Destruct();
+}
+
+void PipelineStateNullImpl::Destruct()
+{
+    TPipelineStateBase::Destruct();
+
+    for (Uint32 s = 0; s < m_NumStaticVarManagers; ++s)
+    {
+        m_pStaticVarManagers[s].~ShaderVariableManagerNull();
+    }
+    m_NumStaticVarManagers = 0;
+
+    // All subobjects are allocated in contiguous chunks of memory.
+    if (auto* pRawMem = m_pStaticVarManagers)
+        GetRawAllocator().Free(pRawMem);
+    m_pStaticVarManagers = nullptr;
+}
+
+void PipelineStateNullImpl::BindStaticResources(Uint32 ShaderFlags, IResourceMapping* pResourceMapping, Uint32 Flags)
+{
+    for (Uint32 s = 0; s < m_NumStaticVarManagers; ++s)
+    {
+        auto& StaticVarMgr = m_pStaticVarManagers[s];
+        if ((ShaderFlags & StaticVarMgr.GetShaderType()) != 0)
+            StaticVarMgr.BindResources(pResourceMapping, Flags);
+    }
+}
+
+Uint32 PipelineStateNullImpl::GetStaticVariableCount(SHADER_TYPE ShaderType) const
+{
+    const auto LayoutInd = GetStaticVariableCountHelper(ShaderType, m_ResourceLayoutIndex);
+    if (LayoutInd < 0)
+        return 0;
+
+    VERIFY_EXPR(static_cast<Uint32>(LayoutInd) < m_NumStaticVarManagers);
+    return m_pStaticVarManagers[LayoutInd].GetVariableCount();
+}
+
+IShaderResourceVariable* PipelineStateNullImpl::GetStaticVariableByName(SHADER_TYPE ShaderType, const Char* Name)
+{
+    const auto LayoutInd = GetStaticVariableByNameHelper(ShaderType, Name, m_ResourceLayoutIndex);
+    if (LayoutInd < 0)
+        return nullptr;
+
+    VERIFY_EXPR(static_cast<Uint32>(LayoutInd) < m_NumStaticVarManagers);
+    return m_pStaticVarManagers[LayoutInd].GetVariable(Name);
+}
+
+IShaderResourceVariable* PipelineStateNullImpl::GetStaticVariableByIndex(SHADER_TYPE ShaderType, Uint32 Index)
+{
+    const auto LayoutInd = GetStaticVariableByIndexHelper(ShaderType, Index, m_ResourceLayoutIndex);
+    if (LayoutInd < 0)
+        return nullptr;
+
+    VERIFY_EXPR(static_cast<Uint32>(LayoutInd) < m_NumStaticVarManagers);
+    return m_pStaticVarManagers[LayoutInd].GetVariable(Index);
+}
+
+void PipelineStateNullImpl::CreateShaderResourceBinding(IShaderResourceBinding** ppShaderResourceBinding, bool InitStaticResources)
+{
+    auto& SRBAllocator      = GetDevice()->GetSRBAllocator();
+    auto  pShaderResBinding = NEW_RC_OBJ(SRBAllocator, "ShaderResourceBindingNullImpl instance", ShaderResourceBindingNullImpl)(this, false);
+    if (InitStaticResources)
+        pShaderResBinding->InitializeStaticResources(nullptr);
+    pShaderResBinding->QueryInterface(IID_ShaderResourceBinding, reinterpret_cast<IObject**>(static_cast<IShaderResourceBinding**>(ppShaderResourceBinding)));
+}
+
+bool PipelineStateNullImpl::IsCompatibleWith(const IPipelineState* pPSO) const
+{
+    VERIFY_EXPR(pPSO != nullptr);
+
+    if (pPSO == this)
+        return true;
+
+    const auto* pPSONull = ValidatedCast<const PipelineStateNullImpl>(pPSO);
+    if (m_ShaderResourceLayoutHash != pPSONull->m_ShaderResourceLayoutHash)
+        return false;
+
+    if (GetNumShaderStages() != pPSONull->GetNumShaderStages())
+        return false;
+
+    for (Uint32 s = 0; s < GetNumShaderStages(); ++s)
+    {
+        const auto* pShader0 = GetShader(s);
+        const auto* pShader1 = pPSONull->GetShader(s);
+        if (pShader0->GetDesc().ShaderType != pShader1->GetDesc().ShaderType)
+            return false;
+        if (!pShader0->GetNullResources()->IsCompatibleWith(*pShader1->GetNullResources()))
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace Diligent
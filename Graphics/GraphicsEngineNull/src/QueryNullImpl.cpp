@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include <chrono>
+
+#include "QueryNullImpl.hpp"
+
+namespace Diligent
+{
+
+static constexpr Uint64 CPUTimerFrequency = 1000000000; // Timestamps are measured in nanoseconds
+
+static Uint64 GetCPUTimestamp()
+{
+    const auto Now = std::chrono::high_resolution_clock::now().time_since_epoch();
+    return static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Now).count());
+}
+
+QueryNullImpl::QueryNullImpl(IReferenceCounters*   pRefCounters,
+                             RenderDeviceNullImpl* pDevice,
+                             const QueryDesc&      Desc) :
+    // clang-format off
+    TQueryBase
+    {
+        pRefCounters,
+        pDevice,
+        Desc
+    }
+// clang-format on
+{
+}
+
+QueryNullImpl::~QueryNullImpl()
+{
+}
+
+void QueryNullImpl::RecordBeginTime()
+{
+    m_BeginTime = GetCPUTimestamp();
+}
+
+void QueryNullImpl::RecordEndTime()
+{
+    m_EndTime = GetCPUTimestamp();
+}
+
+bool QueryNullImpl::GetData(void* pData, Uint32 DataSize, bool AutoInvalidate)
+{
+    if (!TQueryBase::CheckQueryDataPtr(pData, DataSize))
+        return false;
+
+    if (pData != nullptr)
+    {
+        switch (m_Desc.Type)
+        {
+            case QUERY_TYPE_OCCLUSION:
+                reinterpret_cast<QueryDataOcclusion*>(pData)->NumSamples = 0;
+                break;
+
+            case QUERY_TYPE_BINARY_OCCLUSION:
+                reinterpret_cast<QueryDataBinaryOcclusion*>(pData)->AnySamplePassed = false;
+                break;
+
+            case QUERY_TYPE_TIMESTAMP:
+            {
+                auto& QueryData     = *reinterpret_cast<QueryDataTimestamp*>(pData);
+                QueryData.Counter   = m_EndTime;
+                QueryData.Frequency = CPUTimerFrequency;
+                break;
+            }
+
+            case QUERY_TYPE_PIPELINE_STATISTICS:
+            {
+                auto& QueryData               = *reinterpret_cast<QueryDataPipelineStatistics*>(pData);
+                QueryData.InputVertices       = 0;
+                QueryData.InputPrimitives     = 0;
+                QueryData.GSPrimitives        = 0;
+                QueryData.ClippingInvocations = 0;
+                QueryData.ClippingPrimitives  = 0;
+                QueryData.VSInvocations       = 0;
+                QueryData.GSInvocations       = 0;
+                QueryData.PSInvocations       = 0;
+                QueryData.HSInvocations       = 0;
+                QueryData.DSInvocations       = 0;
+                QueryData.CSInvocations       = 0;
+                break;
+            }
+
+            case QUERY_TYPE_DURATION:
+            {
+                auto& QueryData     = *reinterpret_cast<QueryDataDuration*>(pData);
+                QueryData.Duration  = m_EndTime - m_BeginTime;
+                QueryData.Frequency = CPUTimerFrequency;
+                break;
+            }
+
+            default:
+                UNEXPECTED("Unexpected query type");
+        }
+    }
+
+    if (pData != nullptr && AutoInvalidate)
+        Invalidate();
+
+    return true;
+}
+
+} // namespace Diligent
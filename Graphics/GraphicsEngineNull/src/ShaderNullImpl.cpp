@@ -0,0 +1,79 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderNullImpl.hpp"
+#include "ShaderToolsCommon.hpp"
+
+namespace Diligent
+{
+
+ShaderNullImpl::ShaderNullImpl(IReferenceCounters*     pRefCounters,
+                               RenderDeviceNullImpl*   pDeviceNull,
+                               const ShaderCreateInfo& ShaderCI) :
+    // clang-format off
+    TShaderBase
+    {
+        pRefCounters,
+        pDeviceNull,
+        ShaderCI.Desc
+    }
+// clang-format on
+{
+    if (ShaderCI.Source == nullptr && ShaderCI.FilePath == nullptr && ShaderCI.ByteCode == nullptr)
+        LOG_ERROR_AND_THROW("Shader source must be provided through one of the 'Source', 'FilePath' or 'ByteCode' members");
+
+    m_pShaderResources = std::make_shared<const ShaderResourcesNull>(ShaderCI);
+
+    if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
+    {
+        RefCntAutoPtr<IDataBlob> pFileData;
+        size_t                   SourceLen = 0;
+        const auto*              Source    = ReadShaderSourceFile(ShaderCI.Source, ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath, pFileData, SourceLen);
+
+        // There is no compiler, so the content is the source together with everything that affects its compilation
+        std::string Content{std::to_string(static_cast<int>(ShaderCI.SourceLanguage))};
+        Content.append(1, '\0').append(Source, SourceLen);
+        if (ShaderCI.Macros != nullptr)
+        {
+            for (const auto* pMacro = ShaderCI.Macros; pMacro->Name != nullptr && pMacro->Definition != nullptr; ++pMacro)
+                Content.append(1, '\0').append(pMacro->Name).append(1, '\0').append(pMacro->Definition);
+        }
+        InitContent(ShaderCI, Content.data(), Content.size());
+    }
+    else
+    {
+        InitContent(ShaderCI, ShaderCI.ByteCode, ShaderCI.ByteCodeSize);
+    }
+}
+
+ShaderNullImpl::~ShaderNullImpl()
+{
+}
+
+} // namespace Diligent
@@ -0,0 +1,175 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderResourceBindingNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "ShaderNullImpl.hpp"
+#include "EngineMemory.h"
+
+namespace Diligent
+{
+
+ShaderResourceBindingNullImpl::ShaderResourceBindingNullImpl(IReferenceCounters*    pRefCounters,
+                                                             PipelineStateNullImpl* pPSO,
+                                                             bool                   IsInternal) :
+    // clang-format off
+    TBase
+    {
+        pRefCounters,
+        pPSO,
+        IsInternal
+    }
+// clang-format on
+{
+    try
+    {
+        m_ResourceLayoutIndex.fill(-1);
+
+        const auto  NumShaders = pPSO->GetNumShaderStages();
+        const auto& PSODesc    = pPSO->GetDesc();
+
+        m_pVarManagers = ALLOCATE(GetRawAllocator(), "Raw memory for ShaderVariableManagerNull", ShaderVariableManagerNull, NumShaders);
+
+        for (Uint32 s = 0; s < NumShaders; ++s)
+        {
+            const auto* pShader = pPSO->GetShader(s);
+
+            // Variable managers of the SRB will only contain mutable and dynamic variables
+            const SHADER_RESOURCE_VARIABLE_TYPE VarTypes[] = {SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC};
+            new (m_pVarManagers + s) ShaderVariableManagerNull{*this, pShader->GetNullResources(), PSODesc.ResourceLayout, VarTypes, _countof(VarTypes)};
+            ++m_NumVarManagers;
+
+            const auto ShaderInd             = GetShaderTypePipelineIndex(pShader->GetDesc().ShaderType, PSODesc.PipelineType);
+            m_ResourceLayoutIndex[ShaderInd] = static_cast<Int8>(s);
+        }
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+ShaderResourceBindingNullImpl::~ShaderResourceBindingNullImpl()
+{
+    Destruct();
+}
+
+void ShaderResourceBindingNullImpl::Destruct()
+{
+    for (Uint32 s = 0; s < m_NumVarManagers; ++s)
+    {
+        m_pVarManagers[s].~ShaderVariableManagerNull();
+    }
+    m_NumVarManagers = 0;
+
+    if (void* pRawMem = m_pVarManagers)
+    {
+        GetRawAllocator().Free(pRawMem);
+    }
+    m_pVarManagers = nullptr;
+}
+
+void ShaderResourceBindingNullImpl::BindResources(Uint32 ShaderFlags, IResourceMapping* pResMapping, Uint32 Flags)
+{
+    for (Uint32 s = 0; s < m_NumVarManagers; ++s)
+    {
+        auto& VarMgr = m_pVarManagers[s];
+        if ((ShaderFlags & VarMgr.GetShaderType()) != 0)
+            VarMgr.BindResources(pResMapping, Flags);
+    }
+}
+
+void ShaderResourceBindingNullImpl::InitializeStaticResources(const IPipelineState* pPipelineState)
+{
+    if (m_bIsStaticResourcesBound)
+    {
+        LOG_WARNING_MESSAGE("Static resources have already been initialized in this shader resource binding object. The operation will be ignored.");
+        return;
+    }
+
+    if (pPipelineState == nullptr)
+    {
+        pPipelineState = GetPipelineState();
+    }
+    else
+    {
+        DEV_CHECK_ERR(pPipelineState->IsCompatibleWith(GetPipelineState()), "The pipeline state is not compatible with this SRB");
+    }
+
+#ifdef DILIGENT_DEVELOPMENT
+    // Static resources are kept by the pipeline state, so they only need to be verified
+    const auto* pPSONull = ValidatedCast<const PipelineStateNullImpl>(pPipelineState);
+    for (Uint32 s = 0; s < pPSONull->GetNumShaderStages(); ++s)
+    {
+        if (!pPSONull->GetStaticVarManager(s).DvpVerifyBindings())
+        {
+            LOG_ERROR_MESSAGE("Static resources in SRB of PSO '", pPSONull->GetDesc().Name,
+                              "' will not be successfully initialized because not all static resource bindings in shader '",
+                              pPSONull->GetShader(s)->GetDesc().Name,
+                              "' are valid. Please make sure you bind all static resources to PSO before calling InitializeStaticResources() "
+                              "directly or indirectly by passing InitStaticResources=true to CreateShaderResourceBinding() method.");
+        }
+    }
+#endif
+
+    m_bIsStaticResourcesBound = true;
+}
+
+IShaderResourceVariable* ShaderResourceBindingNullImpl::GetVariableByName(SHADER_TYPE ShaderType, const char* Name)
+{
+    auto ResLayoutInd = GetVariableByNameHelper(ShaderType, Name, m_ResourceLayoutIndex);
+    if (ResLayoutInd < 0)
+        return nullptr;
+
+    VERIFY_EXPR(static_cast<Uint32>(ResLayoutInd) < Uint32{m_NumVarManagers});
+    return m_pVarManagers[ResLayoutInd].GetVariable(Name);
+}
+
+Uint32 ShaderResourceBindingNullImpl::GetVariableCount(SHADER_TYPE ShaderType) const
+{
+    auto ResLayoutInd = GetVariableCountHelper(ShaderType, m_ResourceLayoutIndex);
+    if (ResLayoutInd < 0)
+        return 0;
+
+    VERIFY_EXPR(static_cast<Uint32>(ResLayoutInd) < Uint32{m_NumVarManagers});
+    return m_pVarManagers[ResLayoutInd].GetVariableCount();
+}
+
+IShaderResourceVariable* ShaderResourceBindingNullImpl::GetVariableByIndex(SHADER_TYPE ShaderType, Uint32 Index)
+{
+    auto ResLayoutInd = GetVariableByIndexHelper(ShaderType, Index, m_ResourceLayoutIndex);
+    if (ResLayoutInd < 0)
+        return nullptr;
+
+    VERIFY_EXPR(static_cast<Uint32>(ResLayoutInd) < Uint32{m_NumVarManagers});
+    return m_pVarManagers[ResLayoutInd].GetVariable(Index);
+}
+
+} // namespace Diligent
@@ -0,0 +1,651 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include <cctype>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ShaderResourcesNull.hpp"
+#include "ShaderToolsCommon.hpp"
+#include "ShaderResourceVariableBase.hpp"
+#include "GraphicsAccessories.hpp"
+#include "StringTools.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+class SourceTokenizer
+{
+public:
+    SourceTokenizer(IShaderSourceInputStreamFactory* pStreamFactory) :
+        m_pStreamFactory{pStreamFactory}
+    {}
+
+    void Tokenize(const char* Source, size_t Length, Uint32 IncludeDepth)
+    {
+        // Protection against recursive includes
+        static constexpr Uint32 MaxIncludeDepth = 32;
+
+        const char* const End = Source + Length;
+
+        bool LineStart = true;
+        for (const char* c = Source; c < End;)
+        {
+            if (*c == '\n')
+            {
+                LineStart = true;
+                ++c;
+            }
+            else if (std::isspace(static_cast<unsigned char>(*c)))
+            {
+                ++c;
+            }
+            else if (c[0] == '/' && c + 1 < End && c[1] == '/')
+            {
+                while (c < End && *c != '\n')
+                    ++c;
+            }
+            else if (c[0] == '/' && c + 1 < End && c[1] == '*')
+            {
+                c += 2;
+                while (c < End && !(c[0] == '*' && c + 1 < End && c[1] == '/'))
+                    ++c;
+                c = std::min(c + 2, End);
+            }
+            else if (*c == '#' && LineStart)
+            {
+                // Read the preprocessor directive, taking line continuation into account
+                std::string Directive;
+                for (++c; c < End && *c != '\n'; ++c)
+                {
+                    if (*c == '\\' && c + 1 < End && (c[1] == '\n' || c[1] == '\r'))
+                    {
+                        while (c + 1 < End && c[1] != '\n')
+                            ++c;
+                        ++c;
+                        continue;
+                    }
+                    Directive.push_back(*c);
+                }
+                if (IncludeDepth < MaxIncludeDepth)
+                    ProcessDirective(Directive, IncludeDepth);
+            }
+            else if (std::isalpha(static_cast<unsigned char>(*c)) || *c == '_')
+            {
+                const char* IdStart = c;
+                while (c < End && (std::isalnum(static_cast<unsigned char>(*c)) || *c == '_'))
+                    ++c;
+                AddIdentifier(String{IdStart, c}, IncludeDepth);
+                LineStart = false;
+            }
+            else if (std::isdigit(static_cast<unsigned char>(*c)))
+            {
+                const char* NumStart = c;
+                while (c < End && (std::isalnum(static_cast<unsigned char>(*c)) || *c == '.'))
+                    ++c;
+                m_Tokens.emplace_back(NumStart, c);
+                LineStart = false;
+            }
+            else if (*c == '"')
+            {
+                for (++c; c < End && *c != '"' && *c != '\n'; ++c)
+                    ;
+                if (c < End)
+                    ++c;
+                LineStart = false;
+            }
+            else
+            {
+                m_Tokens.emplace_back(1, *c);
+                LineStart = false;
+                ++c;
+            }
+        }
+    }
+
+    const std::vector<String>& GetTokens() const { return m_Tokens; }
+
+    // Object-like macros are expanded, so that e.g. array sizes defined by macros can be resolved.
+    // Function-like macros and conditional directives are ignored.
+    void DefineMacro(String Name, String Definition)
+    {
+        m_Macros[std::move(Name)] = std::move(Definition);
+    }
+
+private:
+    void AddIdentifier(String Identifier, Uint32 IncludeDepth)
+    {
+        auto it = m_Macros.find(Identifier);
+        // Do not expand recursive macros
+        if (it == m_Macros.end() || !m_ExpandingMacros.insert(Identifier).second)
+        {
+            m_Tokens.emplace_back(std::move(Identifier));
+            return;
+        }
+
+        const auto Definition = it->second;
+        Tokenize(Definition.c_str(), Definition.length(), IncludeDepth);
+        m_ExpandingMacros.erase(Identifier);
+    }
+
+    void ProcessDirective(const std::string& Directive, Uint32 IncludeDepth)
+    {
+        auto Pos = Directive.find_first_not_of(" \t");
+        if (Pos == std::string::npos)
+            return;
+
+        if (Directive.compare(Pos, 6, "define") == 0)
+        {
+            const auto NameStart = Directive.find_first_not_of(" \t", Pos + 6);
+            if (NameStart == std::string::npos)
+                return;
+            auto NameEnd = NameStart;
+            while (NameEnd < Directive.length() && (std::isalnum(static_cast<unsigned char>(Directive[NameEnd])) || Directive[NameEnd] == '_'))
+                ++NameEnd;
+            if (NameEnd == NameStart || (NameEnd < Directive.length() && Directive[NameEnd] == '('))
+                return;
+            DefineMacro(Directive.substr(NameStart, NameEnd - NameStart), Directive.substr(NameEnd));
+            return;
+        }
+
+        if (Directive.compare(Pos, 7, "include") != 0)
+            return;
+
+        const auto NameStart = Directive.find_first_of("\"<", Pos + 7);
+        if (NameStart == std::string::npos)
+            return;
+        const auto NameEnd = Directive.find_first_of(Directive[NameStart] == '<' ? ">" : "\"", NameStart + 1);
+        if (NameEnd == std::string::npos)
+            return;
+
+        const auto IncludeName = Directive.substr(NameStart + 1, NameEnd - NameStart - 1);
+        // Every file is only processed once as the declarations it contains will be found anyway
+        if (m_pStreamFactory == nullptr || !m_ProcessedIncludes.insert(IncludeName).second)
+            return;
+
+        RefCntAutoPtr<IDataBlob> pFileData;
+        size_t                   SourceLen = 0;
+        const auto*              Source    = ReadShaderSourceFile(nullptr, m_pStreamFactory, IncludeName.c_str(), pFileData, SourceLen);
+        Tokenize(Source, SourceLen, IncludeDepth + 1);
+    }
+
+    IShaderSourceInputStreamFactory* const m_pStreamFactory;
+
+    std::vector<String>             m_Tokens;
+    std::unordered_set<std::string> m_ProcessedIncludes;
+
+    std::unordered_map<String, String> m_Macros;
+    std::unordered_set<String>         m_ExpandingMacros;
+};
+
+bool ParseResourceDimension(const String& Suffix, RESOURCE_DIMENSION& Dim, bool& IsMS)
+{
+    struct DimInfo
+    {
+        const char*        Suffix;
+        RESOURCE_DIMENSION Dim;
+        bool               IsMS;
+    };
+    // clang-format off
+    static constexpr DimInfo DimInfos[] =
+    {
+        {"1D",        RESOURCE_DIM_TEX_1D,         false},
+        {"1DArray",   RESOURCE_DIM_TEX_1D_ARRAY,   false},
+        {"2D",        RESOURCE_DIM_TEX_2D,         false},
+        {"2DRect",    RESOURCE_DIM_TEX_2D,         false},
+        {"2DArray",   RESOURCE_DIM_TEX_2D_ARRAY,   false},
+        {"2DMS",      RESOURCE_DIM_TEX_2D,         true },
+        {"2DMSArray", RESOURCE_DIM_TEX_2D_ARRAY,   true },
+        {"3D",        RESOURCE_DIM_TEX_3D,         false},
+        {"Cube",      RESOURCE_DIM_TEX_CUBE,       false},
+        {"CubeArray", RESOURCE_DIM_TEX_CUBE_ARRAY, false},
+        {"Buffer",    RESOURCE_DIM_BUFFER,         false},
+    };
+    // clang-format on
+
+    auto DimSuffix = Suffix;
+    // GLSL shadow samplers, e.g. sampler2DShadow
+    static constexpr char ShadowSuffix[] = "Shadow";
+    if (DimSuffix.size() > sizeof(ShadowSuffix) - 1 && DimSuffix.compare(DimSuffix.size() - (sizeof(ShadowSuffix) - 1), std::string::npos, ShadowSuffix) == 0)
+        DimSuffix.resize(DimSuffix.size() - (sizeof(ShadowSuffix) - 1));
+
+    for (const auto& Info : DimInfos)
+    {
+        if (DimSuffix == Info.Suffix)
+        {
+            Dim  = Info.Dim;
+            IsMS = Info.IsMS;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool HasPrefix(const String& Str, const char* Prefix, String& Suffix)
+{
+    const auto PrefixLen = strlen(Prefix);
+    if (Str.compare(0, PrefixLen, Prefix) != 0)
+        return false;
+    Suffix = Str.substr(PrefixLen);
+    return true;
+}
+
+// Parses the resource name and optional array dimensions starting at token Pos, e.g. 'g_Textures[4]'
+bool ParseNameAndArraySize(const std::vector<String>& Tokens, size_t Pos, String& Name, Uint32& ArraySize)
+{
+    if (Pos >= Tokens.size())
+        return false;
+
+    Name = Tokens[Pos];
+    if (!(std::isalpha(static_cast<unsigned char>(Name[0])) || Name[0] == '_'))
+        return false;
+    // Function declaration
+    if (Pos + 1 < Tokens.size() && Tokens[Pos + 1] == "(")
+        return false;
+
+    ArraySize = 1;
+    for (Pos = Pos + 1; Pos + 2 < Tokens.size() && Tokens[Pos] == "["; Pos += 3)
+    {
+        // Array sizes that are not integer literals after macro expansion are treated as 1.
+        const auto& Size = Tokens[Pos + 1];
+        if (!Size.empty() && std::isdigit(static_cast<unsigned char>(Size[0])))
+            ArraySize *= static_cast<Uint32>(std::max(std::stoul(Size), 1ul));
+        if (Tokens[Pos + 2] != "]")
+            break;
+    }
+    return true;
+}
+
+// Skips template arguments, e.g. '<float4>', starting at token Pos
+size_t SkipTemplateArguments(const std::vector<String>& Tokens, size_t Pos)
+{
+    if (Pos >= Tokens.size() || Tokens[Pos] != "<")
+        return Pos;
+
+    int Depth = 0;
+    for (; Pos < Tokens.size(); ++Pos)
+    {
+        if (Tokens[Pos] == "<")
+            ++Depth;
+        else if (Tokens[Pos] == ">" && --Depth == 0)
+            return Pos + 1;
+    }
+    return Pos;
+}
+
+// Handles float, signed and unsigned GLSL opaque types, e.g. sampler2D, isampler2D, usampler2D
+bool HasGLSLTypePrefix(const String& TypeName, const char* Prefix, String& Suffix)
+{
+    if (HasPrefix(TypeName, Prefix, Suffix))
+        return true;
+
+    const auto PrefixLen = strlen(Prefix);
+    if ((TypeName[0] == 'i' || TypeName[0] == 'u') && TypeName.compare(1, PrefixLen, Prefix) == 0)
+    {
+        Suffix = TypeName.substr(PrefixLen + 1);
+        return true;
+    }
+    return false;
+}
+
+// Updates the scope depth and returns true if the token is located at global scope
+bool IsGlobalScopeToken(const String& Token, int& ScopeDepth)
+{
+    if (Token == "{" || Token == "(")
+    {
+        ++ScopeDepth;
+        return false;
+    }
+    else if (Token == "}" || Token == ")")
+    {
+        ScopeDepth = std::max(ScopeDepth - 1, 0);
+        return false;
+    }
+    return ScopeDepth == 0;
+}
+
+} // namespace
+
+
+ShaderResourcesNull::ShaderResourcesNull(const ShaderCreateInfo& ShaderCI) noexcept(false) :
+    // clang-format off
+    m_ShaderType           {ShaderCI.Desc.ShaderType},
+    m_ShaderName           {ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : ""},
+    m_CombinedSamplerSuffix{ShaderCI.UseCombinedTextureSamplers && ShaderCI.CombinedSamplerSuffix != nullptr ? ShaderCI.CombinedSamplerSuffix : ""}
+// clang-format on
+{
+    if (ShaderCI.Source == nullptr && ShaderCI.FilePath == nullptr)
+    {
+        // Shaders created from byte code can't be reflected
+        return;
+    }
+
+    RefCntAutoPtr<IDataBlob> pFileData;
+    size_t                   SourceLen = 0;
+    const auto*              Source    = ReadShaderSourceFile(ShaderCI.Source, ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath, pFileData, SourceLen);
+
+    SourceTokenizer Tokenizer{ShaderCI.pShaderSourceStreamFactory};
+    if (ShaderCI.Macros != nullptr)
+    {
+        for (const auto* pMacro = ShaderCI.Macros; pMacro->Name != nullptr && pMacro->Definition != nullptr; ++pMacro)
+            Tokenizer.DefineMacro(pMacro->Name, pMacro->Definition);
+    }
+    Tokenizer.Tokenize(Source, SourceLen, 0);
+
+    switch (ShaderCI.SourceLanguage)
+    {
+        case SHADER_SOURCE_LANGUAGE_DEFAULT:
+        case SHADER_SOURCE_LANGUAGE_HLSL:
+            ParseHLSL(Tokenizer.GetTokens());
+            break;
+
+        case SHADER_SOURCE_LANGUAGE_GLSL:
+        case SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM:
+            ParseGLSL(Tokenizer.GetTokens());
+            break;
+
+        default:
+            LOG_ERROR_AND_THROW("Shader source language is not supported by Null backend");
+    }
+}
+
+void ShaderResourcesNull::AddResource(String Name, SHADER_RESOURCE_TYPE Type, Uint32 ArraySize, RESOURCE_DIMENSION ResourceDim, bool IsMS)
+{
+    for (const auto& Res : m_Resources)
+    {
+        if (Res.Name == Name)
+            return;
+    }
+    m_Resources.emplace_back(std::move(Name), Type, ArraySize, ResourceDim, IsMS);
+}
+
+void ShaderResourcesNull::ParseHLSL(const std::vector<String>& Tokens)
+{
+    // HLSL compilers strip unreferenced resources, so resources whose name never appears
+    // after the declaration are skipped. Constant buffer blocks are referenced through their members.
+    std::unordered_map<String, Uint32> TokenCounts;
+    for (const auto& Token : Tokens)
+        ++TokenCounts[Token];
+
+    int ScopeDepth = 0;
+    for (size_t t = 0; t < Tokens.size(); ++t)
+    {
+        const auto& Token = Tokens[t];
+        if (!IsGlobalScopeToken(Token, ScopeDepth))
+            continue;
+
+        auto   Type = SHADER_RESOURCE_TYPE_UNKNOWN;
+        auto   Dim  = RESOURCE_DIM_UNDEFINED;
+        bool   IsMS = false;
+        String Suffix;
+        if (Token == "cbuffer" || Token == "ConstantBuffer")
+        {
+            Type = SHADER_RESOURCE_TYPE_CONSTANT_BUFFER;
+            Dim  = RESOURCE_DIM_BUFFER;
+        }
+        else if (Token == "StructuredBuffer" || Token == "ByteAddressBuffer" || Token == "Buffer")
+        {
+            Type = SHADER_RESOURCE_TYPE_BUFFER_SRV;
+            Dim  = RESOURCE_DIM_BUFFER;
+        }
+        else if (Token == "RWStructuredBuffer" || Token == "RWByteAddressBuffer" || Token == "RWBuffer" ||
+                 Token == "AppendStructuredBuffer" || Token == "ConsumeStructuredBuffer")
+        {
+            Type = SHADER_RESOURCE_TYPE_BUFFER_UAV;
+            Dim  = RESOURCE_DIM_BUFFER;
+        }
+        else if (HasPrefix(Token, "RWTexture", Suffix) && ParseResourceDimension(Suffix, Dim, IsMS))
+        {
+            Type = SHADER_RESOURCE_TYPE_TEXTURE_UAV;
+        }
+        else if (HasPrefix(Token, "Texture", Suffix) && ParseResourceDimension(Suffix, Dim, IsMS))
+        {
+            Type = SHADER_RESOURCE_TYPE_TEXTURE_SRV;
+        }
+        else if (Token == "SamplerState" || Token == "SamplerComparisonState")
+        {
+            Type = SHADER_RESOURCE_TYPE_SAMPLER;
+        }
+        else if (Token == "RaytracingAccelerationStructure")
+        {
+            Type = SHADER_RESOURCE_TYPE_ACCEL_STRUCT;
+        }
+        else
+        {
+            continue;
+        }
+
+        String Name;
+        Uint32 ArraySize = 0;
+        if (!ParseNameAndArraySize(Tokens, SkipTemplateArguments(Tokens, t + 1), Name, ArraySize))
+            continue;
+        if (Token != "cbuffer" && TokenCounts[Name] < 2)
+            continue;
+        AddResource(std::move(Name), Type, ArraySize, Dim, IsMS);
+    }
+}
+
+void ShaderResourcesNull::ParseGLSL(const std::vector<String>& Tokens)
+{
+    static const std::unordered_set<String> Qualifiers =
+        {
+            "lowp", "mediump", "highp", "readonly", "writeonly", "coherent", "volatile", "restrict" //
+        };
+
+    int ScopeDepth = 0;
+    for (size_t t = 0; t < Tokens.size(); ++t)
+    {
+        const auto& Token = Tokens[t];
+        if (!IsGlobalScopeToken(Token, ScopeDepth))
+            continue;
+
+        if (Token == "buffer")
+        {
+            // Storage block, e.g. 'layout(std140) readonly buffer Block { ... };'
+            if (t + 2 >= Tokens.size() || Tokens[t + 2] != "{")
+                continue;
+
+            bool IsReadOnly = false;
+            for (size_t q = t; q > 0 && Tokens[q - 1] != ";" && Tokens[q - 1] != "}"; --q)
+                IsReadOnly = IsReadOnly || Tokens[q - 1] == "readonly";
+
+            AddResource(Tokens[t + 1], IsReadOnly ? SHADER_RESOURCE_TYPE_BUFFER_SRV : SHADER_RESOURCE_TYPE_BUFFER_UAV, 1, RESOURCE_DIM_BUFFER, false);
+            continue;
+        }
+
+        if (Token != "uniform")
+            continue;
+
+        auto TypePos = t + 1;
+        while (TypePos < Tokens.size() && Qualifiers.find(Tokens[TypePos]) != Qualifiers.end())
+            ++TypePos;
+        if (TypePos + 1 >= Tokens.size())
+            continue;
+
+        const auto& TypeName = Tokens[TypePos];
+        if (Tokens[TypePos + 1] == "{")
+        {
+            // Uniform block, e.g. 'uniform Constants { ... };'
+            AddResource(TypeName, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, 1, RESOURCE_DIM_BUFFER, false);
+            continue;
+        }
+
+        auto   Type = SHADER_RESOURCE_TYPE_UNKNOWN;
+        auto   Dim  = RESOURCE_DIM_UNDEFINED;
+        bool   IsMS = false;
+        String Suffix;
+        if (TypeName == "sampler" || TypeName == "samplerShadow")
+        {
+            Type = SHADER_RESOURCE_TYPE_SAMPLER;
+        }
+        else if (TypeName == "accelerationStructureEXT")
+        {
+            Type = SHADER_RESOURCE_TYPE_ACCEL_STRUCT;
+        }
+        else if (HasPrefix(TypeName, "subpassInput", Suffix))
+        {
+            Type = SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT;
+            Dim  = RESOURCE_DIM_TEX_2D;
+            IsMS = Suffix == "MS";
+        }
+        else if ((HasGLSLTypePrefix(TypeName, "sampler", Suffix) || HasGLSLTypePrefix(TypeName, "texture", Suffix)) && ParseResourceDimension(Suffix, Dim, IsMS))
+        {
+            Type = Dim == RESOURCE_DIM_BUFFER ? SHADER_RESOURCE_TYPE_BUFFER_SRV : SHADER_RESOURCE_TYPE_TEXTURE_SRV;
+        }
+        else if (HasGLSLTypePrefix(TypeName, "image", Suffix) && ParseResourceDimension(Suffix, Dim, IsMS))
+        {
+            Type = Dim == RESOURCE_DIM_BUFFER ? SHADER_RESOURCE_TYPE_BUFFER_UAV : SHADER_RESOURCE_TYPE_TEXTURE_UAV;
+        }
+        else
+        {
+            // Not an opaque type
+            continue;
+        }
+
+        String Name;
+        Uint32 ArraySize = 0;
+        if (ParseNameAndArraySize(Tokens, TypePos + 1, Name, ArraySize))
+            AddResource(std::move(Name), Type, ArraySize, Dim, IsMS);
+    }
+}
+
+size_t ShaderResourcesNull::GetHash() const
+{
+    size_t Hash = ComputeHash(m_Resources.size(), m_ShaderType);
+    for (const auto& Res : m_Resources)
+        HashCombine(Hash, Res.Type, Res.ArraySize, Res.ResourceDim, Res.IsMS);
+    return Hash;
+}
+
+bool ShaderResourcesNull::IsCompatibleWith(const ShaderResourcesNull& Resources) const
+{
+    if (m_Resources.size() != Resources.m_Resources.size())
+        return false;
+
+    for (size_t r = 0; r < m_Resources.size(); ++r)
+    {
+        if (!m_Resources[r].IsCompatibleWith(Resources.m_Resources[r]))
+            return false;
+    }
+
+    return true;
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void ShaderResourcesNull::DvpVerifyResourceLayout(const PipelineResourceLayoutDesc& ResourceLayout,
+                                                  const ShaderResourcesNull* const  pShaderResources[],
+                                                  Uint32                            NumShaders,
+                                                  bool                              VerifyVariables,
+                                                  bool                              VerifyImmutableSamplers)
+{
+    if (VerifyVariables)
+    {
+        for (Uint32 v = 0; v < ResourceLayout.NumVariables; ++v)
+        {
+            const auto& VarDesc = ResourceLayout.Variables[v];
+            if (VarDesc.ShaderStages == SHADER_TYPE_UNKNOWN)
+            {
+                LOG_WARNING_MESSAGE("No allowed shader stages are specified for ", GetShaderVariableTypeLiteralName(VarDesc.Type), " variable '", VarDesc.Name, "'.");
+                continue;
+            }
+
+            bool VariableFound = false;
+            for (Uint32 s = 0; s < NumShaders && !VariableFound; ++s)
+            {
+                const auto& Resources = *pShaderResources[s];
+                if ((VarDesc.ShaderStages & Resources.GetShaderType()) == 0)
+                    continue;
+
+                for (const auto& Res : Resources.m_Resources)
+                {
+                    // Skip samplers if combined texture samplers are used as
+                    // in this case they are not treated as independent variables
+                    if (Resources.IsUsingCombinedTextureSamplers() && Res.Type == SHADER_RESOURCE_TYPE_SAMPLER)
+                        continue;
+
+                    if (Res.Name == VarDesc.Name)
+                    {
+                        VariableFound = true;
+                        break;
+                    }
+                }
+            }
+
+            if (!VariableFound)
+            {
+                LOG_WARNING_MESSAGE(GetShaderVariableTypeLiteralName(VarDesc.Type), " variable '", VarDesc.Name,
+                                    "' is not found in any of the designated shader stages");
+            }
+        }
+    }
+
+    if (VerifyImmutableSamplers)
+    {
+        for (Uint32 sam = 0; sam < ResourceLayout.NumImmutableSamplers; ++sam)
+        {
+            const auto& ImtblSamDesc = ResourceLayout.ImmutableSamplers[sam];
+            if (ImtblSamDesc.ShaderStages == SHADER_TYPE_UNKNOWN)
+            {
+                LOG_WARNING_MESSAGE("No allowed shader stages are specified for immutable sampler '", ImtblSamDesc.SamplerOrTextureName, "'.");
+                continue;
+            }
+
+            bool ImtblSamplerFound = false;
+            for (Uint32 s = 0; s < NumShaders && !ImtblSamplerFound; ++s)
+            {
+                const auto& Resources = *pShaderResources[s];
+                if ((ImtblSamDesc.ShaderStages & Resources.GetShaderType()) == 0)
+                    continue;
+
+                for (const auto& Res : Resources.m_Resources)
+                {
+                    // GLSL combined image samplers are declared as textures
+                    if ((Res.Type == SHADER_RESOURCE_TYPE_SAMPLER && StreqSuff(Res.Name.c_str(), ImtblSamDesc.SamplerOrTextureName, Resources.GetCombinedSamplerSuffix())) ||
+                        (Res.Type == SHADER_RESOURCE_TYPE_TEXTURE_SRV && Res.Name == ImtblSamDesc.SamplerOrTextureName))
+                    {
+                        ImtblSamplerFound = true;
+                        break;
+                    }
+                }
+            }
+
+            if (!ImtblSamplerFound)
+            {
+                LOG_WARNING_MESSAGE("Immutable sampler '", ImtblSamDesc.SamplerOrTextureName, "' is not found in any of the designated shader stages");
+            }
+        }
+    }
+}
+#endif
+
+} // namespace Diligent
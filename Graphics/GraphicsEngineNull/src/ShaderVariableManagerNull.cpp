@@ -0,0 +1,291 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderVariableManagerNull.hpp"
+#include "Buffer.h"
+#include "BufferView.h"
+#include "TextureView.h"
+#include "Sampler.h"
+#include "TopLevelAS.h"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+ShaderVariableManagerNull::ShaderVariableManagerNull(IObject&                                   Owner,
+                                                     std::shared_ptr<const ShaderResourcesNull> pResources,
+                                                     const PipelineResourceLayoutDesc&          ResourceLayout,
+                                                     const SHADER_RESOURCE_VARIABLE_TYPE*       AllowedVarTypes,
+                                                     Uint32                                     NumAllowedTypes) :
+    // clang-format off
+    m_Owner     {Owner},
+    m_pResources{std::move(pResources)}
+// clang-format on
+{
+    const auto  AllowedTypeBits       = GetAllowedTypeBits(AllowedVarTypes, NumAllowedTypes);
+    const auto  ShaderType            = m_pResources->GetShaderType();
+    const auto* CombinedSamplerSuffix = m_pResources->GetCombinedSamplerSuffix();
+
+    std::vector<std::pair<const ShaderResourcesNull::ResourceAttribs*, SHADER_RESOURCE_VARIABLE_TYPE>> Resources;
+    for (Uint32 r = 0; r < m_pResources->GetNumResources(); ++r)
+    {
+        const auto& Attribs = m_pResources->GetResource(r);
+        if (Attribs.Type == SHADER_RESOURCE_TYPE_SAMPLER)
+        {
+            // Combined samplers are not treated as independent variables
+            if (m_pResources->IsUsingCombinedTextureSamplers())
+                continue;
+
+            // Immutable samplers are never exposed as variables
+            if (FindImmutableSampler(ResourceLayout.ImmutableSamplers, ResourceLayout.NumImmutableSamplers, ShaderType, Attribs.Name.c_str(), CombinedSamplerSuffix) >= 0)
+                continue;
+        }
+
+        const auto VarType = GetShaderVariableType(ShaderType, Attribs.Name.c_str(), ResourceLayout);
+        if (IsAllowedType(VarType, AllowedTypeBits))
+            Resources.emplace_back(&Attribs, VarType);
+    }
+
+    // Variables reference the manager, so the array must never be reallocated
+    m_Variables.reserve(Resources.size());
+
+    Uint32 CacheSize = 0;
+    for (const auto& Res : Resources)
+    {
+        m_Variables.emplace_back(*this, *Res.first, Res.second, CacheSize);
+        CacheSize += Res.first->ArraySize;
+    }
+    m_ResourceCache.resize(CacheSize);
+
+    static_assert(ShaderVariableNameIndex::GetRequiredAlignment() <= alignof(size_t), "Name index data is not properly aligned");
+    const auto NumVariables = static_cast<Uint32>(m_Variables.size());
+    m_NameIndexData.resize((ShaderVariableNameIndex::GetRequiredMemorySize(NumVariables) + sizeof(size_t) - 1) / sizeof(size_t));
+    m_NameIndex.Initialize(m_NameIndexData.data(), NumVariables,
+                           [this](Uint32 VarIdx) //
+                           {
+                               return m_Variables[VarIdx].GetAttribs().Name.c_str();
+                           });
+}
+
+ShaderVariableNullImpl* ShaderVariableManagerNull::GetVariable(const Char* Name)
+{
+    const auto VarIdx = m_NameIndex.Find(Name,
+                                         [this](Uint32 Idx) //
+                                         {
+                                             return m_Variables[Idx].GetAttribs().Name.c_str();
+                                         });
+    return VarIdx != ShaderVariableNameIndex::InvalidIndex ? &m_Variables[VarIdx] : nullptr;
+}
+
+ShaderVariableNullImpl* ShaderVariableManagerNull::GetVariable(Uint32 Index)
+{
+    if (Index >= m_Variables.size())
+    {
+        LOG_ERROR("Index ", Index, " is out of range");
+        return nullptr;
+    }
+    return &m_Variables[Index];
+}
+
+Uint32 ShaderVariableManagerNull::GetVariableIndex(const ShaderVariableNullImpl& Variable) const
+{
+    if (m_Variables.empty())
+    {
+        LOG_ERROR("This shader variable manager has no variables");
+        return static_cast<Uint32>(-1);
+    }
+
+    const auto Offset = reinterpret_cast<const Uint8*>(&Variable) - reinterpret_cast<const Uint8*>(m_Variables.data());
+    DEV_CHECK_ERR(Offset % sizeof(ShaderVariableNullImpl) == 0, "Offset is not multiple of ShaderVariableNullImpl class size");
+    const auto Index = static_cast<Uint32>(Offset / sizeof(ShaderVariableNullImpl));
+    if (Index < m_Variables.size())
+        return Index;
+
+    LOG_ERROR("Failed to get variable index. The variable ", &Variable, " does not belong to this shader variable manager");
+    return static_cast<Uint32>(-1);
+}
+
+void ShaderVariableManagerNull::BindResources(IResourceMapping* pResourceMapping, Uint32 Flags)
+{
+    if (pResourceMapping == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to bind resources in shader '", GetShaderName(), "': resource mapping is null");
+        return;
+    }
+
+    if ((Flags & BIND_SHADER_RESOURCES_UPDATE_ALL) == 0)
+        Flags |= BIND_SHADER_RESOURCES_UPDATE_ALL;
+
+    for (auto& Var : m_Variables)
+    {
+        if ((Flags & (1 << Var.GetType())) == 0)
+            continue;
+
+        const auto& Attribs = Var.GetAttribs();
+        for (Uint32 elem = 0; elem < Attribs.ArraySize; ++elem)
+        {
+            if ((Flags & BIND_SHADER_RESOURCES_KEEP_EXISTING) && Var.IsBound(elem))
+                continue;
+
+            RefCntAutoPtr<IDeviceObject> pObj;
+            pResourceMapping->GetResource(Attribs.Name.c_str(), &pObj, elem);
+            if (pObj)
+            {
+                Var.BindResource(pObj, elem);
+            }
+            else
+            {
+                if ((Flags & BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED) && !Var.IsBound(elem))
+                {
+                    LOG_ERROR_MESSAGE("Unable to bind resource to shader variable '", Attribs.GetPrintName(elem),
+                                      "': resource is not found in the resource mapping");
+                }
+            }
+        }
+    }
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+bool ShaderVariableManagerNull::DvpVerifyBindings() const
+{
+    bool BindingsOK = true;
+    for (const auto& Var : m_Variables)
+    {
+        const auto& Attribs = Var.GetAttribs();
+        for (Uint32 elem = 0; elem < Attribs.ArraySize; ++elem)
+        {
+            if (!Var.IsBound(elem))
+            {
+                LOG_ERROR_MESSAGE("No resource is bound to ", GetShaderVariableTypeLiteralName(Var.GetType()), " variable '",
+                                  Attribs.GetPrintName(elem), "' in shader '", GetShaderName(), "'");
+                BindingsOK = false;
+            }
+        }
+    }
+    return BindingsOK;
+}
+#endif
+
+
+Uint32 ShaderVariableNullImpl::GetIndex() const
+{
+    return m_ParentResLayout.GetVariableIndex(*this);
+}
+
+bool ShaderVariableNullImpl::IsBound(Uint32 ArrayIndex) const
+{
+    VERIFY_EXPR(ArrayIndex < m_Attribs.ArraySize);
+    return m_ParentResLayout.m_ResourceCache[m_CacheOffset + ArrayIndex] != nullptr;
+}
+
+void ShaderVariableNullImpl::BindResource(IDeviceObject* pObject, Uint32 ArrayIndex)
+{
+    DEV_CHECK_ERR(ArrayIndex < m_Attribs.ArraySize, "Array index (", ArrayIndex, ") is out of range for variable '", m_Attribs.Name, "'");
+    if (ArrayIndex >= m_Attribs.ArraySize)
+        return;
+
+    auto& CachedObject = m_ParentResLayout.m_ResourceCache[m_CacheOffset + ArrayIndex];
+
+    // Only objects of the type expected by the variable are stored in the cache
+    RefCntAutoPtr<IDeviceObject> pResource;
+    switch (m_Attribs.Type)
+    {
+        case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+        {
+            RefCntAutoPtr<IBuffer> pBuffer{pObject, IID_Buffer};
+#ifdef DILIGENT_DEVELOPMENT
+            VerifyConstantBufferBinding(m_Attribs, GetType(), ArrayIndex, pObject, pBuffer.RawPtr(), CachedObject.RawPtr(), m_ParentResLayout.GetShaderName());
+#endif
+            pResource = pBuffer;
+            break;
+        }
+
+        case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
+        case SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT:
+        case SHADER_RESOURCE_TYPE_TEXTURE_UAV:
+        {
+            RefCntAutoPtr<ITextureView> pTexView{pObject, IID_TextureView};
+#ifdef DILIGENT_DEVELOPMENT
+            const auto ExpectedViewType = m_Attribs.Type == SHADER_RESOURCE_TYPE_TEXTURE_UAV ? TEXTURE_VIEW_UNORDERED_ACCESS : TEXTURE_VIEW_SHADER_RESOURCE;
+            VerifyResourceViewBinding(m_Attribs, GetType(), ArrayIndex, pObject, pTexView.RawPtr(), {ExpectedViewType}, CachedObject.RawPtr(), m_ParentResLayout.GetShaderName());
+#endif
+            pResource = pTexView;
+            break;
+        }
+
+        case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+        case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+        {
+            RefCntAutoPtr<IBufferView> pBuffView{pObject, IID_BufferView};
+#ifdef DILIGENT_DEVELOPMENT
+            const auto ExpectedViewType = m_Attribs.Type == SHADER_RESOURCE_TYPE_BUFFER_UAV ? BUFFER_VIEW_UNORDERED_ACCESS : BUFFER_VIEW_SHADER_RESOURCE;
+            VerifyResourceViewBinding(m_Attribs, GetType(), ArrayIndex, pObject, pBuffView.RawPtr(), {ExpectedViewType}, CachedObject.RawPtr(), m_ParentResLayout.GetShaderName());
+#endif
+            pResource = pBuffView;
+            break;
+        }
+
+        case SHADER_RESOURCE_TYPE_SAMPLER:
+        {
+            RefCntAutoPtr<ISampler> pSampler{pObject, IID_Sampler};
+#ifdef DILIGENT_DEVELOPMENT
+            if (pObject != nullptr && pSampler == nullptr)
+            {
+                LOG_ERROR_MESSAGE("Failed to bind object '", pObject->GetDesc().Name, "' to variable '", m_Attribs.GetPrintName(ArrayIndex),
+                                  "' in shader '", m_ParentResLayout.GetShaderName(), "'. Invalid resource type: sampler is expected.");
+            }
+            if (GetType() != SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC && CachedObject != nullptr && CachedObject.RawPtr() != pSampler.RawPtr())
+            {
+                LOG_ERROR_MESSAGE("Non-null sampler is already bound to ", GetShaderVariableTypeLiteralName(GetType()), " shader variable '", m_Attribs.GetPrintName(ArrayIndex),
+                                  "' in shader '", m_ParentResLayout.GetShaderName(), "'. Attempting to bind another sampler is an error and may cause unpredicted behavior. ",
+                                  "Use another shader resource binding instance or label the variable as dynamic.");
+            }
+#endif
+            pResource = pSampler;
+            break;
+        }
+
+        case SHADER_RESOURCE_TYPE_ACCEL_STRUCT:
+        {
+            RefCntAutoPtr<ITopLevelAS> pTLAS{pObject, IID_TopLevelAS};
+#ifdef DILIGENT_DEVELOPMENT
+            VerifyTLASResourceBinding(m_Attribs, GetType(), ArrayIndex, pTLAS.RawPtr(), CachedObject.RawPtr(), m_ParentResLayout.GetShaderName());
+#endif
+            pResource = pTLAS;
+            break;
+        }
+
+        default:
+            UNEXPECTED("Unexpected resource type");
+    }
+
+    CachedObject = std::move(pResource);
+}
+
+} // namespace Diligent
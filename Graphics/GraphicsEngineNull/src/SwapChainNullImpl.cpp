@@ -0,0 +1,173 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "SwapChainNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+SwapChainNullImpl::SwapChainNullImpl(IReferenceCounters*    pRefCounters,
+                                     const SwapChainDesc&   SCDesc,
+                                     RenderDeviceNullImpl*  pRenderDeviceNull,
+                                     DeviceContextNullImpl* pImmediateContextNull) :
+    // clang-format off
+    TSwapChainBase
+    {
+        pRefCounters,
+        pRenderDeviceNull,
+        pImmediateContextNull,
+        SCDesc
+    }
+// clang-format on
+{
+    // There is no window to take the size from
+    if (m_SwapChainDesc.Width == 0)
+        m_SwapChainDesc.Width = 1024;
+    if (m_SwapChainDesc.Height == 0)
+        m_SwapChainDesc.Height = 768;
+
+    m_DesiredPreTransform        = SURFACE_TRANSFORM_OPTIMAL;
+    m_SwapChainDesc.PreTransform = SURFACE_TRANSFORM_IDENTITY;
+
+    CreateBuffers();
+}
+
+SwapChainNullImpl::~SwapChainNullImpl()
+{
+}
+
+IMPLEMENT_QUERY_INTERFACE(SwapChainNullImpl, IID_SwapChain, TSwapChainBase)
+
+void SwapChainNullImpl::CreateBuffers()
+{
+    auto* pRenderDeviceNull = m_pRenderDevice.RawPtr<RenderDeviceNullImpl>();
+
+    TextureDesc ColorBuffDesc;
+    ColorBuffDesc.Type      = RESOURCE_DIM_TEX_2D;
+    ColorBuffDesc.Name      = "Main color buffer";
+    ColorBuffDesc.Width     = m_SwapChainDesc.Width;
+    ColorBuffDesc.Height    = m_SwapChainDesc.Height;
+    ColorBuffDesc.Format    = m_SwapChainDesc.ColorBufferFormat;
+    ColorBuffDesc.BindFlags = BIND_RENDER_TARGET;
+    if (m_SwapChainDesc.Usage & SWAP_CHAIN_USAGE_SHADER_INPUT)
+        ColorBuffDesc.BindFlags |= BIND_SHADER_RESOURCE;
+
+    RefCntAutoPtr<ITexture> pColorBuffer;
+    pRenderDeviceNull->CreateTexture(ColorBuffDesc, nullptr, &pColorBuffer);
+    if (!pColorBuffer)
+        LOG_ERROR_AND_THROW("Failed to create the swap chain color buffer");
+    pColorBuffer->SetState(RESOURCE_STATE_RENDER_TARGET);
+    m_pRenderTargetView = ValidatedCast<TextureViewNullImpl>(pColorBuffer->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET));
+
+    m_pDepthStencilView.Release();
+    if (m_SwapChainDesc.DepthBufferFormat != TEX_FORMAT_UNKNOWN)
+    {
+        TextureDesc DepthBuffDesc = ColorBuffDesc;
+        DepthBuffDesc.Name        = "Main depth buffer";
+        DepthBuffDesc.Format      = m_SwapChainDesc.DepthBufferFormat;
+        DepthBuffDesc.BindFlags   = BIND_DEPTH_STENCIL;
+
+        RefCntAutoPtr<ITexture> pDepthBuffer;
+        pRenderDeviceNull->CreateTexture(DepthBuffDesc, nullptr, &pDepthBuffer);
+        if (!pDepthBuffer)
+            LOG_ERROR_AND_THROW("Failed to create the swap chain depth buffer");
+        pDepthBuffer->SetState(RESOURCE_STATE_DEPTH_WRITE);
+        m_pDepthStencilView = ValidatedCast<TextureViewNullImpl>(pDepthBuffer->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL));
+    }
+}
+
+void SwapChainNullImpl::Present(Uint32 SyncInterval)
+{
+    auto pDeviceContext = m_wpDeviceContext.Lock();
+    if (!pDeviceContext)
+    {
+        LOG_ERROR_MESSAGE("Immediate context has been released");
+        return;
+    }
+
+    auto* pImmediateCtxNull = pDeviceContext.RawPtr<DeviceContextNullImpl>();
+
+    // Unbind back buffer from device context to be consistent with other backends
+    pImmediateCtxNull->UnbindTextureFromFramebuffer(ValidatedCast<TextureNullImpl>(m_pRenderTargetView->GetTexture()), false);
+
+    if (m_SwapChainDesc.IsPrimary)
+    {
+        pImmediateCtxNull->FinishFrame();
+        m_pRenderDevice.RawPtr<RenderDeviceNullImpl>()->ReleaseStaleResources();
+    }
+}
+
+void SwapChainNullImpl::Resize(Uint32 NewWidth, Uint32 NewHeight, SURFACE_TRANSFORM NewPreTransform)
+{
+    if (NewPreTransform != SURFACE_TRANSFORM_OPTIMAL &&
+        NewPreTransform != SURFACE_TRANSFORM_IDENTITY)
+    {
+        LOG_WARNING_MESSAGE(GetSurfaceTransformString(NewPreTransform),
+                            " is not an allowed pretransform because Null swap chains only support identity transform. "
+                            "Use SURFACE_TRANSFORM_OPTIMAL (recommended) or SURFACE_TRANSFORM_IDENTITY.");
+    }
+    NewPreTransform = SURFACE_TRANSFORM_OPTIMAL;
+
+    if (TSwapChainBase::Resize(NewWidth, NewHeight, NewPreTransform))
+    {
+        if (auto pDeviceContext = m_wpDeviceContext.Lock())
+        {
+            auto* pImmediateCtxNull  = pDeviceContext.RawPtr<DeviceContextNullImpl>();
+            auto* pCurrentBackBuffer = ValidatedCast<TextureNullImpl>(m_pRenderTargetView->GetTexture());
+            auto  RenderTargetsReset = pImmediateCtxNull->UnbindTextureFromFramebuffer(pCurrentBackBuffer, false);
+            if (m_pDepthStencilView)
+            {
+                auto* pDepthBuffer = ValidatedCast<TextureNullImpl>(m_pDepthStencilView->GetTexture());
+                RenderTargetsReset = pImmediateCtxNull->UnbindTextureFromFramebuffer(pDepthBuffer, false) || RenderTargetsReset;
+            }
+            if (RenderTargetsReset)
+            {
+                LOG_INFO_MESSAGE_ONCE("Resizing the swap chain requires back and depth-stencil buffers to be unbound from the device context. "
+                                      "An application should use SetRenderTargets() to restore them.");
+            }
+        }
+
+        CreateBuffers();
+    }
+}
+
+void SwapChainNullImpl::SetFullscreenMode(const DisplayModeAttribs& DisplayMode)
+{
+    UNSUPPORTED("Null swap chain does not support switching to the fullscreen mode");
+}
+
+void SwapChainNullImpl::SetWindowedMode()
+{
+}
+
+} // namespace Diligent
@@ -0,0 +1,203 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "TextureNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+#include "EngineMemory.h"
+
+namespace Diligent
+{
+
+TextureNullImpl::TextureNullImpl(IReferenceCounters*        pRefCounters,
+                                 FixedBlockMemoryAllocator& TexViewObjAllocator,
+                                 RenderDeviceNullImpl*      pDeviceNull,
+                                 const TextureDesc&         TexDesc,
+                                 const TextureData*         pInitData,
+                                 bool                       bIsDeviceInternal) :
+    // clang-format off
+    TTextureBase
+    {
+        pRefCounters,
+        TexViewObjAllocator,
+        pDeviceNull,
+        TexDesc,
+        bIsDeviceInternal
+    },
+    m_Data              (STD_ALLOCATOR_RAW_MEM(Uint8,  GetRawAllocator(), "Allocator for vector<Uint8>")),
+    m_SubresourceOffsets(STD_ALLOCATOR_RAW_MEM(Uint32, GetRawAllocator(), "Allocator for vector<Uint32>"))
+// clang-format on
+{
+    if (m_Desc.Usage == USAGE_IMMUTABLE && (pInitData == nullptr || pInitData->pSubResources == nullptr))
+        LOG_ERROR_AND_THROW("Immutable textures must be initialized with data at creation time: pInitData can't be null");
+
+    const auto NumSlices = m_Desc.Type == RESOURCE_DIM_TEX_3D ? 1u : m_Desc.ArraySize;
+    if (pInitData != nullptr && pInitData->pSubResources != nullptr)
+    {
+        if (NumSlices * m_Desc.MipLevels != pInitData->NumSubresources)
+            LOG_ERROR_AND_THROW("Incorrect number of subresources in init data. ", NumSlices * m_Desc.MipLevels, " expected, while ", pInitData->NumSubresources, " provided");
+    }
+
+    m_SubresourceOffsets.resize(size_t{NumSlices} * size_t{m_Desc.MipLevels});
+
+    Uint32 DataSize = 0;
+    for (Uint32 Slice = 0; Slice < NumSlices; ++Slice)
+    {
+        for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip)
+        {
+            m_SubresourceOffsets[Slice * m_Desc.MipLevels + Mip] = DataSize;
+            DataSize += GetMipLevelProperties(m_Desc, Mip).MipSize;
+        }
+    }
+    m_Data.resize(DataSize);
+
+    if (pInitData != nullptr && pInitData->pSubResources != nullptr)
+    {
+        Uint32 Subres = 0;
+        for (Uint32 Slice = 0; Slice < NumSlices; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip)
+            {
+                const auto MipProps = GetMipLevelProperties(m_Desc, Mip);
+
+                Box MipBox;
+                MipBox.MaxX = MipProps.LogicalWidth;
+                MipBox.MaxY = MipProps.LogicalHeight;
+                MipBox.MaxZ = MipProps.Depth;
+                UpdateData(Mip, Slice, MipBox, pInitData->pSubResources[Subres++]);
+            }
+        }
+    }
+
+    SetState(RESOURCE_STATE_UNDEFINED);
+}
+
+TextureNullImpl::~TextureNullImpl()
+{
+}
+
+MappedTextureSubresource TextureNullImpl::GetSubresourceData(Uint32 MipLevel, Uint32 Slice, const Box* pRegion)
+{
+    MappedTextureSubresource MappedData;
+
+    const auto  MipProps   = GetMipLevelProperties(m_Desc, MipLevel);
+    const auto& FmtAttribs = GetTextureFormatAttribs(m_Desc.Format);
+
+    Uint32 Offset = GetSubresourceOffset(MipLevel, Slice);
+    if (pRegion != nullptr)
+    {
+        const Uint32 ElementSize = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ?
+            Uint32{FmtAttribs.ComponentSize} :
+            Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+
+        Offset += pRegion->MinZ * MipProps.DepthSliceSize;
+        Offset += pRegion->MinY / Uint32{FmtAttribs.BlockHeight} * MipProps.RowSize;
+        Offset += pRegion->MinX / Uint32{FmtAttribs.BlockWidth} * ElementSize;
+    }
+
+    MappedData.pData       = m_Data.data() + Offset;
+    MappedData.Stride      = MipProps.RowSize;
+    MappedData.DepthStride = MipProps.DepthSliceSize;
+    return MappedData;
+}
+
+void TextureNullImpl::UpdateData(Uint32 MipLevel, Uint32 Slice, const Box& DstBox, const TextureSubResData& SubresData)
+{
+    auto SrcSubres = SubresData;
+    if (SrcSubres.pSrcBuffer != nullptr)
+    {
+        auto* pSrcBufferNull = ValidatedCast<BufferNullImpl>(SrcSubres.pSrcBuffer);
+        SrcSubres.pData      = pSrcBufferNull->GetData() + SrcSubres.SrcOffset;
+        SrcSubres.pSrcBuffer = nullptr;
+        SrcSubres.SrcOffset  = 0;
+    }
+    if (SrcSubres.pData == nullptr)
+        return;
+
+    const auto CopyInfo = GetBufferToTextureCopyInfo(m_Desc, MipLevel, DstBox, 1);
+    const auto DstData  = GetSubresourceData(MipLevel, Slice, &DstBox);
+    CopyTextureSubresource(SrcSubres, CopyInfo.RowCount, DstBox.MaxZ - DstBox.MinZ, CopyInfo.RowSize,
+                           DstData.pData, DstData.Stride, DstData.DepthStride);
+}
+
+void TextureNullImpl::CopyData(TextureNullImpl& SrcTexture,
+                               Uint32           SrcMipLevel,
+                               Uint32           SrcSlice,
+                               const Box&       SrcBox,
+                               Uint32           DstMipLevel,
+                               Uint32           DstSlice,
+                               Uint32           DstX,
+                               Uint32           DstY,
+                               Uint32           DstZ)
+{
+    const auto SrcData = SrcTexture.GetSubresourceData(SrcMipLevel, SrcSlice, &SrcBox);
+
+    Box DstBox;
+    DstBox.MinX = DstX;
+    DstBox.MaxX = DstX + (SrcBox.MaxX - SrcBox.MinX);
+    DstBox.MinY = DstY;
+    DstBox.MaxY = DstY + (SrcBox.MaxY - SrcBox.MinY);
+    DstBox.MinZ = DstZ;
+    DstBox.MaxZ = DstZ + (SrcBox.MaxZ - SrcBox.MinZ);
+    UpdateData(DstMipLevel, DstSlice, DstBox, TextureSubResData{SrcData.pData, SrcData.Stride, SrcData.DepthStride});
+}
+
+void TextureNullImpl::CreateViewInternal(const TextureViewDesc& OrigViewDesc, ITextureView** ppView, bool bIsDefaultView)
+{
+    VERIFY(ppView != nullptr, "Null pointer provided");
+    if (!ppView) return;
+    VERIFY(*ppView == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+    *ppView = nullptr;
+
+    try
+    {
+        auto ViewDesc = OrigViewDesc;
+        ValidatedAndCorrectTextureViewDesc(m_Desc, ViewDesc);
+
+        auto* pDeviceNullImpl  = GetDevice();
+        auto& TexViewAllocator = pDeviceNullImpl->GetTexViewObjAllocator();
+        VERIFY(&TexViewAllocator == &m_dbgTexViewObjAllocator, "Texture view allocator does not match allocator provided during texture initialization");
+
+        auto* pViewNull = NEW_RC_OBJ(TexViewAllocator, "TextureViewNullImpl instance", TextureViewNullImpl, bIsDefaultView ? this : nullptr)(pDeviceNullImpl, ViewDesc, this, bIsDefaultView);
+        VERIFY(pViewNull->GetDesc().ViewType == ViewDesc.ViewType, "Incorrect view type");
+
+        if (bIsDefaultView)
+            *ppView = pViewNull;
+        else
+            pViewNull->QueryInterface(IID_TextureView, reinterpret_cast<IObject**>(ppView));
+    }
+    catch (const std::runtime_error&)
+    {
+        const auto* ViewTypeName = GetTexViewTypeLiteralName(OrigViewDesc.ViewType);
+        LOG_ERROR("Failed to create view \"", OrigViewDesc.Name ? OrigViewDesc.Name : "", "\" (", ViewTypeName, ") for texture \"", m_Desc.Name ? m_Desc.Name : "", "\"");
+    }
+}
+
+} // namespace Diligent
@@ -76,7 +76,25 @@ public:
 
     void BufferMemoryBarrier(Uint32 RequiredBarriers, class GLContextState& GLContextState);
 
-    const GLObjectWrappers::GLBufferObj& GetGLHandle() { return m_GlBuffer; }
+    const GLObjectWrappers::GLBufferObj& GetGLHandle() { return m_pDynamicHeap != nullptr ? m_pDynamicHeap->GetGLBuffer() : m_GlBuffer; }
+
+    /// Returns true if the buffer memory is suballocated from the persistently mapped dynamic heap
+    bool IsSuballocated() const { return m_pDynamicHeap != nullptr; }
+
+    /// Returns the offset of the buffer data in the GL buffer object returned by GetGLHandle()
+    Uint32 GetDynamicOffset() const
+    {
+        VERIFY(m_pDynamicHeap == nullptr || m_DynamicOffset != GLDynamicHeap::InvalidOffset, "Dynamic buffer '", m_Desc.Name, "' has not been mapped");
+        return m_pDynamicHeap != nullptr ? static_cast<Uint32>(m_DynamicOffset) : 0;
+    }
+
+    /// Returns the size of the current dynamic heap allocation, which covers the buffer
+    /// from the beginning through the end of the range last mapped with MAP_FLAG_DISCARD
+    Uint32 GetDynamicSize() const { return m_DynamicAllocSize; }
+
+#ifdef DILIGENT_DEVELOPMENT
+    void DvpVerifyDynamicAllocation() const;
+#endif
 
     /// Implementation of IBufferGL::GetGLBufferHandle().
     virtual GLuint DILIGENT_CALL_TYPE GetGLBufferHandle() override final { return GetGLHandle(); }
@@ -93,9 +111,18 @@ private:
     friend class DeviceContextGLImpl;
     friend class VAOCache;
 
+    // Dynamic heap the buffer memory is suballocated from when the buffer is mapped
+    // with MAP_FLAG_DISCARD, or null if the buffer has its own storage.
+    GLDynamicHeap* const m_pDynamicHeap;
+
     GLObjectWrappers::GLBufferObj m_GlBuffer;
     const Uint32                  m_BindTarget;
     const GLenum                  m_GLUsageHint;
+
+    // Offset and size of the current allocation in the dynamic heap and the heap frame it was made in
+    GLDynamicHeap::OffsetType m_DynamicOffset     = GLDynamicHeap::InvalidOffset;
+    Uint32                    m_DynamicAllocSize  = 0;
+    Uint64                    m_DynamicAllocFrame = 0;
 };
 
 } // namespace Diligent
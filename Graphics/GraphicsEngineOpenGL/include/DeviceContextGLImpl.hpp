@@ -135,6 +135,10 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw               (const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed        (const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw          (const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed   (const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in OpenGL backend.
@@ -236,6 +240,9 @@ public:
     /// Implementation of IDeviceContext::WaitForFence() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE WaitForFence(IFence* pFence, Uint64 Value, bool FlushContext) override final;
 
+    /// Implementation of IDeviceContext::DeviceWaitForFence() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE DeviceWaitForFence(IFence* pFence, Uint64 Value) override final;
+
     /// Implementation of IDeviceContext::WaitForIdle() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE WaitForIdle() override final;
 
@@ -296,6 +303,9 @@ private:
     __forceinline void PrepareForIndirectDraw(IBuffer* pAttribsBuffer);
     __forceinline void PostDraw();
 
+    static __forceinline void DrawArrays(GLenum GlTopology, Uint32 NumVertices, Uint32 NumInstances, Uint32 StartVertexLocation, Uint32 FirstInstanceLocation);
+    static __forceinline void DrawElements(GLenum GlTopology, GLenum GLIndexType, Uint32 FirstIndexByteOffset, Uint32 NumIndices, Uint32 NumInstances, Uint32 BaseVertex, Uint32 FirstInstanceLocation);
+
     void BeginSubpass();
     void EndSubpass();
 
@@ -30,6 +30,7 @@
 /// \file
 /// Declaration of Diligent::FenceGLImpl class
 
+#include <algorithm>
 #include <deque>
 #include "FenceGL.h"
 #include "RenderDeviceGL.h"
@@ -68,6 +69,14 @@ public:
 
     void Wait(Uint64 Value, bool FlushCommands);
 
+    /// Returns the largest value the fence has been signaled with
+    Uint64 GetLastSignaledValue() const
+    {
+        return m_PendingFences.empty() ?
+            m_LastCompletedFenceValue :
+            std::max(Uint64{m_LastCompletedFenceValue}, m_PendingFences.back().first);
+    }
+
 private:
     std::deque<std::pair<Uint64, GLObjectWrappers::GLSyncObj>> m_PendingFences;
     volatile Uint64                                            m_LastCompletedFenceValue = 0;
@@ -49,6 +49,7 @@ public:
     void SetActiveTexture  (Int32 Index);
     void BindTexture       (Int32 Index, GLenum BindTarget, const GLObjectWrappers::GLTextureObj& Tex);
     void BindUniformBuffer (Int32 Index,       const GLObjectWrappers::GLBufferObj& Buff);
+    void BindUniformBuffer (Int32 Index,       const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size);
     void BindBuffer        (GLenum BindTarget, const GLObjectWrappers::GLBufferObj& Buff, bool ResetVAO);
     void BindSampler       (Uint32 Index,      const GLObjectWrappers::GLSamplerObj& GLSampler);
     void BindImage         (Uint32 Index, class TextureViewGLImpl* pTexView, GLint MipLevel, GLboolean IsLayered, GLint Layer, GLenum Access, GLenum Format);
@@ -128,7 +129,6 @@ private:
     UniqueIdentifier              m_FBOId        = -1;
     std::vector<UniqueIdentifier> m_BoundTextures;
     std::vector<UniqueIdentifier> m_BoundSamplers;
-    std::vector<UniqueIdentifier> m_BoundUniformBuffers;
 
     struct BoundImageInfo
     {
@@ -175,10 +175,10 @@ private:
     };
     std::vector<BoundImageInfo> m_BoundImages;
 
-    struct BoundSSBOInfo
+    struct BoundBufferInfo
     {
-        BoundSSBOInfo() {}
-        BoundSSBOInfo(UniqueIdentifier _BufferID,
+        BoundBufferInfo() {}
+        BoundBufferInfo(UniqueIdentifier _BufferID,
                       GLintptr         _Offset,
                       GLsizeiptr       _Size) :
             // clang-format off
@@ -191,7 +191,7 @@ private:
         GLintptr         Offset   = 0;
         GLsizeiptr       Size     = 0;
 
-        bool operator==(const BoundSSBOInfo& rhs) const
+        bool operator==(const BoundBufferInfo& rhs) const
         {
             // clang-format off
             return BufferID == rhs.BufferID &&
@@ -200,7 +200,9 @@ private:
             // clang-format on
         }
     };
-    std::vector<BoundSSBOInfo> m_BoundStorageBlocks;
+    // Zero size indicates that the whole buffer is bound
+    std::vector<BoundBufferInfo> m_BoundUniformBuffers;
+    std::vector<BoundBufferInfo> m_BoundStorageBlocks;
 
     Uint32 m_PendingMemoryBarriers = 0;
 
@@ -0,0 +1,101 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLDynamicHeap class
+
+#include <deque>
+#include "RingBuffer.hpp"
+#include "GLObjectWrapper.hpp"
+
+namespace Diligent
+{
+
+/// Persistently mapped ring buffer that dynamic buffers are suballocated from in OpenGL backend.
+
+/// The heap is a single buffer object created with glBufferStorage(GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT)
+/// that stays mapped for its entire lifetime. Every MAP_FLAG_DISCARD map of a dynamic buffer suballocates
+/// a new region from the ring, so that the CPU never writes to memory the GPU may still be reading.
+/// Regions are retired in frames: FinishFrame() inserts a GLsync object into the command stream and
+/// the space allocated in that frame is reclaimed once the sync object is signaled.
+/// The class is not thread-safe.
+class GLDynamicHeap
+{
+public:
+    using OffsetType = RingBuffer::OffsetType;
+
+    static constexpr OffsetType InvalidOffset = RingBuffer::InvalidOffset;
+
+    GLDynamicHeap(IMemoryAllocator& Allocator, Uint32 Size, Uint32 Alignment);
+    ~GLDynamicHeap();
+
+    // clang-format off
+    GLDynamicHeap             (const GLDynamicHeap&)  = delete;
+    GLDynamicHeap             (      GLDynamicHeap&&) = delete;
+    GLDynamicHeap& operator = (const GLDynamicHeap&)  = delete;
+    GLDynamicHeap& operator = (      GLDynamicHeap&&) = delete;
+    // clang-format on
+
+    /// Allocates SizeInBytes bytes from the ring and returns the offset of the allocation,
+    /// or InvalidOffset if there is not enough space even after waiting for all pending frames.
+    OffsetType Allocate(Uint32 SizeInBytes);
+
+    /// Closes the current frame: signals a GLsync object that guards the memory allocated
+    /// since the previous call and releases the space of all frames the GPU has finished.
+    void FinishFrame();
+
+    Uint8* GetCPUAddress(OffsetType Offset) const
+    {
+        VERIFY_EXPR(Offset < m_RingBuffer.GetMaxSize());
+        return m_CPUAddress + Offset;
+    }
+
+    const GLObjectWrappers::GLBufferObj& GetGLBuffer() const { return m_GLBuffer; }
+
+    /// Returns the index of the current frame. Allocations made in earlier frames are no longer valid.
+    Uint64 GetCurrentFrame() const { return m_CurrentFrame; }
+
+private:
+    void ReleaseCompletedFrames(bool WaitForOldest);
+
+    GLObjectWrappers::GLBufferObj m_GLBuffer;
+    Uint8*                        m_CPUAddress = nullptr;
+    RingBuffer                    m_RingBuffer;
+    const Uint32                  m_Alignment;
+
+    // Sync objects of the frames that may still be in use by the GPU
+    std::deque<std::pair<Uint64, GLObjectWrappers::GLSyncObj>> m_PendingFrames;
+
+    Uint64 m_CurrentFrame = 1;
+
+    OffsetType m_PeakUsedSize = 0;
+};
+
+} // namespace Diligent
@@ -73,6 +73,7 @@
 #include "ShaderResourceVariableBase.hpp"
 #include "GLProgramResources.hpp"
 #include "GLProgramResourceCache.hpp"
+#include "ShaderVariableNameIndex.hpp"
 
 namespace Diligent
 {
@@ -336,7 +337,9 @@ private:
 /*45*/ Uint8      m_NumPrograms         = 0;
 /*46*/ Uint8      m_PipelineType        = 255u;
 /*47*/
-/*48*/ // End of structure
+       // Name index that is allocated in m_ResourceBuffer after the program resource counters
+/*48*/ ShaderVariableNameIndex m_NameIndex;
+/*64*/ // End of structure
     // clang-format on
 
     template <typename ResourceType> OffsetType GetResourceOffset() const;
@@ -361,8 +364,8 @@ private:
         return reinterpret_cast<GLProgramResources::ResourceCounters*>(reinterpret_cast<Uint8*>(m_ResourceBuffer.get()) + m_VariableEndOffset)[prog];
     }
 
-    template <typename ResourceType>
-    IShaderResourceVariable* GetResourceByName(SHADER_TYPE ShaderStage, const Char* Name);
+    // Returns the variable with the given index in the list of all variables of all stages
+    GLVariableBase& GetVariable(Uint32 Index);
 
     template <typename THandleUB,
               typename THandleSampler,
@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLProgramBinaryCache class
+
+#include <string>
+#include <mutex>
+
+#include "SPIRVCache.hpp"
+
+namespace Diligent
+{
+
+/// Persistent cache of linked OpenGL program binaries.
+
+/// Every entry is stored in a separate file in the cache directory and contains the
+/// binary format and the data returned by glGetProgramBinary(). Entry keys are computed
+/// from the final GLSL source of all shaders in the program; the cache additionally mixes
+/// the driver identification strings (GL_VENDOR, GL_RENDERER and GL_VERSION) into every key,
+/// so that binaries produced by a different driver are never looked up.
+/// The driver may still reject a binary (e.g. after a driver update that does not change the
+/// version string). In this case the entry is treated as a miss and is overwritten when
+/// the program is linked from the source.
+///
+/// The methods must be called from the thread that owns the GL context. Statistics
+/// may be queried from any thread.
+class GLProgramBinaryCache
+{
+public:
+    // Program binaries use the same content-addressed keys as the SPIR-V cache
+    using Key        = SPIRVCache::Key;
+    using KeyBuilder = SPIRVCache::KeyBuilder;
+
+    struct Statistics
+    {
+        /// The number of programs that were successfully loaded from the cache.
+        Uint32 NumHits = 0;
+
+        /// The number of programs that were not found in the cache.
+        Uint32 NumMisses = 0;
+
+        /// The number of binaries that were found in the cache, but were rejected by the driver.
+        Uint32 NumRejected = 0;
+
+        /// The number of binaries written to the cache since it was opened.
+        Uint32 NumStored = 0;
+
+        /// The total size of the binaries written to the cache since it was opened, in bytes.
+        Uint64 StoredDataSize = 0;
+    };
+
+    /// Opens the cache in the given directory. The directory is created if it does not exist.
+
+    /// \param [in] Directory - Cache directory.
+    /// \param [in] DriverId  - String that identifies the driver, see GetDriverId().
+    GLProgramBinaryCache(const char* Directory, const std::string& DriverId) noexcept(false);
+
+    // clang-format off
+    GLProgramBinaryCache           (const GLProgramBinaryCache&)  = delete;
+    GLProgramBinaryCache           (      GLProgramBinaryCache&&) = delete;
+    GLProgramBinaryCache& operator=(const GLProgramBinaryCache&)  = delete;
+    GLProgramBinaryCache& operator=(      GLProgramBinaryCache&&) = delete;
+    // clang-format on
+
+    /// Returns true if the current GL context supports program binaries.
+    static bool IsSupported();
+
+    /// Returns the string that identifies the driver of the current GL context.
+    static std::string GetDriverId();
+
+    /// Loads the binary for the given key into the program object.
+
+    /// \param [in] key     - Entry key.
+    /// \param [in] Program - Program object to load the binary into. Program parameters
+    ///                       such as GL_PROGRAM_SEPARABLE must be set before the call.
+    /// \return     true if the binary was found and accepted by the driver, and false otherwise.
+    ///             If the binary was rejected, the program is left unlinked and can be
+    ///             linked from the attached shaders.
+    bool Load(const Key& key, GLuint Program);
+
+    /// Retrieves the binary of the successfully linked program and writes it to the cache.
+    void Store(const Key& key, GLuint Program);
+
+    Statistics GetStatistics() const;
+
+    /// Returns the path of the file that stores the entry for the given key.
+    std::string GetEntryFilePath(const Key& key) const;
+
+private:
+    const std::string m_Directory;
+
+    // Hash of the driver identification strings
+    const Key m_DriverKey;
+
+    mutable std::mutex m_StatsMtx;
+    Statistics         m_Stats;
+};
+
+} // namespace Diligent
@@ -1203,6 +1203,16 @@ extern PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
 typedef void (GL_APIENTRY* PFNGLQUERYCOUNTERPROC) (GLuint id, GLenum target);
 extern PFNGLQUERYCOUNTERPROC glQueryCounter;
 
+#ifndef GL_KHR_parallel_shader_compile
+#   define GL_KHR_parallel_shader_compile 1
+#   define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#   define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+#define LOAD_GL_MAX_SHADER_COMPILER_THREADS_KHR
+typedef void (GL_APIENTRY* PFNGLMAXSHADERCOMPILERTHREADSKHRPROC) (GLuint count);
+extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glMaxShaderCompilerThreadsKHR;
+
 
 #ifndef GL_ES_VERSION_3_2
 
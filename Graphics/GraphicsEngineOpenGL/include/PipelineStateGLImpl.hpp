@@ -84,6 +84,9 @@ public:
     /// Implementation of IPipelineState::IsCompatibleWith() in OpenGL backend.
     virtual bool DILIGENT_CALL_TYPE IsCompatibleWith(const IPipelineState* pPSO) const override final;
 
+    /// Implementation of IPipelineState::GetStatus() in OpenGL backend.
+    virtual PIPELINE_STATE_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) const override final;
+
     void CommitProgram(GLContextState& State);
 
     void InitializeSRBResourceCache(GLProgramResourceCache& ResourceCache) const;
@@ -100,8 +103,11 @@ private:
     template <typename PSOCreateInfoType>
     void Initialize(const PSOCreateInfoType& CreateInfo, std::vector<ShaderGLImpl*>& Shaders);
 
-    void InitResourceLayouts(std::vector<ShaderGLImpl*>& Shaders,
-                             FixedLinearAllocator&       MemPool);
+    void BeginLinkPrograms(std::vector<ShaderGLImpl*>& Shaders);
+
+    void InitResourceLayouts();
+
+    void FinishCompilation();
 
     void Destruct();
 
@@ -136,6 +142,13 @@ private:
 
     using SamplerPtr                = RefCntAutoPtr<ISampler>;
     SamplerPtr* m_ImmutableSamplers = nullptr; // [m_Desc.ResourceLayout.NumImmutableSamplers]
+
+    // Programs that were submitted for linking, but whose status has not been queried yet.
+    std::vector<ShaderGLImpl::ProgramLinkInfo> m_PendingLinks;
+    // Shaders are only referenced until the programs of an asynchronous pipeline are linked.
+    std::vector<RefCntAutoPtr<ShaderGLImpl>> m_PendingShaders;
+
+    PIPELINE_STATE_STATUS m_Status = PIPELINE_STATE_STATUS_UNINITIALIZED;
 };
 
 } // namespace Diligent
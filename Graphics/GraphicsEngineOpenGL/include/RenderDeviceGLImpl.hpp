@@ -34,6 +34,8 @@
 #include "BaseInterfacesGL.h"
 #include "FBOCache.hpp"
 #include "TexRegionRender.hpp"
+#include "GLDynamicHeap.hpp"
+#include "GLProgramBinaryCache.hpp"
 
 namespace Diligent
 {
@@ -138,6 +140,9 @@ public:
                                                               RESOURCE_STATE     InitialState,
                                                               ITexture**         ppTexture) override final;
 
+    /// Implementation of IRenderDeviceGL::GetProgramBinaryCacheStatistics().
+    virtual void DILIGENT_CALL_TYPE GetProgramBinaryCacheStatistics(ProgramBinaryCacheStatistics& Stats) override final;
+
     /// Implementation of IRenderDeviceGL::CreateBufferFromGLHandle().
     virtual void DILIGENT_CALL_TYPE CreateBufferFromGLHandle(Uint32            GLHandle,
                                                              const BufferDesc& BuffDesc,
@@ -167,6 +172,16 @@ public:
 
     void InitTexRegionRender();
 
+    /// Returns the persistently mapped dynamic heap, or null if buffer storage is not supported or the heap is disabled.
+    GLDynamicHeap* GetDynamicHeap() { return m_pDynamicHeap.get(); }
+
+    /// Returns the program binary cache, or null if the cache is disabled or program binaries are not supported.
+    GLProgramBinaryCache* GetProgramBinaryCache() { return m_pProgramBinaryCache.get(); }
+
+    /// Returns true if the driver reports shader compile and program link completion
+    /// through GL_COMPLETION_STATUS_KHR (GL_KHR_parallel_shader_compile or GL_ARB_parallel_shader_compile).
+    bool IsParallelShaderCompileSupported() const { return m_ParallelShaderCompileSupported; }
+
 protected:
     friend class DeviceContextGLImpl;
     friend class TextureBaseGL;
@@ -190,6 +205,12 @@ protected:
 
     std::unique_ptr<TexRegionRender> m_pTexRegionRender;
 
+    std::unique_ptr<GLDynamicHeap> m_pDynamicHeap;
+
+    std::unique_ptr<GLProgramBinaryCache> m_pProgramBinaryCache;
+
+    bool m_ParallelShaderCompileSupported = false;
+
 private:
     template <typename PSOCreateInfoType>
     void CreatePipelineState(const PSOCreateInfoType& PSOCreateInfo, IPipelineState** ppPipelineState, bool bIsDeviceInternal);
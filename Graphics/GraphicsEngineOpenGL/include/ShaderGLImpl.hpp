@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "BaseInterfacesGL.h"
 #include "ShaderGL.h"
 #include "ShaderBase.hpp"
@@ -92,11 +94,68 @@ public:
     /// Implementation of IShader::GetResource() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const override final;
 
-    static GLObjectWrappers::GLProgramObj LinkProgram(ShaderGLImpl** ppShaders, Uint32 NumShaders, bool IsSeparableProgram);
+    /// Implementation of IShader::GetStatus() in OpenGL backend.
+    virtual SHADER_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) const override final;
+
+    /// Program that is being linked from the shaders or that was loaded from the program binary cache.
+    struct ProgramLinkInfo
+    {
+        GLObjectWrappers::GLProgramObj Program{false};
+
+        // Shaders attached to the program. Empty if the program was loaded from the cache.
+        std::vector<ShaderGLImpl*> Shaders;
+
+        GLProgramBinaryCache::Key CacheKey{};
+    };
+
+    /// Loads the program from the program binary cache, or submits the shaders for compilation
+    /// and starts linking the program without waiting for the result.
+
+    /// The shaders must stay alive until FinishLinkProgram() is called.
+    static void BeginLinkProgram(ShaderGLImpl**   ppShaders,
+                                 Uint32           NumShaders,
+                                 bool             IsSeparableProgram,
+                                 ProgramLinkInfo& Link);
+
+    /// Returns true if FinishLinkProgram() will not block. If the driver does not support
+    /// GL_KHR_parallel_shader_compile, the method always returns true.
+    static bool IsLinkComplete(const ProgramLinkInfo& Link);
+
+    /// Waits for the program to be linked, checks the compile and link status,
+    /// and stores the program in the binary cache.
+
+    /// If compilation fails and ppCompilerOutput is not null, it receives the compiler output.
+    /// The method throws an exception if compilation or linking fails.
+    static GLObjectWrappers::GLProgramObj FinishLinkProgram(ProgramLinkInfo& Link,
+                                                            IDataBlob**      ppCompilerOutput = nullptr) noexcept(false);
+
+    /// Links the program from the shaders or loads it from the program binary cache.
+    static GLObjectWrappers::GLProgramObj LinkProgram(ShaderGLImpl** ppShaders,
+                                                      Uint32         NumShaders,
+                                                      bool           IsSeparableProgram,
+                                                      IDataBlob**    ppCompilerOutput = nullptr);
 
 private:
+    void SubmitCompile();
+    void CheckCompileStatus(IDataBlob** ppCompilerOutput) noexcept(false);
+    bool IsCompileComplete() const;
+    void LoadUniforms(const GLObjectWrappers::GLProgramObj& Program);
+    void FinishCompilation();
+
     GLObjectWrappers::GLShaderObj m_GLShaderObj;
     GLProgramResources            m_Resources;
+
+    // Hash of the shader type and the final GLSL source; only computed when the program binary cache is enabled
+    GLProgramBinaryCache::Key m_SourceKey{};
+
+    // Separable program that is being linked for the asynchronously compiled shader.
+    // Resources are loaded when the link is finished.
+    ProgramLinkInfo m_PendingLink;
+
+    SHADER_STATUS m_Status = SHADER_STATUS_UNINITIALIZED;
+
+    bool m_IsCompileSubmitted = false;
+    bool m_IsCompiled         = false;
 };
 
 } // namespace Diligent
@@ -39,6 +39,27 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static const INTERFACE_ID IID_RenderDeviceGL =
     {0xb4b395b9, 0xac99, 0x4e8a, {0xb7, 0xe1, 0x9d, 0xca, 0xd, 0x48, 0x56, 0x18}};
 
+/// Program binary cache statistics, see IRenderDeviceGL::GetProgramBinaryCacheStatistics().
+struct ProgramBinaryCacheStatistics
+{
+    /// The number of programs that were loaded from the cache.
+    Uint32 NumHits DEFAULT_INITIALIZER(0);
+
+    /// The number of programs that were not found in the cache and were linked from the source.
+    Uint32 NumMisses DEFAULT_INITIALIZER(0);
+
+    /// The number of cached binaries that were rejected by the driver.
+    /// Rejected binaries are also counted as misses.
+    Uint32 NumRejected DEFAULT_INITIALIZER(0);
+
+    /// The number of binaries written to the cache since the device was created.
+    Uint32 NumStored DEFAULT_INITIALIZER(0);
+
+    /// The total size of the binaries written to the cache since the device was created, in bytes.
+    Uint64 StoredDataSize DEFAULT_INITIALIZER(0);
+};
+typedef struct ProgramBinaryCacheStatistics ProgramBinaryCacheStatistics;
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceGL
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -113,6 +134,14 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceGL, IRenderDevice)
                                             const TextureDesc REF TexDesc,
                                             RESOURCE_STATE        InitialState,
                                             ITexture**            ppTexture) PURE;
+
+    /// Returns program binary cache statistics.
+
+    /// \param [out] Stats - Cache statistics. If the cache is disabled
+    ///                      (EngineGLCreateInfo::ProgramBinaryCacheDirectory is null)
+    ///                      or is not supported by the device, all members are set to zero.
+    VIRTUAL void METHOD(GetProgramBinaryCacheStatistics)(THIS_
+                                                         ProgramBinaryCacheStatistics REF Stats) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -122,9 +151,10 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IRenderDeviceGL_CreateTextureFromGLHandle(This, ...)CALL_IFACE_METHOD(RenderDeviceGL, CreateTextureFromGLHandle, This, __VA_ARGS__)
-#    define IRenderDeviceGL_CreateBufferFromGLHandle(This, ...) CALL_IFACE_METHOD(RenderDeviceGL, CreateBufferFromGLHandle,  This, __VA_ARGS__)
-#    define IRenderDeviceGL_CreateDummyTexture(This, ...)       CALL_IFACE_METHOD(RenderDeviceGL, CreateDummyTexture,        This, __VA_ARGS__)
+#    define IRenderDeviceGL_CreateTextureFromGLHandle(This, ...)      CALL_IFACE_METHOD(RenderDeviceGL, CreateTextureFromGLHandle,       This, __VA_ARGS__)
+#    define IRenderDeviceGL_CreateBufferFromGLHandle(This, ...)       CALL_IFACE_METHOD(RenderDeviceGL, CreateBufferFromGLHandle,        This, __VA_ARGS__)
+#    define IRenderDeviceGL_CreateDummyTexture(This, ...)             CALL_IFACE_METHOD(RenderDeviceGL, CreateDummyTexture,              This, __VA_ARGS__)
+#    define IRenderDeviceGL_GetProgramBinaryCacheStatistics(This, ...)CALL_IFACE_METHOD(RenderDeviceGL, GetProgramBinaryCacheStatistics, This, __VA_ARGS__)
 
 // clang-format on
 
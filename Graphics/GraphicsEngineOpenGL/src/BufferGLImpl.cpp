@@ -68,6 +68,17 @@ static GLenum GetBufferBindTarget(const BufferDesc& Desc)
 
     return Target;
 }
+
+static GLDynamicHeap* GetBufferDynamicHeap(RenderDeviceGLImpl* pDeviceGL, const BufferDesc& Desc)
+{
+    // Only dynamic uniform buffers are suballocated from the dynamic heap as they are bound with
+    // glBindBufferRange(). Vertex and index buffers are referenced by VAOs that are cached by the
+    // buffer handle, so dynamic vertex and index buffers keep using their own storage.
+    return (Desc.Usage == USAGE_DYNAMIC && Desc.BindFlags == BIND_UNIFORM_BUFFER) ?
+        pDeviceGL->GetDynamicHeap() :
+        nullptr;
+}
+
 BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
                            FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
                            RenderDeviceGLImpl*        pDeviceGL,
@@ -84,7 +95,8 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
         BuffDesc,
         bIsDeviceInternal
     },
-    m_GlBuffer    {true                          }, // Create buffer immediately
+    m_pDynamicHeap{GetBufferDynamicHeap(pDeviceGL, BuffDesc)},
+    m_GlBuffer    {m_pDynamicHeap == nullptr     }, // Create buffer immediately unless it is suballocated
     m_BindTarget  {GetBufferBindTarget(BuffDesc) },
     m_GLUsageHint {UsageToGLUsage(BuffDesc)}
 // clang-format on
@@ -99,6 +111,12 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
     if (m_Desc.Usage == USAGE_IMMUTABLE)
         VERIFY(pBuffData != nullptr && pBuffData->pData != nullptr, "Initial data must not be null for immutable buffers");
 
+    if (m_pDynamicHeap != nullptr)
+    {
+        // Memory for the buffer is allocated in the dynamic heap when the buffer is mapped
+        return;
+    }
+
     // TODO: find out if it affects performance if the buffer is originally bound to one target
     // and then bound to another (such as first to GL_ARRAY_BUFFER and then to GL_UNIFORM_BUFFER)
 
@@ -202,6 +220,7 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
         GetBufferDescFromGLHandle(CtxState, BuffDesc, GLHandle),
         bIsDeviceInternal
     },
+    m_pDynamicHeap{nullptr},
     // Attach to external buffer handle
     m_GlBuffer    {true, GLObjectWrappers::GLBufferObjCreateReleaseHelper(GLHandle)},
     m_BindTarget  {GetBufferBindTarget(m_Desc)   },
@@ -239,6 +258,12 @@ void BufferGLImpl::UpdateData(GLContextState& CtxState, Uint32 Offset, Uint32 Si
 
 void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL, Uint32 SrcOffset, Uint32 DstOffset, Uint32 Size)
 {
+    if (m_pDynamicHeap != nullptr)
+    {
+        LOG_ERROR("Dynamic buffers cannot be copy destinations");
+        return;
+    }
+
     BufferMemoryBarrier(
         GL_BUFFER_UPDATE_BARRIER_BIT, // Reads or writes to buffer objects via any OpenGL API functions that allow
                                       // modifying their contents will reflect data written by shaders prior to the barrier.
@@ -256,8 +281,8 @@ void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL,
     // what was bound to the target before your copy.
     constexpr bool ResetVAO = false; // No need to reset VAO for READ/WRITE targets
     CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, m_GlBuffer, ResetVAO);
-    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.m_GlBuffer, ResetVAO);
-    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, SrcOffset, DstOffset, Size);
+    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.GetGLHandle(), ResetVAO);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, SrcOffset + SrcBufferGL.GetDynamicOffset(), DstOffset, Size);
     CHECK_GL_ERROR("glCopyBufferSubData() failed");
     CtxState.BindBuffer(GL_COPY_READ_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
     CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
@@ -270,6 +295,42 @@ void BufferGLImpl::Map(GLContextState& CtxState, MAP_TYPE MapType, Uint32 MapFla
 
 void BufferGLImpl::MapRange(GLContextState& CtxState, MAP_TYPE MapType, Uint32 MapFlags, Uint32 Offset, Uint32 Length, PVoid& pMappedData)
 {
+    if (m_pDynamicHeap != nullptr)
+    {
+        VERIFY(MapType == MAP_WRITE, "Dynamic buffers can only be mapped for writing");
+        VERIFY(Offset + Length <= m_Desc.uiSizeInBytes, "Map range is out of buffer bounds");
+
+        const auto CurrentFrame = m_pDynamicHeap->GetCurrentFrame();
+        if ((MapFlags & MAP_FLAG_DISCARD) != 0 || m_DynamicOffset == GLDynamicHeap::InvalidOffset)
+        {
+            // Every discard allocates a new region in the ring, so the GPU may keep
+            // reading the previous contents while the CPU writes the new data.
+            // Contents beyond the mapped range are undefined after the discard, so the
+            // region only needs to extend to the end of the range.
+            m_DynamicOffset     = m_pDynamicHeap->Allocate(Offset + Length);
+            m_DynamicAllocSize  = m_DynamicOffset != GLDynamicHeap::InvalidOffset ? Offset + Length : 0;
+            m_DynamicAllocFrame = CurrentFrame;
+        }
+        else
+        {
+            DEV_CHECK_ERR(m_DynamicAllocFrame == CurrentFrame, "Dynamic buffer '", m_Desc.Name, "' is mapped with MAP_FLAG_NO_OVERWRITE, "
+                          "but its memory was allocated in a previous frame. The buffer must be mapped with MAP_FLAG_DISCARD first in every frame.");
+            if (Offset + Length > m_DynamicAllocSize)
+            {
+                LOG_ERROR_MESSAGE("Range [", Offset, ", ", Offset + Length, ") of dynamic buffer '", m_Desc.Name, "' mapped with MAP_FLAG_NO_OVERWRITE "
+                                  "exceeds the range [0, ", m_DynamicAllocSize, ") that was mapped with MAP_FLAG_DISCARD.");
+                pMappedData = nullptr;
+                return;
+            }
+        }
+
+        // The heap is mapped with GL_MAP_COHERENT_BIT, so no flush is required when the buffer is unmapped
+        pMappedData = m_DynamicOffset != GLDynamicHeap::InvalidOffset ?
+            m_pDynamicHeap->GetCPUAddress(m_DynamicOffset) + Offset :
+            nullptr;
+        return;
+    }
+
     BufferMemoryBarrier(
         GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT, // Access by the client to persistent mapped regions of buffer
                                              // objects will reflect data written by shaders prior to the barrier.
@@ -331,6 +392,12 @@ void BufferGLImpl::MapRange(GLContextState& CtxState, MAP_TYPE MapType, Uint32 M
 
 void BufferGLImpl::Unmap(GLContextState& CtxState)
 {
+    if (m_pDynamicHeap != nullptr)
+    {
+        // Dynamic heap is persistently mapped
+        return;
+    }
+
     constexpr bool ResetVAO = true;
     CtxState.BindBuffer(m_BindTarget, m_GlBuffer, ResetVAO);
     auto Result = glUnmapBuffer(m_BindTarget);
@@ -346,6 +413,18 @@ void BufferGLImpl::Unmap(GLContextState& CtxState)
     (void)Result;
 }
 
+#ifdef DILIGENT_DEVELOPMENT
+void BufferGLImpl::DvpVerifyDynamicAllocation() const
+{
+    if (m_pDynamicHeap == nullptr)
+        return;
+
+    const auto CurrentFrame = m_pDynamicHeap->GetCurrentFrame();
+    DEV_CHECK_ERR(m_DynamicOffset != GLDynamicHeap::InvalidOffset, "Dynamic buffer '", m_Desc.Name, "' has not been mapped before its first use. Note: memory for dynamic buffers is allocated when a buffer is mapped.");
+    DEV_CHECK_ERR(m_DynamicAllocFrame == CurrentFrame, "Dynamic allocation of dynamic buffer '", m_Desc.Name, "' in frame ", CurrentFrame, " is out-of-date. Note: contents of all dynamic resources is discarded at the end of every frame. A buffer must be mapped before its first use in any frame.");
+}
+#endif
+
 void BufferGLImpl::BufferMemoryBarrier(Uint32 RequiredBarriers, GLContextState& GLContextState)
 {
 #if GL_ARB_shader_image_load_store
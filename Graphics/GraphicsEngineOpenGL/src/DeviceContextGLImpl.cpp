@@ -82,6 +82,15 @@ void DeviceContextGLImpl::SetPipelineState(IPipelineState* pPipelineState)
     if (PipelineStateGLImpl::IsSameObject(m_pPipelineState, pPipelineStateGLImpl))
         return;
 
+    // An asynchronous pipeline must finish linking before it can be used.
+    // A pipeline that failed to compile is rejected here rather than on every draw command.
+    if (pPipelineStateGLImpl->GetStatus(true) != PIPELINE_STATE_STATUS_READY)
+    {
+        LOG_ERROR_MESSAGE("Pipeline state '", pPipelineStateGLImpl->GetDesc().Name, "' failed to compile and can't be bound to the context");
+        m_pPipelineState.Release();
+        return;
+    }
+
     TDeviceContextBase::SetPipelineState(pPipelineStateGLImpl, 0 /*Dummy*/);
 
     const auto& Desc = pPipelineStateGLImpl->GetDesc();
@@ -666,8 +675,18 @@ void DeviceContextGLImpl::BindProgramResources(Uint32& NewMemoryBarriers, IShade
                                     // will reflect data written by shaders prior to the barrier
             m_ContextState);
 
-        m_ContextState.BindUniformBuffer(ub, pBufferGL->m_GlBuffer);
-        //glBindBufferRange(GL_UNIFORM_BUFFER, it->Index, pBufferGL->m_GlBuffer, 0, pBufferGL->GetDesc().uiSizeInBytes);
+        if (pBufferGL->IsSuballocated())
+        {
+#ifdef DILIGENT_DEVELOPMENT
+            pBufferGL->DvpVerifyDynamicAllocation();
+#endif
+            if (pBufferGL->m_DynamicOffset != GLDynamicHeap::InvalidOffset)
+                m_ContextState.BindUniformBuffer(ub, pBufferGL->GetGLHandle(), pBufferGL->GetDynamicOffset(), pBufferGL->GetDynamicSize());
+        }
+        else
+        {
+            m_ContextState.BindUniformBuffer(ub, pBufferGL->m_GlBuffer);
+        }
     }
 
     for (Uint32 s = 0; s < ResourceCache.GetSamplerCount(); ++s)
@@ -952,25 +971,63 @@ void DeviceContextGLImpl::PostDraw()
     m_CommitedResourcesTentativeBarriers = 0;
 }
 
-void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
+void DeviceContextGLImpl::DrawArrays(GLenum GlTopology, Uint32 NumVertices, Uint32 NumInstances, Uint32 StartVertexLocation, Uint32 FirstInstanceLocation)
 {
-    if (!DvpVerifyDrawArguments(Attribs))
-        return;
+    if (NumInstances > 1 || FirstInstanceLocation != 0)
+    {
+        if (FirstInstanceLocation != 0)
+            glDrawArraysInstancedBaseInstance(GlTopology, StartVertexLocation, NumVertices, NumInstances, FirstInstanceLocation);
+        else
+            glDrawArraysInstanced(GlTopology, StartVertexLocation, NumVertices, NumInstances);
+    }
+    else
+    {
+        glDrawArrays(GlTopology, StartVertexLocation, NumVertices);
+    }
+}
 
-    GLenum GlTopology;
-    PrepareForDraw(Attribs.Flags, false, GlTopology);
+void DeviceContextGLImpl::DrawElements(GLenum GlTopology, GLenum GLIndexType, Uint32 FirstIndexByteOffset, Uint32 NumIndices, Uint32 NumInstances, Uint32 BaseVertex, Uint32 FirstInstanceLocation)
+{
+    // NOTE: Base Vertex and Base Instance versions are not supported even in OpenGL ES 3.1
+    // This functionality can be emulated by adjusting stream offsets. This, however may cause
+    // errors in case instance data is read from the same stream as vertex data. Thus handling
+    // such cases is left to the application
 
-    if (Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0)
+    if (NumInstances > 1 || FirstInstanceLocation != 0)
     {
-        if (Attribs.FirstInstanceLocation != 0)
-            glDrawArraysInstancedBaseInstance(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices, Attribs.NumInstances, Attribs.FirstInstanceLocation);
+        if (BaseVertex > 0)
+        {
+            if (FirstInstanceLocation != 0)
+                glDrawElementsInstancedBaseVertexBaseInstance(GlTopology, NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), NumInstances, BaseVertex, FirstInstanceLocation);
+            else
+                glDrawElementsInstancedBaseVertex(GlTopology, NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), NumInstances, BaseVertex);
+        }
         else
-            glDrawArraysInstanced(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices, Attribs.NumInstances);
+        {
+            if (FirstInstanceLocation != 0)
+                glDrawElementsInstancedBaseInstance(GlTopology, NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), NumInstances, FirstInstanceLocation);
+            else
+                glDrawElementsInstanced(GlTopology, NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), NumInstances);
+        }
     }
     else
     {
-        glDrawArrays(GlTopology, Attribs.StartVertexLocation, Attribs.NumVertices);
+        if (BaseVertex > 0)
+            glDrawElementsBaseVertex(GlTopology, NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), BaseVertex);
+        else
+            glDrawElements(GlTopology, NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)));
     }
+}
+
+void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
+{
+    if (!DvpVerifyDrawArguments(Attribs))
+        return;
+
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, false, GlTopology);
+
+    DrawArrays(GlTopology, Attribs.NumVertices, Attribs.NumInstances, Attribs.StartVertexLocation, Attribs.FirstInstanceLocation);
     DEV_CHECK_GL_ERROR("OpenGL draw command failed");
 
     PostDraw();
@@ -987,36 +1044,55 @@ void DeviceContextGLImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     Uint32 FirstIndexByteOffset;
     PrepareForIndexedDraw(Attribs.IndexType, Attribs.FirstIndexLocation, GLIndexType, FirstIndexByteOffset);
 
-    // NOTE: Base Vertex and Base Instance versions are not supported even in OpenGL ES 3.1
-    // This functionality can be emulated by adjusting stream offsets. This, however may cause
-    // errors in case instance data is read from the same stream as vertex data. Thus handling
-    // such cases is left to the application
+    DrawElements(GlTopology, GLIndexType, FirstIndexByteOffset, Attribs.NumIndices, Attribs.NumInstances, Attribs.BaseVertex, Attribs.FirstInstanceLocation);
+    DEV_CHECK_GL_ERROR("OpenGL draw command failed");
+
+    PostDraw();
+}
+
+void DeviceContextGLImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawArguments(Attribs))
+        return;
 
-    if (Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0)
+    if (Attribs.DrawCount == 0)
+        return;
+
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, false, GlTopology);
+
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
     {
-        if (Attribs.BaseVertex > 0)
-        {
-            if (Attribs.FirstInstanceLocation != 0)
-                glDrawElementsInstancedBaseVertexBaseInstance(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.BaseVertex, Attribs.FirstInstanceLocation);
-            else
-                glDrawElementsInstancedBaseVertex(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.BaseVertex);
-        }
-        else
-        {
-            if (Attribs.FirstInstanceLocation != 0)
-                glDrawElementsInstancedBaseInstance(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances, Attribs.FirstInstanceLocation);
-            else
-                glDrawElementsInstanced(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.NumInstances);
-        }
+        const auto& Item = Attribs.pDrawItems[i];
+        DrawArrays(GlTopology, Item.NumVertices, Item.NumInstances, Item.StartVertexLocation, Item.FirstInstanceLocation);
     }
-    else
+    DEV_CHECK_GL_ERROR("OpenGL multi-draw command failed");
+
+    PostDraw();
+}
+
+void DeviceContextGLImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    if (!DvpVerifyMultiDrawIndexedArguments(Attribs))
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    GLenum GlTopology;
+    PrepareForDraw(Attribs.Flags, true, GlTopology);
+    GLenum GLIndexType;
+    Uint32 IndexDataStartByteOffset;
+    PrepareForIndexedDraw(Attribs.IndexType, 0, GLIndexType, IndexDataStartByteOffset);
+
+    const auto IndexSize = static_cast<Uint32>(GetValueSize(Attribs.IndexType));
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
     {
-        if (Attribs.BaseVertex > 0)
-            glDrawElementsBaseVertex(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)), Attribs.BaseVertex);
-        else
-            glDrawElements(GlTopology, Attribs.NumIndices, GLIndexType, reinterpret_cast<GLvoid*>(static_cast<size_t>(FirstIndexByteOffset)));
+        const auto& Item = Attribs.pDrawItems[i];
+        DrawElements(GlTopology, GLIndexType, IndexDataStartByteOffset + IndexSize * Item.FirstIndexLocation,
+                     Item.NumIndices, Item.NumInstances, Item.BaseVertex, Item.FirstInstanceLocation);
     }
-    DEV_CHECK_GL_ERROR("OpenGL draw command failed");
+    DEV_CHECK_GL_ERROR("OpenGL multi-draw command failed");
 
     PostDraw();
 }
@@ -1274,6 +1350,9 @@ void DeviceContextGLImpl::Flush()
 
 void DeviceContextGLImpl::FinishFrame()
 {
+    if (auto* pDynamicHeap = m_pDevice->GetDynamicHeap())
+        pDynamicHeap->FinishFrame();
+
     TDeviceContextBase::EndFrame();
 }
 
@@ -1307,6 +1386,16 @@ void DeviceContextGLImpl::WaitForFence(IFence* pFence, Uint64 Value, bool FlushC
     pFenceGLImpl->Wait(Value, FlushContext);
 }
 
+void DeviceContextGLImpl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    VERIFY(!m_bIsDeferred, "Fence can only be waited from immediate context");
+    // All commands are executed by the single GL context in order, so the commands that follow
+    // the wait are executed after the fence is signaled as long as the signal command has been recorded.
+    auto* pFenceGLImpl = ValidatedCast<FenceGLImpl>(pFence);
+    DEV_CHECK_ERR(pFenceGLImpl->GetLastSignaledValue() >= Value, "Fence '", pFenceGLImpl->GetDesc().Name, "' has not been signaled with value ", Value,
+                  ". The wait can never complete and would deadlock the GPU in backends that use multiple queues.");
+}
+
 void DeviceContextGLImpl::WaitForIdle()
 {
     VERIFY(!m_bIsDeferred, "Only immediate contexts can be idled");
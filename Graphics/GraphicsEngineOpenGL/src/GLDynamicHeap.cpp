@@ -0,0 +1,178 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include <limits>
+#include <iomanip>
+
+#include "GLDynamicHeap.hpp"
+#include "FormatString.hpp"
+
+namespace Diligent
+{
+
+GLDynamicHeap::GLDynamicHeap(IMemoryAllocator& Allocator, Uint32 Size, Uint32 Alignment) :
+    // clang-format off
+    m_GLBuffer  {true              },
+    m_RingBuffer{Size, Allocator   },
+    m_Alignment {std::max(Alignment, Uint32{16})}
+// clang-format on
+{
+    VERIFY(IsPowerOfTwo(m_Alignment), "Alignment (", m_Alignment, ") must be power of 2");
+
+#if GL_ARB_buffer_storage
+    // Use GL_COPY_WRITE_BUFFER target to avoid disturbing any other binding
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_GLBuffer);
+    CHECK_GL_ERROR_AND_THROW("Failed to bind dynamic heap buffer");
+
+    // GL_MAP_COHERENT_BIT makes CPU writes visible to the GPU without explicit flushes, so that
+    // there is no need to call glFlushMappedBufferRange() or glMemoryBarrier(GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT)
+    constexpr GLbitfield StorageFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_COPY_WRITE_BUFFER, Size, nullptr, StorageFlags);
+    CHECK_GL_ERROR_AND_THROW("Failed to allocate dynamic heap storage");
+
+    m_CPUAddress = reinterpret_cast<Uint8*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, Size, StorageFlags));
+    CHECK_GL_ERROR_AND_THROW("Failed to persistently map dynamic heap");
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    if (m_CPUAddress == nullptr)
+        LOG_ERROR_AND_THROW("Failed to persistently map dynamic heap");
+#else
+    LOG_ERROR_AND_THROW("GL_ARB_buffer_storage is not supported");
+#endif
+
+    LOG_INFO_MESSAGE("GL dynamic heap created. Total buffer size: ", FormatMemorySize(Size, 2));
+}
+
+GLDynamicHeap::~GLDynamicHeap()
+{
+    // Wait until the GPU is done with all the memory before releasing the buffer
+    FinishFrame();
+    while (!m_PendingFrames.empty())
+        ReleaseCompletedFrames(true);
+
+#if GL_ARB_buffer_storage
+    if (m_CPUAddress != nullptr)
+    {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, m_GLBuffer);
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        m_CPUAddress = nullptr;
+    }
+#endif
+
+    const auto Size = m_RingBuffer.GetMaxSize();
+    LOG_INFO_MESSAGE("GL dynamic heap usage stats:\n"
+                     "                       Total size: ",
+                     FormatMemorySize(Size, 2),
+                     ". Peak allocated size: ", FormatMemorySize(m_PeakUsedSize, 2, Size),
+                     ". Peak utilization: ",
+                     std::fixed, std::setprecision(1), static_cast<double>(m_PeakUsedSize) / static_cast<double>(std::max(Size, size_t{1})) * 100.0, '%');
+}
+
+GLDynamicHeap::OffsetType GLDynamicHeap::Allocate(Uint32 SizeInBytes)
+{
+    VERIFY_EXPR(SizeInBytes > 0);
+
+    auto Offset = m_RingBuffer.Allocate(SizeInBytes, m_Alignment);
+    if (Offset == InvalidOffset)
+    {
+        // Release frames that have already been completed by the GPU, and if that is
+        // not enough, block until the oldest pending frames are finished.
+        ReleaseCompletedFrames(false);
+        Offset = m_RingBuffer.Allocate(SizeInBytes, m_Alignment);
+        while (Offset == InvalidOffset && !m_PendingFrames.empty())
+        {
+            ReleaseCompletedFrames(true);
+            Offset = m_RingBuffer.Allocate(SizeInBytes, m_Alignment);
+        }
+    }
+
+    if (Offset == InvalidOffset)
+    {
+        LOG_ERROR_MESSAGE("Failed to allocate ", SizeInBytes, " bytes from the GL dynamic heap of size ", m_RingBuffer.GetMaxSize(),
+                          ": the space allocated in the current frame exceeds the heap size. "
+                          "The app should increase EngineGLCreateInfo::DynamicHeapSize or call FinishFrame() more often.");
+        return InvalidOffset;
+    }
+
+    m_PeakUsedSize = std::max(m_PeakUsedSize, m_RingBuffer.GetUsedSize());
+
+    return Offset;
+}
+
+void GLDynamicHeap::FinishFrame()
+{
+    GLObjectWrappers::GLSyncObj FrameSync{glFenceSync(
+        GL_SYNC_GPU_COMMANDS_COMPLETE, // Condition must always be GL_SYNC_GPU_COMMANDS_COMPLETE
+        0                              // Flags, must be 0
+        )};
+    DEV_CHECK_GL_ERROR("Failed to create gl fence");
+
+    m_RingBuffer.FinishCurrentFrame(m_CurrentFrame);
+    m_PendingFrames.emplace_back(m_CurrentFrame, std::move(FrameSync));
+    ++m_CurrentFrame;
+
+    ReleaseCompletedFrames(false);
+}
+
+void GLDynamicHeap::ReleaseCompletedFrames(bool WaitForOldest)
+{
+    Uint64 CompletedFrame = 0;
+    while (!m_PendingFrames.empty())
+    {
+        auto& frame_sync = m_PendingFrames.front();
+
+        auto res = glClientWaitSync(frame_sync.second,
+                                    WaitForOldest ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+                                    WaitForOldest ? std::numeric_limits<GLuint64>::max() : 0);
+        if (res == GL_WAIT_FAILED)
+        {
+            // The wait fails if the context is lost, in which case the GPU will never signal
+            // the remaining fences. Release all pending frames so that the callers that wait
+            // for the frames to complete do not spin forever.
+            LOG_ERROR_MESSAGE("Failed to wait for the GL dynamic heap frame fence. All pending frames will be released.");
+            CompletedFrame = m_PendingFrames.back().first;
+            m_PendingFrames.clear();
+            break;
+        }
+        if (res != GL_ALREADY_SIGNALED && res != GL_CONDITION_SATISFIED)
+            break;
+
+        CompletedFrame = frame_sync.first;
+        m_PendingFrames.pop_front();
+        // Only block on the oldest frame, and poll the rest
+        WaitForOldest = false;
+    }
+
+    if (CompletedFrame != 0)
+        m_RingBuffer.ReleaseCompletedFrames(CompletedFrame);
+}
+
+} // namespace Diligent
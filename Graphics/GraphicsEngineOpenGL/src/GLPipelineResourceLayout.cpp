@@ -55,6 +55,10 @@ size_t GLPipelineResourceLayout::GetRequiredMemorySize(GLProgramResources*
                           Counters.NumStorageBlocks * sizeof(StorageBufferBindInfo) +
                           NumPrograms               * sizeof(GLProgramResources::ResourceCounters);
     // clang-format on
+
+    // The name index is placed after the program resource counters
+    const auto NumVariables = Counters.NumUBs + Counters.NumSamplers + Counters.NumImages + Counters.NumStorageBlocks;
+    RequiredSize = Align(RequiredSize, ShaderVariableNameIndex::GetRequiredAlignment()) + ShaderVariableNameIndex::GetRequiredMemorySize(NumVariables);
     return RequiredSize;
 }
 
@@ -95,7 +99,9 @@ void GLPipelineResourceLayout::Initialize(GLProgramResources*                  P
     // clang-format off
     m_NumPrograms         = static_cast<Uint8>(NumPrograms);
     VERIFY_EXPR(m_NumPrograms == NumPrograms);
-    auto TotalMemorySize = m_VariableEndOffset + m_NumPrograms * sizeof(GLProgramResources::ResourceCounters);
+    const auto NumVariables    = Counters.NumUBs + Counters.NumSamplers + Counters.NumImages + Counters.NumStorageBlocks;
+    const auto NameIndexOffset = Align(m_VariableEndOffset + m_NumPrograms * sizeof(GLProgramResources::ResourceCounters), ShaderVariableNameIndex::GetRequiredAlignment());
+    const auto TotalMemorySize = NameIndexOffset + ShaderVariableNameIndex::GetRequiredMemorySize(NumVariables);
     VERIFY_EXPR(TotalMemorySize == GetRequiredMemorySize(ProgramResources, NumPrograms, ResourceLayout, AllowedVarTypes, NumAllowedTypes));
 
     m_PipelineType = PipelineType;
@@ -211,6 +217,15 @@ void GLPipelineResourceLayout::Initialize(GLProgramResources*                  P
     VERIFY(VarCounters.NumStorageBlocks == GetNumStorageBuffers(),  "Not all SSBOs are initialized which will cause a crash when dtor is called");
     // clang-format on
 
+    if (m_ResourceBuffer)
+    {
+        m_NameIndex.Initialize(reinterpret_cast<Uint8*>(m_ResourceBuffer.get()) + NameIndexOffset, NumVariables,
+                               [this](Uint32 VarIdx) //
+                               {
+                                   return GetVariable(VarIdx).m_Attribs.Name;
+                               });
+    }
+
     m_pResourceCache = pResourceCache;
     if (m_pResourceCache != nullptr && !m_pResourceCache->IsInitialized())
     {
@@ -503,18 +518,21 @@ void GLPipelineResourceLayout::BindResources(SHADER_TYPE ShaderStage, IResourceM
 }
 
 
-template <typename ResourceType>
-IShaderResourceVariable* GLPipelineResourceLayout::GetResourceByName(SHADER_TYPE ShaderStage, const Char* Name)
+GLPipelineResourceLayout::GLVariableBase& GLPipelineResourceLayout::GetVariable(Uint32 Index)
 {
-    auto NumResources = GetNumResources<ResourceType>();
-    for (Uint32 res = 0; res < NumResources; ++res)
-    {
-        auto& Resource = GetResource<ResourceType>(res);
-        if ((Resource.m_Attribs.ShaderStages & ShaderStage) != 0 && strcmp(Resource.m_Attribs.Name, Name) == 0)
-            return &Resource;
-    }
+    if (Index < GetNumUBs())
+        return GetResource<UniformBuffBindInfo>(Index);
+    Index -= GetNumUBs();
 
-    return nullptr;
+    if (Index < GetNumSamplers())
+        return GetResource<SamplerBindInfo>(Index);
+    Index -= GetNumSamplers();
+
+    if (Index < GetNumImages())
+        return GetResource<ImageBindInfo>(Index);
+    Index -= GetNumImages();
+
+    return GetResource<StorageBufferBindInfo>(Index);
 }
 
 
@@ -522,19 +540,17 @@ IShaderResourceVariable* GLPipelineResourceLayout::GetShaderVariable(SHADER_TYPE
 {
     VERIFY_EXPR(IsConsistentShaderType(ShaderStage, static_cast<PIPELINE_TYPE>(m_PipelineType)));
 
-    if (auto* pUB = GetResourceByName<UniformBuffBindInfo>(ShaderStage, Name))
-        return pUB;
-
-    if (auto* pSampler = GetResourceByName<SamplerBindInfo>(ShaderStage, Name))
-        return pSampler;
-
-    if (auto* pImage = GetResourceByName<ImageBindInfo>(ShaderStage, Name))
-        return pImage;
-
-    if (auto* pSSBO = GetResourceByName<StorageBufferBindInfo>(ShaderStage, Name))
-        return pSSBO;
-
-    return nullptr;
+    const auto VarIdx = m_NameIndex.Find(
+        Name,
+        [this](Uint32 Idx) //
+        {
+            return GetVariable(Idx).m_Attribs.Name;
+        },
+        [this, ShaderStage](Uint32 Idx) //
+        {
+            return (GetVariable(Idx).m_Attribs.ShaderStages & ShaderStage) != 0;
+        });
+    return VarIdx != ShaderVariableNameIndex::InvalidIndex ? &GetVariable(VarIdx) : nullptr;
 }
 
 Uint32 GLPipelineResourceLayout::GetNumVariables(SHADER_TYPE ShaderStage) const
@@ -0,0 +1,236 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+#include "GLProgramBinaryCache.hpp"
+#include "FileWrapper.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 ProgramBinaryMagic   = 0x42504C47; // 'GLPB'
+constexpr Uint32 ProgramBinaryVersion = 1;
+
+struct EntryHeader
+{
+    Uint32 Magic   = ProgramBinaryMagic;
+    Uint32 Version = ProgramBinaryVersion;
+    Uint32 Format  = 0;
+    Uint32 Size    = 0;
+};
+static_assert(sizeof(EntryHeader) == 16, "Entry header layout must not depend on the platform");
+
+} // namespace
+
+GLProgramBinaryCache::GLProgramBinaryCache(const char* Directory, const std::string& DriverId) noexcept(false) :
+    // clang-format off
+    m_Directory{Directory},
+    m_DriverKey{KeyBuilder{}.Add(DriverId).Get()}
+// clang-format on
+{
+    if (!FileSystem::PathExists(Directory) && !FileSystem::CreateDirectory(Directory))
+        LOG_ERROR_AND_THROW("Failed to create program binary cache directory '", Directory, "'");
+}
+
+bool GLProgramBinaryCache::IsSupported()
+{
+#ifdef GL_NUM_PROGRAM_BINARY_FORMATS
+    // Clear errors left by previous calls so that they are not attributed to the query below.
+    // The number of iterations is limited as glGetError() may keep returning GL_CONTEXT_LOST.
+    for (Uint32 i = 0; i < 16 && glGetError() != GL_NO_ERROR; ++i)
+    {
+    }
+
+    GLint NumFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &NumFormats);
+    // The query fails if neither GL4.1/GLES3.0 nor GL_ARB_get_program_binary is supported
+    if (glGetError() != GL_NO_ERROR)
+        return false;
+    return NumFormats > 0;
+#else
+    return false;
+#endif
+}
+
+std::string GLProgramBinaryCache::GetDriverId()
+{
+    std::string DriverId;
+    for (auto Name : {GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION})
+    {
+        const auto* Str = reinterpret_cast<const char*>(glGetString(Name));
+        if (Str != nullptr)
+            DriverId += Str;
+        DriverId += '\n';
+    }
+    return DriverId;
+}
+
+std::string GLProgramBinaryCache::GetEntryFilePath(const Key& key) const
+{
+    // Mix in the driver key so that binaries from different drivers never collide
+    const auto EntryKey = KeyBuilder{}.Add(&m_DriverKey, sizeof(m_DriverKey)).Add(&key, sizeof(key)).Get();
+
+    std::stringstream PathSS;
+    PathSS << m_Directory;
+    if (!m_Directory.empty() && m_Directory.back() != '/' && m_Directory.back() != '\\')
+        PathSS << FileSystem::GetSlashSymbol();
+    PathSS << std::hex << std::setfill('0')
+           << std::setw(16) << EntryKey.Hash[0]
+           << std::setw(16) << EntryKey.Hash[1]
+           << ".glprog";
+    return PathSS.str();
+}
+
+bool GLProgramBinaryCache::Load(const Key& key, GLuint Program)
+{
+#ifdef GL_NUM_PROGRAM_BINARY_FORMATS
+    const auto Path = GetEntryFilePath(key);
+
+    std::vector<Uint8> Data;
+    if (FileSystem::FileExists(Path.c_str()))
+    {
+        FileWrapper File{Path.c_str(), EFileAccessMode::Read};
+        if (File)
+        {
+            Data.resize(File->GetSize());
+            if (!Data.empty() && !File->Read(Data.data(), Data.size()))
+                Data.clear();
+        }
+    }
+
+    EntryHeader Header;
+    if (Data.size() >= sizeof(Header))
+        memcpy(&Header, Data.data(), sizeof(Header));
+
+    // Discard entries that have not been fully written
+    if (Data.size() < sizeof(Header) ||
+        Header.Magic != ProgramBinaryMagic ||
+        Header.Version != ProgramBinaryVersion ||
+        Header.Size != Data.size() - sizeof(Header))
+    {
+        std::lock_guard<std::mutex> Lock{m_StatsMtx};
+        ++m_Stats.NumMisses;
+        return false;
+    }
+
+    glProgramBinary(Program, Header.Format, Data.data() + sizeof(Header), static_cast<GLsizei>(Header.Size));
+    // The binary may be rejected with an error or with the link status set to false
+    const bool LoadFailed = glGetError() != GL_NO_ERROR;
+    GLint      IsLinked   = GL_FALSE;
+    glGetProgramiv(Program, GL_LINK_STATUS, &IsLinked);
+
+    std::lock_guard<std::mutex> Lock{m_StatsMtx};
+    if (LoadFailed || !IsLinked)
+    {
+        LOG_INFO_MESSAGE("Cached program binary '", Path, "' was rejected by the driver. The program will be linked from the source.");
+        ++m_Stats.NumRejected;
+        ++m_Stats.NumMisses;
+        return false;
+    }
+
+    ++m_Stats.NumHits;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void GLProgramBinaryCache::Store(const Key& key, GLuint Program)
+{
+#ifdef GL_NUM_PROGRAM_BINARY_FORMATS
+    GLint BinaryLength = 0;
+    glGetProgramiv(Program, GL_PROGRAM_BINARY_LENGTH, &BinaryLength);
+    if (glGetError() != GL_NO_ERROR || BinaryLength <= 0)
+        return;
+
+    std::vector<Uint8> Data(sizeof(EntryHeader) + static_cast<size_t>(BinaryLength));
+
+    EntryHeader Header;
+    GLenum      Format = 0;
+    GLsizei     Length = 0;
+    glGetProgramBinary(Program, BinaryLength, &Length, &Format, Data.data() + sizeof(Header));
+    if (glGetError() != GL_NO_ERROR || Length <= 0)
+    {
+        LOG_WARNING_MESSAGE("Failed to retrieve program binary");
+        return;
+    }
+    Header.Format = Format;
+    Header.Size   = static_cast<Uint32>(Length);
+    memcpy(Data.data(), &Header, sizeof(Header));
+
+    const auto Path = GetEntryFilePath(key);
+
+    // Write the entry to a temporary file and then rename it, so that another process
+    // sharing the cache never reads a partially written entry.
+    std::stringstream TmpPathSS;
+    TmpPathSS << Path << '.' << std::hex << std::chrono::high_resolution_clock::now().time_since_epoch().count() << ".tmp";
+    const auto TmpPath = TmpPathSS.str();
+
+    bool Written = false;
+    {
+        FileWrapper File{TmpPath.c_str(), EFileAccessMode::Overwrite};
+        Written = File && File->Write(Data.data(), sizeof(Header) + Header.Size);
+    }
+
+    if (Written && std::rename(TmpPath.c_str(), Path.c_str()) != 0)
+    {
+        // On Windows, rename fails if the destination file exists
+        std::remove(Path.c_str());
+        Written = std::rename(TmpPath.c_str(), Path.c_str()) == 0;
+    }
+
+    if (!Written)
+    {
+        std::remove(TmpPath.c_str());
+        LOG_WARNING_MESSAGE("Failed to write program binary cache file '", Path, "'");
+        return;
+    }
+
+    std::lock_guard<std::mutex> Lock{m_StatsMtx};
+    ++m_Stats.NumStored;
+    m_Stats.StoredDataSize += Header.Size;
+#endif
+}
+
+GLProgramBinaryCache::Statistics GLProgramBinaryCache::GetStatistics() const
+{
+    std::lock_guard<std::mutex> Lock{m_StatsMtx};
+    return m_Stats;
+}
+
+} // namespace Diligent
@@ -211,6 +211,10 @@
     DECLARE_GL_FUNCTION( glQueryCounter, PFNGLQUERYCOUNTERPROC, GLuint id, GLenum target)
 #endif
 
+#ifdef LOAD_GL_MAX_SHADER_COMPILER_THREADS_KHR
+    DECLARE_GL_FUNCTION( glMaxShaderCompilerThreadsKHR, PFNGLMAXSHADERCOMPILERTHREADSKHRPROC, GLuint count)
+#endif
+
 
 void LoadGLFunctions()
 {
@@ -393,4 +397,9 @@ Func = (FuncType)eglGetProcAddress( #Func );\
     // Do not use stub
     glQueryCounter = (PFNGLQUERYCOUNTERPROC)eglGetProcAddress( "glQueryCounterEXT" );
 #endif
+
+#ifdef LOAD_GL_MAX_SHADER_COMPILER_THREADS_KHR
+    // Do not use stub: null pointer indicates that GL_KHR_parallel_shader_compile is not supported
+    glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)eglGetProcAddress( "glMaxShaderCompilerThreadsKHR" );
+#endif
 }
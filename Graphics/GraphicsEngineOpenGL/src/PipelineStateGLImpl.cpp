@@ -69,8 +69,23 @@ void PipelineStateGLImpl::Initialize(const PSOCreateInfoType& CreateInfo, std::v
     // It is important to construct all objects before initializing them because if an exception is thrown,
     // destructors will be called for all objects
 
-    InitResourceLayouts(Shaders, MemPool);
+    // Submit all compiles and links before querying any status, so that the driver
+    // can process them in parallel
+    BeginLinkPrograms(Shaders);
     InitializePipelineDesc(CreateInfo, MemPool);
+
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) != 0)
+    {
+        // The shaders must stay alive until the programs are linked
+        for (auto* pShader : Shaders)
+            m_PendingShaders.emplace_back(pShader);
+        m_Status = PIPELINE_STATE_STATUS_COMPILING;
+    }
+    else
+    {
+        InitResourceLayouts();
+        m_Status = PIPELINE_STATE_STATUS_READY;
+    }
 }
 
 PipelineStateGLImpl::PipelineStateGLImpl(IReferenceCounters*                    pRefCounters,
@@ -189,12 +204,41 @@ void PipelineStateGLImpl::Destruct()
 IMPLEMENT_QUERY_INTERFACE(PipelineStateGLImpl, IID_PipelineStateGL, TPipelineStateBase)
 
 
-void PipelineStateGLImpl::InitResourceLayouts(std::vector<ShaderGLImpl*>& Shaders,
-                                              FixedLinearAllocator&       MemPool)
+void PipelineStateGLImpl::BeginLinkPrograms(std::vector<ShaderGLImpl*>& Shaders)
+{
+    const auto& deviceCaps = GetDevice()->GetDeviceCaps();
+    VERIFY(deviceCaps.DevType != RENDER_DEVICE_TYPE_UNDEFINED, "Device caps are not initialized");
+
+    m_PendingLinks.resize(GetNumShaderStages());
+    if (deviceCaps.Features.SeparablePrograms)
+    {
+        // Program pipelines are not shared between GL contexts, so we cannot create
+        // it now
+        for (size_t i = 0; i < Shaders.size(); ++i)
+        {
+            ShaderGLImpl::BeginLinkProgram(&Shaders[i], 1, true, m_PendingLinks[i]);
+        }
+    }
+    else
+    {
+#ifdef DILIGENT_DEBUG
+        SHADER_TYPE ActiveStages = SHADER_TYPE_UNKNOWN;
+        for (const auto* pShader : Shaders)
+        {
+            const auto ShaderType = pShader->GetDesc().ShaderType;
+            VERIFY((ActiveStages & ShaderType) == 0, "Shader stage ", GetShaderTypeLiteralName(ShaderType), " is already active");
+            ActiveStages |= ShaderType;
+        }
+#endif
+
+        ShaderGLImpl::BeginLinkProgram(Shaders.data(), static_cast<Uint32>(Shaders.size()), false, m_PendingLinks[0]);
+    }
+}
+
+void PipelineStateGLImpl::InitResourceLayouts()
 {
     auto* const pDeviceGL  = GetDevice();
     const auto& deviceCaps = pDeviceGL->GetDeviceCaps();
-    VERIFY(deviceCaps.DevType != RENDER_DEVICE_TYPE_UNDEFINED, "Device caps are not initialized");
 
     auto pImmediateCtx = m_pDevice->GetImmediateContext();
     VERIFY_EXPR(pImmediateCtx);
@@ -207,16 +251,12 @@ void PipelineStateGLImpl::InitResourceLayouts(std::vector<ShaderGLImpl*>& Shader
         m_TotalStorageBufferBindings = 0;
         if (deviceCaps.Features.SeparablePrograms)
         {
-            // Program pipelines are not shared between GL contexts, so we cannot create
-            // it now
             m_ShaderResourceLayoutHash = 0;
-            for (size_t i = 0; i < Shaders.size(); ++i)
+            for (Uint32 i = 0; i < GetNumShaderStages(); ++i)
             {
-                auto*       pShaderGL  = Shaders[i];
-                const auto& ShaderDesc = pShaderGL->GetDesc();
-                m_GLPrograms[i]        = GLProgramObj{ShaderGLImpl::LinkProgram(&pShaderGL, 1, true)};
+                m_GLPrograms[i] = ShaderGLImpl::FinishLinkProgram(m_PendingLinks[i]);
                 // Load uniforms and assign bindings
-                m_ProgramResources[i].LoadUniforms(ShaderDesc.ShaderType, m_GLPrograms[i], GLState,
+                m_ProgramResources[i].LoadUniforms(GetShaderStageType(i), m_GLPrograms[i], GLState,
                                                    m_TotalUniformBufferBindings,
                                                    m_TotalSamplerBindings,
                                                    m_TotalImageBindings,
@@ -227,15 +267,12 @@ void PipelineStateGLImpl::InitResourceLayouts(std::vector<ShaderGLImpl*>& Shader
         }
         else
         {
+            // All stages are linked into a single program, but their types are still recorded
             SHADER_TYPE ActiveStages = SHADER_TYPE_UNKNOWN;
-            for (const auto* pShader : Shaders)
-            {
-                const auto ShaderType = pShader->GetDesc().ShaderType;
-                VERIFY((ActiveStages & ShaderType) == 0, "Shader stage ", GetShaderTypeLiteralName(ShaderType), " is already active");
+            for (auto ShaderType : m_ShaderStageTypes)
                 ActiveStages |= ShaderType;
-            }
 
-            m_GLPrograms[0] = ShaderGLImpl::LinkProgram(Shaders.data(), static_cast<Uint32>(Shaders.size()), false);
+            m_GLPrograms[0] = ShaderGLImpl::FinishLinkProgram(m_PendingLinks[0]);
 
             m_ProgramResources[0].LoadUniforms(ActiveStages, m_GLPrograms[0], GLState,
                                                m_TotalUniformBufferBindings,
@@ -245,6 +282,7 @@ void PipelineStateGLImpl::InitResourceLayouts(std::vector<ShaderGLImpl*>& Shader
 
             m_ShaderResourceLayoutHash = m_ProgramResources[0].GetHash();
         }
+        m_PendingLinks.clear();
 
         // Initialize master resource layout that keeps all variable types and does not reference a resource cache
         m_ResourceLayout.Initialize(m_ProgramResources, GetNumShaderStages(), m_Desc.PipelineType, m_Desc.ResourceLayout, nullptr, 0, nullptr);
@@ -263,8 +301,45 @@ void PipelineStateGLImpl::InitResourceLayouts(std::vector<ShaderGLImpl*>& Shader
     }
 }
 
+void PipelineStateGLImpl::FinishCompilation()
+{
+    if (m_Status != PIPELINE_STATE_STATUS_COMPILING)
+        return;
+
+    try
+    {
+        InitResourceLayouts();
+        m_Status = PIPELINE_STATE_STATUS_READY;
+    }
+    catch (...)
+    {
+        LOG_ERROR_MESSAGE("Failed to create pipeline state '", (m_Desc.Name != nullptr ? m_Desc.Name : ""), "'");
+        m_Status = PIPELINE_STATE_STATUS_FAILED;
+    }
+    m_PendingLinks.clear();
+    m_PendingShaders.clear();
+}
+
+PIPELINE_STATE_STATUS PipelineStateGLImpl::GetStatus(bool WaitForCompletion) const
+{
+    if (m_Status == PIPELINE_STATE_STATUS_COMPILING)
+    {
+        bool IsComplete = true;
+        for (size_t i = 0; i < m_PendingLinks.size() && IsComplete && !WaitForCompletion; ++i)
+            IsComplete = ShaderGLImpl::IsLinkComplete(m_PendingLinks[i]);
+
+        // Completing the compilation only queries the driver and initializes the resource layouts
+        // that are not accessible until then, so it is allowed for a const object.
+        if (WaitForCompletion || IsComplete)
+            const_cast<PipelineStateGLImpl*>(this)->FinishCompilation();
+    }
+    return m_Status;
+}
+
 void PipelineStateGLImpl::CreateShaderResourceBinding(IShaderResourceBinding** ppShaderResourceBinding, bool InitStaticResources)
 {
+    GetStatus(true);
+
     auto* pRenderDeviceGL = GetDevice();
     auto& SRBAllocator    = pRenderDeviceGL->GetSRBAllocator();
     auto  pResBinding     = NEW_RC_OBJ(SRBAllocator, "ShaderResourceBindingGLImpl instance", ShaderResourceBindingGLImpl)(this, m_ProgramResources, GetNumShaderStages());
@@ -281,6 +356,8 @@ bool PipelineStateGLImpl::IsCompatibleWith(const IPipelineState* pPSO) const
         return true;
 
     const PipelineStateGLImpl* pPSOGL = ValidatedCast<const PipelineStateGLImpl>(pPSO);
+    GetStatus(true);
+    pPSOGL->GetStatus(true);
     if (m_ShaderResourceLayoutHash != pPSOGL->m_ShaderResourceLayoutHash)
         return false;
 
@@ -298,6 +375,9 @@ bool PipelineStateGLImpl::IsCompatibleWith(const IPipelineState* pPSO) const
 
 void PipelineStateGLImpl::CommitProgram(GLContextState& State)
 {
+    // Pipelines that failed to compile are rejected by DeviceContextGLImpl::SetPipelineState()
+    VERIFY(m_Status == PIPELINE_STATE_STATUS_READY, "Pipeline state '", (m_Desc.Name != nullptr ? m_Desc.Name : ""), "' is not ready");
+
     auto ProgramPipelineSupported = m_pDevice->GetDeviceCaps().Features.SeparablePrograms;
 
     if (ProgramPipelineSupported)
@@ -344,6 +424,7 @@ GLObjectWrappers::GLPipelineObj& PipelineStateGLImpl::GetGLProgramPipeline(GLCon
 
 void PipelineStateGLImpl::InitializeSRBResourceCache(GLProgramResourceCache& ResourceCache) const
 {
+    GetStatus(true);
     ResourceCache.Initialize(m_TotalUniformBufferBindings, m_TotalSamplerBindings, m_TotalImageBindings, m_TotalStorageBufferBindings, GetRawAllocator());
     InitImmutableSamplersInResourceCache(m_ResourceLayout, ResourceCache);
 }
@@ -364,11 +445,14 @@ void PipelineStateGLImpl::InitImmutableSamplersInResourceCache(const GLPipelineR
 
 void PipelineStateGLImpl::BindStaticResources(Uint32 ShaderFlags, IResourceMapping* pResourceMapping, Uint32 Flags)
 {
+    GetStatus(true);
     m_StaticResourceLayout.BindResources(static_cast<SHADER_TYPE>(ShaderFlags), pResourceMapping, Flags, m_StaticResourceCache);
 }
 
 Uint32 PipelineStateGLImpl::GetStaticVariableCount(SHADER_TYPE ShaderType) const
 {
+    GetStatus(true);
+
     if (!IsConsistentShaderType(ShaderType, m_Desc.PipelineType))
     {
         LOG_WARNING_MESSAGE("Unable to get the number of static variables in shader stage ", GetShaderTypeLiteralName(ShaderType),
@@ -381,6 +465,8 @@ Uint32 PipelineStateGLImpl::GetStaticVariableCount(SHADER_TYPE ShaderType) const
 
 IShaderResourceVariable* PipelineStateGLImpl::GetStaticVariableByName(SHADER_TYPE ShaderType, const Char* Name)
 {
+    GetStatus(true);
+
     if (!IsConsistentShaderType(ShaderType, m_Desc.PipelineType))
     {
         LOG_WARNING_MESSAGE("Unable to find static variable '", Name, "' in shader stage ", GetShaderTypeLiteralName(ShaderType),
@@ -393,6 +479,8 @@ IShaderResourceVariable* PipelineStateGLImpl::GetStaticVariableByName(SHADER_TYP
 
 IShaderResourceVariable* PipelineStateGLImpl::GetStaticVariableByIndex(SHADER_TYPE ShaderType, Uint32 Index)
 {
+    GetStatus(true);
+
     if (!IsConsistentShaderType(ShaderType, m_Desc.PipelineType))
     {
         LOG_WARNING_MESSAGE("Unable to get static variable at index ", Index, " in shader stage ", GetShaderTypeLiteralName(ShaderType),
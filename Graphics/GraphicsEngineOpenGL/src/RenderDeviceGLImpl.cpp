@@ -135,6 +135,7 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
         pRefCounters,
         RawMemAllocator,
         pEngineFactory,
+        InitAttribs,
         0,
         DeviceObjectSizes
         {
@@ -469,6 +470,63 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
 #if defined(_MSC_VER) && defined(_WIN64)
     static_assert(sizeof(DeviceFeatures) == 32, "Did you add a new feature to DeviceFeatures? Please handle its satus here.");
 #endif
+
+#if GL_ARB_buffer_storage
+    if (InitAttribs.DynamicHeapSize != 0)
+    {
+        const bool IsGL44OrAbove          = (MajorVersion >= 5) || (MajorVersion == 4 && MinorVersion >= 4);
+        const bool BufferStorageSupported = m_DeviceCaps.DevType == RENDER_DEVICE_TYPE_GL &&
+            (IsGL44OrAbove || CheckExtension("GL_ARB_buffer_storage")) && glBufferStorage != nullptr;
+        if (BufferStorageSupported)
+        {
+            GLint UBOffsetAlignment = 0;
+            glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &UBOffsetAlignment);
+            CHECK_GL_ERROR("Failed to get uniform buffer offset alignment");
+            m_pDynamicHeap.reset(new GLDynamicHeap{RawMemAllocator, InitAttribs.DynamicHeapSize, static_cast<Uint32>(UBOffsetAlignment)});
+        }
+        else
+        {
+            LOG_INFO_MESSAGE("Buffer storage is not supported by this device. Dynamic buffers will be updated with glMapBufferRange().");
+        }
+    }
+#endif
+
+#if GL_KHR_parallel_shader_compile
+    // GL_KHR_parallel_shader_compile is available on both desktop GL and GLES.
+    // Desktop GL may only expose the ARB extension with identical functionality and enum values.
+    if (CheckExtension("GL_KHR_parallel_shader_compile") && glMaxShaderCompilerThreadsKHR != nullptr)
+    {
+        glMaxShaderCompilerThreadsKHR(InitAttribs.MaxShaderCompilerThreads);
+        m_ParallelShaderCompileSupported = true;
+    }
+#    if GL_ARB_parallel_shader_compile
+    else if (CheckExtension("GL_ARB_parallel_shader_compile") && glMaxShaderCompilerThreadsARB != nullptr)
+    {
+        glMaxShaderCompilerThreadsARB(InitAttribs.MaxShaderCompilerThreads);
+        m_ParallelShaderCompileSupported = true;
+    }
+#    endif
+    CHECK_GL_ERROR("Failed to set the maximum number of shader compiler threads");
+#endif
+
+    if (InitAttribs.ProgramBinaryCacheDirectory != nullptr)
+    {
+        if (GLProgramBinaryCache::IsSupported())
+        {
+            try
+            {
+                m_pProgramBinaryCache.reset(new GLProgramBinaryCache{InitAttribs.ProgramBinaryCacheDirectory, GLProgramBinaryCache::GetDriverId()});
+            }
+            catch (...)
+            {
+                LOG_WARNING_MESSAGE("Failed to open program binary cache in '", InitAttribs.ProgramBinaryCacheDirectory, "'. Programs will not be cached.");
+            }
+        }
+        else
+        {
+            LOG_INFO_MESSAGE("Program binaries are not supported by this device. Programs will not be cached.");
+        }
+    }
 }
 
 RenderDeviceGLImpl::~RenderDeviceGLImpl()
@@ -661,6 +719,20 @@ void RenderDeviceGLImpl::CreateTextureFromGLHandle(Uint32             GLHandle,
     );
 }
 
+void RenderDeviceGLImpl::GetProgramBinaryCacheStatistics(ProgramBinaryCacheStatistics& Stats)
+{
+    Stats = ProgramBinaryCacheStatistics{};
+    if (!m_pProgramBinaryCache)
+        return;
+
+    const auto CacheStats = m_pProgramBinaryCache->GetStatistics();
+    Stats.NumHits         = CacheStats.NumHits;
+    Stats.NumMisses       = CacheStats.NumMisses;
+    Stats.NumRejected     = CacheStats.NumRejected;
+    Stats.NumStored       = CacheStats.NumStored;
+    Stats.StoredDataSize  = CacheStats.StoredDataSize;
+}
+
 void RenderDeviceGLImpl::CreateDummyTexture(const TextureDesc& TexDesc, RESOURCE_STATE InitialState, ITexture** ppTexture)
 {
     CreateDeviceObject(
@@ -714,9 +786,17 @@ void RenderDeviceGLImpl::CreatePipelineState(const PSOCreateInfoType& PSOCreateI
         "Pipeline state", PSOCreateInfo.PSODesc, ppPipelineState,
         [&]() //
         {
-            PipelineStateGLImpl* pPipelineStateOGL(NEW_RC_OBJ(m_PSOAllocator, "PipelineStateGLImpl instance", PipelineStateGLImpl)(this, PSOCreateInfo, bIsDeviceInternal));
-            pPipelineStateOGL->QueryInterface(IID_PipelineState, reinterpret_cast<IObject**>(ppPipelineState));
-            OnCreateDeviceObject(pPipelineStateOGL);
+            auto ConstructPSO = [&]() //
+            {
+                PipelineStateGLImpl* pPipelineStateOGL(NEW_RC_OBJ(m_PSOAllocator, "PipelineStateGLImpl instance", PipelineStateGLImpl)(this, PSOCreateInfo, bIsDeviceInternal));
+                pPipelineStateOGL->QueryInterface(IID_PipelineState, reinterpret_cast<IObject**>(ppPipelineState));
+                OnCreateDeviceObject(pPipelineStateOGL);
+            };
+            // Internal pipeline states are never shared with the application
+            if (bIsDeviceInternal)
+                ConstructPSO();
+            else
+                FindOrCreatePipelineState<ShaderGLImpl>(PSOCreateInfo, ppPipelineState, ConstructPSO);
         } //
     );
 }
@@ -105,19 +105,99 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
 
     // Provide source strings (the strings will be saved in internal OpenGL memory)
     glShaderSource(m_GLShaderObj, static_cast<GLsizei>(ShaderStrings.size()), ShaderStrings.data(), Lenghts.data());
+
+    InitContent(ShaderCI, ShaderStrings[0], static_cast<size_t>(Lenghts[0]));
+
+    auto* const pBinaryCache = pDeviceGL->GetProgramBinaryCache();
+    if (pBinaryCache != nullptr)
+    {
+        GLProgramBinaryCache::KeyBuilder SourceKey;
+        SourceKey.Add(GetGLShaderType(m_Desc.ShaderType));
+        for (size_t i = 0; i < ShaderStrings.size(); ++i)
+            SourceKey.Add(ShaderStrings[i], static_cast<size_t>(Lenghts[i]));
+        m_SourceKey = SourceKey.Get();
+    }
+
+    if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) != 0)
+    {
+        DEV_CHECK_ERR(ShaderCI.ppCompilerOutput == nullptr || *ShaderCI.ppCompilerOutput == nullptr,
+                      "Compiler output is not available for shaders that are compiled asynchronously");
+
+        // Only submit the work to the driver. The status is not queried until the shader is
+        // used or GetStatus() is called, so that the driver can compile multiple shaders in parallel.
+        if (deviceCaps.Features.SeparablePrograms)
+        {
+            ShaderGLImpl* ThisShader[] = {this};
+            BeginLinkProgram(ThisShader, 1, true, m_PendingLink);
+        }
+        else
+        {
+            SubmitCompile();
+        }
+        m_Status = SHADER_STATUS_COMPILING;
+        return;
+    }
+
+    // When the program binary cache is used with separable programs, compilation is deferred until
+    // the program is linked, so that it is skipped entirely if the program binary is found in the cache.
+    if (pBinaryCache == nullptr || !deviceCaps.Features.SeparablePrograms)
+        CheckCompileStatus(ShaderCI.ppCompilerOutput);
+
+    if (deviceCaps.Features.SeparablePrograms)
+    {
+        ShaderGLImpl* ThisShader[] = {this};
+        LoadUniforms(LinkProgram(ThisShader, 1, true, ShaderCI.ppCompilerOutput));
+    }
+    m_Status = SHADER_STATUS_READY;
+}
+
+void ShaderGLImpl::LoadUniforms(const GLObjectWrappers::GLProgramObj& Program)
+{
+    Uint32 UniformBufferBinding = 0;
+    Uint32 SamplerBinding       = 0;
+    Uint32 ImageBinding         = 0;
+    Uint32 StorageBufferBinding = 0;
+    auto   pImmediateCtx        = m_pDevice->GetImmediateContext();
+    VERIFY_EXPR(pImmediateCtx);
+    auto& GLState = pImmediateCtx.RawPtr<DeviceContextGLImpl>()->GetContextState();
+    m_Resources.LoadUniforms(m_Desc.ShaderType, Program, GLState, UniformBufferBinding, SamplerBinding, ImageBinding, StorageBufferBinding);
+}
+
+void ShaderGLImpl::SubmitCompile()
+{
+    if (m_IsCompileSubmitted)
+        return;
+
     // When the shader is compiled, it will be compiled as if all of the given strings were concatenated end-to-end.
     glCompileShader(m_GLShaderObj);
+    m_IsCompileSubmitted = true;
+}
+
+void ShaderGLImpl::CheckCompileStatus(IDataBlob** ppCompilerOutput)
+{
+    if (m_IsCompiled)
+        return;
+
+    SubmitCompile();
+
     GLint compiled = GL_FALSE;
     // Get compilation status
     glGetShaderiv(m_GLShaderObj, GL_COMPILE_STATUS, &compiled);
     if (!compiled)
     {
+        // The source strings are saved in internal OpenGL memory, and are concatenated when queried
+        int SourceLen = 0;
+        glGetShaderiv(m_GLShaderObj, GL_SHADER_SOURCE_LENGTH, &SourceLen);
         std::string FullSource;
-        for (const auto* str : ShaderStrings)
-            FullSource.append(str);
+        if (SourceLen > 0)
+        {
+            FullSource.resize(SourceLen);
+            glGetShaderSource(m_GLShaderObj, SourceLen, &SourceLen, &FullSource[0]);
+            FullSource.resize(SourceLen);
+        }
 
         std::stringstream ErrorMsgSS;
-        ErrorMsgSS << "Failed to compile shader file '" << (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : "") << '\'' << std::endl;
+        ErrorMsgSS << "Failed to compile shader file '" << (m_Desc.Name != nullptr ? m_Desc.Name : "") << '\'' << std::endl;
         int infoLogLen = 0;
         // The function glGetShaderiv() tells how many bytes to allocate; the length includes the NULL terminator.
         glGetShaderiv(m_GLShaderObj, GL_INFO_LOG_LENGTH, &infoLogLen);
@@ -135,7 +215,7 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
                        << infoLog.data() << std::endl;
         }
 
-        if (ShaderCI.ppCompilerOutput != nullptr)
+        if (ppCompilerOutput != nullptr)
         {
             // infoLogLen accounts for null terminator
             auto* pOutputDataBlob = MakeNewRCObj<DataBlobImpl>()(infoLogLen + FullSource.length() + 1);
@@ -143,7 +223,7 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
             if (infoLogLen > 0)
                 memcpy(DataPtr, infoLog.data(), infoLogLen);
             memcpy(DataPtr + infoLogLen, FullSource.data(), FullSource.length() + 1);
-            pOutputDataBlob->QueryInterface(IID_DataBlob, reinterpret_cast<IObject**>(ShaderCI.ppCompilerOutput));
+            pOutputDataBlob->QueryInterface(IID_DataBlob, reinterpret_cast<IObject**>(ppCompilerOutput));
         }
         else
         {
@@ -156,21 +236,57 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
         LOG_ERROR_AND_THROW(ErrorMsgSS.str().c_str());
     }
 
-    if (deviceCaps.Features.SeparablePrograms)
+    m_IsCompiled = true;
+}
+
+bool ShaderGLImpl::IsCompileComplete() const
+{
+#if GL_KHR_parallel_shader_compile
+    if (m_IsCompileSubmitted && !m_IsCompiled && m_pDevice->IsParallelShaderCompileSupported())
+    {
+        GLint IsComplete = GL_FALSE;
+        glGetShaderiv(m_GLShaderObj, GL_COMPLETION_STATUS_KHR, &IsComplete);
+        return IsComplete != GL_FALSE;
+    }
+#endif
+    // Without GL_KHR_parallel_shader_compile, the only way to find out is to wait
+    return true;
+}
+
+void ShaderGLImpl::FinishCompilation()
+{
+    if (m_Status != SHADER_STATUS_COMPILING)
+        return;
+
+    try
     {
-        ShaderGLImpl*                  ThisShader[]         = {this};
-        GLObjectWrappers::GLProgramObj Program              = LinkProgram(ThisShader, 1, true);
-        Uint32                         UniformBufferBinding = 0;
-        Uint32                         SamplerBinding       = 0;
-        Uint32                         ImageBinding         = 0;
-        Uint32                         StorageBufferBinding = 0;
-        auto                           pImmediateCtx        = m_pDevice->GetImmediateContext();
-        VERIFY_EXPR(pImmediateCtx);
-        auto& GLState = pImmediateCtx.RawPtr<DeviceContextGLImpl>()->GetContextState();
-        m_Resources.LoadUniforms(m_Desc.ShaderType, Program, GLState, UniformBufferBinding, SamplerBinding, ImageBinding, StorageBufferBinding);
+        if (m_pDevice->GetDeviceCaps().Features.SeparablePrograms)
+            LoadUniforms(FinishLinkProgram(m_PendingLink));
+        else
+            CheckCompileStatus(nullptr);
+        m_Status = SHADER_STATUS_READY;
+    }
+    catch (...)
+    {
+        m_Status = SHADER_STATUS_FAILED;
     }
 }
 
+SHADER_STATUS ShaderGLImpl::GetStatus(bool WaitForCompletion) const
+{
+    if (m_Status == SHADER_STATUS_COMPILING)
+    {
+        const bool IsComplete = m_pDevice->GetDeviceCaps().Features.SeparablePrograms ?
+            IsLinkComplete(m_PendingLink) :
+            IsCompileComplete();
+        // Completing the compilation only queries the driver and does not change
+        // the observable state of the shader, so it is allowed for a const object.
+        if (WaitForCompletion || IsComplete)
+            const_cast<ShaderGLImpl*>(this)->FinishCompilation();
+    }
+    return m_Status;
+}
+
 ShaderGLImpl::~ShaderGLImpl()
 {
 }
@@ -178,9 +294,32 @@ ShaderGLImpl::~ShaderGLImpl()
 IMPLEMENT_QUERY_INTERFACE(ShaderGLImpl, IID_ShaderGL, TShaderBase)
 
 
-GLObjectWrappers::GLProgramObj ShaderGLImpl::LinkProgram(ShaderGLImpl** ppShaders, Uint32 NumShaders, bool IsSeparableProgram)
+void ShaderGLImpl::BeginLinkProgram(ShaderGLImpl** ppShaders, Uint32 NumShaders, bool IsSeparableProgram, ProgramLinkInfo& Link)
 {
     VERIFY(!IsSeparableProgram || NumShaders == 1, "Number of shaders must be 1 when separable program is created");
+    VERIFY_EXPR(NumShaders > 0);
+
+    Link = ProgramLinkInfo{};
+
+    auto* const pBinaryCache = ppShaders[0]->m_pDevice->GetProgramBinaryCache();
+    if (pBinaryCache != nullptr)
+    {
+        GLProgramBinaryCache::KeyBuilder KeyBuilder;
+        KeyBuilder.Add(IsSeparableProgram ? Uint32{1} : Uint32{0});
+        for (Uint32 i = 0; i < NumShaders; ++i)
+            KeyBuilder.Add(&ppShaders[i]->m_SourceKey, sizeof(ppShaders[i]->m_SourceKey));
+        Link.CacheKey = KeyBuilder.Get();
+
+        GLObjectWrappers::GLProgramObj CachedProg(true);
+        // Program parameters must be set before the binary is loaded
+        if (IsSeparableProgram)
+            glProgramParameteri(CachedProg, GL_PROGRAM_SEPARABLE, GL_TRUE);
+        if (pBinaryCache->Load(Link.CacheKey, CachedProg))
+        {
+            Link.Program = std::move(CachedProg);
+            return;
+        }
+    }
 
     GLObjectWrappers::GLProgramObj GLProg(true);
 
@@ -188,11 +327,20 @@ GLObjectWrappers::GLProgramObj ShaderGLImpl::LinkProgram(ShaderGLImpl** ppShader
     if (IsSeparableProgram)
         glProgramParameteri(GLProg, GL_PROGRAM_SEPARABLE, GL_TRUE);
 
+#ifdef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+    if (pBinaryCache != nullptr)
+        glProgramParameteri(GLProg, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
     for (Uint32 i = 0; i < NumShaders; ++i)
     {
         auto* pCurrShader = ppShaders[i];
+        // Compilation may have been deferred in anticipation of a program binary cache hit.
+        // The compile status is checked when the link is finished.
+        pCurrShader->SubmitCompile();
         glAttachShader(GLProg, pCurrShader->m_GLShaderObj);
         CHECK_GL_ERROR("glAttachShader() failed");
+        Link.Shaders.push_back(pCurrShader);
     }
 
     //With separable program objects, interfaces between shader stages may
@@ -207,6 +355,37 @@ GLObjectWrappers::GLProgramObj ShaderGLImpl::LinkProgram(ShaderGLImpl** ppShader
     //of the inputs on the interface will be undefined.
     glLinkProgram(GLProg);
     CHECK_GL_ERROR("glLinkProgram() failed");
+
+    Link.Program = std::move(GLProg);
+}
+
+bool ShaderGLImpl::IsLinkComplete(const ProgramLinkInfo& Link)
+{
+#if GL_KHR_parallel_shader_compile
+    if (!Link.Shaders.empty() && Link.Shaders[0]->m_pDevice->IsParallelShaderCompileSupported())
+    {
+        // Program completion status also covers compilation of the attached shaders
+        GLint IsComplete = GL_FALSE;
+        glGetProgramiv(Link.Program, GL_COMPLETION_STATUS_KHR, &IsComplete);
+        return IsComplete != GL_FALSE;
+    }
+#endif
+    // The program was loaded from the cache, or there is no way to find out without waiting
+    return true;
+}
+
+GLObjectWrappers::GLProgramObj ShaderGLImpl::FinishLinkProgram(ProgramLinkInfo& Link, IDataBlob** ppCompilerOutput) noexcept(false)
+{
+    // The program was loaded from the program binary cache
+    if (Link.Shaders.empty())
+        return std::move(Link.Program);
+
+    // Report compilation errors before the link error they cause
+    for (auto* pShader : Link.Shaders)
+        pShader->CheckCompileStatus(ppCompilerOutput);
+
+    auto& GLProg = Link.Program;
+
     int IsLinked = GL_FALSE;
     glGetProgramiv(GLProg, GL_LINK_STATUS, &IsLinked);
     CHECK_GL_ERROR("glGetProgramiv() failed");
@@ -223,24 +402,35 @@ GLObjectWrappers::GLProgramObj ShaderGLImpl::LinkProgram(ShaderGLImpl** ppShader
         // Notice that glGetProgramInfoLog  is used, not glGetShaderInfoLog.
         glGetProgramInfoLog(GLProg, LengthWithNull, &Length, shaderProgramInfoLog.data());
         VERIFY(Length == LengthWithNull - 1, "Incorrect program info log len");
-        LOG_ERROR_MESSAGE("Failed to link shader program:\n", shaderProgramInfoLog.data(), '\n');
-        UNEXPECTED("glLinkProgram failed");
+        LOG_ERROR_AND_THROW("Failed to link shader program:\n", shaderProgramInfoLog.data(), '\n');
     }
 
-    for (Uint32 i = 0; i < NumShaders; ++i)
+    for (auto* pShader : Link.Shaders)
     {
-        auto* pCurrShader = ValidatedCast<ShaderGLImpl>(ppShaders[i]);
-        glDetachShader(GLProg, pCurrShader->m_GLShaderObj);
+        glDetachShader(GLProg, pShader->m_GLShaderObj);
         CHECK_GL_ERROR("glDetachShader() failed");
     }
 
-    return GLProg;
+    auto* const pBinaryCache = Link.Shaders[0]->m_pDevice->GetProgramBinaryCache();
+    if (pBinaryCache != nullptr)
+        pBinaryCache->Store(Link.CacheKey, GLProg);
+
+    Link.Shaders.clear();
+    return std::move(GLProg);
+}
+
+GLObjectWrappers::GLProgramObj ShaderGLImpl::LinkProgram(ShaderGLImpl** ppShaders, Uint32 NumShaders, bool IsSeparableProgram, IDataBlob** ppCompilerOutput)
+{
+    ProgramLinkInfo Link;
+    BeginLinkProgram(ppShaders, NumShaders, IsSeparableProgram, Link);
+    return FinishLinkProgram(Link, ppCompilerOutput);
 }
 
 Uint32 ShaderGLImpl::GetResourceCount() const
 {
     if (m_pDevice->GetDeviceCaps().Features.SeparablePrograms)
     {
+        GetStatus(true);
         return m_Resources.GetVariableCount();
     }
     else
@@ -254,6 +444,7 @@ void ShaderGLImpl::GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDes
 {
     if (m_pDevice->GetDeviceCaps().Features.SeparablePrograms)
     {
+        GetStatus(true);
         DEV_CHECK_ERR(Index < GetResourceCount(), "Index is out of range");
         ResourceDesc = m_Resources.GetResourceDesc(Index);
     }
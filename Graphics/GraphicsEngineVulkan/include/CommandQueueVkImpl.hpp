@@ -32,6 +32,7 @@
 
 #include <mutex>
 #include <deque>
+#include <vector>
 #include "VulkanUtilities/VulkanHeaders.h"
 #include "CommandQueueVk.h"
 #include "ObjectBase.hpp"
@@ -49,7 +50,8 @@ public:
 
     CommandQueueVkImpl(IReferenceCounters*                                   pRefCounters,
                        std::shared_ptr<VulkanUtilities::VulkanLogicalDevice> LogicalDevice,
-                       uint32_t                                              QueueFamilyIndex);
+                       uint32_t                                              QueueFamilyIndex,
+                       uint32_t                                              QueueIndex = 0);
     ~CommandQueueVkImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_CommandQueueVk, TBase)
@@ -84,6 +86,10 @@ public:
     void SetFence(RefCntAutoPtr<FenceVkImpl> pFence) { m_pFence = std::move(pFence); }
 
 private:
+    // Submits the batch and signals the queue fence through its timeline semaphore.
+    // Must be called while m_QueueMutex is locked.
+    void SubmitWithTimelineSemaphore(const VkSubmitInfo& SubmitInfo, Uint64 FenceValue);
+
     std::shared_ptr<VulkanUtilities::VulkanLogicalDevice> m_LogicalDevice;
 
     const VkQueue  m_VkQueue;
@@ -98,6 +104,10 @@ private:
     Atomics::AtomicInt64 m_NextFenceValue;
 
     std::mutex m_QueueMutex;
+
+    // Scratch arrays used by SubmitWithTimelineSemaphore(), protected by m_QueueMutex
+    std::vector<VkSemaphore> m_SignalSemaphores;
+    std::vector<uint64_t>    m_SignalValues;
 };
 
 } // namespace Diligent
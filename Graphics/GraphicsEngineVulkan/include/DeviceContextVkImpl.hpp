@@ -154,6 +154,10 @@ public:
     virtual void DILIGENT_CALL_TYPE Draw               (const DrawAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndexed() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE DrawIndexed        (const DrawIndexedAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDraw() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw          (const MultiDrawAttribs& Attribs) override final;
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed   (const MultiDrawIndexedAttribs& Attribs) override final;
     /// Implementation of IDeviceContext::DrawIndirect() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE DrawIndirect       (const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer) override final;
     /// Implementation of IDeviceContext::DrawIndexedIndirect() in Vulkan backend.
@@ -243,6 +247,9 @@ public:
     /// Implementation of IDeviceContext::WaitForFence() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE WaitForFence(IFence* pFence, Uint64 Value, bool FlushContext) override final;
 
+    /// Implementation of IDeviceContext::DeviceWaitForFence() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE DeviceWaitForFence(IFence* pFence, Uint64 Value) override final;
+
     /// Implementation of IDeviceContext::WaitForIdle() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE WaitForIdle() override final;
 
@@ -362,6 +369,12 @@ public:
 
     size_t GetNumCommandsInCtx() const { return m_State.NumCommands; }
 
+    /// Implementation of IDeviceContextVk::GetBarrierStatistics().
+    virtual void DILIGENT_CALL_TYPE GetBarrierStatistics(PipelineBarrierStatistics& Stats) const override final;
+
+    /// Implementation of IDeviceContextVk::GetLastFrameUploadStatistics().
+    virtual void DILIGENT_CALL_TYPE GetLastFrameUploadStatistics(FrameUploadStatistics& Stats) const override final;
+
     __forceinline VulkanUtilities::VulkanCommandBuffer& GetCommandBuffer()
     {
         EnsureVkCmdBuffer();
@@ -462,10 +475,29 @@ private:
     __forceinline void          PrepareForDispatchCompute();
     __forceinline void          PrepareForRayTracing();
 
+    template <typename DrawItemType, typename DrawIndirectCmdType>
+    bool IssueMultiDrawIndirect(const DrawItemType* pDrawItems, Uint32 DrawCount, DrawIndirectCmdType DrawIndirectCmd);
+
     void DvpLogRenderPass_PSOMismatch();
 
+#ifdef DILIGENT_DEVELOPMENT
+    bool DvpVerifyCommandQueueCaps(VkQueueFlags RequiredFlags, const char* OpName) const;
+    void DvpVerifyImageTransferGranularity(const TextureDesc& TexDesc, Uint32 MipLevel, const VkOffset3D& Offset, const VkExtent3D& Extent, const char* OpName) const;
+    void DvpVerifyCommandQueueMask(Uint64 CommandQueueMask, const char* ResourceName, const char* OpName) const;
+#else
+    bool DvpVerifyCommandQueueCaps(VkQueueFlags RequiredFlags, const char* OpName) const { return true; }
+    void DvpVerifyImageTransferGranularity(const TextureDesc& TexDesc, Uint32 MipLevel, const VkOffset3D& Offset, const VkExtent3D& Extent, const char* OpName) const {}
+    void DvpVerifyCommandQueueMask(Uint64 CommandQueueMask, const char* ResourceName, const char* OpName) const {}
+#endif
+
     void CreateASCompactedSizeQueryPool();
 
+    void CreateMappedTexturesMap();
+    void DestroyMappedTexturesMap();
+
+    // Capabilities of the queue family the context submits commands to
+    const VkQueueFlags m_CommandQueueFlags;
+
     VulkanUtilities::VulkanCommandBuffer m_CommandBuffer;
 
     struct ContextState
@@ -501,7 +533,12 @@ private:
     // List of fences to signal next time the command context is flushed
     std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>> m_PendingFences;
 
-    std::unordered_map<BufferVkImpl*, VulkanUploadAllocation> m_UploadAllocations;
+    // List of timeline semaphore fences the GPU waits for next time the command context is flushed
+    std::vector<std::pair<Uint64, RefCntAutoPtr<IFence>>> m_PendingFenceWaits;
+
+    // Timeline semaphore values for every wait and signal semaphore of the submitted batch
+    std::vector<uint64_t> m_WaitSemaphoreValues;
+    std::vector<uint64_t> m_SignalSemaphoreValues;
 
     struct MappedTextureKey
     {
@@ -528,11 +565,20 @@ private:
         BufferToTextureCopyInfo CopyInfo;
         VulkanDynamicAllocation Allocation;
     };
-    std::unordered_map<MappedTextureKey, MappedTexture, MappedTextureKey::Hasher> m_MappedTextures;
+    // Mapped textures only live until the end of the frame, so the map itself as well as its nodes
+    // and buckets are allocated from the frame allocator. The map is destroyed before the allocator
+    // is discarded in EndFrame() and is created again afterwards (see FinishFrame()).
+    using MappedTexturesMap = std::unordered_map<MappedTextureKey,
+                                                 MappedTexture,
+                                                 MappedTextureKey::Hasher,
+                                                 std::equal_to<MappedTextureKey>,
+                                                 STDAllocatorDynamicLinear<std::pair<const MappedTextureKey, MappedTexture>>>;
+    MappedTexturesMap* m_pMappedTextures = nullptr;
 
     VulkanUtilities::VulkanCommandBufferPool m_CmdPool;
     VulkanUploadHeap                         m_UploadHeap;
     VulkanDynamicHeap                        m_DynamicHeap;
+    FrameUploadStatistics                    m_LastFrameUploadStats;
     DynamicDescriptorSetAllocator            m_DynamicDescrSetAllocator;
 
     PipelineLayout::DescriptorSetBindInfo m_DescrSetBindInfo;
@@ -542,6 +588,10 @@ private:
     // In Vulkan we can't bind null vertex buffer, so we have to create a dummy VB
     RefCntAutoPtr<BufferVkImpl> m_DummyVB;
 
+    // The maximum number of draws in a single indirect draw command, or 1
+    // if multiDrawIndirect or drawIndirectFirstInstance feature is not enabled.
+    Uint32 m_MaxDrawIndirectCount = 1;
+
     std::unique_ptr<QueryManagerVk> m_QueryMgr;
     Int32                           m_ActiveQueriesCounter = 0;
 
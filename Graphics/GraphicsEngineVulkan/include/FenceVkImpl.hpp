@@ -31,6 +31,7 @@
 /// Declaration of Diligent::FenceVkImpl class
 
 #include <deque>
+#include <atomic>
 #include "FenceVk.h"
 #include "FenceBase.hpp"
 #include "VulkanUtilities/VulkanFencePool.hpp"
@@ -56,7 +57,9 @@ public:
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_FenceVk, TFenceBase)
 
     /// Implementation of IFence::GetCompletedValue() in Vulkan backend.
-    /// Note that this method is not thread-safe. The reason is that VulkanFencePool is not thread
+    /// When the fence is backed by a timeline semaphore, the method simply queries the semaphore
+    /// counter and is thread-safe.
+    /// Otherwise, the method is not thread-safe. The reason is that VulkanFencePool is not thread
     /// safe, and DeviceContextVkImpl::SignalFence() adds the fence to the pending fences list that
     /// are signaled later by the command context when it submits the command list. So there is no
     /// guarantee that the fence pool is not accessed simultaneously by multiple threads even if the
@@ -64,6 +67,9 @@ public:
     virtual Uint64 DILIGENT_CALL_TYPE GetCompletedValue() override final;
 
     /// Implementation of IFence::Reset() in Vulkan backend.
+    /// For a timeline semaphore, the semaphore counter is signaled from the host only when
+    /// there are no pending GPU signal operations. Otherwise, the value only raises the
+    /// completed value reported to the application.
     virtual void DILIGENT_CALL_TYPE Reset(Uint64 Value) override final;
 
     VulkanUtilities::FenceWrapper GetVkFence() { return m_FencePool.GetFence(); }
@@ -73,12 +79,28 @@ public:
         m_PendingFences.emplace_back(FenceValue, std::move(vkFence));
     }
 
+    /// Returns true if the fence is backed by a timeline semaphore (VK_KHR_timeline_semaphore).
+    bool IsTimelineSemaphore() const { return m_TimelineSemaphore != VK_NULL_HANDLE; }
+
+    /// Returns the timeline semaphore, or VK_NULL_HANDLE if the fence uses binary Vulkan fences.
+    VkSemaphore GetVkSemaphore() const { return m_TimelineSemaphore; }
+
+    /// Registers the value that will be signaled by the queue submission that is being recorded.
+    /// Values must be strictly increasing.
+    void AddPendingTimelineSignal(Uint64 FenceValue);
+
     void Wait(Uint64 Value);
 
 private:
+    Uint64 GetTimelineSemaphoreValue() const;
+
     VulkanUtilities::VulkanFencePool                             m_FencePool;
     std::deque<std::pair<Uint64, VulkanUtilities::FenceWrapper>> m_PendingFences;
     volatile Uint64                                              m_LastCompletedFenceValue = 0;
+
+    VulkanUtilities::SemaphoreWrapper m_TimelineSemaphore;
+    // The largest value that was submitted to the GPU to be signaled on the timeline semaphore
+    std::atomic<Uint64> m_LastSignaledValue{0};
 };
 
 } // namespace Diligent
@@ -91,6 +91,18 @@ public:
         return m_LayoutMgr.GetDescriptorSet(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC).VkLayout;
     }
 
+    // Static and mutable resources share the same descriptor set
+    VkDescriptorSetLayout GetStaticMutableDescriptorSetVkLayout() const
+    {
+        return m_LayoutMgr.GetDescriptorSet(SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE).VkLayout;
+    }
+
+    // Returns -1 if there are no static or mutable resources in the layout
+    Int32 GetStaticMutableDescriptorSetIndex() const
+    {
+        return m_LayoutMgr.GetDescriptorSet(SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE).SetIndex;
+    }
+
     struct DescriptorSetBindInfo
     {
         std::vector<VkDescriptorSet> vkSets;
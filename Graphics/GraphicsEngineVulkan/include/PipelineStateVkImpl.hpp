@@ -115,6 +115,13 @@ public:
         return m_SRBMemAllocator;
     }
 
+    // Returns the template that writes all mutable descriptors of the static/mutable descriptor set,
+    // or VK_NULL_HANDLE if descriptor update templates are not supported
+    VkDescriptorUpdateTemplate GetVkDescriptorUpdateTemplate() const { return m_DescrUpdateTemplate; }
+
+    // Returns the number of descriptors written by the descriptor update template
+    Uint32 GetNumDescriptorUpdateTemplateDescriptors() const { return m_NumDescrUpdateTemplateDescriptors; }
+
     static RenderPassDesc GetImplicitRenderPassDesc(Uint32                                                        NumRenderTargets,
                                                     const TEXTURE_FORMAT                                          RTVFormats[],
                                                     TEXTURE_FORMAT                                                DSVFormat,
@@ -137,6 +144,8 @@ private:
     void InitResourceLayouts(const PipelineStateCreateInfo& CreateInfo,
                              TShaderStages&                 ShaderStages);
 
+    void CreateDescriptorUpdateTemplate(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice);
+
     void Destruct();
 
     const ShaderResourceLayoutVk& GetStaticShaderResLayout(Uint32 ShaderInd) const
@@ -166,6 +175,9 @@ private:
     VulkanUtilities::PipelineWrapper m_Pipeline;
     PipelineLayout                   m_PipelineLayout;
 
+    VulkanUtilities::DescriptorUpdateTemplateWrapper m_DescrUpdateTemplate;
+    Uint32                                           m_NumDescrUpdateTemplateDescriptors = 0;
+
     // Resource layout index in m_ShaderResourceLayouts array for every shader stage,
     // indexed by the shader type pipeline index (returned by GetShaderTypePipelineIndex)
     std::array<Int8, MAX_SHADERS_IN_PIPELINE> m_ResourceLayoutIndex = {-1, -1, -1, -1, -1, -1};
@@ -30,6 +30,9 @@
 /// \file
 /// Declaration of Diligent::RenderDeviceVkImpl class
 #include <memory>
+#include <mutex>
+#include <vector>
+#include <limits>
 
 #include "RenderDeviceVk.h"
 #include "RenderDeviceBase.hpp"
@@ -49,6 +52,8 @@
 #include "RenderPassCache.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
+#include "SPIRVCache.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -163,6 +168,15 @@ public:
                                                                  RESOURCE_STATE             InitialState,
                                                                  ITopLevelAS**              ppTLAS) override final;
 
+    /// Implementation of IRenderDeviceVk::GetVkPipelineCache().
+    virtual VkPipelineCache DILIGENT_CALL_TYPE GetVkPipelineCache() override final { return m_PipelineCache; }
+
+    /// Implementation of IRenderDeviceVk::GetPipelineCacheData().
+    virtual void DILIGENT_CALL_TYPE GetPipelineCacheData(IDataBlob** ppData) override final;
+
+    /// Implementation of IRenderDeviceVk::GetSPIRVCacheStatistics().
+    virtual void DILIGENT_CALL_TYPE GetSPIRVCacheStatistics(SPIRVCacheStatistics& Stats) override final;
+
     /// Implementation of IRenderDevice::IdleGPU() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE IdleGPU() override final;
 
@@ -205,10 +219,62 @@ public:
 
     VulkanDynamicMemoryManager& GetDynamicMemoryManager() { return m_DynamicMemoryManager; }
 
+    // Initializes the sharing mode of a buffer or an image that is used by the command queues
+    // in CommandQueueMask. Resources shared by queues from different families are created with
+    // VK_SHARING_MODE_CONCURRENT, so that no queue family ownership transfer is ever required.
+    // This only holds for the queues in the mask, which device contexts verify in development builds
+    // (see DeviceContextVkImpl::DvpVerifyCommandQueueMask()).
+    template <typename VkResourceCreateInfoType>
+    void InitSharingMode(VkResourceCreateInfoType& CreateInfo, Uint64 CommandQueueMask) const
+    {
+        CommandQueueMask &= GetCommandQueueMask();
+
+        bool     MultipleFamilies = false;
+        uint32_t QueueFamilyIndex = std::numeric_limits<uint32_t>::max();
+        while (CommandQueueMask != 0)
+        {
+            const auto QueueIndex = PlatformMisc::GetLSB(CommandQueueMask);
+            CommandQueueMask &= ~(Uint64{1} << Uint64{QueueIndex});
+
+            const auto FamilyIndex = GetCommandQueue(QueueIndex).GetQueueFamilyIndex();
+            if (QueueFamilyIndex != std::numeric_limits<uint32_t>::max() && QueueFamilyIndex != FamilyIndex)
+                MultipleFamilies = true;
+            QueueFamilyIndex = FamilyIndex;
+        }
+
+        if (MultipleFamilies)
+        {
+            // It is valid to list families that never access the resource
+            CreateInfo.sharingMode           = VK_SHARING_MODE_CONCURRENT;
+            CreateInfo.queueFamilyIndexCount = static_cast<uint32_t>(m_QueueFamilyIndices.size());
+            CreateInfo.pQueueFamilyIndices   = m_QueueFamilyIndices.data();
+        }
+        else
+        {
+            CreateInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+            CreateInfo.queueFamilyIndexCount = 0;
+            CreateInfo.pQueueFamilyIndices   = nullptr;
+        }
+    }
+
+    // Returns the total number of device contexts: the main immediate context, deferred contexts,
+    // and immediate contexts of additional command queues. Context ids are in range [0, N).
+    Uint32 GetNumDeviceContexts() const
+    {
+        return static_cast<Uint32>(GetNumDeferredContexts() + GetCommandQueueCount());
+    }
+
     void FlushStaleResources(Uint32 CmdQueueIndex);
 
     IDXCompiler* GetDxCompiler() const { return m_pDxCompiler.get(); }
 
+    // Returns the thread pool that compiles shaders created with SHADER_COMPILE_FLAG_ASYNCHRONOUS flag.
+    // The pool is created when the method is called for the first time.
+    ThreadingTools::ThreadPool& GetShaderCompilationThreadPool();
+
+    // Returns the SPIR-V compilation cache, or null if the cache is disabled.
+    SPIRVCache* GetSPIRVCache() const { return m_pSPIRVCache.get(); }
+
     struct Properties
     {
         const Uint32 ShaderGroupHandleSize;
@@ -230,6 +296,9 @@ private:
 
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
 
+    void InitPipelineCache(const EngineVkCreateInfo& EngineCI);
+    void SavePipelineCache();
+
     // Submits command buffer(s) for execution to the command queue and
     // returns the submitted command buffer(s) number and the fence value.
     // If SubmitInfo contains multiple command buffers, they all are treated
@@ -249,6 +318,9 @@ private:
 
     EngineVkCreateInfo m_EngineAttribs;
 
+    // Distinct queue families of all command queues
+    const std::vector<uint32_t> m_QueueFamilyIndices;
+
     FramebufferCache       m_FramebufferCache;
     RenderPassCache        m_ImplicitRenderPassCache;
     DescriptorSetAllocator m_DescriptorSetAllocator;
@@ -263,8 +335,18 @@ private:
 
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
+    // Pipeline cache shared by all pipeline states created by the device
+    VulkanUtilities::PipelineCacheWrapper m_PipelineCache;
+    // If not empty, the pipeline cache is saved to this file when the device is destroyed
+    String m_PipelineCacheFilePath;
+
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
 
+    std::unique_ptr<SPIRVCache> m_pSPIRVCache;
+
+    std::once_flag                              m_ShaderCompilationThreadPoolInitFlag;
+    std::unique_ptr<ThreadingTools::ThreadPool> m_pShaderCompilationThreadPool;
+
     Properties m_Properties;
 };
 
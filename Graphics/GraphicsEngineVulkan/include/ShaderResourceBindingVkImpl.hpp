@@ -71,6 +71,9 @@ public:
     /// Implementation of IShaderResourceBinding::InitializeStaticResources() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE InitializeStaticResources(const IPipelineState* pPipelineState) override final;
 
+    /// Implementation of IShaderResourceBinding::SetVariables() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetVariables(Uint32 NumVariables, const ShaderResourceVariableBinding* pVariables) override final;
+
     ShaderResourceCacheVk& GetResourceCache() { return m_ShaderResourceCache; }
 
     bool StaticResourcesInitialized() const { return m_bStaticResourcesInitialized; }
@@ -89,6 +89,7 @@
 #include <array>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "PipelineState.h"
 #include "ShaderBase.hpp"
@@ -251,8 +252,9 @@ public:
         // Checks if a resource is bound in ResourceCache at the given ArrayIndex
         bool IsBound(Uint32 ArrayIndex, const ShaderResourceCacheVk& ResourceCache) const;
 
-        // Binds a resource pObject in the ResourceCache
-        void BindResource(IDeviceObject* pObject, Uint32 ArrayIndex, ShaderResourceCacheVk& ResourceCache) const;
+        // Binds a resource pObject in the ResourceCache. If WriteDescriptor is false, the descriptor
+        // is only cached and must later be written by ShaderResourceLayoutVk::WriteNewlyBoundDescriptors()
+        void BindResource(IDeviceObject* pObject, Uint32 ArrayIndex, ShaderResourceCacheVk& ResourceCache, bool WriteDescriptor = true) const;
 
         // Updates resource descriptor in the descriptor set
         inline void UpdateDescriptorHandle(VkDescriptorSet                                     vkDescrSet,
@@ -387,6 +389,31 @@ public:
     void CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
                                 VkDescriptorSet              vkDynamicDescriptorSet) const;
 
+    // Descriptor data consumed by vkUpdateDescriptorSetWithTemplate. The data of every descriptor
+    // in the static/mutable set is located at the descriptor's offset in the resource cache.
+    union DescriptorUpdateTemplateData
+    {
+        VkDescriptorImageInfo      ImageInfo;
+        VkDescriptorBufferInfo     BufferInfo;
+        VkBufferView               BufferView;
+        VkAccelerationStructureKHR AccelStruct;
+    };
+
+    // Appends descriptor update template entries for all mutable resources that can be
+    // bound by the application and returns the total number of descriptors they cover
+    Uint32 GetDescriptorUpdateTemplateEntries(std::vector<VkDescriptorUpdateTemplateEntry>& Entries) const;
+
+    // For every static and mutable descriptor flagged in IsNewlyBound (indexed by the offset in the cache),
+    // writes the descriptor data from ResourceCache to pData at the same offset. If pWrites is not null,
+    // also appends a write of this descriptor to vkDescrSet; pAccelStructInfo must then provide
+    // one structure per descriptor in the set.
+    void WriteNewlyBoundDescriptors(const ShaderResourceCacheVk&                  ResourceCache,
+                                    const std::vector<bool>&                      IsNewlyBound,
+                                    VkDescriptorSet                               vkDescrSet,
+                                    DescriptorUpdateTemplateData*                 pData,
+                                    VkWriteDescriptorSetAccelerationStructureKHR* pAccelStructInfo,
+                                    std::vector<VkWriteDescriptorSet>*            pWrites) const;
+
     const Char* GetShaderName() const
     {
         return GetStringPoolData();
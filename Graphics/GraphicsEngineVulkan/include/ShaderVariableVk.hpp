@@ -63,13 +63,14 @@
 
 #include "ShaderResourceLayoutVk.hpp"
 #include "ShaderResourceVariableBase.hpp"
+#include "ShaderVariableNameIndex.hpp"
 
 namespace Diligent
 {
 
 class ShaderVariableVkImpl;
 
-// sizeof(ShaderVariableManagerVk) == 32 (x64, msvc, Release)
+// sizeof(ShaderVariableManagerVk) == 48 (x64, msvc, Release)
 class ShaderVariableManagerVk
 {
 public:
@@ -118,6 +119,9 @@ private:
     ShaderVariableVkImpl* m_pVariables   = nullptr;
     Uint32                m_NumVariables = 0;
 
+    // Name index that is allocated in the same memory block after the variables
+    ShaderVariableNameIndex m_NameIndex;
+
 #ifdef DILIGENT_DEBUG
     IMemoryAllocator* m_pDbgAllocator = nullptr;
 #endif
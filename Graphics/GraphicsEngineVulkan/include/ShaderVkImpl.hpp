@@ -30,6 +30,9 @@
 /// \file
 /// Declaration of Diligent::ShaderVkImpl class
 
+#include <atomic>
+#include <future>
+
 #include "RenderDeviceVk.h"
 #include "ShaderVk.h"
 #include "ShaderBase.hpp"
@@ -56,7 +59,8 @@ public:
     /// Implementation of IShader::GetResourceCount() in Vulkan backend.
     virtual Uint32 DILIGENT_CALL_TYPE GetResourceCount() const override final
     {
-        return m_pShaderResources->GetTotalResources();
+        WaitForCompletion();
+        return m_pShaderResources ? m_pShaderResources->GetTotalResources() : 0;
     }
 
     /// Implementation of IShader::GetResource() in Vulkan backend.
@@ -65,22 +69,73 @@ public:
     /// Implementation of IShaderVk::GetSPIRV().
     virtual const std::vector<uint32_t>& DILIGENT_CALL_TYPE GetSPIRV() const override final
     {
+        WaitForCompletion();
         return m_SPIRV;
     }
 
-    const std::shared_ptr<const SPIRVShaderResources>& GetShaderResources() const { return m_pShaderResources; }
+    /// Implementation of IShader::GetStatus() in Vulkan backend.
+    virtual SHADER_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) const override final;
+
+    const std::shared_ptr<const SPIRVShaderResources>& GetShaderResources() const
+    {
+        WaitForCompletion();
+        return m_pShaderResources;
+    }
+
+    const char* GetEntryPoint() const
+    {
+        WaitForCompletion();
+        return m_EntryPoint.c_str();
+    }
+
+    size_t GetContentHash() const
+    {
+        WaitForCompletion();
+        return TShaderBase::GetContentHash();
+    }
+
+    bool IsContentEqual(const ShaderVkImpl& Shader) const
+    {
+        WaitForCompletion();
+        Shader.WaitForCompletion();
+        return TShaderBase::IsContentEqual(Shader);
+    }
 
-    const char* GetEntryPoint() const { return m_EntryPoint.c_str(); }
+    /// Returns the error message if the asynchronous compilation failed.
+    const std::string& GetCompilationError() const
+    {
+        WaitForCompletion();
+        return m_CompilationError;
+    }
 
 private:
+    void CompileShader(const ShaderCreateInfo& ShaderCI) noexcept(false);
     void MapHLSLVertexShaderInputs();
 
+    void WaitForCompletion() const
+    {
+        if (m_CompileTask.valid())
+            m_CompileTask.wait();
+    }
+
     // SPIRVShaderResources class instance must be referenced through the shared pointer, because
     // it is referenced by ShaderResourceLayoutVk class instances
     std::shared_ptr<const SPIRVShaderResources> m_pShaderResources;
 
     std::string           m_EntryPoint;
     std::vector<uint32_t> m_SPIRV;
+
+    // Error message of the failed asynchronous compilation
+    std::string m_CompilationError;
+
+    std::atomic<SHADER_STATUS> m_Status{SHADER_STATUS_UNINITIALIZED};
+
+    mutable std::atomic<bool> m_CompilationErrorReported{false};
+
+    // Asynchronous compilation task. All members above must not be accessed
+    // until the task is complete. The task may be waited on by multiple threads,
+    // e.g. when several pipelines that use the shader are created in parallel.
+    std::shared_future<void> m_CompileTask;
 };
 
 } // namespace Diligent
@@ -112,6 +112,12 @@ public:
         return m_Pages.size();
     }
 
+    // Returns the total size of all allocations made in the current frame
+    VkDeviceSize GetCurrFrameSize() const
+    {
+        return m_CurrFrameSize;
+    }
+
 private:
     RenderDeviceVkImpl& m_RenderDevice;
     std::string         m_HeapName;
@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "VulkanHeaders.h"
 #include "DebugUtilities.hpp"
 
@@ -36,9 +38,10 @@ namespace VulkanUtilities
 class VulkanCommandBuffer
 {
 public:
-    VulkanCommandBuffer(VkPipelineStageFlags EnabledShaderStages) noexcept :
-        m_EnabledShaderStages{EnabledShaderStages}
-    {}
+    // QueueFlags are the capabilities of the queue family the command buffers are submitted to.
+    // Pipeline stages and access types that the queue does not support are removed from the barriers.
+    VulkanCommandBuffer(VkPipelineStageFlags EnabledShaderStages,
+                        VkQueueFlags         QueueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT) noexcept;
 
     // clang-format off
     VulkanCommandBuffer             (const VulkanCommandBuffer&)  = delete;
@@ -55,6 +58,7 @@ public:
         VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "vkCmdClearColorImage() must be called outside of render pass (17.1)");
         VERIFY(Subresource.aspectMask == VK_IMAGE_ASPECT_COLOR_BIT, "The aspectMask of all image subresource ranges must only include VK_IMAGE_ASPECT_COLOR_BIT (17.1)");
 
+        FlushBarriers();
         vkCmdClearColorImage(
             m_VkCmdBuffer,
             Image,
@@ -76,6 +80,7 @@ public:
                "The aspectMask of all image subresource ranges must only include VK_IMAGE_ASPECT_DEPTH_BIT or VK_IMAGE_ASPECT_STENCIL_BIT(17.1)");
         // clang-format on
 
+        FlushBarriers();
         vkCmdClearDepthStencilImage(
             m_VkCmdBuffer,
             Image,
@@ -170,6 +175,7 @@ public:
         VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "vkCmdDispatch() must be called outside of render pass (27)");
         VERIFY(m_State.ComputePipeline != VK_NULL_HANDLE, "No compute pipeline bound");
 
+        FlushBarriers();
         vkCmdDispatch(m_VkCmdBuffer, GroupCountX, GroupCountY, GroupCountZ);
     }
 
@@ -179,6 +185,7 @@ public:
         VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "vkCmdDispatchIndirect() must be called outside of render pass (27)");
         VERIFY(m_State.ComputePipeline != VK_NULL_HANDLE, "No compute pipeline bound");
 
+        FlushBarriers();
         vkCmdDispatchIndirect(m_VkCmdBuffer, Buffer, Offset);
     }
 
@@ -192,6 +199,7 @@ public:
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "Current pass has not been ended");
 
+        FlushBarriers();
         if (m_State.RenderPass != RenderPass || m_State.Framebuffer != Framebuffer)
         {
             VkRenderPassBeginInfo BeginInfo;
@@ -249,11 +257,19 @@ public:
     __forceinline void EndCommandBuffer()
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        FlushBarriers();
         vkEndCommandBuffer(m_VkCmdBuffer);
     }
 
     __forceinline void Reset()
     {
+        m_PendingBufferCopies.clear();
+        m_PendingImageBarriers.clear();
+        m_PendingBufferBarriers.clear();
+        m_PendingMemoryBarriers.clear();
+        m_PendingSrcStages = 0;
+        m_PendingDstStages = 0;
+
         m_VkCmdBuffer = VK_NULL_HANDLE;
         m_State       = StateCache{};
     }
@@ -346,22 +362,15 @@ public:
                                       VkPipelineStageFlags           SrcStages  = 0,
                                       VkPipelineStageFlags           DestStages = 0);
 
-    __forceinline void TransitionImageLayout(VkImage                        Image,
-                                             VkImageLayout                  OldLayout,
-                                             VkImageLayout                  NewLayout,
-                                             const VkImageSubresourceRange& SubresRange,
-                                             VkPipelineStageFlags           SrcStages  = 0,
-                                             VkPipelineStageFlags           DestStages = 0)
-    {
-        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
-        {
-            // Image layout transitions within a render pass execute
-            // dependencies between attachments
-            EndRenderPass();
-        }
-        TransitionImageLayout(m_VkCmdBuffer, Image, OldLayout, NewLayout, SubresRange, m_EnabledShaderStages, SrcStages, DestStages);
-    }
+    // Image, buffer and acceleration structure barriers recorded by the instance methods below are not
+    // submitted immediately. They are accumulated and issued as a single vkCmdPipelineBarrier
+    // when FlushBarriers() is called or before the next command that may depend on them.
+    void TransitionImageLayout(VkImage                        Image,
+                               VkImageLayout                  OldLayout,
+                               VkImageLayout                  NewLayout,
+                               const VkImageSubresourceRange& SubresRange,
+                               VkPipelineStageFlags           SrcStages  = 0,
+                               VkPipelineStageFlags           DestStages = 0);
 
 
     static void BufferMemoryBarrier(VkCommandBuffer      CmdBuffer,
@@ -372,21 +381,11 @@ public:
                                     VkPipelineStageFlags SrcStages  = 0,
                                     VkPipelineStageFlags DestStages = 0);
 
-    __forceinline void BufferMemoryBarrier(VkBuffer             Buffer,
-                                           VkAccessFlags        srcAccessMask,
-                                           VkAccessFlags        dstAccessMask,
-                                           VkPipelineStageFlags SrcStages  = 0,
-                                           VkPipelineStageFlags DestStages = 0)
-    {
-        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
-        {
-            // Image layout transitions within a render pass execute
-            // dependencies between attachments
-            EndRenderPass();
-        }
-        BufferMemoryBarrier(m_VkCmdBuffer, Buffer, srcAccessMask, dstAccessMask, m_EnabledShaderStages, SrcStages, DestStages);
-    }
+    void BufferMemoryBarrier(VkBuffer             Buffer,
+                             VkAccessFlags        srcAccessMask,
+                             VkAccessFlags        dstAccessMask,
+                             VkPipelineStageFlags SrcStages  = 0,
+                             VkPipelineStageFlags DestStages = 0);
 
 
     // for Acceleration structures
@@ -397,20 +396,10 @@ public:
                                 VkPipelineStageFlags SrcStages  = 0,
                                 VkPipelineStageFlags DestStages = 0);
 
-    __forceinline void ASMemoryBarrier(VkAccessFlags        srcAccessMask,
-                                       VkAccessFlags        dstAccessMask,
-                                       VkPipelineStageFlags SrcStages  = 0,
-                                       VkPipelineStageFlags DestStages = 0)
-    {
-        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
-        {
-            // Image layout transitions within a render pass execute
-            // dependencies between attachments
-            EndRenderPass();
-        }
-        ASMemoryBarrier(m_VkCmdBuffer, srcAccessMask, dstAccessMask, m_EnabledShaderStages, SrcStages, DestStages);
-    }
+    void ASMemoryBarrier(VkAccessFlags        srcAccessMask,
+                         VkAccessFlags        dstAccessMask,
+                         VkPipelineStageFlags SrcStages  = 0,
+                         VkPipelineStageFlags DestStages = 0);
 
     __forceinline void BindDescriptorSets(VkPipelineBindPoint    pipelineBindPoint,
                                           VkPipelineLayout       layout,
@@ -424,19 +413,13 @@ public:
         vkCmdBindDescriptorSets(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 
-    __forceinline void CopyBuffer(VkBuffer            srcBuffer,
-                                  VkBuffer            dstBuffer,
-                                  uint32_t            regionCount,
-                                  const VkBufferCopy* pRegions)
-    {
-        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
-        {
-            // Copy buffer operation must be performed outside of render pass.
-            EndRenderPass();
-        }
-        vkCmdCopyBuffer(m_VkCmdBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
-    }
+    // Buffer copies are not recorded immediately either. They are accumulated, and all regions
+    // that have the same source and destination buffers are issued as a single vkCmdCopyBuffer
+    // when FlushBarriers() is called or before the next command that may depend on them.
+    void CopyBuffer(VkBuffer            srcBuffer,
+                    VkBuffer            dstBuffer,
+                    uint32_t            regionCount,
+                    const VkBufferCopy* pRegions);
 
     __forceinline void CopyImage(VkImage            srcImage,
                                  VkImageLayout      srcImageLayout,
@@ -452,6 +435,7 @@ public:
             EndRenderPass();
         }
 
+        FlushBarriers();
         vkCmdCopyImage(m_VkCmdBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 
@@ -468,6 +452,7 @@ public:
             EndRenderPass();
         }
 
+        FlushBarriers();
         vkCmdCopyBufferToImage(m_VkCmdBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
 
@@ -484,6 +469,7 @@ public:
             EndRenderPass();
         }
 
+        FlushBarriers();
         vkCmdCopyImageToBuffer(m_VkCmdBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
 
@@ -502,6 +488,7 @@ public:
             EndRenderPass();
         }
 
+        FlushBarriers();
         vkCmdBlitImage(m_VkCmdBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
 
@@ -518,6 +505,7 @@ public:
             // Resolve must be performed outside of render pass.
             EndRenderPass();
         }
+        FlushBarriers();
         vkCmdResolveImage(m_VkCmdBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 
@@ -541,6 +529,7 @@ public:
         // begin and end outside of a render pass instance (i.e. contain entire render pass instances) (17.2).
 
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        FlushBarriers();
         vkCmdBeginQuery(m_VkCmdBuffer, queryPool, query, flags);
         if (m_State.RenderPass != VK_NULL_HANDLE)
             m_State.InsidePassQueries |= queryFlag;
@@ -553,6 +542,7 @@ public:
                                 uint32_t    queryFlag)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        FlushBarriers();
         vkCmdEndQuery(m_VkCmdBuffer, queryPool, query);
         if (m_State.RenderPass != VK_NULL_HANDLE)
         {
@@ -571,6 +561,7 @@ public:
                                       uint32_t                query)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        FlushBarriers();
         vkCmdWriteTimestamp(m_VkCmdBuffer, pipelineStage, queryPool, query);
     }
 
@@ -584,6 +575,7 @@ public:
             // Query pool reset must be performed outside of render pass (17.2).
             EndRenderPass();
         }
+        FlushBarriers();
         vkCmdResetQueryPool(m_VkCmdBuffer, queryPool, firstQuery, queryCount);
     }
 
@@ -601,6 +593,7 @@ public:
             // Copy query results must be performed outside of render pass (17.2).
             EndRenderPass();
         }
+        FlushBarriers();
         vkCmdCopyQueryPoolResults(m_VkCmdBuffer, queryPool, firstQuery, queryCount,
                                   dstBuffer, dstOffset, stride, flags);
     }
@@ -616,6 +609,7 @@ public:
             // Build AS operations must be performed outside of render pass.
             EndRenderPass();
         }
+        FlushBarriers();
         vkCmdBuildAccelerationStructuresKHR(m_VkCmdBuffer, infoCount, pInfos, ppBuildRangeInfos);
 #else
         UNSUPPORTED("Ray tracing is not supported when vulkan library is linked statically");
@@ -631,6 +625,7 @@ public:
             // Copy AS operations must be performed outside of render pass.
             EndRenderPass();
         }
+        FlushBarriers();
         vkCmdCopyAccelerationStructureKHR(m_VkCmdBuffer, &Info);
 #else
         UNSUPPORTED("Ray tracing is not supported when vulkan library is linked statically");
@@ -646,6 +641,7 @@ public:
             // Write AS properties operations must be performed outside of render pass.
             EndRenderPass();
         }
+        FlushBarriers();
         vkCmdWriteAccelerationStructuresPropertiesKHR(m_VkCmdBuffer, 1, &accelerationStructure, queryType, queryPool, firstQuery);
 #else
         UNSUPPORTED("Ray tracing is not supported when vulkan library is linked statically");
@@ -664,13 +660,59 @@ public:
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         VERIFY(m_State.RayTracingPipeline != VK_NULL_HANDLE, "No ray tracing pipeline bound");
 
+        FlushBarriers();
         vkCmdTraceRaysKHR(m_VkCmdBuffer, &RaygenShaderBindingTable, &MissShaderBindingTable, &HitShaderBindingTable, &CallableShaderBindingTable, width, height, depth);
 #else
         UNSUPPORTED("Ray tracing is not supported when vulkan library is linked statically");
 #endif
     }
 
-    void FlushBarriers();
+    __forceinline bool HasPendingBarriers() const
+    {
+        return !m_PendingImageBarriers.empty() || !m_PendingBufferBarriers.empty() || !m_PendingMemoryBarriers.empty();
+    }
+
+    // Records all pending buffer copies and then all pending barriers with one vkCmdPipelineBarrier.
+    // Draw commands never need to flush as all barriers and copies are recorded outside
+    // of render pass and BeginRenderPass() flushes them.
+    __forceinline void FlushBarriers()
+    {
+        if (!m_PendingBufferCopies.empty())
+            FlushPendingBufferCopies();
+        if (HasPendingBarriers())
+            FlushPendingBarriers();
+    }
+
+    struct BarrierStatistics
+    {
+        /// The total number of image, buffer and memory barriers recorded
+        uint64_t NumBarriers = 0;
+
+        /// The number of vkCmdPipelineBarrier calls these barriers were submitted with.
+        /// NumBarriers - NumPipelineBarriers is the number of barriers that were merged.
+        uint64_t NumPipelineBarriers = 0;
+    };
+
+    const BarrierStatistics& GetBarrierStatistics() const { return m_BarrierStats; }
+
+    void ResetBarrierStatistics() { m_BarrierStats = BarrierStatistics{}; }
+
+    struct CopyStatistics
+    {
+        /// The total number of bytes copied by vkCmdCopyBuffer
+        uint64_t NumBytes = 0;
+
+        /// The total number of buffer copy regions
+        uint64_t NumRegions = 0;
+
+        /// The number of vkCmdCopyBuffer calls these regions were submitted with.
+        /// NumRegions - NumCopyCommands is the number of regions that were merged.
+        uint64_t NumCopyCommands = 0;
+    };
+
+    const CopyStatistics& GetCopyStatistics() const { return m_CopyStats; }
+
+    void ResetCopyStatistics() { m_CopyStats = CopyStatistics{}; }
 
     __forceinline void SetVkCmdBuffer(VkCommandBuffer VkCmdBuffer)
     {
@@ -702,6 +744,30 @@ private:
     StateCache                 m_State;
     VkCommandBuffer            m_VkCmdBuffer = VK_NULL_HANDLE;
     const VkPipelineStageFlags m_EnabledShaderStages;
+    const VkPipelineStageFlags m_SupportedStages;
+    const VkAccessFlags        m_SupportedAccessFlags;
+
+    void FlushPendingBarriers();
+    void FlushPendingBufferCopies();
+
+    std::vector<VkImageMemoryBarrier>  m_PendingImageBarriers;
+    std::vector<VkBufferMemoryBarrier> m_PendingBufferBarriers;
+    std::vector<VkMemoryBarrier>       m_PendingMemoryBarriers;
+    VkPipelineStageFlags               m_PendingSrcStages = 0;
+    VkPipelineStageFlags               m_PendingDstStages = 0;
+
+    BarrierStatistics m_BarrierStats;
+
+    struct PendingBufferCopy
+    {
+        VkBuffer     SrcBuffer;
+        VkBuffer     DstBuffer;
+        VkBufferCopy Region;
+    };
+    std::vector<PendingBufferCopy> m_PendingBufferCopies;
+    std::vector<VkBufferCopy>      m_PendingCopyRegions;
+
+    CopyStatistics m_CopyStats;
 };
 
 } // namespace VulkanUtilities
@@ -78,6 +78,8 @@ void SetSemaphoreName           (VkDevice device, VkSemaphore           semaphor
 void SetFenceName               (VkDevice device, VkFence               fence,               const char * name);
 void SetEventName               (VkDevice device, VkEvent               _event,              const char * name);
 void SetQueryPoolName           (VkDevice device, VkQueryPool           queryPool,           const char * name);
+void SetPipelineCacheName       (VkDevice device, VkPipelineCache       pipelineCache,       const char * name);
+void SetDescriptorUpdateTemplateName(VkDevice device, VkDescriptorUpdateTemplate descrUpdateTemplate, const char * name);
 
 enum class VulkanHandleTypeId : uint32_t;
 
@@ -49,6 +49,8 @@ public:
         bool                                             Spirv15             = false; // DXC shaders with ray tracing requires Vulkan 1.2 with SPIRV 1.5
         VkPhysicalDeviceBufferDeviceAddressFeaturesKHR   BufferDeviceAddress = {};
         VkPhysicalDeviceDescriptorIndexingFeaturesEXT    DescriptorIndexing  = {};
+        bool                                             DescriptorUpdateTemplate = false; // Descriptor update templates are in Vulkan 1.1 core
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR     TimelineSemaphore   = {};
     };
 
     struct ExtensionProperties
@@ -81,12 +83,13 @@ public:
 
     uint32_t GetMemoryTypeIndex(uint32_t typeBits, VkMemoryPropertyFlags properties) const;
 
-    const VkPhysicalDeviceProperties&       GetProperties() const { return m_Properties; }
-    const VkPhysicalDeviceFeatures&         GetFeatures() const { return m_Features; }
-    const ExtensionFeatures&                GetExtFeatures() const { return m_ExtFeatures; }
-    const ExtensionProperties&              GetExtProperties() const { return m_ExtProperties; }
-    const VkPhysicalDeviceMemoryProperties& GetMemoryProperties() const { return m_MemoryProperties; }
-    VkFormatProperties                      GetPhysicalDeviceFormatProperties(VkFormat imageFormat) const;
+    const VkPhysicalDeviceProperties&           GetProperties() const { return m_Properties; }
+    const VkPhysicalDeviceFeatures&             GetFeatures() const { return m_Features; }
+    const ExtensionFeatures&                    GetExtFeatures() const { return m_ExtFeatures; }
+    const ExtensionProperties&                  GetExtProperties() const { return m_ExtProperties; }
+    const VkPhysicalDeviceMemoryProperties&     GetMemoryProperties() const { return m_MemoryProperties; }
+    const std::vector<VkQueueFamilyProperties>& GetQueueProperties() const { return m_QueueFamilyProperties; }
+    VkFormatProperties                          GetPhysicalDeviceFormatProperties(VkFormat imageFormat) const;
 
 private:
     VulkanPhysicalDevice(VkPhysicalDevice      vkDevice,
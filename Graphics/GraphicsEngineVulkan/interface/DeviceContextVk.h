@@ -39,6 +39,36 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static const INTERFACE_ID IID_DeviceContextVk =
     {0x72aeb1ba, 0xc6ad, 0x42ec, {0x88, 0x11, 0x7e, 0xd9, 0xc7, 0x21, 0x76, 0xbb}};
 
+/// Pipeline barrier statistics, see IDeviceContextVk::GetBarrierStatistics().
+struct PipelineBarrierStatistics
+{
+    /// The total number of image, buffer and memory barriers recorded by the context.
+    Uint64 NumBarriers DEFAULT_INITIALIZER(0);
+
+    /// The number of vkCmdPipelineBarrier commands these barriers were submitted with.
+    /// NumBarriers - NumPipelineBarriers is the number of barriers that were merged.
+    Uint64 NumPipelineBarriers DEFAULT_INITIALIZER(0);
+};
+typedef struct PipelineBarrierStatistics PipelineBarrierStatistics;
+
+/// Upload statistics of a frame, see IDeviceContextVk::GetLastFrameUploadStatistics().
+struct FrameUploadStatistics
+{
+    /// The total size of all upload heap allocations made during the frame.
+    Uint64 UploadHeapSize DEFAULT_INITIALIZER(0);
+
+    /// The total number of bytes copied between buffers.
+    Uint64 NumCopyBytes DEFAULT_INITIALIZER(0);
+
+    /// The total number of buffer copy regions.
+    Uint64 NumCopyRegions DEFAULT_INITIALIZER(0);
+
+    /// The number of vkCmdCopyBuffer commands these regions were submitted with.
+    /// NumCopyRegions - NumCopyCommands is the number of regions that were merged.
+    Uint64 NumCopyCommands DEFAULT_INITIALIZER(0);
+};
+typedef struct FrameUploadStatistics FrameUploadStatistics;
+
 #define DILIGENT_INTERFACE_NAME IDeviceContextVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -89,6 +119,25 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextVk, IDeviceContext)
 
     /// Unlocks the command queue that was previously locked by IDeviceContextVk::LockCommandQueue().
     VIRTUAL void METHOD(UnlockCommandQueue)(THIS) PURE;
+
+    /// Returns pipeline barrier statistics accumulated over the lifetime of the context.
+
+    /// \param [out] Stats - Barrier statistics.
+    ///
+    /// \remarks Barriers are recorded lazily, so barriers that are still pending
+    ///          (not yet followed by any command or flush) are counted in NumBarriers,
+    ///          but not in NumPipelineBarriers.
+    VIRTUAL void METHOD(GetBarrierStatistics)(THIS_
+                                              PipelineBarrierStatistics REF Stats) CONST PURE;
+
+    /// Returns upload statistics of the last frame finished by IDeviceContext::FinishFrame().
+
+    /// \param [out] Stats - Upload statistics.
+    ///
+    /// \remarks Buffer copies are recorded lazily, so copies that were still pending
+    ///          when the frame was finished are counted in NumCopyRegions, but not in NumCopyCommands.
+    VIRTUAL void METHOD(GetLastFrameUploadStatistics)(THIS_
+                                                      FrameUploadStatistics REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -98,10 +147,12 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IDeviceContextVk_TransitionImageLayout(This, ...) CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout, This, __VA_ARGS__)
-#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)   CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,   This, __VA_ARGS__)
-#    define IDeviceContextVk_LockCommandQueue(This)           CALL_IFACE_METHOD(DeviceContextVk, LockCommandQueue,      This)
-#    define IDeviceContextVk_UnlockCommandQueue(This)         CALL_IFACE_METHOD(DeviceContextVk, UnlockCommandQueue,    This)
+#    define IDeviceContextVk_TransitionImageLayout(This, ...)        CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout,        This, __VA_ARGS__)
+#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)          CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,          This, __VA_ARGS__)
+#    define IDeviceContextVk_LockCommandQueue(This)                  CALL_IFACE_METHOD(DeviceContextVk, LockCommandQueue,             This)
+#    define IDeviceContextVk_UnlockCommandQueue(This)                CALL_IFACE_METHOD(DeviceContextVk, UnlockCommandQueue,           This)
+#    define IDeviceContextVk_GetBarrierStatistics(This, ...)         CALL_IFACE_METHOD(DeviceContextVk, GetBarrierStatistics,         This, __VA_ARGS__)
+#    define IDeviceContextVk_GetLastFrameUploadStatistics(This, ...) CALL_IFACE_METHOD(DeviceContextVk, GetLastFrameUploadStatistics, This, __VA_ARGS__)
 
 // clang-format on
 
@@ -75,6 +75,10 @@ DILIGENT_BEGIN_INTERFACE(IEngineFactoryVk, IEngineFactory)
     ///                           the contexts will be written. Immediate context goes at
     ///                           position 0. If EngineCI.NumDeferredContexts > 0,
     ///                           pointers to the deferred contexts are written afterwards.
+    ///                           If EngineCI.EnableAsyncComputeQueue is true, the pointer to the
+    ///                           async compute context is written next, followed by the pointer
+    ///                           to the transfer context if EngineCI.EnableTransferQueue is true.
+    ///                           The array must be large enough to hold all these pointers.
     VIRTUAL void METHOD(CreateDeviceAndContextsVk)(THIS_
                                                    const EngineVkCreateInfo REF EngineCI,
                                                    IRenderDevice**              ppDevice,
@@ -30,6 +30,7 @@
 /// \file
 /// Definition of the Diligent::IRenderDeviceVk interface
 
+#include "../../../Primitives/interface/DataBlob.h"
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
@@ -38,6 +39,23 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static const INTERFACE_ID IID_RenderDeviceVk =
     {0xab8cf3a6, 0xd959, 0x41c1, {0xae, 0x0, 0xa5, 0x8a, 0xe9, 0x82, 0xe, 0x6a}};
 
+/// SPIR-V compilation cache statistics, see IRenderDeviceVk::GetSPIRVCacheStatistics().
+struct SPIRVCacheStatistics
+{
+    /// The number of shaders that were loaded from the cache.
+    Uint32 NumHits DEFAULT_INITIALIZER(0);
+
+    /// The number of shaders that were not found in the cache and were compiled.
+    Uint32 NumMisses DEFAULT_INITIALIZER(0);
+
+    /// The total number of entries in the cache.
+    Uint32 NumEntries DEFAULT_INITIALIZER(0);
+
+    /// The total size of the byte code stored in the cache, in bytes.
+    Uint64 DataSize DEFAULT_INITIALIZER(0);
+};
+typedef struct SPIRVCacheStatistics SPIRVCacheStatistics;
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -150,6 +168,28 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
                                                       const TopLevelASDesc REF   Desc,
                                                       RESOURCE_STATE             InitialState,
                                                       ITopLevelAS**              ppTLAS) PURE;
+
+    /// Returns Vulkan pipeline cache handle that is used to create all pipeline states
+    VIRTUAL VkPipelineCache METHOD(GetVkPipelineCache)(THIS) PURE;
+
+    /// Serializes the content of the pipeline cache into a data blob
+
+    /// \param [out] ppData - Address of the memory location where the pointer to the
+    ///                       data blob will be stored.
+    ///                       The function calls AddRef(), so that the new object will contain
+    ///                       one reference.
+    /// \note  The data can be used to initialize the pipeline cache through
+    ///        EngineVkCreateInfo::pPipelineCacheData when the engine is created next time.
+    VIRTUAL void METHOD(GetPipelineCacheData)(THIS_
+                                              IDataBlob** ppData) PURE;
+
+    /// Returns SPIR-V compilation cache statistics.
+
+    /// \param [out] Stats - Cache statistics. If the cache is disabled
+    ///                      (EngineVkCreateInfo::SPIRVCacheDirectory is null),
+    ///                      all members are set to zero.
+    VIRTUAL void METHOD(GetSPIRVCacheStatistics)(THIS_
+                                                 SPIRVCacheStatistics REF Stats) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -169,6 +209,9 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_CreateBufferFromVulkanResource(This, ...) CALL_IFACE_METHOD(RenderDeviceVk, CreateBufferFromVulkanResource, This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateBLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateBLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateTLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateTLASFromVulkanResource,   This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetVkPipelineCache(This)                  CALL_IFACE_METHOD(RenderDeviceVk, GetVkPipelineCache,             This)
+#    define IRenderDeviceVk_GetPipelineCacheData(This, ...)           CALL_IFACE_METHOD(RenderDeviceVk, GetPipelineCacheData,           This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetSPIRVCacheStatistics(This, ...)        CALL_IFACE_METHOD(RenderDeviceVk, GetSPIRVCacheStatistics,        This, __VA_ARGS__)
 
 // clang-format on
 
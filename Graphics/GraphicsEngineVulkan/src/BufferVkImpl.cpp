@@ -173,7 +173,7 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
 
     if (m_Desc.Usage == USAGE_DYNAMIC)
     {
-        auto CtxCount = 1 + pRenderDeviceVk->GetNumDeferredContexts();
+        auto CtxCount = pRenderDeviceVk->GetNumDeviceContexts();
         m_DynamicData.reserve(CtxCount);
         for (Uint32 ctx = 0; ctx < CtxCount; ++ctx)
             m_DynamicData.emplace_back();
@@ -207,10 +207,8 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
     }
     else
     {
-        VkBuffCI.sharingMode           = VK_SHARING_MODE_EXCLUSIVE; // sharing mode of the buffer when it will be accessed by multiple queue families.
-        VkBuffCI.queueFamilyIndexCount = 0;                         // number of entries in the pQueueFamilyIndices array
-        VkBuffCI.pQueueFamilyIndices   = nullptr;                   // list of queue families that will access this buffer
-                                                                    // (ignored if sharingMode is not VK_SHARING_MODE_CONCURRENT).
+        // Buffers used by queues from different families are created with concurrent sharing mode
+        pRenderDeviceVk->InitSharingMode(VkBuffCI, m_Desc.CommandQueueMask);
 
         m_VulkanBuffer = LogicalDevice.CreateBuffer(VkBuffCI, m_Desc.Name);
 
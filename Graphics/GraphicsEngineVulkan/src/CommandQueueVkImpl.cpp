@@ -34,11 +34,12 @@ namespace Diligent
 
 CommandQueueVkImpl::CommandQueueVkImpl(IReferenceCounters*                                   pRefCounters,
                                        std::shared_ptr<VulkanUtilities::VulkanLogicalDevice> LogicalDevice,
-                                       uint32_t                                              QueueFamilyIndex) :
+                                       uint32_t                                              QueueFamilyIndex,
+                                       uint32_t                                              QueueIndex) :
     // clang-format off
     TBase{pRefCounters},
     m_LogicalDevice    {LogicalDevice},
-    m_VkQueue          {LogicalDevice->GetQueue(QueueFamilyIndex, 0)},
+    m_VkQueue          {LogicalDevice->GetQueue(QueueFamilyIndex, QueueIndex)},
     m_QueueFamilyIndex {QueueFamilyIndex},
     m_NextFenceValue   {1}
 // clang-format on
@@ -60,6 +61,12 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& SubmitInfo)
     // Increment the value before submitting the buffer to be overly safe
     Atomics::AtomicIncrement(m_NextFenceValue);
 
+    if (m_pFence->IsTimelineSemaphore())
+    {
+        SubmitWithTimelineSemaphore(SubmitInfo, static_cast<Uint64>(FenceValue));
+        return FenceValue;
+    }
+
     auto vkFence = m_pFence->GetVkFence();
 
     uint32_t SubmitCount =
@@ -78,6 +85,58 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& SubmitInfo)
     return FenceValue;
 }
 
+void CommandQueueVkImpl::SubmitWithTimelineSemaphore(const VkSubmitInfo& SubmitInfo, Uint64 FenceValue)
+{
+    // The queue fence semaphore is appended to the signal semaphores of the batch, so that no
+    // separate VkFence is required. If the batch already uses timeline semaphores, the
+    // VkTimelineSemaphoreSubmitInfoKHR structure must be the first one in the pNext chain.
+    const VkTimelineSemaphoreSubmitInfoKHR* pSrcTimelineInfo = nullptr;
+    if (SubmitInfo.pNext != nullptr &&
+        static_cast<const VkBaseInStructure*>(SubmitInfo.pNext)->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR)
+    {
+        pSrcTimelineInfo = static_cast<const VkTimelineSemaphoreSubmitInfoKHR*>(SubmitInfo.pNext);
+    }
+
+    m_SignalSemaphores.assign(SubmitInfo.pSignalSemaphores, SubmitInfo.pSignalSemaphores + SubmitInfo.signalSemaphoreCount);
+    if (pSrcTimelineInfo != nullptr && pSrcTimelineInfo->signalSemaphoreValueCount != 0)
+    {
+        VERIFY_EXPR(pSrcTimelineInfo->signalSemaphoreValueCount == SubmitInfo.signalSemaphoreCount);
+        m_SignalValues.assign(pSrcTimelineInfo->pSignalSemaphoreValues, pSrcTimelineInfo->pSignalSemaphoreValues + pSrcTimelineInfo->signalSemaphoreValueCount);
+    }
+    else
+    {
+        // Values are ignored for binary semaphores
+        m_SignalValues.assign(SubmitInfo.signalSemaphoreCount, 0);
+    }
+    m_SignalSemaphores.push_back(m_pFence->GetVkSemaphore());
+    m_SignalValues.push_back(FenceValue);
+
+    VkTimelineSemaphoreSubmitInfoKHR TimelineInfo = {};
+    if (pSrcTimelineInfo != nullptr)
+    {
+        TimelineInfo = *pSrcTimelineInfo;
+    }
+    else
+    {
+        TimelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        TimelineInfo.pNext = SubmitInfo.pNext;
+    }
+    TimelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(m_SignalValues.size());
+    TimelineInfo.pSignalSemaphoreValues    = m_SignalValues.data();
+
+    VkSubmitInfo TimelineSubmitInfo = SubmitInfo;
+
+    TimelineSubmitInfo.pNext                = &TimelineInfo;
+    TimelineSubmitInfo.signalSemaphoreCount = static_cast<uint32_t>(m_SignalSemaphores.size());
+    TimelineSubmitInfo.pSignalSemaphores    = m_SignalSemaphores.data();
+
+    m_pFence->AddPendingTimelineSignal(FenceValue);
+
+    auto err = vkQueueSubmit(m_VkQueue, 1, &TimelineSubmitInfo, VK_NULL_HANDLE);
+    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffer to the command queue");
+    (void)err;
+}
+
 Uint64 CommandQueueVkImpl::SubmitCmdBuffer(VkCommandBuffer cmdBuffer)
 {
     VkSubmitInfo SubmitInfo = {};
@@ -50,11 +50,21 @@ static std::string GetContextObjectName(const char* Object, bool bIsDeferred, Ui
     ss << Object;
     if (bIsDeferred)
         ss << " of deferred context #" << ContextId;
+    else if (ContextId != 0)
+        ss << " of immediate context #" << ContextId;
     else
         ss << " of immediate context";
     return ss.str();
 }
 
+static VkQueueFlags GetCommandQueueFlags(const RenderDeviceVkImpl& DeviceVk, Uint32 CommandQueueId)
+{
+    const auto  QueueFamilyIndex = DeviceVk.GetCommandQueue(CommandQueueId).GetQueueFamilyIndex();
+    const auto& QueueProperties  = DeviceVk.GetPhysicalDevice().GetQueueProperties();
+    VERIFY_EXPR(QueueFamilyIndex < QueueProperties.size());
+    return QueueProperties[QueueFamilyIndex].queueFlags;
+}
+
 DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*                   pRefCounters,
                                          RenderDeviceVkImpl*                   pDeviceVkImpl,
                                          bool                                  bIsDeferred,
@@ -72,7 +82,12 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*                   p
         bIsDeferred ? std::numeric_limits<decltype(m_NumCommandsToFlush)>::max() : EngineCI.NumCommandsToFlushCmdBuffer,
         bIsDeferred
     },
-    m_CommandBuffer { pDeviceVkImpl->GetLogicalDevice().GetEnabledShaderStages() },
+    m_CommandQueueFlags{GetCommandQueueFlags(*pDeviceVkImpl, CommandQueueId)},
+    m_CommandBuffer
+    {
+        pDeviceVkImpl->GetLogicalDevice().GetEnabledShaderStages(),
+        m_CommandQueueFlags
+    },
     m_CmdListAllocator { GetRawAllocator(), sizeof(CommandListVkImpl), 64 },
     // Command pools must be thread safe because command buffers are returned into pools by release queues
     // potentially running in another thread
@@ -103,7 +118,8 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*                   p
     m_GenerateMipsHelper{std::move(GenerateMipsHelper)}
 // clang-format on
 {
-    if (!m_bIsDeferred)
+    // Query pools can only be reset by queues that support graphics or compute operations
+    if (!m_bIsDeferred && (m_CommandQueueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) != 0)
     {
         m_QueryMgr.reset(new QueryManagerVk{pDeviceVkImpl, EngineCI.QueryPoolSizes});
     }
@@ -119,9 +135,15 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*                   p
     m_pDevice->CreateBuffer(DummyVBDesc, nullptr, &pDummyVB);
     m_DummyVB = pDummyVB.RawPtr<BufferVkImpl>();
 
+    const auto& EnabledFeatures = pDeviceVkImpl->GetLogicalDevice().GetEnabledFeatures();
+    if (EnabledFeatures.multiDrawIndirect != VK_FALSE && EnabledFeatures.drawIndirectFirstInstance != VK_FALSE)
+        m_MaxDrawIndirectCount = pDeviceVkImpl->GetPhysicalDevice().GetProperties().limits.maxDrawIndirectCount;
+
     m_vkClearValues.reserve(16);
 
     CreateASCompactedSizeQueryPool();
+
+    CreateMappedTexturesMap();
 }
 
 DeviceContextVkImpl::~DeviceContextVkImpl()
@@ -150,6 +172,7 @@ DeviceContextVkImpl::~DeviceContextVkImpl()
     // For deferred contexts, m_SubmittedBuffersCmdQueueMask is reset to 0 after every call to FinishFrame().
     // In this case there are no resources to release, so there will be no issues.
     FinishFrame();
+    DestroyMappedTexturesMap();
 
     // There must be no stale resources
     // clang-format off
@@ -441,6 +464,75 @@ void DeviceContextVkImpl::DvpLogRenderPass_PSOMismatch()
     LOG_ERROR_MESSAGE(ss.str());
 }
 
+#ifdef DILIGENT_DEVELOPMENT
+bool DeviceContextVkImpl::DvpVerifyCommandQueueCaps(VkQueueFlags RequiredFlags, const char* OpName) const
+{
+    if ((m_CommandQueueFlags & RequiredFlags) != RequiredFlags)
+    {
+        LOG_ERROR_MESSAGE(OpName, " command can't be executed by the context ", m_ContextId,
+                          " as its command queue (", m_CommandQueueId, ") does not support ",
+                          (RequiredFlags & VK_QUEUE_GRAPHICS_BIT) ? "graphics" : "compute", " operations.");
+        return false;
+    }
+    return true;
+}
+
+void DeviceContextVkImpl::DvpVerifyImageTransferGranularity(const TextureDesc& TexDesc,
+                                                            Uint32             MipLevel,
+                                                            const VkOffset3D&  Offset,
+                                                            const VkExtent3D&  Extent,
+                                                            const char*        OpName) const
+{
+    const auto  QueueFamilyIndex = m_pDevice->GetCommandQueue(m_CommandQueueId).GetQueueFamilyIndex();
+    const auto& Granularity      = m_pDevice->GetPhysicalDevice().GetQueueProperties()[QueueFamilyIndex].minImageTransferGranularity;
+    if (Granularity.width == 1 && Granularity.height == 1 && Granularity.depth == 1)
+        return;
+
+    const auto& FmtAttribs = GetTextureFormatAttribs(TexDesc.Format);
+    const auto  MipProps   = GetMipLevelProperties(TexDesc, MipLevel);
+
+    // Granularity (0,0,0) means that only whole mip levels can be transferred.
+    // Otherwise offsets must be multiples of the granularity, and extents must either be
+    // multiples of the granularity or reach the subresource edge. For compressed formats,
+    // the granularity is measured in texel blocks.
+    auto IsAligned = [](int32_t Start, uint32_t Size, uint32_t GranularityInBlocks, Uint32 BlockSize, Uint32 MipSize) -> bool //
+    {
+        const auto Begin = static_cast<Uint32>(Start);
+        if (GranularityInBlocks == 0)
+            return Begin == 0 && Begin + Size >= MipSize;
+
+        const auto TexelGranularity = GranularityInBlocks * BlockSize;
+        return (Begin % TexelGranularity) == 0 && ((Size % TexelGranularity) == 0 || Begin + Size >= MipSize);
+    };
+
+    const auto BlockWidth  = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ? Uint32{FmtAttribs.BlockWidth} : 1u;
+    const auto BlockHeight = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ? Uint32{FmtAttribs.BlockHeight} : 1u;
+    const auto MipDepth    = TexDesc.Type == RESOURCE_DIM_TEX_3D ? MipProps.Depth : 1u;
+    if (!IsAligned(Offset.x, Extent.width, Granularity.width, BlockWidth, MipProps.LogicalWidth) ||
+        !IsAligned(Offset.y, Extent.height, Granularity.height, BlockHeight, MipProps.LogicalHeight) ||
+        !IsAligned(Offset.z, Extent.depth, Granularity.depth, 1, MipDepth))
+    {
+        LOG_ERROR_MESSAGE(OpName, ": region [", Offset.x, " .. ", Offset.x + Extent.width, ") x [", Offset.y, " .. ", Offset.y + Extent.height,
+                          ") x [", Offset.z, " .. ", Offset.z + Extent.depth, ") of mip level ", MipLevel, " of texture '", TexDesc.Name,
+                          "' does not satisfy the image transfer granularity (", Granularity.width, ", ", Granularity.height, ", ", Granularity.depth,
+                          ") of the queue family ", QueueFamilyIndex, " the context ", m_ContextId, " submits commands to.");
+    }
+}
+
+void DeviceContextVkImpl::DvpVerifyCommandQueueMask(Uint64 CommandQueueMask, const char* ResourceName, const char* OpName) const
+{
+    // Deferred contexts are not bound to a queue until their command lists are executed
+    if (m_bIsDeferred)
+        return;
+
+    // Resources are only shared between the queues in their CommandQueueMask (see RenderDeviceVkImpl::InitSharingMode()).
+    // Accessing an exclusive resource from a queue of another family would require a queue family ownership transfer.
+    DEV_CHECK_ERR(((CommandQueueMask >> Uint64{m_CommandQueueId}) & 1) != 0,
+                  OpName, ": resource '", ResourceName, "' is accessed by the context ", m_ContextId, " that submits commands to the queue ",
+                  m_CommandQueueId, ", but the queue is not in the resource's CommandQueueMask (", CommandQueueMask, ").");
+}
+#endif
+
 void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
 {
 #ifdef DILIGENT_DEVELOPMENT
@@ -540,7 +632,7 @@ void DeviceContextVkImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE Ind
 
 void DeviceContextVkImpl::Draw(const DrawAttribs& Attribs)
 {
-    if (!DvpVerifyDrawArguments(Attribs))
+    if (!DvpVerifyCommandQueueCaps(VK_QUEUE_GRAPHICS_BIT, "Draw") || !DvpVerifyDrawArguments(Attribs))
         return;
 
     PrepareForDraw(Attribs.Flags);
@@ -551,7 +643,7 @@ void DeviceContextVkImpl::Draw(const DrawAttribs& Attribs)
 
 void DeviceContextVkImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
-    if (!DvpVerifyDrawIndexedArguments(Attribs))
+    if (!DvpVerifyCommandQueueCaps(VK_QUEUE_GRAPHICS_BIT, "DrawIndexed") || !DvpVerifyDrawIndexedArguments(Attribs))
         return;
 
     PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
@@ -560,9 +652,88 @@ void DeviceContextVkImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     ++m_State.NumCommands;
 }
 
+template <typename DrawItemType, typename DrawIndirectCmdType>
+bool DeviceContextVkImpl::IssueMultiDrawIndirect(const DrawItemType* pDrawItems, Uint32 DrawCount, DrawIndirectCmdType DrawIndirectCmd)
+{
+    if (DrawCount < 2 || m_MaxDrawIndirectCount < 2)
+        return false;
+
+    // Draw items are laid out exactly as indirect draw arguments, so they can be
+    // copied to the dynamic heap as is and issued with one indirect draw command.
+    constexpr Uint32 Stride = sizeof(DrawItemType);
+
+    auto DynAlloc = AllocateDynamicSpace(Stride * DrawCount, 4);
+    if (DynAlloc.pDynamicMemMgr == nullptr)
+        return false;
+
+    memcpy(DynAlloc.pDynamicMemMgr->GetCPUAddress() + DynAlloc.AlignedOffset, pDrawItems, size_t{Stride} * DrawCount);
+
+    const auto vkArgsBuffer = DynAlloc.pDynamicMemMgr->GetVkBuffer();
+    for (Uint32 FirstDraw = 0; FirstDraw < DrawCount; FirstDraw += m_MaxDrawIndirectCount)
+    {
+        const auto NumDraws = std::min(DrawCount - FirstDraw, m_MaxDrawIndirectCount);
+        DrawIndirectCmd(vkArgsBuffer, DynAlloc.AlignedOffset + VkDeviceSize{Stride} * FirstDraw, NumDraws, Stride);
+        ++m_State.NumCommands;
+    }
+
+    return true;
+}
+
+void DeviceContextVkImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    static_assert(sizeof(MultiDrawItem) == sizeof(VkDrawIndirectCommand), "MultiDrawItem must have the same layout as VkDrawIndirectCommand");
+
+    if (!DvpVerifyCommandQueueCaps(VK_QUEUE_GRAPHICS_BIT, "MultiDraw") || !DvpVerifyMultiDrawArguments(Attribs))
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    PrepareForDraw(Attribs.Flags);
+
+    auto DrawIndirectCmd = [this](VkBuffer Buffer, VkDeviceSize Offset, uint32_t DrawCount, uint32_t Stride) {
+        m_CommandBuffer.DrawIndirect(Buffer, Offset, DrawCount, Stride);
+    };
+    if (!IssueMultiDrawIndirect(Attribs.pDrawItems, Attribs.DrawCount, DrawIndirectCmd))
+    {
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item = Attribs.pDrawItems[i];
+            m_CommandBuffer.Draw(Item.NumVertices, Item.NumInstances, Item.StartVertexLocation, Item.FirstInstanceLocation);
+        }
+        m_State.NumCommands += Attribs.DrawCount;
+    }
+}
+
+void DeviceContextVkImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    static_assert(sizeof(MultiDrawIndexedItem) == sizeof(VkDrawIndexedIndirectCommand), "MultiDrawIndexedItem must have the same layout as VkDrawIndexedIndirectCommand");
+
+    if (!DvpVerifyCommandQueueCaps(VK_QUEUE_GRAPHICS_BIT, "MultiDrawIndexed") || !DvpVerifyMultiDrawIndexedArguments(Attribs))
+        return;
+
+    if (Attribs.DrawCount == 0)
+        return;
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    auto DrawIndexedIndirectCmd = [this](VkBuffer Buffer, VkDeviceSize Offset, uint32_t DrawCount, uint32_t Stride) {
+        m_CommandBuffer.DrawIndexedIndirect(Buffer, Offset, DrawCount, Stride);
+    };
+    if (!IssueMultiDrawIndirect(Attribs.pDrawItems, Attribs.DrawCount, DrawIndexedIndirectCmd))
+    {
+        for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+        {
+            const auto& Item = Attribs.pDrawItems[i];
+            m_CommandBuffer.DrawIndexed(Item.NumIndices, Item.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Item.FirstInstanceLocation);
+        }
+        m_State.NumCommands += Attribs.DrawCount;
+    }
+}
+
 void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
-    if (!DvpVerifyDrawIndirectArguments(Attribs, pAttribsBuffer))
+    if (!DvpVerifyCommandQueueCaps(VK_QUEUE_GRAPHICS_BIT, "DrawIndirect") || !DvpVerifyDrawIndirectArguments(Attribs, pAttribsBuffer))
         return;
 
     // We must prepare indirect draw attribs buffer first because state transitions must
@@ -577,7 +748,7 @@ void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs, IBuff
 
 void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
-    if (!DvpVerifyDrawIndexedIndirectArguments(Attribs, pAttribsBuffer))
+    if (!DvpVerifyCommandQueueCaps(VK_QUEUE_GRAPHICS_BIT, "DrawIndexedIndirect") || !DvpVerifyDrawIndexedIndirectArguments(Attribs, pAttribsBuffer))
         return;
 
     // We must prepare indirect draw attribs buffer first because state transitions must
@@ -592,7 +763,7 @@ void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs&
 
 void DeviceContextVkImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
-    if (!DvpVerifyDrawMeshArguments(Attribs))
+    if (!DvpVerifyCommandQueueCaps(VK_QUEUE_GRAPHICS_BIT, "DrawMesh") || !DvpVerifyDrawMeshArguments(Attribs))
         return;
 
     PrepareForDraw(Attribs.Flags);
@@ -603,7 +774,7 @@ void DeviceContextVkImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 
 void DeviceContextVkImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
-    if (!DvpVerifyDrawMeshIndirectArguments(Attribs, pAttribsBuffer))
+    if (!DvpVerifyCommandQueueCaps(VK_QUEUE_GRAPHICS_BIT, "DrawMeshIndirect") || !DvpVerifyDrawMeshIndirectArguments(Attribs, pAttribsBuffer))
         return;
 
     // We must prepare indirect draw attribs buffer first because state transitions must
@@ -657,7 +828,7 @@ void DeviceContextVkImpl::PrepareForRayTracing()
 
 void DeviceContextVkImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
-    if (!DvpVerifyDispatchArguments(Attribs))
+    if (!DvpVerifyCommandQueueCaps(VK_QUEUE_COMPUTE_BIT, "DispatchCompute") || !DvpVerifyDispatchArguments(Attribs))
         return;
 
     PrepareForDispatchCompute();
@@ -667,7 +838,7 @@ void DeviceContextVkImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 
 void DeviceContextVkImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs, IBuffer* pAttribsBuffer)
 {
-    if (!DvpVerifyDispatchIndirectArguments(Attribs, pAttribsBuffer))
+    if (!DvpVerifyCommandQueueCaps(VK_QUEUE_COMPUTE_BIT, "DispatchComputeIndirect") || !DvpVerifyDispatchIndirectArguments(Attribs, pAttribsBuffer))
         return;
 
     PrepareForDispatchCompute();
@@ -935,11 +1106,18 @@ void DeviceContextVkImpl::FinishFrame()
         LOG_ERROR_MESSAGE("Finishing frame inside an active render pass.");
     }
 
-    if (!m_MappedTextures.empty())
+    if (!m_pMappedTextures->empty())
         LOG_ERROR_MESSAGE("There are mapped textures in the device context when finishing the frame. All dynamic resources must be used in the same frame in which they are mapped.");
 
     VERIFY_EXPR(m_bIsDeferred || m_SubmittedBuffersCmdQueueMask == (Uint64{1} << m_CommandQueueId));
 
+    const auto& CopyStats                  = m_CommandBuffer.GetCopyStatistics();
+    m_LastFrameUploadStats.UploadHeapSize  = m_UploadHeap.GetCurrFrameSize();
+    m_LastFrameUploadStats.NumCopyBytes    = CopyStats.NumBytes;
+    m_LastFrameUploadStats.NumCopyRegions  = CopyStats.NumRegions;
+    m_LastFrameUploadStats.NumCopyCommands = CopyStats.NumCopyCommands;
+    m_CommandBuffer.ResetCopyStatistics();
+
     // Release resources used by the context during this frame.
 
     // Upload heap returns all allocated pages to the global memory manager.
@@ -957,7 +1135,26 @@ void DeviceContextVkImpl::FinishFrame()
     // be destroyed before the pools are actually returned to the global pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(m_SubmittedBuffersCmdQueueMask);
 
+    // The map lives in the frame allocator memory, so it must be destroyed before the memory is
+    // discarded by EndFrame() and created again afterwards.
+    DestroyMappedTexturesMap();
     EndFrame();
+    CreateMappedTexturesMap();
+}
+
+void DeviceContextVkImpl::CreateMappedTexturesMap()
+{
+    VERIFY_EXPR(m_pMappedTextures == nullptr);
+    m_pMappedTextures = m_FrameAllocator.Construct<MappedTexturesMap>(
+        0, MappedTextureKey::Hasher{}, std::equal_to<MappedTextureKey>{},
+        STD_ALLOCATOR_DYNAMIC_LINEAR(MappedTexturesMap::value_type, m_FrameAllocator, "Allocator for unordered_map<MappedTextureKey, MappedTexture>"));
+}
+
+void DeviceContextVkImpl::DestroyMappedTexturesMap()
+{
+    VERIFY_EXPR(m_pMappedTextures != nullptr);
+    m_pMappedTextures->~MappedTexturesMap();
+    m_pMappedTextures = nullptr;
 }
 
 void DeviceContextVkImpl::Flush()
@@ -1027,21 +1224,75 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
 
     VERIFY_EXPR(m_VkWaitSemaphores.size() == m_WaitSemaphores.size());
     VERIFY_EXPR(m_VkSignalSemaphores.size() == m_SignalSemaphores.size());
+    VERIFY_EXPR(m_WaitSemaphores.size() == m_WaitDstStageMasks.size());
+
+    // Fences that are backed by timeline semaphores are signaled and waited for by the batch itself
+    // rather than through separate VkFence submissions. Values of binary semaphores are ignored.
+    bool UseTimelineSemaphores = !m_PendingFenceWaits.empty();
+    m_WaitSemaphoreValues.assign(m_VkWaitSemaphores.size(), 0);
+    m_SignalSemaphoreValues.assign(m_VkSignalSemaphores.size(), 0);
+    for (auto& val_fence : m_PendingFences)
+    {
+        auto* pFenceVk = val_fence.second.RawPtr<FenceVkImpl>();
+        if (!pFenceVk->IsTimelineSemaphore())
+            continue;
+
+        UseTimelineSemaphores = true;
+
+        // A semaphore must only be signaled once per batch, so only the last value is used
+        auto vkSemaphore = pFenceVk->GetVkSemaphore();
+        auto SignalIdx   = m_SignalSemaphores.size();
+        while (SignalIdx < m_VkSignalSemaphores.size() && m_VkSignalSemaphores[SignalIdx] != vkSemaphore)
+            ++SignalIdx;
+        if (SignalIdx == m_VkSignalSemaphores.size())
+        {
+            m_VkSignalSemaphores.push_back(vkSemaphore);
+            m_SignalSemaphoreValues.push_back(val_fence.first);
+        }
+        else
+        {
+            DEV_CHECK_ERR(val_fence.first > m_SignalSemaphoreValues[SignalIdx], "Fence '", pFenceVk->GetDesc().Name,
+                          "' is signaled multiple times with values that are not increasing");
+            m_SignalSemaphoreValues[SignalIdx] = val_fence.first;
+        }
+        pFenceVk->AddPendingTimelineSignal(val_fence.first);
+    }
+    for (auto& val_fence : m_PendingFenceWaits)
+    {
+        auto* pFenceVk = val_fence.second.RawPtr<FenceVkImpl>();
+        VERIFY_EXPR(pFenceVk->IsTimelineSemaphore());
+        m_VkWaitSemaphores.push_back(pFenceVk->GetVkSemaphore());
+        m_WaitDstStageMasks.push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+        m_WaitSemaphoreValues.push_back(val_fence.first);
+    }
 
     VkSubmitInfo SubmitInfo = {};
 
     SubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     SubmitInfo.pNext = nullptr;
 
-    SubmitInfo.commandBufferCount = static_cast<uint32_t>(vkCmdBuffs.size());
-    SubmitInfo.pCommandBuffers    = vkCmdBuffs.data();
-    SubmitInfo.waitSemaphoreCount = static_cast<uint32_t>(m_WaitSemaphores.size());
-    VERIFY_EXPR(m_WaitSemaphores.size() == m_WaitDstStageMasks.size());
+    SubmitInfo.commandBufferCount   = static_cast<uint32_t>(vkCmdBuffs.size());
+    SubmitInfo.pCommandBuffers      = vkCmdBuffs.data();
+    SubmitInfo.waitSemaphoreCount   = static_cast<uint32_t>(m_VkWaitSemaphores.size());
     SubmitInfo.pWaitSemaphores      = SubmitInfo.waitSemaphoreCount != 0 ? m_VkWaitSemaphores.data() : nullptr;
     SubmitInfo.pWaitDstStageMask    = SubmitInfo.waitSemaphoreCount != 0 ? m_WaitDstStageMasks.data() : nullptr;
-    SubmitInfo.signalSemaphoreCount = static_cast<uint32_t>(m_SignalSemaphores.size());
+    SubmitInfo.signalSemaphoreCount = static_cast<uint32_t>(m_VkSignalSemaphores.size());
     SubmitInfo.pSignalSemaphores    = SubmitInfo.signalSemaphoreCount != 0 ? m_VkSignalSemaphores.data() : nullptr;
 
+    VkTimelineSemaphoreSubmitInfoKHR TimelineInfo = {};
+    if (UseTimelineSemaphores)
+    {
+        // The structure must be the first in the chain, see CommandQueueVkImpl::Submit()
+        TimelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        TimelineInfo.pNext                     = nullptr;
+        TimelineInfo.waitSemaphoreValueCount   = SubmitInfo.waitSemaphoreCount;
+        TimelineInfo.pWaitSemaphoreValues      = SubmitInfo.waitSemaphoreCount != 0 ? m_WaitSemaphoreValues.data() : nullptr;
+        TimelineInfo.signalSemaphoreValueCount = SubmitInfo.signalSemaphoreCount;
+        TimelineInfo.pSignalSemaphoreValues    = SubmitInfo.signalSemaphoreCount != 0 ? m_SignalSemaphoreValues.data() : nullptr;
+
+        SubmitInfo.pNext = &TimelineInfo;
+    }
+
     // Submit command buffer even if there are no commands to release stale resources.
     //if (SubmitInfo.commandBufferCount != 0 || SubmitInfo.waitSemaphoreCount !=0 || SubmitInfo.signalSemaphoreCount != 0)
     auto SubmittedFenceValue = m_pDevice->ExecuteCommandBuffer(m_CommandQueueId, SubmitInfo, this, &m_PendingFences);
@@ -1051,7 +1302,10 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     m_SignalSemaphores.clear();
     m_VkWaitSemaphores.clear();
     m_VkSignalSemaphores.clear();
+    m_WaitSemaphoreValues.clear();
+    m_SignalSemaphoreValues.clear();
     m_PendingFences.clear();
+    m_PendingFenceWaits.clear();
 
     size_t buff_idx = 0;
     if (vkCmdBuff != VK_NULL_HANDLE)
@@ -1457,6 +1711,7 @@ void DeviceContextVkImpl::UpdateBuffer(IBuffer*                       pBuffer,
         return;
     }
 #endif
+    DvpVerifyCommandQueueMask(pBuffVk->GetDesc().CommandQueueMask, pBuffVk->GetDesc().Name, "UpdateBuffer");
 
     constexpr size_t Alignment = 4;
     // Source buffer offset must be multiple of 4 (18.4)
@@ -1487,6 +1742,8 @@ void DeviceContextVkImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
         return;
     }
 #endif
+    DvpVerifyCommandQueueMask(pSrcBuffVk->GetDesc().CommandQueueMask, pSrcBuffVk->GetDesc().Name, "CopyBuffer");
+    DvpVerifyCommandQueueMask(pDstBuffVk->GetDesc().CommandQueueMask, pDstBuffVk->GetDesc().Name, "CopyBuffer");
 
     EnsureVkCmdBuffer();
     TransitionOrVerifyBufferState(*pSrcBuffVk, SrcBufferTransitionMode, RESOURCE_STATE_COPY_SOURCE, VK_ACCESS_TRANSFER_READ_BIT, "Using buffer as copy source (DeviceContextVkImpl::CopyBuffer)");
@@ -1620,6 +1877,7 @@ void DeviceContextVkImpl::UpdateTexture(ITexture*                      pTexture,
     auto* pTexVk = ValidatedCast<TextureVkImpl>(pTexture);
     // OpenGL backend uses UpdateData() to initialize textures, so we can't check the usage in ValidateUpdateTextureParams()
     DEV_CHECK_ERR(pTexVk->GetDesc().Usage == USAGE_DEFAULT, "Only USAGE_DEFAULT textures should be updated with UpdateData()");
+    DvpVerifyCommandQueueMask(pTexVk->GetDesc().CommandQueueMask, pTexVk->GetDesc().Name, "UpdateTexture");
 
     if (SubresData.pSrcBuffer != nullptr)
     {
@@ -1638,6 +1896,8 @@ void DeviceContextVkImpl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
 
     auto* pSrcTexVk = ValidatedCast<TextureVkImpl>(CopyAttribs.pSrcTexture);
     auto* pDstTexVk = ValidatedCast<TextureVkImpl>(CopyAttribs.pDstTexture);
+    DvpVerifyCommandQueueMask(pSrcTexVk->GetDesc().CommandQueueMask, pSrcTexVk->GetDesc().Name, "CopyTexture");
+    DvpVerifyCommandQueueMask(pDstTexVk->GetDesc().CommandQueueMask, pDstTexVk->GetDesc().Name, "CopyTexture");
 
     // We must unbind the textures from framebuffer because
     // we will transition their states. If we later try to commit
@@ -1775,6 +2035,11 @@ void DeviceContextVkImpl::CopyTextureRegion(TextureVkImpl*                 pSrcT
     TransitionOrVerifyTextureState(*pDstTexture, DstTextureTransitionMode, RESOURCE_STATE_COPY_DEST, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                                    "Using texture as transfer destination (DeviceContextVkImpl::CopyTextureRegion)");
 
+    DvpVerifyImageTransferGranularity(pSrcTexture->GetDesc(), CopyRegion.srcSubresource.mipLevel, CopyRegion.srcOffset, CopyRegion.extent,
+                                      "Copying texture region (DeviceContextVkImpl::CopyTextureRegion)");
+    DvpVerifyImageTransferGranularity(pDstTexture->GetDesc(), CopyRegion.dstSubresource.mipLevel, CopyRegion.dstOffset, CopyRegion.extent,
+                                      "Copying texture region (DeviceContextVkImpl::CopyTextureRegion)");
+
     // srcImageLayout must be VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL or VK_IMAGE_LAYOUT_GENERAL
     // dstImageLayout must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL or VK_IMAGE_LAYOUT_GENERAL (18.3)
     m_CommandBuffer.CopyImage(pSrcTexture->GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, pDstTexture->GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &CopyRegion);
@@ -1819,24 +2084,15 @@ void DeviceContextVkImpl::UpdateTextureRegion(const void*                    pSr
         VERIFY(UpdateRegionDepth == 1 || SrcDepthStride >= PlaneSize, "Source data depth stride (", SrcDepthStride, ") is below the image plane size (", PlaneSize, ")");
     }
 #endif
-    for (Uint32 DepthSlice = 0; DepthSlice < UpdateRegionDepth; ++DepthSlice)
-    {
-        for (Uint32 row = 0; row < CopyInfo.RowCount; ++row)
-        {
-            // clang-format off
-            const auto* pSrcPtr =
-                reinterpret_cast<const Uint8*>(pSrcData)
-                + row        * SrcStride
-                + DepthSlice * SrcDepthStride;
-            auto* pDstPtr =
-                reinterpret_cast<Uint8*>(Allocation.CPUAddress)
-                + row        * CopyInfo.RowStride
-                + DepthSlice * CopyInfo.DepthStride;
-            // clang-format on
-
-            memcpy(pDstPtr, pSrcPtr, CopyInfo.RowSize);
-        }
-    }
+    CopyTextureSubresource(TextureSubResData{pSrcData, SrcStride, SrcDepthStride},
+                           CopyInfo.RowCount,
+                           UpdateRegionDepth,
+                           CopyInfo.RowSize,
+                           Allocation.CPUAddress,
+                           CopyInfo.RowStride,
+                           CopyInfo.DepthStride,
+                           COPY_TEXTURE_SUBRESOURCE_FLAG_WRITE_COMBINED,
+                           m_pDevice->GetTextureCopyThreadPool(CopyInfo.MemorySize));
     CopyBufferToTexture(Allocation.vkBuffer,
                         static_cast<Uint32>(Allocation.AlignedOffset),
                         CopyInfo.RowStrideInTexels,
@@ -1928,6 +2184,8 @@ void DeviceContextVkImpl::CopyBufferToTexture(VkBuffer                       vkS
 
     const auto&       TexDesc     = DstTextureVk.GetDesc();
     VkBufferImageCopy BuffImgCopy = GetBufferImageCopyInfo(SrcBufferOffset, SrcBufferRowStrideInTexels, TexDesc, DstRegion, DstMipLevel, DstArraySlice);
+    DvpVerifyImageTransferGranularity(TexDesc, DstMipLevel, BuffImgCopy.imageOffset, BuffImgCopy.imageExtent,
+                                      "Copying buffer to texture (DeviceContextVkImpl::CopyBufferToTexture)");
 
     m_CommandBuffer.CopyBufferToImage(
         vkSrcBuffer,
@@ -1952,6 +2210,8 @@ void DeviceContextVkImpl::CopyTextureToBuffer(TextureVkImpl&                 Src
 
     const auto&       TexDesc     = SrcTextureVk.GetDesc();
     VkBufferImageCopy BuffImgCopy = GetBufferImageCopyInfo(DstBufferOffset, DstBufferRowStrideInTexels, TexDesc, SrcRegion, SrcMipLevel, SrcArraySlice);
+    DvpVerifyImageTransferGranularity(TexDesc, SrcMipLevel, BuffImgCopy.imageOffset, BuffImgCopy.imageExtent,
+                                      "Copying texture to buffer (DeviceContextVkImpl::CopyTextureToBuffer)");
 
     m_CommandBuffer.CopyImageToBuffer(
         SrcTextureVk.GetVkImage(),
@@ -2014,7 +2274,7 @@ void DeviceContextVkImpl::MapTextureSubresource(ITexture*                 pTextu
         MappedData.Stride      = CopyInfo.RowStride;
         MappedData.DepthStride = CopyInfo.DepthStride;
 
-        auto it = m_MappedTextures.emplace(MappedTextureKey{&TextureVk, MipLevel, ArraySlice}, MappedTexture{CopyInfo, std::move(Allocation)});
+        auto it = m_pMappedTextures->emplace(MappedTextureKey{&TextureVk, MipLevel, ArraySlice}, MappedTexture{CopyInfo, std::move(Allocation)});
         if (!it.second)
             LOG_ERROR_MESSAGE("Mip level ", MipLevel, ", slice ", ArraySlice, " of texture '", TexDesc.Name, "' has already been mapped");
     }
@@ -2078,8 +2338,8 @@ void DeviceContextVkImpl::UnmapTextureSubresource(ITexture* pTexture,
 
     if (TexDesc.Usage == USAGE_DYNAMIC)
     {
-        auto UploadSpaceIt = m_MappedTextures.find(MappedTextureKey{&TextureVk, MipLevel, ArraySlice});
-        if (UploadSpaceIt != m_MappedTextures.end())
+        auto UploadSpaceIt = m_pMappedTextures->find(MappedTextureKey{&TextureVk, MipLevel, ArraySlice});
+        if (UploadSpaceIt != m_pMappedTextures->end())
         {
             auto& MappedTex = UploadSpaceIt->second;
             CopyBufferToTexture(MappedTex.Allocation.pDynamicMemMgr->GetVkBuffer(),
@@ -2090,7 +2350,7 @@ void DeviceContextVkImpl::UnmapTextureSubresource(ITexture* pTexture,
                                 MipLevel,
                                 ArraySlice,
                                 RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
-            m_MappedTextures.erase(UploadSpaceIt);
+            m_pMappedTextures->erase(UploadSpaceIt);
         }
         else
         {
@@ -2124,6 +2384,8 @@ void DeviceContextVkImpl::FinishCommandList(class ICommandList** ppCommandList)
         m_CommandBuffer.EndRenderPass();
     }
 
+    m_CommandBuffer.FlushBarriers();
+
     auto vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
     auto err       = vkEndCommandBuffer(vkCmdBuff);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to end command buffer");
@@ -2152,6 +2414,9 @@ void DeviceContextVkImpl::ExecuteCommandLists(Uint32               NumCommandLis
     if (NumCommandLists == 0)
         return;
     DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+    // Deferred contexts allocate command buffers from the pools of the main queue family
+    DEV_CHECK_ERR(m_pDevice->GetCommandQueue(m_CommandQueueId).GetQueueFamilyIndex() == m_pDevice->GetCommandQueue(0).GetQueueFamilyIndex(),
+                  "Command lists can only be executed by contexts whose command queue belongs to the same family as the main queue");
 
     Flush(NumCommandLists, ppCommandLists);
 
@@ -2173,6 +2438,43 @@ void DeviceContextVkImpl::WaitForFence(IFence* pFence, Uint64 Value, bool FlushC
     pFenceVk->Wait(Value);
 }
 
+void DeviceContextVkImpl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    VERIFY(!m_bIsDeferred, "Fence can only be waited from immediate context");
+    DEV_CHECK_ERR(pFence != nullptr, "Fence must not be null");
+
+    auto* pFenceVk = ValidatedCast<FenceVkImpl>(pFence);
+    if (pFenceVk->IsTimelineSemaphore())
+    {
+        // The value may already be reached, or the fence may have been reset past it from
+        // the host while a GPU signal is still pending. A GPU wait in the latter case would
+        // never complete as the semaphore counter can't reach the reset value.
+        if (Value <= pFenceVk->GetCompletedValue())
+            return;
+
+        // If the value is signaled by this context, but the signal has not been submitted yet,
+        // the signal and the wait would end up in the same batch. Waits are performed before
+        // the command buffers are executed and signals after, so the queue would deadlock.
+        // Submit the signal in a separate batch first.
+        for (const auto& SignalInfo : m_PendingFences)
+        {
+            if (SignalInfo.second.RawPtr() == pFence && SignalInfo.first >= Value)
+            {
+                Flush();
+                break;
+            }
+        }
+
+        m_PendingFenceWaits.emplace_back(std::make_pair(Value, pFence));
+    }
+    else
+    {
+        // Binary fences can only be waited for on the host
+        Flush();
+        pFenceVk->Wait(Value);
+    }
+}
+
 void DeviceContextVkImpl::WaitForIdle()
 {
     VERIFY(!m_bIsDeferred, "Only immediate contexts can be idled");
@@ -2182,6 +2484,12 @@ void DeviceContextVkImpl::WaitForIdle()
 
 void DeviceContextVkImpl::BeginQuery(IQuery* pQuery)
 {
+    if (!m_bIsDeferred && m_QueryMgr == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Queries are not supported by the transfer queue the context submits commands to");
+        return;
+    }
+
     if (!TDeviceContextBase::BeginQuery(pQuery, 0))
         return;
 
@@ -2226,6 +2534,12 @@ void DeviceContextVkImpl::BeginQuery(IQuery* pQuery)
 
 void DeviceContextVkImpl::EndQuery(IQuery* pQuery)
 {
+    if (!m_bIsDeferred && m_QueryMgr == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Queries are not supported by the transfer queue the context submits commands to");
+        return;
+    }
+
     if (!TDeviceContextBase::EndQuery(pQuery, 0))
         return;
 
@@ -2285,6 +2599,18 @@ void DeviceContextVkImpl::TransitionImageLayout(ITexture* pTexture, VkImageLayou
     }
 }
 
+void DeviceContextVkImpl::GetBarrierStatistics(PipelineBarrierStatistics& Stats) const
+{
+    const auto& CmdBuffStats  = m_CommandBuffer.GetBarrierStatistics();
+    Stats.NumBarriers         = CmdBuffStats.NumBarriers;
+    Stats.NumPipelineBarriers = CmdBuffStats.NumPipelineBarriers;
+}
+
+void DeviceContextVkImpl::GetLastFrameUploadStatistics(FrameUploadStatistics& Stats) const
+{
+    Stats = m_LastFrameUploadStats;
+}
+
 namespace
 {
 NODISCARD inline bool ResourceStateHasWriteAccess(RESOURCE_STATE State)
@@ -2330,6 +2656,8 @@ void DeviceContextVkImpl::TransitionTextureState(TextureVkImpl&           Textur
         }
     }
 
+    DvpVerifyCommandQueueMask(TextureVk.GetDesc().CommandQueueMask, TextureVk.GetDesc().Name, "Texture state transition");
+
     EnsureVkCmdBuffer();
 
     auto vkImg = TextureVk.GetVkImage();
@@ -2458,6 +2786,8 @@ void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl& BufferVk, RESOURCE
         }
     }
 
+    DvpVerifyCommandQueueMask(BufferVk.GetDesc().CommandQueueMask, BufferVk.GetDesc().Name, "Buffer state transition");
+
     // Always add barrier after writes.
     const bool AfterWrite = ResourceStateHasWriteAccess(OldState);
 
@@ -3138,7 +3468,7 @@ void DeviceContextVkImpl::CreateASCompactedSizeQueryPool()
 
 void DeviceContextVkImpl::TraceRays(const TraceRaysAttribs& Attribs)
 {
-    if (!TDeviceContextBase::TraceRays(Attribs, 0))
+    if (!DvpVerifyCommandQueueCaps(VK_QUEUE_COMPUTE_BIT, "TraceRays") || !TDeviceContextBase::TraceRays(Attribs, 0))
         return;
 
     auto*    pSBTVk  = ValidatedCast<ShaderBindingTableVkImpl>(Attribs.pSBT);
@@ -29,7 +29,8 @@
 /// Routines that initialize Vulkan-based engine implementation
 
 #include "pch.h"
-#include <array>
+#include <vector>
+#include <limits>
 #include "EngineFactoryVk.h"
 #include "RenderDeviceVkImpl.hpp"
 #include "DeviceContextVkImpl.hpp"
@@ -133,7 +134,8 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& _E
     SetRawAllocator(EngineCI.pRawMemAllocator);
 
     *ppDevice = nullptr;
-    memset(ppContexts, 0, sizeof(*ppContexts) * (1 + EngineCI.NumDeferredContexts));
+    const Uint32 NumExtraContexts = (EngineCI.EnableAsyncComputeQueue ? 1 : 0) + (EngineCI.EnableTransferQueue ? 1 : 0);
+    memset(ppContexts, 0, sizeof(*ppContexts) * (1 + EngineCI.NumDeferredContexts + NumExtraContexts));
 
     try
     {
@@ -156,28 +158,100 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& _E
         // at least one queue family of at least one physical device exposed by the implementation
         // must support both graphics and compute operations.
 
-        VkDeviceQueueCreateInfo QueueInfo{};
-        QueueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-        QueueInfo.flags = 0; // reserved for future use
-        // All commands that are allowed on a queue that supports transfer operations are also allowed on a
-        // queue that supports either graphics or compute operations. Thus, if the capabilities of a queue family
-        // include VK_QUEUE_GRAPHICS_BIT or VK_QUEUE_COMPUTE_BIT, then reporting the VK_QUEUE_TRANSFER_BIT
-        // capability separately for that queue family is optional (4.1).
-        QueueInfo.queueFamilyIndex       = PhysicalDevice->FindQueueFamily(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT);
-        QueueInfo.queueCount             = 1;
-        const float defaultQueuePriority = 1.0f; // Ask for highest priority for our queue. (range [0,1])
-        QueueInfo.pQueuePriorities       = &defaultQueuePriority;
+        const auto GraphicsQueueFamily = PhysicalDevice->FindQueueFamily(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT);
+
+        const auto& QueueFamilyProps = PhysicalDevice->GetQueueProperties();
+        // The number of queues requested from every queue family
+        std::vector<uint32_t> FamilyQueueCount(QueueFamilyProps.size());
+        // Family index and queue index within the family of every command queue.
+        // The main graphics queue always goes first.
+        std::vector<std::pair<uint32_t, uint32_t>> CmdQueueLocations;
+        CmdQueueLocations.emplace_back(GraphicsQueueFamily, FamilyQueueCount[GraphicsQueueFamily]++);
+
+        static constexpr uint32_t InvalidFamilyInd = std::numeric_limits<uint32_t>::max();
+        // Finds a family that has a queue that is not used yet, and whose capabilities
+        // include any of AnyOfFlags and none of NoneOfFlags.
+        auto FindFreeQueueFamily = [&](VkQueueFlags AnyOfFlags, VkQueueFlags NoneOfFlags) //
+        {
+            for (uint32_t i = 0; i < QueueFamilyProps.size(); ++i)
+            {
+                const auto& Props = QueueFamilyProps[i];
+                if ((Props.queueFlags & AnyOfFlags) != 0 && (Props.queueFlags & NoneOfFlags) == 0 && FamilyQueueCount[i] < Props.queueCount)
+                    return i;
+            }
+            return InvalidFamilyInd;
+        };
+
+        bool AsyncComputeQueueFound = false;
+        if (EngineCI.EnableAsyncComputeQueue)
+        {
+            // Prefer a family without graphics capabilities as its queues are more likely to
+            // be executed by the hardware in parallel with the graphics queue.
+            auto FamilyInd = FindFreeQueueFamily(VK_QUEUE_COMPUTE_BIT, VK_QUEUE_GRAPHICS_BIT);
+            if (FamilyInd == InvalidFamilyInd)
+                FamilyInd = FindFreeQueueFamily(VK_QUEUE_COMPUTE_BIT, 0);
+
+            if (FamilyInd != InvalidFamilyInd)
+            {
+                CmdQueueLocations.emplace_back(FamilyInd, FamilyQueueCount[FamilyInd]++);
+                AsyncComputeQueueFound = true;
+            }
+            else
+                LOG_WARNING_MESSAGE("The device has no free compute queue. Async compute context will not be created.");
+        }
+
+        bool TransferQueueFound = false;
+        if (EngineCI.EnableTransferQueue)
+        {
+            // All commands that are allowed on a queue that supports transfer operations are also allowed on a
+            // queue that supports either graphics or compute operations. Thus, if the capabilities of a queue family
+            // include VK_QUEUE_GRAPHICS_BIT or VK_QUEUE_COMPUTE_BIT, then reporting the VK_QUEUE_TRANSFER_BIT
+            // capability separately for that queue family is optional (4.1).
+            // Transfer-only families are typically backed by dedicated DMA engines.
+            auto FamilyInd = FindFreeQueueFamily(VK_QUEUE_TRANSFER_BIT, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT);
+            if (FamilyInd == InvalidFamilyInd)
+                FamilyInd = FindFreeQueueFamily(VK_QUEUE_COMPUTE_BIT, VK_QUEUE_GRAPHICS_BIT);
+            if (FamilyInd == InvalidFamilyInd)
+                FamilyInd = FindFreeQueueFamily(VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT, 0);
+
+            if (FamilyInd != InvalidFamilyInd)
+            {
+                CmdQueueLocations.emplace_back(FamilyInd, FamilyQueueCount[FamilyInd]++);
+                TransferQueueFound = true;
+            }
+            else
+                LOG_WARNING_MESSAGE("The device has no free transfer queue. Transfer context will not be created.");
+        }
+
+        // Ask for highest priority for all queues (range [0,1])
+        const std::vector<float>             QueuePriorities(CmdQueueLocations.size(), 1.0f);
+        std::vector<VkDeviceQueueCreateInfo> QueueInfos;
+        for (uint32_t FamilyInd = 0; FamilyInd < FamilyQueueCount.size(); ++FamilyInd)
+        {
+            if (FamilyQueueCount[FamilyInd] == 0)
+                continue;
+
+            VkDeviceQueueCreateInfo QueueInfo{};
+            QueueInfo.sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            QueueInfo.flags            = 0; // reserved for future use
+            QueueInfo.queueFamilyIndex = FamilyInd;
+            QueueInfo.queueCount       = FamilyQueueCount[FamilyInd];
+            QueueInfo.pQueuePriorities = QueuePriorities.data();
+            QueueInfos.push_back(QueueInfo);
+        }
 
         VkDeviceCreateInfo DeviceCreateInfo = {};
         DeviceCreateInfo.sType              = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
         DeviceCreateInfo.flags              = 0; // Reserved for future use
         // https://www.khronos.org/registry/vulkan/specs/1.0/html/vkspec.html#extended-functionality-device-layer-deprecation
-        DeviceCreateInfo.enabledLayerCount       = 0;       // Deprecated and ignored.
-        DeviceCreateInfo.ppEnabledLayerNames     = nullptr; // Deprecated and ignored
-        DeviceCreateInfo.queueCreateInfoCount    = 1;
-        DeviceCreateInfo.pQueueCreateInfos       = &QueueInfo;
-        VkPhysicalDeviceFeatures EnabledFeatures = {};
-        EnabledFeatures.fullDrawIndexUint32      = PhysicalDeviceFeatures.fullDrawIndexUint32;
+        DeviceCreateInfo.enabledLayerCount        = 0;       // Deprecated and ignored.
+        DeviceCreateInfo.ppEnabledLayerNames      = nullptr; // Deprecated and ignored
+        DeviceCreateInfo.queueCreateInfoCount     = static_cast<uint32_t>(QueueInfos.size());
+        DeviceCreateInfo.pQueueCreateInfos        = QueueInfos.data();
+        VkPhysicalDeviceFeatures EnabledFeatures  = {};
+        EnabledFeatures.fullDrawIndexUint32       = PhysicalDeviceFeatures.fullDrawIndexUint32;
+        EnabledFeatures.multiDrawIndirect         = PhysicalDeviceFeatures.multiDrawIndirect;
+        EnabledFeatures.drawIndirectFirstInstance = PhysicalDeviceFeatures.drawIndirectFirstInstance;
 
         auto GetFeatureState = [](DEVICE_FEATURE_STATE RequestedState, bool IsFeatureSupported, const char* FeatureName) //
         {
@@ -249,6 +323,9 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& _E
         // SPIRV 1.5 is in Vulkan 1.2 core
         EnabledExtFeats.Spirv15 = DeviceExtFeatures.Spirv15;
 
+        // Descriptor update templates are in Vulkan 1.1 core
+        EnabledExtFeats.DescriptorUpdateTemplate = DeviceExtFeatures.DescriptorUpdateTemplate;
+
 #define ENABLE_FEATURE(IsFeatureSupported, Feature, FeatureName)                         \
     do                                                                                   \
     {                                                                                    \
@@ -447,6 +524,17 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& _E
                 NextExt  = &EnabledExtFeats.BufferDeviceAddress.pNext;
             }
 
+            // Timeline semaphores replace binary fences in FenceVkImpl and CommandQueueVkImpl
+            if (DeviceExtFeatures.TimelineSemaphore.timelineSemaphore != VK_FALSE)
+            {
+                DeviceExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+
+                EnabledExtFeats.TimelineSemaphore = DeviceExtFeatures.TimelineSemaphore;
+
+                *NextExt = &EnabledExtFeats.TimelineSemaphore;
+                NextExt  = &EnabledExtFeats.TimelineSemaphore.pNext;
+            }
+
             // make sure that last pNext is null
             *NextExt = nullptr;
         }
@@ -463,23 +551,41 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& _E
 
         auto& RawMemAllocator = GetRawAllocator();
 
-        RefCntAutoPtr<CommandQueueVkImpl> pCmdQueueVk{
-            NEW_RC_OBJ(RawMemAllocator, "CommandQueueVk instance", CommandQueueVkImpl)(LogicalDevice, QueueInfo.queueFamilyIndex)};
+        std::vector<RefCntAutoPtr<CommandQueueVkImpl>> CmdQueuesVk;
+        std::vector<ICommandQueueVk*>                  CommandQueues;
+        for (const auto& Location : CmdQueueLocations)
+        {
+            RefCntAutoPtr<CommandQueueVkImpl> pCmdQueueVk{
+                NEW_RC_OBJ(RawMemAllocator, "CommandQueueVk instance", CommandQueueVkImpl)(LogicalDevice, Location.first, Location.second)};
+            CommandQueues.push_back(pCmdQueueVk);
+            CmdQueuesVk.emplace_back(std::move(pCmdQueueVk));
+        }
 
         OnRenderDeviceCreated = [&](RenderDeviceVkImpl* pRenderDeviceVk) //
         {
-            FenceDesc Desc;
-            Desc.Name = "Command queue internal fence";
-            // Render device owns command queue that in turn owns the fence, so it is an internal device object
-            constexpr bool IsDeviceInternal = true;
-
-            RefCntAutoPtr<FenceVkImpl> pFenceVk{
-                NEW_RC_OBJ(RawMemAllocator, "FenceVkImpl instance", FenceVkImpl)(pRenderDeviceVk, Desc, IsDeviceInternal)};
-            pCmdQueueVk->SetFence(std::move(pFenceVk));
+            for (auto& pCmdQueueVk : CmdQueuesVk)
+            {
+                FenceDesc Desc;
+                Desc.Name = "Command queue internal fence";
+                // Render device owns command queue that in turn owns the fence, so it is an internal device object
+                constexpr bool IsDeviceInternal = true;
+
+                RefCntAutoPtr<FenceVkImpl> pFenceVk{
+                    NEW_RC_OBJ(RawMemAllocator, "FenceVkImpl instance", FenceVkImpl)(pRenderDeviceVk, Desc, IsDeviceInternal)};
+                pCmdQueueVk->SetFence(std::move(pFenceVk));
+            }
         };
 
-        std::array<ICommandQueueVk*, 1> CommandQueues = {{pCmdQueueVk}};
         AttachToVulkanDevice(Instance, std::move(PhysicalDevice), LogicalDevice, CommandQueues.size(), CommandQueues.data(), EngineCI, ppDevice, ppContexts);
+
+        if (EngineCI.EnableAsyncComputeQueue && !AsyncComputeQueueFound && TransferQueueFound)
+        {
+            // Contexts of additional queues are written contiguously, but the slot of
+            // the async compute context must be kept even if the context was not created.
+            auto* const pExtraContexts = ppContexts + 1 + EngineCI.NumDeferredContexts;
+            pExtraContexts[1]          = pExtraContexts[0];
+            pExtraContexts[0]          = nullptr;
+        }
     }
     catch (std::runtime_error&)
     {
@@ -500,6 +606,8 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& _E
 ///                           the contexts will be written. Immediate context goes at
 ///                           position 0. If EngineCI.NumDeferredContexts > 0,
 ///                           pointers to the deferred contexts are written afterwards.
+///                           If CommandQueueCount > 1, pointers to the immediate contexts
+///                           of the command queues 1, 2, ... are written at the end.
 void EngineFactoryVkImpl::AttachToVulkanDevice(std::shared_ptr<VulkanUtilities::VulkanInstance>       Instance,
                                                std::unique_ptr<VulkanUtilities::VulkanPhysicalDevice> PhysicalDevice,
                                                std::shared_ptr<VulkanUtilities::VulkanLogicalDevice>  LogicalDevice,
@@ -523,7 +631,8 @@ void EngineFactoryVkImpl::AttachToVulkanDevice(std::shared_ptr<VulkanUtilities::
         return;
 
     *ppDevice = nullptr;
-    memset(ppContexts, 0, sizeof(*ppContexts) * (1 + EngineCI.NumDeferredContexts));
+    const size_t NumContexts = EngineCI.NumDeferredContexts + CommandQueueCount;
+    memset(ppContexts, 0, sizeof(*ppContexts) * NumContexts);
 
     try
     {
@@ -551,6 +660,16 @@ void EngineFactoryVkImpl::AttachToVulkanDevice(std::shared_ptr<VulkanUtilities::
             pDeferredCtxVk->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts + 1 + DeferredCtx));
             pRenderDeviceVk->SetDeferredContext(DeferredCtx, pDeferredCtxVk);
         }
+
+        // Immediate contexts of additional command queues go after deferred contexts and
+        // use context ids that follow deferred context ids.
+        for (Uint32 QueueIndex = 1; QueueIndex < CommandQueueCount; ++QueueIndex)
+        {
+            const Uint32 ContextId = EngineCI.NumDeferredContexts + QueueIndex;
+
+            RefCntAutoPtr<DeviceContextVkImpl> pQueueCtxVk(NEW_RC_OBJ(RawMemAllocator, "DeviceContextVkImpl instance", DeviceContextVkImpl)(pRenderDeviceVk, false, EngineCI, ContextId, QueueIndex, GenerateMipsHelper));
+            pQueueCtxVk->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts + ContextId));
+        }
     }
     catch (const std::runtime_error&)
     {
@@ -559,7 +678,7 @@ void EngineFactoryVkImpl::AttachToVulkanDevice(std::shared_ptr<VulkanUtilities::
             (*ppDevice)->Release();
             *ppDevice = nullptr;
         }
-        for (Uint32 ctx = 0; ctx < 1 + EngineCI.NumDeferredContexts; ++ctx)
+        for (size_t ctx = 0; ctx < NumContexts; ++ctx)
         {
             if (ppContexts[ctx] != nullptr)
             {
@@ -27,6 +27,8 @@
 
 #include "pch.h"
 
+#include <algorithm>
+
 #include "FenceVkImpl.hpp"
 #include "EngineMemory.h"
 #include "RenderDeviceVkImpl.hpp"
@@ -49,10 +51,36 @@ FenceVkImpl::FenceVkImpl(IReferenceCounters* pRefCounters,
     m_FencePool{pRendeDeviceVkImpl->GetLogicalDevice().GetSharedPtr()}
 // clang-format on
 {
+    const auto& LogicalDevice = pRendeDeviceVkImpl->GetLogicalDevice();
+    if (LogicalDevice.GetEnabledExtFeatures().TimelineSemaphore.timelineSemaphore != VK_FALSE)
+    {
+        VkSemaphoreTypeCreateInfoKHR TimelineCI = {};
+
+        TimelineCI.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        TimelineCI.pNext         = nullptr;
+        TimelineCI.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        TimelineCI.initialValue  = 0;
+
+        VkSemaphoreCreateInfo SemaphoreCI = {};
+
+        SemaphoreCI.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        SemaphoreCI.pNext = &TimelineCI;
+        SemaphoreCI.flags = 0; // reserved for future use
+
+        m_TimelineSemaphore = LogicalDevice.CreateSemaphore(SemaphoreCI, m_Desc.Name);
+    }
 }
 
 FenceVkImpl::~FenceVkImpl()
 {
+    if (IsTimelineSemaphore())
+    {
+        // All queue submissions that signal the semaphore must complete before it is destroyed
+        // (https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#VUID-vkDestroySemaphore-semaphore-01137)
+        Wait(UINT64_MAX);
+        return;
+    }
+
     if (!m_PendingFences.empty())
     {
         LOG_INFO_MESSAGE("FenceVkImpl::~FenceVkImpl(): waiting for ", m_PendingFences.size(), " pending Vulkan ",
@@ -64,8 +92,36 @@ FenceVkImpl::~FenceVkImpl()
     }
 }
 
+Uint64 FenceVkImpl::GetTimelineSemaphoreValue() const
+{
+    VERIFY_EXPR(IsTimelineSemaphore());
+
+    uint64_t SemaphoreValue = 0;
+
+    auto err = m_pDevice->GetLogicalDevice().GetSemaphoreCounter(m_TimelineSemaphore, &SemaphoreValue);
+    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to get timeline semaphore counter value");
+    (void)err;
+
+    return SemaphoreValue;
+}
+
+void FenceVkImpl::AddPendingTimelineSignal(Uint64 FenceValue)
+{
+    VERIFY_EXPR(IsTimelineSemaphore());
+    DEV_CHECK_ERR(FenceValue > m_LastSignaledValue, "Timeline semaphore of fence '", m_Desc.Name, "' must be signaled with strictly increasing values: ",
+                  FenceValue, " is not greater than the previously signaled value (", m_LastSignaledValue.load(), ")");
+    if (FenceValue > m_LastSignaledValue)
+        m_LastSignaledValue = FenceValue;
+}
+
 Uint64 FenceVkImpl::GetCompletedValue()
 {
+    if (IsTimelineSemaphore())
+    {
+        const auto SemaphoreValue = GetTimelineSemaphoreValue();
+        return std::max(SemaphoreValue, static_cast<Uint64>(m_LastCompletedFenceValue));
+    }
+
     const auto& LogicalDevice = m_pDevice->GetLogicalDevice();
     while (!m_PendingFences.empty())
     {
@@ -91,6 +147,29 @@ Uint64 FenceVkImpl::GetCompletedValue()
 void FenceVkImpl::Reset(Uint64 Value)
 {
     DEV_CHECK_ERR(Value >= m_LastCompletedFenceValue, "Resetting fence '", m_Desc.Name, "' to the value (", Value, ") that is smaller than the last completed value (", m_LastCompletedFenceValue, ")");
+
+    if (IsTimelineSemaphore())
+    {
+        // A timeline semaphore can only be signaled from the host with a value that is greater than
+        // its current value and smaller than the values of all pending signal operations.
+        const auto SemaphoreValue = GetTimelineSemaphoreValue();
+        if (SemaphoreValue >= m_LastSignaledValue && Value > SemaphoreValue)
+        {
+            VkSemaphoreSignalInfoKHR SignalInfo = {};
+
+            SignalInfo.sType     = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO_KHR;
+            SignalInfo.pNext     = nullptr;
+            SignalInfo.semaphore = m_TimelineSemaphore;
+            SignalInfo.value     = Value;
+
+            auto err = m_pDevice->GetLogicalDevice().SignalSemaphore(SignalInfo);
+            DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to signal timeline semaphore");
+            (void)err;
+
+            m_LastSignaledValue = Value;
+        }
+    }
+
     if (Value > m_LastCompletedFenceValue)
         m_LastCompletedFenceValue = Value;
 }
@@ -98,6 +177,30 @@ void FenceVkImpl::Reset(Uint64 Value)
 
 void FenceVkImpl::Wait(Uint64 Value)
 {
+    if (IsTimelineSemaphore())
+    {
+        // Do not wait for the values that have not been submitted to the GPU as this may never complete.
+        Value = std::min(Value, m_LastSignaledValue.load());
+        if (Value <= m_LastCompletedFenceValue || Value <= GetTimelineSemaphoreValue())
+            return;
+
+        uint64_t WaitValue = Value;
+
+        VkSemaphoreWaitInfoKHR WaitInfo = {};
+
+        WaitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+        WaitInfo.pNext          = nullptr;
+        WaitInfo.flags          = 0;
+        WaitInfo.semaphoreCount = 1;
+        WaitInfo.pSemaphores    = &m_TimelineSemaphore;
+        WaitInfo.pValues        = &WaitValue;
+
+        auto err = m_pDevice->GetLogicalDevice().WaitSemaphores(WaitInfo, UINT64_MAX);
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to wait for timeline semaphore");
+        (void)err;
+        return;
+    }
+
     const auto& LogicalDevice = m_pDevice->GetLogicalDevice();
     while (!m_PendingFences.empty())
     {
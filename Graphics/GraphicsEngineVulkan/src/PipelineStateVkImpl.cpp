@@ -163,7 +163,7 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
     PipelineCI.stage  = Stages[0];
     PipelineCI.layout = Layout.GetVkPipelineLayout();
 
-    Pipeline = LogicalDevice.CreateComputePipeline(PipelineCI, VK_NULL_HANDLE, PSODesc.Name);
+    Pipeline = LogicalDevice.CreateComputePipeline(PipelineCI, pDeviceVk->GetVkPipelineCache(), PSODesc.Name);
 }
 
 
@@ -347,7 +347,7 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, VK_NULL_HANDLE, PSODesc.Name);
+    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, pDeviceVk->GetVkPipelineCache(), PSODesc.Name);
 }
 
 
@@ -381,7 +381,7 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
     PipelineCI.basePipelineHandle           = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex            = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateRayTracingPipeline(PipelineCI, VK_NULL_HANDLE, PSODesc.Name);
+    Pipeline = LogicalDevice.CreateRayTracingPipeline(PipelineCI, pDeviceVk->GetVkPipelineCache(), PSODesc.Name);
 }
 
 
@@ -629,6 +629,9 @@ void PipelineStateVkImpl::InitResourceLayouts(const PipelineStateCreateInfo& Cre
                                        (CreateInfo.Flags & PSO_CREATE_FLAG_IGNORE_MISSING_IMMUTABLE_SAMPLERS) == 0);
     m_PipelineLayout.Finalize(LogicalDevice);
 
+    if (LogicalDevice.GetEnabledExtFeatures().DescriptorUpdateTemplate)
+        CreateDescriptorUpdateTemplate(LogicalDevice);
+
     if (m_Desc.SRBAllocationGranularity > 1)
     {
         std::array<size_t, MAX_SHADERS_IN_PIPELINE> ShaderVariableDataSizes = {};
@@ -663,6 +666,37 @@ void PipelineStateVkImpl::InitResourceLayouts(const PipelineStateCreateInfo& Cre
     m_ShaderResourceLayoutHash = m_PipelineLayout.GetHash();
 }
 
+void PipelineStateVkImpl::CreateDescriptorUpdateTemplate(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice)
+{
+    if (m_PipelineLayout.GetStaticMutableDescriptorSetIndex() < 0)
+        return;
+
+    std::vector<VkDescriptorUpdateTemplateEntry> Entries;
+
+    m_NumDescrUpdateTemplateDescriptors = 0;
+    for (Uint32 s = 0; s < GetNumShaderStages(); ++s)
+        m_NumDescrUpdateTemplateDescriptors += m_ShaderResourceLayouts[s].GetDescriptorUpdateTemplateEntries(Entries);
+
+    if (Entries.empty())
+        return;
+
+    VkDescriptorUpdateTemplateCreateInfo TemplateCI = {};
+
+    TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    TemplateCI.pNext                      = nullptr;
+    TemplateCI.flags                      = 0;
+    TemplateCI.descriptorUpdateEntryCount = static_cast<uint32_t>(Entries.size());
+    TemplateCI.pDescriptorUpdateEntries   = Entries.data();
+    TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    TemplateCI.descriptorSetLayout        = m_PipelineLayout.GetStaticMutableDescriptorSetVkLayout();
+    // pipelineBindPoint, pipelineLayout and set are ignored for VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
+    TemplateCI.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    TemplateCI.pipelineLayout    = VK_NULL_HANDLE;
+    TemplateCI.set               = 0;
+
+    m_DescrUpdateTemplate = LogicalDevice.CreateDescriptorUpdateTemplate(TemplateCI, m_Desc.Name);
+}
+
 template <typename PSOCreateInfoType>
 PipelineStateVkImpl::TShaderStages PipelineStateVkImpl::InitInternalObjects(
     const PSOCreateInfoType&                           CreateInfo,
@@ -674,6 +708,16 @@ PipelineStateVkImpl::TShaderStages PipelineStateVkImpl::InitInternalObjects(
     TShaderStages ShaderStages;
     ExtractShaders<ShaderVkImpl>(CreateInfo, ShaderStages);
 
+    // Shaders may still be being compiled asynchronously
+    for (const auto& Stage : ShaderStages)
+    {
+        for (const auto* pShader : Stage.Shaders)
+        {
+            if (pShader->GetStatus(true) != SHADER_STATUS_READY)
+                LOG_ERROR_AND_THROW("Shader '", pShader->GetDesc().Name, "' failed to compile: ", pShader->GetCompilationError());
+        }
+    }
+
     FixedLinearAllocator MemPool{GetRawAllocator()};
 
     const auto NumShaderStages = GetNumShaderStages();
@@ -804,6 +848,7 @@ void PipelineStateVkImpl::Destruct()
     TPipelineStateBase::Destruct();
 
     m_pDevice->SafeReleaseDeviceObject(std::move(m_Pipeline), m_Desc.CommandQueueMask);
+    m_pDevice->SafeReleaseDeviceObject(std::move(m_DescrUpdateTemplate), m_Desc.CommandQueueMask);
     m_PipelineLayout.Release(m_pDevice, m_Desc.CommandQueueMask);
 
     auto& RawAllocator = GetRawAllocator();
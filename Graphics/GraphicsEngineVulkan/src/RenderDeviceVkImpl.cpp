@@ -43,10 +43,24 @@
 #include "TopLevelASVkImpl.hpp"
 #include "ShaderBindingTableVkImpl.hpp"
 #include "EngineMemory.h"
+#include "DataBlobImpl.hpp"
+#include "FileWrapper.hpp"
 
 namespace Diligent
 {
 
+static std::vector<uint32_t> GetDistinctQueueFamilies(size_t CommandQueueCount, ICommandQueueVk** CmdQueues)
+{
+    std::vector<uint32_t> QueueFamilies;
+    for (size_t q = 0; q < CommandQueueCount; ++q)
+    {
+        const auto FamilyIndex = CmdQueues[q]->GetQueueFamilyIndex();
+        if (std::find(QueueFamilies.begin(), QueueFamilies.end(), FamilyIndex) == QueueFamilies.end())
+            QueueFamilies.push_back(FamilyIndex);
+    }
+    return QueueFamilies;
+}
+
 RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*                                    pRefCounters,
                                        IMemoryAllocator&                                      RawMemAllocator,
                                        IEngineFactory*                                        pEngineFactory,
@@ -62,6 +76,7 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         pRefCounters,
         RawMemAllocator,
         pEngineFactory,
+        EngineCI,
         CommandQueueCount,
         CmdQueues,
         EngineCI.NumDeferredContexts,
@@ -88,6 +103,7 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     m_PhysicalDevice         {std::move(PhysicalDevice)},
     m_LogicalVkDevice        {std::move(LogicalDevice) },
     m_EngineAttribs          {EngineCI                 },
+    m_QueueFamilyIndices     {GetDistinctQueueFamilies(CommandQueueCount, CmdQueues)},
     m_FramebufferCache       {*this                    },
     m_ImplicitRenderPassCache{*this                    },
     m_DescriptorSetAllocator
@@ -274,6 +290,20 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     SamCaps.BorderSamplingModeSupported   = True;
     SamCaps.AnisotropicFilteringSupported = vkEnabledFeatures.samplerAnisotropy;
     SamCaps.LODBiasSupported              = True;
+
+    InitPipelineCache(EngineCI);
+
+    if (EngineCI.SPIRVCacheDirectory != nullptr)
+    {
+        try
+        {
+            m_pSPIRVCache.reset(new SPIRVCache{EngineCI.SPIRVCacheDirectory});
+        }
+        catch (...)
+        {
+            LOG_WARNING_MESSAGE("Failed to open SPIR-V cache in '", EngineCI.SPIRVCacheDirectory, "'. Shaders will not be cached.");
+        }
+    }
 }
 
 RenderDeviceVkImpl::~RenderDeviceVkImpl()
@@ -290,6 +320,8 @@ RenderDeviceVkImpl::~RenderDeviceVkImpl()
 
     ReleaseStaleResources(true);
 
+    SavePipelineCache();
+
     DEV_CHECK_ERR(m_DescriptorSetAllocator.GetAllocatedDescriptorSetCounter() == 0, "All allocated descriptor sets must have been released now.");
     DEV_CHECK_ERR(m_TransientCmdPoolMgr.GetAllocatedPoolCount() == 0, "All allocated transient command pools must have been released now. If there are outstanding references to the pools in release queues, the app will crash when CommandPoolManager::FreeCommandPool() is called.");
     DEV_CHECK_ERR(m_DynamicDescriptorPool.GetAllocatedPoolCounter() == 0, "All allocated dynamic descriptor pools must have been released now.");
@@ -310,6 +342,134 @@ RenderDeviceVkImpl::~RenderDeviceVkImpl()
 }
 
 
+static bool IsPipelineCacheDataCompatible(const void* pData, size_t DataSize, const VkPhysicalDeviceProperties& DeviceProps)
+{
+    // Every pipeline cache starts with the header defined by the Vulkan spec
+    // (10.6. Pipeline Cache, VkPipelineCacheHeaderVersionOne):
+    //   uint32_t headerSize
+    //   uint32_t headerVersion
+    //   uint32_t vendorID
+    //   uint32_t deviceID
+    //   uint8_t  pipelineCacheUUID[VK_UUID_SIZE]
+    constexpr size_t HeaderSize = sizeof(uint32_t) * 4 + VK_UUID_SIZE;
+    if (pData == nullptr || DataSize < HeaderSize)
+        return false;
+
+    uint32_t Header[4] = {};
+    memcpy(Header, pData, sizeof(Header));
+    if (Header[0] < HeaderSize || Header[0] > DataSize)
+        return false;
+
+    if (Header[1] != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+        Header[2] != DeviceProps.vendorID ||
+        Header[3] != DeviceProps.deviceID)
+        return false;
+
+    return memcmp(reinterpret_cast<const Uint8*>(pData) + sizeof(Header), DeviceProps.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+void RenderDeviceVkImpl::InitPipelineCache(const EngineVkCreateInfo& EngineCI)
+{
+    const void* pInitialData    = EngineCI.pPipelineCacheData;
+    size_t      InitialDataSize = EngineCI.PipelineCacheDataSize;
+
+    RefCntAutoPtr<IDataBlob> pFileData;
+    if (EngineCI.PipelineCacheFilePath != nullptr && *EngineCI.PipelineCacheFilePath != 0)
+    {
+        m_PipelineCacheFilePath = EngineCI.PipelineCacheFilePath;
+        if (FileSystem::FileExists(m_PipelineCacheFilePath.c_str()))
+        {
+            FileWrapper CacheFile{m_PipelineCacheFilePath.c_str(), EFileAccessMode::Read};
+            if (CacheFile)
+            {
+                pFileData = MakeNewRCObj<DataBlobImpl>{}(0);
+                CacheFile->Read(pFileData);
+                pInitialData    = pFileData->GetConstDataPtr();
+                InitialDataSize = pFileData->GetSize();
+            }
+            else
+            {
+                LOG_WARNING_MESSAGE("Failed to open pipeline cache file '", m_PipelineCacheFilePath, "'");
+            }
+        }
+    }
+
+    if (pInitialData != nullptr && !IsPipelineCacheDataCompatible(pInitialData, InitialDataSize, m_PhysicalDevice->GetProperties()))
+    {
+        LOG_INFO_MESSAGE("Pipeline cache data was created by a different device or driver version and will be ignored");
+        pInitialData    = nullptr;
+        InitialDataSize = 0;
+    }
+
+    VkPipelineCacheCreateInfo PipelineCacheCI = {};
+
+    PipelineCacheCI.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    PipelineCacheCI.pNext           = nullptr;
+    PipelineCacheCI.flags           = 0;
+    PipelineCacheCI.initialDataSize = InitialDataSize;
+    PipelineCacheCI.pInitialData    = pInitialData;
+
+    m_PipelineCache = m_LogicalVkDevice->CreatePipelineCache(PipelineCacheCI, "Main pipeline cache");
+}
+
+void RenderDeviceVkImpl::GetSPIRVCacheStatistics(SPIRVCacheStatistics& Stats)
+{
+    Stats = SPIRVCacheStatistics{};
+    if (!m_pSPIRVCache)
+        return;
+
+    const auto CacheStats = m_pSPIRVCache->GetStatistics();
+    Stats.NumHits         = CacheStats.NumHits;
+    Stats.NumMisses       = CacheStats.NumMisses;
+    Stats.NumEntries      = CacheStats.NumEntries;
+    Stats.DataSize        = CacheStats.DataSize;
+}
+
+void RenderDeviceVkImpl::GetPipelineCacheData(IDataBlob** ppData)
+{
+    DEV_CHECK_ERR(ppData != nullptr, "ppData must not be null");
+    DEV_CHECK_ERR(*ppData == nullptr, "Overwriting reference to an existing object may result in memory leaks");
+
+    size_t DataSize = 0;
+
+    auto err = m_LogicalVkDevice->GetPipelineCacheData(m_PipelineCache, &DataSize, nullptr);
+    if (err != VK_SUCCESS)
+    {
+        LOG_ERROR_MESSAGE("Failed to get pipeline cache data size");
+        return;
+    }
+
+    RefCntAutoPtr<DataBlobImpl> pDataBlob{MakeNewRCObj<DataBlobImpl>{}(DataSize)};
+    // The cache may grow between the two calls, in which case VK_INCOMPLETE is returned
+    // and DataSize contains the number of bytes actually written.
+    err = m_LogicalVkDevice->GetPipelineCacheData(m_PipelineCache, &DataSize, pDataBlob->GetDataPtr());
+    if (err != VK_SUCCESS && err != VK_INCOMPLETE)
+    {
+        LOG_ERROR_MESSAGE("Failed to get pipeline cache data");
+        return;
+    }
+    pDataBlob->Resize(DataSize);
+
+    *ppData = pDataBlob.Detach();
+}
+
+void RenderDeviceVkImpl::SavePipelineCache()
+{
+    if (m_PipelineCacheFilePath.empty() || m_PipelineCache == VK_NULL_HANDLE)
+        return;
+
+    RefCntAutoPtr<IDataBlob> pCacheData;
+    GetPipelineCacheData(&pCacheData);
+    if (!pCacheData)
+        return;
+
+    FileWrapper CacheFile{m_PipelineCacheFilePath.c_str(), EFileAccessMode::Overwrite};
+    if (!CacheFile || !CacheFile->Write(pCacheData->GetConstDataPtr(), pCacheData->GetSize()))
+    {
+        LOG_WARNING_MESSAGE("Failed to save pipeline cache to file '", m_PipelineCacheFilePath, "'");
+    }
+}
+
 void RenderDeviceVkImpl::AllocateTransientCmdPool(VulkanUtilities::CommandPoolWrapper& CmdPool, VkCommandBuffer& vkCmdBuff, const Char* DebugPoolName)
 {
     CmdPool = m_TransientCmdPoolMgr.AllocateCommandPool(DebugPoolName);
@@ -407,7 +567,11 @@ void RenderDeviceVkImpl::SubmitCommandBuffer(Uint32
         for (auto& val_fence : *pFences)
         {
             auto* pFenceVkImpl = val_fence.second.RawPtr<FenceVkImpl>();
-            auto  vkFence      = pFenceVkImpl->GetVkFence();
+            // Timeline semaphores are signaled by the submitted batch itself (see DeviceContextVkImpl::Flush())
+            if (pFenceVkImpl->IsTimelineSemaphore())
+                continue;
+
+            auto vkFence = pFenceVkImpl->GetVkFence();
             m_CommandQueues[QueueIndex].CmdQueue->SignalFence(vkFence);
             pFenceVkImpl->AddPendingFence(std::move(vkFence), val_fence.first);
         }
@@ -572,9 +736,15 @@ void RenderDeviceVkImpl::CreatePipelineState(const PSOCreateInfoType& PSOCreateI
         "Pipeline State", PSOCreateInfo.PSODesc, ppPipelineState,
         [&]() //
         {
-            PipelineStateVkImpl* pPipelineStateVk(NEW_RC_OBJ(m_PSOAllocator, "PipelineStateVkImpl instance", PipelineStateVkImpl)(this, PSOCreateInfo));
-            pPipelineStateVk->QueryInterface(IID_PipelineState, reinterpret_cast<IObject**>(ppPipelineState));
-            OnCreateDeviceObject(pPipelineStateVk);
+            FindOrCreatePipelineState<ShaderVkImpl>(
+                PSOCreateInfo, ppPipelineState,
+                [&]() //
+                {
+                    PipelineStateVkImpl* pPipelineStateVk(NEW_RC_OBJ(m_PSOAllocator, "PipelineStateVkImpl instance", PipelineStateVkImpl)(this, PSOCreateInfo));
+                    pPipelineStateVk->QueryInterface(IID_PipelineState, reinterpret_cast<IObject**>(ppPipelineState));
+                    OnCreateDeviceObject(pPipelineStateVk);
+                } //
+            );
         } //
     );
 }
@@ -639,6 +809,16 @@ void RenderDeviceVkImpl::CreateShader(const ShaderCreateInfo& ShaderCI, IShader*
     );
 }
 
+ThreadingTools::ThreadPool& RenderDeviceVkImpl::GetShaderCompilationThreadPool()
+{
+    std::call_once(m_ShaderCompilationThreadPoolInitFlag,
+                   [this]() {
+                       m_pShaderCompilationThreadPool.reset(new ThreadingTools::ThreadPool{m_EngineAttribs.NumAsyncShaderCompilationThreads});
+                       LOG_INFO_MESSAGE("Started ", m_pShaderCompilationThreadPool->GetNumThreads(), " asynchronous shader compilation thread(s)");
+                   });
+    return *m_pShaderCompilationThreadPool;
+}
+
 
 void RenderDeviceVkImpl::CreateTextureFromVulkanImage(VkImage vkImage, const TextureDesc& TexDesc, RESOURCE_STATE InitialState, ITexture** ppTexture)
 {
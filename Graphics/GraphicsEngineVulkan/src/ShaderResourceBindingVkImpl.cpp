@@ -171,6 +171,88 @@ IShaderResourceVariable* ShaderResourceBindingVkImpl::GetVariableByIndex(SHADER_
     return m_pShaderVarMgrs[ResLayoutInd].GetVariable(Index);
 }
 
+void ShaderResourceBindingVkImpl::SetVariables(Uint32 NumVariables, const ShaderResourceVariableBinding* pVariables)
+{
+    const auto SetIndex = m_pPSO->GetPipelineLayout().GetStaticMutableDescriptorSetIndex();
+    if (SetIndex < 0)
+    {
+        // There are only dynamic variables, which are written when resources are committed
+        TBase::SetVariables(NumVariables, pVariables);
+        return;
+    }
+
+    DEV_CHECK_ERR(NumVariables == 0 || pVariables != nullptr, "pVariables must not be null");
+
+    auto&      DescrSet   = m_ShaderResourceCache.GetDescriptorSet(SetIndex);
+    const auto vkDescrSet = DescrSet.GetVkDescriptorSet();
+    const auto SetSize    = DescrSet.GetSize();
+
+    // Static and mutable resources can't be rebound, so only the descriptors that are not bound
+    // now will need to be written
+    std::vector<bool> IsNewlyBound(SetSize);
+    for (Uint32 i = 0; i < SetSize; ++i)
+        IsNewlyBound[i] = !DescrSet.GetResource(i).pObject;
+
+    for (Uint32 i = 0; i < NumVariables; ++i)
+    {
+        const auto& Var  = pVariables[i];
+        auto*       pVar = GetVariableByName(Var.ShaderType, Var.Name);
+        if (pVar == nullptr)
+        {
+            LOG_ERROR_MESSAGE("Unable to find mutable/dynamic variable '", Var.Name, "' in shader stage ", GetShaderTypeLiteralName(Var.ShaderType),
+                              " of shader resource binding of PSO '", m_pPSO->GetDesc().Name, "'.");
+            continue;
+        }
+
+        const auto& Res = ValidatedCast<ShaderVariableVkImpl>(pVar)->GetResource();
+        if (Var.ArrayIndex >= Res.ArraySize)
+        {
+            LOG_ERROR_MESSAGE("Array index (", Var.ArrayIndex, ") is out of range for variable '", Var.Name, "' of size ", Res.ArraySize);
+            continue;
+        }
+
+        // Descriptors are written below in one batch
+        Res.BindResource(Var.pObject, Var.ArrayIndex, m_ShaderResourceCache, false);
+    }
+
+    Uint32 NumNewlyBound = 0;
+    for (Uint32 i = 0; i < SetSize; ++i)
+    {
+        if (IsNewlyBound[i] && DescrSet.GetResource(i).pObject)
+            ++NumNewlyBound;
+        else
+            IsNewlyBound[i] = false;
+    }
+    if (NumNewlyBound == 0)
+        return;
+
+    const auto& LogicalDevice = m_pPSO->GetDevice()->GetLogicalDevice();
+
+    std::vector<ShaderResourceLayoutVk::DescriptorUpdateTemplateData> DescrData(SetSize);
+
+    // The template writes every mutable descriptor, so it can only be used when all of them
+    // have been bound by this call. Only mutable variables are accessible through the SRB.
+    const auto vkTemplate = m_pPSO->GetVkDescriptorUpdateTemplate();
+    if (vkTemplate != VK_NULL_HANDLE && NumNewlyBound == m_pPSO->GetNumDescriptorUpdateTemplateDescriptors())
+    {
+        for (Uint32 s = 0; s < m_NumShaders; ++s)
+            m_pPSO->GetShaderResLayout(s).WriteNewlyBoundDescriptors(m_ShaderResourceCache, IsNewlyBound, vkDescrSet, DescrData.data(), nullptr, nullptr);
+
+        LogicalDevice.UpdateDescriptorSetWithTemplate(vkDescrSet, vkTemplate, DescrData.data());
+    }
+    else
+    {
+        std::vector<VkWriteDescriptorSetAccelerationStructureKHR> AccelStructInfo(SetSize);
+        std::vector<VkWriteDescriptorSet>                         Writes;
+        Writes.reserve(NumNewlyBound);
+        for (Uint32 s = 0; s < m_NumShaders; ++s)
+            m_pPSO->GetShaderResLayout(s).WriteNewlyBoundDescriptors(m_ShaderResourceCache, IsNewlyBound, vkDescrSet, DescrData.data(), AccelStructInfo.data(), &Writes);
+
+        VERIFY_EXPR(Writes.size() == NumNewlyBound);
+        LogicalDevice.UpdateDescriptorSets(static_cast<uint32_t>(Writes.size()), Writes.data(), 0, nullptr);
+    }
+}
+
 void ShaderResourceBindingVkImpl::InitializeStaticResources(const IPipelineState* pPipelineState)
 {
     if (StaticResourcesInitialized())
@@ -1170,7 +1170,7 @@ void ShaderResourceLayoutVk::VkResource::CacheAccelerationStructure(IDeviceObjec
     }
 }
 
-void ShaderResourceLayoutVk::VkResource::BindResource(IDeviceObject* pObj, Uint32 ArrayIndex, ShaderResourceCacheVk& ResourceCache) const
+void ShaderResourceLayoutVk::VkResource::BindResource(IDeviceObject* pObj, Uint32 ArrayIndex, ShaderResourceCacheVk& ResourceCache, bool WriteDescriptor) const
 {
     VERIFY_EXPR(ArrayIndex < ArraySize);
 
@@ -1194,6 +1194,12 @@ void ShaderResourceLayoutVk::VkResource::BindResource(IDeviceObject* pObj, Uint3
         UNEXPECTED("Unexpected shader resource cache content type");
     }
 #endif
+    if (!WriteDescriptor)
+    {
+        // Null descriptor set handle makes Cache* methods only update the cache
+        vkDescrSet = VK_NULL_HANDLE;
+    }
+
     auto& DstRes = DstDescrSet.GetResource(CacheOffset + ArrayIndex);
     VERIFY(DstRes.Type == Type, "Inconsistent types");
 
@@ -1230,7 +1236,7 @@ void ShaderResourceLayoutVk::VkResource::BindResource(IDeviceObject* pObj, Uint3
                                              "' must be one or the same as the array size (", ArraySize,
                                              ") of separate image variable '", Name, "' it is assigned to");
                                Uint32 SamplerArrInd = SeparateSampler.ArraySize == 1 ? 0 : ArrayIndex;
-                               SeparateSampler.BindResource(pSampler, SamplerArrInd, ResourceCache);
+                               SeparateSampler.BindResource(pSampler, SamplerArrInd, ResourceCache, WriteDescriptor);
                            });
                 break;
 
@@ -1578,6 +1584,133 @@ void ShaderResourceLayoutVk::CommitDynamicResources(const ShaderResourceCacheVk&
     }
 }
 
+Uint32 ShaderResourceLayoutVk::GetDescriptorUpdateTemplateEntries(std::vector<VkDescriptorUpdateTemplateEntry>& Entries) const
+{
+    Uint32 NumDescriptors = 0;
+    for (Uint32 r = 0; r < m_NumResources[SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE]; ++r)
+    {
+        const auto& Res = GetResource(SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, r);
+
+        // Atomic counters are never bound, and immutable samplers are permanently
+        // bound into the set layout (13.2.1)
+        if (Res.Type == SPIRVShaderResourceAttribs::ResourceType::AtomicCounter ||
+            (Res.Type == SPIRVShaderResourceAttribs::ResourceType::SeparateSampler && Res.IsImmutableSamplerAssigned()))
+            continue;
+
+        VkDescriptorUpdateTemplateEntry Entry;
+        Entry.dstBinding      = Res.Binding;
+        Entry.dstArrayElement = 0;
+        Entry.descriptorCount = Res.ArraySize;
+        Entry.descriptorType  = PipelineLayout::GetVkDescriptorType(Res.Type);
+        Entry.offset          = size_t{Res.CacheOffset} * sizeof(DescriptorUpdateTemplateData);
+        Entry.stride          = sizeof(DescriptorUpdateTemplateData);
+        Entries.push_back(Entry);
+
+        NumDescriptors += Res.ArraySize;
+    }
+    return NumDescriptors;
+}
+
+void ShaderResourceLayoutVk::WriteNewlyBoundDescriptors(const ShaderResourceCacheVk&                  ResourceCache,
+                                                        const std::vector<bool>&                      IsNewlyBound,
+                                                        VkDescriptorSet                               vkDescrSet,
+                                                        DescriptorUpdateTemplateData*                 pData,
+                                                        VkWriteDescriptorSetAccelerationStructureKHR* pAccelStructInfo,
+                                                        std::vector<VkWriteDescriptorSet>*            pWrites) const
+{
+    VERIFY_EXPR(pData != nullptr);
+    VERIFY(pWrites == nullptr || vkDescrSet != VK_NULL_HANDLE, "Vulkan descriptor set must not be null");
+
+    const auto NumStaticAndMutableRes = m_NumResources[SHADER_RESOURCE_VARIABLE_TYPE_STATIC] + m_NumResources[SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE];
+    for (Uint32 r = 0; r < NumStaticAndMutableRes; ++r)
+    {
+        const auto& Res          = GetResource(r);
+        const auto& SetResources = ResourceCache.GetDescriptorSet(Res.DescriptorSet);
+        for (Uint32 ArrElem = 0; ArrElem < Res.ArraySize; ++ArrElem)
+        {
+            const auto Offset = Res.CacheOffset + ArrElem;
+            VERIFY_EXPR(Offset < IsNewlyBound.size());
+            if (!IsNewlyBound[Offset])
+                continue;
+
+            const auto& CachedRes = SetResources.GetResource(Offset);
+            auto&       Data      = pData[Offset];
+
+            VkWriteDescriptorSet WriteDescrSet;
+            WriteDescrSet.sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            WriteDescrSet.pNext            = nullptr;
+            WriteDescrSet.dstSet           = vkDescrSet;
+            WriteDescrSet.dstBinding       = Res.Binding;
+            WriteDescrSet.dstArrayElement  = ArrElem;
+            WriteDescrSet.descriptorCount  = 1;
+            WriteDescrSet.descriptorType   = PipelineLayout::GetVkDescriptorType(Res.Type);
+            WriteDescrSet.pImageInfo       = nullptr;
+            WriteDescrSet.pBufferInfo      = nullptr;
+            WriteDescrSet.pTexelBufferView = nullptr;
+
+            static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please handle the new resource type below");
+            switch (Res.Type)
+            {
+                case SPIRVShaderResourceAttribs::ResourceType::UniformBuffer:
+                    Data.BufferInfo           = CachedRes.GetUniformBufferDescriptorWriteInfo();
+                    WriteDescrSet.pBufferInfo = &Data.BufferInfo;
+                    break;
+
+                case SPIRVShaderResourceAttribs::ResourceType::ROStorageBuffer:
+                case SPIRVShaderResourceAttribs::ResourceType::RWStorageBuffer:
+                    Data.BufferInfo           = CachedRes.GetStorageBufferDescriptorWriteInfo();
+                    WriteDescrSet.pBufferInfo = &Data.BufferInfo;
+                    break;
+
+                case SPIRVShaderResourceAttribs::ResourceType::UniformTexelBuffer:
+                case SPIRVShaderResourceAttribs::ResourceType::StorageTexelBuffer:
+                    Data.BufferView                = CachedRes.GetBufferViewWriteInfo();
+                    WriteDescrSet.pTexelBufferView = &Data.BufferView;
+                    break;
+
+                case SPIRVShaderResourceAttribs::ResourceType::SeparateImage:
+                case SPIRVShaderResourceAttribs::ResourceType::StorageImage:
+                case SPIRVShaderResourceAttribs::ResourceType::SampledImage:
+                    Data.ImageInfo           = CachedRes.GetImageDescriptorWriteInfo(Res.IsImmutableSamplerAssigned());
+                    WriteDescrSet.pImageInfo = &Data.ImageInfo;
+                    break;
+
+                case SPIRVShaderResourceAttribs::ResourceType::SeparateSampler:
+                    VERIFY(!Res.IsImmutableSamplerAssigned(), "Immutable samplers can't be bound");
+                    Data.ImageInfo           = CachedRes.GetSamplerDescriptorWriteInfo();
+                    WriteDescrSet.pImageInfo = &Data.ImageInfo;
+                    break;
+
+                case SPIRVShaderResourceAttribs::ResourceType::InputAttachment:
+                    Data.ImageInfo           = CachedRes.GetInputAttachmentDescriptorWriteInfo();
+                    WriteDescrSet.pImageInfo = &Data.ImageInfo;
+                    break;
+
+                case SPIRVShaderResourceAttribs::ResourceType::AccelerationStructure:
+                {
+                    const auto DescrASInfo = CachedRes.GetAccelerationStructureWriteInfo();
+                    Data.AccelStruct       = *DescrASInfo.pAccelerationStructures;
+                    VERIFY(pWrites == nullptr || pAccelStructInfo != nullptr, "Acceleration structure write info array must not be null");
+                    if (pAccelStructInfo != nullptr)
+                    {
+                        auto& ASInfo                   = pAccelStructInfo[Offset];
+                        ASInfo                         = DescrASInfo;
+                        ASInfo.pAccelerationStructures = &Data.AccelStruct;
+                        WriteDescrSet.pNext            = &ASInfo;
+                    }
+                    break;
+                }
+
+                default:
+                    UNEXPECTED("Unexpected resource type");
+            }
+
+            if (pWrites != nullptr)
+                pWrites->push_back(WriteDescrSet);
+        }
+    }
+}
+
 bool ShaderResourceLayoutVk::IsCompatibleWith(const ShaderResourceLayoutVk& ResLayout) const
 {
     if (m_NumResources != ResLayout.m_NumResources)
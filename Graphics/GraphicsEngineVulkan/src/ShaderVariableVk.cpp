@@ -29,6 +29,7 @@
 
 #include "ShaderVariableVk.hpp"
 #include "ShaderResourceVariableBase.hpp"
+#include "Align.hpp"
 
 namespace Diligent
 {
@@ -61,7 +62,12 @@ size_t ShaderVariableManagerVk::GetRequiredMemorySize(const ShaderResourceLayout
         }
     }
 
-    return NumVariables * sizeof(ShaderVariableVkImpl);
+    if (NumVariables == 0)
+        return 0;
+
+    // The name index is placed after the variables
+    return Align(NumVariables * sizeof(ShaderVariableVkImpl), ShaderVariableNameIndex::GetRequiredAlignment()) +
+        ShaderVariableNameIndex::GetRequiredMemorySize(NumVariables);
 }
 
 // Creates shader variable for every resource from SrcLayout whose type is one AllowedVarTypes
@@ -105,6 +111,13 @@ void ShaderVariableManagerVk::Initialize(const ShaderResourceLayoutVk&        Sr
         }
     }
     VERIFY_EXPR(VarInd == m_NumVariables);
+
+    auto* pNameIndexMem = Align(reinterpret_cast<Uint8*>(m_pVariables + m_NumVariables), ShaderVariableNameIndex::GetRequiredAlignment());
+    m_NameIndex.Initialize(pNameIndexMem, m_NumVariables,
+                           [this](Uint32 VarIdx) //
+                           {
+                               return m_pVariables[VarIdx].m_Resource.Name;
+                           });
 }
 
 ShaderVariableManagerVk::~ShaderVariableManagerVk()
@@ -127,18 +140,12 @@ void ShaderVariableManagerVk::DestroyVariables(IMemoryAllocator& Allocator)
 
 ShaderVariableVkImpl* ShaderVariableManagerVk::GetVariable(const Char* Name) const
 {
-    ShaderVariableVkImpl* pVar = nullptr;
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        auto&       Var = m_pVariables[v];
-        const auto& Res = Var.m_Resource;
-        if (strcmp(Res.Name, Name) == 0)
-        {
-            pVar = &Var;
-            break;
-        }
-    }
-    return pVar;
+    const auto VarIdx = m_NameIndex.Find(Name,
+                                         [this](Uint32 Idx) //
+                                         {
+                                             return m_pVariables[Idx].m_Resource.Name;
+                                         });
+    return VarIdx != ShaderVariableNameIndex::InvalidIndex ? m_pVariables + VarIdx : nullptr;
 }
 
 
@@ -55,6 +55,66 @@ ShaderVkImpl::ShaderVkImpl(IReferenceCounters*     pRefCounters,
     }
 // clang-format on
 {
+    if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) != 0)
+    {
+        DEV_CHECK_ERR(ShaderCI.ppCompilerOutput == nullptr || *ShaderCI.ppCompilerOutput == nullptr,
+                      "Compiler output is not available for shaders that are compiled asynchronously");
+
+        // The create info and all data it references may be released as soon as the constructor returns
+        auto pShaderCI = std::make_shared<ShaderCreateInfoWrapper>(ShaderCI);
+
+        m_Status.store(SHADER_STATUS_COMPILING);
+        m_CompileTask = pRenderDeviceVk->GetShaderCompilationThreadPool().Enqueue(
+            [this, pShaderCI]() //
+            {
+                try
+                {
+                    CompileShader(pShaderCI->Get());
+                    m_Status.store(SHADER_STATUS_READY);
+                }
+                catch (const std::exception& Err)
+                {
+                    m_CompilationError = Err.what();
+                    m_Status.store(SHADER_STATUS_FAILED);
+                }
+                catch (...)
+                {
+                    m_CompilationError = "unknown error";
+                    m_Status.store(SHADER_STATUS_FAILED);
+                }
+            }).share();
+    }
+    else
+    {
+        CompileShader(ShaderCI);
+        m_Status.store(SHADER_STATUS_READY);
+    }
+}
+
+ShaderVkImpl::~ShaderVkImpl()
+{
+    // The compilation task references this object
+    WaitForCompletion();
+}
+
+SHADER_STATUS ShaderVkImpl::GetStatus(bool WaitForCompletion) const
+{
+    if (WaitForCompletion)
+        this->WaitForCompletion();
+
+    const auto Status = m_Status.load();
+    if (Status == SHADER_STATUS_FAILED && !m_CompilationErrorReported.exchange(true))
+    {
+        // The error is reported once by the first thread that observes the failure
+        LOG_ERROR_MESSAGE("Failed to compile shader '", m_Desc.Name, "': ", m_CompilationError);
+    }
+    return Status;
+}
+
+void ShaderVkImpl::CompileShader(const ShaderCreateInfo& ShaderCI) noexcept(false)
+{
+    auto* pRenderDeviceVk = GetDevice();
+
     if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
     {
         DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "'ByteCode' must be null when shader is created from source code or a file");
@@ -94,7 +154,7 @@ ShaderVkImpl::ShaderVkImpl(IReferenceCounters*     pRefCounters,
 #else
                 if (ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_HLSL)
                 {
-                    m_SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, VulkanDefine, ShaderCI.ppCompilerOutput);
+                    m_SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, VulkanDefine, ShaderCI.ppCompilerOutput, pRenderDeviceVk->GetSPIRVCache());
                 }
                 else
                 {
@@ -133,7 +193,8 @@ ShaderVkImpl::ShaderVkImpl(IReferenceCounters*     pRefCounters,
                                                         static_cast<int>(SourceLength), Macros,
                                                         ShaderCI.pShaderSourceStreamFactory,
                                                         spvVersion,
-                                                        ShaderCI.ppCompilerOutput);
+                                                        ShaderCI.ppCompilerOutput,
+                                                        pRenderDeviceVk->GetSPIRVCache());
                 }
 #endif
                 break;
@@ -183,6 +244,8 @@ ShaderVkImpl::ShaderVkImpl(IReferenceCounters*     pRefCounters,
     {
         MapHLSLVertexShaderInputs();
     }
+
+    InitContent(ShaderCI, m_SPIRV.data(), m_SPIRV.size() * sizeof(m_SPIRV[0]));
 }
 
 void ShaderVkImpl::MapHLSLVertexShaderInputs()
@@ -216,10 +279,6 @@ void ShaderVkImpl::MapHLSLVertexShaderInputs()
     }
 }
 
-ShaderVkImpl::~ShaderVkImpl()
-{
-}
-
 void ShaderVkImpl::GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const
 {
     auto ResCount = GetResourceCount();
@@ -168,9 +168,8 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
             }
         }
 
-        ImageCI.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-        ImageCI.queueFamilyIndexCount = 0;
-        ImageCI.pQueueFamilyIndices   = nullptr;
+        // Images used by queues from different families are created with concurrent sharing mode
+        pRenderDeviceVk->InitSharingMode(ImageCI, m_Desc.CommandQueueMask);
 
         // initialLayout must be either VK_IMAGE_LAYOUT_UNDEFINED or VK_IMAGE_LAYOUT_PREINITIALIZED (11.4)
         // If it is VK_IMAGE_LAYOUT_PREINITIALIZED, then the image data can be preinitialized by the host
@@ -330,16 +329,18 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
                     // For compressed-block formats, MipInfo.RowSize is the size of one row of blocks
                     VERIFY(SubResData.DepthStride == 0 || SubResData.DepthStride >= (MipInfo.StorageHeight / FmtAttribs.BlockHeight) * MipInfo.RowSize, "Depth stride is too small");
 
-                    for (Uint32 z = 0; z < MipInfo.Depth; ++z)
-                    {
-                        for (Uint32 y = 0; y < MipInfo.StorageHeight; y += FmtAttribs.BlockHeight)
-                        {
-                            memcpy(StagingData + CopyRegion.bufferOffset + ((y + z * MipInfo.StorageHeight) / FmtAttribs.BlockHeight) * MipInfo.RowSize,
-                                   // SubResData.Stride must be the stride of one row of compressed blocks
-                                   reinterpret_cast<const uint8_t*>(SubResData.pData) + (y / FmtAttribs.BlockHeight) * SubResData.Stride + z * SubResData.DepthStride,
-                                   MipInfo.RowSize);
-                        }
-                    }
+                    // SubResData.Stride must be the stride of one row of compressed blocks
+                    const auto NumRows  = MipInfo.StorageHeight / FmtAttribs.BlockHeight;
+                    const auto CopySize = size_t{NumRows} * MipInfo.RowSize * MipInfo.Depth;
+                    CopyTextureSubresource(SubResData,
+                                           NumRows,
+                                           MipInfo.Depth,
+                                           MipInfo.RowSize,
+                                           StagingData + CopyRegion.bufferOffset,
+                                           MipInfo.RowSize,           // DstRowStride
+                                           NumRows * MipInfo.RowSize, // DstDepthStride
+                                           COPY_TEXTURE_SUBRESOURCE_FLAG_WRITE_COMBINED,
+                                           pRenderDeviceVk->GetTextureCopyThreadPool(CopySize));
 
                     ++subres;
                 }
@@ -441,9 +442,7 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
         else
             UNEXPECTED("Unexpected CPU access");
 
-        VkStagingBuffCI.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-        VkStagingBuffCI.queueFamilyIndexCount = 0;
-        VkStagingBuffCI.pQueueFamilyIndices   = nullptr;
+        pRenderDeviceVk->InitSharingMode(VkStagingBuffCI, m_Desc.CommandQueueMask);
 
         std::string StagingBufferName = "Staging buffer for '";
         StagingBufferName += m_Desc.Name;
@@ -483,9 +482,10 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
                                            MipProps.Depth,
                                            MipProps.RowSize,
                                            pStagingData + DstSubresOffset,
-                                           MipProps.RowSize,       // DstRowStride
-                                           MipProps.DepthSliceSize // DstDepthStride
-                    );
+                                           MipProps.RowSize,        // DstRowStride
+                                           MipProps.DepthSliceSize, // DstDepthStride
+                                           COPY_TEXTURE_SUBRESOURCE_FLAG_WRITE_COMBINED,
+                                           pRenderDeviceVk->GetTextureCopyThreadPool(MipProps.MipSize));
                 }
             }
         }
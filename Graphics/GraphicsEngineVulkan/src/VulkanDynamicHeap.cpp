@@ -66,9 +66,8 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
         VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
         VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
         VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
-    VkBuffCI.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-    VkBuffCI.queueFamilyIndexCount = 0;
-    VkBuffCI.pQueueFamilyIndices   = nullptr;
+    // The heap is shared by all contexts that may submit commands to queues from different families
+    DeviceVk.InitSharingMode(VkBuffCI, m_CommandQueueMask);
 
     const auto& LogicalDevice    = DeviceVk.GetLogicalDevice();
     m_VkBuffer                   = LogicalDevice.CreateBuffer(VkBuffCI, "Dynamic heap buffer");
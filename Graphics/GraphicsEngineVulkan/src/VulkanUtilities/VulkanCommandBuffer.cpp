@@ -25,12 +25,78 @@
  *  of the possibility of such damages.
  */
 #include <sstream>
+#include <algorithm>
 
 #include "VulkanUtilities/VulkanCommandBuffer.hpp"
 
 namespace VulkanUtilities
 {
 
+// Pipeline stages that can be used in synchronization commands recorded
+// into command buffers submitted to a queue with the given capabilities (6.1.2)
+static VkPipelineStageFlags GetSupportedPipelineStages(VkQueueFlags QueueFlags)
+{
+    if (QueueFlags & VK_QUEUE_GRAPHICS_BIT)
+        return ~VkPipelineStageFlags{0};
+
+    VkPipelineStageFlags Stages =
+        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT |
+        VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT |
+        VK_PIPELINE_STAGE_HOST_BIT |
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT |
+        VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+    if (QueueFlags & VK_QUEUE_COMPUTE_BIT)
+    {
+        Stages |=
+            VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT |
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT |
+            VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR |
+            VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR;
+    }
+
+    return Stages;
+}
+
+// Access types that can be performed by the pipeline stages supported
+// by a queue with the given capabilities (6.1.3)
+static VkAccessFlags GetSupportedAccessFlags(VkQueueFlags QueueFlags)
+{
+    if (QueueFlags & VK_QUEUE_GRAPHICS_BIT)
+        return ~VkAccessFlags{0};
+
+    VkAccessFlags AccessFlags =
+        VK_ACCESS_TRANSFER_READ_BIT |
+        VK_ACCESS_TRANSFER_WRITE_BIT |
+        VK_ACCESS_HOST_READ_BIT |
+        VK_ACCESS_HOST_WRITE_BIT |
+        VK_ACCESS_MEMORY_READ_BIT |
+        VK_ACCESS_MEMORY_WRITE_BIT;
+
+    if (QueueFlags & VK_QUEUE_COMPUTE_BIT)
+    {
+        AccessFlags |=
+            VK_ACCESS_INDIRECT_COMMAND_READ_BIT |
+            VK_ACCESS_UNIFORM_READ_BIT |
+            VK_ACCESS_SHADER_READ_BIT |
+            VK_ACCESS_SHADER_WRITE_BIT |
+            VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR |
+            VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+    }
+
+    return AccessFlags;
+}
+
+VulkanCommandBuffer::VulkanCommandBuffer(VkPipelineStageFlags EnabledShaderStages,
+                                         VkQueueFlags         QueueFlags) noexcept :
+    // clang-format off
+    m_EnabledShaderStages  {EnabledShaderStages & GetSupportedPipelineStages(QueueFlags)},
+    m_SupportedStages      {GetSupportedPipelineStages(QueueFlags)},
+    m_SupportedAccessFlags {GetSupportedAccessFlags(QueueFlags)}
+// clang-format on
+{
+}
+
 static VkPipelineStageFlags PipelineStageFromAccessFlags(VkAccessFlags              AccessFlags,
                                                          const VkPipelineStageFlags EnabledShaderStages)
 {
@@ -249,17 +315,14 @@ static VkAccessFlags AccessMaskFromImageLayout(VkImageLayout Layout,
     return AccessMask;
 }
 
-void VulkanCommandBuffer::TransitionImageLayout(VkCommandBuffer                CmdBuffer,
-                                                VkImage                        Image,
-                                                VkImageLayout                  OldLayout,
-                                                VkImageLayout                  NewLayout,
-                                                const VkImageSubresourceRange& SubresRange,
-                                                VkPipelineStageFlags           EnabledShaderStages,
-                                                VkPipelineStageFlags           SrcStages,
-                                                VkPipelineStageFlags           DestStages)
+static VkImageMemoryBarrier GetImageLayoutTransitionBarrier(VkImage                        Image,
+                                                            VkImageLayout                  OldLayout,
+                                                            VkImageLayout                  NewLayout,
+                                                            const VkImageSubresourceRange& SubresRange,
+                                                            VkPipelineStageFlags           EnabledShaderStages,
+                                                            VkPipelineStageFlags&          SrcStages,
+                                                            VkPipelineStageFlags&          DestStages)
 {
-    VERIFY_EXPR(CmdBuffer != VK_NULL_HANDLE);
-
     VkImageMemoryBarrier ImgBarrier = {};
     ImgBarrier.sType                = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
     ImgBarrier.pNext                = nullptr;
@@ -312,38 +375,15 @@ void VulkanCommandBuffer::TransitionImageLayout(VkCommandBuffer                C
         }
     }
 
-    // Including a particular pipeline stage in the first synchronization scope of a command implicitly
-    // includes logically earlier pipeline stages in the synchronization scope. Similarly, the second
-    // synchronization scope includes logically later pipeline stages.
-    // However, note that access scopes are not affected in this way - only the precise stages specified
-    // are considered part of each access scope.  (6.1.2)
-
-    vkCmdPipelineBarrier(CmdBuffer,
-                         SrcStages,  // must not be 0
-                         DestStages, // must not be 0
-                         0,          // a bitmask specifying how execution and memory dependencies are formed
-                         0,          // memoryBarrierCount
-                         nullptr,    // pMemoryBarriers
-                         0,          // bufferMemoryBarrierCount
-                         nullptr,    // pBufferMemoryBarriers
-                         1,
-                         &ImgBarrier);
-    // Each element of pMemoryBarriers, pBufferMemoryBarriers and pImageMemoryBarriers must not
-    // have any access flag included in its srcAccessMask member if that bit is not supported by
-    // any of the pipeline stages in srcStageMask.
-    // Each element of pMemoryBarriers, pBufferMemoryBarriers and pImageMemoryBarriers must not
-    // have any access flag included in its dstAccessMask member if that bit is not supported by any
-    // of the pipeline stages in dstStageMask (6.6)
+    return ImgBarrier;
 }
 
-
-void VulkanCommandBuffer::BufferMemoryBarrier(VkCommandBuffer      CmdBuffer,
-                                              VkBuffer             Buffer,
-                                              VkAccessFlags        srcAccessMask,
-                                              VkAccessFlags        dstAccessMask,
-                                              VkPipelineStageFlags EnabledShaderStages,
-                                              VkPipelineStageFlags SrcStages,
-                                              VkPipelineStageFlags DestStages)
+static VkBufferMemoryBarrier GetBufferMemoryBarrier(VkBuffer              Buffer,
+                                                    VkAccessFlags         srcAccessMask,
+                                                    VkAccessFlags         dstAccessMask,
+                                                    VkPipelineStageFlags  EnabledShaderStages,
+                                                    VkPipelineStageFlags& SrcStages,
+                                                    VkPipelineStageFlags& DestStages)
 {
     VkBufferMemoryBarrier BuffBarrier = {};
     BuffBarrier.sType                 = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
@@ -373,24 +413,14 @@ void VulkanCommandBuffer::BufferMemoryBarrier(VkCommandBuffer      CmdBuffer,
         DestStages = PipelineStageFromAccessFlags(BuffBarrier.dstAccessMask, EnabledShaderStages);
     }
 
-    vkCmdPipelineBarrier(CmdBuffer,
-                         SrcStages,    // must not be 0
-                         DestStages,   // must not be 0
-                         0,            // a bitmask specifying how execution and memory dependencies are formed
-                         0,            // memoryBarrierCount
-                         nullptr,      // pMemoryBarriers
-                         1,            // bufferMemoryBarrierCount
-                         &BuffBarrier, // pBufferMemoryBarriers
-                         0,
-                         nullptr);
+    return BuffBarrier;
 }
 
-void VulkanCommandBuffer::ASMemoryBarrier(VkCommandBuffer      CmdBuffer,
-                                          VkAccessFlags        srcAccessMask,
-                                          VkAccessFlags        dstAccessMask,
-                                          VkPipelineStageFlags EnabledShaderStages,
-                                          VkPipelineStageFlags SrcStages,
-                                          VkPipelineStageFlags DestStages)
+static VkMemoryBarrier GetASMemoryBarrier(VkAccessFlags         srcAccessMask,
+                                          VkAccessFlags         dstAccessMask,
+                                          VkPipelineStageFlags  EnabledShaderStages,
+                                          VkPipelineStageFlags& SrcStages,
+                                          VkPipelineStageFlags& DestStages)
 {
     VkMemoryBarrier Barrier = {};
     Barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
@@ -422,6 +452,78 @@ void VulkanCommandBuffer::ASMemoryBarrier(VkCommandBuffer      CmdBuffer,
     SrcStages &= StagesMask;
     DestStages &= StagesMask;
 
+    return Barrier;
+}
+
+void VulkanCommandBuffer::TransitionImageLayout(VkCommandBuffer                CmdBuffer,
+                                                VkImage                        Image,
+                                                VkImageLayout                  OldLayout,
+                                                VkImageLayout                  NewLayout,
+                                                const VkImageSubresourceRange& SubresRange,
+                                                VkPipelineStageFlags           EnabledShaderStages,
+                                                VkPipelineStageFlags           SrcStages,
+                                                VkPipelineStageFlags           DestStages)
+{
+    VERIFY_EXPR(CmdBuffer != VK_NULL_HANDLE);
+
+    auto ImgBarrier = GetImageLayoutTransitionBarrier(Image, OldLayout, NewLayout, SubresRange, EnabledShaderStages, SrcStages, DestStages);
+
+    // Including a particular pipeline stage in the first synchronization scope of a command implicitly
+    // includes logically earlier pipeline stages in the synchronization scope. Similarly, the second
+    // synchronization scope includes logically later pipeline stages.
+    // However, note that access scopes are not affected in this way - only the precise stages specified
+    // are considered part of each access scope.  (6.1.2)
+
+    vkCmdPipelineBarrier(CmdBuffer,
+                         SrcStages,  // must not be 0
+                         DestStages, // must not be 0
+                         0,          // a bitmask specifying how execution and memory dependencies are formed
+                         0,          // memoryBarrierCount
+                         nullptr,    // pMemoryBarriers
+                         0,          // bufferMemoryBarrierCount
+                         nullptr,    // pBufferMemoryBarriers
+                         1,
+                         &ImgBarrier);
+    // Each element of pMemoryBarriers, pBufferMemoryBarriers and pImageMemoryBarriers must not
+    // have any access flag included in its srcAccessMask member if that bit is not supported by
+    // any of the pipeline stages in srcStageMask.
+    // Each element of pMemoryBarriers, pBufferMemoryBarriers and pImageMemoryBarriers must not
+    // have any access flag included in its dstAccessMask member if that bit is not supported by any
+    // of the pipeline stages in dstStageMask (6.6)
+}
+
+
+void VulkanCommandBuffer::BufferMemoryBarrier(VkCommandBuffer      CmdBuffer,
+                                              VkBuffer             Buffer,
+                                              VkAccessFlags        srcAccessMask,
+                                              VkAccessFlags        dstAccessMask,
+                                              VkPipelineStageFlags EnabledShaderStages,
+                                              VkPipelineStageFlags SrcStages,
+                                              VkPipelineStageFlags DestStages)
+{
+    auto BuffBarrier = GetBufferMemoryBarrier(Buffer, srcAccessMask, dstAccessMask, EnabledShaderStages, SrcStages, DestStages);
+
+    vkCmdPipelineBarrier(CmdBuffer,
+                         SrcStages,    // must not be 0
+                         DestStages,   // must not be 0
+                         0,            // a bitmask specifying how execution and memory dependencies are formed
+                         0,            // memoryBarrierCount
+                         nullptr,      // pMemoryBarriers
+                         1,            // bufferMemoryBarrierCount
+                         &BuffBarrier, // pBufferMemoryBarriers
+                         0,
+                         nullptr);
+}
+
+void VulkanCommandBuffer::ASMemoryBarrier(VkCommandBuffer      CmdBuffer,
+                                          VkAccessFlags        srcAccessMask,
+                                          VkAccessFlags        dstAccessMask,
+                                          VkPipelineStageFlags EnabledShaderStages,
+                                          VkPipelineStageFlags SrcStages,
+                                          VkPipelineStageFlags DestStages)
+{
+    auto Barrier = GetASMemoryBarrier(srcAccessMask, dstAccessMask, EnabledShaderStages, SrcStages, DestStages);
+
     vkCmdPipelineBarrier(CmdBuffer,
                          SrcStages,  // must not be 0
                          DestStages, // must not be 0
@@ -434,8 +536,255 @@ void VulkanCommandBuffer::ASMemoryBarrier(VkCommandBuffer      CmdBuffer,
                          nullptr);
 }
 
-void VulkanCommandBuffer::FlushBarriers()
+
+void VulkanCommandBuffer::TransitionImageLayout(VkImage                        Image,
+                                                VkImageLayout                  OldLayout,
+                                                VkImageLayout                  NewLayout,
+                                                const VkImageSubresourceRange& SubresRange,
+                                                VkPipelineStageFlags           SrcStages,
+                                                VkPipelineStageFlags           DestStages)
+{
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+    if (m_State.RenderPass != VK_NULL_HANDLE)
+    {
+        // Image layout transitions within a render pass execute
+        // dependencies between attachments
+        EndRenderPass();
+    }
+
+    // The barrier must be recorded after all preceding copies
+    if (!m_PendingBufferCopies.empty())
+        FlushPendingBufferCopies();
+
+    // Barriers recorded by a single vkCmdPipelineBarrier are not ordered with respect to each other,
+    // so the second transition of the same image must go to the next batch.
+    for (const auto& PendingBarrier : m_PendingImageBarriers)
+    {
+        if (PendingBarrier.image == Image)
+        {
+            FlushPendingBarriers();
+            break;
+        }
+    }
+
+    auto ImgBarrier = GetImageLayoutTransitionBarrier(Image, OldLayout, NewLayout, SubresRange, m_EnabledShaderStages, SrcStages, DestStages);
+    m_PendingImageBarriers.push_back(ImgBarrier);
+    m_PendingSrcStages |= SrcStages;
+    m_PendingDstStages |= DestStages;
+    ++m_BarrierStats.NumBarriers;
+}
+
+void VulkanCommandBuffer::BufferMemoryBarrier(VkBuffer             Buffer,
+                                              VkAccessFlags        srcAccessMask,
+                                              VkAccessFlags        dstAccessMask,
+                                              VkPipelineStageFlags SrcStages,
+                                              VkPipelineStageFlags DestStages)
 {
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+    if (m_State.RenderPass != VK_NULL_HANDLE)
+    {
+        // Buffer barriers are not allowed inside a render pass
+        // unless there is a self-dependency
+        EndRenderPass();
+    }
+
+    if (!m_PendingBufferCopies.empty())
+        FlushPendingBufferCopies();
+
+    for (const auto& PendingBarrier : m_PendingBufferBarriers)
+    {
+        if (PendingBarrier.buffer == Buffer)
+        {
+            FlushPendingBarriers();
+            break;
+        }
+    }
+
+    auto BuffBarrier = GetBufferMemoryBarrier(Buffer, srcAccessMask, dstAccessMask, m_EnabledShaderStages, SrcStages, DestStages);
+    m_PendingBufferBarriers.push_back(BuffBarrier);
+    m_PendingSrcStages |= SrcStages;
+    m_PendingDstStages |= DestStages;
+    ++m_BarrierStats.NumBarriers;
+}
+
+void VulkanCommandBuffer::ASMemoryBarrier(VkAccessFlags        srcAccessMask,
+                                          VkAccessFlags        dstAccessMask,
+                                          VkPipelineStageFlags SrcStages,
+                                          VkPipelineStageFlags DestStages)
+{
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+    if (m_State.RenderPass != VK_NULL_HANDLE)
+    {
+        EndRenderPass();
+    }
+
+    if (!m_PendingBufferCopies.empty())
+        FlushPendingBufferCopies();
+
+    // Global memory barriers are not tied to a resource, so two of them
+    // can't be told apart and must never end up in the same batch.
+    if (!m_PendingMemoryBarriers.empty())
+        FlushPendingBarriers();
+
+    auto Barrier = GetASMemoryBarrier(srcAccessMask, dstAccessMask, m_EnabledShaderStages, SrcStages, DestStages);
+    m_PendingMemoryBarriers.push_back(Barrier);
+    m_PendingSrcStages |= SrcStages;
+    m_PendingDstStages |= DestStages;
+    ++m_BarrierStats.NumBarriers;
+}
+
+void VulkanCommandBuffer::FlushPendingBarriers()
+{
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+    VERIFY(m_PendingBufferCopies.empty(), "Pending copies must be flushed before the barriers");
+    VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "Pending barriers must be flushed outside of render pass");
+    VERIFY_EXPR(m_PendingSrcStages != 0 && m_PendingDstStages != 0);
+
+    auto SrcStages = m_PendingSrcStages;
+    auto DstStages = m_PendingDstStages;
+    if (((SrcStages | DstStages) & ~m_SupportedStages) != 0)
+    {
+        // Resource states are shared by all contexts, so a barrier recorded for a compute-only or
+        // transfer-only queue may reference stages and accesses performed by the graphics queue.
+        // These are not allowed on this queue and are replaced with all commands of the queue; the
+        // accesses by the other queue are made available by the semaphore the queues synchronize with.
+        if ((SrcStages & ~m_SupportedStages) != 0)
+            SrcStages = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        if ((DstStages & ~m_SupportedStages) != 0)
+            DstStages = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+        for (auto& Barrier : m_PendingImageBarriers)
+        {
+            Barrier.srcAccessMask &= m_SupportedAccessFlags;
+            Barrier.dstAccessMask &= m_SupportedAccessFlags;
+        }
+        for (auto& Barrier : m_PendingBufferBarriers)
+        {
+            Barrier.srcAccessMask &= m_SupportedAccessFlags;
+            Barrier.dstAccessMask &= m_SupportedAccessFlags;
+        }
+        for (auto& Barrier : m_PendingMemoryBarriers)
+        {
+            Barrier.srcAccessMask &= m_SupportedAccessFlags;
+            Barrier.dstAccessMask &= m_SupportedAccessFlags;
+        }
+    }
+
+    // Merging the stage masks is always valid: every access flag of every barrier remains
+    // supported by the combined masks, while the dependency becomes at most more conservative. (6.6)
+    vkCmdPipelineBarrier(m_VkCmdBuffer,
+                         SrcStages,
+                         DstStages,
+                         0,
+                         static_cast<uint32_t>(m_PendingMemoryBarriers.size()),
+                         m_PendingMemoryBarriers.data(),
+                         static_cast<uint32_t>(m_PendingBufferBarriers.size()),
+                         m_PendingBufferBarriers.data(),
+                         static_cast<uint32_t>(m_PendingImageBarriers.size()),
+                         m_PendingImageBarriers.data());
+    ++m_BarrierStats.NumPipelineBarriers;
+
+    m_PendingImageBarriers.clear();
+    m_PendingBufferBarriers.clear();
+    m_PendingMemoryBarriers.clear();
+    m_PendingSrcStages = 0;
+    m_PendingDstStages = 0;
+}
+
+void VulkanCommandBuffer::CopyBuffer(VkBuffer            srcBuffer,
+                                     VkBuffer            dstBuffer,
+                                     uint32_t            regionCount,
+                                     const VkBufferCopy* pRegions)
+{
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+    if (m_State.RenderPass != VK_NULL_HANDLE)
+    {
+        // Copy buffer operation must be performed outside of render pass.
+        EndRenderPass();
+    }
+    if (HasPendingBarriers())
+        FlushPendingBarriers();
+
+    // Limits the cost of the overlap test below
+    constexpr size_t MaxPendingBufferCopies = 64;
+
+    const auto Overlap = [](VkDeviceSize Offset0, VkDeviceSize Offset1, VkDeviceSize Size0, VkDeviceSize Size1) //
+    {
+        return Offset0 < Offset1 + Size1 && Offset1 < Offset0 + Size0;
+    };
+
+    for (uint32_t r = 0; r < regionCount; ++r)
+    {
+        const auto& Region = pRegions[r];
+
+        // Regions of a single vkCmdCopyBuffer are not ordered with respect to each other (and neither are
+        // separate copies without a barrier), so a copy that writes to or reads from the memory written by a
+        // pending copy, or writes to the memory read by it, must go to the next batch after a barrier.
+        bool Conflict = false;
+        for (size_t i = 0; i < m_PendingBufferCopies.size() && !Conflict; ++i)
+        {
+            const auto& Pending = m_PendingBufferCopies[i];
+
+            Conflict =
+                (Pending.DstBuffer == dstBuffer && Overlap(Pending.Region.dstOffset, Region.dstOffset, Pending.Region.size, Region.size)) ||
+                (Pending.DstBuffer == srcBuffer && Overlap(Pending.Region.dstOffset, Region.srcOffset, Pending.Region.size, Region.size)) ||
+                (Pending.SrcBuffer == dstBuffer && Overlap(Pending.Region.srcOffset, Region.dstOffset, Pending.Region.size, Region.size));
+        }
+        if (Conflict)
+        {
+            FlushPendingBufferCopies();
+
+            VkMemoryBarrier Barrier{};
+            Barrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            Barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+            Barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+            vkCmdPipelineBarrier(m_VkCmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &Barrier, 0, nullptr, 0, nullptr);
+            ++m_BarrierStats.NumBarriers;
+            ++m_BarrierStats.NumPipelineBarriers;
+        }
+        else if (m_PendingBufferCopies.size() >= MaxPendingBufferCopies)
+        {
+            FlushPendingBufferCopies();
+        }
+
+        m_PendingBufferCopies.push_back({srcBuffer, dstBuffer, Region});
+        m_CopyStats.NumBytes += Region.size;
+        ++m_CopyStats.NumRegions;
+    }
+}
+
+void VulkanCommandBuffer::FlushPendingBufferCopies()
+{
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+    VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "Pending copies must be flushed outside of render pass");
+    VERIFY_EXPR(!m_PendingBufferCopies.empty());
+
+    // Pending copies never conflict with each other, so they can be reordered to group the
+    // regions with the same source and destination buffers.
+    std::stable_sort(m_PendingBufferCopies.begin(), m_PendingBufferCopies.end(),
+                     [](const PendingBufferCopy& lhs, const PendingBufferCopy& rhs) //
+                     {
+                         return lhs.SrcBuffer < rhs.SrcBuffer || (lhs.SrcBuffer == rhs.SrcBuffer && lhs.DstBuffer < rhs.DstBuffer);
+                     });
+
+    // vkCmdCopyBuffer takes a tightly packed array of regions
+    m_PendingCopyRegions.clear();
+    for (size_t i = 0; i < m_PendingBufferCopies.size();)
+    {
+        const auto SrcBuffer = m_PendingBufferCopies[i].SrcBuffer;
+        const auto DstBuffer = m_PendingBufferCopies[i].DstBuffer;
+
+        const auto FirstRegion = m_PendingCopyRegions.size();
+        for (; i < m_PendingBufferCopies.size() && m_PendingBufferCopies[i].SrcBuffer == SrcBuffer && m_PendingBufferCopies[i].DstBuffer == DstBuffer; ++i)
+            m_PendingCopyRegions.push_back(m_PendingBufferCopies[i].Region);
+
+        vkCmdCopyBuffer(m_VkCmdBuffer, SrcBuffer, DstBuffer,
+                        static_cast<uint32_t>(m_PendingCopyRegions.size() - FirstRegion),
+                        m_PendingCopyRegions.data() + FirstRegion);
+        ++m_CopyStats.NumCopyCommands;
+    }
+
+    m_PendingBufferCopies.clear();
 }
 
 } // namespace VulkanUtilities
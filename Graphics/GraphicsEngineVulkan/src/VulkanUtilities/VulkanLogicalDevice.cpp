@@ -305,6 +305,23 @@ AccelStructWrapper VulkanLogicalDevice::CreateAccelStruct(const VkAccelerationSt
 #endif
 }
 
+PipelineCacheWrapper VulkanLogicalDevice::CreatePipelineCache(const VkPipelineCacheCreateInfo& PipelineCacheCI, const char* DebugName) const
+{
+    VERIFY_EXPR(PipelineCacheCI.sType == VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO);
+    return CreateVulkanObject<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(vkCreatePipelineCache, PipelineCacheCI, DebugName, "pipeline cache");
+}
+
+DescriptorUpdateTemplateWrapper VulkanLogicalDevice::CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfo& TemplateCI, const char* DebugName) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(TemplateCI.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO);
+    return CreateVulkanObject<VkDescriptorUpdateTemplate, VulkanHandleTypeId::DescriptorUpdateTemplate>(vkCreateDescriptorUpdateTemplate, TemplateCI, DebugName, "descriptor update template");
+#else
+    UNSUPPORTED("vkCreateDescriptorUpdateTemplate is only available through Volk");
+    return DescriptorUpdateTemplateWrapper{};
+#endif
+}
+
 VkCommandBuffer VulkanLogicalDevice::AllocateVkCommandBuffer(const VkCommandBufferAllocateInfo& AllocInfo, const char* DebugName) const
 {
     VERIFY_EXPR(AllocInfo.sType == VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO);
@@ -456,6 +473,22 @@ void VulkanLogicalDevice::ReleaseVulkanObject(AccelStructWrapper&& AccelStruct)
 #endif
 }
 
+void VulkanLogicalDevice::ReleaseVulkanObject(PipelineCacheWrapper&& PipelineCache) const
+{
+    vkDestroyPipelineCache(m_VkDevice, PipelineCache.m_VkObject, m_VkAllocator);
+    PipelineCache.m_VkObject = VK_NULL_HANDLE;
+}
+
+void VulkanLogicalDevice::ReleaseVulkanObject(DescriptorUpdateTemplateWrapper&& DescrUpdateTemplate) const
+{
+#if DILIGENT_USE_VOLK
+    vkDestroyDescriptorUpdateTemplate(m_VkDevice, DescrUpdateTemplate.m_VkObject, m_VkAllocator);
+    DescrUpdateTemplate.m_VkObject = VK_NULL_HANDLE;
+#else
+    UNSUPPORTED("vkDestroyDescriptorUpdateTemplate is only available through Volk");
+#endif
+}
+
 void VulkanLogicalDevice::FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const
 {
     VERIFY_EXPR(Pool != VK_NULL_HANDLE && Set != VK_NULL_HANDLE);
@@ -554,6 +587,38 @@ VkResult VulkanLogicalDevice::WaitForFences(uint32_t       fenceCount,
     return vkWaitForFences(m_VkDevice, fenceCount, pFences, waitAll, timeout);
 }
 
+VkResult VulkanLogicalDevice::GetSemaphoreCounter(VkSemaphore TimelineSemaphore, uint64_t* pSemaphoreValue) const
+{
+#if DILIGENT_USE_VOLK
+    return vkGetSemaphoreCounterValueKHR(m_VkDevice, TimelineSemaphore, pSemaphoreValue);
+#else
+    UNSUPPORTED("vkGetSemaphoreCounterValueKHR is only available through Volk");
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+#endif
+}
+
+VkResult VulkanLogicalDevice::SignalSemaphore(const VkSemaphoreSignalInfoKHR& SignalInfo) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(SignalInfo.sType == VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO_KHR);
+    return vkSignalSemaphoreKHR(m_VkDevice, &SignalInfo);
+#else
+    UNSUPPORTED("vkSignalSemaphoreKHR is only available through Volk");
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+#endif
+}
+
+VkResult VulkanLogicalDevice::WaitSemaphores(const VkSemaphoreWaitInfoKHR& WaitInfo, uint64_t Timeout) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(WaitInfo.sType == VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR);
+    return vkWaitSemaphoresKHR(m_VkDevice, &WaitInfo, Timeout);
+#else
+    UNSUPPORTED("vkWaitSemaphoresKHR is only available through Volk");
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+#endif
+}
+
 void VulkanLogicalDevice::UpdateDescriptorSets(uint32_t                    descriptorWriteCount,
                                                const VkWriteDescriptorSet* pDescriptorWrites,
                                                uint32_t                    descriptorCopyCount,
@@ -562,6 +627,17 @@ void VulkanLogicalDevice::UpdateDescriptorSets(uint32_t                    descr
     vkUpdateDescriptorSets(m_VkDevice, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
 }
 
+void VulkanLogicalDevice::UpdateDescriptorSetWithTemplate(VkDescriptorSet            descriptorSet,
+                                                          VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                          const void*                pData) const
+{
+#if DILIGENT_USE_VOLK
+    vkUpdateDescriptorSetWithTemplate(m_VkDevice, descriptorSet, descriptorUpdateTemplate, pData);
+#else
+    UNSUPPORTED("vkUpdateDescriptorSetWithTemplate is only available through Volk");
+#endif
+}
+
 VkResult VulkanLogicalDevice::ResetCommandPool(VkCommandPool           vkCmdPool,
                                                VkCommandPoolResetFlags flags) const
 {
@@ -578,6 +654,11 @@ VkResult VulkanLogicalDevice::ResetDescriptorPool(VkDescriptorPool           vkD
     return err;
 }
 
+VkResult VulkanLogicalDevice::GetPipelineCacheData(VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) const
+{
+    return vkGetPipelineCacheData(m_VkDevice, pipelineCache, pDataSize, pData);
+}
+
 VkResult VulkanLogicalDevice::GetRayTracingShaderGroupHandles(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const
 {
 #if DILIGENT_USE_VOLK
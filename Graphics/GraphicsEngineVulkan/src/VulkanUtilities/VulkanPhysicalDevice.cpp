@@ -169,6 +169,15 @@ VulkanPhysicalDevice::VulkanPhysicalDevice(VkPhysicalDevice      vkDevice,
             m_ExtProperties.DescriptorIndexing.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
         }
 
+        // Timeline semaphores are used by fences and command queues when available.
+        if (IsExtensionSupported(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.TimelineSemaphore;
+            NextFeat  = &m_ExtFeatures.TimelineSemaphore.pNext;
+
+            m_ExtFeatures.TimelineSemaphore.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+        }
+
         // Additional extension that is required for ray tracing shader.
         if (IsExtensionSupported(VK_KHR_SPIRV_1_4_EXTENSION_NAME))
             m_ExtFeatures.Spirv14 = true;
@@ -189,6 +198,10 @@ VulkanPhysicalDevice::VulkanPhysicalDevice(VkPhysicalDevice      vkDevice,
         vkGetPhysicalDeviceFeatures2KHR(m_VkDevice, &Feats2);
         vkGetPhysicalDeviceProperties2KHR(m_VkDevice, &Props2);
     }
+
+    // Descriptor update templates are in Vulkan 1.1 core and are loaded by Volk
+    if (Instance.GetVkVersion() >= VK_API_VERSION_1_1 && m_Properties.apiVersion >= VK_API_VERSION_1_1)
+        m_ExtFeatures.DescriptorUpdateTemplate = true;
 #endif // DILIGENT_USE_VOLK
 }
 
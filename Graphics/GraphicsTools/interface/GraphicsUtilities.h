@@ -34,6 +34,15 @@
 #include "../../GraphicsEngine/interface/Buffer.h"
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 
+#include "../../../Primitives/interface/DefineGlobalFuncHelperMacros.h"
+
+#if DILIGENT_CPP_INTERFACE
+namespace ThreadingTools
+{
+class ThreadPool;
+}
+#endif
+
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
 void DILIGENT_GLOBAL_FUNCTION(CreateUniformBuffer)(IRenderDevice*                  pDevice,
@@ -61,4 +70,52 @@ void DILIGENT_GLOBAL_FUNCTION(ComputeMipLevel)(Uint32         FineLevelWidth,
                                                void*          pCoarseLevelData,
                                                Uint32         CoarseDataStrideInBytes);
 
+/// Attributes of the ComputeMipChain function
+struct ComputeMipChainAttribs
+{
+    /// Texture format
+    TEXTURE_FORMAT Format DEFAULT_INITIALIZER(TEX_FORMAT_UNKNOWN);
+
+    /// Width of the finest mip level
+    Uint32 Width DEFAULT_INITIALIZER(0);
+
+    /// Height of the finest mip level
+    Uint32 Height DEFAULT_INITIALIZER(0);
+
+    /// Pointer to the finest mip level data
+    const void* pFineLevelData DEFAULT_INITIALIZER(nullptr);
+
+    /// Stride of the finest mip level, in bytes
+    Uint32 FineLevelStrideInBytes DEFAULT_INITIALIZER(0);
+
+    /// The number of coarse levels to compute
+    Uint32 NumCoarseLevels DEFAULT_INITIALIZER(0);
+
+    /// An array of NumCoarseLevels pointers to the coarse level data.
+    /// Level i + 1 is computed from level i, level 0 being the finest level.
+    void* const* ppCoarseLevelData DEFAULT_INITIALIZER(nullptr);
+
+    /// An array of NumCoarseLevels coarse level strides, in bytes
+    const Uint32* pCoarseLevelStrides DEFAULT_INITIALIZER(nullptr);
+};
+typedef struct ComputeMipChainAttribs ComputeMipChainAttribs;
+
+/// Computes the whole chain of coarse mip levels in a single pass.
+
+/// The function produces the same results as successive calls to ComputeMipLevel,
+/// but computes each coarse row as soon as the two fine rows it depends on are ready,
+/// so that the data stays in the cache. Common formats use vectorized kernels.
+void DILIGENT_GLOBAL_FUNCTION(ComputeMipChain)(const ComputeMipChainAttribs REF Attribs);
+
+#if DILIGENT_CPP_INTERFACE
+/// Computes the whole chain of coarse mip levels using the thread pool.
+
+/// The fine level of a large texture is split into bands that are processed by the pool
+/// threads and the calling thread. Small textures are always processed by the calling thread,
+/// which is also what happens when pThreadPool is null.
+void ComputeMipChain(const ComputeMipChainAttribs& Attribs, ThreadingTools::ThreadPool* pThreadPool);
+#endif
+
+#include "../../../Primitives/interface/UndefGlobalFuncHelperMacros.h"
+
 DILIGENT_END_NAMESPACE // namespace Diligent
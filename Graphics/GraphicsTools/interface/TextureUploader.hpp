@@ -66,6 +66,19 @@ public:
 /// Texture uploader description.
 struct TextureUploaderDesc
 {
+    /// Optional immediate context that submits commands to a dedicated transfer queue,
+    /// see EngineVkCreateInfo::EnableTransferQueue.
+
+    /// When the context is not null, Direct3D12 and Vulkan uploaders record copies of whole mip levels
+    /// into this context, so that the uploads overlap with rendering. Copies of partial mip levels
+    /// are recorded into the render context, as transfer queues may only be able to copy whole
+    /// subresources. The context is flushed
+    /// every time the copies are scheduled, and the context passed to ITextureUploader methods
+    /// waits on the GPU for the copies to complete. The context is only used by the thread that
+    /// calls the methods with non-null pContext, and must not be used by the application
+    /// simultaneously. Destination textures must include the command queues of both contexts
+    /// in their CommandQueueMask. Other backends ignore this member.
+    IDeviceContext* pTransferContext = nullptr;
 };
 
 
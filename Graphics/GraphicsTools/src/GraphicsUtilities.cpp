@@ -27,11 +27,19 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <vector>
 
 #include "GraphicsUtilities.h"
 #include "DebugUtilities.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ColorConversion.h"
+#include "BasicMathSIMD.hpp"
+#include "ThreadPool.hpp"
+
+#if DILIGENT_SIMD_MATH_SSE && defined(__F16C__)
+#    include <immintrin.h>
+#endif
 
 #define PI_F 3.1415926f
 
@@ -200,140 +208,688 @@ float LinearAverage<float>(float c0, float c1, float c2, float c3)
     return (c0 + c1 + c2 + c3) * 0.25f;
 }
 
-struct ComputeCoarseMipHelper
+// Half-precision float conversion used by the 16-bit float mip kernels
+float HalfToFloat(Uint16 Half)
 {
-    const Uint32 FineMipWidth;
-    const Uint32 FineMipHeight;
+    const Uint32 Sign     = (Uint32{Half} & 0x8000u) << 16u;
+    Uint32       Exponent = (Uint32{Half} >> 10u) & 0x1Fu;
+    Uint32       Mantissa = Uint32{Half} & 0x3FFu;
 
-    const void* const pFineMip;
-    const Uint32      FineMipStride;
+    Uint32 Bits = 0;
+    if (Exponent == 0x1F)
+    {
+        // Inf/NaN
+        Bits = Sign | 0x7F800000u | (Mantissa << 13u);
+    }
+    else if (Exponent != 0)
+    {
+        Bits = Sign | ((Exponent + (127 - 15)) << 23u) | (Mantissa << 13u);
+    }
+    else if (Mantissa != 0)
+    {
+        // Denormal - normalize the mantissa
+        Exponent = 127 - 15 + 1;
+        while ((Mantissa & 0x400u) == 0)
+        {
+            Mantissa <<= 1u;
+            --Exponent;
+        }
+        Bits = Sign | (Exponent << 23u) | ((Mantissa & 0x3FFu) << 13u);
+    }
+    else
+    {
+        Bits = Sign;
+    }
 
-    void* const  pCoarseMip;
-    const Uint32 CoarseMipStride;
+    float Val;
+    memcpy(&Val, &Bits, sizeof(Val));
+    return Val;
+}
 
-    const Uint32 NumChannels;
+// Converts a 32-bit float to half, rounding to nearest even
+Uint16 FloatToHalf(float Val)
+{
+    Uint32 Bits;
+    memcpy(&Bits, &Val, sizeof(Bits));
+
+    const Uint32 Sign = (Bits >> 16u) & 0x8000u;
+    const Uint32 Abs  = Bits & 0x7FFFFFFFu;
 
-    template <typename ChannelType,
-              typename AverageFuncType>
-    void Run(AverageFuncType ComputeAverage) const
+    if (Abs >= 0x7F800000u)
+    {
+        // Inf/NaN (keep NaNs quiet)
+        return static_cast<Uint16>(Sign | 0x7C00u | (Abs > 0x7F800000u ? 0x200u : 0u));
+    }
+    if (Abs >= 0x477FF000u)
+    {
+        // Values that round to 65520 and above overflow to infinity
+        return static_cast<Uint16>(Sign | 0x7C00u);
+    }
+    if (Abs < 0x38800000u)
     {
-        VERIFY_EXPR(FineMipWidth > 0 && FineMipHeight > 0);
-        VERIFY(FineMipHeight == 1 || FineMipStride >= FineMipWidth * sizeof(ChannelType) * NumChannels, "Fine mip level stride is too small");
+        // Smaller than the smallest normal half
+        if (Abs < 0x33000000u)
+            return static_cast<Uint16>(Sign);
+
+        const Uint32 Shift    = 126u - (Abs >> 23u);
+        const Uint32 Mantissa = (Abs & 0x7FFFFFu) | 0x800000u;
+        const Uint32 Rem      = Mantissa & ((1u << Shift) - 1u);
+        const Uint32 Halfway  = 1u << (Shift - 1u);
+
+        Uint32 Res = Mantissa >> Shift;
+        if (Rem > Halfway || (Rem == Halfway && (Res & 1u) != 0))
+            ++Res;
+        return static_cast<Uint16>(Sign | Res);
+    }
+
+    Uint32       Res = (Abs >> 13u) - ((127u - 15u) << 10u);
+    const Uint32 Rem = Abs & 0x1FFFu;
+    // Carry from the mantissa correctly propagates into the exponent
+    if (Rem > 0x1000u || (Rem == 0x1000u && (Res & 1u) != 0))
+        ++Res;
+    return static_cast<Uint16>(Sign | Res);
+}
 
-        const auto CoarseMipWidth  = std::max(FineMipWidth / Uint32{2}, Uint32{1});
-        const auto CoarseMipHeight = std::max(FineMipHeight / Uint32{2}, Uint32{1});
+Uint16 HalfAverage(Uint16 c0, Uint16 c1, Uint16 c2, Uint16 c3)
+{
+    return FloatToHalf(LinearAverage<float>(HalfToFloat(c0), HalfToFloat(c1), HalfToFloat(c2), HalfToFloat(c3)));
+}
 
-        VERIFY(CoarseMipHeight == 1 || CoarseMipStride >= CoarseMipWidth * sizeof(ChannelType) * NumChannels, "Coarse mip level stride is too small");
 
-        for (Uint32 row = 0; row < CoarseMipHeight; ++row)
+// Computes one row of the coarse mip level from two rows of the fine level.
+// The second fine row is the same as the first one when the fine level has odd height
+// and this is the last coarse row.
+using ComputeCoarseRowFuncType = void (*)(const void* pFineRow0,
+                                          const void* pFineRow1,
+                                          Uint32      FineWidth,
+                                          void*       pCoarseRow,
+                                          Uint32      CoarseWidth,
+                                          Uint32      NumChannels);
+
+template <typename ChannelType, ChannelType (*ComputeAverage)(ChannelType, ChannelType, ChannelType, ChannelType)>
+void ComputeCoarseRow(const void* pFineRow0,
+                      const void* pFineRow1,
+                      Uint32      FineWidth,
+                      void*       pCoarseRow,
+                      Uint32      CoarseWidth,
+                      Uint32      NumChannels)
+{
+    const auto* pSrcRow0 = static_cast<const ChannelType*>(pFineRow0);
+    const auto* pSrcRow1 = static_cast<const ChannelType*>(pFineRow1);
+    auto*       pDstRow  = static_cast<ChannelType*>(pCoarseRow);
+    for (Uint32 col = 0; col < CoarseWidth; ++col)
+    {
+        auto src_col0 = col * 2;
+        auto src_col1 = std::min(col * 2 + 1, FineWidth - 1);
+
+        for (Uint32 c = 0; c < NumChannels; ++c)
         {
-            auto src_row0 = row * 2;
-            auto src_row1 = std::min(row * 2 + 1, FineMipHeight - 1);
+            const auto Chnl00 = pSrcRow0[src_col0 * NumChannels + c];
+            const auto Chnl01 = pSrcRow0[src_col1 * NumChannels + c];
+            const auto Chnl10 = pSrcRow1[src_col0 * NumChannels + c];
+            const auto Chnl11 = pSrcRow1[src_col1 * NumChannels + c];
 
-            auto pSrcRow0 = reinterpret_cast<const ChannelType*>(reinterpret_cast<const Uint8*>(pFineMip) + src_row0 * FineMipStride);
-            auto pSrcRow1 = reinterpret_cast<const ChannelType*>(reinterpret_cast<const Uint8*>(pFineMip) + src_row1 * FineMipStride);
+            pDstRow[col * NumChannels + c] = ComputeAverage(Chnl00, Chnl01, Chnl10, Chnl11);
+        }
+    }
+}
 
-            for (Uint32 col = 0; col < CoarseMipWidth; ++col)
-            {
-                auto src_col0 = col * 2;
-                auto src_col1 = std::min(col * 2 + 1, FineMipWidth - 1);
+// Processes the columns [FirstCol, CoarseWidth) that are not handled by a vectorized kernel
+template <typename ChannelType, ChannelType (*ComputeAverage)(ChannelType, ChannelType, ChannelType, ChannelType)>
+void ComputeCoarseRowTail(const void* pFineRow0,
+                          const void* pFineRow1,
+                          Uint32      FineWidth,
+                          void*       pCoarseRow,
+                          Uint32      CoarseWidth,
+                          Uint32      NumChannels,
+                          Uint32      FirstCol)
+{
+    if (FirstCol >= CoarseWidth)
+        return;
+
+    ComputeCoarseRow<ChannelType, ComputeAverage>(
+        static_cast<const ChannelType*>(pFineRow0) + FirstCol * 2 * NumChannels,
+        static_cast<const ChannelType*>(pFineRow1) + FirstCol * 2 * NumChannels,
+        FineWidth - FirstCol * 2,
+        static_cast<ChannelType*>(pCoarseRow) + FirstCol * NumChannels,
+        CoarseWidth - FirstCol,
+        NumChannels);
+}
 
-                for (Uint32 c = 0; c < NumChannels; ++c)
-                {
-                    const auto Chnl00 = pSrcRow0[src_col0 * NumChannels + c];
-                    const auto Chnl01 = pSrcRow0[src_col1 * NumChannels + c];
-                    const auto Chnl10 = pSrcRow1[src_col0 * NumChannels + c];
-                    const auto Chnl11 = pSrcRow1[src_col1 * NumChannels + c];
+// Returns the number of leading coarse columns whose both source columns are inside the fine row
+inline Uint32 GetNumFullCoarseColumns(Uint32 FineWidth, Uint32 CoarseWidth)
+{
+    return std::min(FineWidth / 2, CoarseWidth);
+}
 
-                    auto& DstCol = reinterpret_cast<ChannelType*>(reinterpret_cast<Uint8*>(pCoarseMip) + row * CoarseMipStride)[col * NumChannels + c];
+// Linear average of 4-channel 8-bit unsigned formats
+void ComputeCoarseRowRGBA8(const void* pFineRow0,
+                           const void* pFineRow1,
+                           Uint32      FineWidth,
+                           void*       pCoarseRow,
+                           Uint32      CoarseWidth,
+                           Uint32      NumChannels)
+{
+    VERIFY_EXPR(NumChannels == 4);
 
-                    DstCol = ComputeAverage(Chnl00, Chnl01, Chnl10, Chnl11);
-                }
-            }
-        }
+    Uint32 col = 0;
+#if DILIGENT_SIMD_MATH_SSE || DILIGENT_SIMD_MATH_NEON
+    const auto* pSrcRow0 = static_cast<const Uint8*>(pFineRow0);
+    const auto* pSrcRow1 = static_cast<const Uint8*>(pFineRow1);
+    auto*       pDstRow  = static_cast<Uint8*>(pCoarseRow);
+
+    // Every iteration reads 8 fine texels (32 bytes) from each row and writes 4 coarse texels
+    const Uint32 NumFullCols = GetNumFullCoarseColumns(FineWidth, CoarseWidth);
+    for (; col + 4 <= NumFullCols; col += 4)
+    {
+        const auto* pSrc0 = pSrcRow0 + col * 8;
+        const auto* pSrc1 = pSrcRow1 + col * 8;
+        auto*       pDst  = pDstRow + col * 4;
+#    if DILIGENT_SIMD_MATH_SSE
+        const __m128i Zero = _mm_setzero_si128();
+        const __m128i a0   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc0));
+        const __m128i a1   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc0 + 16));
+        const __m128i b0   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc1));
+        const __m128i b1   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc1 + 16));
+
+        // Vertical sums of fine texel pairs {0,1}, {2,3}, {4,5}, {6,7} as 16-bit values
+        const __m128i s01 = _mm_add_epi16(_mm_unpacklo_epi8(a0, Zero), _mm_unpacklo_epi8(b0, Zero));
+        const __m128i s23 = _mm_add_epi16(_mm_unpackhi_epi8(a0, Zero), _mm_unpackhi_epi8(b0, Zero));
+        const __m128i s45 = _mm_add_epi16(_mm_unpacklo_epi8(a1, Zero), _mm_unpacklo_epi8(b1, Zero));
+        const __m128i s67 = _mm_add_epi16(_mm_unpackhi_epi8(a1, Zero), _mm_unpackhi_epi8(b1, Zero));
+
+        // Horizontal sums: {s0 + s1, s2 + s3} and {s4 + s5, s6 + s7}
+        const __m128i h01 = _mm_add_epi16(_mm_unpacklo_epi64(s01, s23), _mm_unpackhi_epi64(s01, s23));
+        const __m128i h23 = _mm_add_epi16(_mm_unpacklo_epi64(s45, s67), _mm_unpackhi_epi64(s45, s67));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), _mm_packus_epi16(_mm_srli_epi16(h01, 2), _mm_srli_epi16(h23, 2)));
+#    else
+        const uint8x16_t a0 = vld1q_u8(pSrc0);
+        const uint8x16_t a1 = vld1q_u8(pSrc0 + 16);
+        const uint8x16_t b0 = vld1q_u8(pSrc1);
+        const uint8x16_t b1 = vld1q_u8(pSrc1 + 16);
+
+        // Vertical sums of fine texel pairs {0,1}, {2,3}, {4,5}, {6,7} as 16-bit values
+        const uint16x8_t s01 = vaddl_u8(vget_low_u8(a0), vget_low_u8(b0));
+        const uint16x8_t s23 = vaddl_u8(vget_high_u8(a0), vget_high_u8(b0));
+        const uint16x8_t s45 = vaddl_u8(vget_low_u8(a1), vget_low_u8(b1));
+        const uint16x8_t s67 = vaddl_u8(vget_high_u8(a1), vget_high_u8(b1));
+
+        // Horizontal sums
+        const uint16x8_t h01 = vcombine_u16(vadd_u16(vget_low_u16(s01), vget_high_u16(s01)), vadd_u16(vget_low_u16(s23), vget_high_u16(s23)));
+        const uint16x8_t h23 = vcombine_u16(vadd_u16(vget_low_u16(s45), vget_high_u16(s45)), vadd_u16(vget_low_u16(s67), vget_high_u16(s67)));
+
+        vst1q_u8(pDst, vcombine_u8(vshrn_n_u16(h01, 2), vshrn_n_u16(h23, 2)));
+#    endif
     }
+#endif
+
+    ComputeCoarseRowTail<Uint8, LinearAverage<Uint8>>(pFineRow0, pFineRow1, FineWidth, pCoarseRow, CoarseWidth, NumChannels, col);
+}
+
+// FastSRGBToLinear() of all 8-bit values
+struct SRGBToLinearTable
+{
+    SRGBToLinearTable()
+    {
+        for (Uint32 i = 0; i < _countof(Values); ++i)
+            Values[i] = FastSRGBToLinear(static_cast<float>(i) * (1.f / 255.f));
+    }
+    float Values[256];
 };
 
-void ComputeMipLevel(Uint32         FineLevelWidth,
-                     Uint32         FineLevelHeight,
-                     TEXTURE_FORMAT Fmt,
-                     const void*    pFineLevelData,
-                     Uint32         FineDataStrideInBytes,
-                     void*          pCoarseLevelData,
-                     Uint32         CoarseDataStrideInBytes)
+// sRGB average of 4-channel 8-bit formats.
+// The results are identical to SRGBAverage<Uint8> as both versions perform the same float operations
+// in the same order. The sRGB-to-linear polynomial is replaced with a table lookup.
+void ComputeCoarseRowRGBA8SRGB(const void* pFineRow0,
+                               const void* pFineRow1,
+                               Uint32      FineWidth,
+                               void*       pCoarseRow,
+                               Uint32      CoarseWidth,
+                               Uint32      NumChannels)
 {
-    const auto& FmtAttribs = GetTextureFormatAttribs(Fmt);
+    VERIFY_EXPR(NumChannels == 4);
+
+    static const SRGBToLinearTable ToLinear;
+
+    const auto* pSrcRow0 = static_cast<const Uint8*>(pFineRow0);
+    const auto* pSrcRow1 = static_cast<const Uint8*>(pFineRow1);
+    auto*       pDstRow  = static_cast<Uint8*>(pCoarseRow);
+
+    const Uint32 NumFullCols = GetNumFullCoarseColumns(FineWidth, CoarseWidth);
+
+    Uint32 col = 0;
+#if DILIGENT_SIMD_MATH
+    const auto SRGBThreshold = SIMD::Splat(0.0031308f);
+    const auto LinearScale   = SIMD::Splat(12.92f);
+    const auto Offset        = SIMD::Splat(0.00228f);
+    const auto SqrtScale     = SIMD::Splat(1.13005f);
+    const auto LinearTerm    = SIMD::Splat(0.13448f);
+    const auto Bias          = SIMD::Splat(0.005719f);
+    const auto Quarter       = SIMD::Splat(0.25f);
+    const auto Zero          = SIMD::Splat(0.f);
+    const auto MaxVal        = SIMD::Splat(255.f);
+    for (; col < NumFullCols; ++col)
+    {
+        const auto* p00 = pSrcRow0 + col * 8;
+        const auto* p01 = p00 + 4;
+        const auto* p10 = pSrcRow1 + col * 8;
+        const auto* p11 = p10 + 4;
+
+        const auto* LUT = ToLinear.Values;
+
+        const auto l00 = SIMD::Set(LUT[p00[0]], LUT[p00[1]], LUT[p00[2]], LUT[p00[3]]);
+        const auto l01 = SIMD::Set(LUT[p01[0]], LUT[p01[1]], LUT[p01[2]], LUT[p01[3]]);
+        const auto l10 = SIMD::Set(LUT[p10[0]], LUT[p10[1]], LUT[p10[2]], LUT[p10[3]]);
+        const auto l11 = SIMD::Set(LUT[p11[0]], LUT[p11[1]], LUT[p11[2]], LUT[p11[3]]);
+
+        const auto Linear = SIMD::Mul(SIMD::Add(SIMD::Add(SIMD::Add(l00, l01), l10), l11), Quarter);
+
+        // FastLinearToSRGB(); the argument of the square root is clamped instead of taking the absolute
+        // value as it only matters for the lanes that select the linear segment.
+        const auto Lin  = SIMD::Mul(Linear, LinearScale);
+        const auto Sqrt = SIMD::Sqrt(SIMD::Max(SIMD::Sub(Linear, Offset), Zero));
+        const auto Pow  = SIMD::Add(SIMD::Sub(SIMD::Mul(SqrtScale, Sqrt), SIMD::Mul(LinearTerm, Linear)), Bias);
+        auto       SRGB = SIMD::Select(SIMD::CmpLT(Linear, SRGBThreshold), Lin, Pow);
+
+        SRGB = SIMD::Min(SIMD::Max(SIMD::Mul(SRGB, MaxVal), Zero), MaxVal);
+
+        float Res[4];
+        SIMD::Store(Res, SRGB);
+
+        auto* pDst = pDstRow + col * 4;
+        pDst[0]    = static_cast<Uint8>(Res[0]);
+        pDst[1]    = static_cast<Uint8>(Res[1]);
+        pDst[2]    = static_cast<Uint8>(Res[2]);
+        pDst[3]    = static_cast<Uint8>(Res[3]);
+    }
+#else
+    for (; col < NumFullCols; ++col)
+    {
+        const auto* p00 = pSrcRow0 + col * 8;
+        const auto* p01 = p00 + 4;
+        const auto* p10 = pSrcRow1 + col * 8;
+        const auto* p11 = p10 + 4;
+        for (Uint32 c = 0; c < 4; ++c)
+        {
+            const auto Linear = (ToLinear.Values[p00[c]] + ToLinear.Values[p01[c]] + ToLinear.Values[p10[c]] + ToLinear.Values[p11[c]]) * 0.25f;
+            const auto SRGB   = FastLinearToSRGB(Linear) * 255.f;
+            pDstRow[col * 4 + c] = static_cast<Uint8>(std::min(std::max(SRGB, 0.f), 255.f));
+        }
+    }
+#endif
 
-    ComputeCoarseMipHelper ComputeMipHelper //
+    ComputeCoarseRowTail<Uint8, SRGBAverage<Uint8>>(pFineRow0, pFineRow1, FineWidth, pCoarseRow, CoarseWidth, NumChannels, col);
+}
+
+#if DILIGENT_SIMD_MATH
+// Linear average of 32-bit float formats with one and four channels
+void ComputeCoarseRowFloat(const void* pFineRow0,
+                           const void* pFineRow1,
+                           Uint32      FineWidth,
+                           void*       pCoarseRow,
+                           Uint32      CoarseWidth,
+                           Uint32      NumChannels)
+{
+    VERIFY_EXPR(NumChannels == 1 || NumChannels == 4);
+
+    const auto* pSrcRow0 = static_cast<const float*>(pFineRow0);
+    const auto* pSrcRow1 = static_cast<const float*>(pFineRow1);
+    auto*       pDstRow  = static_cast<float*>(pCoarseRow);
+
+    const auto   Quarter     = SIMD::Splat(0.25f);
+    const Uint32 NumFullCols = GetNumFullCoarseColumns(FineWidth, CoarseWidth);
+
+    Uint32 col = 0;
+    if (NumChannels == 4)
+    {
+        for (; col < NumFullCols; ++col)
+        {
+            const auto c00 = SIMD::Load(pSrcRow0 + col * 8);
+            const auto c01 = SIMD::Load(pSrcRow0 + col * 8 + 4);
+            const auto c10 = SIMD::Load(pSrcRow1 + col * 8);
+            const auto c11 = SIMD::Load(pSrcRow1 + col * 8 + 4);
+            SIMD::Store(pDstRow + col * 4, SIMD::Mul(SIMD::Add(SIMD::Add(SIMD::Add(c00, c01), c10), c11), Quarter));
+        }
+    }
+    else
+    {
+        // Every iteration reads 8 fine texels from each row and writes 4 coarse texels
+        for (; col + 4 <= NumFullCols; col += 4)
         {
-            FineLevelWidth,
-            FineLevelHeight,
-            pFineLevelData,
-            FineDataStrideInBytes,
-            pCoarseLevelData,
-            CoarseDataStrideInBytes,
-            FmtAttribs.NumComponents //
-        };
+            const auto a0  = SIMD::Load(pSrcRow0 + col * 2);
+            const auto a1  = SIMD::Load(pSrcRow0 + col * 2 + 4);
+            const auto b0  = SIMD::Load(pSrcRow1 + col * 2);
+            const auto b1  = SIMD::Load(pSrcRow1 + col * 2 + 4);
+            const auto c00 = SIMD::Shuffle<0, 2, 0, 2>(a0, a1);
+            const auto c01 = SIMD::Shuffle<1, 3, 1, 3>(a0, a1);
+            const auto c10 = SIMD::Shuffle<0, 2, 0, 2>(b0, b1);
+            const auto c11 = SIMD::Shuffle<1, 3, 1, 3>(b0, b1);
+            SIMD::Store(pDstRow + col, SIMD::Mul(SIMD::Add(SIMD::Add(SIMD::Add(c00, c01), c10), c11), Quarter));
+        }
+    }
+
+    ComputeCoarseRowTail<float, LinearAverage<float>>(pFineRow0, pFineRow1, FineWidth, pCoarseRow, CoarseWidth, NumChannels, col);
+}
+#endif
+
+#if (DILIGENT_SIMD_MATH_SSE && defined(__F16C__)) || (DILIGENT_SIMD_MATH_NEON && (defined(__aarch64__) || defined(_M_ARM64)))
+// Linear average of 4-channel 16-bit float formats using hardware half conversion.
+// Both F16C and NEON round to nearest even, so the results are identical to HalfAverage.
+void ComputeCoarseRowRGBA16F(const void* pFineRow0,
+                             const void* pFineRow1,
+                             Uint32      FineWidth,
+                             void*       pCoarseRow,
+                             Uint32      CoarseWidth,
+                             Uint32      NumChannels)
+{
+    VERIFY_EXPR(NumChannels == 4);
+
+    const auto* pSrcRow0 = static_cast<const Uint16*>(pFineRow0);
+    const auto* pSrcRow1 = static_cast<const Uint16*>(pFineRow1);
+    auto*       pDstRow  = static_cast<Uint16*>(pCoarseRow);
+
+    const auto LoadHalf4 = [](const Uint16* pSrc) {
+#    if DILIGENT_SIMD_MATH_SSE
+        return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc)));
+#    else
+        return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(pSrc)));
+#    endif
+    };
+
+    const auto   Quarter     = SIMD::Splat(0.25f);
+    const Uint32 NumFullCols = GetNumFullCoarseColumns(FineWidth, CoarseWidth);
+
+    Uint32 col = 0;
+    for (; col < NumFullCols; ++col)
+    {
+        const auto c00 = LoadHalf4(pSrcRow0 + col * 8);
+        const auto c01 = LoadHalf4(pSrcRow0 + col * 8 + 4);
+        const auto c10 = LoadHalf4(pSrcRow1 + col * 8);
+        const auto c11 = LoadHalf4(pSrcRow1 + col * 8 + 4);
+        const auto Avg = SIMD::Mul(SIMD::Add(SIMD::Add(SIMD::Add(c00, c01), c10), c11), Quarter);
+#    if DILIGENT_SIMD_MATH_SSE
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(pDstRow + col * 4), _mm_cvtps_ph(Avg, _MM_FROUND_TO_NEAREST_INT));
+#    else
+        vst1_u16(pDstRow + col * 4, vreinterpret_u16_f16(vcvt_f16_f32(Avg)));
+#    endif
+    }
 
+    ComputeCoarseRowTail<Uint16, HalfAverage>(pFineRow0, pFineRow1, FineWidth, pCoarseRow, CoarseWidth, NumChannels, col);
+}
+#    define DILIGENT_HALF_FLOAT_MIP_KERNEL 1
+#endif
+
+ComputeCoarseRowFuncType GetComputeCoarseRowFunc(const TextureFormatAttribs& FmtAttribs, bool UseVectorKernels)
+{
     switch (FmtAttribs.ComponentType)
     {
         case COMPONENT_TYPE_UNORM_SRGB:
             VERIFY(FmtAttribs.ComponentSize == 1, "Only 8-bit sRGB formats are expected");
-            ComputeMipHelper.Run<Uint8>(SRGBAverage<Uint8>);
-            break;
+            if (UseVectorKernels && FmtAttribs.NumComponents == 4)
+                return ComputeCoarseRowRGBA8SRGB;
+            return ComputeCoarseRow<Uint8, SRGBAverage<Uint8>>;
 
         case COMPONENT_TYPE_UNORM:
         case COMPONENT_TYPE_UINT:
             switch (FmtAttribs.ComponentSize)
             {
                 case 1:
-                    ComputeMipHelper.Run<Uint8>(LinearAverage<Uint8>);
-                    break;
+                    if (UseVectorKernels && FmtAttribs.NumComponents == 4)
+                        return ComputeCoarseRowRGBA8;
+                    return ComputeCoarseRow<Uint8, LinearAverage<Uint8>>;
 
                 case 2:
-                    ComputeMipHelper.Run<Uint16>(LinearAverage<Uint16>);
-                    break;
+                    return ComputeCoarseRow<Uint16, LinearAverage<Uint16>>;
 
                 case 4:
-                    ComputeMipHelper.Run<Uint32>(LinearAverage<Uint32>);
-                    break;
+                    return ComputeCoarseRow<Uint32, LinearAverage<Uint32>>;
 
                 default:
                     UNEXPECTED("Unexpected component size (", FmtAttribs.ComponentSize, ") for UNORM/UINT texture format");
+                    return nullptr;
             }
-            break;
 
         case COMPONENT_TYPE_SNORM:
         case COMPONENT_TYPE_SINT:
             switch (FmtAttribs.ComponentSize)
             {
                 case 1:
-                    ComputeMipHelper.Run<Int8>(LinearAverage<Int8>);
-                    break;
+                    return ComputeCoarseRow<Int8, LinearAverage<Int8>>;
 
                 case 2:
-                    ComputeMipHelper.Run<Int16>(LinearAverage<Int16>);
-                    break;
+                    return ComputeCoarseRow<Int16, LinearAverage<Int16>>;
 
                 case 4:
-                    ComputeMipHelper.Run<Int32>(LinearAverage<Int32>);
-                    break;
+                    return ComputeCoarseRow<Int32, LinearAverage<Int32>>;
 
                 default:
                     UNEXPECTED("Unexpected component size (", FmtAttribs.ComponentSize, ") for UINT/SINT texture format");
+                    return nullptr;
             }
-            break;
 
         case COMPONENT_TYPE_FLOAT:
-            VERIFY(FmtAttribs.ComponentSize == 4, "Only 32-bit float formats are currently supported");
-            ComputeMipHelper.Run<Float32>(LinearAverage<Float32>);
-            break;
+            switch (FmtAttribs.ComponentSize)
+            {
+                case 2:
+#if DILIGENT_HALF_FLOAT_MIP_KERNEL
+                    if (UseVectorKernels && FmtAttribs.NumComponents == 4)
+                        return ComputeCoarseRowRGBA16F;
+#endif
+                    return ComputeCoarseRow<Uint16, HalfAverage>;
+
+                case 4:
+#if DILIGENT_SIMD_MATH
+                    if (UseVectorKernels && (FmtAttribs.NumComponents == 1 || FmtAttribs.NumComponents == 4))
+                        return ComputeCoarseRowFloat;
+#endif
+                    return ComputeCoarseRow<Float32, LinearAverage<Float32>>;
+
+                default:
+                    UNEXPECTED("Unexpected component size (", FmtAttribs.ComponentSize, ") for FLOAT texture format");
+                    return nullptr;
+            }
 
         default:
             UNEXPECTED("Unsupported component type");
+            return nullptr;
     }
 }
 
+
+// Computes the chain of coarse mip levels. Every coarse row is computed as soon as both
+// fine rows it depends on are available, so that the fine data is still in the cache.
+class MipChainBuilder
+{
+public:
+    MipChainBuilder(const ComputeMipChainAttribs& Attribs, ComputeCoarseRowFuncType ComputeRow) :
+        m_ComputeRow{ComputeRow},
+        m_NumChannels{GetTextureFormatAttribs(Attribs.Format).NumComponents}
+    {
+#ifdef DILIGENT_DEBUG
+        const auto&  FmtAttribs = GetTextureFormatAttribs(Attribs.Format);
+        const Uint32 TexelSize  = Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+#endif
+
+        m_Levels.resize(size_t{Attribs.NumCoarseLevels} + 1);
+
+        auto& FineLevel  = m_Levels[0];
+        FineLevel.Width  = Attribs.Width;
+        FineLevel.Height = Attribs.Height;
+        FineLevel.pData  = static_cast<Uint8*>(const_cast<void*>(Attribs.pFineLevelData));
+        FineLevel.Stride = Attribs.FineLevelStrideInBytes;
+        VERIFY(FineLevel.Height == 1 || FineLevel.Stride >= FineLevel.Width * TexelSize, "Fine mip level stride is too small");
+
+        for (Uint32 i = 1; i < m_Levels.size(); ++i)
+        {
+            auto& Level  = m_Levels[i];
+            Level.Width  = std::max(m_Levels[i - 1].Width / Uint32{2}, Uint32{1});
+            Level.Height = std::max(m_Levels[i - 1].Height / Uint32{2}, Uint32{1});
+            Level.pData  = static_cast<Uint8*>(Attribs.ppCoarseLevelData[i - 1]);
+            Level.Stride = Attribs.pCoarseLevelStrides[i - 1];
+            VERIFY(Level.Height == 1 || Level.Stride >= Level.Width * TexelSize, "Coarse mip level stride is too small");
+        }
+    }
+
+    Uint32 GetLevelHeight(Uint32 Level) const
+    {
+        return m_Levels[Level].Height;
+    }
+
+    // Processes rows [StartRow, EndRow) of level SrcLevel that are already available and computes
+    // all rows of levels SrcLevel+1 .. LastLevel that depend on them.
+    // StartRow must be a multiple of 2^(LastLevel - SrcLevel).
+    void Run(Uint32 SrcLevel, Uint32 LastLevel, Uint32 StartRow, Uint32 EndRow) const
+    {
+        VERIFY_EXPR(LastLevel < m_Levels.size());
+        for (Uint32 row = StartRow; row < EndRow; ++row)
+        {
+            auto Level = SrcLevel;
+            auto Row   = row;
+            while (Level < LastLevel)
+            {
+                const auto& Fine      = m_Levels[Level];
+                const auto& Coarse    = m_Levels[Level + 1];
+                const auto  CoarseRow = Row / 2;
+                // Coarse row is computed once the last fine row it depends on is ready
+                if (CoarseRow >= Coarse.Height || Row != std::min(CoarseRow * 2 + 1, Fine.Height - 1))
+                    break;
+
+                const auto SrcRow0 = CoarseRow * 2;
+                const auto SrcRow1 = std::min(CoarseRow * 2 + 1, Fine.Height - 1);
+                m_ComputeRow(Fine.pData + size_t{SrcRow0} * Fine.Stride,
+                             Fine.pData + size_t{SrcRow1} * Fine.Stride,
+                             Fine.Width,
+                             Coarse.pData + size_t{CoarseRow} * Coarse.Stride,
+                             Coarse.Width,
+                             m_NumChannels);
+
+                Row = CoarseRow;
+                ++Level;
+            }
+        }
+    }
+
+private:
+    struct LevelInfo
+    {
+        Uint32 Width  = 0;
+        Uint32 Height = 0;
+        Uint8* pData  = nullptr;
+        Uint32 Stride = 0;
+    };
+    std::vector<LevelInfo> m_Levels;
+
+    const ComputeCoarseRowFuncType m_ComputeRow;
+    const Uint32                   m_NumChannels;
+};
+
+void ComputeMipLevel(Uint32         FineLevelWidth,
+                     Uint32         FineLevelHeight,
+                     TEXTURE_FORMAT Fmt,
+                     const void*    pFineLevelData,
+                     Uint32         FineDataStrideInBytes,
+                     void*          pCoarseLevelData,
+                     Uint32         CoarseDataStrideInBytes)
+{
+    VERIFY_EXPR(FineLevelWidth > 0 && FineLevelHeight > 0);
+
+    const auto& FmtAttribs = GetTextureFormatAttribs(Fmt);
+
+    const auto ComputeRow = GetComputeCoarseRowFunc(FmtAttribs, false);
+    if (ComputeRow == nullptr)
+        return;
+
+    ComputeMipChainAttribs Attribs;
+    Attribs.Format                 = Fmt;
+    Attribs.Width                  = FineLevelWidth;
+    Attribs.Height                 = FineLevelHeight;
+    Attribs.pFineLevelData         = pFineLevelData;
+    Attribs.FineLevelStrideInBytes = FineDataStrideInBytes;
+    Attribs.NumCoarseLevels        = 1;
+    Attribs.ppCoarseLevelData      = &pCoarseLevelData;
+    Attribs.pCoarseLevelStrides    = &CoarseDataStrideInBytes;
+
+    MipChainBuilder Builder{Attribs, ComputeRow};
+    Builder.Run(0, 1, 0, FineLevelHeight);
+}
+
+void ComputeMipChain(const ComputeMipChainAttribs& Attribs)
+{
+    ComputeMipChain(Attribs, nullptr);
+}
+
+void ComputeMipChain(const ComputeMipChainAttribs& Attribs, ThreadingTools::ThreadPool* pThreadPool)
+{
+    DEV_CHECK_ERR(Attribs.Width > 0 && Attribs.Height > 0, "Texture dimensions must not be zero");
+    DEV_CHECK_ERR(Attribs.pFineLevelData != nullptr, "Fine level data must not be null");
+    DEV_CHECK_ERR(Attribs.NumCoarseLevels == 0 || (Attribs.ppCoarseLevelData != nullptr && Attribs.pCoarseLevelStrides != nullptr),
+                  "Coarse level data pointers and strides must not be null");
+    if (Attribs.NumCoarseLevels == 0)
+        return;
+
+    const auto& FmtAttribs = GetTextureFormatAttribs(Attribs.Format);
+
+    const auto ComputeRow = GetComputeCoarseRowFunc(FmtAttribs, true);
+    if (ComputeRow == nullptr)
+        return;
+
+    const MipChainBuilder Builder{Attribs, ComputeRow};
+
+    // The calling thread processes its share of bands too
+    const Uint32 NumThreads = pThreadPool != nullptr ? static_cast<Uint32>(pThreadPool->GetNumThreads()) + 1 : 1;
+
+    // The fine level is split into bands of 2^NumBandLevels rows. Coarse levels 1 .. NumBandLevels
+    // of different bands do not depend on each other and are computed in parallel.
+    // Keep a few tasks per thread for load balancing and do not bother with small textures.
+    static constexpr Uint32 TasksPerThread   = 4;
+    static constexpr Uint32 MinTexelsPerTask = 64 << 10;
+
+    Uint32 NumBandLevels = 0;
+    if (NumThreads > 1)
+    {
+        if (size_t{Attribs.Width} * size_t{Attribs.Height} >= size_t{MinTexelsPerTask} * NumThreads)
+        {
+            while (NumBandLevels < Attribs.NumCoarseLevels &&
+                   (Attribs.Height >> (NumBandLevels + 1)) >= NumThreads * TasksPerThread)
+                ++NumBandLevels;
+        }
+    }
+
+    if (NumBandLevels == 0)
+    {
+        Builder.Run(0, Attribs.NumCoarseLevels, 0, Attribs.Height);
+        return;
+    }
+
+    const Uint32 BandHeight   = 1u << NumBandLevels;
+    const Uint32 NumBands     = (Attribs.Height + BandHeight - 1) / BandHeight;
+    const Uint32 NumTasks     = std::min(NumBands, NumThreads * TasksPerThread);
+    const Uint32 BandsPerTask = (NumBands + NumTasks - 1) / NumTasks;
+
+    {
+        std::vector<std::future<void>> Tasks;
+        Tasks.reserve(NumTasks);
+        // The calling thread processes the first group of bands
+        for (Uint32 FirstBand = BandsPerTask; FirstBand < NumBands; FirstBand += BandsPerTask)
+        {
+            const Uint32 StartRow = FirstBand * BandHeight;
+            const Uint32 EndRow   = std::min((FirstBand + BandsPerTask) * BandHeight, Attribs.Height);
+            Tasks.emplace_back(pThreadPool->Enqueue(
+                [&Builder, NumBandLevels, StartRow, EndRow]() {
+                    Builder.Run(0, NumBandLevels, StartRow, EndRow);
+                }));
+        }
+        Builder.Run(0, NumBandLevels, 0, std::min(BandsPerTask * BandHeight, Attribs.Height));
+
+        for (auto& Task : Tasks)
+            Task.get();
+    }
+
+    // The remaining levels are small and are computed by the calling thread
+    Builder.Run(NumBandLevels, Attribs.NumCoarseLevels, 0, Builder.GetLevelHeight(NumBandLevels));
+}
+
 } // namespace Diligent
 
 
@@ -373,4 +929,9 @@ extern "C"
         ComputeMipLevel(FineLevelWidth, FineLevelHeight, Fmt, pFineLevelData,
                         FineDataStrideInBytes, pCoarseLevelData, CoarseDataStrideInBytes);
     }
+
+    void Diligent_ComputeMipChain(const Diligent::ComputeMipChainAttribs* Attribs)
+    {
+        Diligent::ComputeMipChain(*Attribs);
+    }
 }
@@ -29,7 +29,7 @@
 #    include "TextureUploaderD3D11.hpp"
 #endif
 
-#if D3D12_SUPPORTED || VULKAN_SUPPORTED
+#if D3D12_SUPPORTED || VULKAN_SUPPORTED || NULL_SUPPORTED
 #    include "TextureUploaderD3D12_Vk.hpp"
 #endif
 
@@ -51,9 +51,11 @@ void CreateTextureUploader(IRenderDevice* pDevice, const TextureUploaderDesc& De
             break;
 #endif
 
-#if D3D12_SUPPORTED || VULKAN_SUPPORTED
+#if D3D12_SUPPORTED || VULKAN_SUPPORTED || NULL_SUPPORTED
+        // Null device implements staging textures and fences, so it can use the same uploader
         case RENDER_DEVICE_TYPE_D3D12:
         case RENDER_DEVICE_TYPE_VULKAN:
+        case RENDER_DEVICE_TYPE_NULL:
             *ppUploader = MakeNewRCObj<TextureUploaderD3D12_Vk>()(pDevice, Desc);
             break;
 #endif
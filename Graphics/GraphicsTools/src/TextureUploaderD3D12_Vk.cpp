@@ -166,7 +166,8 @@ struct TextureUploaderD3D12_Vk::InternalData
         // clang-format on
     };
 
-    InternalData(IRenderDevice* pDevice)
+    InternalData(IRenderDevice* pDevice, IDeviceContext* pTransferContext) :
+        m_pTransferContext{pTransferContext}
     {
         FenceDesc fenceDesc;
         fenceDesc.Name = "Texture uploader sync fence";
@@ -212,10 +213,26 @@ struct TextureUploaderD3D12_Vk::InternalData
         // Fences can't be accessed from multiple threads simultaneously even
         // when protected by mutex
         auto FenceValue = m_NextFenceValue++;
-        pContext->SignalFence(m_pFence, FenceValue);
+        if (m_pTransferContext)
+        {
+            // Copies are executed by the transfer queue in parallel with rendering. The render
+            // queue waits for them to complete before executing the commands that follow.
+            m_pTransferContext->SignalFence(m_pFence, FenceValue);
+            m_pTransferContext->Flush();
+            pContext->DeviceWaitForFence(m_pFence, FenceValue);
+        }
+        else
+        {
+            pContext->SignalFence(m_pFence, FenceValue);
+        }
         return FenceValue;
     }
 
+    bool HasTransferContext() const
+    {
+        return m_pTransferContext != nullptr;
+    }
+
     void UpdatedCompletedFenceValue()
     {
         // Fences can't be accessed from multiple threads simultaneously even
@@ -269,6 +286,8 @@ private:
     std::mutex                                                                     m_UploadTexturesCacheMtx;
     std::unordered_map<UploadBufferDesc, std::deque<RefCntAutoPtr<UploadTexture>>> m_UploadTexturesCache;
 
+    RefCntAutoPtr<IDeviceContext> m_pTransferContext;
+
     RefCntAutoPtr<IFence> m_pFence;
     Uint64                m_NextFenceValue      = 1;
     Uint64                m_CompletedFenceValue = 0;
@@ -276,7 +295,7 @@ private:
 
 TextureUploaderD3D12_Vk::TextureUploaderD3D12_Vk(IReferenceCounters* pRefCounters, IRenderDevice* pDevice, const TextureUploaderDesc Desc) :
     TextureUploaderBase{pRefCounters, pDevice, Desc},
-    m_pInternalData{new InternalData(pDevice)}
+    m_pInternalData{new InternalData(pDevice, Desc.pTransferContext)}
 {
 }
 
@@ -329,6 +348,11 @@ void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
 void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pContext,
                                                     PendingBufferOperation& OperationInfo)
 {
+    // Staging textures are mapped and unmapped through the transfer context, if there is one
+    auto* pRenderContext = pContext;
+    if (m_pTransferContext)
+        pContext = m_pTransferContext;
+
     auto&       pUploadTex     = OperationInfo.pUploadTexture;
     const auto& StagingTexDesc = pUploadTex->GetDesc();
 
@@ -367,7 +391,18 @@ void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pCon
                     CopyInfo.SrcSlice    = Slice;
                     CopyInfo.DstMipLevel = OperationInfo.DstMip + Mip;
                     CopyInfo.DstSlice    = OperationInfo.DstSlice + Slice;
-                    pContext->CopyTexture(CopyInfo);
+
+                    // Transfer-only queues may only be able to copy whole subresources (minImageTransferGranularity
+                    // is (0,0,0) in Vulkan), so copies of partial mip levels are recorded into the render context.
+                    auto* pCopyContext = pContext;
+                    if (pContext != pRenderContext)
+                    {
+                        const auto SrcMipProps = GetMipLevelProperties(pUploadTex->GetStagingTexture()->GetDesc(), CopyInfo.SrcMipLevel);
+                        const auto DstMipProps = GetMipLevelProperties(OperationInfo.pDstTexture->GetDesc(), CopyInfo.DstMipLevel);
+                        if (SrcMipProps.LogicalWidth != DstMipProps.LogicalWidth || SrcMipProps.LogicalHeight != DstMipProps.LogicalHeight)
+                            pCopyContext = pRenderContext;
+                    }
+                    pCopyContext->CopyTexture(CopyInfo);
                 }
             }
         }
@@ -393,6 +428,12 @@ void TextureUploaderD3D12_Vk::AllocateUploadBuffer(IDeviceContext*         pCont
         StagingTexDesc.ArraySize      = Desc.ArraySize;
         StagingTexDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
         StagingTexDesc.Usage          = USAGE_STAGING;
+        if (m_pInternalData->HasTransferContext())
+        {
+            // The texture is used by the transfer queue, so it must not be released until
+            // the queue is done with it
+            StagingTexDesc.CommandQueueMask = ~Uint64{0};
+        }
 
         RefCntAutoPtr<ITexture> pStagingTexture;
         m_pDevice->CreateTexture(StagingTexDesc, nullptr, &pStagingTexture);
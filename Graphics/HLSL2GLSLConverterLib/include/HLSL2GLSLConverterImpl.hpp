@@ -32,6 +32,7 @@
 #include <unordered_map>
 #include <vector>
 #include <array>
+#include <memory>
 
 #include "HLSL2GLSLConverter.h"
 #include "ObjectBase.hpp"
@@ -276,7 +277,84 @@ private:
             Delimiter{_Delimiter}
         {}
     };
-    typedef std::list<TokenInfo> TokenListType;
+
+    // Memory pool for the token list nodes.
+    // The converter constantly inserts and removes tokens and relies on list
+    // iterators staying valid, so tokens are kept in a std::list. Allocating every
+    // node from the heap is however a major source of overhead, so nodes are
+    // instead sub-allocated from large pages owned by the conversion stream
+    // and are recycled through per-size free lists.
+    class TokenNodePool
+    {
+    public:
+        TokenNodePool() {}
+
+        // clang-format off
+        TokenNodePool           (const TokenNodePool&)  = delete;
+        TokenNodePool           (      TokenNodePool&&) = delete;
+        TokenNodePool& operator=(const TokenNodePool&)  = delete;
+        TokenNodePool& operator=(      TokenNodePool&&) = delete;
+        // clang-format on
+
+        void* Allocate(size_t Size);
+        void  Free(void* Ptr, size_t Size);
+
+    private:
+        static constexpr size_t PageSize = 64 << 10;
+
+        struct FreeNode
+        {
+            FreeNode* pNext;
+        };
+
+        std::vector<std::unique_ptr<Uint8[]>> m_Pages;
+
+        Uint8* m_pCurrPtr = nullptr;
+        Uint8* m_pPageEnd = nullptr;
+
+        // Free lists for every block size, typically only the list node size
+        std::vector<std::pair<size_t, FreeNode*>> m_FreeLists;
+    };
+
+    template <typename T>
+    struct TokenNodeAllocator
+    {
+        using value_type = T;
+
+        explicit TokenNodeAllocator(TokenNodePool& Pool) noexcept :
+            m_Pool{Pool}
+        {}
+
+        template <typename U>
+        TokenNodeAllocator(const TokenNodeAllocator<U>& Other) noexcept :
+            m_Pool{Other.m_Pool}
+        {}
+
+        T* allocate(size_t Count)
+        {
+            return static_cast<T*>(m_Pool.Allocate(Count * sizeof(T)));
+        }
+
+        void deallocate(T* Ptr, size_t Count)
+        {
+            m_Pool.Free(Ptr, Count * sizeof(T));
+        }
+
+        template <typename U>
+        bool operator==(const TokenNodeAllocator<U>& Other) const
+        {
+            return &m_Pool == &Other.m_Pool;
+        }
+
+        template <typename U>
+        bool operator!=(const TokenNodeAllocator<U>& Other) const
+        {
+            return &m_Pool != &Other.m_Pool;
+        }
+
+        TokenNodePool& m_Pool;
+    };
+    typedef std::list<TokenInfo, TokenNodeAllocator<TokenInfo>> TokenListType;
 
 
     class ConversionStream : public ObjectBase<IHLSL2GLSLConversionStream>
@@ -510,6 +588,10 @@ private:
 
         String BuildGLSLSource();
 
+        // Pool that allocates token list nodes. Must be declared before
+        // m_Tokens as it has to outlive the list.
+        TokenNodePool m_TokenPool;
+
         // Tokenized source code
         TokenListType m_Tokens;
 
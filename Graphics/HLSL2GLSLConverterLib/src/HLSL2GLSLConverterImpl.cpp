@@ -356,13 +356,17 @@
 #include "pch.h"
 #include <unordered_set>
 #include <string>
+#include <algorithm>
+#include <cstddef>
 
 #include "HLSL2GLSLConverterImpl.hpp"
 #include "GraphicsAccessories.hpp"
 #include "DataBlobImpl.hpp"
+#include "MappedFileStream.hpp"
 #include "StringDataBlobImpl.hpp"
 #include "StringTools.hpp"
 #include "EngineMemory.h"
+#include "Align.hpp"
 
 using namespace std;
 
@@ -1061,8 +1065,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::InsertIncludes(String& GLSLSource
             pSourceStreamFactory->CreateInputStream(IncludeName.c_str(), &pIncludeDataStream);
             if (!pIncludeDataStream)
                 LOG_ERROR_AND_THROW("Failed to open include file ", IncludeName);
-            RefCntAutoPtr<IDataBlob> pIncludeData(MakeNewRCObj<DataBlobImpl>()(0));
-            pIncludeDataStream->ReadBlob(pIncludeData);
+            RefCntAutoPtr<IDataBlob> pIncludeData = ReadStreamData(pIncludeDataStream);
 
             // Get include text
             auto   IncludeText = reinterpret_cast<const Char*>(pIncludeData->GetDataPtr());
@@ -1178,7 +1181,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::Tokenize(const String& Source)
                 break;
 
             case '=':
-                if (m_Tokens.size() > 0 && NewToken.Delimiter == "")
+                if (m_Tokens.size() > 0 && NewToken.Delimiter.empty())
                 {
                     auto& LastToken = m_Tokens.back();
                     // +=, -=, *=, /=, %=, <<=, >>=, &=, |=, ^=
@@ -1214,7 +1217,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::Tokenize(const String& Source)
 
             case '|':
             case '&':
-                if (m_Tokens.size() > 0 && NewToken.Delimiter == "" &&
+                if (m_Tokens.size() > 0 && NewToken.Delimiter.empty() &&
                     m_Tokens.back().Literal.length() == 1 && m_Tokens.back().Literal[0] == *SrcPos)
                 {
                     m_Tokens.back().Type = TokenType::BooleanOp;
@@ -1230,7 +1233,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::Tokenize(const String& Source)
 
             case '<':
             case '>':
-                if (m_Tokens.size() > 0 && NewToken.Delimiter == "" &&
+                if (m_Tokens.size() > 0 && NewToken.Delimiter.empty() &&
                     m_Tokens.back().Literal.length() == 1 && m_Tokens.back().Literal[0] == *SrcPos)
                 {
                     m_Tokens.back().Type = TokenType::BitwiseOp;
@@ -1249,7 +1252,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::Tokenize(const String& Source)
 
             case '+':
             case '-':
-                if (m_Tokens.size() > 0 && NewToken.Delimiter == "" &&
+                if (m_Tokens.size() > 0 && NewToken.Delimiter.empty() &&
                     m_Tokens.back().Literal.length() == 1 && m_Tokens.back().Literal[0] == *SrcPos)
                 {
                     m_Tokens.back().Type = TokenType::IncDecOp;
@@ -1366,7 +1369,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::Tokenize(const String& Source)
             }
         }
 
-        m_Tokens.push_back(NewToken);
+        m_Tokens.push_back(std::move(NewToken));
     }
 #undef CHECK_END
 }
@@ -2187,9 +2190,14 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessTextureDeclaration(TokenLi
 // Finds an HLSL object with the given name in object stack
 const HLSL2GLSLConverterImpl::HLSLObjectInfo* HLSL2GLSLConverterImpl::ConversionStream::FindHLSLObject(const String& Name)
 {
+    // Compute the hash once rather than for every scope
+    const HashMapStringKey Key{Name.c_str()};
     for (auto ScopeIt = m_Objects.rbegin(); ScopeIt != m_Objects.rend(); ++ScopeIt)
     {
-        auto It = ScopeIt->m.find(Name.c_str());
+        if (ScopeIt->m.empty())
+            continue;
+
+        auto It = ScopeIt->m.find(Key);
         if (It != ScopeIt->m.end())
             return &It->second;
     }
@@ -4770,9 +4778,67 @@ void HLSL2GLSLConverterImpl::ConversionStream::RemoveSpecialShaderAttributes()
     );
 }
 
+void* HLSL2GLSLConverterImpl::TokenNodePool::Allocate(size_t Size)
+{
+    VERIFY_EXPR(Size > 0);
+    Size = Align(std::max(Size, sizeof(FreeNode)), alignof(std::max_align_t));
+
+    for (auto& FreeList : m_FreeLists)
+    {
+        if (FreeList.first == Size)
+        {
+            if (auto* pNode = FreeList.second)
+            {
+                FreeList.second = pNode->pNext;
+                return pNode;
+            }
+            break;
+        }
+    }
+
+    if (m_pCurrPtr == nullptr || static_cast<size_t>(m_pPageEnd - m_pCurrPtr) < Size)
+    {
+        const auto NewPageSize = std::max(size_t{PageSize}, Size);
+        m_Pages.emplace_back(new Uint8[NewPageSize]);
+        m_pCurrPtr = m_Pages.back().get();
+        m_pPageEnd = m_pCurrPtr + NewPageSize;
+    }
+
+    auto* Ptr = m_pCurrPtr;
+    m_pCurrPtr += Size;
+    return Ptr;
+}
+
+void HLSL2GLSLConverterImpl::TokenNodePool::Free(void* Ptr, size_t Size)
+{
+    if (Ptr == nullptr)
+        return;
+
+    Size = Align(std::max(Size, sizeof(FreeNode)), alignof(std::max_align_t));
+
+    auto* pNode = static_cast<FreeNode*>(Ptr);
+    for (auto& FreeList : m_FreeLists)
+    {
+        if (FreeList.first == Size)
+        {
+            pNode->pNext    = FreeList.second;
+            FreeList.second = pNode;
+            return;
+        }
+    }
+
+    pNode->pNext = nullptr;
+    m_FreeLists.emplace_back(Size, pNode);
+}
+
 String HLSL2GLSLConverterImpl::ConversionStream::BuildGLSLSource()
 {
+    size_t OutputSize = 0;
+    for (const auto& Token : m_Tokens)
+        OutputSize += Token.Delimiter.length() + Token.Literal.length();
+
     String Output;
+    Output.reserve(OutputSize);
     for (const auto& Token : m_Tokens)
     {
         Output.append(Token.Delimiter);
@@ -4790,6 +4856,7 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
                                                            bool                             bPreserveTokens) :
     // clang-format off
     TBase            {pRefCounters   },
+    m_Tokens         {TokenNodeAllocator<TokenInfo>{m_TokenPool}},
     m_bPreserveTokens{bPreserveTokens},
     m_Converter      {Converter      },
     m_InputFileName  {InputFileName != nullptr ? InputFileName : "<Unknown>"}
@@ -4809,8 +4876,7 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
         if (pSourceStream == nullptr)
             LOG_ERROR_AND_THROW("Failed to open shader source file ", InputFileName);
 
-        pFileData = MakeNewRCObj<DataBlobImpl>()(0);
-        pSourceStream->ReadBlob(pFileData);
+        pFileData  = ReadStreamData(pSourceStream);
         HLSLSource = reinterpret_cast<char*>(pFileData->GetDataPtr());
         NumSymbols = pFileData->GetSize();
     }
@@ -4906,7 +4972,9 @@ String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
                                                          bool        UseInOutLocationQualifiers)
 {
     m_bUseInOutLocationQualifiers = UseInOutLocationQualifiers;
-    TokenListType TokensCopy(m_bPreserveTokens ? m_Tokens : TokenListType());
+    TokenListType TokensCopy{m_Tokens.get_allocator()};
+    if (m_bPreserveTokens)
+        TokensCopy = m_Tokens;
 
     Uint32 ShaderStorageBlockBinding = 0;
     Uint32 ImageBinding              = 0;
@@ -30,6 +30,7 @@
 #include <vector>
 #include "Shader.h"
 #include "DataBlob.h"
+#include "SPIRVCache.hpp"
 
 namespace Diligent
 {
@@ -54,11 +55,13 @@ std::vector<unsigned int> GLSLtoSPIRV(SHADER_TYPE                      ShaderTyp
                                       const ShaderMacro*               Macros,
                                       IShaderSourceInputStreamFactory* pShaderSourceStreamFactory,
                                       SpirvVersion                     Version,
-                                      IDataBlob**                      ppCompilerOutput);
+                                      IDataBlob**                      ppCompilerOutput,
+                                      SPIRVCache*                      pCache = nullptr);
 
 std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
                                       const char*             ExtraDefinitions,
-                                      IDataBlob**             ppCompilerOutput);
+                                      IDataBlob**             ppCompilerOutput,
+                                      SPIRVCache*             pCache = nullptr);
 
 } // namespace GLSLangUtils
 
@@ -0,0 +1,184 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::SPIRVCache class
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <mutex>
+#include <cstring>
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Persistent content-addressed cache of SPIR-V byte code.
+
+/// The cache is stored in a directory as two append-only files: the data file
+/// that contains the byte code of all entries, and the index file that maps
+/// the 128-bit entry keys to the byte code locations in the data file.
+/// Entries are never overwritten or removed; an index record is only written
+/// after the byte code it references, so that a partially written entry is
+/// discarded when the cache is loaded next time.
+///
+/// Several processes may share the same cache directory: the files are locked
+/// while they are read or appended, and every index record stores the size and
+/// the hash of the byte code, which are verified when the entry is looked up.
+///
+/// All methods are thread-safe.
+class SPIRVCache
+{
+public:
+    /// 128-bit key that identifies a cache entry.
+    struct Key
+    {
+        Uint64 Hash[2];
+
+        bool operator==(const Key& rhs) const
+        {
+            return Hash[0] == rhs.Hash[0] && Hash[1] == rhs.Hash[1];
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const Key& key) const
+            {
+                return static_cast<size_t>(key.Hash[0] ^ key.Hash[1]);
+            }
+        };
+    };
+
+    /// Computes the key from the data that fully defines the compilation result,
+    /// e.g. preprocessed source, compiler type and target SPIR-V version.
+
+    /// The key does not depend on the platform or on the process,
+    /// so it can be used in the persistent storage.
+    class KeyBuilder
+    {
+    public:
+        KeyBuilder& Add(const void* pData, size_t Size);
+
+        KeyBuilder& Add(const char* Str)
+        {
+            // Include the terminating zero so that {"ab", "c"} and {"a", "bc"} produce different keys
+            return Str != nullptr ? Add(Str, strlen(Str) + 1) : Add("", 1);
+        }
+
+        KeyBuilder& Add(const std::string& Str)
+        {
+            return Add(Str.c_str(), Str.length() + 1);
+        }
+
+        KeyBuilder& Add(Uint32 Value)
+        {
+            return Add(&Value, sizeof(Value));
+        }
+
+        const Key& Get() const { return m_Key; }
+
+    private:
+        // FNV-1a with two different offset bases
+        Key m_Key{{0xcbf29ce484222325ull, 0x84222325cbf29ce4ull}};
+    };
+
+    struct Statistics
+    {
+        /// The number of successful lookups since the cache was opened.
+        Uint32 NumHits = 0;
+
+        /// The number of failed lookups since the cache was opened.
+        Uint32 NumMisses = 0;
+
+        /// The total number of entries in the cache.
+        Uint32 NumEntries = 0;
+
+        /// The total size of the byte code stored in the cache, in bytes.
+        Uint64 DataSize = 0;
+    };
+
+    /// Opens the cache in the given directory. The directory is created if it does not exist.
+    /// If the cache files are missing or incompatible, an empty cache is created.
+    explicit SPIRVCache(const char* Directory) noexcept(false);
+
+    // clang-format off
+    SPIRVCache           (const SPIRVCache&)  = delete;
+    SPIRVCache           (      SPIRVCache&&) = delete;
+    SPIRVCache& operator=(const SPIRVCache&)  = delete;
+    SPIRVCache& operator=(      SPIRVCache&&) = delete;
+    // clang-format on
+
+    /// Looks up the byte code for the given key.
+
+    /// \param [in]  key   - Entry key.
+    /// \param [out] SPIRV - Byte code of the entry, if it was found.
+    /// \return     true if the entry was found, and false otherwise.
+    bool Find(const Key& key, std::vector<Uint32>& SPIRV);
+
+    /// Adds new entry to the cache and writes it to the disk.
+    /// If the entry with the same key already exists, the method does nothing.
+    void Add(const Key& key, const std::vector<Uint32>& SPIRV);
+
+    Statistics GetStatistics() const;
+
+private:
+    void Load();
+    void Reset();
+
+    struct Entry
+    {
+        Uint64 Offset; // Offset in m_Data, in bytes
+        Uint64 Size;   // Size of the byte code, in bytes
+        Uint64 Hash;   // Hash of the byte code
+    };
+
+    const std::string m_IndexFilePath;
+    const std::string m_DataFilePath;
+    const std::string m_LockFilePath;
+
+    mutable std::mutex m_Mtx;
+
+    std::unordered_map<Key, Entry, Key::Hasher> m_Index;
+
+    // Content of the data file excluding the header, followed by the byte code
+    // of the entries added by this instance. Data files may contain garbage left by
+    // processes that were terminated while writing, so the byte code is not necessarily
+    // aligned in this array.
+    std::vector<Uint8> m_Data;
+
+    Uint32 m_NumHits   = 0;
+    Uint32 m_NumMisses = 0;
+
+    bool m_IsWritable = true;
+};
+
+} // namespace Diligent
@@ -27,6 +27,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "GraphicsTypes.h"
 #include "Shader.h"
 #include "RefCntAutoPtr.hpp"
@@ -79,4 +82,41 @@ const char* ReadShaderSourceFile(const char*                      SourceCode,
 void AppendShaderSourceCode(std::string& Source, const ShaderCreateInfo& ShaderCI) noexcept(false);
 
 
+/// Makes a deep copy of the shader create info so that the shader can be compiled
+/// after the original structure and the data it references have gone out of scope,
+/// e.g. by a worker thread.
+///
+/// \note  The copy does not reference the conversion stream and the compiler output
+///        blob of the original structure. Compile flags are reset to SHADER_COMPILE_FLAG_NONE.
+class ShaderCreateInfoWrapper
+{
+public:
+    explicit ShaderCreateInfoWrapper(const ShaderCreateInfo& ShaderCI) noexcept(false);
+
+    // clang-format off
+    ShaderCreateInfoWrapper           (const ShaderCreateInfoWrapper&)  = delete;
+    ShaderCreateInfoWrapper           (      ShaderCreateInfoWrapper&&) = delete;
+    ShaderCreateInfoWrapper& operator=(const ShaderCreateInfoWrapper&)  = delete;
+    ShaderCreateInfoWrapper& operator=(      ShaderCreateInfoWrapper&&) = delete;
+    // clang-format on
+
+    const ShaderCreateInfo& Get() const { return m_CreateInfo; }
+
+private:
+    ShaderCreateInfo m_CreateInfo;
+
+    std::string m_Name;
+    std::string m_FilePath;
+    std::string m_Source;
+    std::string m_EntryPoint;
+    std::string m_CombinedSamplerSuffix;
+
+    std::vector<Uint8>       m_ByteCode;
+    std::vector<std::string> m_MacroStrings;
+    std::vector<ShaderMacro> m_Macros;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pSourceStreamFactory;
+};
+
+
 } // namespace Diligent
@@ -39,7 +39,7 @@
 #    error DXC is not supported on this platform
 #endif
 
-#include "DataBlobImpl.hpp"
+#include "MappedFileStream.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ShaderToolsCommon.hpp"
 
@@ -193,8 +193,7 @@ public:
             return E_FAIL;
         }
 
-        RefCntAutoPtr<IDataBlob> pFileData(MakeNewRCObj<DataBlobImpl>()(0));
-        pSourceStream->ReadBlob(pFileData);
+        RefCntAutoPtr<IDataBlob> pFileData = ReadStreamData(pSourceStream);
 
         CComPtr<IDxcBlobEncoding> sourceBlob;
 
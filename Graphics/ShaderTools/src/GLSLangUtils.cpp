@@ -40,6 +40,7 @@
 #include "GLSLangUtils.hpp"
 #include "DebugUtilities.hpp"
 #include "DataBlobImpl.hpp"
+#include "MappedFileStream.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ShaderToolsCommon.hpp"
 
@@ -411,8 +412,8 @@ public:
             return nullptr;
         }
 
-        RefCntAutoPtr<IDataBlob> pFileData(MakeNewRCObj<DataBlobImpl>()(0));
-        pSourceStream->ReadBlob(pFileData);
+        RefCntAutoPtr<IDataBlob> pFileData = ReadStreamData(pSourceStream);
+
         auto* pNewInclude =
             new IncludeResult{
                 headerName,
@@ -448,6 +449,33 @@ private:
     std::unordered_map<IncludeResult*, RefCntAutoPtr<IDataBlob>> m_DataBlobs;
 };
 
+// Runs the preprocessor on the shader and adds the fully expanded source,
+// with all macros and includes resolved, to the cache key.
+bool AddPreprocessedSourceToCacheKey(::glslang::TShader&              Shader,
+                                     EShMessages                      messages,
+                                     IShaderSourceInputStreamFactory* pShaderSourceStreamFactory,
+                                     SPIRVCache::KeyBuilder&          KeyBuilder)
+{
+    TBuiltInResource Resources = InitResources();
+    IncluderImpl     Includer{pShaderSourceStreamFactory};
+    std::string      PreprocessedSource;
+    if (!Shader.preprocess(&Resources, 100, ENoProfile, false, false, messages, &PreprocessedSource, Includer))
+        return false;
+
+    KeyBuilder.Add(PreprocessedSource);
+    return true;
+}
+
+// Adds the versions of glslang and SPIRV-Tools to the cache key, so that the byte code
+// produced by a different compiler or optimizer version is not used after an upgrade.
+void AddCompilerVersionToCacheKey(SPIRVCache::KeyBuilder& KeyBuilder)
+{
+    std::string SpirvVersion;
+    ::glslang::GetSpirvVersion(SpirvVersion);
+    KeyBuilder.Add(SpirvVersion).Add(static_cast<Uint32>(::glslang::GetSpirvGeneratorVersion()));
+    KeyBuilder.Add(spvSoftwareVersionDetailsString());
+}
+
 } // namespace
 
 void SpvOptimizerMessageConsumer(
@@ -500,11 +528,11 @@ void SpvOptimizerMessageConsumer(
 
 std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
                                       const char*             ExtraDefinitions,
-                                      IDataBlob**             ppCompilerOutput)
+                                      IDataBlob**             ppCompilerOutput,
+                                      SPIRVCache*             pCache)
 {
-    EShLanguage        ShLang = ShaderTypeToShLanguage(ShaderCI.Desc.ShaderType);
-    ::glslang::TShader Shader{ShLang};
-    EShMessages        messages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules | EShMsgReadHlsl | EShMsgHlslLegalization);
+    EShLanguage ShLang   = ShaderTypeToShLanguage(ShaderCI.Desc.ShaderType);
+    EShMessages messages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules | EShMsgReadHlsl | EShMsgHlslLegalization);
 
     VERIFY_EXPR(ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_HLSL);
 
@@ -513,13 +541,6 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     VERIFY(ShLang != EShLangTaskNV && ShLang != EShLangMeshNV,
            "Mesh shaders are not supported, use DXCompiler to build SPIRV from HLSL");
 
-    Shader.setEnvInput(::glslang::EShSourceHlsl, ShLang, ::glslang::EShClientVulkan, 100);
-    Shader.setEnvClient(::glslang::EShClientVulkan, ::glslang::EShTargetVulkan_1_0);
-    Shader.setEnvTarget(::glslang::EShTargetSpv, ::glslang::EShTargetSpv_1_0);
-    Shader.setHlslIoMapping(true);
-    Shader.setEntryPoint(ShaderCI.EntryPoint);
-    Shader.setEnvTargetHlslFunctionality1();
-
     RefCntAutoPtr<IDataBlob> pFileData;
     size_t                   SourceCodeLen = 0;
 
@@ -536,12 +557,45 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
         Defines += '\n';
         AppendShaderMacros(Defines, ShaderCI.Macros);
     }
-    Shader.setPreamble(Defines.c_str());
 
     const char* ShaderStrings[]       = {SourceCode};
     const int   ShaderStringLenghts[] = {static_cast<int>(SourceCodeLen)};
     const char* Names[]               = {ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : ""};
-    Shader.setStringsWithLengthsAndNames(ShaderStrings, ShaderStringLenghts, Names, 1);
+
+    auto InitShader = [&](::glslang::TShader& Shader) {
+        Shader.setEnvInput(::glslang::EShSourceHlsl, ShLang, ::glslang::EShClientVulkan, 100);
+        Shader.setEnvClient(::glslang::EShClientVulkan, ::glslang::EShTargetVulkan_1_0);
+        Shader.setEnvTarget(::glslang::EShTargetSpv, ::glslang::EShTargetSpv_1_0);
+        Shader.setHlslIoMapping(true);
+        Shader.setEntryPoint(ShaderCI.EntryPoint);
+        Shader.setEnvTargetHlslFunctionality1();
+        Shader.setPreamble(Defines.c_str());
+        Shader.setStringsWithLengthsAndNames(ShaderStrings, ShaderStringLenghts, Names, 1);
+    };
+
+    SPIRVCache::KeyBuilder CacheKey;
+    if (pCache != nullptr)
+    {
+        ::glslang::TShader PreprocShader{ShLang};
+        InitShader(PreprocShader);
+        // Everything that affects the byte code besides the source must be included into the key
+        CacheKey.Add("glslang-hlsl-legalized").Add(static_cast<Uint32>(ShLang)).Add(static_cast<Uint32>(messages)).Add(ShaderCI.EntryPoint);
+        AddCompilerVersionToCacheKey(CacheKey);
+        if (AddPreprocessedSourceToCacheKey(PreprocShader, messages, ShaderCI.pShaderSourceStreamFactory, CacheKey))
+        {
+            std::vector<unsigned int> CachedSPIRV;
+            if (pCache->Find(CacheKey.Get(), CachedSPIRV))
+                return CachedSPIRV;
+        }
+        else
+        {
+            // Let the compiler report the error
+            pCache = nullptr;
+        }
+    }
+
+    ::glslang::TShader Shader{ShLang};
+    InitShader(Shader);
 
     IncluderImpl Includer{ShaderCI.pShaderSourceStreamFactory};
 
@@ -558,6 +612,8 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     std::vector<uint32_t> LegalizedSPIRV;
     if (SpirvOptimizer.Run(SPIRV.data(), SPIRV.size(), &LegalizedSPIRV))
     {
+        if (pCache != nullptr)
+            pCache->Add(CacheKey.Get(), LegalizedSPIRV);
         return std::move(LegalizedSPIRV);
     }
     else
@@ -573,7 +629,8 @@ std::vector<unsigned int> GLSLtoSPIRV(SHADER_TYPE                      ShaderTyp
                                       const ShaderMacro*               Macros,
                                       IShaderSourceInputStreamFactory* pShaderSourceStreamFactory,
                                       SpirvVersion                     Version,
-                                      IDataBlob**                      ppCompilerOutput)
+                                      IDataBlob**                      ppCompilerOutput,
+                                      SPIRVCache*                      pCache)
 {
     VERIFY_EXPR(ShaderSource != nullptr && SourceCodeLen > 0);
 
@@ -621,6 +678,33 @@ std::vector<unsigned int> GLSLtoSPIRV(SHADER_TYPE                      ShaderTyp
         Shader.setPreamble(Defines.c_str());
     }
 
+    SPIRVCache::KeyBuilder CacheKey;
+    if (pCache != nullptr)
+    {
+        ::glslang::TShader PreprocShader{ShLang};
+        if (Version != SpirvVersion::Vk100)
+        {
+            PreprocShader.setEnvInput(::glslang::EShSourceGlsl, ShLang, ::glslang::EShClientVulkan, Version == SpirvVersion::Vk120 ? 120 : 110);
+        }
+        PreprocShader.setStringsWithLengths(ShaderStrings, Lenghts, 1);
+        if (Macros != nullptr)
+            PreprocShader.setPreamble(Defines.c_str());
+
+        CacheKey.Add("glslang-glsl-optimized").Add(static_cast<Uint32>(ShLang)).Add(static_cast<Uint32>(messages)).Add(static_cast<Uint32>(Version));
+        AddCompilerVersionToCacheKey(CacheKey);
+        if (AddPreprocessedSourceToCacheKey(PreprocShader, messages, pShaderSourceStreamFactory, CacheKey))
+        {
+            std::vector<unsigned int> CachedSPIRV;
+            if (pCache->Find(CacheKey.Get(), CachedSPIRV))
+                return CachedSPIRV;
+        }
+        else
+        {
+            // Let the compiler report the error
+            pCache = nullptr;
+        }
+    }
+
     IncluderImpl Includer{pShaderSourceStreamFactory};
 
     auto SPIRV = CompileShaderInternal(Shader, messages, &Includer, ShaderSource, SourceCodeLen, ppCompilerOutput);
@@ -633,6 +717,8 @@ std::vector<unsigned int> GLSLtoSPIRV(SHADER_TYPE                      ShaderTyp
     std::vector<uint32_t> OptimizedSPIRV;
     if (SpirvOptimizer.Run(SPIRV.data(), SPIRV.size(), &OptimizedSPIRV))
     {
+        if (pCache != nullptr)
+            pCache->Add(CacheKey.Get(), OptimizedSPIRV);
         return std::move(OptimizedSPIRV);
     }
     else
@@ -0,0 +1,384 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include "SPIRVCache.hpp"
+
+#include "FileWrapper.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 SPIRVCacheMagic   = 0x56505343; // 'CSPV'
+constexpr Uint32 SPIRVCacheVersion = 2;
+
+struct FileHeader
+{
+    Uint32 Magic   = SPIRVCacheMagic;
+    Uint32 Version = SPIRVCacheVersion;
+};
+
+struct IndexRecord
+{
+    SPIRVCache::Key Key;
+
+    Uint64 Offset; // Offset of the byte code in the data file excluding the header, in bytes
+    Uint64 Size;   // Size of the byte code, in bytes
+    Uint64 Hash;   // Hash of the byte code
+};
+static_assert(sizeof(IndexRecord) == 40, "Index record layout must not depend on the platform");
+
+Uint64 ComputeDataHash(const void* pData, size_t Size)
+{
+    return SPIRVCache::KeyBuilder{}.Add(pData, Size).Get().Hash[0];
+}
+
+// Inter-process lock of the cache files. The lock is taken on a separate file rather than
+// on the cache files themselves because on Windows file locks are mandatory and would
+// block the writes through other handles. The implementation is at the end of the file,
+// as Windows.h defines CreateDirectory as a macro.
+class CacheFileLock
+{
+public:
+    explicit CacheFileLock(const std::string& Path);
+    ~CacheFileLock();
+
+    // clang-format off
+    CacheFileLock           (const CacheFileLock&) = delete;
+    CacheFileLock& operator=(const CacheFileLock&) = delete;
+    // clang-format on
+
+    bool IsLocked() const { return m_IsLocked; }
+
+private:
+#if PLATFORM_WIN32
+    void* m_hFile = nullptr;
+#elif PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS
+    int m_fd = -1;
+#endif
+    bool m_IsLocked = false;
+};
+
+std::string GetCacheFilePath(const char* Directory, const char* FileName)
+{
+    std::string Path{Directory};
+    if (!Path.empty() && Path.back() != '/' && Path.back() != '\\')
+        Path += FileSystem::GetSlashSymbol();
+    Path += FileName;
+    return Path;
+}
+
+bool ReadCacheFile(const std::string& Path, std::vector<Uint8>& Data)
+{
+    if (!FileSystem::FileExists(Path.c_str()))
+        return false;
+
+    FileWrapper File{Path.c_str(), EFileAccessMode::Read};
+    if (!File)
+        return false;
+
+    Data.resize(File->GetSize());
+    return Data.empty() || File->Read(Data.data(), Data.size());
+}
+
+bool IsValidHeader(const std::vector<Uint8>& Data)
+{
+    if (Data.size() < sizeof(FileHeader))
+        return false;
+
+    FileHeader Header;
+    memcpy(&Header, Data.data(), sizeof(Header));
+    return Header.Magic == SPIRVCacheMagic && Header.Version == SPIRVCacheVersion;
+}
+
+} // namespace
+
+SPIRVCache::KeyBuilder& SPIRVCache::KeyBuilder::Add(const void* pData, size_t Size)
+{
+    constexpr Uint64 FNVPrime = 0x100000001b3ull;
+
+    const auto* pBytes = static_cast<const Uint8*>(pData);
+    for (size_t i = 0; i < Size; ++i)
+    {
+        m_Key.Hash[0] = (m_Key.Hash[0] ^ pBytes[i]) * FNVPrime;
+        m_Key.Hash[1] = (m_Key.Hash[1] ^ pBytes[i]) * FNVPrime;
+    }
+    return *this;
+}
+
+SPIRVCache::SPIRVCache(const char* Directory) noexcept(false) :
+    // clang-format off
+    m_IndexFilePath{GetCacheFilePath(Directory, "SPIRVCache.idx")},
+    m_DataFilePath {GetCacheFilePath(Directory, "SPIRVCache.dat")},
+    m_LockFilePath {GetCacheFilePath(Directory, "SPIRVCache.lock")}
+// clang-format on
+{
+    if (!FileSystem::PathExists(Directory) && !FileSystem::CreateDirectory(Directory))
+        LOG_ERROR_AND_THROW("Failed to create SPIR-V cache directory '", Directory, "'");
+
+    Load();
+}
+
+void SPIRVCache::Load()
+{
+    CacheFileLock FileLock{m_LockFilePath};
+    if (!FileLock.IsLocked())
+    {
+        LOG_WARNING_MESSAGE("Failed to lock SPIR-V cache file '", m_LockFilePath, "'. The cache will not be used.");
+        m_IsWritable = false;
+        return;
+    }
+
+    std::vector<Uint8> IndexFile;
+    if (!ReadCacheFile(m_DataFilePath, m_Data) || !ReadCacheFile(m_IndexFilePath, IndexFile) ||
+        !IsValidHeader(m_Data) || !IsValidHeader(IndexFile))
+    {
+        Reset();
+        return;
+    }
+    m_Data.erase(m_Data.begin(), m_Data.begin() + sizeof(FileHeader));
+
+    const auto NumRecords = (IndexFile.size() - sizeof(FileHeader)) / sizeof(IndexRecord);
+    for (size_t i = 0; i < NumRecords; ++i)
+    {
+        IndexRecord Record{};
+        memcpy(&Record, IndexFile.data() + sizeof(FileHeader) + i * sizeof(IndexRecord), sizeof(Record));
+        // Discard records that reference byte code that has not been fully written.
+        // The content of the remaining entries is verified by Find().
+        if (Record.Size > 0 && Record.Size % sizeof(Uint32) == 0 && Record.Offset <= m_Data.size() && Record.Size <= m_Data.size() - Record.Offset)
+            m_Index.emplace(Record.Key, Entry{Record.Offset, Record.Size, Record.Hash});
+    }
+
+    if (sizeof(FileHeader) + NumRecords * sizeof(IndexRecord) != IndexFile.size())
+    {
+        // The last record was partially written. Rewrite the index as new records
+        // are appended to the end of the file.
+        FileWrapper File{m_IndexFilePath.c_str(), EFileAccessMode::Overwrite};
+        if (!File || !File->Write(IndexFile.data(), sizeof(FileHeader) + NumRecords * sizeof(IndexRecord)))
+        {
+            LOG_WARNING_MESSAGE("Failed to repair SPIR-V cache index file '", m_IndexFilePath, "'. New entries will not be saved.");
+            m_IsWritable = false;
+        }
+    }
+}
+
+void SPIRVCache::Reset()
+{
+    m_Index.clear();
+    m_Data.clear();
+
+    const FileHeader Header;
+    for (const auto* Path : {&m_DataFilePath, &m_IndexFilePath})
+    {
+        FileWrapper File{Path->c_str(), EFileAccessMode::Overwrite};
+        if (!File || !File->Write(&Header, sizeof(Header)))
+        {
+            LOG_WARNING_MESSAGE("Failed to initialize SPIR-V cache file '", *Path, "'. New entries will not be saved.");
+            m_IsWritable = false;
+            return;
+        }
+    }
+}
+
+bool SPIRVCache::Find(const Key& key, std::vector<Uint32>& SPIRV)
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    auto it = m_Index.find(key);
+    if (it == m_Index.end())
+    {
+        ++m_NumMisses;
+        return false;
+    }
+
+    const auto& Entry = it->second;
+    const auto* pData = m_Data.data() + static_cast<size_t>(Entry.Offset);
+    if (ComputeDataHash(pData, static_cast<size_t>(Entry.Size)) != Entry.Hash)
+    {
+        LOG_WARNING_MESSAGE("SPIR-V cache entry is corrupted and will be ignored");
+        m_Index.erase(it);
+        ++m_NumMisses;
+        return false;
+    }
+
+    SPIRV.resize(static_cast<size_t>(Entry.Size) / sizeof(Uint32));
+    memcpy(SPIRV.data(), pData, static_cast<size_t>(Entry.Size));
+    ++m_NumHits;
+    return true;
+}
+
+void SPIRVCache::Add(const Key& key, const std::vector<Uint32>& SPIRV)
+{
+    VERIFY(!SPIRV.empty(), "Byte code must not be empty");
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    if (m_Index.find(key) != m_Index.end())
+        return;
+
+    const auto* pBytes   = reinterpret_cast<const Uint8*>(SPIRV.data());
+    const auto  DataSize = SPIRV.size() * sizeof(Uint32);
+    const auto  DataHash = ComputeDataHash(pBytes, DataSize);
+
+    m_Index.emplace(key, Entry{m_Data.size(), DataSize, DataHash});
+    m_Data.insert(m_Data.end(), pBytes, pBytes + DataSize);
+
+    if (!m_IsWritable)
+        return;
+
+    // Other processes may append to the same files, so the files are locked, and
+    // the byte code offset is taken from the actual end of the data file.
+    CacheFileLock FileLock{m_LockFilePath};
+    if (!FileLock.IsLocked())
+    {
+        LOG_WARNING_MESSAGE("Failed to lock SPIR-V cache file '", m_LockFilePath, "'. New entries will not be saved.");
+        m_IsWritable = false;
+        return;
+    }
+
+    IndexRecord Record{};
+    Record.Key  = key;
+    Record.Size = DataSize;
+    Record.Hash = DataHash;
+
+    // Byte code must be written before the index record that references it
+    {
+        FileWrapper DataFile{m_DataFilePath.c_str(), EFileAccessMode::Append};
+        if (!DataFile || DataFile->GetSize() < sizeof(FileHeader))
+        {
+            LOG_WARNING_MESSAGE("Failed to open SPIR-V cache data file '", m_DataFilePath, "'. New entries will not be saved.");
+            m_IsWritable = false;
+            return;
+        }
+
+        Record.Offset = DataFile->GetSize() - sizeof(FileHeader);
+        if (!DataFile->Write(pBytes, DataSize))
+        {
+            LOG_WARNING_MESSAGE("Failed to write SPIR-V cache data file '", m_DataFilePath, "'. New entries will not be saved.");
+            m_IsWritable = false;
+            return;
+        }
+    }
+
+    {
+        FileWrapper IndexFile{m_IndexFilePath.c_str(), EFileAccessMode::Append};
+        if (!IndexFile || !IndexFile->Write(&Record, sizeof(Record)))
+        {
+            LOG_WARNING_MESSAGE("Failed to write SPIR-V cache index file '", m_IndexFilePath, "'. New entries will not be saved.");
+            m_IsWritable = false;
+        }
+    }
+}
+
+SPIRVCache::Statistics SPIRVCache::GetStatistics() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    Statistics Stats;
+    Stats.NumHits    = m_NumHits;
+    Stats.NumMisses  = m_NumMisses;
+    Stats.NumEntries = static_cast<Uint32>(m_Index.size());
+    for (const auto& it : m_Index)
+        Stats.DataSize += it.second.Size;
+    return Stats;
+}
+
+} // namespace Diligent
+
+#if PLATFORM_WIN32
+#    include <Windows.h>
+#elif PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS
+#    include <errno.h>
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <unistd.h>
+#endif
+
+namespace Diligent
+{
+
+namespace
+{
+
+CacheFileLock::CacheFileLock(const std::string& Path)
+{
+#if PLATFORM_WIN32
+    auto hFile = CreateFileA(Path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                             nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+        return;
+
+    m_hFile = hFile;
+
+    OVERLAPPED Overlapped = {};
+    m_IsLocked            = LockFileEx(hFile, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &Overlapped) != FALSE;
+#elif PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS
+    m_fd = open(Path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (m_fd < 0)
+        return;
+
+    int res = 0;
+    do
+    {
+        res = flock(m_fd, LOCK_EX);
+    } while (res != 0 && errno == EINTR);
+    m_IsLocked = res == 0;
+#else
+    // Other platforms do not share the cache directory between processes
+    (void)Path;
+    m_IsLocked = true;
+#endif
+}
+
+CacheFileLock::~CacheFileLock()
+{
+#if PLATFORM_WIN32
+    if (m_hFile != nullptr)
+    {
+        if (m_IsLocked)
+        {
+            OVERLAPPED Overlapped = {};
+            UnlockFileEx(m_hFile, 0, 1, 0, &Overlapped);
+        }
+        CloseHandle(m_hFile);
+    }
+#elif PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS
+    if (m_fd >= 0)
+    {
+        // Closing the descriptor releases the lock
+        close(m_fd);
+    }
+#endif
+}
+
+} // namespace
+
+} // namespace Diligent
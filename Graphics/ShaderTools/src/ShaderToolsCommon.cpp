@@ -27,7 +27,7 @@
 
 #include "ShaderToolsCommon.hpp"
 #include "DebugUtilities.hpp"
-#include "DataBlobImpl.hpp"
+#include "MappedFileStream.hpp"
 
 namespace Diligent
 {
@@ -123,8 +123,7 @@ const char* ReadShaderSourceFile(const char*                      SourceCode,
                 if (pSourceStream == nullptr)
                     LOG_ERROR_AND_THROW("Failed to load shader source file '", FilePath, '\'');
 
-                pFileData = MakeNewRCObj<DataBlobImpl>{}(0);
-                pSourceStream->ReadBlob(pFileData);
+                pFileData     = ReadStreamData(pSourceStream);
                 SourceCode    = reinterpret_cast<char*>(pFileData->GetDataPtr());
                 SourceCodeLen = pFileData->GetSize();
             }
@@ -154,4 +153,49 @@ void AppendShaderSourceCode(std::string& Source, const ShaderCreateInfo& ShaderC
     Source.append(SourceCode, SourceCodeLen);
 }
 
+ShaderCreateInfoWrapper::ShaderCreateInfoWrapper(const ShaderCreateInfo& ShaderCI) noexcept(false) :
+    m_CreateInfo{ShaderCI},
+    m_pSourceStreamFactory{ShaderCI.pShaderSourceStreamFactory}
+{
+    auto CopyString = [](std::string& Dst, const char*& Str) {
+        if (Str != nullptr)
+        {
+            Dst = Str;
+            Str = Dst.c_str();
+        }
+    };
+    CopyString(m_Name, m_CreateInfo.Desc.Name);
+    CopyString(m_FilePath, m_CreateInfo.FilePath);
+    CopyString(m_Source, m_CreateInfo.Source);
+    CopyString(m_EntryPoint, m_CreateInfo.EntryPoint);
+    CopyString(m_CombinedSamplerSuffix, m_CreateInfo.CombinedSamplerSuffix);
+
+    if (ShaderCI.ByteCode != nullptr)
+    {
+        const auto* pByteCode = static_cast<const Uint8*>(ShaderCI.ByteCode);
+        m_ByteCode.assign(pByteCode, pByteCode + ShaderCI.ByteCodeSize);
+        m_CreateInfo.ByteCode = m_ByteCode.data();
+    }
+
+    if (ShaderCI.Macros != nullptr)
+    {
+        for (const auto* pMacro = ShaderCI.Macros; pMacro->Name != nullptr && pMacro->Definition != nullptr; ++pMacro)
+        {
+            m_MacroStrings.emplace_back(pMacro->Name);
+            m_MacroStrings.emplace_back(pMacro->Definition);
+        }
+        // Strings must not be moved once the macros reference them
+        m_Macros.reserve(m_MacroStrings.size() / 2 + 1);
+        for (size_t i = 0; i < m_MacroStrings.size(); i += 2)
+            m_Macros.emplace_back(m_MacroStrings[i].c_str(), m_MacroStrings[i + 1].c_str());
+        m_Macros.emplace_back();
+        m_CreateInfo.Macros = m_Macros.data();
+    }
+
+    m_CreateInfo.pShaderSourceStreamFactory = m_pSourceStreamFactory;
+    m_CreateInfo.ppConversionStream         = nullptr;
+    m_CreateInfo.ppCompilerOutput           = nullptr;
+    m_CreateInfo.CompileFlags               = SHADER_COMPILE_FLAG_NONE;
+}
+
 } // namespace Diligent
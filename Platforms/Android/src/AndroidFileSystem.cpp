@@ -348,6 +348,17 @@ void AndroidFileSystem::DeleteFile(const Diligent::Char* strPath)
     UNSUPPORTED("Not implemented");
 }
 
+void AndroidFileSystem::DeleteDirectory(const Diligent::Char* strPath)
+{
+    UNSUPPORTED("Not implemented");
+}
+
+std::string AndroidFileSystem::GetTemporaryDirectory()
+{
+    UNSUPPORTED("Not implemented");
+    return "";
+}
+
 std::vector<std::unique_ptr<FindFileData>> AndroidFileSystem::Search(const Diligent::Char* SearchPattern)
 {
     UNSUPPORTED("Not implemented");
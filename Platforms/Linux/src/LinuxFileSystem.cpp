@@ -24,6 +24,11 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <cstdio>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <sys/stat.h>
 
 #include "LinuxFileSystem.hpp"
 #include "Errors.hpp"
@@ -58,14 +63,37 @@ bool LinuxFileSystem::FileExists(const Diligent::Char* strFilePath)
 
 bool LinuxFileSystem::PathExists(const Diligent::Char* strPath)
 {
-    UNSUPPORTED("Not implemented");
-    return false;
+    FileOpenAttribs OpenAttribs;
+    OpenAttribs.strFilePath = strPath;
+    BasicFile   DummyFile(OpenAttribs, LinuxFileSystem::GetSlashSymbol());
+    const auto& Path = DummyFile.GetPath(); // This is necessary to correct slashes
+
+    struct stat StatBuff;
+    return stat(Path.c_str(), &StatBuff) == 0;
 }
 
 bool LinuxFileSystem::CreateDirectory(const Diligent::Char* strPath)
 {
-    UNSUPPORTED("Not implemented");
-    return false;
+    FileOpenAttribs OpenAttribs;
+    OpenAttribs.strFilePath = strPath;
+    BasicFile   DummyFile(OpenAttribs, LinuxFileSystem::GetSlashSymbol());
+    const auto& DirectoryPath = DummyFile.GetPath(); // This is necessary to correct slashes
+
+    // Create all parent directories
+    std::string::size_type SlashPos = 0;
+    do
+    {
+        SlashPos = DirectoryPath.find(LinuxFileSystem::GetSlashSymbol(), SlashPos + 1);
+
+        const auto ParentDir = DirectoryPath.substr(0, SlashPos);
+        if (!PathExists(ParentDir.c_str()))
+        {
+            if (mkdir(ParentDir.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH) != 0 && errno != EEXIST)
+                return false;
+        }
+    } while (SlashPos != std::string::npos);
+
+    return true;
 }
 
 void LinuxFileSystem::ClearDirectory(const Diligent::Char* strPath)
@@ -78,6 +106,39 @@ void LinuxFileSystem::DeleteFile(const Diligent::Char* strPath)
     remove(strPath);
 }
 
+void LinuxFileSystem::DeleteDirectory(const Diligent::Char* strPath)
+{
+    // Remove all files and subdirectories first
+    if (auto* pDir = opendir(strPath))
+    {
+        while (auto* pEntry = readdir(pDir))
+        {
+            if (strcmp(pEntry->d_name, ".") == 0 || strcmp(pEntry->d_name, "..") == 0)
+                continue;
+
+            const auto EntryPath = std::string{strPath} + GetSlashSymbol() + pEntry->d_name;
+
+            struct stat StatBuff;
+            if (lstat(EntryPath.c_str(), &StatBuff) == 0 && S_ISDIR(StatBuff.st_mode))
+                DeleteDirectory(EntryPath.c_str());
+            else
+                remove(EntryPath.c_str());
+        }
+        closedir(pDir);
+    }
+
+    if (rmdir(strPath) != 0)
+    {
+        LOG_ERROR_MESSAGE("Failed to remove directory '", strPath, "'. Error code: ", errno);
+    }
+}
+
+std::string LinuxFileSystem::GetTemporaryDirectory()
+{
+    const auto* TmpDir = getenv("TMPDIR");
+    return TmpDir != nullptr && *TmpDir != '\0' ? TmpDir : "/tmp";
+}
+
 std::vector<std::unique_ptr<FindFileData>> LinuxFileSystem::Search(const Diligent::Char* SearchPattern)
 {
     UNSUPPORTED("Not implemented");
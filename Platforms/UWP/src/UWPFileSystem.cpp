@@ -254,6 +254,17 @@ void WindowsStoreFileSystem::ClearDirectory(const Diligent::Char* strPath)
     UNSUPPORTED("Not implemented");
 }
 
+void WindowsStoreFileSystem::DeleteDirectory(const Diligent::Char* strPath)
+{
+    UNSUPPORTED("Not implemented");
+}
+
+std::string WindowsStoreFileSystem::GetTemporaryDirectory()
+{
+    UNSUPPORTED("Not implemented");
+    return "";
+}
+
 
 bool CreateDirectoryImpl(const Diligent::Char* strPath)
 {
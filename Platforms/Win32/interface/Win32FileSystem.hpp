@@ -112,6 +112,8 @@ public:
 
     static std::string GetCurrentDirectory();
 
+    static std::string GetTemporaryDirectory();
+
 
     /// Returns a relative path from one file or folder to another.
 
@@ -228,6 +228,23 @@ void WindowsFileSystem::DeleteDirectory(const Diligent::Char* strPath)
 }
 
 
+std::string WindowsFileSystem::GetTemporaryDirectory()
+{
+    // The returned path ends with a backslash
+    char TempPath[MAX_PATH + 1] = {};
+    auto NumChars               = GetTempPathA(_countof(TempPath), TempPath);
+    if (NumChars == 0 || NumChars > MAX_PATH)
+    {
+        LOG_ERROR_MESSAGE("Failed to get temporary directory path. Error code: ", GetLastError());
+        return ".";
+    }
+
+    std::string TempDir{TempPath, NumChars};
+    if (TempDir.back() == GetSlashSymbol())
+        TempDir.pop_back();
+    return TempDir;
+}
+
 bool WindowsFileSystem::PathExists(const Char* strPath)
 {
     return PathFileExistsA(strPath) != FALSE;
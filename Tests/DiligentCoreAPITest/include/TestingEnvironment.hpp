@@ -56,6 +56,9 @@ public:
         Uint32             AdapterId                 = DEFAULT_ADAPTER_ID;
         Uint32             NumDeferredContexts       = 4;
         bool               ForceNonSeparablePrograms = false;
+        const char*        GLProgramBinaryCacheDir   = nullptr;
+        bool               EnableAsyncComputeQueue   = false;
+        bool               EnableTransferQueue       = false;
     };
     TestingEnvironment(const CreateInfo& CI, const SwapChainDesc& SCDesc);
 
@@ -98,6 +101,11 @@ public:
     ISwapChain*     GetSwapChain() { return m_pSwapChain; }
     size_t          GetNumDeferredContexts() const { return m_pDeviceContexts.size() - 1; }
 
+    // Immediate contexts of the async compute and transfer queues (Vulkan only),
+    // null if the queue was not requested or is not available.
+    IDeviceContext* GetComputeContext() { return m_pComputeContext; }
+    IDeviceContext* GetTransferContext() { return m_pTransferContext; }
+
     static TestingEnvironment* GetInstance() { return m_pTheEnvironment; }
 
     RefCntAutoPtr<ITexture> CreateTexture(const char* Name, TEXTURE_FORMAT Fmt, BIND_FLAGS BindFlags, Uint32 Width, Uint32 Height, void* pInitData = nullptr);
@@ -138,6 +146,8 @@ protected:
 
     RefCntAutoPtr<IRenderDevice>               m_pDevice;
     std::vector<RefCntAutoPtr<IDeviceContext>> m_pDeviceContexts;
+    RefCntAutoPtr<IDeviceContext>              m_pComputeContext;
+    RefCntAutoPtr<IDeviceContext>              m_pTransferContext;
     RefCntAutoPtr<ISwapChain>                  m_pSwapChain;
     SHADER_COMPILER                            m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
 
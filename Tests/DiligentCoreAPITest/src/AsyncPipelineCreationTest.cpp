@@ -0,0 +1,205 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "ShaderMacroHelper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// clang-format off
+const std::string AsyncPipelineTestPS{
+R"(
+cbuffer Constants
+{
+    float4 g_Data[4];
+};
+
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    float4 Color = g_Data[0];
+    for (int i = 0; i < ITERATIONS; ++i)
+        Color = Color * g_Data[1] + g_Data[2] * sin(Color + float(i));
+    return Color + g_Data[3];
+}
+)"
+};
+// clang-format on
+
+RefCntAutoPtr<IPipelineState> CreateTestPSO(IRenderDevice* pDevice, int Iterations, bool Async)
+{
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("ITERATIONS", Iterations);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Macros                     = Macros;
+    ShaderCI.CompileFlags               = Async ? SHADER_COMPILE_FLAG_ASYNCHRONOUS : SHADER_COMPILE_FLAG_NONE;
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCI.Desc.Name       = "Async pipeline test VS";
+        ShaderCI.Source          = "float4 main(uint VertId : SV_VertexID) : SV_Position { return float4(float(VertId), 0.0, 0.0, 1.0); }";
+        pDevice->CreateShader(ShaderCI, &pVS);
+        if (!pVS)
+            return {};
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.Desc.Name       = "Async pipeline test PS";
+        ShaderCI.Source          = AsyncPipelineTestPS.c_str();
+        pDevice->CreateShader(ShaderCI, &pPS);
+        if (!pPS)
+            return {};
+    }
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSOCreateInfo.PSODesc.Name         = "Async pipeline test";
+    PSOCreateInfo.Flags                = Async ? PSO_CREATE_FLAG_ASYNCHRONOUS : PSO_CREATE_FLAG_NONE;
+    PSOCreateInfo.pVS                  = pVS;
+    PSOCreateInfo.pPS                  = pPS;
+    GraphicsPipeline.NumRenderTargets  = 1;
+    GraphicsPipeline.RTVFormats[0]     = TEX_FORMAT_RGBA8_UNORM;
+    GraphicsPipeline.PrimitiveTopology = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    return pPSO;
+}
+
+// The test environment does not limit EngineGLCreateInfo::MaxShaderCompilerThreads,
+// so the driver may use as many compiler threads as there are hardware threads.
+Uint32 GetNumShaderCompilerThreads()
+{
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void VerifyPipeline(IPipelineState* pPSO)
+{
+    EXPECT_EQ(pPSO->GetStatus(true), PIPELINE_STATE_STATUS_READY);
+    // Resource queries must be valid once the pipeline is ready
+    EXPECT_EQ(pPSO->GetStaticVariableCount(SHADER_TYPE_PIXEL), 1u);
+    EXPECT_NE(pPSO->GetStaticVariableByName(SHADER_TYPE_PIXEL, "Constants"), nullptr);
+}
+
+// Creates enough asynchronous pipelines to keep all compiler threads busy, waits for all of them
+// and verifies that they are ready and their resources are accessible. Unique macros are used in
+// every pipeline to defeat driver caches.
+TEST(AsyncPipelineCreation, CreatePipelines)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const Uint32 NumPipelines = 2 * GetNumShaderCompilerThreads();
+
+    std::vector<RefCntAutoPtr<IPipelineState>> Pipelines;
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        auto pPSO = CreateTestPSO(pDevice, static_cast<int>(i + 1), true);
+        ASSERT_NE(pPSO, nullptr);
+        Pipelines.emplace_back(std::move(pPSO));
+    }
+
+    for (auto& pPSO : Pipelines)
+        VerifyPipeline(pPSO);
+
+    // Synchronous pipelines are ready immediately
+    auto pPSO = CreateTestPSO(pDevice, static_cast<int>(NumPipelines + 1), false);
+    ASSERT_NE(pPSO, nullptr);
+    EXPECT_EQ(pPSO->GetStatus(), PIPELINE_STATE_STATUS_READY);
+    VerifyPipeline(pPSO);
+}
+
+// Compares the time it takes to create a set of unique pipelines when every compile and link
+// status is queried immediately with the time it takes when all pipelines are submitted first
+// and are waited on afterwards.
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. AsyncPipelineCreation.CreatePipelines verifies the pipelines.
+TEST(AsyncPipelineCreation, DISABLED_CreatePipelinesTiming)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const Uint32 NumPipelines = std::max(1000u, 64 * GetNumShaderCompilerThreads());
+
+    const auto SyncStartTime = std::chrono::high_resolution_clock::now();
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        auto pPSO = CreateTestPSO(pDevice, static_cast<int>(i + 1), false);
+        ASSERT_NE(pPSO, nullptr);
+        ASSERT_EQ(pPSO->GetStatus(), PIPELINE_STATE_STATUS_READY);
+    }
+    const auto SyncEndTime = std::chrono::high_resolution_clock::now();
+
+    const auto AsyncStartTime = std::chrono::high_resolution_clock::now();
+
+    std::vector<RefCntAutoPtr<IPipelineState>> Pipelines;
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        auto pPSO = CreateTestPSO(pDevice, static_cast<int>(NumPipelines + i + 1), true);
+        ASSERT_NE(pPSO, nullptr);
+        Pipelines.emplace_back(std::move(pPSO));
+    }
+    const auto AsyncSubmitTime = std::chrono::high_resolution_clock::now();
+
+    for (auto& pPSO : Pipelines)
+        ASSERT_EQ(pPSO->GetStatus(true), PIPELINE_STATE_STATUS_READY);
+    const auto AsyncEndTime = std::chrono::high_resolution_clock::now();
+
+    std::cout << "[          ] Created " << NumPipelines << " pipelines synchronously in "
+              << std::chrono::duration<double, std::milli>(SyncEndTime - SyncStartTime).count() << " ms, asynchronously in "
+              << std::chrono::duration<double, std::milli>(AsyncEndTime - AsyncStartTime).count() << " ms ("
+              << std::chrono::duration<double, std::milli>(AsyncSubmitTime - AsyncStartTime).count() << " ms to submit)"
+              << std::endl;
+}
+
+} // namespace
@@ -0,0 +1,226 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "TestingEnvironment.hpp"
+#include "ShaderMacroHelper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// clang-format off
+const std::string AsyncShaderTestPS{
+R"(
+cbuffer Constants
+{
+    float4 g_Data[4];
+};
+
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    float4 Color = g_Data[0];
+    for (int i = 0; i < ITERATIONS; ++i)
+        Color = Color * g_Data[1] + g_Data[2] * sin(Color + float(i));
+    return Color + g_Data[3];
+}
+)"
+};
+
+const std::string BrokenAsyncShaderTestPS{
+R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return float3(0.0, 0.0, 0.0);
+}
+)"
+};
+// clang-format on
+
+// Vulkan compiles asynchronous shaders on worker threads and OpenGL submits them to the driver.
+// Other backends ignore SHADER_COMPILE_FLAG_ASYNCHRONOUS.
+bool CompilesAsynchronously(const DeviceCaps& deviceCaps)
+{
+    return deviceCaps.IsVulkanDevice() || deviceCaps.IsGLDevice();
+}
+
+// Unique macros are used in every shader to defeat compiler caches
+RefCntAutoPtr<IShader> CreateTestShader(IRenderDevice*       pDevice,
+                                        SHADER_TYPE          ShaderType,
+                                        const char*          Name,
+                                        const char*          Source,
+                                        int                  Iterations,
+                                        SHADER_COMPILE_FLAGS CompileFlags)
+{
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("ITERATIONS", Iterations);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Macros                     = Macros;
+    ShaderCI.CompileFlags               = CompileFlags;
+    ShaderCI.Desc.ShaderType            = ShaderType;
+    ShaderCI.Desc.Name                  = Name;
+    ShaderCI.Source                     = Source;
+
+    RefCntAutoPtr<IShader> pShader;
+    pDevice->CreateShader(ShaderCI, &pShader);
+    return pShader;
+}
+
+RefCntAutoPtr<IShader> CreateTestVS(IRenderDevice* pDevice, int Iterations, SHADER_COMPILE_FLAGS CompileFlags)
+{
+    return CreateTestShader(pDevice, SHADER_TYPE_VERTEX, "Async shader test VS",
+                            "float4 main(uint VertId : SV_VertexID) : SV_Position { return float4(float(VertId + ITERATIONS), 0.0, 0.0, 1.0); }",
+                            Iterations, CompileFlags);
+}
+
+RefCntAutoPtr<IPipelineState> CreateTestPSO(IRenderDevice* pDevice, IShader* pVS, IShader* pPS)
+{
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSOCreateInfo.PSODesc.Name         = "Async shader test";
+    PSOCreateInfo.pVS                  = pVS;
+    PSOCreateInfo.pPS                  = pPS;
+    GraphicsPipeline.NumRenderTargets  = 1;
+    GraphicsPipeline.RTVFormats[0]     = TEX_FORMAT_RGBA8_UNORM;
+    GraphicsPipeline.PrimitiveTopology = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    return pPSO;
+}
+
+// An asynchronous shader is either being compiled or is already compiled when CreateShader() returns.
+// Once it is ready, it stays ready and its resources can be queried.
+TEST(AsyncShaderCompilation, StatusTransitions)
+{
+    auto* pEnv       = TestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto& deviceCaps = pDevice->GetDeviceCaps();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pPS = CreateTestShader(pDevice, SHADER_TYPE_PIXEL, "Async shader status test PS", AsyncShaderTestPS.c_str(), 64, SHADER_COMPILE_FLAG_ASYNCHRONOUS);
+    ASSERT_NE(pPS, nullptr);
+
+    const auto InitialStatus = pPS->GetStatus();
+    if (CompilesAsynchronously(deviceCaps))
+    {
+        EXPECT_TRUE(InitialStatus == SHADER_STATUS_COMPILING || InitialStatus == SHADER_STATUS_READY) << InitialStatus;
+    }
+    else
+    {
+        EXPECT_EQ(InitialStatus, SHADER_STATUS_READY);
+    }
+
+    EXPECT_EQ(pPS->GetStatus(true), SHADER_STATUS_READY);
+    EXPECT_EQ(pPS->GetStatus(), SHADER_STATUS_READY);
+
+    if (deviceCaps.Features.ShaderResourceQueries && !deviceCaps.IsNullDevice())
+    {
+        EXPECT_EQ(pPS->GetResourceCount(), 1u);
+    }
+
+    // Synchronous shaders are ready immediately
+    auto pSyncPS = CreateTestShader(pDevice, SHADER_TYPE_PIXEL, "Sync shader status test PS", AsyncShaderTestPS.c_str(), 65, SHADER_COMPILE_FLAG_NONE);
+    ASSERT_NE(pSyncPS, nullptr);
+    EXPECT_EQ(pSyncPS->GetStatus(), SHADER_STATUS_READY);
+}
+
+// A shader that fails to compile asynchronously is created, but its status becomes SHADER_STATUS_FAILED
+// and pipeline states cannot be created from it. Synchronous backends fail to create the shader.
+TEST(AsyncShaderCompilation, FailedCompilation)
+{
+    auto* pEnv       = TestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto& deviceCaps = pDevice->GetDeviceCaps();
+    if (deviceCaps.IsNullDevice())
+    {
+        GTEST_SKIP() << "Null device does not compile shaders";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pVS = CreateTestVS(pDevice, 1, SHADER_COMPILE_FLAG_NONE);
+    ASSERT_NE(pVS, nullptr);
+
+    pEnv->SetErrorAllowance(8, "\n\nNo worries, testing broken shader...\n\n");
+
+    auto pPS = CreateTestShader(pDevice, SHADER_TYPE_PIXEL, "Broken async shader test PS", BrokenAsyncShaderTestPS.c_str(), 1, SHADER_COMPILE_FLAG_ASYNCHRONOUS);
+    if (!CompilesAsynchronously(deviceCaps))
+    {
+        EXPECT_EQ(pPS, nullptr);
+        return;
+    }
+    ASSERT_NE(pPS, nullptr);
+
+    const auto InitialStatus = pPS->GetStatus();
+    EXPECT_TRUE(InitialStatus == SHADER_STATUS_COMPILING || InitialStatus == SHADER_STATUS_FAILED) << InitialStatus;
+    EXPECT_EQ(pPS->GetStatus(true), SHADER_STATUS_FAILED);
+    EXPECT_EQ(pPS->GetStatus(), SHADER_STATUS_FAILED);
+
+    auto pPSO = CreateTestPSO(pDevice, pVS, pPS);
+    EXPECT_EQ(pPSO, nullptr);
+}
+
+// Pipeline states created from shaders that are still being compiled wait for the compilation to finish
+TEST(AsyncShaderCompilation, PipelineWaitsForShaders)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        // Long loops make it likely that the pixel shader is still being compiled
+        const int Iterations = 256 + i;
+
+        auto pVS = CreateTestVS(pDevice, Iterations, SHADER_COMPILE_FLAG_ASYNCHRONOUS);
+        auto pPS = CreateTestShader(pDevice, SHADER_TYPE_PIXEL, "Async shader test PS", AsyncShaderTestPS.c_str(), Iterations, SHADER_COMPILE_FLAG_ASYNCHRONOUS);
+        ASSERT_NE(pVS, nullptr);
+        ASSERT_NE(pPS, nullptr);
+
+        auto pPSO = CreateTestPSO(pDevice, pVS, pPS);
+        ASSERT_NE(pPSO, nullptr);
+        EXPECT_EQ(pPSO->GetStatus(true), PIPELINE_STATE_STATUS_READY);
+
+        EXPECT_EQ(pVS->GetStatus(), SHADER_STATUS_READY);
+        EXPECT_EQ(pPS->GetStatus(), SHADER_STATUS_READY);
+        EXPECT_NE(pPSO->GetStaticVariableByName(SHADER_TYPE_PIXEL, "Constants"), nullptr);
+    }
+}
+
+} // namespace
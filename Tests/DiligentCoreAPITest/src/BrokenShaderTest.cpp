@@ -72,6 +72,10 @@ void TestBrokenShader(const char* Source, const char* Name, SHADER_SOURCE_LANGUA
 {
     auto* pEnv    = TestingEnvironment::GetInstance();
     auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceCaps().IsNullDevice())
+    {
+        GTEST_SKIP() << "Null device does not compile shaders";
+    }
 
     TestingEnvironment::ScopedReset EnvironmentAutoReset;
 
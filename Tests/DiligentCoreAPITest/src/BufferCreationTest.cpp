@@ -45,6 +45,10 @@
 #    include "Metal/CreateObjFromNativeResMtl.hpp"
 #endif
 
+#if NULL_SUPPORTED
+#    include "Null/CreateObjFromNativeResNull.hpp"
+#endif
+
 #include "GraphicsAccessories.hpp"
 
 #include "TestingEnvironment.hpp"
@@ -105,6 +109,12 @@ protected:
                 pCreateObjFromNativeRes.reset(new TestCreateObjFromNativeResMtl(pDevice));
                 break;
 #endif
+
+#if NULL_SUPPORTED
+            case RENDER_DEVICE_TYPE_NULL:
+                pCreateObjFromNativeRes.reset(new TestCreateObjFromNativeResNull(pDevice));
+                break;
+#endif
             default: UNEXPECTED("Unexpected device type");
         }
     }
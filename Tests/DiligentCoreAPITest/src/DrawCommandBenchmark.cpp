@@ -0,0 +1,193 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "BasicMath.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// clang-format off
+const std::string DrawBenchmarkVS{
+R"(
+void main(in  float4 Pos : ATTRIB0,
+          out float4 PosOut : SV_POSITION)
+{
+    PosOut = Pos;
+}
+)"
+};
+
+const std::string DrawBenchmarkPS{
+R"(
+float4 main(in float4 Pos : SV_POSITION) : SV_Target
+{
+    return float4(1.0, 0.0, 0.0, 1.0);
+}
+)"
+};
+// clang-format on
+
+// Measures the CPU time it takes to record a large number of indexed draws with
+// individual DrawIndexed() calls and with a single MultiDrawIndexed() call.
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. DrawCommandTest.MultiDrawIndexed_MatchesIndividualDraws verifies the rendering.
+TEST(DrawCommandBenchmark, DISABLED_MultiDrawIndexed)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr TEXTURE_FORMAT RTVFormat = TEX_FORMAT_RGBA8_UNORM;
+
+    auto pRT = pEnv->CreateTexture("Draw command benchmark render target", RTVFormat, BIND_RENDER_TARGET, 256, 256);
+    ASSERT_NE(pRT, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.EntryPoint                 = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCI.Desc.Name       = "Draw command benchmark vertex shader";
+        ShaderCI.Source          = DrawBenchmarkVS.c_str();
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCI.Desc.Name       = "Draw command benchmark pixel shader";
+        ShaderCI.Source          = DrawBenchmarkPS.c_str();
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    auto& PSODesc          = PSOCreateInfo.PSODesc;
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSODesc.Name                                  = "Draw command benchmark";
+    PSODesc.PipelineType                          = PIPELINE_TYPE_GRAPHICS;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = RTVFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    LayoutElement Elems[] = {LayoutElement{0, 0, 4, VT_FLOAT32}};
+
+    GraphicsPipeline.InputLayout.LayoutElements = Elems;
+    GraphicsPipeline.InputLayout.NumElements    = _countof(Elems);
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    const float4 Vertices[] =
+        {
+            float4{-0.5f, -0.5f, 0.f, 1.f},
+            float4{+0.0f, +0.5f, 0.f, 1.f},
+            float4{+0.5f, -0.5f, 0.f, 1.f} //
+        };
+    const Uint32 Indices[] = {0, 1, 2};
+
+    RefCntAutoPtr<IBuffer> pVB;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name          = "Draw command benchmark vertex buffer";
+        BuffDesc.BindFlags     = BIND_VERTEX_BUFFER;
+        BuffDesc.uiSizeInBytes = sizeof(Vertices);
+        BufferData InitData{Vertices, sizeof(Vertices)};
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pVB);
+        ASSERT_NE(pVB, nullptr);
+    }
+
+    RefCntAutoPtr<IBuffer> pIB;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name          = "Draw command benchmark index buffer";
+        BuffDesc.BindFlags     = BIND_INDEX_BUFFER;
+        BuffDesc.uiSizeInBytes = sizeof(Indices);
+        BufferData InitData{Indices, sizeof(Indices)};
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pIB);
+        ASSERT_NE(pIB, nullptr);
+    }
+
+    ITextureView* pRTVs[] = {pRT->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET)};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetPipelineState(pPSO);
+
+    IBuffer* pVBs[]    = {pVB};
+    Uint32   Offsets[] = {0};
+    pContext->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+    pContext->SetIndexBuffer(pIB, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    constexpr Uint32                        NumDraws = 100000;
+    const std::vector<MultiDrawIndexedItem> DrawItems(NumDraws, MultiDrawIndexedItem{3});
+
+    Timer T;
+    for (const auto& Item : DrawItems)
+    {
+        DrawIndexedAttribs drawAttrs{Item.NumIndices, VT_UINT32, DRAW_FLAG_NONE};
+        pContext->DrawIndexed(drawAttrs);
+    }
+    const auto DrawIndexedTime = T.GetElapsedTime();
+
+    T.Restart();
+    MultiDrawIndexedAttribs drawAttrs{NumDraws, DrawItems.data(), VT_UINT32, DRAW_FLAG_NONE};
+    pContext->MultiDrawIndexed(drawAttrs);
+    const auto MultiDrawIndexedTime = T.GetElapsedTime();
+
+    std::cout << "[          ] " << NumDraws << " draws: DrawIndexed: " << DrawIndexedTime * 1e3
+              << " ms, MultiDrawIndexed: " << MultiDrawIndexedTime * 1e3 << " ms" << std::endl;
+
+    pContext->Flush();
+    pContext->WaitForIdle();
+}
+
+} // namespace
@@ -27,10 +27,15 @@
 
 #include <thread>
 #include <array>
+#include <vector>
+#include <functional>
+#include <cstring>
 
 #include "TestingEnvironment.hpp"
 #include "TestingSwapChainBase.hpp"
 #include "BasicMath.hpp"
+#include "GraphicsAccessories.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
 
 #include "gtest/gtest.h"
 
@@ -227,6 +232,16 @@ Vertex VertInst[] =
 };
 // clang-format on
 
+// Scale and bias of the instances drawn by multi-draw tests: a 5x5 grid of small triangles
+constexpr Uint32 NumMultiDrawItems = 8;
+
+const std::vector<float4> MultiDrawInstanceData = []() {
+    std::vector<float4> ScaleBias;
+    for (Uint32 i = 0; i < 25; ++i)
+        ScaleBias.emplace_back(0.2f, 0.2f, -0.8f + 0.4f * static_cast<float>(i % 5), -0.9f + 0.4f * static_cast<float>(i / 5));
+    return ScaleBias;
+}();
+
 class DrawCommandTest : public ::testing::Test
 {
 protected:
@@ -389,6 +404,62 @@ protected:
         pContext->InvalidateState();
     }
 
+    // Renders the commands recorded by Draw() with the instanced pipeline into an offscreen render
+    // target and returns the contents of the target. Returns an empty array on the Null device.
+    static std::vector<Uint8> RenderOffscreen(const std::function<void()>& Draw)
+    {
+        auto* pEnv       = TestingEnvironment::GetInstance();
+        auto* pDevice    = pEnv->GetDevice();
+        auto* pContext   = pEnv->GetDeviceContext();
+        auto* pSwapChain = pEnv->GetSwapChain();
+
+        const auto& SCDesc = pSwapChain->GetDesc();
+
+        auto pRT = pEnv->CreateTexture("Draw command test offscreen render target", SCDesc.ColorBufferFormat, BIND_RENDER_TARGET, SCDesc.Width, SCDesc.Height);
+        VERIFY_EXPR(pRT);
+
+        ITextureView* pRTVs[] = {pRT->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET)};
+        pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        const float ClearColor[] = {0.f, 0.f, 0.f, 0.0f};
+        pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        pContext->SetPipelineState(sm_pDrawInstancedPSO);
+        Draw();
+
+        std::vector<Uint8> Pixels;
+        if (!pDevice->GetDeviceCaps().IsNullDevice())
+        {
+            auto StagingDesc           = pRT->GetDesc();
+            StagingDesc.Name           = "Draw command test staging texture";
+            StagingDesc.Usage          = USAGE_STAGING;
+            StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+            StagingDesc.BindFlags      = BIND_NONE;
+
+            RefCntAutoPtr<ITexture> pStagingTex;
+            pDevice->CreateTexture(StagingDesc, nullptr, &pStagingTex);
+            VERIFY_EXPR(pStagingTex);
+
+            CopyTextureAttribs CopyAttribs{pRT, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+            pContext->CopyTexture(CopyAttribs);
+            pContext->WaitForIdle();
+
+            const auto RowSize = SCDesc.Width * GetTextureFormatAttribs(SCDesc.ColorBufferFormat).GetElementSize();
+            Pixels.resize(size_t{RowSize} * SCDesc.Height);
+
+            MappedTextureSubresource MappedData;
+            pContext->MapTextureSubresource(pStagingTex, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+            for (Uint32 row = 0; row < SCDesc.Height; ++row)
+                memcpy(&Pixels[size_t{RowSize} * row], static_cast<const Uint8*>(MappedData.pData) + size_t{MappedData.Stride} * row, RowSize);
+            pContext->UnmapTextureSubresource(pStagingTex, 0, 0);
+        }
+
+        pContext->Flush();
+        pContext->InvalidateState();
+
+        return Pixels;
+    }
+
     RefCntAutoPtr<IBuffer> CreateVertexBuffer(const void* VertexData, Uint32 DataSize)
     {
         BufferDesc BuffDesc;
@@ -1492,6 +1563,230 @@ TEST_F(DrawCommandTest, DrawIndexedInstancedIndirect_FirstInstance_BaseVertex_Fi
     Present();
 }
 
+// Multi-draw calls
+
+TEST_F(DrawCommandTest, MultiDraw)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SetRenderTargets(sm_pDrawPSO);
+
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        Vert[0], Vert[1], Vert[2],
+        {}, {},
+        Vert[3], Vert[4], Vert[5]
+    };
+    // clang-format on
+
+    auto     pVB       = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    IBuffer* pVBs[]    = {pVB};
+    Uint32   Offsets[] = {0};
+    pContext->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+
+    const MultiDrawItem DrawItems[] = {{3, 1, 0}, {3, 1, 5}};
+    MultiDrawAttribs    drawAttrs{_countof(DrawItems), DrawItems, DRAW_FLAG_VERIFY_ALL};
+    pContext->MultiDraw(drawAttrs);
+
+    Present();
+}
+
+TEST_F(DrawCommandTest, MultiDrawIndexed_IBOffset_BaseVertex)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SetRenderTargets(sm_pDrawPSO);
+
+    Uint32 bv = 2; // Base vertex of the second draw
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        {}, {},
+        Vert[0], {}, Vert[1], {}, {}, Vert[2],
+        Vert[3], {}, {}, Vert[5], Vert[4]
+    };
+    Uint32 Indices[] = {0,0,0,0, 2,4,7, 0, 8-bv,12-bv,11-bv};
+    // clang-format on
+
+    auto pVB = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    auto pIB = CreateIndexBuffer(Indices, _countof(Indices));
+
+    IBuffer* pVBs[]    = {pVB};
+    Uint32   Offsets[] = {0};
+    pContext->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+    pContext->SetIndexBuffer(pIB, sizeof(Uint32) * 4, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    const MultiDrawIndexedItem DrawItems[] = {{3, 1, 0, 0}, {3, 1, 4, bv}};
+    MultiDrawIndexedAttribs    drawAttrs{_countof(DrawItems), DrawItems, VT_UINT32, DRAW_FLAG_VERIFY_ALL};
+    pContext->MultiDrawIndexed(drawAttrs);
+
+    Present();
+}
+
+// Renders the same instanced triangles with individual draws and with a single
+// multi-draw command into offscreen render targets and compares the results.
+TEST_F(DrawCommandTest, MultiDraw_MatchesIndividualDraws)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        {}, {},
+        VertInst[0], VertInst[1], VertInst[2]
+    };
+    // clang-format on
+
+    auto pVB     = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    auto pInstVB = CreateVertexBuffer(MultiDrawInstanceData.data(), static_cast<Uint32>(sizeof(float4) * MultiDrawInstanceData.size()));
+
+    std::vector<MultiDrawItem> DrawItems;
+    for (Uint32 i = 0; i < NumMultiDrawItems; ++i)
+        DrawItems.emplace_back(3, 1 + i % 3, 2, 2 * i);
+
+    const auto MultiDrawPixels = RenderOffscreen(
+        [&]() //
+        {
+            IBuffer* pVBs[]    = {pVB, pInstVB};
+            Uint32   Offsets[] = {0, 0};
+            pContext->SetVertexBuffers(0, 2, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+
+            MultiDrawAttribs drawAttrs{static_cast<Uint32>(DrawItems.size()), DrawItems.data(), DRAW_FLAG_VERIFY_ALL};
+            pContext->MultiDraw(drawAttrs);
+        });
+
+    const auto DrawPixels = RenderOffscreen(
+        [&]() //
+        {
+            IBuffer* pVBs[]    = {pVB, pInstVB};
+            Uint32   Offsets[] = {0, 0};
+            pContext->SetVertexBuffers(0, 2, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+
+            for (const auto& Item : DrawItems)
+            {
+                DrawAttribs drawAttrs{Item.NumVertices, DRAW_FLAG_VERIFY_ALL, Item.NumInstances, Item.StartVertexLocation, Item.FirstInstanceLocation};
+                pContext->Draw(drawAttrs);
+            }
+        });
+
+    if (!pEnv->GetDevice()->GetDeviceCaps().IsNullDevice())
+    {
+        ASSERT_EQ(MultiDrawPixels.size(), DrawPixels.size());
+        EXPECT_TRUE(MultiDrawPixels == DrawPixels);
+    }
+}
+
+TEST_F(DrawCommandTest, MultiDrawIndexed_MatchesIndividualDraws)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    Uint32 bv = 1; // Base vertex of odd draws
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        {},
+        VertInst[0], VertInst[1], VertInst[2]
+    };
+    Uint32 Indices[] = {0,0, 1,2,3, 1-bv,2-bv,3-bv};
+    // clang-format on
+
+    auto pVB     = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    auto pIB     = CreateIndexBuffer(Indices, _countof(Indices));
+    auto pInstVB = CreateVertexBuffer(MultiDrawInstanceData.data(), static_cast<Uint32>(sizeof(float4) * MultiDrawInstanceData.size()));
+
+    std::vector<MultiDrawIndexedItem> DrawItems;
+    for (Uint32 i = 0; i < NumMultiDrawItems; ++i)
+    {
+        const bool IsOdd = (i % 2) != 0;
+        DrawItems.emplace_back(3, 1 + i % 3, IsOdd ? 5 : 2, IsOdd ? bv : 0, 2 * i);
+    }
+
+    auto SetBuffers = [&]() //
+    {
+        IBuffer* pVBs[]    = {pVB, pInstVB};
+        Uint32   Offsets[] = {0, 0};
+        pContext->SetVertexBuffers(0, 2, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+        pContext->SetIndexBuffer(pIB, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    };
+
+    const auto MultiDrawPixels = RenderOffscreen(
+        [&]() //
+        {
+            SetBuffers();
+            MultiDrawIndexedAttribs drawAttrs{static_cast<Uint32>(DrawItems.size()), DrawItems.data(), VT_UINT32, DRAW_FLAG_VERIFY_ALL};
+            pContext->MultiDrawIndexed(drawAttrs);
+        });
+
+    const auto DrawPixels = RenderOffscreen(
+        [&]() //
+        {
+            SetBuffers();
+            for (const auto& Item : DrawItems)
+            {
+                DrawIndexedAttribs drawAttrs{Item.NumIndices, VT_UINT32, DRAW_FLAG_VERIFY_ALL, Item.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Item.FirstInstanceLocation};
+                pContext->DrawIndexed(drawAttrs);
+            }
+        });
+
+    if (!pEnv->GetDevice()->GetDeviceCaps().IsNullDevice())
+    {
+        ASSERT_EQ(MultiDrawPixels.size(), DrawPixels.size());
+        EXPECT_TRUE(MultiDrawPixels == DrawPixels);
+    }
+}
+
+// Records the same draw commands over several frames and verifies that once the context has
+// warmed up, draw calls do not allocate memory.
+TEST_F(DrawCommandTest, SteadyStateDrawAllocations)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    // clang-format off
+    const Vertex Triangles[] =
+    {
+        Vert[0], Vert[1], Vert[2],
+        Vert[3], Vert[4], Vert[5]
+    };
+    // clang-format on
+
+    auto     pVB       = CreateVertexBuffer(Triangles, sizeof(Triangles));
+    IBuffer* pVBs[]    = {pVB};
+    Uint32   Offsets[] = {0};
+
+    const auto& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    constexpr Uint32 NumFrames = 3;
+    constexpr Uint32 NumDraws  = 256;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        SetRenderTargets(sm_pDrawPSO);
+        pContext->SetVertexBuffers(0, 1, pVBs, Offsets, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, SET_VERTEX_BUFFERS_FLAG_RESET);
+
+        const auto StartAllocationCount = RawAllocator.GetAllocationCount();
+        for (Uint32 i = 0; i < NumDraws; ++i)
+        {
+            DrawAttribs drawAttrs{6, DRAW_FLAG_VERIFY_ALL};
+            pContext->Draw(drawAttrs);
+        }
+        const auto NumAllocations = RawAllocator.GetAllocationCount() - StartAllocationCount;
+
+        // The first frame may create render passes, framebuffers, etc.
+        if (frame > 0)
+        {
+            EXPECT_EQ(NumAllocations, 0u) << "frame " << frame;
+        }
+
+        Present();
+        pContext->FinishFrame();
+    }
+}
+
 TEST_F(DrawCommandTest, DeferredContexts)
 {
     auto* pEnv = TestingEnvironment::GetInstance();
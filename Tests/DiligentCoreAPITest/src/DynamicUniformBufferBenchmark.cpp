@@ -0,0 +1,233 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "TestingEnvironment.hpp"
+#include "GraphicsAccessories.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// clang-format off
+const std::string UniformUpdateBenchmarkCS{
+R"(
+cbuffer Constants
+{
+    float4 g_Data[16];
+};
+
+RWTexture2D</*format=rgba8*/ float4> g_Output;
+
+[numthreads(1, 1, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    // Every update writes its own texel, so that the data seen by each dispatch can be verified
+    g_Output[uint2(uint(g_Data[15].x), 0u)] = g_Data[0];
+}
+)"
+};
+// clang-format on
+
+// Measures the throughput of uniform buffer updates: every update writes the buffer
+// and dispatches a compute shader that reads it. Dynamic buffers are updated with
+// MapBuffer(MAP_FLAG_DISCARD), default buffers are updated with UpdateBuffer().
+// The shader writes the data to the output texture, which is verified after the last frame.
+void TestUniformBufferUpdates(Uint32 NumFrames, Uint32 NumUpdatesPerFrame, bool PrintTiming)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceCaps().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Desc.Name                  = "Uniform update benchmark CS";
+    ShaderCI.Source                     = UniformUpdateBenchmarkCS.c_str();
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+
+    PSOCreateInfo.PSODesc.Name                               = "Uniform update benchmark";
+    PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+    PSOCreateInfo.pCS                                        = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    auto pOutput = pEnv->CreateTexture("Uniform update benchmark output", TEX_FORMAT_RGBA8_UNORM, BIND_UNORDERED_ACCESS, NumUpdatesPerFrame, 1);
+    ASSERT_NE(pOutput, nullptr);
+
+    RefCntAutoPtr<ITexture> pStagingTex;
+    if (!pDevice->GetDeviceCaps().IsNullDevice())
+    {
+        auto StagingDesc           = pOutput->GetDesc();
+        StagingDesc.Name           = "Uniform update benchmark staging texture";
+        StagingDesc.Usage          = USAGE_STAGING;
+        StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        StagingDesc.BindFlags      = BIND_NONE;
+        pDevice->CreateTexture(StagingDesc, nullptr, &pStagingTex);
+        ASSERT_NE(pStagingTex, nullptr);
+    }
+
+    // The color written by the given update in the given frame
+    auto GetUpdateColor = [](Uint32 Frame, Uint32 Update, Uint8* Color) //
+    {
+        Color[0] = static_cast<Uint8>(Update & 0xFF);
+        Color[1] = static_cast<Uint8>(Update >> 8);
+        Color[2] = static_cast<Uint8>(Frame);
+        Color[3] = 255;
+    };
+
+    float Data[16 * 4] = {};
+
+    auto RunBenchmark = [&](const char* Name, USAGE Usage) {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Uniform update benchmark buffer";
+        BuffDesc.uiSizeInBytes  = sizeof(Data);
+        BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+        BuffDesc.Usage          = Usage;
+        BuffDesc.CPUAccessFlags = Usage == USAGE_DYNAMIC ? CPU_ACCESS_WRITE : CPU_ACCESS_NONE;
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+        pPSO->CreateShaderResourceBinding(&pSRB, true);
+        ASSERT_NE(pSRB, nullptr);
+        pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "Constants")->Set(pBuffer);
+        pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Output")->Set(pOutput->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS));
+
+        pContext->SetPipelineState(pPSO);
+
+        const auto StartTime = std::chrono::high_resolution_clock::now();
+        for (Uint32 frame = 0; frame < NumFrames; ++frame)
+        {
+            for (Uint32 upd = 0; upd < NumUpdatesPerFrame; ++upd)
+            {
+                Uint8 Color[4];
+                GetUpdateColor(frame, upd, Color);
+                for (Uint32 c = 0; c < 4; ++c)
+                    Data[c] = static_cast<float>(Color[c]) / 255.f;
+                Data[15 * 4] = static_cast<float>(upd);
+
+                if (Usage == USAGE_DYNAMIC)
+                {
+                    void* pMappedData = nullptr;
+                    pContext->MapBuffer(pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pMappedData);
+                    ASSERT_NE(pMappedData, nullptr);
+                    memcpy(pMappedData, Data, sizeof(Data));
+                    pContext->UnmapBuffer(pBuffer, MAP_WRITE);
+                }
+                else
+                {
+                    pContext->UpdateBuffer(pBuffer, 0, sizeof(Data), Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                }
+
+                pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                pContext->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+            }
+            pContext->Flush();
+            pContext->FinishFrame();
+        }
+        pContext->WaitForIdle();
+        const auto EndTime = std::chrono::high_resolution_clock::now();
+
+        if (PrintTiming)
+        {
+            const auto Time = std::chrono::duration_cast<std::chrono::duration<double>>(EndTime - StartTime).count();
+            std::cout << "[          ] " << Name << ": "
+                      << Time * 1e9 / (NumFrames * NumUpdatesPerFrame) << " ns/update, "
+                      << static_cast<double>(NumFrames * NumUpdatesPerFrame) * sizeof(Data) / Time / (1 << 20) << " MB/s" << std::endl;
+        }
+
+        if (pStagingTex)
+        {
+            CopyTextureAttribs CopyAttribs{pOutput, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+            pContext->CopyTexture(CopyAttribs);
+            pContext->WaitForIdle();
+
+            MappedTextureSubresource MappedData;
+            pContext->MapTextureSubresource(pStagingTex, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+            ASSERT_NE(MappedData.pData, nullptr);
+
+            Uint32 NumMismatches = 0;
+            for (Uint32 upd = 0; upd < NumUpdatesPerFrame; ++upd)
+            {
+                Uint8 Color[4];
+                GetUpdateColor(NumFrames - 1, upd, Color);
+                if (memcmp(static_cast<const Uint8*>(MappedData.pData) + upd * 4, Color, sizeof(Color)) != 0)
+                    ++NumMismatches;
+            }
+            pContext->UnmapTextureSubresource(pStagingTex, 0, 0);
+            EXPECT_EQ(NumMismatches, 0u) << Name << ": dispatches read wrong uniform buffer data";
+        }
+
+        pDevice->ReleaseStaleResources();
+    };
+
+    RunBenchmark("MapBuffer(MAP_FLAG_DISCARD)", USAGE_DYNAMIC);
+    RunBenchmark("UpdateBuffer", USAGE_DEFAULT);
+}
+
+// Verifies that every dispatch reads the data written by its own uniform buffer update.
+TEST(DynamicUniformBufferTest, Updates)
+{
+    TestUniformBufferUpdates(4, 256, false);
+}
+
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. DynamicUniformBufferTest.Updates verifies the data.
+TEST(DynamicUniformBufferBenchmark, DISABLED_UpdateThroughput)
+{
+    TestUniformBufferUpdates(16, 1024, true);
+}
+
+} // namespace
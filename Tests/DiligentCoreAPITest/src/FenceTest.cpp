@@ -0,0 +1,266 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+RefCntAutoPtr<IFence> CreateTestFence(IRenderDevice* pDevice, const char* Name)
+{
+    FenceDesc Desc;
+    Desc.Name = Name;
+    RefCntAutoPtr<IFence> pFence;
+    pDevice->CreateFence(Desc, &pFence);
+    return pFence;
+}
+
+TEST(FenceTest, SignalAndWait)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pFence = CreateTestFence(pDevice, "Fence test");
+    ASSERT_NE(pFence, nullptr);
+    EXPECT_EQ(pFence->GetCompletedValue(), Uint64{0});
+
+    constexpr Uint64 NumSignals = 16;
+    for (Uint64 Value = 1; Value <= NumSignals; ++Value)
+    {
+        pContext->SignalFence(pFence, Value);
+        pContext->Flush();
+    }
+    pContext->WaitForFence(pFence, NumSignals, false);
+    EXPECT_EQ(pFence->GetCompletedValue(), NumSignals);
+
+    // Several values signaled in the same batch
+    pContext->SignalFence(pFence, NumSignals + 1);
+    pContext->SignalFence(pFence, NumSignals + 2);
+    pContext->WaitForFence(pFence, NumSignals + 2, true);
+    EXPECT_EQ(pFence->GetCompletedValue(), NumSignals + 2);
+
+    pFence->Reset(NumSignals + 10);
+    EXPECT_EQ(pFence->GetCompletedValue(), NumSignals + 10);
+
+    pContext->SignalFence(pFence, NumSignals + 11);
+    pContext->WaitForFence(pFence, NumSignals + 11, true);
+    EXPECT_EQ(pFence->GetCompletedValue(), NumSignals + 11);
+}
+
+TEST(FenceTest, DeviceWait)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pProducerFence = CreateTestFence(pDevice, "Producer fence");
+    auto pConsumerFence = CreateTestFence(pDevice, "Consumer fence");
+    ASSERT_NE(pProducerFence, nullptr);
+    ASSERT_NE(pConsumerFence, nullptr);
+
+    for (Uint64 Value = 1; Value <= 4; ++Value)
+    {
+        pContext->SignalFence(pProducerFence, Value);
+        pContext->Flush();
+
+        pContext->DeviceWaitForFence(pProducerFence, Value);
+        pContext->SignalFence(pConsumerFence, Value);
+        pContext->Flush();
+    }
+
+    pContext->WaitForFence(pConsumerFence, 4, false);
+    EXPECT_EQ(pConsumerFence->GetCompletedValue(), Uint64{4});
+    EXPECT_GE(pProducerFence->GetCompletedValue(), Uint64{4});
+}
+
+// Waits for values that are signaled by the same context in the same batch, and for values
+// that were reached by resetting the fence from the host. Both used to deadlock the queue.
+TEST(FenceTest, DeviceWaitForPendingOrResetValue)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pFence = CreateTestFence(pDevice, "Pending signal fence");
+    ASSERT_NE(pFence, nullptr);
+
+    // The signal has not been submitted when the wait is recorded
+    pContext->SignalFence(pFence, 1);
+    pContext->DeviceWaitForFence(pFence, 1);
+    pContext->Flush();
+    pContext->WaitForIdle();
+    EXPECT_EQ(pFence->GetCompletedValue(), Uint64{1});
+
+    // The fence is reset past a value that has been signaled, but not yet reached by the GPU
+    pContext->SignalFence(pFence, 2);
+    pContext->Flush();
+    pFence->Reset(8);
+    pContext->DeviceWaitForFence(pFence, 8);
+    pContext->Flush();
+    pContext->WaitForIdle();
+    EXPECT_GE(pFence->GetCompletedValue(), Uint64{8});
+}
+
+// Copies a buffer on the transfer (or async compute) queue and reads the result back on
+// the main queue. The queues are only synchronized with DeviceWaitForFence().
+// Run the tests with --vk_transfer_queue or --vk_compute_queue to enable the queues.
+TEST(FenceTest, CrossQueueWait)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    auto* pQueueContext = pEnv->GetTransferContext() != nullptr ? pEnv->GetTransferContext() : pEnv->GetComputeContext();
+    if (pQueueContext == nullptr)
+    {
+        GTEST_SKIP() << "Neither transfer nor async compute queue is enabled";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 BufferSize = 1024;
+
+    std::vector<Uint8> RefData(BufferSize);
+    for (Uint32 i = 0; i < BufferSize; ++i)
+        RefData[i] = static_cast<Uint8>((i * 7) & 0xFF);
+
+    auto CreateBuffer = [&](const char* Name, USAGE Usage, const void* pInitData) //
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name          = Name;
+        BuffDesc.uiSizeInBytes = BufferSize;
+        BuffDesc.Usage         = Usage;
+        if (Usage == USAGE_STAGING)
+            BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        else
+            BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+        // The buffers are accessed by both queues
+        BuffDesc.CommandQueueMask = ~Uint64{0};
+
+        BufferData InitData{pInitData, BufferSize};
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        pDevice->CreateBuffer(BuffDesc, pInitData != nullptr ? &InitData : nullptr, &pBuffer);
+        return pBuffer;
+    };
+
+    auto pSrcBuffer     = CreateBuffer("Cross-queue fence test - src", USAGE_DEFAULT, RefData.data());
+    auto pDstBuffer     = CreateBuffer("Cross-queue fence test - dst", USAGE_DEFAULT, nullptr);
+    auto pStagingBuffer = CreateBuffer("Cross-queue fence test - staging", USAGE_STAGING, nullptr);
+    ASSERT_TRUE(pSrcBuffer && pDstBuffer && pStagingBuffer);
+
+    auto pFence = CreateTestFence(pDevice, "Cross-queue fence");
+    ASSERT_NE(pFence, nullptr);
+
+    // Main queue -> transfer queue: the buffers are initialized by the main queue
+    pContext->SignalFence(pFence, 1);
+    pContext->Flush();
+
+    pQueueContext->DeviceWaitForFence(pFence, 1);
+    pQueueContext->CopyBuffer(pSrcBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                              pDstBuffer, 0, BufferSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pQueueContext->SignalFence(pFence, 2);
+    pQueueContext->Flush();
+
+    // Transfer queue -> main queue
+    pContext->DeviceWaitForFence(pFence, 2);
+    pContext->CopyBuffer(pDstBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuffer, 0, BufferSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+    EXPECT_GE(pFence->GetCompletedValue(), Uint64{2});
+
+    void* pData = nullptr;
+    pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    EXPECT_EQ(memcmp(pData, RefData.data(), BufferSize), 0);
+    pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+}
+
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. It measures the cost of signaling a fence on every submission and of polling
+// its completed value. With timeline semaphores, no VkFence is allocated per signal and
+// polling does not walk the list of pending fences.
+TEST(FenceBenchmark, DISABLED_SignalAndPoll)
+{
+    auto* pEnv     = TestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pFence = CreateTestFence(pDevice, "Fence benchmark");
+    ASSERT_NE(pFence, nullptr);
+
+    constexpr Uint64 NumSignals = 4096;
+
+    const auto SignalStartTime = std::chrono::high_resolution_clock::now();
+    for (Uint64 Value = 1; Value <= NumSignals; ++Value)
+    {
+        pContext->SignalFence(pFence, Value);
+        pContext->Flush();
+    }
+    const auto SignalEndTime = std::chrono::high_resolution_clock::now();
+
+    Uint64 CompletedValue = 0;
+
+    const auto PollStartTime = std::chrono::high_resolution_clock::now();
+    for (Uint64 i = 0; i < NumSignals; ++i)
+        CompletedValue = std::max(CompletedValue, pFence->GetCompletedValue());
+    const auto PollEndTime = std::chrono::high_resolution_clock::now();
+
+    pContext->WaitForFence(pFence, NumSignals, false);
+    EXPECT_EQ(pFence->GetCompletedValue(), NumSignals);
+    EXPECT_LE(CompletedValue, NumSignals);
+
+    const auto SignalTime = std::chrono::duration_cast<std::chrono::duration<double>>(SignalEndTime - SignalStartTime).count();
+    const auto PollTime   = std::chrono::duration_cast<std::chrono::duration<double>>(PollEndTime - PollStartTime).count();
+    std::cout << "[          ] SignalFence + Flush: " << SignalTime * 1e9 / NumSignals << " ns/signal" << std::endl;
+    std::cout << "[          ] GetCompletedValue: " << PollTime * 1e9 / NumSignals << " ns/poll" << std::endl;
+
+    pContext->FinishFrame();
+    pDevice->ReleaseStaleResources();
+}
+
+} // namespace
@@ -0,0 +1,304 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "GL/TestingEnvironmentGL.hpp"
+#include "../include/GLProgramBinaryCache.hpp"
+
+#include "RenderDeviceGL.h"
+#include "ShaderMacroHelper.hpp"
+#include "FileWrapper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// clang-format off
+const std::string ProgramBinaryCacheTestPS{
+R"(
+cbuffer Constants
+{
+    float4 g_Data[4];
+};
+
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    float4 Color = g_Data[0];
+    for (int i = 0; i < ITERATIONS; ++i)
+        Color = Color * g_Data[1] + g_Data[2] * sin(Color + float(i));
+    return Color + g_Data[3];
+}
+)"
+};
+
+const std::string ProgramBinaryCacheTestGLSL_VS{
+R"(
+#version 420 core
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+void main()
+{
+    gl_Position = vec4(float(gl_VertexID), 0.0, 0.0, 1.0);
+}
+)"
+};
+
+const std::string ProgramBinaryCacheTestGLSL_FS{
+R"(
+#version 420 core
+
+layout(location = 0) out vec4 out_Color;
+
+void main()
+{
+    out_Color = vec4(1.0, 0.0, 0.0, 1.0);
+}
+)"
+};
+// clang-format on
+
+GLuint CreateRetrievableProgram()
+{
+    auto Program = glCreateProgram();
+    glProgramParameteri(Program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    return Program;
+}
+
+bool LinkFromShaders(GLuint Program, GLuint VS, GLuint FS)
+{
+    glAttachShader(Program, VS);
+    glAttachShader(Program, FS);
+    glLinkProgram(Program);
+    glDetachShader(Program, VS);
+    glDetachShader(Program, FS);
+
+    GLint IsLinked = GL_FALSE;
+    glGetProgramiv(Program, GL_LINK_STATUS, &IsLinked);
+    return IsLinked != GL_FALSE;
+}
+
+// Stores a program in the cache in a temporary directory, loads it back, and then verifies
+// that a corrupted entry is rejected and the program can still be linked from the source.
+TEST(ProgramBinaryCacheGL, StoreLoadAndReject)
+{
+    auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+    if (!pDevice->GetDeviceCaps().IsGLDevice())
+    {
+        GTEST_SKIP() << "Program binary cache is only available in OpenGL backend";
+    }
+    if (!GLProgramBinaryCache::IsSupported())
+    {
+        GTEST_SKIP() << "Program binaries are not supported by this device";
+    }
+
+    auto* pEnv = TestingEnvironmentGL::GetInstance();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const auto CacheDir = FileSystem::GetTemporaryDirectory() + FileSystem::GetSlashSymbol() + "DiligentProgramBinaryCacheGLTest";
+    if (FileSystem::PathExists(CacheDir.c_str()))
+        FileSystem::DeleteDirectory(CacheDir.c_str());
+
+    auto VS = pEnv->CompileGLShader(ProgramBinaryCacheTestGLSL_VS, GL_VERTEX_SHADER);
+    auto FS = pEnv->CompileGLShader(ProgramBinaryCacheTestGLSL_FS, GL_FRAGMENT_SHADER);
+    ASSERT_NE(VS, 0u);
+    ASSERT_NE(FS, 0u);
+
+    const auto Key = GLProgramBinaryCache::KeyBuilder{}.Add(ProgramBinaryCacheTestGLSL_VS).Add(ProgramBinaryCacheTestGLSL_FS).Get();
+
+    {
+        GLProgramBinaryCache Cache{CacheDir.c_str(), GLProgramBinaryCache::GetDriverId()};
+
+        // The first program is not in the cache and is linked from the source
+        auto Program = CreateRetrievableProgram();
+        EXPECT_FALSE(Cache.Load(Key, Program));
+        EXPECT_TRUE(LinkFromShaders(Program, VS, FS));
+        Cache.Store(Key, Program);
+        glDeleteProgram(Program);
+
+        const auto Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumMisses, 1u);
+        EXPECT_EQ(Stats.NumStored, 1u);
+        EXPECT_GT(Stats.StoredDataSize, 0u);
+    }
+
+    // The same program is loaded from the cache that is reopened from the same directory
+    GLProgramBinaryCache Cache{CacheDir.c_str(), GLProgramBinaryCache::GetDriverId()};
+    {
+        auto Program = CreateRetrievableProgram();
+        EXPECT_TRUE(Cache.Load(Key, Program));
+        glDeleteProgram(Program);
+
+        const auto Stats = Cache.GetStatistics();
+        EXPECT_GE(Stats.NumHits, 1u);
+        EXPECT_EQ(Stats.NumRejected, 0u);
+    }
+
+    // Corrupt the second half of the entry that contains the program binary
+    {
+        const auto EntryPath = Cache.GetEntryFilePath(Key);
+
+        std::vector<Uint8> Data;
+        {
+            FileWrapper File{EntryPath.c_str(), EFileAccessMode::Read};
+            ASSERT_TRUE(File != nullptr);
+            Data.resize(File->GetSize());
+            ASSERT_FALSE(Data.empty());
+            ASSERT_TRUE(File->Read(Data.data(), Data.size()));
+        }
+
+        for (size_t i = Data.size() / 2; i < Data.size(); ++i)
+            Data[i] ^= 0xA5;
+
+        FileWrapper File{EntryPath.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File != nullptr);
+        ASSERT_TRUE(File->Write(Data.data(), Data.size()));
+    }
+
+    // The corrupted binary is rejected and the program is linked from the source
+    {
+        const auto StatsBefore = Cache.GetStatistics();
+
+        auto Program = CreateRetrievableProgram();
+        EXPECT_FALSE(Cache.Load(Key, Program));
+        EXPECT_TRUE(LinkFromShaders(Program, VS, FS));
+        glDeleteProgram(Program);
+
+        const auto Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumRejected, StatsBefore.NumRejected + 1);
+        EXPECT_EQ(Stats.NumHits, StatsBefore.NumHits);
+    }
+
+    glDeleteShader(VS);
+    glDeleteShader(FS);
+
+    FileSystem::DeleteDirectory(CacheDir.c_str());
+}
+
+constexpr Uint32 NumPrograms = 32;
+
+// Measures the time it takes to create a set of unique shaders and pipeline states.
+// Run the test twice with --gl_program_cache=<dir> to compare cold and warm startup:
+// the first run populates the cache, the second run loads all programs from it.
+TEST(ProgramBinaryCacheGL, CreatePrograms)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IRenderDeviceGL> pDeviceGL{pDevice, IID_RenderDeviceGL};
+    if (!pDeviceGL)
+    {
+        GTEST_SKIP() << "Program binary cache is only available in OpenGL backend";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ProgramBinaryCacheStatistics StatsBefore;
+    pDeviceGL->GetProgramBinaryCacheStatistics(StatsBefore);
+
+    const auto StartTime = std::chrono::high_resolution_clock::now();
+    for (Uint32 i = 0; i < NumPrograms; ++i)
+    {
+        ShaderMacroHelper Macros;
+        Macros.AddShaderMacro("ITERATIONS", static_cast<int>(i + 1));
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.UseCombinedTextureSamplers = true;
+        ShaderCI.EntryPoint                 = "main";
+        ShaderCI.Macros                     = Macros;
+
+        RefCntAutoPtr<IShader> pVS;
+        {
+            ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+            ShaderCI.Desc.Name       = "Program binary cache test VS";
+            ShaderCI.Source          = "float4 main(uint VertId : SV_VertexID) : SV_Position { return float4(float(VertId), 0.0, 0.0, 1.0); }";
+            pDevice->CreateShader(ShaderCI, &pVS);
+            ASSERT_NE(pVS, nullptr);
+        }
+
+        RefCntAutoPtr<IShader> pPS;
+        {
+            ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+            ShaderCI.Desc.Name       = "Program binary cache test PS";
+            ShaderCI.Source          = ProgramBinaryCacheTestPS.c_str();
+            pDevice->CreateShader(ShaderCI, &pPS);
+            ASSERT_NE(pPS, nullptr);
+        }
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+        auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+        PSOCreateInfo.PSODesc.Name         = "Program binary cache test";
+        PSOCreateInfo.pVS                  = pVS;
+        PSOCreateInfo.pPS                  = pPS;
+        GraphicsPipeline.NumRenderTargets  = 1;
+        GraphicsPipeline.RTVFormats[0]     = TEX_FORMAT_RGBA8_UNORM;
+        GraphicsPipeline.PrimitiveTopology = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+    }
+    const auto EndTime = std::chrono::high_resolution_clock::now();
+
+    ProgramBinaryCacheStatistics StatsAfter;
+    pDeviceGL->GetProgramBinaryCacheStatistics(StatsAfter);
+
+    const auto NumHits     = StatsAfter.NumHits - StatsBefore.NumHits;
+    const auto NumMisses   = StatsAfter.NumMisses - StatsBefore.NumMisses;
+    const auto NumRejected = StatsAfter.NumRejected - StatsBefore.NumRejected;
+
+    std::cout << "[          ] Created " << NumPrograms << " pipelines in "
+              << std::chrono::duration<double, std::milli>(EndTime - StartTime).count() << " ms. "
+              << "Program cache hits: " << NumHits << ", misses: " << NumMisses << ", rejected: " << NumRejected
+              << std::endl;
+
+    if (NumHits + NumMisses == 0)
+    {
+        GTEST_SKIP() << "Program binary cache is disabled. Use --gl_program_cache=<dir> to enable it.";
+    }
+
+    // Every program that was not loaded from the cache must have been stored in it
+    EXPECT_EQ(StatsAfter.NumStored - StatsBefore.NumStored, NumMisses);
+}
+
+} // namespace
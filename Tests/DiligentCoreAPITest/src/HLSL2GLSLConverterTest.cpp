@@ -25,8 +25,15 @@
  *  of the possibility of such damages.
  */
 
+#include <string>
+
 #include "TestingEnvironment.hpp"
 #include "HLSL2GLSLConverter.h"
+#include "Timer.hpp"
+
+#if GL_SUPPORTED || GLES_SUPPORTED
+#    include "EngineFactoryOpenGL.h"
+#endif
 
 #include "gtest/gtest.h"
 
@@ -132,4 +139,123 @@ TEST(HLSL2GLSLConverterTest, CS_RWBuff)
     EXPECT_NE(pCS, nullptr);
 }
 
+#if GL_SUPPORTED || GLES_SUPPORTED
+// Converts the test shaders and verifies that a conversion stream that is reused produces
+// the same output as a new stream. If MeasureThroughput is true, also reports the conversion
+// throughput in MB of HLSL source per second.
+void TestConversionStreams(bool MeasureThroughput)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IEngineFactoryOpenGL> pFactoryGL{pDevice->GetEngineFactory(), IID_EngineFactoryOpenGL};
+    if (!pFactoryGL)
+    {
+        GTEST_SKIP() << "HLSL to GLSL converter is only exposed by the OpenGL engine factory";
+    }
+
+    RefCntAutoPtr<IHLSL2GLSLConverter> pConverter;
+    pFactoryGL->CreateHLSL2GLSLConverter(&pConverter);
+    ASSERT_NE(pConverter, nullptr);
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pFactoryGL->CreateDefaultShaderSourceStreamFactory("shaders/HLSL2GLSLConverter", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    struct TestShaderInfo
+    {
+        const char* FileName;
+        const char* EntryPoint;
+        SHADER_TYPE ShaderType;
+    };
+    // clang-format off
+    static constexpr TestShaderInfo TestShaders[] =
+    {
+        {"VS_PS.hlsl",        "TestVS", SHADER_TYPE_VERTEX },
+        {"VS_PS.hlsl",        "TestPS", SHADER_TYPE_PIXEL  },
+        {"CS_RWTex1D.hlsl",   "TestCS", SHADER_TYPE_COMPUTE},
+        {"CS_RWTex2D_1.hlsl", "TestCS", SHADER_TYPE_COMPUTE},
+        {"CS_RWTex2D_2.hlsl", "TestCS", SHADER_TYPE_COMPUTE},
+        {"CS_RWBuff.hlsl",    "TestCS", SHADER_TYPE_COMPUTE}
+    };
+    // clang-format on
+
+    auto Convert = [&](IHLSL2GLSLConversionStream* pStream, const TestShaderInfo& Shader) {
+        RefCntAutoPtr<IDataBlob> pGLSL;
+        pStream->Convert(Shader.EntryPoint, Shader.ShaderType, true, "_sampler", true, &pGLSL);
+        return pGLSL != nullptr ?
+            std::string{reinterpret_cast<const char*>(pGLSL->GetDataPtr()), pGLSL->GetSize()} :
+            std::string{};
+    };
+
+    // Source sizes, and the reference output produced by a new stream for every conversion
+    size_t      SourceSize[_countof(TestShaders)] = {};
+    std::string ReferenceGLSL[_countof(TestShaders)];
+    for (size_t i = 0; i < _countof(TestShaders); ++i)
+    {
+        RefCntAutoPtr<IFileStream> pSourceStream;
+        pShaderSourceFactory->CreateInputStream(TestShaders[i].FileName, &pSourceStream);
+        ASSERT_NE(pSourceStream, nullptr);
+        SourceSize[i] = pSourceStream->GetSize();
+
+        RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+        pConverter->CreateStream(TestShaders[i].FileName, pShaderSourceFactory, nullptr, 0, &pStream);
+        ASSERT_NE(pStream, nullptr) << TestShaders[i].FileName;
+
+        ReferenceGLSL[i] = Convert(pStream, TestShaders[i]);
+        ASSERT_FALSE(ReferenceGLSL[i].empty()) << TestShaders[i].FileName << ", " << TestShaders[i].EntryPoint;
+    }
+
+    // A conversion stream reuses its tokens between conversions and must produce exactly
+    // the same output as a new stream, no matter how many times it is converted.
+    {
+        RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+        pConverter->CreateStream(TestShaders[0].FileName, pShaderSourceFactory, nullptr, 0, &pStream);
+        ASSERT_NE(pStream, nullptr);
+        for (Uint32 Pass = 0; Pass < 2; ++Pass)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                EXPECT_EQ(Convert(pStream, TestShaders[i]), ReferenceGLSL[i]) << TestShaders[i].EntryPoint << ", pass " << Pass;
+            }
+        }
+    }
+
+    if (!MeasureThroughput)
+        return;
+
+    constexpr Uint32 NumIterations = 20;
+
+    size_t TotalSize = 0;
+    Timer  ConversionTimer;
+    for (Uint32 Iter = 0; Iter < NumIterations; ++Iter)
+    {
+        for (size_t i = 0; i < _countof(TestShaders); ++i)
+        {
+            RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+            pConverter->CreateStream(TestShaders[i].FileName, pShaderSourceFactory, nullptr, 0, &pStream);
+            ASSERT_NE(pStream, nullptr);
+            EXPECT_EQ(Convert(pStream, TestShaders[i]).length(), ReferenceGLSL[i].length());
+            TotalSize += SourceSize[i];
+        }
+    }
+    const auto ElapsedTime = ConversionTimer.GetElapsedTime();
+
+    LOG_INFO_MESSAGE("HLSL->GLSL conversion throughput: ", static_cast<double>(TotalSize) / (ElapsedTime * 1024.0 * 1024.0), " MB/s (",
+                     TotalSize, " bytes converted in ", ElapsedTime * 1000.0, " ms)");
+}
+
+TEST(HLSL2GLSLConverterTest, StreamReuse)
+{
+    TestConversionStreams(false);
+}
+
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. HLSL2GLSLConverterTest.StreamReuse verifies the output.
+TEST(HLSL2GLSLConverterTest, DISABLED_Throughput)
+{
+    TestConversionStreams(true);
+}
+#endif
+
 } // namespace
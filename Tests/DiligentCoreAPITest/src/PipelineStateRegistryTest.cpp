@@ -0,0 +1,278 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "TestingEnvironment.hpp"
+
+#if NULL_SUPPORTED
+#    include "EngineFactoryNull.h"
+#endif
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+static const char* VSSource = R"(
+float4 main() : SV_Position
+{
+    return float4(0.0, 0.0, 0.0, 0.0);
+}
+)";
+
+static const char* PSSource = R"(
+float4 main() : SV_Target
+{
+    return float4(0.0, 0.0, 0.0, 0.0);
+}
+)";
+
+static const char* PSSource2 = R"(
+float4 main() : SV_Target
+{
+    return float4(1.0, 1.0, 1.0, 1.0);
+}
+)";
+
+static const char* CSSource = R"(
+RWTexture2D<float/* format=r32f */> g_RWTex;
+
+[numthreads(1,1,1)]
+void main()
+{
+    g_RWTex[int2(0,0)] = 0.0;
+}
+)";
+
+RefCntAutoPtr<IShader> CreateTestShader(IRenderDevice* pDevice, SHADER_TYPE ShaderType, const char* Source)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.Desc.ShaderType            = ShaderType;
+    ShaderCI.Desc.Name                  = "PSO registry test shader";
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Source                     = Source;
+
+    RefCntAutoPtr<IShader> pShader;
+    pDevice->CreateShader(ShaderCI, &pShader);
+    return pShader;
+}
+
+GraphicsPipelineStateCreateInfo GetGraphicsPSOCreateInfo(IShader* pVS, IShader* pPS, const char* Name)
+{
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSOCreateInfo.PSODesc.Name                    = Name;
+    PSOCreateInfo.PSODesc.PipelineType            = PIPELINE_TYPE_GRAPHICS;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = TEX_FORMAT_RGBA8_UNORM;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+    return PSOCreateInfo;
+}
+
+TEST(PipelineStateRegistryTest, DisabledByDefault)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    TestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    auto pVS = CreateTestShader(pDevice, SHADER_TYPE_VERTEX, VSSource);
+    auto pPS = CreateTestShader(pDevice, SHADER_TYPE_PIXEL, PSSource);
+    ASSERT_TRUE(pVS && pPS);
+
+    const auto PSOCreateInfo = GetGraphicsPSOCreateInfo(pVS, pPS, "PSO registry test");
+
+    RefCntAutoPtr<IPipelineState> pPSO0, pPSO1;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO0);
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO1);
+    ASSERT_TRUE(pPSO0 && pPSO1);
+    EXPECT_NE(pPSO0, pPSO1);
+
+    PipelineStateRegistryStatistics Stats;
+    pDevice->GetPipelineStateRegistryStatistics(Stats);
+    EXPECT_EQ(Stats.NumHits, 0u);
+    EXPECT_EQ(Stats.NumMisses, 0u);
+}
+
+#if NULL_SUPPORTED
+TEST(PipelineStateRegistryTest, DeduplicatePipelines)
+{
+    auto* pEnv = TestingEnvironment::GetInstance();
+    if (pEnv->GetDevice()->GetDeviceCaps().DevType != RENDER_DEVICE_TYPE_NULL)
+        GTEST_SKIP() << "The test creates a separate device with the pipeline state registry enabled, which is only supported by the Null backend";
+
+    RefCntAutoPtr<IEngineFactoryNull> pFactoryNull{pEnv->GetDevice()->GetEngineFactory(), IID_EngineFactoryNull};
+    ASSERT_TRUE(pFactoryNull);
+
+    EngineNullCreateInfo EngineCI;
+    EngineCI.EnablePipelineStateRegistry = true;
+
+    RefCntAutoPtr<IRenderDevice>  pDevice;
+    RefCntAutoPtr<IDeviceContext> pContext;
+    pFactoryNull->CreateDeviceAndContextsNull(EngineCI, &pDevice, &pContext);
+    ASSERT_TRUE(pDevice && pContext);
+
+    auto pVS = CreateTestShader(pDevice, SHADER_TYPE_VERTEX, VSSource);
+    auto pPS = CreateTestShader(pDevice, SHADER_TYPE_PIXEL, PSSource);
+    auto pCS = CreateTestShader(pDevice, SHADER_TYPE_COMPUTE, CSSource);
+    ASSERT_TRUE(pVS && pPS && pCS);
+
+    auto CheckStats = [&](Uint32 NumHits, Uint32 NumMisses) //
+    {
+        PipelineStateRegistryStatistics Stats;
+        pDevice->GetPipelineStateRegistryStatistics(Stats);
+        EXPECT_EQ(Stats.NumHits, NumHits);
+        EXPECT_EQ(Stats.NumMisses, NumMisses);
+    };
+
+    auto PSOCreateInfo = GetGraphicsPSOCreateInfo(pVS, pPS, "PSO registry test 0");
+
+    RefCntAutoPtr<IPipelineState> pPSO0;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO0);
+    ASSERT_TRUE(pPSO0);
+    CheckStats(0, 1);
+
+    // The name is part of the key
+    {
+        PSOCreateInfo.PSODesc.Name = "PSO registry test 1";
+
+        RefCntAutoPtr<IPipelineState> pPSO1;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO1);
+        EXPECT_NE(pPSO0, pPSO1);
+        CheckStats(0, 2);
+
+        PSOCreateInfo.PSODesc.Name = "PSO registry test 0";
+    }
+
+    // Variables are deep-copied and compared by name
+    {
+        std::string                VarName{"g_Tex"};
+        ShaderResourceVariableDesc Var{SHADER_TYPE_PIXEL, VarName.c_str(), SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE};
+        PSOCreateInfo.PSODesc.ResourceLayout.Variables    = &Var;
+        PSOCreateInfo.PSODesc.ResourceLayout.NumVariables = 1;
+
+        RefCntAutoPtr<IPipelineState> pPSO1;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO1);
+        EXPECT_NE(pPSO0, pPSO1);
+        CheckStats(0, 3);
+
+        std::string                VarName2{"g_Tex"};
+        ShaderResourceVariableDesc Var2{SHADER_TYPE_PIXEL, VarName2.c_str(), SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE};
+        PSOCreateInfo.PSODesc.ResourceLayout.Variables = &Var2;
+
+        RefCntAutoPtr<IPipelineState> pPSO2;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO2);
+        EXPECT_EQ(pPSO1, pPSO2);
+        CheckStats(1, 3);
+
+        PSOCreateInfo.PSODesc.ResourceLayout.Variables    = nullptr;
+        PSOCreateInfo.PSODesc.ResourceLayout.NumVariables = 0;
+    }
+
+    // Different render states produce different pipelines
+    {
+        PSOCreateInfo.GraphicsPipeline.RasterizerDesc.CullMode = CULL_MODE_NONE;
+
+        RefCntAutoPtr<IPipelineState> pPSO1;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO1);
+        EXPECT_NE(pPSO0, pPSO1);
+        CheckStats(1, 4);
+
+        PSOCreateInfo.GraphicsPipeline.RasterizerDesc.CullMode = RasterizerStateDesc{}.CullMode;
+    }
+
+    // Shaders are compared by content
+    {
+        auto pPS1 = CreateTestShader(pDevice, SHADER_TYPE_PIXEL, PSSource);
+        ASSERT_TRUE(pPS1);
+        PSOCreateInfo.pPS = pPS1;
+
+        RefCntAutoPtr<IPipelineState> pPSO1;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO1);
+        EXPECT_EQ(pPSO0, pPSO1);
+        CheckStats(2, 4);
+
+        auto pPS2 = CreateTestShader(pDevice, SHADER_TYPE_PIXEL, PSSource2);
+        ASSERT_TRUE(pPS2);
+        PSOCreateInfo.pPS = pPS2;
+
+        RefCntAutoPtr<IPipelineState> pPSO2;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO2);
+        EXPECT_NE(pPSO0, pPSO2);
+        CheckStats(2, 5);
+
+        PSOCreateInfo.pPS = pPS;
+    }
+
+    // Released pipelines are not returned
+    pPSO0.Release();
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO0);
+    ASSERT_TRUE(pPSO0);
+    CheckStats(2, 6);
+
+    ComputePipelineStateCreateInfo ComputePSOCreateInfo;
+    ComputePSOCreateInfo.PSODesc.Name         = "PSO registry test - compute";
+    ComputePSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+    ComputePSOCreateInfo.pCS                  = pCS;
+
+    ComputePSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+    {
+        RefCntAutoPtr<IPipelineState> pComputePSO0, pComputePSO1;
+        pDevice->CreateComputePipelineState(ComputePSOCreateInfo, &pComputePSO0);
+        pDevice->CreateComputePipelineState(ComputePSOCreateInfo, &pComputePSO1);
+        ASSERT_TRUE(pComputePSO0);
+        EXPECT_EQ(pComputePSO0, pComputePSO1);
+        CheckStats(3, 7);
+    }
+
+    // Pipelines with static variables are never shared
+    ComputePSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+    {
+        RefCntAutoPtr<IPipelineState> pComputePSO0, pComputePSO1;
+        pDevice->CreateComputePipelineState(ComputePSOCreateInfo, &pComputePSO0);
+        pDevice->CreateComputePipelineState(ComputePSOCreateInfo, &pComputePSO1);
+        ASSERT_TRUE(pComputePSO0 && pComputePSO1);
+        EXPECT_EQ(pComputePSO0->GetStaticVariableCount(SHADER_TYPE_COMPUTE), 1u);
+        EXPECT_NE(pComputePSO0, pComputePSO1);
+        CheckStats(3, 9);
+    }
+}
+#endif
+
+} // namespace
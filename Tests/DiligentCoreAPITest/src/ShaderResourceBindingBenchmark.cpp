@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// clang-format off
+const std::string BindingBenchmarkCS{
+R"(
+Texture2D<float4> g_Tex0;
+Texture2D<float4> g_Tex1;
+Texture2D<float4> g_Tex2;
+Texture2D<float4> g_Tex3;
+Texture2D<float4> g_Tex4;
+Texture2D<float4> g_Tex5;
+Texture2D<float4> g_Tex6;
+Texture2D<float4> g_Tex7;
+
+RWTexture2D</*format=rgba8*/ float4> g_Output;
+
+[numthreads(8, 8, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    int3 Location = int3(DTid.xy, 0);
+    g_Output[DTid.xy] =
+        g_Tex0.Load(Location) + g_Tex1.Load(Location) + g_Tex2.Load(Location) + g_Tex3.Load(Location) +
+        g_Tex4.Load(Location) + g_Tex5.Load(Location) + g_Tex6.Load(Location) + g_Tex7.Load(Location);
+}
+)"
+};
+// clang-format on
+
+constexpr Uint32 NumTextures = 8;
+constexpr Uint32 NumSRBs     = 1024;
+
+// Measures the time it takes to create a shader resource binding and bind all its
+// mutable variables either one by one or with a single SetVariables() call.
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. ShaderResourceBinding.SetVariables verifies the bindings.
+TEST(ShaderResourceBindingBenchmark, DISABLED_BindMutableVariables)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceCaps().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Desc.Name                  = "Binding benchmark CS";
+    ShaderCI.Source                     = BindingBenchmarkCS.c_str();
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+
+    PSOCreateInfo.PSODesc.Name                               = "Binding benchmark";
+    PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+    PSOCreateInfo.pCS                                        = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    std::array<std::string, NumTextures>             TexNames;
+    std::array<RefCntAutoPtr<ITexture>, NumTextures> pTextures;
+    std::vector<ShaderResourceVariableBinding>       Bindings;
+    for (Uint32 t = 0; t < NumTextures; ++t)
+    {
+        TexNames[t]  = "g_Tex" + std::to_string(t);
+        pTextures[t] = pEnv->CreateTexture("Binding benchmark texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, 64, 64);
+        ASSERT_NE(pTextures[t], nullptr);
+        Bindings.emplace_back(SHADER_TYPE_COMPUTE, TexNames[t].c_str(), pTextures[t]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+    }
+
+    auto pOutput = pEnv->CreateTexture("Binding benchmark output", TEX_FORMAT_RGBA8_UNORM, BIND_UNORDERED_ACCESS, 64, 64);
+    ASSERT_NE(pOutput, nullptr);
+    Bindings.emplace_back(SHADER_TYPE_COMPUTE, "g_Output", pOutput->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS));
+
+    auto RunBenchmark = [&](const char* Name, bool UseSetVariables) {
+        std::vector<RefCntAutoPtr<IShaderResourceBinding>> SRBs(NumSRBs);
+
+        const auto StartTime = std::chrono::high_resolution_clock::now();
+        for (auto& pSRB : SRBs)
+        {
+            pPSO->CreateShaderResourceBinding(&pSRB, true);
+            if (UseSetVariables)
+            {
+                pSRB->SetVariables(static_cast<Uint32>(Bindings.size()), Bindings.data());
+            }
+            else
+            {
+                for (const auto& Binding : Bindings)
+                    pSRB->GetVariableByName(Binding.ShaderType, Binding.Name)->Set(Binding.pObject);
+            }
+        }
+        const auto EndTime = std::chrono::high_resolution_clock::now();
+
+        for (auto& pSRB : SRBs)
+        {
+            for (const auto& Binding : Bindings)
+                EXPECT_TRUE(pSRB->GetVariableByName(Binding.ShaderType, Binding.Name)->IsBound(0));
+        }
+
+        const auto Time = std::chrono::duration_cast<std::chrono::duration<double>>(EndTime - StartTime).count();
+        std::cout << "[          ] " << Name << ": "
+                  << Time * 1e9 / NumSRBs << " ns/SRB (" << Bindings.size() << " variables)" << std::endl;
+
+        SRBs.clear();
+        // Release stale descriptor sets
+        pContext->Flush();
+        pContext->FinishFrame();
+        pDevice->ReleaseStaleResources();
+    };
+
+    RunBenchmark("Set", false);
+    RunBenchmark("SetVariables", true);
+}
+
+} // namespace
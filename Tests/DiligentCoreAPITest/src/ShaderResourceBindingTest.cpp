@@ -0,0 +1,236 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// clang-format off
+const std::string SetVariablesTestCS{
+R"(
+Texture2D<float4> g_Tex0;
+Texture2D<float4> g_Tex1;
+Texture2D<float4> g_Tex2;
+Texture2D<float4> g_Tex3;
+Texture2D<float4> g_Tex4;
+Texture2D<float4> g_Tex5;
+Texture2D<float4> g_Tex6;
+Texture2D<float4> g_Tex7;
+
+RWStructuredBuffer<float4> g_Output;
+
+[numthreads(4, 1, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    int3 Location = int3(DTid.x, 0, 0);
+    // Different weights make sure that every texture is bound to the right variable
+    g_Output[DTid.x] =
+        g_Tex0.Load(Location) * 1.0 + g_Tex1.Load(Location) * 2.0 + g_Tex2.Load(Location) * 3.0 + g_Tex3.Load(Location) * 4.0 +
+        g_Tex4.Load(Location) * 5.0 + g_Tex5.Load(Location) * 6.0 + g_Tex6.Load(Location) * 7.0 + g_Tex7.Load(Location) * 8.0;
+}
+)"
+};
+// clang-format on
+
+constexpr Uint32 NumTextures = 8;
+constexpr Uint32 TexWidth    = 4;
+
+// Binds the same resources to three shader resource bindings: one variable at a time,
+// with a single SetVariables() call, and partially with Set() and then with SetVariables(),
+// and verifies that all of them produce the same result.
+TEST(ShaderResourceBinding, SetVariables)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceCaps().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.UseCombinedTextureSamplers = true;
+    ShaderCI.Desc.ShaderType            = SHADER_TYPE_COMPUTE;
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.Desc.Name                  = "SetVariables test CS";
+    ShaderCI.Source                     = SetVariablesTestCS.c_str();
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+
+    PSOCreateInfo.PSODesc.Name                               = "SetVariables test";
+    PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+    PSOCreateInfo.pCS                                        = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    std::array<std::string, NumTextures>             TexNames;
+    std::array<RefCntAutoPtr<ITexture>, NumTextures> pTextures;
+    std::vector<ShaderResourceVariableBinding>       Bindings;
+    for (Uint32 t = 0; t < NumTextures; ++t)
+    {
+        std::array<Uint8, TexWidth * 4> TexData;
+        for (Uint32 i = 0; i < TexData.size(); ++i)
+            TexData[i] = static_cast<Uint8>((t * 31 + i * 7) % 256);
+
+        TexNames[t]  = "g_Tex" + std::to_string(t);
+        pTextures[t] = pEnv->CreateTexture("SetVariables test texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, TexWidth, 1, TexData.data());
+        ASSERT_NE(pTextures[t], nullptr);
+        Bindings.emplace_back(SHADER_TYPE_COMPUTE, TexNames[t].c_str(), pTextures[t]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+    }
+
+    constexpr Uint32 NumSRBs = 3;
+
+    std::array<RefCntAutoPtr<IBuffer>, NumSRBs>                OutputBuffers;
+    std::array<RefCntAutoPtr<IShaderResourceBinding>, NumSRBs> SRBs;
+    for (Uint32 i = 0; i < NumSRBs; ++i)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "SetVariables test output";
+        BuffDesc.uiSizeInBytes     = sizeof(float) * 4 * TexWidth;
+        BuffDesc.Usage             = USAGE_DEFAULT;
+        BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(float) * 4;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &OutputBuffers[i]);
+        ASSERT_NE(OutputBuffers[i], nullptr);
+
+        pPSO->CreateShaderResourceBinding(&SRBs[i], true);
+        ASSERT_NE(SRBs[i], nullptr);
+    }
+
+    auto GetOutputBinding = [&](Uint32 i) {
+        return ShaderResourceVariableBinding{SHADER_TYPE_COMPUTE, "g_Output", OutputBuffers[i]->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS)};
+    };
+
+    // One variable at a time
+    {
+        auto AllBindings = Bindings;
+        AllBindings.push_back(GetOutputBinding(0));
+        for (const auto& Binding : AllBindings)
+            SRBs[0]->GetVariableByName(Binding.ShaderType, Binding.Name)->Set(Binding.pObject);
+    }
+
+    // All variables with a single call
+    {
+        auto AllBindings = Bindings;
+        AllBindings.push_back(GetOutputBinding(1));
+        SRBs[1]->SetVariables(static_cast<Uint32>(AllBindings.size()), AllBindings.data());
+    }
+
+    // Some variables one at a time, the rest with a single call
+    {
+        auto AllBindings = Bindings;
+        AllBindings.push_back(GetOutputBinding(2));
+        const Uint32 NumSet = NumTextures / 2;
+        for (Uint32 i = 0; i < NumSet; ++i)
+            SRBs[2]->GetVariableByName(AllBindings[i].ShaderType, AllBindings[i].Name)->Set(AllBindings[i].pObject);
+        SRBs[2]->SetVariables(static_cast<Uint32>(AllBindings.size()) - NumSet, AllBindings.data() + NumSet);
+    }
+
+    for (Uint32 i = 0; i < NumSRBs; ++i)
+    {
+        EXPECT_EQ(SRBs[i]->GetVariableCount(SHADER_TYPE_COMPUTE), NumTextures + 1);
+        for (const auto& Binding : Bindings)
+            EXPECT_TRUE(SRBs[i]->GetVariableByName(Binding.ShaderType, Binding.Name)->IsBound(0)) << Binding.Name;
+        EXPECT_TRUE(SRBs[i]->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Output")->IsBound(0));
+    }
+
+    if (pDevice->GetDeviceCaps().IsNullDevice())
+        return;
+
+    pContext->SetPipelineState(pPSO);
+    for (Uint32 i = 0; i < NumSRBs; ++i)
+    {
+        pContext->CommitShaderResources(SRBs[i], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        DispatchComputeAttribs DispatchAttribs;
+        DispatchAttribs.ThreadGroupCountX = 1;
+        pContext->DispatchCompute(DispatchAttribs);
+    }
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "SetVariables test staging buffer";
+    BuffDesc.Usage          = USAGE_STAGING;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    BuffDesc.uiSizeInBytes  = sizeof(float) * 4 * TexWidth * NumSRBs;
+    BuffDesc.BindFlags      = BIND_NONE;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    const Uint32 OutputSize = sizeof(float) * 4 * TexWidth;
+    for (Uint32 i = 0; i < NumSRBs; ++i)
+    {
+        pContext->CopyBuffer(OutputBuffers[i], 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, OutputSize * i, OutputSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+    pContext->WaitForIdle();
+
+    void* pData = nullptr;
+    pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    const auto* pOutput = static_cast<const float*>(pData);
+    for (Uint32 x = 0; x < TexWidth; ++x)
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+        {
+            float Expected = 0;
+            for (Uint32 t = 0; t < NumTextures; ++t)
+                Expected += static_cast<float>((t * 31 + (x * 4 + c) * 7) % 256) / 255.f * static_cast<float>(t + 1);
+
+            EXPECT_NEAR(pOutput[x * 4 + c], Expected, 1e-3f) << "x=" << x << " c=" << c;
+        }
+    }
+    EXPECT_EQ(memcmp(pOutput, pOutput + TexWidth * 4, OutputSize), 0) << "SetVariables() result does not match Set()";
+    EXPECT_EQ(memcmp(pOutput, pOutput + TexWidth * 4 * 2, OutputSize), 0) << "Partial SetVariables() result does not match Set()";
+    pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+}
+
+} // namespace
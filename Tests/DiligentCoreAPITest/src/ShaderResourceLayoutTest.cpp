@@ -756,7 +756,8 @@ void ShaderResourceLayoutTest::TestStructuredOrFormattedBuffer(bool IsFormatted)
 
     const char*            ShaderFileName = nullptr;
     SHADER_SOURCE_LANGUAGE SrcLang        = SHADER_SOURCE_LANGUAGE_DEFAULT;
-    if (pDevice->GetDeviceCaps().IsD3DDevice())
+    // Null backend only scans declarations, so always use HLSL where all arrays are declared the same way
+    if (pDevice->GetDeviceCaps().IsD3DDevice() || pDevice->GetDeviceCaps().IsNullDevice())
     {
         ShaderFileName = IsFormatted ? "FormattedBuffers.hlsl" : "StructuredBuffers.hlsl";
         SrcLang        = SHADER_SOURCE_LANGUAGE_HLSL;
@@ -913,6 +914,11 @@ void ShaderResourceLayoutTest::TestRWStructuredOrFormattedBuffer(bool IsFormatte
     auto* pDevice    = pEnv->GetDevice();
     auto* pSwapChain = pEnv->GetSwapChain();
 
+    if (pDevice->GetDeviceCaps().IsNullDevice())
+    {
+        GTEST_SKIP() << "Compute shader test requires testing swap chain, which is not available in Null backend";
+    }
+
     ComputeShaderReference(pSwapChain);
 
     const auto& deviceCaps = pDevice->GetDeviceCaps();
@@ -958,7 +964,7 @@ void ShaderResourceLayoutTest::TestRWStructuredOrFormattedBuffer(bool IsFormatte
 
     const char*            ShaderFileName = nullptr;
     SHADER_SOURCE_LANGUAGE SrcLang        = SHADER_SOURCE_LANGUAGE_DEFAULT;
-    if (pDevice->GetDeviceCaps().IsD3DDevice())
+    if (pDevice->GetDeviceCaps().IsD3DDevice() || deviceCaps.IsNullDevice())
     {
         ShaderFileName = IsFormatted ? "RWFormattedBuffers.hlsl" : "RWStructuredBuffers.hlsl";
         SrcLang        = SHADER_SOURCE_LANGUAGE_HLSL;
@@ -1086,6 +1092,11 @@ TEST_F(ShaderResourceLayoutTest, RWTextures)
     auto* pDevice    = pEnv->GetDevice();
     auto* pSwapChain = pEnv->GetSwapChain();
 
+    if (pDevice->GetDeviceCaps().IsNullDevice())
+    {
+        GTEST_SKIP() << "Compute shader test requires testing swap chain, which is not available in Null backend";
+    }
+
     ComputeShaderReference(pSwapChain);
 
     const auto& deviceCaps = pDevice->GetDeviceCaps();
@@ -1260,7 +1271,8 @@ TEST_F(ShaderResourceLayoutTest, ConstantBuffers)
     const auto CBArraysSupported =
         deviceCaps.DevType == RENDER_DEVICE_TYPE_D3D12 ||
         deviceCaps.DevType == RENDER_DEVICE_TYPE_VULKAN ||
-        deviceCaps.DevType == RENDER_DEVICE_TYPE_METAL;
+        deviceCaps.DevType == RENDER_DEVICE_TYPE_METAL ||
+        deviceCaps.DevType == RENDER_DEVICE_TYPE_NULL;
 
     ShaderMacroHelper Macros;
 
@@ -28,6 +28,7 @@
 #include "TestingEnvironment.hpp"
 #include "PlatformDebug.hpp"
 #include "TestingSwapChainBase.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
 
 #if D3D11_SUPPORTED
 #    include "EngineFactoryD3D11.h"
@@ -49,6 +50,10 @@
 #    include "EngineFactoryMtl.h"
 #endif
 
+#if NULL_SUPPORTED
+#    include "EngineFactoryNull.h"
+#endif
+
 namespace Diligent
 {
 
@@ -130,6 +135,10 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
     std::vector<IDeviceContext*>     ppContexts;
     std::vector<GraphicsAdapterInfo> Adapters;
 
+    // Engine libraries may be linked dynamically and have their own instances of the default
+    // allocator. Use the one from the test executable so that tests can count engine allocations.
+    IMemoryAllocator* const pRawMemAllocator = &DefaultRawMemoryAllocator::GetAllocator();
+
 #if D3D11_SUPPORTED || D3D12_SUPPORTED
     auto PrintAdapterInfo = [](Uint32 AdapterId, const GraphicsAdapterInfo& AdapterInfo, const std::vector<DisplayModeAttribs>& DisplayModes) //
     {
@@ -162,6 +171,7 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
 
             EngineD3D11CreateInfo CreateInfo;
             CreateInfo.DebugMessageCallback = MessageCallback;
+            CreateInfo.pRawMemAllocator     = pRawMemAllocator;
             CreateInfo.Features             = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
 
 #    ifdef DILIGENT_DEBUG
@@ -227,6 +237,7 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
 
             EngineD3D12CreateInfo CreateInfo;
             CreateInfo.DebugMessageCallback = MessageCallback;
+            CreateInfo.pRawMemAllocator     = pRawMemAllocator;
             CreateInfo.Features             = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
 
             LOG_INFO_MESSAGE("Found ", Adapters.size(), " compatible adapters");
@@ -283,12 +294,14 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
             auto Window = CreateNativeWindow();
 
             EngineGLCreateInfo CreateInfo;
-            CreateInfo.DebugMessageCallback      = MessageCallback;
-            CreateInfo.Window                    = Window;
-            CreateInfo.CreateDebugContext        = true;
-            CreateInfo.Features                  = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
-            CreateInfo.ForceNonSeparablePrograms = CI.ForceNonSeparablePrograms;
-            NumDeferredCtx                       = 0;
+            CreateInfo.DebugMessageCallback        = MessageCallback;
+            CreateInfo.pRawMemAllocator            = pRawMemAllocator;
+            CreateInfo.Window                      = Window;
+            CreateInfo.CreateDebugContext          = true;
+            CreateInfo.Features                    = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
+            CreateInfo.ForceNonSeparablePrograms   = CI.ForceNonSeparablePrograms;
+            CreateInfo.ProgramBinaryCacheDirectory = CI.GLProgramBinaryCacheDir;
+            NumDeferredCtx                         = 0;
             ppContexts.resize(1 + NumDeferredCtx);
             RefCntAutoPtr<ISwapChain> pSwapChain; // We will use testing swap chain instead
             pFactoryOpenGL->CreateDeviceAndSwapChainGL(
@@ -312,6 +325,7 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
             EngineVkCreateInfo CreateInfo;
             CreateInfo.AdapterId                 = CI.AdapterId;
             CreateInfo.DebugMessageCallback      = MessageCallback;
+            CreateInfo.pRawMemAllocator          = pRawMemAllocator;
             CreateInfo.EnableValidation          = true;
             CreateInfo.MainDescriptorPoolSize    = VulkanDescriptorPoolSize{64, 64, 256, 256, 64, 32, 32, 32, 32, 16, 16};
             CreateInfo.DynamicDescriptorPoolSize = VulkanDescriptorPoolSize{64, 64, 256, 256, 64, 32, 32, 32, 32, 16, 16};
@@ -320,11 +334,23 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
             //CreateInfo.HostVisibleMemoryReserveSize = 48 << 20;
             CreateInfo.Features = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
 
+            CreateInfo.EnableAsyncComputeQueue = CI.EnableAsyncComputeQueue;
+            CreateInfo.EnableTransferQueue     = CI.EnableTransferQueue;
+
             NumDeferredCtx                 = CI.NumDeferredContexts;
             CreateInfo.NumDeferredContexts = NumDeferredCtx;
-            ppContexts.resize(1 + NumDeferredCtx);
+            ppContexts.resize(1 + NumDeferredCtx + (CI.EnableAsyncComputeQueue ? 1 : 0) + (CI.EnableTransferQueue ? 1 : 0));
             auto* pFactoryVk = GetEngineFactoryVk();
             pFactoryVk->CreateDeviceAndContextsVk(CreateInfo, &m_pDevice, ppContexts.data());
+
+            // Extra immediate contexts follow the deferred ones and may be null
+            // if the device has no suitable queue.
+            auto ExtraCtxIdx = 1 + NumDeferredCtx;
+            if (CI.EnableAsyncComputeQueue)
+                m_pComputeContext.Attach(ppContexts[ExtraCtxIdx++]);
+            if (CI.EnableTransferQueue)
+                m_pTransferContext.Attach(ppContexts[ExtraCtxIdx++]);
+            ppContexts.resize(1 + NumDeferredCtx);
         }
         break;
 #endif
@@ -335,6 +361,7 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
             EngineMtlCreateInfo MtlAttribs;
 
             MtlAttribs.DebugMessageCallback = MessageCallback;
+            MtlAttribs.pRawMemAllocator     = pRawMemAllocator;
             NumDeferredCtx                  = CI.NumDeferredContexts;
             MtlAttribs.NumDeferredContexts  = NumDeferredCtx;
             ppContexts.resize(1 + NumDeferredCtx);
@@ -344,6 +371,38 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
         break;
 #endif
 
+#if NULL_SUPPORTED
+        case RENDER_DEVICE_TYPE_NULL:
+        {
+#    if EXPLICITLY_LOAD_ENGINE_NULL_DLL
+            // Load the dll and import GetEngineFactoryNull() function
+            auto GetEngineFactoryNull = LoadGraphicsEngineNull();
+            if (GetEngineFactoryNull == nullptr)
+            {
+                LOG_ERROR_AND_THROW("Failed to load the engine");
+            }
+#    endif
+
+            EngineNullCreateInfo CreateInfo;
+            CreateInfo.DebugMessageCallback = MessageCallback;
+            CreateInfo.pRawMemAllocator     = pRawMemAllocator;
+            CreateInfo.Features             = DeviceFeatures{DEVICE_FEATURE_STATE_OPTIONAL};
+
+            NumDeferredCtx                 = CI.NumDeferredContexts;
+            CreateInfo.NumDeferredContexts = NumDeferredCtx;
+            ppContexts.resize(1 + NumDeferredCtx);
+            auto* pFactoryNull = GetEngineFactoryNull();
+            pFactoryNull->CreateDeviceAndContextsNull(CreateInfo, &m_pDevice, ppContexts.data());
+            if (m_pDevice)
+            {
+                // The Null swap chain does not support snapshots, so tests that compare
+                // rendering results with the reference are skipped.
+                pFactoryNull->CreateSwapChainNull(m_pDevice, ppContexts[0], SCDesc, &m_pSwapChain);
+            }
+        }
+        break;
+#endif
+
         default:
             LOG_ERROR_AND_THROW("Unknown device type");
             break;
@@ -395,9 +454,14 @@ TestingEnvironment::TestingEnvironment(const CreateInfo& CI, const SwapChainDesc
 
 TestingEnvironment::~TestingEnvironment()
 {
-    auto* pCtx = GetDeviceContext();
-    pCtx->Flush();
-    pCtx->FinishFrame();
+    for (auto* pCtx : {GetDeviceContext(), GetComputeContext(), GetTransferContext()})
+    {
+        if (pCtx != nullptr)
+        {
+            pCtx->Flush();
+            pCtx->FinishFrame();
+        }
+    }
 }
 
 // Override this to define how to set up the environment.
@@ -423,6 +487,14 @@ void TestingEnvironment::ReleaseResources()
 
 void TestingEnvironment::Reset()
 {
+    for (auto* pExtraCtx : {GetComputeContext(), GetTransferContext()})
+    {
+        if (pExtraCtx != nullptr)
+        {
+            pExtraCtx->Flush();
+            pExtraCtx->FinishFrame();
+        }
+    }
     auto* pCtx = GetDeviceContext();
     pCtx->Flush();
     pCtx->FinishFrame();
@@ -529,6 +601,19 @@ void TestingEnvironment::SetDefaultCompiler(SHADER_COMPILER compiler)
             }
             break;
 
+        case RENDER_DEVICE_TYPE_NULL:
+            switch (compiler)
+            {
+                case SHADER_COMPILER_DEFAULT:
+                    m_ShaderCompiler = compiler;
+                    break;
+
+                default:
+                    LOG_WARNING_MESSAGE(GetShaderCompilerTypeString(compiler), " is not supported by Null backend. Using default compiler");
+                    m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
+            }
+            break;
+
         default:
             LOG_WARNING_MESSAGE("Unepxected device type");
             m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
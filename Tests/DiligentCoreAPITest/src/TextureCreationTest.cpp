@@ -50,6 +50,10 @@
 #    include "Metal/CreateObjFromNativeResMtl.hpp"
 #endif
 
+#if NULL_SUPPORTED
+#    include "Null/CreateObjFromNativeResNull.hpp"
+#endif
+
 #include "TestingEnvironment.hpp"
 
 #include "gtest/gtest.h"
@@ -124,6 +128,12 @@ protected:
                 break;
 #endif
 
+#if NULL_SUPPORTED
+            case RENDER_DEVICE_TYPE_NULL:
+                pCreateObjFromNativeRes.reset(new TestCreateObjFromNativeResNull(pDevice));
+                break;
+#endif
+
             default: UNEXPECTED("Unexpected device type");
         }
 
@@ -0,0 +1,201 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "DeviceContextVk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 BufferSize = 4096;
+constexpr Uint32 RegionSize = 16;
+
+RefCntAutoPtr<IBuffer> CreateCopyTestBuffer(IRenderDevice* pDevice, const char* Name, USAGE Usage, const std::vector<Uint8>* pInitData)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name          = Name;
+    BuffDesc.uiSizeInBytes = BufferSize;
+    BuffDesc.Usage         = Usage;
+    if (Usage == USAGE_STAGING)
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    else
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+
+    BufferData InitData;
+    if (pInitData != nullptr)
+    {
+        InitData.pData    = pInitData->data();
+        InitData.DataSize = static_cast<Uint32>(pInitData->size());
+    }
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, pInitData != nullptr ? &InitData : nullptr, &pBuffer);
+    return pBuffer;
+}
+
+// Records buffer copies through the device context and verifies how the pending copies of
+// VulkanCommandBuffer are merged into vkCmdCopyBuffer commands and that the results are correct.
+TEST(BufferCopyVk, PendingCopies)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceCaps().DevType != RENDER_DEVICE_TYPE_VULKAN)
+    {
+        GTEST_SKIP() << "Buffer copy test is only available in Vulkan backend";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    ASSERT_TRUE(pContextVk);
+
+    std::vector<Uint8> SrcDataA(BufferSize), SrcDataC(BufferSize);
+    for (Uint32 i = 0; i < BufferSize; ++i)
+    {
+        SrcDataA[i] = static_cast<Uint8>(i & 0xFF);
+        SrcDataC[i] = static_cast<Uint8>(0xFF - (i & 0xFF));
+    }
+
+    auto pSrcA = CreateCopyTestBuffer(pDevice, "Buffer copy test - src A", USAGE_DEFAULT, &SrcDataA);
+    auto pSrcC = CreateCopyTestBuffer(pDevice, "Buffer copy test - src C", USAGE_DEFAULT, &SrcDataC);
+    auto pDstB = CreateCopyTestBuffer(pDevice, "Buffer copy test - dst B", USAGE_DEFAULT, nullptr);
+    auto pDstD = CreateCopyTestBuffer(pDevice, "Buffer copy test - dst D", USAGE_DEFAULT, nullptr);
+    ASSERT_TRUE(pSrcA && pSrcC && pDstB && pDstD);
+
+    // Transition the buffers up front so that the copies below do not require barriers
+    // that would flush the pending copies.
+    StateTransitionDesc Barriers[] = //
+        {
+            {pSrcA, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_SOURCE, true},
+            {pSrcC, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_SOURCE, true},
+            {pDstB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, true},
+            {pDstD, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, true} //
+        };
+    pContext->TransitionResourceStates(_countof(Barriers), Barriers);
+    pContext->Flush();
+    pContext->FinishFrame();
+
+    auto Copy = [&](IBuffer* pSrc, Uint32 SrcOffset, IBuffer* pDst, Uint32 DstOffset) //
+    {
+        pContext->CopyBuffer(pSrc, SrcOffset, RESOURCE_STATE_TRANSITION_MODE_VERIFY,
+                             pDst, DstOffset, RegionSize, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+    };
+
+    auto GetFrameStats = [&]() //
+    {
+        pContext->Flush();
+        pContext->FinishFrame();
+
+        FrameUploadStatistics Stats;
+        pContextVk->GetLastFrameUploadStatistics(Stats);
+        return Stats;
+    };
+
+    // Interleaved copies between two buffer pairs are sorted by (src, dst) and
+    // issued as one command per pair.
+    constexpr Uint32 NumInterleavedCopies = 8;
+    for (Uint32 i = 0; i < NumInterleavedCopies; ++i)
+    {
+        Copy(pSrcA, i * RegionSize, pDstB, i * RegionSize);
+        Copy(pSrcC, i * RegionSize, pDstD, i * RegionSize);
+    }
+    {
+        const auto Stats = GetFrameStats();
+        EXPECT_EQ(Stats.NumCopyRegions, 2 * NumInterleavedCopies);
+        EXPECT_EQ(Stats.NumCopyBytes, 2 * NumInterleavedCopies * RegionSize);
+        EXPECT_EQ(Stats.NumCopyCommands, 2u);
+    }
+
+    // The number of pending copies is limited to 64
+    constexpr Uint32 NumCappedCopies  = 65;
+    constexpr Uint32 CappedCopyOffset = 256;
+    for (Uint32 i = 0; i < NumCappedCopies; ++i)
+    {
+        Copy(pSrcA, i * RegionSize, pDstB, CappedCopyOffset + i * RegionSize);
+    }
+    {
+        const auto Stats = GetFrameStats();
+        EXPECT_EQ(Stats.NumCopyRegions, NumCappedCopies);
+        EXPECT_EQ(Stats.NumCopyCommands, 2u);
+    }
+
+    // A copy that overwrites the memory written by a pending copy flushes the
+    // pending copies and is separated from them by a barrier.
+    constexpr Uint32 OverlapCopyOffset = 2048;
+    {
+        PipelineBarrierStatistics StartBarrierStats;
+        pContextVk->GetBarrierStatistics(StartBarrierStats);
+
+        Copy(pSrcA, 0, pDstB, OverlapCopyOffset);
+        Copy(pSrcC, 0, pDstB, OverlapCopyOffset);
+
+        const auto Stats = GetFrameStats();
+        EXPECT_EQ(Stats.NumCopyRegions, 2u);
+        EXPECT_EQ(Stats.NumCopyCommands, 2u);
+
+        PipelineBarrierStatistics BarrierStats;
+        pContextVk->GetBarrierStatistics(BarrierStats);
+        EXPECT_EQ(BarrierStats.NumPipelineBarriers - StartBarrierStats.NumPipelineBarriers, 1u);
+    }
+
+    auto pStagingB = CreateCopyTestBuffer(pDevice, "Buffer copy test - staging B", USAGE_STAGING, nullptr);
+    auto pStagingD = CreateCopyTestBuffer(pDevice, "Buffer copy test - staging D", USAGE_STAGING, nullptr);
+    ASSERT_TRUE(pStagingB && pStagingD);
+
+    pContext->CopyBuffer(pDstB, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingB, 0, BufferSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->CopyBuffer(pDstD, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingD, 0, BufferSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    void* pDataB = nullptr;
+    void* pDataD = nullptr;
+    pContext->MapBuffer(pStagingB, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pDataB);
+    pContext->MapBuffer(pStagingD, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pDataD);
+    ASSERT_TRUE(pDataB != nullptr && pDataD != nullptr);
+
+    const auto* pBytesB = static_cast<const Uint8*>(pDataB);
+    const auto* pBytesD = static_cast<const Uint8*>(pDataD);
+    EXPECT_EQ(memcmp(pBytesB, SrcDataA.data(), NumInterleavedCopies * RegionSize), 0);
+    EXPECT_EQ(memcmp(pBytesD, SrcDataC.data(), NumInterleavedCopies * RegionSize), 0);
+    EXPECT_EQ(memcmp(pBytesB + CappedCopyOffset, SrcDataA.data(), NumCappedCopies * RegionSize), 0);
+    EXPECT_EQ(memcmp(pBytesB + OverlapCopyOffset, SrcDataC.data(), RegionSize), 0);
+
+    pContext->UnmapBuffer(pStagingB, MAP_READ);
+    pContext->UnmapBuffer(pStagingD, MAP_READ);
+}
+
+} // namespace
@@ -0,0 +1,143 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+#include <vector>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "DeviceContextVk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Transitions a number of resources with a single TransitionResourceStates() call and
+// verifies that all barriers are submitted with a single vkCmdPipelineBarrier command.
+TEST(PipelineBarrierVk, MergedBarriers)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceCaps().DevType != RENDER_DEVICE_TYPE_VULKAN)
+    {
+        GTEST_SKIP() << "Pipeline barrier test is only available in Vulkan backend";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    ASSERT_TRUE(pContextVk);
+
+    constexpr Uint32 NumResources = 8;
+
+    std::vector<RefCntAutoPtr<ITexture>> Textures(NumResources);
+    std::vector<RefCntAutoPtr<IBuffer>>  Buffers(NumResources);
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        const auto Name = std::string{"Pipeline barrier test "} + std::to_string(i);
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = Name.c_str();
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = 64;
+        TexDesc.Height    = 64;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.Usage     = USAGE_DEFAULT;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+        pDevice->CreateTexture(TexDesc, nullptr, &Textures[i]);
+        ASSERT_NE(Textures[i], nullptr);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name          = Name.c_str();
+        BuffDesc.uiSizeInBytes = 256;
+        BuffDesc.Usage         = USAGE_DEFAULT;
+        BuffDesc.BindFlags     = BIND_VERTEX_BUFFER;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &Buffers[i]);
+        ASSERT_NE(Buffers[i], nullptr);
+    }
+
+    RefCntAutoPtr<IBuffer> pDstBuffer;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name          = "Pipeline barrier test copy destination";
+        BuffDesc.uiSizeInBytes = 256;
+        BuffDesc.Usage         = USAGE_DEFAULT;
+        BuffDesc.BindFlags     = BIND_VERTEX_BUFFER;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pDstBuffer);
+        ASSERT_NE(pDstBuffer, nullptr);
+    }
+
+    PipelineBarrierStatistics StartStats;
+    pContextVk->GetBarrierStatistics(StartStats);
+
+    std::vector<StateTransitionDesc> Barriers;
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        Barriers.emplace_back(Textures[i], RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADER_RESOURCE, true);
+        Barriers.emplace_back(Buffers[i], RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, true);
+    }
+    pContext->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+
+    // Barriers are recorded lazily: nothing has been submitted yet
+    PipelineBarrierStatistics Stats;
+    pContextVk->GetBarrierStatistics(Stats);
+    EXPECT_EQ(Stats.NumBarriers - StartStats.NumBarriers, Barriers.size());
+    EXPECT_EQ(Stats.NumPipelineBarriers, StartStats.NumPipelineBarriers);
+
+    // Barriers for the same resources can't share the batch with the previous ones:
+    // the first of them submits all pending barriers with one command.
+    Barriers.clear();
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        Barriers.emplace_back(Textures[i], RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_SOURCE, true);
+        Barriers.emplace_back(Buffers[i], RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_SOURCE, true);
+    }
+    pContext->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+
+    pContextVk->GetBarrierStatistics(Stats);
+    EXPECT_EQ(Stats.NumBarriers - StartStats.NumBarriers, 2 * Barriers.size());
+    EXPECT_EQ(Stats.NumPipelineBarriers - StartStats.NumPipelineBarriers, 1u);
+
+    // The copy submits the second batch together with the transition of the destination buffer
+    pContext->CopyBuffer(Buffers[0], 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pDstBuffer, 0, 256, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Flush();
+
+    pContextVk->GetBarrierStatistics(Stats);
+    EXPECT_EQ(Stats.NumBarriers - StartStats.NumBarriers, 2 * Barriers.size() + 1);
+    EXPECT_EQ(Stats.NumPipelineBarriers - StartStats.NumPipelineBarriers, 2u);
+
+    pContext->WaitForIdle();
+}
+
+} // namespace
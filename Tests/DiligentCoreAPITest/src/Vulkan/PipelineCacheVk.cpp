@@ -0,0 +1,454 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+#include "EngineFactoryVk.h"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+
+#include "volk/volk.h"
+
+#include "InlineShaders/ComputeShaderTestGLSL.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// VkPipelineCacheHeaderVersionOne
+constexpr size_t PipelineCacheHeaderSize = sizeof(uint32_t) * 4 + VK_UUID_SIZE;
+
+void VerifyPipelineCacheHeader(const Uint8* pData, size_t DataSize, const VkPhysicalDeviceProperties& Props)
+{
+    ASSERT_GE(DataSize, PipelineCacheHeaderSize);
+
+    uint32_t Header[4] = {};
+    memcpy(Header, pData, sizeof(Header));
+    EXPECT_GE(Header[0], PipelineCacheHeaderSize);
+    EXPECT_EQ(Header[1], static_cast<uint32_t>(VK_PIPELINE_CACHE_HEADER_VERSION_ONE));
+    EXPECT_EQ(Header[2], Props.vendorID);
+    EXPECT_EQ(Header[3], Props.deviceID);
+    EXPECT_EQ(memcmp(pData + sizeof(Header), Props.pipelineCacheUUID, VK_UUID_SIZE), 0);
+}
+
+std::vector<Uint8> GetPipelineCacheData(IRenderDeviceVk* pDeviceVk)
+{
+    RefCntAutoPtr<IDataBlob> pCacheData;
+    pDeviceVk->GetPipelineCacheData(&pCacheData);
+    if (!pCacheData)
+        return {};
+
+    const auto* pData = static_cast<const Uint8*>(pCacheData->GetConstDataPtr());
+    return std::vector<Uint8>{pData, pData + pCacheData->GetSize()};
+}
+
+void CreateTestPipeline(IRenderDevice* pDevice)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_GLSL;
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+    ShaderCI.Desc.Name       = "Pipeline cache test CS";
+    ShaderCI.EntryPoint      = "main";
+    ShaderCI.Source          = GLSL::FillTextureCS.c_str();
+
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name         = "Pipeline cache test";
+    PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.pCS                  = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+}
+
+// Creates a separate device through the engine factory with the given pipeline cache
+// settings. Volk keeps Vulkan entry points in global variables that are overwritten
+// by the new instance and device, so they are reloaded for the testing environment
+// device when the object is destroyed.
+class PipelineCacheTestDevice
+{
+public:
+    PipelineCacheTestDevice(const void* pCacheData, size_t CacheDataSize, const char* CacheFilePath)
+    {
+        auto* pEnvDevice = TestingEnvironment::GetInstance()->GetDevice();
+
+        RefCntAutoPtr<IEngineFactoryVk> pFactoryVk{pEnvDevice->GetEngineFactory(), IID_EngineFactoryVk};
+        if (!pFactoryVk)
+            return;
+
+        EngineVkCreateInfo EngineCI;
+        EngineCI.EnableValidation      = true;
+        EngineCI.pPipelineCacheData    = pCacheData;
+        EngineCI.PipelineCacheDataSize = static_cast<Uint32>(CacheDataSize);
+        EngineCI.PipelineCacheFilePath = CacheFilePath;
+
+        RefCntAutoPtr<IRenderDevice> pDevice;
+        pFactoryVk->CreateDeviceAndContextsVk(EngineCI, &pDevice, &m_pContext);
+        m_pDeviceVk = RefCntAutoPtr<IRenderDeviceVk>{pDevice, IID_RenderDeviceVk};
+    }
+
+    // Releasing the device saves the pipeline cache to the file if the path was given
+    ~PipelineCacheTestDevice()
+    {
+        if (!m_pDeviceVk && !m_pContext)
+            return;
+
+        m_pContext.Release();
+        m_pDeviceVk.Release();
+
+        RefCntAutoPtr<IRenderDeviceVk> pEnvDeviceVk{TestingEnvironment::GetInstance()->GetDevice(), IID_RenderDeviceVk};
+        volkLoadInstance(pEnvDeviceVk->GetVkInstance());
+        volkLoadDevice(pEnvDeviceVk->GetVkDevice());
+    }
+
+    IRenderDeviceVk* GetDevice() { return m_pDeviceVk; }
+
+    VkPhysicalDeviceProperties GetPhysicalDeviceProperties()
+    {
+        VkPhysicalDeviceProperties Props = {};
+        vkGetPhysicalDeviceProperties(m_pDeviceVk->GetVkPhysicalDevice(), &Props);
+        return Props;
+    }
+
+private:
+    RefCntAutoPtr<IRenderDeviceVk> m_pDeviceVk;
+    RefCntAutoPtr<IDeviceContext>  m_pContext;
+};
+
+std::vector<Uint8> ReadFileData(const std::string& Path)
+{
+    std::vector<Uint8> Data;
+
+    FileWrapper File{Path.c_str(), EFileAccessMode::Read};
+    if (File)
+    {
+        Data.resize(File->GetSize());
+        if (!Data.empty() && !File->Read(Data.data(), Data.size()))
+            Data.clear();
+    }
+    return Data;
+}
+
+void WriteFileData(const std::string& Path, const std::vector<Uint8>& Data)
+{
+    FileWrapper File{Path.c_str(), EFileAccessMode::Overwrite};
+    ASSERT_TRUE(File != nullptr);
+    if (!Data.empty())
+    {
+        ASSERT_TRUE(File->Write(Data.data(), Data.size()));
+    }
+}
+
+class PipelineCacheVkTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        auto* pDevice = TestingEnvironment::GetInstance()->GetDevice();
+        if (!pDevice->GetDeviceCaps().IsVulkanDevice())
+            return;
+
+        auto* pEnvVk = TestingEnvironmentVk::GetInstance();
+        vkGetPhysicalDeviceProperties(pEnvVk->GetVkPhysicalDevice(), &EnvDeviceProps);
+
+        RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+        CreateTestPipeline(pDevice);
+        ValidData = GetPipelineCacheData(pDeviceVk);
+
+        // The size of the cache that a new device creates without initial data
+        PipelineCacheTestDevice EmptyDevice{nullptr, 0, nullptr};
+        if (EmptyDevice.GetDevice() != nullptr)
+        {
+            const auto Props = EmptyDevice.GetPhysicalDeviceProperties();
+
+            SameAdapter =
+                Props.vendorID == EnvDeviceProps.vendorID &&
+                Props.deviceID == EnvDeviceProps.deviceID &&
+                memcmp(Props.pipelineCacheUUID, EnvDeviceProps.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+
+            EmptyCacheSize = GetPipelineCacheData(EmptyDevice.GetDevice()).size();
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        ValidData.clear();
+        ValidData.shrink_to_fit();
+    }
+
+    void SetUp() override
+    {
+        if (!TestingEnvironment::GetInstance()->GetDevice()->GetDeviceCaps().IsVulkanDevice())
+        {
+            GTEST_SKIP() << "Pipeline cache test is only available in Vulkan backend";
+        }
+        if (!SameAdapter)
+        {
+            GTEST_SKIP() << "The default adapter differs from the one used by the testing environment";
+        }
+        ASSERT_GE(ValidData.size(), PipelineCacheHeaderSize);
+    }
+
+    // Data with a valid header that was created by another driver version
+    static std::vector<Uint8> GetStaleData()
+    {
+        auto Data = ValidData;
+        Data[sizeof(uint32_t) * 4] ^= 0xFF;
+        return Data;
+    }
+
+    // Creates a device with the given cache settings and verifies that it accepted
+    // (ExpectLoaded == true) or ignored the initial data and remains fully functional.
+    static void TestDevice(const void* pCacheData, size_t CacheDataSize, const char* CacheFilePath, bool ExpectLoaded)
+    {
+        PipelineCacheTestDevice Device{pCacheData, CacheDataSize, CacheFilePath};
+        ASSERT_NE(Device.GetDevice(), nullptr);
+        ASSERT_TRUE(Device.GetDevice()->GetVkPipelineCache() != VK_NULL_HANDLE);
+
+        const auto InitialData = GetPipelineCacheData(Device.GetDevice());
+        VerifyPipelineCacheHeader(InitialData.data(), InitialData.size(), EnvDeviceProps);
+        if (ExpectLoaded)
+        {
+            EXPECT_GE(InitialData.size(), ValidData.size());
+        }
+        else
+        {
+            EXPECT_EQ(InitialData.size(), EmptyCacheSize);
+        }
+
+        CreateTestPipeline(Device.GetDevice());
+
+        const auto FinalData = GetPipelineCacheData(Device.GetDevice());
+        VerifyPipelineCacheHeader(FinalData.data(), FinalData.size(), EnvDeviceProps);
+    }
+
+    static std::string GetCacheFilePath()
+    {
+        return FileSystem::GetTemporaryDirectory() + FileSystem::GetSlashSymbol() + "DiligentPipelineCacheVkTest.bin";
+    }
+
+    static VkPhysicalDeviceProperties EnvDeviceProps;
+    static std::vector<Uint8>         ValidData;
+    static size_t                     EmptyCacheSize;
+    static bool                       SameAdapter;
+};
+
+VkPhysicalDeviceProperties PipelineCacheVkTest::EnvDeviceProps = {};
+std::vector<Uint8>         PipelineCacheVkTest::ValidData;
+size_t                     PipelineCacheVkTest::EmptyCacheSize = 0;
+bool                       PipelineCacheVkTest::SameAdapter    = false;
+
+
+// Creates a pipeline through the engine, serializes the device pipeline cache and
+// verifies that a new cache initialized with this data is accepted by the driver.
+TEST(PipelineCacheVk, DataRoundTrip)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceCaps().DevType != RENDER_DEVICE_TYPE_VULKAN)
+    {
+        GTEST_SKIP() << "Pipeline cache test is only available in Vulkan backend";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pEnvVk   = TestingEnvironmentVk::GetInstance();
+    auto  vkDevice = pEnvVk->GetVkDevice();
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_TRUE(pDeviceVk);
+    ASSERT_TRUE(pDeviceVk->GetVkPipelineCache() != VK_NULL_HANDLE);
+
+    CreateTestPipeline(pDevice);
+
+    VkPhysicalDeviceProperties Props = {};
+    vkGetPhysicalDeviceProperties(pEnvVk->GetVkPhysicalDevice(), &Props);
+
+    // Saved
+    const auto CacheData = GetPipelineCacheData(pDeviceVk);
+    VerifyPipelineCacheHeader(CacheData.data(), CacheData.size(), Props);
+
+    // Reloaded
+    VkPipelineCacheCreateInfo PipelineCacheCI = {};
+    PipelineCacheCI.sType                     = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    PipelineCacheCI.initialDataSize           = CacheData.size();
+    PipelineCacheCI.pInitialData              = CacheData.data();
+
+    VkPipelineCache vkReloadedCache = VK_NULL_HANDLE;
+    ASSERT_EQ(vkCreatePipelineCache(vkDevice, &PipelineCacheCI, nullptr, &vkReloadedCache), VK_SUCCESS);
+    ASSERT_TRUE(vkReloadedCache != VK_NULL_HANDLE);
+
+    // Accepted: the reloaded cache serializes with the same header
+    size_t ReloadedSize = 0;
+    EXPECT_EQ(vkGetPipelineCacheData(vkDevice, vkReloadedCache, &ReloadedSize, nullptr), VK_SUCCESS);
+    std::vector<Uint8> ReloadedData(ReloadedSize);
+    if (ReloadedSize > 0)
+    {
+        EXPECT_EQ(vkGetPipelineCacheData(vkDevice, vkReloadedCache, &ReloadedSize, ReloadedData.data()), VK_SUCCESS);
+    }
+    VerifyPipelineCacheHeader(ReloadedData.data(), ReloadedSize, Props);
+
+    vkDestroyPipelineCache(vkDevice, vkReloadedCache, nullptr);
+}
+
+// The data previously retrieved from a device is used by a new device
+TEST_F(PipelineCacheVkTest, ValidCreateInfoData)
+{
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    TestDevice(ValidData.data(), ValidData.size(), nullptr, true);
+}
+
+// The data with a mismatching header is ignored
+TEST_F(PipelineCacheVkTest, StaleCreateInfoData)
+{
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    {
+        const auto Data = GetStaleData();
+        TestDevice(Data.data(), Data.size(), nullptr, false);
+    }
+
+    {
+        // Different device ID
+        auto Data = ValidData;
+        Data[sizeof(uint32_t) * 3] ^= 0xFF;
+        TestDevice(Data.data(), Data.size(), nullptr, false);
+    }
+
+    {
+        // Unknown header version
+        auto Data = ValidData;
+        Data[sizeof(uint32_t) * 1] ^= 0xFF;
+        TestDevice(Data.data(), Data.size(), nullptr, false);
+    }
+}
+
+// Truncated data and data with an invalid header are ignored, while a corrupted
+// payload behind a valid header is passed to the driver that must reject it.
+TEST_F(PipelineCacheVkTest, CorruptedCreateInfoData)
+{
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // Truncated header
+    TestDevice(ValidData.data(), PipelineCacheHeaderSize / 2, nullptr, false);
+
+    {
+        // Header size exceeds the data size
+        auto           Data       = ValidData;
+        const uint32_t HeaderSize = static_cast<uint32_t>(Data.size() + 1);
+        memcpy(Data.data(), &HeaderSize, sizeof(HeaderSize));
+        TestDevice(Data.data(), Data.size(), nullptr, false);
+    }
+
+    {
+        // Random payload behind the valid header
+        auto Data = ValidData;
+        Data.resize(Data.size() + 256);
+        for (size_t i = PipelineCacheHeaderSize; i < Data.size(); ++i)
+            Data[i] = static_cast<Uint8>((i * 131) ^ 0x5A);
+
+        PipelineCacheTestDevice Device{Data.data(), Data.size(), nullptr};
+        ASSERT_NE(Device.GetDevice(), nullptr);
+        ASSERT_TRUE(Device.GetDevice()->GetVkPipelineCache() != VK_NULL_HANDLE);
+
+        CreateTestPipeline(Device.GetDevice());
+
+        const auto FinalData = GetPipelineCacheData(Device.GetDevice());
+        VerifyPipelineCacheHeader(FinalData.data(), FinalData.size(), EnvDeviceProps);
+    }
+}
+
+// The cache is loaded from the file when the device is created and is written
+// back when the device is destroyed.
+TEST_F(PipelineCacheVkTest, FileLoadAndSave)
+{
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const auto FilePath = GetCacheFilePath();
+    if (FileSystem::FileExists(FilePath.c_str()))
+        FileSystem::DeleteFile(FilePath.c_str());
+
+    // The file does not exist: the device starts with an empty cache and creates the file
+    TestDevice(nullptr, 0, FilePath.c_str(), false);
+    {
+        const auto FileData = ReadFileData(FilePath);
+        VerifyPipelineCacheHeader(FileData.data(), FileData.size(), EnvDeviceProps);
+    }
+
+    // Valid file
+    WriteFileData(FilePath, ValidData);
+    TestDevice(nullptr, 0, FilePath.c_str(), true);
+    {
+        const auto FileData = ReadFileData(FilePath);
+        VerifyPipelineCacheHeader(FileData.data(), FileData.size(), EnvDeviceProps);
+        EXPECT_GE(FileData.size(), ValidData.size());
+    }
+
+    // Stale file takes precedence over the valid create info data and is ignored
+    WriteFileData(FilePath, GetStaleData());
+    TestDevice(ValidData.data(), ValidData.size(), FilePath.c_str(), false);
+    {
+        const auto FileData = ReadFileData(FilePath);
+        VerifyPipelineCacheHeader(FileData.data(), FileData.size(), EnvDeviceProps);
+    }
+
+    // Corrupted file is ignored and overwritten with the valid cache
+    {
+        std::vector<Uint8> Data(ValidData.size());
+        for (size_t i = 0; i < Data.size(); ++i)
+            Data[i] = static_cast<Uint8>((i * 131) ^ 0x5A);
+        WriteFileData(FilePath, Data);
+    }
+    TestDevice(nullptr, 0, FilePath.c_str(), false);
+    {
+        const auto FileData = ReadFileData(FilePath);
+        VerifyPipelineCacheHeader(FileData.data(), FileData.size(), EnvDeviceProps);
+    }
+
+    // Empty file
+    WriteFileData(FilePath, {});
+    TestDevice(nullptr, 0, FilePath.c_str(), false);
+
+    FileSystem::DeleteFile(FilePath.c_str());
+}
+
+} // namespace
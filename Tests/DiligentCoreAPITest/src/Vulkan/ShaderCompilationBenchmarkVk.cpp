@@ -0,0 +1,151 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+#include "ShaderMacroHelper.hpp"
+
+#include "InlineShaders/ComputeShaderTestGLSL.h"
+#include "InlineShaders/DrawCommandTestGLSL.h"
+#include "InlineShaders/GeometryShaderTestGLSL.h"
+#include "InlineShaders/TessellationTestGLSL.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+#if !DILIGENT_NO_GLSLANG
+
+struct InlineShaderInfo
+{
+    SHADER_TYPE        Type;
+    const std::string& Source;
+};
+
+// Creates the API test inline shaders with IRenderDevice::CreateShader(), first synchronously and
+// then with SHADER_COMPILE_FLAG_ASYNCHRONOUS, and reports the speed-up of the asynchronous path.
+// The number of compilation threads is set by EngineVkCreateInfo::NumAsyncShaderCompilationThreads.
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it.
+TEST(ShaderCompilationBenchmarkVk, DISABLED_AsyncCreateShader)
+{
+    auto* pEnv    = TestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceCaps().IsVulkanDevice())
+    {
+        GTEST_SKIP() << "Asynchronous shader compilation on worker threads is only implemented in Vulkan backend";
+    }
+
+    TestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // clang-format off
+    const InlineShaderInfo Shaders[] =
+    {
+        {SHADER_TYPE_VERTEX,   GLSL::DrawTest_ProceduralTriangleVS},
+        {SHADER_TYPE_PIXEL,    GLSL::DrawTest_FS},
+        {SHADER_TYPE_COMPUTE,  GLSL::FillTextureCS},
+        {SHADER_TYPE_VERTEX,   GLSL::GSTest_VS},
+        {SHADER_TYPE_GEOMETRY, GLSL::GSTest_GS},
+        {SHADER_TYPE_PIXEL,    GLSL::GSTest_FS},
+        {SHADER_TYPE_VERTEX,   GLSL::TessTest_VS},
+        {SHADER_TYPE_HULL,     GLSL::TessTest_TCS},
+        {SHADER_TYPE_DOMAIN,   GLSL::TessTest_TES},
+        {SHADER_TYPE_PIXEL,    GLSL::TessTest_FS}
+    };
+    // clang-format on
+
+    const auto& deviceFeatures = pDevice->GetDeviceCaps().Features;
+
+    // Every shader is compiled several times to give each worker enough jobs
+    constexpr int NumRepetitions = 8;
+
+    // Every shader gets a unique macro so that it is not found in the SPIR-V cache
+    int  ShaderId      = 0;
+    auto CreateShaders = [&](SHADER_COMPILE_FLAGS CompileFlags, std::vector<RefCntAutoPtr<IShader>>& CreatedShaders) {
+        for (int r = 0; r < NumRepetitions; ++r)
+        {
+            for (const auto& Shader : Shaders)
+            {
+                if ((Shader.Type == SHADER_TYPE_GEOMETRY && !deviceFeatures.GeometryShaders) ||
+                    ((Shader.Type == SHADER_TYPE_HULL || Shader.Type == SHADER_TYPE_DOMAIN) && !deviceFeatures.Tessellation))
+                    continue;
+
+                ShaderMacroHelper Macros;
+                Macros.AddShaderMacro("BENCHMARK_SHADER_ID", ++ShaderId);
+
+                ShaderCreateInfo ShaderCI;
+                ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_GLSL;
+                ShaderCI.EntryPoint      = "main";
+                ShaderCI.Desc.ShaderType = Shader.Type;
+                ShaderCI.Desc.Name       = "Shader compilation benchmark";
+                ShaderCI.Source          = Shader.Source.c_str();
+                ShaderCI.Macros          = Macros;
+                ShaderCI.CompileFlags    = CompileFlags;
+
+                RefCntAutoPtr<IShader> pShader;
+                pDevice->CreateShader(ShaderCI, &pShader);
+                ASSERT_NE(pShader, nullptr);
+                CreatedShaders.emplace_back(std::move(pShader));
+            }
+        }
+    };
+
+    std::vector<RefCntAutoPtr<IShader>> SyncShaders;
+
+    const auto SyncStartTime = std::chrono::high_resolution_clock::now();
+    CreateShaders(SHADER_COMPILE_FLAG_NONE, SyncShaders);
+    const auto SyncEndTime = std::chrono::high_resolution_clock::now();
+
+    std::vector<RefCntAutoPtr<IShader>> AsyncShaders;
+
+    const auto AsyncStartTime = std::chrono::high_resolution_clock::now();
+    CreateShaders(SHADER_COMPILE_FLAG_ASYNCHRONOUS, AsyncShaders);
+    const auto AsyncSubmitTime = std::chrono::high_resolution_clock::now();
+    for (auto& pShader : AsyncShaders)
+        ASSERT_EQ(pShader->GetStatus(true), SHADER_STATUS_READY);
+    const auto AsyncEndTime = std::chrono::high_resolution_clock::now();
+
+    const auto SyncTime        = std::chrono::duration<double, std::milli>(SyncEndTime - SyncStartTime).count();
+    const auto AsyncTime       = std::chrono::duration<double, std::milli>(AsyncEndTime - AsyncStartTime).count();
+    const auto SubmitTime      = std::chrono::duration<double, std::milli>(AsyncSubmitTime - AsyncStartTime).count();
+
+    std::cout << "[          ] Created " << SyncShaders.size() << " shaders synchronously in " << SyncTime
+              << " ms, asynchronously in " << AsyncTime << " ms (x" << SyncTime / AsyncTime << "), "
+              << SubmitTime << " ms of which were spent in CreateShader()" << std::endl;
+}
+
+#endif
+
+} // namespace
@@ -99,6 +99,9 @@ int TestPipelineStateCInterface(struct IPipelineState* pPSO)
     if (!IsComptible)
         ++num_errors;
 
+    if (IPipelineState_GetStatus(pPSO, true) != PIPELINE_STATE_STATUS_READY)
+        ++num_errors;
+
     return num_errors;
 }
 
@@ -33,12 +33,13 @@ int TestObjectCInterface(struct IObject* pObject);
 
 int TestRenderDeviceCInterface_Misc(struct IRenderDevice* pRenderDevice)
 {
-    IObject*                  pUnknown = NULL;
-    ReferenceCounterValueType RefCnt1 = 0, RefCnt2 = 0;
-    DeviceCaps                deviceCaps;
-    TextureFormatInfo         TexFmtInfo;
-    TextureFormatInfoExt      TexFmtInfoExt;
-    IEngineFactory*           pFactory = NULL;
+    IObject*                        pUnknown = NULL;
+    ReferenceCounterValueType       RefCnt1 = 0, RefCnt2 = 0;
+    DeviceCaps                      deviceCaps;
+    TextureFormatInfo               TexFmtInfo;
+    TextureFormatInfoExt            TexFmtInfoExt;
+    IEngineFactory*                 pFactory = NULL;
+    PipelineStateRegistryStatistics PSORegistryStats;
 
     int num_errors = TestObjectCInterface((struct IObject*)pRenderDevice);
 
@@ -76,6 +77,8 @@ int TestRenderDeviceCInterface_Misc(struct IRenderDevice* pRenderDevice)
     if (pFactory == NULL)
         ++num_errors;
 
+    IRenderDevice_GetPipelineStateRegistryStatistics(pRenderDevice, &PSORegistryStats);
+
     return num_errors;
 }
 
@@ -81,5 +81,8 @@ int TestShaderCInterface(struct IShader* pShader)
     if (ResourceDesc.ArraySize == 0)
         ++num_errors;
 
+    if (IShader_GetStatus(pShader, true) != SHADER_STATUS_READY)
+        ++num_errors;
+
     return num_errors;
 }
@@ -83,6 +83,7 @@ int main(int argc, char** argv)
     for (int i = 1; i < argc; ++i)
     {
         const std::string AdapterArgName = "--adapter=";
+        const std::string GLProgramCacheArgName = "--gl_program_cache=";
 
         const auto* arg = argv[i];
         if (strcmp(arg, "--mode=d3d11") == 0)
@@ -115,6 +116,10 @@ int main(int argc, char** argv)
         {
             TestEnvCI.deviceType = RENDER_DEVICE_TYPE_METAL;
         }
+        else if (strcmp(arg, "--mode=null") == 0)
+        {
+            TestEnvCI.deviceType = RENDER_DEVICE_TYPE_NULL;
+        }
         else if (AdapterArgName.compare(0, AdapterArgName.length(), arg, AdapterArgName.length()) == 0)
         {
             TestEnvCI.AdapterId = static_cast<Uint32>(atoi(arg + AdapterArgName.length()));
@@ -127,6 +132,18 @@ int main(int argc, char** argv)
         {
             TestEnvCI.ForceNonSeparablePrograms = true;
         }
+        else if (GLProgramCacheArgName.compare(0, GLProgramCacheArgName.length(), arg, GLProgramCacheArgName.length()) == 0)
+        {
+            TestEnvCI.GLProgramBinaryCacheDir = arg + GLProgramCacheArgName.length();
+        }
+        else if (strcmp(arg, "--vk_compute_queue") == 0)
+        {
+            TestEnvCI.EnableAsyncComputeQueue = true;
+        }
+        else if (strcmp(arg, "--vk_transfer_queue") == 0)
+        {
+            TestEnvCI.EnableTransferQueue = true;
+        }
     }
 
     if (TestEnvCI.deviceType == RENDER_DEVICE_TYPE_UNDEFINED)
@@ -140,6 +157,16 @@ int main(int argc, char** argv)
         LOG_ERROR_MESSAGE("Non-separable programs can only be forced for OpenGL device.");
     }
 
+    if (TestEnvCI.GLProgramBinaryCacheDir != nullptr && TestEnvCI.deviceType != RENDER_DEVICE_TYPE_GL)
+    {
+        LOG_ERROR_MESSAGE("Program binary cache can only be used with OpenGL device.");
+    }
+
+    if ((TestEnvCI.EnableAsyncComputeQueue || TestEnvCI.EnableTransferQueue) && TestEnvCI.deviceType != RENDER_DEVICE_TYPE_VULKAN)
+    {
+        LOG_ERROR_MESSAGE("Async compute and transfer queues can only be enabled for Vulkan device.");
+    }
+
     SwapChainDesc SCDesc;
     SCDesc.Width             = 512;
     SCDesc.Height            = 512;
@@ -196,6 +223,13 @@ int main(int argc, char** argv)
                 break;
 #endif
 
+#if NULL_SUPPORTED
+            case RENDER_DEVICE_TYPE_NULL:
+                std::cout << "\n\n\n===================== Testing Diligent Core API in Null mode =====================\n\n";
+                pEnv = new TestingEnvironment{TestEnvCI, SCDesc};
+                break;
+#endif
+
             default:
                 LOG_ERROR_AND_THROW("Unsupported device type");
         }
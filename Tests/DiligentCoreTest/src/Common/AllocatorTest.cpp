@@ -26,6 +26,14 @@
  */
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
@@ -124,6 +132,280 @@ TEST(Common_FixedBlockMemoryAllocator, UnalignedSize)
     }
 }
 
+TEST(Common_FixedBlockMemoryAllocator, ThreadCaching)
+{
+    constexpr Uint32 AllocSize             = 24;
+    constexpr Uint32 NumAllocationsPerPage = 16;
+    constexpr Uint32 NumAllocations        = 1000;
+
+    FixedBlockMemoryAllocator TestAllocator(DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage, true);
+
+    std::vector<void*> Allocations(NumAllocations);
+    for (Uint32 pass = 0; pass < 3; ++pass)
+    {
+        std::unordered_set<void*> UniqueAllocations;
+        for (Uint32 i = 0; i < NumAllocations; ++i)
+        {
+            Allocations[i] = TestAllocator.Allocate(AllocSize, "Thread-caching allocator test", __FILE__, __LINE__);
+            ASSERT_NE(Allocations[i], nullptr);
+            EXPECT_EQ(reinterpret_cast<size_t>(Allocations[i]) % sizeof(void*), size_t{0});
+            EXPECT_TRUE(UniqueAllocations.insert(Allocations[i]).second) << "Same block has been allocated twice";
+            memset(Allocations[i], static_cast<int>(i & 0xFF), AllocSize);
+        }
+
+        for (Uint32 i = 0; i < NumAllocations; ++i)
+        {
+            const auto* pBytes = reinterpret_cast<const Uint8*>(Allocations[i]);
+            for (Uint32 b = 0; b < AllocSize; ++b)
+                ASSERT_EQ(pBytes[b], static_cast<Uint8>(i & 0xFF)) << "Block memory has been corrupted";
+        }
+
+        // Release the blocks in different orders
+        for (Uint32 s = 0; s < pass + 1; ++s)
+            for (Uint32 i = s; i < NumAllocations; i += pass + 1)
+                TestAllocator.Free(Allocations[i]);
+    }
+}
+
+TEST(Common_FixedBlockMemoryAllocator, ThreadCachingRemoteFree)
+{
+    constexpr Uint32 AllocSize             = 64;
+    constexpr Uint32 NumAllocationsPerPage = 64;
+    constexpr Uint32 NumThreads            = 4;
+    constexpr Uint32 NumIterations         = 20;
+    constexpr Uint32 NumBlocksPerThread    = 500;
+
+    FixedBlockMemoryAllocator TestAllocator(DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage, true);
+
+    // Every thread allocates blocks and hands them over to the next thread that releases them
+    std::vector<std::vector<void*>> Blocks(NumThreads);
+    for (Uint32 iter = 0; iter < NumIterations; ++iter)
+    {
+        std::vector<std::thread> Threads;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back(
+                [&](Uint32 ThreadId) {
+                    auto& BlocksToFree = Blocks[(ThreadId + 1) % NumThreads];
+                    for (auto* pBlock : BlocksToFree)
+                    {
+                        EXPECT_EQ(*reinterpret_cast<Uint32*>(pBlock), (ThreadId + 1) % NumThreads);
+                        TestAllocator.Free(pBlock);
+                    }
+                    BlocksToFree.clear();
+                },
+                t);
+        }
+        for (auto& Thread : Threads)
+            Thread.join();
+
+        Threads.clear();
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back(
+                [&](Uint32 ThreadId) {
+                    auto& NewBlocks = Blocks[ThreadId];
+                    for (Uint32 i = 0; i < NumBlocksPerThread; ++i)
+                    {
+                        auto* pBlock = TestAllocator.Allocate(AllocSize, "Thread-caching allocator test", __FILE__, __LINE__);
+                        // Threads are joined before the blocks are handed over, so writing the block must not race with anyone
+                        *reinterpret_cast<Uint32*>(pBlock) = ThreadId;
+                        NewBlocks.push_back(pBlock);
+                    }
+                },
+                t);
+        }
+        for (auto& Thread : Threads)
+            Thread.join();
+
+        std::unordered_set<void*> UniqueBlocks;
+        for (const auto& ThreadBlocks : Blocks)
+        {
+            for (auto* pBlock : ThreadBlocks)
+                EXPECT_TRUE(UniqueBlocks.insert(pBlock).second) << "Same block has been allocated twice";
+        }
+    }
+
+    for (auto& ThreadBlocks : Blocks)
+    {
+        for (auto* pBlock : ThreadBlocks)
+            TestAllocator.Free(pBlock);
+    }
+}
+
+class CountingRawMemoryAllocator final : public IMemoryAllocator
+{
+public:
+    virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final
+    {
+        NumAllocations.fetch_add(1);
+        NumOutstandingAllocations.fetch_add(1);
+        return DefaultRawMemoryAllocator::GetAllocator().Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+    }
+
+    virtual void Free(void* Ptr) override final
+    {
+        NumOutstandingAllocations.fetch_sub(1);
+        DefaultRawMemoryAllocator::GetAllocator().Free(Ptr);
+    }
+
+    std::atomic<Int32> NumAllocations{0};
+    std::atomic<Int32> NumOutstandingAllocations{0};
+};
+
+TEST(Common_FixedBlockMemoryAllocator, ThreadCachingTeardown)
+{
+    constexpr Uint32 AllocSize             = 32;
+    constexpr Uint32 NumAllocationsPerPage = 64;
+    constexpr Uint32 NumBlocks             = 16;
+
+    CountingRawMemoryAllocator RawAllocator;
+
+    auto AllocateAndFree = [](FixedBlockMemoryAllocator& Allocator) {
+        std::vector<void*> Blocks(NumBlocks);
+        for (auto& pBlock : Blocks)
+            pBlock = Allocator.Allocate(AllocSize, "Thread-caching allocator teardown test", __FILE__, __LINE__);
+        for (auto* pBlock : Blocks)
+            Allocator.Free(pBlock);
+    };
+
+    {
+        FixedBlockMemoryAllocator TestAllocator(RawAllocator, AllocSize, NumAllocationsPerPage, true);
+
+        // Blocks cached by a thread that has exited are returned to the allocator,
+        // and the cache is reused by the next thread
+        std::thread{AllocateAndFree, std::ref(TestAllocator)}.join();
+        const auto NumRawAllocations = RawAllocator.NumAllocations.load();
+        std::thread{AllocateAndFree, std::ref(TestAllocator)}.join();
+        EXPECT_EQ(RawAllocator.NumAllocations.load(), NumRawAllocations);
+    }
+    EXPECT_EQ(RawAllocator.NumOutstandingAllocations.load(), 0);
+
+    // The allocator is destroyed while the thread that has cached blocks is still running.
+    // All memory must be released by the allocator, and the thread must not touch it at exit.
+    std::atomic<int> Stage{0};
+
+    std::unique_ptr<FixedBlockMemoryAllocator> pTestAllocator{new FixedBlockMemoryAllocator{RawAllocator, AllocSize, NumAllocationsPerPage, true}};
+    std::thread Thread{
+        [&]() {
+            AllocateAndFree(*pTestAllocator);
+            Stage.store(1);
+            while (Stage.load() != 2)
+                std::this_thread::yield();
+        }};
+    while (Stage.load() != 1)
+        std::this_thread::yield();
+
+    pTestAllocator.reset();
+    EXPECT_EQ(RawAllocator.NumOutstandingAllocations.load(), 0);
+
+    Stage.store(2);
+    Thread.join();
+    EXPECT_EQ(RawAllocator.NumOutstandingAllocations.load(), 0);
+}
+
+// Every thread allocates blocks, and every allocated block replaces a random block in the shared
+// slot array. The replaced block is released, so most blocks are released by another thread.
+// Every block is tagged on allocation, and the tag is verified before the block is released:
+// if the same block were handed out twice, the two owners would overwrite each other's tags.
+// Returns the elapsed time in milliseconds.
+double RunMultithreadedAllocations(bool ThreadCaching, Uint32 NumThreads, Uint32 TotalOperations, Uint32& NumCorruptedBlocks)
+{
+    constexpr Uint32 AllocSize             = 128;
+    constexpr Uint32 NumAllocationsPerPage = 256;
+    constexpr Uint32 NumSlots              = 1024;
+    constexpr size_t LastWord              = AllocSize / sizeof(Uint32) - 1;
+
+    FixedBlockMemoryAllocator TestAllocator(DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage, ThreadCaching);
+
+    std::vector<std::atomic<void*>> Slots(NumSlots);
+    for (auto& Slot : Slots)
+        Slot.store(nullptr);
+
+    std::atomic<bool>   Start{false};
+    std::atomic<Uint32> CorruptedBlocks{0};
+
+    auto FreeBlock = [&](void* pBlock) {
+        const auto* pWords = reinterpret_cast<const Uint32*>(pBlock);
+        if (pWords[0] != ~pWords[LastWord])
+            CorruptedBlocks.fetch_add(1);
+        TestAllocator.Free(pBlock);
+    };
+
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back(
+            [&](Uint32 Seed) {
+                while (!Start.load())
+                    std::this_thread::yield();
+
+                for (Uint32 i = 0; i < TotalOperations / NumThreads; ++i)
+                {
+                    Seed = Seed * 1664525u + 1013904223u;
+
+                    auto* pBlock = TestAllocator.Allocate(AllocSize, "Multithreaded allocator test", __FILE__, __LINE__);
+
+                    auto* pWords     = reinterpret_cast<Uint32*>(pBlock);
+                    pWords[0]        = Seed;
+                    pWords[LastWord] = ~Seed;
+                    if (auto* pOldBlock = Slots[(Seed >> 8) % NumSlots].exchange(pBlock))
+                        FreeBlock(pOldBlock);
+                }
+            },
+            t + 1);
+    }
+
+    const auto StartTime = std::chrono::high_resolution_clock::now();
+    Start.store(true);
+    for (auto& Thread : Threads)
+        Thread.join();
+    const auto EndTime = std::chrono::high_resolution_clock::now();
+
+    for (auto& Slot : Slots)
+    {
+        if (auto* pBlock = Slot.load())
+            FreeBlock(pBlock);
+    }
+
+    NumCorruptedBlocks = CorruptedBlocks.load();
+    return std::chrono::duration<double, std::milli>(EndTime - StartTime).count();
+}
+
+TEST(Common_FixedBlockMemoryAllocator, MultithreadedStress)
+{
+    constexpr Uint32 TotalOperations = 1 << 16;
+    for (Uint32 NumThreads = 1; NumThreads <= 16; NumThreads *= 2)
+    {
+        for (int ThreadCaching = 0; ThreadCaching < 2; ++ThreadCaching)
+        {
+            Uint32 NumCorruptedBlocks = 0;
+            RunMultithreadedAllocations(ThreadCaching != 0, NumThreads, TotalOperations, NumCorruptedBlocks);
+            EXPECT_EQ(NumCorruptedBlocks, 0u) << NumThreads << " thread(s), " << (ThreadCaching ? "thread-caching" : "mutex") << " mode";
+        }
+    }
+}
+
+// Compares the mutex and thread-caching modes at 1-64 threads.
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it.
+TEST(Common_FixedBlockMemoryAllocator, DISABLED_MultithreadedPerformance)
+{
+    constexpr Uint32 TotalOperations = 1 << 18;
+    for (Uint32 NumThreads = 1; NumThreads <= 64; NumThreads *= 2)
+    {
+        double Time[2] = {};
+        for (int ThreadCaching = 0; ThreadCaching < 2; ++ThreadCaching)
+        {
+            Uint32 NumCorruptedBlocks = 0;
+            Time[ThreadCaching]       = RunMultithreadedAllocations(ThreadCaching != 0, NumThreads, TotalOperations, NumCorruptedBlocks);
+            EXPECT_EQ(NumCorruptedBlocks, 0u);
+        }
+
+        std::cout << "[          ] " << NumThreads << " thread(s), " << TotalOperations << " allocations: mutex " << Time[0] << " ms, thread-caching " << Time[1] << " ms" << std::endl;
+    }
+}
+
 TEST(Common_FixedLinearAllocator, EmptyAllocator)
 {
     FixedLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
@@ -229,4 +511,60 @@ TEST(Common_DynamicLinearAllocator, ObjectConstruction)
     EXPECT_TRUE(reinterpret_cast<size_t>(Allocator.Allocate(200, 64)) % 64 == 0);
 }
 
+TEST(Common_DynamicLinearAllocator, STDContainers)
+{
+    DynamicLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), 256};
+
+    using MapType = std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, STDAllocatorDynamicLinear<std::pair<const int, int>>>;
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        {
+            MapType Map{0, std::hash<int>{}, std::equal_to<int>{}, STD_ALLOCATOR_DYNAMIC_LINEAR(MapType::value_type, Allocator, "Allocator for unordered_map<int, int>")};
+            for (int i = 0; i < 1000; ++i)
+                Map.emplace(i, i * 2);
+            for (int i = 0; i < 1000; i += 2)
+                Map.erase(i);
+            ASSERT_EQ(Map.size(), size_t{500});
+            for (int i = 1; i < 1000; i += 2)
+                EXPECT_EQ(Map[i], i * 2);
+
+            std::vector<Uint32, STDAllocatorDynamicLinear<Uint32>> Vec{STD_ALLOCATOR_DYNAMIC_LINEAR(Uint32, Allocator, "Allocator for vector<Uint32>")};
+            for (Uint32 i = 0; i < 1000; ++i)
+                Vec.push_back(i);
+            for (Uint32 i = 0; i < 1000; ++i)
+                EXPECT_EQ(Vec[i], i);
+        }
+        Allocator.Discard();
+    }
+}
+
+TEST(Common_DynamicLinearAllocator, SteadyStateAllocations)
+{
+    auto& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    DynamicLinearAllocator Allocator{RawAllocator, 1024};
+
+    auto AllocateFrameData = [&Allocator]() {
+        for (Uint32 i = 0; i < 256; ++i)
+        {
+            auto* pData = Allocator.Allocate<Uint64>(i % 16 + 1);
+            ASSERT_NE(pData, nullptr);
+            pData[0] = i;
+        }
+    };
+
+    // The first frame allocates the memory blocks
+    AllocateFrameData();
+    Allocator.Discard();
+
+    // Subsequent frames with the same workload must reuse the blocks
+    const auto NumAllocations = RawAllocator.GetAllocationCount();
+    for (Uint32 frame = 0; frame < 10; ++frame)
+    {
+        AllocateFrameData();
+        Allocator.Discard();
+    }
+    EXPECT_EQ(RawAllocator.GetAllocationCount(), NumAllocations);
+}
+
 } // namespace
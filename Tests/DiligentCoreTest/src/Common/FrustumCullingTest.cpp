@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "FrustumCulling.hpp"
+#include "FastRand.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class BoundBoxArrays
+{
+public:
+    BoundBoxArrays(size_t NumBoxes, unsigned int Seed)
+    {
+        FastRandFloat CenterRnd{Seed, -100, 100};
+        FastRandFloat SizeRnd{Seed + 1, 0.1f, 20};
+        for (size_t i = 0; i < NumBoxes; ++i)
+        {
+            const float3 Center{CenterRnd(), CenterRnd(), CenterRnd()};
+            const float3 HalfSize{SizeRnd(), SizeRnd(), SizeRnd()};
+            Boxes.push_back(BoundBox{Center - HalfSize, Center + HalfSize});
+        }
+
+        for (int c = 0; c < 6; ++c)
+        {
+            Coords[c].resize(NumBoxes);
+            for (size_t i = 0; i < NumBoxes; ++i)
+                Coords[c][i] = reinterpret_cast<const float*>(&Boxes[i])[c];
+        }
+
+        SOA.MinX = Coords[0].data();
+        SOA.MinY = Coords[1].data();
+        SOA.MinZ = Coords[2].data();
+        SOA.MaxX = Coords[3].data();
+        SOA.MaxY = Coords[4].data();
+        SOA.MaxZ = Coords[5].data();
+    }
+
+    std::vector<BoundBox> Boxes;
+    BoundBoxArraysSOA     SOA;
+
+private:
+    std::vector<float> Coords[6];
+};
+
+ViewFrustumExt MakeFrustum()
+{
+    const auto View = float4x4::RotationY(0.5f) * float4x4::Translation(10, -5, 20);
+    const auto Proj = float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 150.f, false);
+
+    ViewFrustumExt Frustum;
+    ExtractViewFrustumPlanesFromMatrix(View * Proj, Frustum, false);
+    return Frustum;
+}
+
+template <typename FrustumType>
+void TestBoxVisibility(const FrustumType& Frustum, FRUSTUM_PLANE_FLAGS PlaneFlags)
+{
+    // Odd number of boxes to test the scalar tail
+    constexpr size_t     NumBoxes = 1003;
+    const BoundBoxArrays Boxes{NumBoxes, 0};
+
+    std::vector<BoxVisibility> Visibility(NumBoxes);
+    GetBoxVisibility(Frustum, Boxes.SOA, 0, NumBoxes, Visibility.data(), PlaneFlags);
+
+    size_t NumVisible[3] = {};
+    for (size_t i = 0; i < NumBoxes; ++i)
+    {
+        const auto RefVisibility = GetBoxVisibility(Frustum, Boxes.Boxes[i], PlaneFlags);
+        EXPECT_EQ(Visibility[i], RefVisibility) << "Box " << i;
+        ++NumVisible[static_cast<int>(RefVisibility)];
+    }
+    // Make sure that all cases are covered
+    if (PlaneFlags != FRUSTUM_PLANE_FLAG_NONE)
+    {
+        EXPECT_GT(NumVisible[static_cast<int>(BoxVisibility::Invisible)], size_t{0});
+        EXPECT_GT(NumVisible[static_cast<int>(BoxVisibility::Intersecting)], size_t{0});
+    }
+    EXPECT_GT(NumVisible[static_cast<int>(BoxVisibility::FullyVisible)], size_t{0});
+
+    // Sub-range that does not start at a multiple of 4
+    std::vector<BoxVisibility> SubRange(NumBoxes, BoxVisibility::Invisible);
+    GetBoxVisibility(Frustum, Boxes.SOA, 5, 101, SubRange.data(), PlaneFlags);
+    for (size_t i = 5; i < 5 + 101; ++i)
+        EXPECT_EQ(SubRange[i], Visibility[i]) << "Box " << i;
+
+    std::vector<Uint32> Mask((NumBoxes + 31) / 32, ~0u);
+    GetBoxVisibilityMask(Frustum, Boxes.SOA, 0, NumBoxes, Mask.data(), PlaneFlags);
+    for (size_t i = 0; i < Mask.size() * 32; ++i)
+    {
+        const bool IsVisible = (Mask[i / 32] & (1u << (i % 32))) != 0;
+        EXPECT_EQ(IsVisible, i < NumBoxes && Visibility[i] != BoxVisibility::Invisible) << "Box " << i;
+    }
+}
+
+TEST(Common_FrustumCulling, BoxVisibility)
+{
+    const auto Frustum = MakeFrustum();
+    TestBoxVisibility(static_cast<const ViewFrustum&>(Frustum), FRUSTUM_PLANE_FLAG_FULL_FRUSTUM);
+    TestBoxVisibility(static_cast<const ViewFrustum&>(Frustum), FRUSTUM_PLANE_FLAG_OPEN_NEAR);
+    TestBoxVisibility(static_cast<const ViewFrustum&>(Frustum), FRUSTUM_PLANE_FLAG_LEFT_PLANE | FRUSTUM_PLANE_FLAG_TOP_PLANE);
+    TestBoxVisibility(static_cast<const ViewFrustum&>(Frustum), FRUSTUM_PLANE_FLAG_NONE);
+}
+
+TEST(Common_FrustumCulling, BoxVisibilityExt)
+{
+    const auto Frustum = MakeFrustum();
+    TestBoxVisibility(Frustum, FRUSTUM_PLANE_FLAG_FULL_FRUSTUM);
+    TestBoxVisibility(Frustum, FRUSTUM_PLANE_FLAG_OPEN_NEAR);
+}
+
+TEST(Common_FrustumCulling, Parallel)
+{
+    const auto Frustum = MakeFrustum();
+
+    constexpr size_t     NumBoxes = 10001;
+    const BoundBoxArrays Boxes{NumBoxes, 1};
+
+    std::vector<BoxVisibility> RefVisibility(NumBoxes);
+    GetBoxVisibility(Frustum, Boxes.SOA, 0, NumBoxes, RefVisibility.data());
+
+    std::vector<Uint32> RefMask((NumBoxes + 31) / 32);
+    GetBoxVisibilityMask(Frustum, Boxes.SOA, 0, NumBoxes, RefMask.data());
+
+    ThreadingTools::ThreadPool Pool{4};
+    for (size_t MinBoxesPerTask : {size_t{1}, size_t{100}, size_t{1000}, size_t{100000}})
+    {
+        std::vector<BoxVisibility> Visibility(NumBoxes);
+        GetBoxVisibilityParallel(Pool, Frustum, Boxes.SOA, NumBoxes, Visibility.data(), FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, MinBoxesPerTask);
+        EXPECT_EQ(Visibility, RefVisibility);
+
+        std::vector<Uint32> Mask(RefMask.size());
+        GetBoxVisibilityMaskParallel(Pool, Frustum, Boxes.SOA, NumBoxes, Mask.data(), FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, MinBoxesPerTask);
+        EXPECT_EQ(Mask, RefMask);
+    }
+}
+
+} // namespace
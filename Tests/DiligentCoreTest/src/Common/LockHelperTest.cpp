@@ -0,0 +1,192 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include "LockHelper.hpp"
+#include "Timer.hpp"
+
+#include <thread>
+#include <vector>
+#include <iostream>
+
+#include "gtest/gtest.h"
+
+using namespace ThreadingTools;
+
+namespace
+{
+
+// Increments the counter NumIterations times in each of NumThreads threads under the lock
+// and returns the total time
+double RunContention(LockFlag& Flag, size_t NumThreads, int NumIterations, int& Counter)
+{
+    std::vector<std::thread> Threads;
+    Diligent::Timer          T;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back(
+            [&]() //
+            {
+                for (int i = 0; i < NumIterations; ++i)
+                {
+                    LockHelper Lock{Flag};
+                    ++Counter;
+                }
+            });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+    return T.GetElapsedTime();
+}
+
+TEST(Common_LockHelper, TryLock)
+{
+    LockFlag Flag;
+
+    LockHelper Lock1;
+    EXPECT_TRUE(Lock1.TryLock(Flag));
+    EXPECT_EQ(Flag, LockFlag::LOCK_FLAG_LOCKED);
+
+    LockHelper Lock2;
+    EXPECT_FALSE(Lock2.TryLock(Flag));
+
+    Lock1.Unlock();
+    EXPECT_EQ(Flag, LockFlag::LOCK_FLAG_UNLOCKED);
+    EXPECT_TRUE(Lock2.TryLock(Flag));
+}
+
+TEST(Common_LockHelper, MutualExclusion)
+{
+    LockFlag Flag;
+
+    constexpr size_t NumThreads    = 8;
+    constexpr int    NumIterations = 20000;
+
+    int Counter = 0;
+    RunContention(Flag, NumThreads, NumIterations, Counter);
+    EXPECT_EQ(Counter, static_cast<int>(NumThreads) * NumIterations);
+    EXPECT_EQ(Flag, LockFlag::LOCK_FLAG_UNLOCKED);
+}
+
+TEST(Common_LockHelper, FlagSize)
+{
+#if DILIGENT_LOCK_STATISTICS
+    EXPECT_EQ(sizeof(LockFlag), sizeof(Atomics::AtomicLong) + sizeof(LockStatistics*));
+#else
+    // The flag is a member of every reference-counted object and must not carry the statistics pointer
+    EXPECT_EQ(sizeof(LockFlag), sizeof(Atomics::AtomicLong));
+#endif
+}
+
+TEST(Common_LockHelper, Statistics)
+{
+    EXPECT_EQ(LockStatistics::Register("Common_LockHelper.Statistics"), nullptr);
+
+    LockStatistics::SetCollectionEnabled(true);
+    auto* pStats = LockStatistics::Register("Common_LockHelper.Statistics");
+    LockStatistics::SetCollectionEnabled(false);
+    ASSERT_NE(pStats, nullptr);
+    EXPECT_STREQ(pStats->GetName(), "Common_LockHelper.Statistics");
+
+    LockStatistics::SetCollectionEnabled(true);
+    EXPECT_EQ(LockStatistics::Register("Common_LockHelper.Statistics"), pStats);
+    LockStatistics::SetCollectionEnabled(false);
+
+    const auto Dump = LockStatistics::DumpAll();
+    EXPECT_NE(Dump.find("Common_LockHelper.Statistics"), std::string::npos);
+
+    LockFlag Flag;
+    Flag.SetStatistics(pStats);
+#if !DILIGENT_LOCK_STATISTICS
+    EXPECT_EQ(Flag.GetStatistics(), nullptr);
+    GTEST_SKIP() << "Lock statistics are disabled in this build (DILIGENT_LOCK_STATISTICS)";
+#endif
+    EXPECT_EQ(Flag.GetStatistics(), pStats);
+
+    {
+        LockHelper Lock{Flag};
+        EXPECT_FALSE(LockHelper{}.TryLock(Flag));
+    }
+    {
+        LockHelper Lock;
+        EXPECT_TRUE(Lock.TryLock(Flag));
+    }
+
+    auto Cnt = pStats->GetCounters();
+    EXPECT_EQ(Cnt.Acquisitions, 2);
+    EXPECT_EQ(Cnt.ContendedAcquisitions, 0);
+
+    constexpr size_t NumThreads    = 4;
+    constexpr int    NumIterations = 10000;
+
+    int Counter = 0;
+    RunContention(Flag, NumThreads, NumIterations, Counter);
+    Cnt = pStats->GetCounters();
+    EXPECT_EQ(Cnt.Acquisitions, 2 + static_cast<Atomics::Int64>(NumThreads) * NumIterations);
+    EXPECT_LE(Cnt.ContendedAcquisitions, Cnt.Acquisitions);
+    if (Cnt.ContendedAcquisitions > 0)
+    {
+        EXPECT_GT(Cnt.SpinCount, 0);
+    }
+
+    pStats->Reset();
+    Cnt = pStats->GetCounters();
+    EXPECT_EQ(Cnt.Acquisitions, 0);
+    EXPECT_EQ(Cnt.SpinCount, 0);
+}
+
+// Measures the cost of an acquisition with 1 to N threads contending for the same lock.
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it.
+TEST(Common_LockHelperBenchmark, DISABLED_Contention)
+{
+    LockStatistics::SetCollectionEnabled(true);
+    auto* pStats = LockStatistics::Register("Common_LockHelperBenchmark.Contention");
+    LockStatistics::SetCollectionEnabled(false);
+
+    constexpr int NumIterations = 100000;
+
+    const size_t MaxThreads = std::max(std::thread::hardware_concurrency(), 2u);
+    for (size_t NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2)
+    {
+        LockFlag Flag;
+        Flag.SetStatistics(pStats);
+        pStats->Reset();
+
+        int        Counter = 0;
+        const auto Time    = RunContention(Flag, NumThreads, NumIterations, Counter);
+        EXPECT_EQ(Counter, static_cast<int>(NumThreads) * NumIterations);
+
+        const auto Cnt = pStats->GetCounters();
+        std::cout << "[          ] " << NumThreads << " thread(s): "
+                  << Time * 1e9 / static_cast<double>(Counter) << " ns/acquisition, "
+                  << Cnt.ContendedAcquisitions << " contended, "
+                  << Cnt.SpinCount << " spins, "
+                  << Cnt.YieldCount << " yields" << std::endl;
+    }
+}
+
+} // namespace
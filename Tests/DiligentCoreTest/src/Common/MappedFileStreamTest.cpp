@@ -0,0 +1,253 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "MappedFileStream.hpp"
+#include "BasicFileStream.hpp"
+#include "DataBlobImpl.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "Timer.hpp"
+
+#if PLATFORM_LINUX
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+static constexpr char TestDirectory[] = "MappedFileStreamTest";
+
+std::string GetTestFilePath(Uint32 i)
+{
+    return std::string{TestDirectory} + FileSystem::GetSlashSymbol() + "File" + std::to_string(i) + ".fxh";
+}
+
+std::string MakeFileContents(Uint32 i, size_t Size)
+{
+    std::string Contents;
+    Contents.reserve(Size);
+    while (Contents.size() < Size)
+        Contents += "float4 Function" + std::to_string(i) + "_" + std::to_string(Contents.size()) + "(float4 f) { return f * 2.0; }\n";
+    Contents.resize(Size);
+    return Contents;
+}
+
+void WriteTestFile(const std::string& Path, const std::string& Contents)
+{
+    FileWrapper File{Path.c_str(), EFileAccessMode::Overwrite};
+    ASSERT_TRUE(!!File);
+    if (!Contents.empty())
+    {
+        EXPECT_TRUE(File->Write(Contents.data(), Contents.size()));
+    }
+}
+
+class Common_MappedFileStream : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        FileSystem::CreateDirectory(TestDirectory);
+    }
+
+    static void TearDownTestSuite()
+    {
+        FileSystem::DeleteDirectory(TestDirectory);
+    }
+};
+
+#if PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS
+
+TEST_F(Common_MappedFileStream, Read)
+{
+    const auto Path     = GetTestFilePath(0);
+    const auto Contents = MakeFileContents(0, 10000);
+    WriteTestFile(Path, Contents);
+
+    size_t FileSize = 0;
+    EXPECT_TRUE(MappedFileStream::GetMappableFileSize(Path.c_str(), FileSize));
+    EXPECT_EQ(FileSize, Contents.size());
+    EXPECT_FALSE(MappedFileStream::GetMappableFileSize(TestDirectory, FileSize));
+
+    RefCntAutoPtr<MappedFileStream> pStream{MakeNewRCObj<MappedFileStream>()(Path.c_str())};
+    ASSERT_TRUE(pStream->IsValid());
+    EXPECT_EQ(pStream->GetSize(), Contents.size());
+
+    char Header[16] = {};
+    EXPECT_TRUE(pStream->Read(Header, sizeof(Header)));
+    EXPECT_EQ(std::string(Header, sizeof(Header)), Contents.substr(0, sizeof(Header)));
+
+    // The stream is not at the beginning, so the data must be copied
+    auto pData = ReadStreamData(pStream);
+    ASSERT_TRUE(pData);
+    EXPECT_EQ(pData->GetSize(), Contents.size() - sizeof(Header));
+    EXPECT_EQ(std::string(static_cast<const char*>(pData->GetConstDataPtr()), pData->GetSize()), Contents.substr(sizeof(Header)));
+
+    EXPECT_FALSE(pStream->Read(Header, 1));
+    EXPECT_FALSE(pStream->Write(Header, 1));
+}
+
+TEST_F(Common_MappedFileStream, ZeroCopy)
+{
+    const auto Path     = GetTestFilePath(1);
+    const auto Contents = MakeFileContents(1, 5000);
+    WriteTestFile(Path, Contents);
+
+    RefCntAutoPtr<IFileStream> pStream{MakeNewRCObj<MappedFileStream>()(Path.c_str())};
+    ASSERT_TRUE(pStream->IsValid());
+
+    auto pData = ReadStreamData(pStream);
+    ASSERT_TRUE(pData);
+    EXPECT_NE(dynamic_cast<MappedDataBlob*>(pData.RawPtr()), nullptr) << "The data must not be copied";
+    ASSERT_EQ(pData->GetSize(), Contents.size());
+    EXPECT_EQ(std::string(static_cast<const char*>(pData->GetConstDataPtr()), pData->GetSize()), Contents);
+
+    // Writing to the blob must not modify the file
+    static_cast<char*>(pData->GetDataPtr())[0] = '#';
+    pData.Release();
+    pStream.Release();
+
+    RefCntAutoPtr<IFileStream> pBasicStream{MakeNewRCObj<BasicFileStream>()(Path.c_str())};
+    auto                       pFileData = ReadStreamData(pBasicStream);
+    ASSERT_EQ(pFileData->GetSize(), Contents.size());
+    EXPECT_EQ(static_cast<const char*>(pFileData->GetConstDataPtr())[0], Contents[0]);
+}
+
+TEST_F(Common_MappedFileStream, EmptyFile)
+{
+    const auto Path = GetTestFilePath(2);
+    WriteTestFile(Path, "");
+
+    RefCntAutoPtr<MappedFileStream> pStream{MakeNewRCObj<MappedFileStream>()(Path.c_str())};
+    ASSERT_TRUE(pStream->IsValid());
+    EXPECT_EQ(pStream->GetSize(), size_t{0});
+
+    auto pData = ReadStreamData(pStream);
+    ASSERT_TRUE(pData);
+    EXPECT_EQ(pData->GetSize(), size_t{0});
+}
+
+// Compares loading a shader tree through the basic file stream (the file is read into
+// a new data blob) with loading it through the mapped file stream (no copy).
+void RunLoadBenchmark(Uint32 FirstFileId, Uint32 NumFiles, size_t FileSize)
+{
+    std::vector<std::string> Paths;
+    for (Uint32 i = 0; i < NumFiles; ++i)
+    {
+        Paths.emplace_back(GetTestFilePath(FirstFileId + i));
+        WriteTestFile(Paths.back(), MakeFileContents(i, FileSize));
+    }
+
+    auto EvictFromPageCache = [&Paths]() {
+#    if PLATFORM_LINUX
+        for (const auto& Path : Paths)
+        {
+            int fd = open(Path.c_str(), O_RDONLY);
+            if (fd >= 0)
+            {
+                fdatasync(fd);
+                posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+                close(fd);
+            }
+        }
+#    endif
+    };
+
+    auto LoadFiles = [&Paths](bool UseMappedStream, size_t& BytesCopied) {
+        size_t Checksum = 0;
+        BytesCopied     = 0;
+        for (const auto& Path : Paths)
+        {
+            RefCntAutoPtr<IFileStream> pStream;
+            if (UseMappedStream)
+                pStream = MakeNewRCObj<MappedFileStream>()(Path.c_str());
+            else
+                pStream = MakeNewRCObj<BasicFileStream>()(Path.c_str());
+            auto pData = ReadStreamData(pStream);
+            if (dynamic_cast<MappedDataBlob*>(pData.RawPtr()) == nullptr)
+                BytesCopied += pData->GetSize();
+
+            // Touch every page as a compiler would
+            const auto* pChars = static_cast<const char*>(pData->GetConstDataPtr());
+            for (size_t i = 0; i < pData->GetSize(); i += 1024)
+                Checksum += pChars[i];
+        }
+        return Checksum;
+    };
+
+    for (const char* Mode : {"cold", "warm"})
+    {
+        const bool Cold = Mode[0] == 'c';
+        double     Time[2]        = {};
+        size_t     BytesCopied[2] = {};
+        size_t     Checksum[2]    = {};
+        for (int mapped = 0; mapped < 2; ++mapped)
+        {
+            if (Cold)
+                EvictFromPageCache();
+            else
+                LoadFiles(mapped != 0, BytesCopied[mapped]);
+
+            Timer T;
+            Checksum[mapped] = LoadFiles(mapped != 0, BytesCopied[mapped]);
+            Time[mapped]     = T.GetElapsedTime();
+        }
+        EXPECT_EQ(Checksum[0], Checksum[1]);
+        EXPECT_EQ(BytesCopied[0], NumFiles * FileSize);
+        EXPECT_EQ(BytesCopied[1], size_t{0});
+
+        std::cout << "[          ] " << Mode << " load of " << NumFiles << " x " << FileSize / 1024 << " KB files: basic stream " << Time[0] * 1000.0 << " ms ("
+                  << BytesCopied[0] / 1024 << " KB copied), mapped stream " << Time[1] * 1000.0 << " ms ("
+                  << BytesCopied[1] / 1024 << " KB copied)" << std::endl;
+    }
+}
+
+// These are timing tests that are not run by default, use --gtest_also_run_disabled_tests
+// to run them. Common_MappedFileStream.ZeroCopy verifies that the mapped data is not copied.
+TEST_F(Common_MappedFileStream, DISABLED_LoadBenchmark_SmallFiles)
+{
+    RunLoadBenchmark(100, 64, 16 << 10);
+}
+
+TEST_F(Common_MappedFileStream, DISABLED_LoadBenchmark_LargeFiles)
+{
+    RunLoadBenchmark(200, 8, 256 << 10);
+}
+
+#endif
+
+} // namespace
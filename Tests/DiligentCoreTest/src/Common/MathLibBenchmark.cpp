@@ -0,0 +1,287 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "BasicMath.hpp"
+#include "FrustumCulling.hpp"
+#include "FastRand.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Micro-benchmarks that compare the vectorized float specializations with the scalar code.
+// The scalar baseline for multiplications is a float matrix type that is not specialized.
+// The inverse is compared with double4x4 that always uses the generic template.
+template <typename T>
+struct ScalarMatrix4x4 : Matrix4x4<T>
+{
+    ScalarMatrix4x4() {}
+    explicit ScalarMatrix4x4(const Matrix4x4<T>& m) :
+        Matrix4x4<T>{m} {}
+
+    friend ScalarMatrix4x4 operator*(const ScalarMatrix4x4& m1, const ScalarMatrix4x4& m2)
+    {
+        ScalarMatrix4x4 mOut;
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                for (int k = 0; k < 4; k++)
+                {
+                    mOut.m[i][j] += m1.m[i][k] * m2.m[k][j];
+                }
+            }
+        }
+        return mOut;
+    }
+
+    friend Vector4<T> operator*(const Vector4<T>& v, const ScalarMatrix4x4& m)
+    {
+        Vector4<T> out;
+        out[0] = v.x * m[0][0] + v.y * m[1][0] + v.z * m[2][0] + v.w * m[3][0];
+        out[1] = v.x * m[0][1] + v.y * m[1][1] + v.z * m[2][1] + v.w * m[3][1];
+        out[2] = v.x * m[0][2] + v.y * m[1][2] + v.z * m[2][2] + v.w * m[3][2];
+        out[3] = v.x * m[0][3] + v.y * m[1][3] + v.z * m[2][3] + v.w * m[3][3];
+        return out;
+    }
+};
+
+constexpr size_t NumMatrices = 1024;
+constexpr size_t NumVectors  = 1 << 16;
+constexpr int    NumRepeats  = 64;
+
+template <typename MatrixType>
+std::vector<MatrixType> MakeMatrices()
+{
+    FastRandFloat Rnd{0, -1, 1};
+
+    std::vector<MatrixType> Matrices(NumMatrices);
+    for (auto& m : Matrices)
+    {
+        for (int i = 0; i < 16; ++i)
+            m.Data()[i] = Rnd();
+        for (int i = 0; i < 4; ++i)
+            m.m[i][i] += 4;
+    }
+    return Matrices;
+}
+
+std::vector<float4> MakeVectors()
+{
+    FastRandFloat Rnd{1, -1, 1};
+
+    std::vector<float4> Vectors(NumVectors);
+    for (auto& v : Vectors)
+        v = float4{Rnd(), Rnd(), Rnd(), 1};
+    return Vectors;
+}
+
+void PrintResult(const char* Name, double ScalarTime, double SIMDTime, size_t NumOps)
+{
+    std::cout << "[          ] " << Name << ": scalar " << ScalarTime * 1e9 / static_cast<double>(NumOps)
+              << " ns, SIMD " << SIMDTime * 1e9 / static_cast<double>(NumOps)
+              << " ns (x" << ScalarTime / SIMDTime << ")" << std::endl;
+}
+
+template <typename MatrixType>
+double MatrixMultiplyTime(const std::vector<MatrixType>& Matrices, float& Checksum)
+{
+    Timer T;
+    for (int r = 0; r < NumRepeats; ++r)
+    {
+        for (size_t i = 1; i < Matrices.size(); ++i)
+            Checksum += (Matrices[i] * Matrices[i - 1]).m[r & 3][i & 3];
+    }
+    return T.GetElapsedTime();
+}
+
+template <typename MatrixType>
+double MatrixInverseTime(const std::vector<MatrixType>& Matrices, float& Checksum)
+{
+    Timer T;
+    for (int r = 0; r < NumRepeats; ++r)
+    {
+        for (const auto& m : Matrices)
+            Checksum += m.Inverse().m[r & 3][0];
+    }
+    return T.GetElapsedTime();
+}
+
+template <typename MatrixType>
+double TransformTime(const std::vector<float4>& Vectors, const MatrixType& m, float& Checksum)
+{
+    std::vector<float4> Out(Vectors.size());
+
+    Timer T;
+    for (int r = 0; r < NumRepeats; ++r)
+    {
+        for (size_t i = 0; i < Vectors.size(); ++i)
+            Out[i] = Vectors[i] * m;
+        Checksum += Out[r].x;
+    }
+    return T.GetElapsedTime();
+}
+
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. Common_BasicMath.SIMDMatrixMultiply verifies the results.
+TEST(Common_BasicMathBenchmark, DISABLED_MatrixMultiply)
+{
+    const auto Matrices       = MakeMatrices<float4x4>();
+    const auto ScalarMatrices = MakeMatrices<ScalarMatrix4x4<float>>();
+
+    float      Checksum[2] = {};
+    const auto ScalarTime  = MatrixMultiplyTime(ScalarMatrices, Checksum[0]);
+    const auto SIMDTime    = MatrixMultiplyTime(Matrices, Checksum[1]);
+    PrintResult("float4x4 * float4x4", ScalarTime, SIMDTime, (NumMatrices - 1) * NumRepeats);
+    EXPECT_NEAR(Checksum[0], Checksum[1], std::abs(Checksum[0]) * 1e-4f);
+}
+
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. Common_BasicMath.SIMDMatrixInverse verifies the results.
+TEST(Common_BasicMathBenchmark, DISABLED_MatrixInverse)
+{
+    const auto Matrices       = MakeMatrices<float4x4>();
+    const auto ScalarMatrices = MakeMatrices<double4x4>();
+
+    float      Checksum[2] = {};
+    const auto ScalarTime  = MatrixInverseTime(ScalarMatrices, Checksum[0]);
+    const auto SIMDTime    = MatrixInverseTime(Matrices, Checksum[1]);
+    PrintResult("float4x4::Inverse (scalar baseline is double4x4)", ScalarTime, SIMDTime, NumMatrices * NumRepeats);
+    EXPECT_NEAR(Checksum[0], Checksum[1], std::abs(Checksum[0]) * 1e-3f);
+}
+
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. Common_BasicMath.SIMDMatrixVectorMultiply and Common_BasicMath.TransformArrays
+// verify the results.
+TEST(Common_BasicMathBenchmark, DISABLED_VectorTransform)
+{
+    const auto Vectors = MakeVectors();
+    const auto m       = MakeMatrices<float4x4>()[0];
+
+    float      Checksum[3] = {};
+    const auto ScalarTime  = TransformTime(Vectors, ScalarMatrix4x4<float>{m}, Checksum[0]);
+    const auto SIMDTime    = TransformTime(Vectors, m, Checksum[1]);
+    PrintResult("float4 * float4x4", ScalarTime, SIMDTime, NumVectors * NumRepeats);
+
+    std::vector<float4> Out(Vectors.size());
+
+    Timer T;
+    for (int r = 0; r < NumRepeats; ++r)
+    {
+        TransformVectors(Vectors.data(), Out.data(), Vectors.size(), m);
+        Checksum[2] += Out[r].x;
+    }
+    PrintResult("TransformVectors", ScalarTime, T.GetElapsedTime(), NumVectors * NumRepeats);
+    EXPECT_EQ(Checksum[1], Checksum[2]);
+}
+
+void PrintThroughput(const char* Name, double Time, size_t NumBoxes)
+{
+    std::cout << "[          ] " << Name << ": " << static_cast<double>(NumBoxes) / Time * 1e-6 << " M boxes/s" << std::endl;
+}
+
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. Common_FrustumCulling tests verify the results.
+TEST(Common_AdvancedMathBenchmark, DISABLED_BoxVisibility)
+{
+    constexpr size_t NumBoxes = 200000;
+
+    FastRandFloat         Rnd{2, -100, 100};
+    std::vector<BoundBox> Boxes(NumBoxes);
+    std::vector<float>    Coords[6];
+    for (auto& c : Coords)
+        c.resize(NumBoxes);
+    for (size_t i = 0; i < NumBoxes; ++i)
+    {
+        const float3 Center{Rnd(), Rnd(), Rnd()};
+        const float3 HalfSize{1 + std::abs(Rnd()) * 0.05f, 1 + std::abs(Rnd()) * 0.05f, 1 + std::abs(Rnd()) * 0.05f};
+        Boxes[i] = BoundBox{Center - HalfSize, Center + HalfSize};
+        for (int c = 0; c < 6; ++c)
+            Coords[c][i] = reinterpret_cast<const float*>(&Boxes[i])[c];
+    }
+
+    BoundBoxArraysSOA SOA;
+    SOA.MinX = Coords[0].data();
+    SOA.MinY = Coords[1].data();
+    SOA.MinZ = Coords[2].data();
+    SOA.MaxX = Coords[3].data();
+    SOA.MaxY = Coords[4].data();
+    SOA.MaxZ = Coords[5].data();
+
+    ViewFrustumExt Frustum;
+    ExtractViewFrustumPlanesFromMatrix(float4x4::Projection(PI_F / 2.f, 1.f, 1.f, 100.f, false), Frustum, false);
+
+    std::vector<BoxVisibility> RefVisibility(NumBoxes);
+    std::vector<BoxVisibility> Visibility(NumBoxes);
+    std::vector<Uint32>        Mask((NumBoxes + 31) / 32);
+
+    double ScalarTime = 0;
+    {
+        Timer T;
+        for (int r = 0; r < NumRepeats / 8; ++r)
+        {
+            for (size_t i = 0; i < NumBoxes; ++i)
+                RefVisibility[i] = GetBoxVisibility(Frustum, Boxes[i]);
+        }
+        ScalarTime = T.GetElapsedTime();
+        PrintThroughput("GetBoxVisibility (scalar)", ScalarTime, NumBoxes * (NumRepeats / 8));
+    }
+
+    {
+        Timer T;
+        for (int r = 0; r < NumRepeats / 8; ++r)
+            GetBoxVisibility(Frustum, SOA, 0, NumBoxes, Visibility.data());
+        PrintThroughput("GetBoxVisibility (SOA)", T.GetElapsedTime(), NumBoxes * (NumRepeats / 8));
+        EXPECT_EQ(Visibility, RefVisibility);
+    }
+
+    {
+        Timer T;
+        for (int r = 0; r < NumRepeats / 8; ++r)
+            GetBoxVisibilityMask(Frustum, SOA, 0, NumBoxes, Mask.data());
+        PrintThroughput("GetBoxVisibilityMask (SOA)", T.GetElapsedTime(), NumBoxes * (NumRepeats / 8));
+    }
+
+    {
+        ThreadingTools::ThreadPool Pool;
+
+        Timer T;
+        for (int r = 0; r < NumRepeats / 8; ++r)
+            GetBoxVisibilityParallel(Pool, Frustum, SOA, NumBoxes, Visibility.data());
+        PrintThroughput("GetBoxVisibilityParallel (SOA)", T.GetElapsedTime(), NumBoxes * (NumRepeats / 8));
+        EXPECT_EQ(Visibility, RefVisibility);
+    }
+}
+
+} // namespace
@@ -30,6 +30,7 @@
 
 #include "BasicMath.hpp"
 #include "AdvancedMath.hpp"
+#include "FastRand.hpp"
 
 #include "gtest/gtest.h"
 
@@ -2156,4 +2157,184 @@ TEST(Common_AdvancedMath, CheckBox2DBox2DOverlap)
     // clang-format on
 }
 
+
+// Scalar float references that accumulate in the same order as BasicMath templates
+float4x4 MulRef(const float4x4& m1, const float4x4& m2)
+{
+    float4x4 out;
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            float r = 0;
+            for (int k = 0; k < 4; ++k)
+                r += m1.m[i][k] * m2.m[k][j];
+            out.m[i][j] = r;
+        }
+    }
+    return out;
+}
+
+float4 MulRef(const float4& v, const float4x4& m)
+{
+    float4 out;
+    for (int j = 0; j < 4; ++j)
+        out[j] = v.x * m.m[0][j] + v.y * m.m[1][j] + v.z * m.m[2][j] + v.w * m.m[3][j];
+    return out;
+}
+
+float4 MulRef(const float4x4& m, const float4& v)
+{
+    float4 out;
+    for (int i = 0; i < 4; ++i)
+        out[i] = m.m[i][0] * v.x + m.m[i][1] * v.y + m.m[i][2] * v.z + m.m[i][3] * v.w;
+    return out;
+}
+
+float4x4 RandomMatrix(FastRandFloat& Rnd)
+{
+    float4x4 m;
+    for (int i = 0; i < 16; ++i)
+        m.Data()[i] = Rnd();
+    return m;
+}
+
+// Vectorized paths are bit-identical to the scalar ones unless FMA contracts multiplications and additions.
+// In the latter case, the error is relative to the magnitude of the products (up to 400 for inputs in [-10, 10])
+// rather than of the result, which may be close to zero due to cancellation.
+#if defined(__FMA__)
+#    define EXPECT_SIMD_EQ(Val, Ref) EXPECT_NEAR(Val, Ref, 1e-3f)
+#else
+#    define EXPECT_SIMD_EQ(Val, Ref) EXPECT_EQ(Val, Ref)
+#endif
+
+TEST(Common_BasicMath, SIMDMatrixMultiply)
+{
+    FastRandFloat Rnd{0, -10, 10};
+    for (int iter = 0; iter < 1000; ++iter)
+    {
+        const auto m1  = RandomMatrix(Rnd);
+        const auto m2  = RandomMatrix(Rnd);
+        const auto m   = m1 * m2;
+        const auto Ref = MulRef(m1, m2);
+        for (int i = 0; i < 16; ++i)
+            EXPECT_SIMD_EQ(m.Data()[i], Ref.Data()[i]);
+    }
+}
+
+TEST(Common_BasicMath, SIMDMatrixVectorMultiply)
+{
+    FastRandFloat Rnd{1, -10, 10};
+    for (int iter = 0; iter < 1000; ++iter)
+    {
+        const auto   m = RandomMatrix(Rnd);
+        const float4 v{Rnd(), Rnd(), Rnd(), Rnd()};
+
+        const auto RowVec    = v * m;
+        const auto RowVecRef = MulRef(v, m);
+        const auto ColVec    = m * v;
+        const auto ColVecRef = MulRef(m, v);
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_SIMD_EQ(RowVec[i], RowVecRef[i]);
+            EXPECT_SIMD_EQ(ColVec[i], ColVecRef[i]);
+        }
+    }
+}
+
+TEST(Common_BasicMath, SIMDMatrixInverse)
+{
+    FastRandFloat Rnd{2, -10, 10};
+    for (int iter = 0; iter < 1000; ++iter)
+    {
+        auto m = RandomMatrix(Rnd);
+        // Make the matrix diagonally dominant to keep it well-conditioned
+        for (int i = 0; i < 4; ++i)
+            m.m[i][i] += m.m[i][i] >= 0 ? 40.f : -40.f;
+
+        const auto md = double4x4::MakeMatrix(m.Data());
+
+        const auto det    = m.Determinant();
+        const auto DetRef = md.Determinant();
+        EXPECT_NEAR(det, DetRef, std::abs(DetRef) * 1e-5);
+
+        const auto inv    = m.Inverse();
+        const auto InvRef = md.Inverse();
+        for (int i = 0; i < 16; ++i)
+            EXPECT_NEAR(inv.Data()[i], InvRef.Data()[i], 1e-6);
+
+        const auto identity = m * inv;
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+                EXPECT_NEAR(identity.m[i][j], i == j ? 1.f : 0.f, 1e-5f);
+        }
+    }
+}
+
+TEST(Common_BasicMath, TransformArrays)
+{
+    FastRandFloat Rnd{3, -10, 10};
+
+    auto m = RandomMatrix(Rnd);
+    // Keep w away from zero
+    m._14 *= 0.1f;
+    m._24 *= 0.1f;
+    m._34 *= 0.1f;
+    m._44 = 50.f;
+
+    // Odd count to cover the tail of the vectorized loops
+    constexpr size_t Count = 37;
+
+    std::vector<float4> Vectors(Count);
+    std::vector<float3> Points(Count);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        Vectors[i] = float4{Rnd(), Rnd(), Rnd(), Rnd()};
+        Points[i]  = float3{Rnd(), Rnd(), Rnd()};
+    }
+
+    {
+        std::vector<float4> Out(Count);
+        TransformVectors(Vectors.data(), Out.data(), Count, m);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const auto Ref = MulRef(Vectors[i], m);
+            for (int c = 0; c < 4; ++c)
+                EXPECT_SIMD_EQ(Out[i][c], Ref[c]);
+        }
+
+        // In place
+        auto InPlace = Vectors;
+        TransformVectors(InPlace.data(), InPlace.data(), Count, m);
+        EXPECT_EQ(InPlace, Out);
+    }
+
+    {
+        std::vector<float4> Out(Count);
+        TransformPoints(Points.data(), Out.data(), Count, m);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const auto Ref = MulRef(float4{Points[i], 1}, m);
+            for (int c = 0; c < 4; ++c)
+                EXPECT_SIMD_EQ(Out[i][c], Ref[c]);
+        }
+    }
+
+    {
+        std::vector<float3> Out(Count);
+        TransformPoints(Points.data(), Out.data(), Count, m);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const auto Ref4 = MulRef(float4{Points[i], 1}, m);
+            for (int c = 0; c < 3; ++c)
+                EXPECT_SIMD_EQ(Out[i][c], Ref4[c] / Ref4.w);
+        }
+
+        auto InPlace = Points;
+        TransformPoints(InPlace.data(), InPlace.data(), Count, m);
+        EXPECT_EQ(InPlace, Out);
+    }
+}
+
 } // namespace
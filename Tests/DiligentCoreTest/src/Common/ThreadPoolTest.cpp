@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ThreadingTools;
+
+namespace
+{
+
+TEST(Common_ThreadPool, DefaultThreadCount)
+{
+    ThreadPool Pool;
+    EXPECT_EQ(Pool.GetNumThreads(), ThreadPool::GetDefaultThreadCount());
+}
+
+TEST(Common_ThreadPool, ReturnValues)
+{
+    ThreadPool Pool{4};
+    EXPECT_EQ(Pool.GetNumThreads(), size_t{4});
+
+    std::vector<std::future<int>> Futures;
+    for (int i = 0; i < 256; ++i)
+        Futures.emplace_back(Pool.Enqueue([i]() { return i * i; }));
+
+    for (int i = 0; i < 256; ++i)
+        EXPECT_EQ(Futures[i].get(), i * i);
+}
+
+TEST(Common_ThreadPool, Exception)
+{
+    ThreadPool Pool{2};
+
+    auto Future = Pool.Enqueue([]() -> int { throw std::runtime_error("Test"); });
+    EXPECT_THROW(Future.get(), std::runtime_error);
+
+    // The pool must remain operational after a task throws
+    EXPECT_EQ(Pool.Enqueue([]() { return 7; }).get(), 7);
+}
+
+TEST(Common_ThreadPool, DrainOnDestruction)
+{
+    std::atomic<int> Counter{0};
+    {
+        ThreadPool Pool{3};
+        for (int i = 0; i < 1000; ++i)
+            Pool.Enqueue([&Counter]() { Counter.fetch_add(1); });
+    }
+    EXPECT_EQ(Counter.load(), 1000);
+}
+
+} // namespace
@@ -26,8 +26,14 @@
  */
 
 #include <array>
+#include <vector>
+#include <cstring>
+#include <functional>
+#include <iostream>
 
 #include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
 
 #include "gtest/gtest.h"
 
@@ -649,4 +655,102 @@ TEST(GraphicsAccessories_GraphicsAccessories, GetShaderTypeFromPipelineIndex)
     TestPipelineType(PIPELINE_TYPE_MESH);
 }
 
+void TestCopyTextureSubresource(Uint32 RowSize, Uint32 NumRows, Uint32 NumSlices, Uint32 SrcStride, Uint32 DstStride, ThreadingTools::ThreadPool* pThreadPool)
+{
+    const Uint32 SrcDepthStride = SrcStride * NumRows;
+    const Uint32 DstDepthStride = DstStride * NumRows;
+
+    std::vector<Uint8> SrcData(size_t{SrcDepthStride} * NumSlices);
+    for (size_t i = 0; i < SrcData.size(); ++i)
+        SrcData[i] = static_cast<Uint8>(i * 7 + i / 251);
+
+    std::vector<Uint8> RefData(size_t{DstDepthStride} * NumSlices + 1, 0xCD);
+    for (Uint32 z = 0; z < NumSlices; ++z)
+    {
+        for (Uint32 y = 0; y < NumRows; ++y)
+            memcpy(&RefData[z * DstDepthStride + y * DstStride], &SrcData[z * SrcDepthStride + y * SrcStride], RowSize);
+    }
+
+    for (auto Flags : {COPY_TEXTURE_SUBRESOURCE_FLAG_NONE, COPY_TEXTURE_SUBRESOURCE_FLAG_WRITE_COMBINED})
+    {
+        // Offset the destination by one byte to test unaligned non-temporal stores
+        std::vector<Uint8> DstData(RefData.size() + 1, 0xCD);
+        CopyTextureSubresource(TextureSubResData{SrcData.data(), SrcStride, SrcDepthStride}, NumRows, NumSlices, RowSize,
+                               DstData.data() + 1, DstStride, DstDepthStride, Flags, pThreadPool);
+        EXPECT_EQ(DstData[0], 0xCD);
+        EXPECT_EQ(memcmp(DstData.data() + 1, RefData.data(), RefData.size()), 0)
+            << "RowSize=" << RowSize << " NumRows=" << NumRows << " NumSlices=" << NumSlices
+            << " SrcStride=" << SrcStride << " DstStride=" << DstStride << " Flags=" << Flags;
+    }
+}
+
+TEST(GraphicsAccessories_GraphicsAccessories, CopyTextureSubresource)
+{
+    // Contiguous rows and slices
+    TestCopyTextureSubresource(256, 16, 1, 256, 256, nullptr);
+    TestCopyTextureSubresource(256, 16, 4, 256, 256, nullptr);
+    // Strided source or destination
+    TestCopyTextureSubresource(100, 33, 1, 128, 100, nullptr);
+    TestCopyTextureSubresource(100, 33, 3, 100, 256, nullptr);
+    TestCopyTextureSubresource(1000, 7, 2, 1024, 1027, nullptr);
+    // Small rows
+    TestCopyTextureSubresource(3, 5, 2, 4, 3, nullptr);
+
+    ThreadingTools::ThreadPool ThreadPool{3};
+    // Large contiguous and strided copies that are split between threads
+    TestCopyTextureSubresource(4096, 4096, 1, 4096, 4096, &ThreadPool);
+    TestCopyTextureSubresource(4000, 1024, 3, 4096, 4000, &ThreadPool);
+    TestCopyTextureSubresource(4000, 2048, 1, 4096, 4352, &ThreadPool);
+    // Too small to be split
+    TestCopyTextureSubresource(1024, 1024, 1, 1024, 1024, &ThreadPool);
+}
+
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. GraphicsAccessories_GraphicsAccessories.CopyTextureSubresource verifies the copies.
+TEST(GraphicsAccessories_GraphicsAccessoriesBenchmark, DISABLED_CopyTextureSubresource)
+{
+    const Uint32 RowSize   = 4096 * 4;
+    const Uint32 NumRows   = 4096;
+    const Uint32 SrcStride = RowSize;
+    const Uint32 DstStride = RowSize + 256;
+
+    std::vector<Uint8> SrcData(size_t{SrcStride} * NumRows, 1);
+    std::vector<Uint8> DstData(size_t{DstStride} * NumRows, 0);
+
+    const auto CopySize = static_cast<double>(RowSize) * NumRows;
+
+    ThreadingTools::ThreadPool ThreadPool{3};
+
+    const auto Measure = [&](const char* Name, const std::function<void(Uint32)>& Copy) {
+        // Warm up the destination pages
+        Copy(DstStride);
+        for (Uint32 DstRowStride : {RowSize, DstStride})
+        {
+            Timer     T;
+            const int NumIterations = 8;
+            for (int i = 0; i < NumIterations; ++i)
+                Copy(DstRowStride);
+            const auto Time = T.GetElapsedTime();
+            std::cout << "[          ] " << Name << (DstRowStride == RowSize ? ", contiguous rows: " : ", strided rows:    ")
+                      << CopySize * NumIterations / Time / (1 << 20) << " MB/s" << std::endl;
+        }
+    };
+
+    Measure("Row-by-row memcpy", [&](Uint32 DstRowStride) {
+        for (Uint32 y = 0; y < NumRows; ++y)
+            memcpy(&DstData[size_t{y} * DstRowStride], &SrcData[size_t{y} * SrcStride], RowSize);
+    });
+    Measure("CopyTextureSubresource", [&](Uint32 DstRowStride) {
+        CopyTextureSubresource(TextureSubResData{SrcData.data(), SrcStride}, NumRows, 1, RowSize, DstData.data(), DstRowStride, 0);
+    });
+    Measure("CopyTextureSubresource, write-combined", [&](Uint32 DstRowStride) {
+        CopyTextureSubresource(TextureSubResData{SrcData.data(), SrcStride}, NumRows, 1, RowSize, DstData.data(), DstRowStride, 0,
+                               COPY_TEXTURE_SUBRESOURCE_FLAG_WRITE_COMBINED);
+    });
+    Measure("CopyTextureSubresource, write-combined, 4 threads", [&](Uint32 DstRowStride) {
+        CopyTextureSubresource(TextureSubResData{SrcData.data(), SrcStride}, NumRows, 1, RowSize, DstData.data(), DstRowStride, 0,
+                               COPY_TEXTURE_SUBRESOURCE_FLAG_WRITE_COMBINED, &ThreadPool);
+    });
+}
+
 } // namespace
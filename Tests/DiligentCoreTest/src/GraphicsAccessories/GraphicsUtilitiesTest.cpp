@@ -26,11 +26,16 @@
  */
 
 #include "GraphicsUtilities.h"
+#include "GraphicsAccessories.hpp"
 #include "FastRand.hpp"
 #include "ColorConversion.h"
+#include "Timer.hpp"
+#include "ThreadPool.hpp"
 
 #include <vector>
 #include <array>
+#include <algorithm>
+#include <iostream>
 
 #include "gtest/gtest.h"
 
@@ -501,4 +506,204 @@ TEST(GraphicsTools_CalculateMipLevel, sRGB)
     EXPECT_TRUE(CoarseData == RefCoarseData);
 }
 
+TEST(GraphicsTools_CalculateMipLevel, RG16F)
+{
+    // Red: 1.0, 2.0, 3.0, 4.0; green: -1.0, 0.5, 65504.0, 65504.0
+    const Uint16 FineData[] = //
+        {
+            0x3C00, 0xBC00, 0x4000, 0x3800, //
+            0x4200, 0x7BFF, 0x4400, 0x7BFF  //
+        };
+
+    Uint16 CoarseData[4] = {};
+    ComputeMipLevel(2, 2, TEX_FORMAT_RG16_FLOAT, FineData, 8, CoarseData, 4);
+    // 2.5 and 32751.625 rounded to half precision
+    EXPECT_EQ(CoarseData[0], Uint16{0x4100});
+    EXPECT_EQ(CoarseData[1], Uint16{0x77FF});
+}
+
+
+struct MipChain
+{
+    MipChain(Uint32 Width, Uint32 Height, Uint32 TexelSize, Uint32 NumLevels)
+    {
+        for (Uint32 level = 0; level < NumLevels; ++level)
+        {
+            Width  = std::max(Width / 2, 1u);
+            Height = std::max(Height / 2, 1u);
+            Strides.push_back(Width * TexelSize);
+            Levels.emplace_back(size_t{Strides.back()} * Height);
+            Pointers.push_back(Levels.back().data());
+        }
+    }
+
+    std::vector<std::vector<Uint8>> Levels;
+    std::vector<void*>              Pointers;
+    std::vector<Uint32>             Strides;
+};
+
+// Computes the coarse levels with ComputeMipLevel
+void ComputeReferenceMipChain(const ComputeMipChainAttribs& Attribs, MipChain& Chain)
+{
+    auto        Width  = Attribs.Width;
+    auto        Height = Attribs.Height;
+    const void* pFine  = Attribs.pFineLevelData;
+    Uint32      Stride = Attribs.FineLevelStrideInBytes;
+    for (Uint32 level = 0; level < Attribs.NumCoarseLevels; ++level)
+    {
+        ComputeMipLevel(Width, Height, Attribs.Format, pFine, Stride, Chain.Pointers[level], Chain.Strides[level]);
+        Width  = std::max(Width / 2, 1u);
+        Height = std::max(Height / 2, 1u);
+        pFine  = Chain.Pointers[level];
+        Stride = Chain.Strides[level];
+    }
+}
+
+void TestComputeMipChain(TEXTURE_FORMAT Fmt, Uint32 Width, Uint32 Height, ThreadingTools::ThreadPool* pThreadPool)
+{
+    const auto&  FmtAttribs = GetTextureFormatAttribs(Fmt);
+    const Uint32 TexelSize  = Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+    const Uint32 NumLevels  = ComputeMipLevelsCount(Width, Height);
+
+    std::vector<Uint8> FineData(size_t{Width} * Height * TexelSize);
+    FastRandInt rnd(0, 0, 255);
+    for (auto& c : FineData)
+        c = static_cast<Uint8>(rnd());
+    if (FmtAttribs.ComponentType == COMPONENT_TYPE_FLOAT)
+    {
+        // Keep random floats finite by limiting the exponent
+        for (size_t i = FmtAttribs.ComponentSize - 1; i < FineData.size(); i += FmtAttribs.ComponentSize)
+            FineData[i] = static_cast<Uint8>((FineData[i] & 0x80u) | (FmtAttribs.ComponentSize == 4 ? 0x40u : 0x10u + (FineData[i] & 0x3Fu) % 0x30u));
+    }
+
+    ComputeMipChainAttribs Attribs;
+    Attribs.Format                 = Fmt;
+    Attribs.Width                  = Width;
+    Attribs.Height                 = Height;
+    Attribs.pFineLevelData         = FineData.data();
+    Attribs.FineLevelStrideInBytes = Width * TexelSize;
+    Attribs.NumCoarseLevels        = NumLevels - 1;
+
+    MipChain RefChain{Width, Height, TexelSize, Attribs.NumCoarseLevels};
+    ComputeReferenceMipChain(Attribs, RefChain);
+
+    MipChain Chain{Width, Height, TexelSize, Attribs.NumCoarseLevels};
+    Attribs.ppCoarseLevelData   = Chain.Pointers.data();
+    Attribs.pCoarseLevelStrides = Chain.Strides.data();
+    ComputeMipChain(Attribs, pThreadPool);
+
+    for (Uint32 level = 0; level < Attribs.NumCoarseLevels; ++level)
+    {
+        const auto& Ref  = RefChain.Levels[level];
+        const auto& Data = Chain.Levels[level];
+        if (FmtAttribs.ComponentType == COMPONENT_TYPE_UNORM_SRGB)
+        {
+            // Vectorized sRGB math may differ by one LSB when the compiler fuses multiply-adds differently
+            for (size_t i = 0; i < Ref.size(); ++i)
+                ASSERT_LE(std::abs(int{Ref[i]} - int{Data[i]}), 1) << GetTextureFormatAttribs(Fmt).Name << ' ' << Width << 'x' << Height << " level " << level + 1;
+        }
+        else
+        {
+            EXPECT_TRUE(Data == Ref) << GetTextureFormatAttribs(Fmt).Name << ' ' << Width << 'x' << Height << " level " << level + 1;
+        }
+    }
+}
+
+TEST(GraphicsTools_ComputeMipChain, MatchesComputeMipLevel)
+{
+    const TEXTURE_FORMAT Formats[] = {
+        TEX_FORMAT_RGBA8_UNORM,
+        TEX_FORMAT_RGBA8_UNORM_SRGB,
+        TEX_FORMAT_R8_UNORM,
+        TEX_FORMAT_RGBA16_FLOAT,
+        TEX_FORMAT_R32_FLOAT,
+        TEX_FORMAT_RG32_FLOAT,
+        TEX_FORMAT_RGBA32_FLOAT,
+        TEX_FORMAT_RGBA16_UINT,
+    };
+    const std::pair<Uint32, Uint32> Sizes[] = {
+        {1, 1},
+        {1, 37},
+        {45, 1},
+        {64, 64},
+        {67, 33},
+        {255, 129},
+    };
+    for (auto Fmt : Formats)
+    {
+        for (const auto& Size : Sizes)
+            TestComputeMipChain(Fmt, Size.first, Size.second, nullptr);
+    }
+}
+
+TEST(GraphicsTools_ComputeMipChain, Multithreaded)
+{
+    ThreadingTools::ThreadPool Pool3{3};
+    ThreadingTools::ThreadPool Pool2{2};
+    ThreadingTools::ThreadPool DefaultPool;
+    for (auto Fmt : {TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM_SRGB, TEX_FORMAT_R32_FLOAT})
+    {
+        TestComputeMipChain(Fmt, 1024, 1024, &Pool3);
+        TestComputeMipChain(Fmt, 1023, 1029, &Pool2);
+        TestComputeMipChain(Fmt, 4000, 513, &DefaultPool);
+    }
+}
+
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it.
+TEST(GraphicsTools_ComputeMipChainBenchmark, DISABLED_Texture4K)
+{
+    const Uint32 Width  = 4096;
+    const Uint32 Height = 4096;
+
+    // The pool is shared by all iterations, as an application would do
+    ThreadingTools::ThreadPool Pool{std::max(ThreadingTools::ThreadPool::GetDefaultThreadCount(), size_t{2}) - 1};
+
+    for (auto Fmt : {TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM_SRGB, TEX_FORMAT_RGBA16_FLOAT, TEX_FORMAT_R32_FLOAT})
+    {
+        const auto&  FmtAttribs = GetTextureFormatAttribs(Fmt);
+        const Uint32 TexelSize  = Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+
+        std::vector<Uint8> FineData(size_t{Width} * Height * TexelSize);
+        FastRandInt        rnd(0, 0, 255);
+        for (auto& c : FineData)
+            c = static_cast<Uint8>(rnd());
+        if (FmtAttribs.ComponentType == COMPONENT_TYPE_FLOAT)
+        {
+            // Avoid NaNs and denormals
+            for (size_t i = FmtAttribs.ComponentSize - 1; i < FineData.size(); i += FmtAttribs.ComponentSize)
+                FineData[i] = 0x3C;
+        }
+
+        ComputeMipChainAttribs Attribs;
+        Attribs.Format                 = Fmt;
+        Attribs.Width                  = Width;
+        Attribs.Height                 = Height;
+        Attribs.pFineLevelData         = FineData.data();
+        Attribs.FineLevelStrideInBytes = Width * TexelSize;
+        Attribs.NumCoarseLevels        = ComputeMipLevelsCount(Width, Height) - 1;
+
+        MipChain Chain{Width, Height, TexelSize, Attribs.NumCoarseLevels};
+        Attribs.ppCoarseLevelData   = Chain.Pointers.data();
+        Attribs.pCoarseLevelStrides = Chain.Strides.data();
+
+        Timer  T;
+        double StartTime = T.GetElapsedTime();
+        ComputeReferenceMipChain(Attribs, Chain);
+        const double MipLevelTime = T.GetElapsedTime() - StartTime;
+
+        StartTime = T.GetElapsedTime();
+        ComputeMipChain(Attribs);
+        const double ChainTime = T.GetElapsedTime() - StartTime;
+
+        StartTime = T.GetElapsedTime();
+        ComputeMipChain(Attribs, &Pool);
+        const double ChainMTTime = T.GetElapsedTime() - StartTime;
+
+        std::cout << "[          ] " << FmtAttribs.Name << ": ComputeMipLevel " << MipLevelTime * 1000.0
+                  << " ms, ComputeMipChain " << ChainTime * 1000.0
+                  << " ms, ComputeMipChain (all threads) " << ChainMTTime * 1000.0 << " ms" << std::endl;
+    }
+}
+
 } // namespace
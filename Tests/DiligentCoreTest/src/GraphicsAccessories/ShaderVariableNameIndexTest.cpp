@@ -0,0 +1,206 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ShaderVariableNameIndex.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class NameIndexTestHelper
+{
+public:
+    explicit NameIndexTestHelper(std::vector<std::string> _Names) :
+        Names{std::move(_Names)},
+        Memory((ShaderVariableNameIndex::GetRequiredMemorySize(static_cast<Uint32>(Names.size())) + sizeof(size_t) - 1) / sizeof(size_t))
+    {
+        Index.Initialize(Memory.data(), static_cast<Uint32>(Names.size()), GetNameFunc());
+    }
+
+    Uint32 Find(const char* Name) const
+    {
+        return Index.Find(Name, GetNameFunc());
+    }
+
+    template <typename FilterType>
+    Uint32 Find(const char* Name, FilterType Filter) const
+    {
+        return Index.Find(Name, GetNameFunc(), Filter);
+    }
+
+    Uint32 FindLinear(const char* Name) const
+    {
+        for (Uint32 v = 0; v < Names.size(); ++v)
+        {
+            if (strcmp(Names[v].c_str(), Name) == 0)
+                return v;
+        }
+        return ShaderVariableNameIndex::InvalidIndex;
+    }
+
+private:
+    struct NameGetter
+    {
+        const std::vector<std::string>& Names;
+
+        const char* operator()(Uint32 Idx) const
+        {
+            return Names[Idx].c_str();
+        }
+    };
+
+    NameGetter GetNameFunc() const
+    {
+        return NameGetter{Names};
+    }
+
+    const std::vector<std::string> Names;
+    std::vector<size_t>            Memory;
+    ShaderVariableNameIndex        Index;
+};
+
+std::vector<std::string> MakeVariableNames(size_t NumVars)
+{
+    std::vector<std::string> Names(NumVars);
+    for (size_t v = 0; v < NumVars; ++v)
+    {
+        static const char* Prefixes[] = {"g_Texture", "g_Buffer", "cbCamera", "g_Sampler"};
+        Names[v]                      = Prefixes[v % 4] + std::to_string(v);
+    }
+    return Names;
+}
+
+TEST(GraphicsAccessories_ShaderVariableNameIndex, Empty)
+{
+    // Need to define local variable to avoid vexing linker errors
+    const auto InvalidIndex = ShaderVariableNameIndex::InvalidIndex;
+
+    NameIndexTestHelper Index{{}};
+    EXPECT_EQ(Index.Find("g_Texture"), InvalidIndex);
+}
+
+TEST(GraphicsAccessories_ShaderVariableNameIndex, Find)
+{
+    const auto InvalidIndex = ShaderVariableNameIndex::InvalidIndex;
+
+    const auto          Names = MakeVariableNames(100);
+    NameIndexTestHelper Index{Names};
+    for (Uint32 v = 0; v < Names.size(); ++v)
+        EXPECT_EQ(Index.Find(Names[v].c_str()), v) << Names[v];
+
+    EXPECT_EQ(Index.Find(""), InvalidIndex);
+    EXPECT_EQ(Index.Find("g_Texture"), InvalidIndex);
+    EXPECT_EQ(Index.Find("g_Texture00"), InvalidIndex);
+    EXPECT_EQ(Index.Find("g_Texture0_"), InvalidIndex);
+}
+
+TEST(GraphicsAccessories_ShaderVariableNameIndex, Duplicates)
+{
+    const auto InvalidIndex = ShaderVariableNameIndex::InvalidIndex;
+
+    // Small sets of variables are searched linearly, larger ones use the index
+    for (size_t NumExtraVars : {0, 16})
+    {
+        // The same name may be used by different shader stages. The first variable
+        // must be returned, same as with the linear search.
+        std::vector<std::string> Names{"g_Tex", "g_Buff", "g_Tex", "g_Sam", "g_Buff", "g_Tex"};
+        for (size_t v = 0; v < NumExtraVars; ++v)
+            Names.emplace_back("g_Extra" + std::to_string(v));
+
+        NameIndexTestHelper Index{Names};
+        EXPECT_EQ(Index.Find("g_Tex"), Index.FindLinear("g_Tex"));
+        EXPECT_EQ(Index.Find("g_Buff"), Index.FindLinear("g_Buff"));
+        EXPECT_EQ(Index.Find("g_Sam"), 3u);
+
+        EXPECT_EQ(Index.Find("g_Tex", [](Uint32 Idx) { return Idx > 0; }), 2u);
+        EXPECT_EQ(Index.Find("g_Tex", [](Uint32 Idx) { return Idx > 2; }), 5u);
+        EXPECT_EQ(Index.Find("g_Buff", [](Uint32 Idx) { return Idx == 4; }), 4u);
+        EXPECT_EQ(Index.Find("g_Sam", [](Uint32 Idx) { return Idx != 3; }), InvalidIndex);
+        EXPECT_EQ(Index.Find("g_Extra"), InvalidIndex);
+    }
+}
+
+TEST(GraphicsAccessories_ShaderVariableNameIndex, SmallCount)
+{
+    const auto InvalidIndex = ShaderVariableNameIndex::InvalidIndex;
+    const auto MaxLinear    = ShaderVariableNameIndex::MaxLinearSearchVariables;
+
+    // No memory is required when the variables are searched linearly
+    EXPECT_EQ(ShaderVariableNameIndex::GetRequiredMemorySize(MaxLinear), 0u);
+    EXPECT_GT(ShaderVariableNameIndex::GetRequiredMemorySize(MaxLinear + 1), 0u);
+
+    for (Uint32 NumVars = 1; NumVars <= MaxLinear + 1; ++NumVars)
+    {
+        const auto          Names = MakeVariableNames(NumVars);
+        NameIndexTestHelper Index{Names};
+        for (Uint32 v = 0; v < NumVars; ++v)
+            EXPECT_EQ(Index.Find(Names[v].c_str()), v) << Names[v];
+        EXPECT_EQ(Index.Find("g_Texture"), InvalidIndex);
+    }
+}
+
+// Compares the cost of looking up every variable by name with the linear search
+// and with the name index for different numbers of variables.
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it. GraphicsAccessories_ShaderVariableNameIndex tests verify the lookups.
+TEST(GraphicsAccessories_ShaderVariableNameIndexBenchmark, DISABLED_Lookup)
+{
+    for (size_t NumVars : {4, 16, 64, 256})
+    {
+        const auto          Names = MakeVariableNames(NumVars);
+        NameIndexTestHelper Index{Names};
+
+        const size_t NumRepeats = 1 << 20;
+
+        Uint32 Checksum[2] = {};
+
+        Timer T;
+        for (size_t r = 0; r < NumRepeats; ++r)
+            Checksum[0] += Index.FindLinear(Names[r % NumVars].c_str());
+        const auto LinearTime = T.GetElapsedTime();
+
+        T.Restart();
+        for (size_t r = 0; r < NumRepeats; ++r)
+            Checksum[1] += Index.Find(Names[r % NumVars].c_str());
+        const auto IndexTime = T.GetElapsedTime();
+
+        std::cout << "[          ] " << NumVars << " variables: linear search: " << LinearTime * 1e9 / NumRepeats
+                  << " ns, name index: " << IndexTime * 1e9 / NumRepeats << " ns per lookup" << std::endl;
+        EXPECT_EQ(Checksum[0], Checksum[1]);
+    }
+}
+
+} // namespace
@@ -0,0 +1,348 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include "TLSFAllocationsManager.hpp"
+#include "VariableSizeAllocationsManager.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+template <typename AllocationsManagerType>
+class GraphicsAccessories_AllocationsManager : public ::testing::Test
+{};
+
+using AllocationsManagerTypes = ::testing::Types<VariableSizeAllocationsManager, TLSFAllocationsManager>;
+TYPED_TEST_SUITE(GraphicsAccessories_AllocationsManager, AllocationsManagerTypes);
+
+TYPED_TEST(GraphicsAccessories_AllocationsManager, AllocateFree)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    using OffsetType = typename TypeParam::OffsetType;
+
+    {
+        TypeParam Mgr(128, Allocator);
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+        auto a1 = Mgr.Allocate(17, 4);
+        EXPECT_EQ(a1.UnalignedOffset, OffsetType{0});
+        EXPECT_EQ(a1.Size, OffsetType{20});
+
+        auto a2 = Mgr.Allocate(17, 8);
+        EXPECT_EQ(a2.UnalignedOffset, OffsetType{20});
+        EXPECT_EQ(a2.Size, OffsetType{28});
+
+        auto a3 = Mgr.Allocate(8, 1);
+        EXPECT_EQ(a3.UnalignedOffset, OffsetType{48});
+        EXPECT_EQ(a3.Size, OffsetType{8});
+
+        auto a4 = Mgr.Allocate(11, 8);
+        EXPECT_EQ(a4.UnalignedOffset, OffsetType{56});
+        EXPECT_EQ(a4.Size, OffsetType{16});
+
+        auto a5 = Mgr.Allocate(64, 1);
+        EXPECT_FALSE(a5.IsValid());
+
+        a5 = Mgr.Allocate(16, 1);
+        EXPECT_EQ(a5.UnalignedOffset, OffsetType{72});
+
+        auto a6 = Mgr.Allocate(8, 1);
+        EXPECT_EQ(a6.UnalignedOffset, OffsetType{88});
+
+        auto a7 = Mgr.Allocate(16, 1);
+        EXPECT_EQ(a7.UnalignedOffset, OffsetType{96});
+
+        auto a8 = Mgr.Allocate(8, 1);
+        EXPECT_EQ(a8.UnalignedOffset, OffsetType{112});
+
+        auto a9 = Mgr.Allocate(8, 1);
+        EXPECT_EQ(a9.UnalignedOffset, OffsetType{120});
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{0});
+        EXPECT_TRUE(Mgr.IsFull());
+
+        Mgr.Free(std::move(a6));
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+        Mgr.Free(a8.UnalignedOffset, a8.Size);
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{2});
+
+        Mgr.Free(std::move(a9));
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{2});
+
+        auto a10 = Mgr.Allocate(16, 1);
+        EXPECT_EQ(a10.UnalignedOffset, OffsetType{112});
+        EXPECT_EQ(a10.Size, OffsetType{16});
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+        Mgr.Free(a10.UnalignedOffset, a10.Size);
+        Mgr.Free(std::move(a7));
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+        Mgr.Free(std::move(a4));
+        Mgr.Free(a2.UnalignedOffset, a2.Size);
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{3});
+
+        Mgr.Free(std::move(a1));
+        Mgr.Free(std::move(a3));
+        Mgr.Free(std::move(a5));
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+        EXPECT_TRUE(Mgr.IsEmpty());
+    }
+
+    {
+        TypeParam Mgr(128, Allocator);
+
+        auto a1 = Mgr.Allocate(64, 1);
+        EXPECT_EQ(a1.UnalignedOffset, OffsetType{0});
+
+        auto a2 = Mgr.Allocate(128, 1);
+        EXPECT_FALSE(a2.IsValid());
+
+        Mgr.Extend(128);
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+        a2 = Mgr.Allocate(128, 1);
+        EXPECT_EQ(a2.UnalignedOffset, OffsetType{64});
+        EXPECT_EQ(a2.Size, OffsetType{128});
+
+        auto a3 = Mgr.Allocate(64, 1);
+        EXPECT_TRUE(Mgr.IsFull());
+
+        Mgr.Free(std::move(a1));
+        Mgr.Extend(1024);
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{2});
+
+        auto a4 = Mgr.Allocate(512, 1);
+        EXPECT_EQ(a4.UnalignedOffset, OffsetType{256});
+
+        Mgr.Free(std::move(a2));
+        Mgr.Free(std::move(a4));
+        Mgr.Free(std::move(a3));
+        EXPECT_TRUE(Mgr.IsEmpty());
+    }
+}
+
+TYPED_TEST(GraphicsAccessories_AllocationsManager, FreeOrder)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    const size_t NumAllocs = 6;
+    size_t       ReleaseOrder[NumAllocs];
+    for (size_t a = 0; a < NumAllocs; ++a)
+        ReleaseOrder[a] = a;
+    do
+    {
+        TypeParam Mgr(NumAllocs * 4, Allocator);
+
+        typename TypeParam::Allocation allocs[NumAllocs];
+        for (size_t a = 0; a < NumAllocs; ++a)
+        {
+            allocs[a] = Mgr.Allocate(4, 1);
+            EXPECT_EQ(allocs[a].UnalignedOffset, a * 4);
+        }
+        for (size_t a = 0; a < NumAllocs; ++a)
+            Mgr.Free(std::move(allocs[ReleaseOrder[a]]));
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+        EXPECT_TRUE(Mgr.IsEmpty());
+    } while (std::next_permutation(std::begin(ReleaseOrder), std::end(ReleaseOrder)));
+}
+
+struct TraceStats
+{
+    size_t NumFailed        = 0;
+    size_t NumFreeBlocks    = 0;
+    size_t LargestAllocSize = 0;
+    double TimeMs           = 0;
+};
+
+// Runs a random trace of allocations and releases and checks that live allocations never overlap
+template <typename AllocationsManagerType>
+TraceStats RunRandomTrace(size_t MaxSize, size_t NumOperations, size_t MaxLiveAllocs, bool Validate)
+{
+    using Allocation = typename AllocationsManagerType::Allocation;
+
+    std::mt19937 gen{42}; // Use the same seed for both managers
+
+    std::uniform_int_distribution<int>    SizeLog2Distr{2, 14};
+    std::uniform_int_distribution<int>    AlignLog2Distr{0, 8};
+    std::uniform_real_distribution<float> FractDistr{1.f, 2.f};
+
+    AllocationsManagerType Mgr(MaxSize, DefaultRawMemoryAllocator::GetAllocator());
+    std::vector<Allocation> Live;
+    Live.reserve(MaxLiveAllocs);
+
+    TraceStats Stats;
+
+    const auto StartTime = std::chrono::high_resolution_clock::now();
+    for (size_t op = 0; op < NumOperations; ++op)
+    {
+        // Keep the number of live allocations around MaxLiveAllocs / 2
+        const bool DoAllocate = Live.empty() || (Live.size() < MaxLiveAllocs && (gen() % MaxLiveAllocs) >= Live.size());
+        if (DoAllocate)
+        {
+            const auto Size      = static_cast<size_t>(static_cast<float>(size_t{1} << SizeLog2Distr(gen)) * FractDistr(gen));
+            const auto Alignment = size_t{1} << AlignLog2Distr(gen);
+
+            auto NewAlloc = Mgr.Allocate(Size, Alignment);
+            if (NewAlloc.IsValid())
+                Live.emplace_back(std::move(NewAlloc));
+            else
+                ++Stats.NumFailed;
+        }
+        else
+        {
+            const auto Idx = gen() % Live.size();
+            std::swap(Live[Idx], Live.back());
+            Mgr.Free(std::move(Live.back()));
+            Live.pop_back();
+        }
+
+        if (Validate && (op % 1024) == 0)
+        {
+            auto Sorted = Live;
+            std::sort(Sorted.begin(), Sorted.end(), [](const Allocation& a1, const Allocation& a2) { return a1.UnalignedOffset < a2.UnalignedOffset; });
+            size_t UsedSize = 0;
+            for (size_t i = 0; i < Sorted.size(); ++i)
+            {
+                UsedSize += Sorted[i].Size;
+                if (i > 0)
+                    EXPECT_GE(Sorted[i].UnalignedOffset, Sorted[i - 1].UnalignedOffset + Sorted[i - 1].Size) << "Overlapping allocations";
+            }
+            EXPECT_EQ(UsedSize, Mgr.GetUsedSize());
+        }
+    }
+    const auto EndTime = std::chrono::high_resolution_clock::now();
+    Stats.TimeMs       = std::chrono::duration<double, std::milli>(EndTime - StartTime).count();
+
+    Stats.NumFreeBlocks = Mgr.GetNumFreeBlocks();
+
+    // Find the largest allocation that can be made without alignment
+    size_t MinSize = 0, MaxAllocSize = Mgr.GetFreeSize();
+    while (MinSize < MaxAllocSize)
+    {
+        const auto Size = (MinSize + MaxAllocSize + 1) / 2;
+
+        auto TestAlloc = Mgr.Allocate(Size, 1);
+        if (TestAlloc.IsValid())
+        {
+            Mgr.Free(std::move(TestAlloc));
+            MinSize = Size;
+        }
+        else
+        {
+            MaxAllocSize = Size - 1;
+        }
+    }
+    Stats.LargestAllocSize = MinSize;
+
+    for (auto& LiveAlloc : Live)
+        Mgr.Free(std::move(LiveAlloc));
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+    return Stats;
+}
+
+TYPED_TEST(GraphicsAccessories_AllocationsManager, RandomTrace)
+{
+    RunRandomTrace<TypeParam>(size_t{4} << 20, 20000, 512, true);
+}
+
+TYPED_TEST(GraphicsAccessories_AllocationsManager, Move)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    TypeParam Mgr1(128, Allocator);
+
+    auto a1 = Mgr1.Allocate(16, 1);
+    EXPECT_EQ(a1.UnalignedOffset, 0u);
+
+    TypeParam Mgr2{std::move(Mgr1)};
+    EXPECT_EQ(Mgr1.GetMaxSize(), 0u);
+    EXPECT_EQ(Mgr1.GetFreeSize(), 0u);
+    EXPECT_EQ(Mgr1.GetNumFreeBlocks(), size_t{0});
+    EXPECT_EQ(Mgr2.GetMaxSize(), 128u);
+    EXPECT_EQ(Mgr2.GetFreeSize(), 112u);
+
+    TypeParam Mgr3(64, Allocator);
+    Mgr3 = std::move(Mgr2);
+    EXPECT_EQ(Mgr2.GetMaxSize(), 0u);
+    EXPECT_EQ(Mgr2.GetFreeSize(), 0u);
+    EXPECT_EQ(Mgr2.GetNumFreeBlocks(), size_t{0});
+    EXPECT_FALSE(Mgr2.Allocate(16, 1).IsValid());
+    EXPECT_EQ(Mgr3.GetMaxSize(), 128u);
+    EXPECT_EQ(Mgr3.GetFreeSize(), 112u);
+
+    // The moved-to manager keeps working with the moved allocation
+    auto a2 = Mgr3.Allocate(16, 1);
+    EXPECT_EQ(a2.UnalignedOffset, 16u);
+    Mgr3.Free(std::move(a1));
+    Mgr3.Free(std::move(a2));
+    EXPECT_TRUE(Mgr3.IsEmpty());
+    EXPECT_EQ(Mgr3.GetNumFreeBlocks(), size_t{1});
+}
+
+// Replays the same random trace on both managers and compares time and fragmentation.
+// This is a timing test that is not run by default, use --gtest_also_run_disabled_tests
+// to run it.
+TEST(GraphicsAccessories_TLSFAllocationsManager, DISABLED_Benchmark)
+{
+#ifdef DILIGENT_DEBUG
+    // Both managers verify all free blocks after every operation in debug build
+    const size_t NumOperations = 20000;
+    const size_t MaxLiveAllocs = 1024;
+#else
+    const size_t NumOperations = 2000000;
+    const size_t MaxLiveAllocs = 16384;
+#endif
+    const size_t MaxSize = size_t{64} << 20;
+
+    const auto Results = {
+        std::make_pair("map/multimap", RunRandomTrace<VariableSizeAllocationsManager>(MaxSize, NumOperations, MaxLiveAllocs, false)),
+        std::make_pair("TLSF        ", RunRandomTrace<TLSFAllocationsManager>(MaxSize, NumOperations, MaxLiveAllocs, false)),
+    };
+    for (const auto& Res : Results)
+    {
+        std::cout << "[          ] " << Res.first << ": " << NumOperations << " operations in " << Res.second.TimeMs << " ms, "
+                  << Res.second.NumFailed << " failed allocations, " << Res.second.NumFreeBlocks << " free blocks, largest allocation "
+                  << Res.second.LargestAllocSize << " bytes" << std::endl;
+    }
+}
+
+} // namespace
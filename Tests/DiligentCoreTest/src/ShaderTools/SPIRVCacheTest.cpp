@@ -0,0 +1,322 @@
+/*
+ *  Copyright 2019-2021 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *  
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *  
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *  
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence), 
+ *  contract, or otherwise, unless required by applicable law (such as deliberate 
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental, 
+ *  or consequential damages of any character arising as a result of this License or 
+ *  out of the use or inability to use the software (including but not limited to damages 
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and 
+ *  all other commercial damages or losses), even if such Contributor has been advised 
+ *  of the possibility of such damages.
+ */
+
+
+#include "SPIRVCache.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+
+#if !DILIGENT_NO_GLSLANG
+#    include "GLSLangUtils.hpp"
+#endif
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+const std::string& GetCacheDirectory()
+{
+    static const std::string CacheDirectory = FileSystem::GetTemporaryDirectory() + FileSystem::GetSlashSymbol() + "DiligentSPIRVCacheTest";
+    return CacheDirectory;
+}
+
+void DeleteCacheDirectory()
+{
+    if (FileSystem::PathExists(GetCacheDirectory().c_str()))
+        FileSystem::DeleteDirectory(GetCacheDirectory().c_str());
+}
+
+SPIRVCache::Key MakeKey(Uint32 i)
+{
+    SPIRVCache::KeyBuilder Builder;
+    Builder.Add("SPIRVCacheTest").Add(i);
+    return Builder.Get();
+}
+
+std::vector<Uint32> MakeSPIRV(Uint32 i)
+{
+    std::vector<Uint32> SPIRV(16 + i % 64);
+    for (size_t w = 0; w < SPIRV.size(); ++w)
+        SPIRV[w] = i * 1000 + static_cast<Uint32>(w);
+    return SPIRV;
+}
+
+class ShaderTools_SPIRVCache : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        DeleteCacheDirectory();
+    }
+
+    void TearDown() override
+    {
+        DeleteCacheDirectory();
+    }
+};
+
+TEST_F(ShaderTools_SPIRVCache, KeyBuilder)
+{
+    SPIRVCache::KeyBuilder Builder1, Builder2, Builder3;
+    Builder1.Add("ab").Add("c");
+    Builder2.Add("a").Add("bc");
+    Builder3.Add("ab").Add("c");
+    EXPECT_FALSE(Builder1.Get() == Builder2.Get());
+    EXPECT_TRUE(Builder1.Get() == Builder3.Get());
+
+    // The key must not depend on the process
+    SPIRVCache::KeyBuilder Builder4;
+    Builder4.Add("");
+    EXPECT_EQ(Builder4.Get().Hash[0], 0xaf63bd4c8601b7dfull);
+}
+
+TEST_F(ShaderTools_SPIRVCache, AddFind)
+{
+    SPIRVCache Cache{GetCacheDirectory().c_str()};
+
+    std::vector<Uint32> SPIRV;
+    EXPECT_FALSE(Cache.Find(MakeKey(0), SPIRV));
+
+    for (Uint32 i = 0; i < 16; ++i)
+        Cache.Add(MakeKey(i), MakeSPIRV(i));
+
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        ASSERT_TRUE(Cache.Find(MakeKey(i), SPIRV));
+        EXPECT_EQ(SPIRV, MakeSPIRV(i));
+    }
+    EXPECT_FALSE(Cache.Find(MakeKey(16), SPIRV));
+
+    const auto Stats = Cache.GetStatistics();
+    EXPECT_EQ(Stats.NumHits, 16u);
+    EXPECT_EQ(Stats.NumMisses, 2u);
+    EXPECT_EQ(Stats.NumEntries, 16u);
+}
+
+TEST_F(ShaderTools_SPIRVCache, Persistence)
+{
+    {
+        SPIRVCache Cache{GetCacheDirectory().c_str()};
+        for (Uint32 i = 0; i < 32; ++i)
+            Cache.Add(MakeKey(i), MakeSPIRV(i));
+    }
+
+    {
+        SPIRVCache Cache{GetCacheDirectory().c_str()};
+        EXPECT_EQ(Cache.GetStatistics().NumEntries, 32u);
+        Cache.Add(MakeKey(32), MakeSPIRV(32));
+    }
+
+    SPIRVCache Cache{GetCacheDirectory().c_str()};
+    EXPECT_EQ(Cache.GetStatistics().NumEntries, 33u);
+    for (Uint32 i = 0; i <= 32; ++i)
+    {
+        std::vector<Uint32> SPIRV;
+        ASSERT_TRUE(Cache.Find(MakeKey(i), SPIRV));
+        EXPECT_EQ(SPIRV, MakeSPIRV(i));
+    }
+}
+
+TEST_F(ShaderTools_SPIRVCache, PartialIndexRecord)
+{
+    {
+        SPIRVCache Cache{GetCacheDirectory().c_str()};
+        Cache.Add(MakeKey(0), MakeSPIRV(0));
+    }
+
+    // Simulate the application terminating while writing the index record
+    {
+        const std::string IndexPath = GetCacheDirectory() + FileSystem::GetSlashSymbol() + "SPIRVCache.idx";
+        FileWrapper       IndexFile{IndexPath.c_str(), EFileAccessMode::Append};
+        ASSERT_NE(static_cast<CFile*>(IndexFile), nullptr);
+        const Uint8 Garbage[7] = {};
+        IndexFile->Write(Garbage, sizeof(Garbage));
+    }
+
+    {
+        SPIRVCache Cache{GetCacheDirectory().c_str()};
+        EXPECT_EQ(Cache.GetStatistics().NumEntries, 1u);
+        Cache.Add(MakeKey(1), MakeSPIRV(1));
+    }
+
+    SPIRVCache          Cache{GetCacheDirectory().c_str()};
+    std::vector<Uint32> SPIRV;
+    EXPECT_EQ(Cache.GetStatistics().NumEntries, 2u);
+    EXPECT_TRUE(Cache.Find(MakeKey(1), SPIRV));
+    EXPECT_EQ(SPIRV, MakeSPIRV(1));
+}
+
+// Two cache instances on the same directory behave like two processes sharing the cache
+TEST_F(ShaderTools_SPIRVCache, SharedDirectory)
+{
+    {
+        SPIRVCache Cache0{GetCacheDirectory().c_str()};
+        SPIRVCache Cache1{GetCacheDirectory().c_str()};
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            auto& Cache = (i % 2 == 0) ? Cache0 : Cache1;
+            Cache.Add(MakeKey(i), MakeSPIRV(i));
+        }
+    }
+
+    SPIRVCache Cache{GetCacheDirectory().c_str()};
+    EXPECT_EQ(Cache.GetStatistics().NumEntries, 16u);
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        std::vector<Uint32> SPIRV;
+        ASSERT_TRUE(Cache.Find(MakeKey(i), SPIRV));
+        EXPECT_EQ(SPIRV, MakeSPIRV(i));
+    }
+}
+
+TEST_F(ShaderTools_SPIRVCache, CorruptedData)
+{
+    {
+        SPIRVCache Cache{GetCacheDirectory().c_str()};
+        Cache.Add(MakeKey(0), MakeSPIRV(0));
+        Cache.Add(MakeKey(1), MakeSPIRV(1));
+    }
+
+    // Overwrite the last word of the second entry
+    {
+        const std::string DataPath = GetCacheDirectory() + FileSystem::GetSlashSymbol() + "SPIRVCache.dat";
+
+        std::vector<Uint8> Data;
+        {
+            FileWrapper DataFile{DataPath.c_str(), EFileAccessMode::Read};
+            ASSERT_TRUE(DataFile != nullptr);
+            Data.resize(DataFile->GetSize());
+            ASSERT_TRUE(DataFile->Read(Data.data(), Data.size()));
+        }
+        Data.back() ^= 0xFF;
+        {
+            FileWrapper DataFile{DataPath.c_str(), EFileAccessMode::Overwrite};
+            ASSERT_TRUE(DataFile != nullptr);
+            ASSERT_TRUE(DataFile->Write(Data.data(), Data.size()));
+        }
+    }
+
+    SPIRVCache          Cache{GetCacheDirectory().c_str()};
+    std::vector<Uint32> SPIRV;
+    ASSERT_TRUE(Cache.Find(MakeKey(0), SPIRV));
+    EXPECT_EQ(SPIRV, MakeSPIRV(0));
+    EXPECT_FALSE(Cache.Find(MakeKey(1), SPIRV));
+    EXPECT_EQ(Cache.GetStatistics().NumEntries, 1u);
+}
+
+#if !DILIGENT_NO_GLSLANG
+
+// clang-format off
+const std::string ColdVsWarmTestCS{
+R"(
+#version 430 core
+
+layout(rgba8, binding = 0) uniform writeonly image2D g_tex2DUAV;
+
+layout (local_size_x = 16, local_size_y = 16, local_size_z = 1) in;
+
+void main()
+{
+    vec4 Color = vec4(vec2(gl_GlobalInvocationID.xy % 256u) / 256.0, 0.0, 1.0);
+    for (int i = 0; i < ITERATIONS; ++i)
+        Color = fract(Color * 1.5 + sin(Color + float(i)));
+    imageStore(g_tex2DUAV, ivec2(gl_GlobalInvocationID.xy), Color);
+}
+)"
+};
+// clang-format on
+
+// Compiles a set of unique shaders through GLSLangUtils with an empty cache and then
+// again with the cache loaded from the disk, and compares the time of both runs.
+TEST_F(ShaderTools_SPIRVCache, ColdVsWarm)
+{
+    constexpr Uint32 NumShaders = 16;
+
+    GLSLangUtils::InitializeGlslang();
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    auto CompileShaders = [](SPIRVCache& Cache, std::vector<std::vector<unsigned int>>& ByteCode) {
+        ByteCode.resize(NumShaders);
+        for (Uint32 i = 0; i < NumShaders; ++i)
+        {
+            const auto        Iterations = std::to_string(i + 1);
+            const ShaderMacro Macros[]   = {{"ITERATIONS", Iterations.c_str()}, {}};
+
+            ByteCode[i] = GLSLangUtils::GLSLtoSPIRV(SHADER_TYPE_COMPUTE, ColdVsWarmTestCS.c_str(), static_cast<int>(ColdVsWarmTestCS.length()),
+                                                    Macros, nullptr, GLSLangUtils::SpirvVersion::Vk100, nullptr, &Cache);
+        }
+    };
+
+    // Cold run: every lookup misses, and the shaders are compiled and added to the cache
+    std::vector<std::vector<unsigned int>> ColdByteCode;
+
+    auto ColdStart = Clock::now();
+    {
+        SPIRVCache Cache{GetCacheDirectory().c_str()};
+        CompileShaders(Cache, ColdByteCode);
+        const auto Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumMisses, NumShaders);
+        EXPECT_EQ(Stats.NumEntries, NumShaders);
+    }
+    auto ColdTime = std::chrono::duration<double, std::milli>(Clock::now() - ColdStart).count();
+
+    // Warm run: the cache is loaded from the disk and no shader is compiled
+    std::vector<std::vector<unsigned int>> WarmByteCode;
+
+    auto WarmStart = Clock::now();
+    {
+        SPIRVCache Cache{GetCacheDirectory().c_str()};
+        CompileShaders(Cache, WarmByteCode);
+        const auto Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumHits, NumShaders);
+        EXPECT_EQ(Stats.NumMisses, 0u);
+    }
+    auto WarmTime = std::chrono::duration<double, std::milli>(Clock::now() - WarmStart).count();
+
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        EXPECT_FALSE(ColdByteCode[i].empty());
+        EXPECT_EQ(ColdByteCode[i], WarmByteCode[i]);
+    }
+
+    GLSLangUtils::FinalizeGlslang();
+
+    std::cout << "[          ] " << NumShaders << " shaders: cold cache " << ColdTime << " ms, warm cache " << WarmTime << " ms" << std::endl;
+}
+
+#endif
+
+} // namespace
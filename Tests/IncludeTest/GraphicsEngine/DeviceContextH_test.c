@@ -32,13 +32,19 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
     struct IPipelineState*            pPSO                       = NULL;
     struct DrawAttribs                drawAttribs                = {0};
     struct DrawIndexedAttribs         drawIndexedAttribs         = {0};
+    struct MultiDrawAttribs           multiDrawAttribs           = {0};
+    struct MultiDrawIndexedAttribs    multiDrawIndexedAttribs    = {0};
     struct DrawIndirectAttribs        drawIndirectAttribs        = {0};
     struct DrawIndexedIndirectAttribs drawIndexedIndirectAttribs = {0};
     struct IBuffer*                   pIndirectBuffer            = NULL;
+    struct IFence*                    pFence                     = NULL;
 
     IDeviceContext_SetPipelineState(pCtx, pPSO);
     IDeviceContext_Draw(pCtx, &drawAttribs);
     IDeviceContext_DrawIndexed(pCtx, &drawIndexedAttribs);
+    IDeviceContext_MultiDraw(pCtx, &multiDrawAttribs);
+    IDeviceContext_MultiDrawIndexed(pCtx, &multiDrawIndexedAttribs);
     IDeviceContext_DrawIndirect(pCtx, &drawIndirectAttribs, pIndirectBuffer);
     IDeviceContext_DrawIndexedIndirect(pCtx, &drawIndexedIndirectAttribs, pIndirectBuffer);
+    IDeviceContext_DeviceWaitForFence(pCtx, pFence, (Uint64)1);
 }